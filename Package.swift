@@ -134,6 +134,8 @@ let package = Package(
         "src/core/call/client_call.h",
         "src/core/call/custom_metadata.h",
         "src/core/call/filter_fusion.h",
+        "src/core/call/filter_latency.cc",
+        "src/core/call/filter_latency.h",
         "src/core/call/interception_chain.cc",
         "src/core/call/interception_chain.h",
         "src/core/call/message.cc",
@@ -376,6 +378,7 @@ let package = Package(
         "src/core/ext/transport/chttp2/transport/chttp2_transport.h",
         "src/core/ext/transport/chttp2/transport/decode_huff.cc",
         "src/core/ext/transport/chttp2/transport/decode_huff.h",
+        "src/core/ext/transport/chttp2/transport/decode_huff_fast.h",
         "src/core/ext/transport/chttp2/transport/flow_control.cc",
         "src/core/ext/transport/chttp2/transport/flow_control.h",
         "src/core/ext/transport/chttp2/transport/frame.cc",
@@ -1353,9 +1356,12 @@ let package = Package(
         "src/core/lib/event_engine/extensions/channelz.h",
         "src/core/lib/event_engine/extensions/chaotic_good_extension.h",
         "src/core/lib/event_engine/extensions/iomgr_compatible.h",
+        "src/core/lib/event_engine/extensions/pacing.h",
+        "src/core/lib/event_engine/extensions/splice.h",
         "src/core/lib/event_engine/extensions/supports_fd.h",
         "src/core/lib/event_engine/extensions/supports_win_sockets.h",
         "src/core/lib/event_engine/extensions/tcp_trace.h",
+        "src/core/lib/event_engine/extensions/urgent_write.h",
         "src/core/lib/event_engine/grpc_polled_fd.h",
         "src/core/lib/event_engine/handle_containers.h",
         "src/core/lib/event_engine/memory_allocator_factory.h",
@@ -1398,7 +1404,9 @@ let package = Package(
         "src/core/lib/event_engine/posix_engine/timer.cc",
         "src/core/lib/event_engine/posix_engine/timer.h",
         "src/core/lib/event_engine/posix_engine/timer_heap.cc",
+        "src/core/lib/event_engine/posix_engine/timer_wheel.cc",
         "src/core/lib/event_engine/posix_engine/timer_heap.h",
+        "src/core/lib/event_engine/posix_engine/timer_wheel.h",
         "src/core/lib/event_engine/posix_engine/timer_manager.cc",
         "src/core/lib/event_engine/posix_engine/timer_manager.h",
         "src/core/lib/event_engine/posix_engine/traced_buffer_list.cc",
@@ -1449,7 +1457,9 @@ let package = Package(
         "src/core/lib/event_engine/windows/windows_listener.cc",
         "src/core/lib/event_engine/windows/windows_listener.h",
         "src/core/lib/event_engine/work_queue/basic_work_queue.cc",
+        "src/core/lib/event_engine/work_queue/mpmc_ring_work_queue.cc",
         "src/core/lib/event_engine/work_queue/basic_work_queue.h",
+        "src/core/lib/event_engine/work_queue/mpmc_ring_work_queue.h",
         "src/core/lib/event_engine/work_queue/work_queue.h",
         "src/core/lib/experiments/config.cc",
         "src/core/lib/experiments/config.h",
@@ -1797,6 +1807,8 @@ let package = Package(
         "src/core/resolver/dns/c_ares/grpc_ares_wrapper_windows.cc",
         "src/core/resolver/dns/dns_resolver_plugin.cc",
         "src/core/resolver/dns/dns_resolver_plugin.h",
+        "src/core/resolver/dns/event_engine/caching_dns_resolver.cc",
+        "src/core/resolver/dns/event_engine/caching_dns_resolver.h",
         "src/core/resolver/dns/event_engine/event_engine_client_channel_resolver.cc",
         "src/core/resolver/dns/event_engine/event_engine_client_channel_resolver.h",
         "src/core/resolver/dns/event_engine/service_config_helper.cc",
@@ -1832,6 +1844,8 @@ let package = Package(
         "src/core/server/server_config_selector_filter.cc",
         "src/core/server/server_config_selector_filter.h",
         "src/core/server/server_interface.h",
+        "src/core/server/server_latency_histograms.cc",
+        "src/core/server/server_latency_histograms.h",
         "src/core/server/xds_channel_stack_modifier.cc",
         "src/core/server/xds_channel_stack_modifier.h",
         "src/core/server/xds_server_config_fetcher.cc",
@@ -1961,6 +1975,7 @@ let package = Package(
         "src/core/util/grpc_if_nametoindex.h",
         "src/core/util/grpc_if_nametoindex_posix.cc",
         "src/core/util/grpc_if_nametoindex_unsupported.cc",
+        "src/core/util/hamt.h",
         "src/core/util/host_port.cc",
         "src/core/util/host_port.h",
         "src/core/util/http_client/format_request.cc",
@@ -2008,6 +2023,7 @@ let package = Package(
         "src/core/util/packed_table.h",
         "src/core/util/per_cpu.cc",
         "src/core/util/per_cpu.h",
+        "src/core/util/object_pool.h",
         "src/core/util/posix/cpu.cc",
         "src/core/util/posix/directory_reader.cc",
         "src/core/util/posix/env.cc",
@@ -2036,6 +2052,7 @@ let package = Package(
         "src/core/util/strerror.h",
         "src/core/util/string.cc",
         "src/core/util/string.h",
+        "src/core/util/structured_event_log.h",
         "src/core/util/sync.cc",
         "src/core/util/sync.h",
         "src/core/util/sync_abseil.cc",
@@ -122,6 +122,23 @@ GRPCAPI grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
                                               gpr_timespec deadline,
                                               void* reserved);
 
+/** Like grpc_completion_queue_next, but may return several events per
+    call.  Blocks until at least one event is available, the completion
+    queue is being shut down, or deadline is reached, then drains up to
+    \a max_events already-queued events without blocking again.  Fills
+    \a events and returns the number of entries filled (at least 1 if
+    \a max_events > 0).  A GRPC_QUEUE_TIMEOUT or GRPC_QUEUE_SHUTDOWN
+    event, if present, is always the only entry filled.
+
+    Only valid on completion queues of type GRPC_CQ_NEXT.  Callers must
+    not call this and grpc_completion_queue_pluck simultaneously on the
+    same completion queue. */
+GRPCAPI size_t grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                                grpc_event* events,
+                                                size_t max_events,
+                                                gpr_timespec deadline,
+                                                void* reserved);
+
 /** Blocks until an event with tag 'tag' is available, the completion queue is
     being shutdown or deadline is reached.
 
@@ -277,6 +294,16 @@ GRPCAPI void grpc_channel_get_info(grpc_channel* channel,
     to non-experimental or remove it. */
 GRPCAPI void grpc_channel_reset_connect_backoff(grpc_channel* channel);
 
+/** EXPERIMENTAL.  Pre-warms a channel's connections and keeps them warm.
+    Immediately drives the channel out of IDLE, and re-triggers connection
+    establishment any time the channel later reports IDLE (e.g. after a
+    connection is lost).  The number of connections established is
+    determined by the channel's load balancing policy: one for pick_first,
+    one per endpoint for round_robin and similar policies.  Should be
+    called at most once per channel.  No-op for channels that do not
+    support connectivity watching. */
+GRPCAPI void grpc_channel_warm_connections(grpc_channel* channel);
+
 /** --- grpc_channel_credentials object. ---
 
    A channel credentials object represents a way to authenticate a client on a
@@ -57,6 +57,8 @@ GRPCAPI void grpc_server_add_channel_from_fd(grpc_server* server, int fd,
 #ifdef __cplusplus
 }
 
+#include <vector>
+
 namespace grpc_core::experimental {
 
 /**
@@ -73,6 +75,24 @@ namespace grpc_core::experimental {
 grpc_channel* CreateChannelFromFd(int fd, grpc_channel_credentials* creds,
                                   const grpc_channel_args* args);
 
+/**
+ * EXPERIMENTAL API - Subject to change
+ *
+ * Returns the listening socket file descriptors owned by a started server.
+ * This enables zero-downtime restarts: the old process dup()s the returned
+ * fds and passes them to its replacement (e.g. over a unix socket with
+ * SCM_RIGHTS); connections pending in each fd's accept queue travel with
+ * the fd. The new process hands an inherited fd to its server via the
+ * GRPC_ARG_PREALLOCATED_LISTENER_FD channel argument, and clients never
+ * see the listening socket close.
+ *
+ * The returned fds remain owned by the server and are closed on server
+ * shutdown; callers must dup() them before shipping them elsewhere.
+ *
+ * \param server A started server whose listening fds should be returned.
+ */
+std::vector<int> ServerListenFds(grpc_server* server);
+
 }  // namespace grpc_core::experimental
 
 #endif  // __cplusplus
@@ -120,6 +120,17 @@
     before the request is cancelled */
 #define GRPC_ARG_SERVER_MAX_UNREQUESTED_TIME_IN_SERVER_SECONDS \
   "grpc.server_max_unrequested_time_in_server"
+/** If non-zero, the server maintains built-in per-method call latency
+    histograms, readable via channelz and the C++
+    grpc::experimental::GetServerMetricsSnapshot() API. Memory is bounded
+    regardless of the number of methods called. Defaults to 0 (disabled). */
+#define GRPC_ARG_SERVER_PER_METHOD_LATENCY_TRACKING \
+  "grpc.experimental.server_per_method_latency_tracking"
+/** If non-zero, channels using the v3 call stack record per-filter call
+    operation latency histograms, readable via channelz. Defaults to 0
+    (disabled). */
+#define GRPC_ARG_PER_FILTER_LATENCY_TRACKING \
+  "grpc.experimental.per_filter_latency_tracking"
 /** Channel arg to override the http2 :scheme header. String valued. */
 #define GRPC_ARG_HTTP2_SCHEME "grpc.http2_scheme"
 /** How many pings can the client send before needing to send a data/header
@@ -191,6 +202,13 @@
 /** The timeout used on servers for finishing handshaking on an incoming
     connection.  Defaults to 120 seconds. */
 #define GRPC_ARG_SERVER_HANDSHAKE_TIMEOUT_MS "grpc.server_handshake_timeout_ms"
+/** Maximum number of handshakes allowed to run concurrently in the process.
+    Handshakes past the limit wait in a FIFO queue and are started as running
+    handshakes complete, so that a burst of new connections cannot starve
+    established-connection processing with handshake crypto. The handshake
+    deadline keeps running while queued. Defaults to 0 (unlimited). */
+#define GRPC_ARG_MAX_CONCURRENT_HANDSHAKES \
+  "grpc.experimental.max_concurrent_handshakes"
 /** This *should* be used for testing only.
     The caller of the secure_channel_create functions may override the target
     name used for SSL host name checking using this channel argument which is of
@@ -228,6 +246,14 @@
 /** If non-zero, expand wildcard addresses to a list of local addresses. Boolean
  * valued. */
 #define GRPC_ARG_EXPAND_WILDCARD_ADDRS "grpc.expand_wildcard_addrs"
+/** If non-negative, an inherited listening socket file descriptor (e.g.
+   received over SCM_RIGHTS from a previous incarnation of this server) that
+   the server adopts instead of creating and binding a new socket, provided
+   its bound address matches the address being listened on. Connections
+   pending in the fd's accept queue are preserved across the handoff. Only
+   supported on POSIX systems. */
+#define GRPC_ARG_PREALLOCATED_LISTENER_FD \
+  "grpc.experimental.preallocated_listener_fd"
 /** Service config data in JSON form.
     This value will be ignored if the name resolver returns a service config. A
    string value. */
@@ -274,6 +300,42 @@
    default, it is disabled. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED \
   "grpc.experimental.tcp_tx_zerocopy_enabled"
+/* TCP RX Zerocopy enable state: zero is disabled, non-zero is enabled. When
+   enabled, large reads map receive queue pages via TCP_ZEROCOPY_RECEIVE on
+   supported kernels instead of copying, falling back automatically. By
+   default, it is disabled. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED \
+  "grpc.experimental.tcp_rx_zerocopy_enabled"
+/* Number of microseconds the kernel busy-polls the device queue for incoming
+   packets on this connection's sockets (SO_BUSY_POLL). Zero, the default,
+   disables busy polling. Only has an effect on kernels that support it. */
+#define GRPC_ARG_TCP_BUSY_POLL_USEC "grpc.experimental.tcp_busy_poll_usec"
+/* When positive, runs of adjacent read slices shorter than this many bytes
+   are merged into single contiguous slices before a read completes, trading
+   a bounded copy for fewer slice boundaries in downstream parsers. Zero, the
+   default, delivers read slices as received. */
+#define GRPC_ARG_TCP_MIN_COALESCE_READ_BYTES \
+  "grpc.experimental.tcp_min_coalesce_read_bytes"
+/* Number of SO_REUSEPORT listening sockets ("accept shards") a server creates
+   per bound TCP address, letting the kernel spread incoming connections
+   across several accepting fds. 1, the default, keeps a single listening
+   socket per address. Values above 1 are only effective where SO_REUSEPORT is
+   supported and not disabled via GRPC_ARG_ALLOW_REUSEPORT. */
+#define GRPC_ARG_TCP_LISTENER_ACCEPT_SHARDS \
+  "grpc.experimental.tcp_listener_accept_shards"
+/* TCP Fast Open enable state: zero is disabled, non-zero is enabled. When
+   enabled, listeners accept TFO connections (TCP_FASTOPEN) and clients arm
+   TCP_FASTOPEN_CONNECT so that, once a TFO cookie for the server is cached,
+   the first bytes written - the security handshake's first flight - are
+   carried in the SYN payload, saving one round trip on reconnects. Only has
+   an effect on kernels that support it. By default, it is disabled. */
+#define GRPC_ARG_TCP_FAST_OPEN "grpc.experimental.tcp_fast_open"
+/* TCP TX timestamp sampling period: when kernel TX timestamp collection is
+   requested for writes, only one in every N timestamped writes actually
+   arms SO_TIMESTAMPING; the rest are sent untraced. Defaults to 1 (every
+   timestamped write is traced). */
+#define GRPC_ARG_TCP_TX_TIMESTAMP_SAMPLING_PERIOD \
+  "grpc.experimental.tcp_tx_timestamp_sampling_period"
 /* TCP TX Zerocopy send threshold: only zerocopy if >= this many bytes sent. By
    default, this is set to 16KB. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_SEND_BYTES_THRESHOLD \
@@ -391,6 +453,12 @@
  * timeouts/backoff/retry logic, and so the actual DNS resolution may time out
  * sooner than the value specified here. */
 #define GRPC_ARG_DNS_ARES_QUERY_TIMEOUT_MS "grpc.dns_ares_query_timeout"
+/** EXPERIMENTAL. If set to a positive number of milliseconds, hostname
+ * resolution results are cached process-wide for that duration, and expired
+ * entries are served stale while a single deduplicated refresh is in flight.
+ * Useful when many channels in one process resolve the same names. Defaults
+ * to 0 (caching disabled). */
+#define GRPC_ARG_DNS_CACHE_TTL_MS "grpc.dns_cache_ttl_ms"
 /** If set, uses a local subchannel pool within the channel. Otherwise, uses the
  * global subchannel pool. Boolean valued. Defaults to false. */
 #define GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL "grpc.use_local_subchannel_pool"
@@ -412,7 +480,8 @@
  *  Integer value ranging from 0 to 63. */
 #define GRPC_ARG_DSCP "grpc.dscp"
 /** Connection Attempt Delay for use in Happy Eyeballs, in milliseconds.
- *  Defaults to 250ms. */
+ *  Defaults to 250ms; values are clamped to the range [100ms, 2000ms],
+ *  per RFC 8305 section 5. */
 #define GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS \
   "grpc.happy_eyeballs_connection_attempt_delay_ms"
 /** It accepts a MemoryAllocatorFactory as input and If specified, it forces
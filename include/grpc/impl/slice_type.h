@@ -40,8 +40,18 @@ typedef struct grpc_slice grpc_slice;
    constraints (is the callee allowed to modify the slice?) */
 
 /* Inlined half of grpc_slice is allowed to expand the size of the overall type
-   by this many bytes */
+   by this many bytes.
+
+   This may be overridden at build time (e.g. -DGRPC_SLICE_INLINE_EXTRA_SIZE
+   with (2 * sizeof(void*)) or (4 * sizeof(void*)) giving 32/48-byte slices on
+   64-bit platforms) so that workloads whose metadata values commonly exceed
+   the default inline capacity can keep them out of refcounted heap slices.
+   Every translation unit linked into a process - gRPC itself and anything
+   that passes grpc_slice across the API boundary - must be compiled with the
+   same value; mixing values is an ABI break. */
+#ifndef GRPC_SLICE_INLINE_EXTRA_SIZE
 #define GRPC_SLICE_INLINE_EXTRA_SIZE sizeof(void*)
+#endif
 
 #define GRPC_SLICE_INLINED_SIZE \
   (sizeof(size_t) + sizeof(uint8_t*) - 1 + GRPC_SLICE_INLINE_EXTRA_SIZE)
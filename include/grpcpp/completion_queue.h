@@ -184,6 +184,24 @@ class CompletionQueue : private grpc::internal::GrpcLibrary {
             GOT_EVENT);
   }
 
+  /// EXPERIMENTAL
+  /// Read and remove up to \a max_events events from the queue in one
+  /// call.  Blocks until at least one event is available or the queue
+  /// is fully drained and shut down, then drains events that are
+  /// already queued without blocking again.  Semantically equivalent to
+  /// calling Next() repeatedly, but the queue synchronization cost is
+  /// paid once per batch rather than once per event.
+  ///
+  /// \param[out] tags Array of at least \a max_events entries, filled
+  ///        with the tags of the events read.
+  /// \param[out] oks Array of at least \a max_events entries, filled
+  ///        with the success flag of each event; see the documentation
+  ///        for CompletionQueue::Next for the meaning of \a ok.
+  ///
+  /// \return The number of events read, or 0 if the queue is fully
+  ///         drained and shut down.
+  size_t NextBatch(void** tags, bool* oks, size_t max_events);
+
   /// Read from the queue, blocking up to \a deadline (or the queue's shutdown).
   /// Both \a tag and \a ok are updated upon success (if an event is available
   /// within the \a deadline).  A \a tag points to an arbitrary location usually
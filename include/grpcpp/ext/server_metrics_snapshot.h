@@ -0,0 +1,59 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPCPP_EXT_SERVER_METRICS_SNAPSHOT_H
+#define GRPCPP_EXT_SERVER_METRICS_SNAPSHOT_H
+
+#include <grpcpp/server.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace grpc {
+namespace experimental {
+
+/// Latency distribution snapshot for one method served by a server.
+/// Percentiles are interpolated from exponential histogram buckets and
+/// reported in milliseconds.
+struct MethodLatencySnapshot {
+  std::string method;
+  uint64_t count;
+  double p50_ms;
+  double p95_ms;
+  double p99_ms;
+};
+
+/// Snapshot of a server's built-in metrics.
+struct ServerMetricsSnapshot {
+  /// One entry per method seen by the server, ordered by method name. The
+  /// number of individually tracked methods is bounded; calls to methods
+  /// beyond that bound are aggregated under a single "[other]" entry.
+  std::vector<MethodLatencySnapshot> method_latencies;
+};
+
+/// Returns the built-in metrics snapshot for \a server. Per-method latency
+/// tracking must be enabled by building the server with the
+/// GRPC_ARG_SERVER_PER_METHOD_LATENCY_TRACKING channel argument set to a
+/// non-zero value; otherwise the snapshot is empty.
+ServerMetricsSnapshot GetServerMetricsSnapshot(Server* server);
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_EXT_SERVER_METRICS_SNAPSHOT_H
@@ -31,8 +31,12 @@
 #include <grpcpp/support/slice.h>
 #include <grpcpp/support/status.h>
 
+#include <limits>
 #include <type_traits>
 
+#include "absl/log/absl_check.h"
+#include "absl/strings/str_cat.h"
+
 /// This header provides serialization and deserialization between gRPC
 /// messages serialized using protobuf and the C++ objects they represent.
 
@@ -48,11 +52,46 @@ class SerializationTraits<
  public:
   static Status Serialize(const grpc::protobuf::MessageLite& msg,
                           ByteBuffer* bb, bool* own_buffer) {
-    return GenericSerialize<ProtoBufferWriter, T>(msg, bb, own_buffer);
+    // Serialize into a single exactly-sized slice: one allocation sized by
+    // ByteSizeLong, written once via SerializeWithCachedSizesToArray. This
+    // avoids the block-by-block ProtoBufferWriter machinery and keeps the
+    // payload contiguous, which lets the receive side take its
+    // parse-from-array fast path. GenericSerialize is left as is for
+    // callers that instantiate it with custom writer types.
+    *own_buffer = true;
+    const size_t byte_size = msg.ByteSizeLong();
+    if (byte_size > static_cast<size_t>(std::numeric_limits<int>::max())) {
+      return Status(
+          StatusCode::INTERNAL, "Protobuf is too large to be serialized",
+          absl::StrCat(byte_size, " bytes is beyond the limit 2^31-1"));
+    }
+    Slice slice(byte_size);
+    ABSL_CHECK(slice.end() == msg.SerializeWithCachedSizesToArray(
+                                  const_cast<uint8_t*>(slice.begin())));
+    ByteBuffer tmp(&slice, 1);
+    bb->Swap(&tmp);
+    return grpc::Status::OK;
   }
 
   static Status Deserialize(ByteBuffer* buffer,
                             grpc::protobuf::MessageLite* msg) {
+    // When the payload is a single contiguous slice (the common case) parse
+    // directly from the slice's memory, skipping the byte buffer reader and
+    // the ZeroCopyInputStream machinery. Fragmented payloads parse in place
+    // over the slice list via ProtoBufferReader; neither path flattens or
+    // copies the wire bytes.
+    if (buffer != nullptr) {
+      Slice slice;
+      if (buffer->TrySingleSlice(&slice).ok() &&
+          slice.size() <=
+              static_cast<size_t>(std::numeric_limits<int>::max())) {
+        const bool parsed =
+            msg->ParseFromArray(slice.begin(), static_cast<int>(slice.size()));
+        buffer->Clear();
+        if (parsed) return grpc::Status::OK;
+        return Status(StatusCode::INTERNAL, msg->InitializationErrorString());
+      }
+    }
     return GenericDeserialize<ProtoBufferReader, T>(buffer, msg);
   }
 };
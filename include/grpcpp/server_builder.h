@@ -295,6 +295,16 @@ class ServerBuilder {
     void EnableCallMetricRecording(
         experimental::ServerMetricRecorder* server_metric_recorder = nullptr);
 
+    /// Caps the number of RPCs concurrently handed to the application per
+    /// method for services using the callback (or sync) API. Overflow RPCs
+    /// are answered RESOURCE_EXHAUSTED before their request payload is
+    /// read. A \a max_concurrent_requests of 0 means unlimited. When
+    /// \a shed_on_memory_pressure is true, new RPCs are additionally
+    /// rejected while the server's resource quota reports high memory
+    /// pressure, shrinking the server's footprint under overload.
+    void SetMaxConcurrentCallbackRequests(int max_concurrent_requests,
+                                          bool shed_on_memory_pressure = false);
+
     // Creates a passive listener for Server Endpoint injection.
     ///
     /// \a PassiveListener lets applications provide pre-established connections
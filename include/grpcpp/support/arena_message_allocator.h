@@ -0,0 +1,64 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPCPP_SUPPORT_ARENA_MESSAGE_ALLOCATOR_H
+#define GRPCPP_SUPPORT_ARENA_MESSAGE_ALLOCATOR_H
+
+#include <grpcpp/impl/codegen/config_protobuf.h>
+#include <grpcpp/support/message_allocator.h>
+
+namespace grpc {
+
+/// A ready-made MessageAllocator that places each RPC's request and response
+/// on a google::protobuf::Arena owned by that RPC. Unlike the default
+/// allocation strategy - which constructs the message objects in the call's
+/// memory but leaves their internal allocations (strings, submessages,
+/// repeated fields) on the heap - an arena-allocated message pools all of its
+/// internal allocations with the messages themselves.
+///
+/// Register it per method via the generated
+/// SetMessageAllocatorFor_<Method>() hook:
+///
+///   ArenaMessageAllocator<EchoRequest, EchoResponse> allocator;
+///   service.SetMessageAllocatorFor_Echo(&allocator);
+///
+/// The allocator must outlive the server. The arena, and with it both
+/// messages, is destroyed when the RPC completes; requests cannot be freed
+/// ahead of the response (FreeRequest is a no-op).
+template <typename RequestT, typename ResponseT>
+class ArenaMessageAllocator : public MessageAllocator<RequestT, ResponseT> {
+ public:
+  MessageHolder<RequestT, ResponseT>* AllocateMessages() override {
+    return new MessageHolderImpl;
+  }
+
+ private:
+  class MessageHolderImpl : public MessageHolder<RequestT, ResponseT> {
+   public:
+    MessageHolderImpl() {
+      this->set_request(protobuf::Arena::Create<RequestT>(&arena_));
+      this->set_response(protobuf::Arena::Create<ResponseT>(&arena_));
+    }
+    // Both messages live on the arena: nothing can be freed early.
+    void FreeRequest() override {}
+    void Release() override { delete this; }
+
+   private:
+    protobuf::Arena arena_;
+  };
+};
+
+}  // namespace grpc
+
+#endif  // GRPCPP_SUPPORT_ARENA_MESSAGE_ALLOCATOR_H
@@ -93,6 +93,14 @@ class ByteBuffer final {
   /// size-independent.
   ByteBuffer(const ByteBuffer& buf) : buffer_(nullptr) { operator=(buf); }
 
+  /// Construct by taking over the contents of \a buf, leaving it empty.
+  /// Unlike copying this touches no slice refcounts and performs no
+  /// allocation, so it is the cheapest way to hand a received buffer onward
+  /// (e.g. when proxying generic calls).
+  ByteBuffer(ByteBuffer&& buf) noexcept : buffer_(buf.buffer_) {
+    buf.buffer_ = nullptr;
+  }
+
   ~ByteBuffer() {
     if (buffer_) {
       grpc_byte_buffer_destroy(buffer_);
@@ -113,6 +121,16 @@ class ByteBuffer final {
     return *this;
   }
 
+  /// Take over the contents of \a buf, leaving it empty.
+  ByteBuffer& operator=(ByteBuffer&& buf) noexcept {
+    if (this != &buf) {
+      Clear();
+      buffer_ = buf.buffer_;
+      buf.buffer_ = nullptr;
+    }
+    return *this;
+  }
+
   // If this ByteBuffer's representation is a single flat slice, returns a
   // slice referencing that array.
   Status TrySingleSlice(Slice* slice) const;
@@ -120,6 +138,13 @@ class ByteBuffer final {
   /// Dump (read) the buffer contents into \a slics.
   Status DumpToSingleSlice(Slice* slice) const;
 
+  /// Get the buffer contents as a single contiguous slice, without copying
+  /// when possible: if the buffer already consists of a single uncompressed
+  /// slice (the common case for small messages) the returned slice merely
+  /// references it; otherwise the contents are copied as in
+  /// DumpToSingleSlice.
+  Status FlattenToSlice(Slice* slice) const;
+
   /// Dump (read) the buffer contents into \a slices.
   Status Dump(std::vector<Slice>* slices) const;
 
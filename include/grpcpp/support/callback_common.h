@@ -24,11 +24,15 @@
 #include <grpcpp/impl/call.h>
 #include <grpcpp/impl/codegen/channel_interface.h>
 #include <grpcpp/impl/completion_queue_tag.h>
+#include <grpcpp/impl/sync.h>
 #include <grpcpp/support/config.h>
 #include <grpcpp/support/global_callback_hook.h>
 #include <grpcpp/support/status.h>
 
+#include <deque>
 #include <functional>
+#include <limits>
+#include <vector>
 
 #include "absl/log/absl_check.h"
 
@@ -65,6 +69,131 @@ Reactor* CatchingReactorGetter(Func&& func, Args&&... args) {
 #endif  // GRPC_ALLOW_EXCEPTIONS
 }
 
+// Shared machinery behind ClientPipelinedReadReactor and
+// ServerPipelinedReadReactor. The core call permits only a single
+// outstanding recv_message op, so "n reads outstanding" is realized as a
+// ring of n message slots: when a read completes into one slot, the next
+// read is started into a free slot before the completed message is handed
+// to the application. The transport thus keeps reading while the
+// application processes messages, and bursts of up to n messages are
+// buffered without stalling the pipeline. Deliveries are serialized here
+// even though raw reactions may be invoked concurrently. Derived must
+// provide StartRead(Message*), OnReadMessage(Message&), and OnReadsDone().
+template <class Message, class Derived>
+class PipelinedReadStateMachine {
+ protected:
+  // Sizes the slot ring and starts the first read. Called at most once.
+  void BeginReads(size_t slots) ABSL_LOCKS_EXCLUDED(mu_) {
+    {
+      grpc::internal::MutexLock lock(&mu_);
+      ring_.resize(slots < 2 ? 2 : slots);
+      free_slots_ = ring_.size() - 1;
+      next_slot_ = 1;
+    }
+    in_flight_slot_ = 0;
+    static_cast<Derived*>(this)->StartRead(&ring_[0]);
+  }
+
+  // Must be invoked from the reactor's OnReadDone reaction.
+  void ReadDone(bool ok) ABSL_LOCKS_EXCLUDED(mu_) {
+    size_t arm = kNoSlot;
+    bool deliver = false;
+    {
+      grpc::internal::MutexLock lock(&mu_);
+      if (!ok) {
+        reads_done_ = true;
+      } else {
+        ready_.push_back(in_flight_slot_);
+        if (free_slots_ > 0) {
+          --free_slots_;
+          arm = next_slot_;
+          next_slot_ = (next_slot_ + 1) % ring_.size();
+        } else {
+          read_stalled_ = true;
+        }
+      }
+      if (!delivering_) {
+        delivering_ = true;
+        deliver = true;
+      }
+    }
+    // Re-arm before delivering so the transport fetches the next message
+    // while the application processes this one.
+    if (arm != kNoSlot) {
+      ArmRead(arm);
+    }
+    if (deliver) {
+      Drain();
+    }
+  }
+
+ private:
+  static constexpr size_t kNoSlot = std::numeric_limits<size_t>::max();
+
+  void ArmRead(size_t slot) {
+    // in_flight_slot_ is published to the next ReadDone by the read op's
+    // completion edge, the same ordering that makes the slot written by
+    // StartRead visible there.
+    in_flight_slot_ = slot;
+    static_cast<Derived*>(this)->StartRead(&ring_[slot]);
+  }
+
+  // Hands ready messages to the application one at a time. Only one thread
+  // drains at a time, so OnReadMessage is never invoked concurrently.
+  void Drain() ABSL_LOCKS_EXCLUDED(mu_) {
+    while (true) {
+      size_t slot;
+      {
+        grpc::internal::MutexLock lock(&mu_);
+        if (ready_.empty()) {
+          if (reads_done_ && !reads_done_notified_) {
+            // No further reactions will arrive, so nothing else can enter
+            // the drain loop; notify end-of-stream outside the lock.
+            reads_done_notified_ = true;
+            break;
+          }
+          delivering_ = false;
+          return;
+        }
+        slot = ready_.front();
+        ready_.pop_front();
+      }
+      static_cast<Derived*>(this)->OnReadMessage(ring_[slot]);
+      size_t arm = kNoSlot;
+      {
+        grpc::internal::MutexLock lock(&mu_);
+        ++free_slots_;
+        if (read_stalled_ && !reads_done_) {
+          read_stalled_ = false;
+          --free_slots_;
+          arm = next_slot_;
+          next_slot_ = (next_slot_ + 1) % ring_.size();
+        }
+      }
+      if (arm != kNoSlot) {
+        ArmRead(arm);
+      }
+    }
+    static_cast<Derived*>(this)->OnReadsDone();
+  }
+
+  grpc::internal::Mutex mu_;
+  // Sized once in BeginReads and never resized; slots are only touched by
+  // the single in-flight read or the single draining thread.
+  std::vector<Message> ring_;
+  // Slots holding completed messages, in arrival order.
+  std::deque<size_t> ready_ ABSL_GUARDED_BY(mu_);
+  size_t free_slots_ ABSL_GUARDED_BY(mu_) = 0;
+  size_t next_slot_ ABSL_GUARDED_BY(mu_) = 0;
+  // Owned by whichever thread armed the most recent read; see ArmRead.
+  size_t in_flight_slot_ = 0;
+  // A read completed with no free slot; re-arm as soon as one frees up.
+  bool read_stalled_ ABSL_GUARDED_BY(mu_) = false;
+  bool delivering_ ABSL_GUARDED_BY(mu_) = false;
+  bool reads_done_ ABSL_GUARDED_BY(mu_) = false;
+  bool reads_done_notified_ ABSL_GUARDED_BY(mu_) = false;
+};
+
 // The contract on these tags is that they are single-shot. They must be
 // constructed and then fired at exactly one point. There is no expectation
 // that they can be reused without reconstruction.
@@ -83,15 +212,16 @@ class CallbackWithStatusTag : public grpc_completion_queue_functor {
   // there are no tests catching the compiler warning.
   static void operator delete(void*, void*) { ABSL_CHECK(false); }
 
+  // can_inline indicates that this particular callback can be executed inline
+  // (without needing a thread hop); for client-side callbacks this is only
+  // safe when the application has opted in because its callback is known to
+  // be non-blocking.
   CallbackWithStatusTag(grpc_call* call, std::function<void(Status)>&& f,
-                        CompletionQueueTag* ops)
+                        CompletionQueueTag* ops, bool can_inline = false)
       : call_(call), func_(std::move(f)), ops_(ops) {
     grpc_call_ref(call);
     functor_run = &CallbackWithStatusTag::StaticRun;
-    // A client-side callback should never be run inline since they will always
-    // have work to do from the user application. So, set the parent's
-    // inlineable field to false
-    inlineable = false;
+    inlineable = can_inline;
   }
   ~CallbackWithStatusTag() {}
   Status* status_ptr() { return &status_; }
@@ -91,7 +91,8 @@ class CallbackUnaryCallImpl {
         static_cast<OpSetAndTag*>(grpc_call_arena_alloc(call.call(), alloc_sz));
     auto* ops = new (&alloced->opset) FullCallOpSet;
     auto* tag = new (&alloced->tag) grpc::internal::CallbackWithStatusTag(
-        call.call(), std::move(on_completion), ops);
+        call.call(), std::move(on_completion), ops,
+        context->inline_callbacks_);
 
     // TODO(vjpai): Unify code with sync API as much as possible
     grpc::Status s = ops->SendMessagePtr(request);
@@ -387,6 +388,39 @@ class ClientReadReactor : public internal::ClientReactor {
   ClientCallbackReader<Response>* reader_;
 };
 
+/// \a ClientPipelinedReadReactor is a ClientReadReactor that keeps the read
+/// pipeline of a server-streaming RPC full. Instead of issuing StartRead and
+/// waiting for OnReadDone one message at a time, call StartReads(n) once:
+/// reads are cycled through a ring of n message slots, and the next read is
+/// started before each completed message is delivered, so the transport
+/// keeps reading while the application processes messages. Messages arrive
+/// via OnReadMessage, which is never invoked concurrently, followed by
+/// OnReadsDone once the stream ends. Do not call StartRead or override
+/// OnReadDone when using this reactor.
+template <class Response>
+class ClientPipelinedReadReactor
+    : public ClientReadReactor<Response>,
+      private internal::PipelinedReadStateMachine<
+          Response, ClientPipelinedReadReactor<Response>> {
+ public:
+  /// Start the read pipeline with \a slots message slots (values below 2
+  /// provide no pipelining and are rounded up). Call at most once, typically
+  /// just before StartCall.
+  void StartReads(size_t slots) { this->BeginReads(slots); }
+
+  /// Notifies the application of a new message. Invocations are serialized,
+  /// and \a msg is only valid for the duration of the call.
+  virtual void OnReadMessage(Response& msg) = 0;
+
+  /// Notifies the application that no further messages will arrive.
+  virtual void OnReadsDone() {}
+
+ private:
+  friend class internal::PipelinedReadStateMachine<
+      Response, ClientPipelinedReadReactor<Response>>;
+  void OnReadDone(bool ok) final { this->ReadDone(ok); }
+};
+
 /// \a ClientWriteReactor is the interface for a client-streaming RPC.
 /// All public methods behave as in ClientBidiReactor.
 template <class Request>
@@ -556,7 +590,7 @@ class ClientCallbackReaderWriterImpl
           reactor_->OnWritesDoneDone(ok);
           MaybeFinish(/*from_reaction=*/true);
         },
-        &writes_done_ops_, /*can_inline=*/false);
+        &writes_done_ops_, context_->inline_callbacks_);
     writes_done_ops_.set_core_cq_tag(&writes_done_tag_);
     callbacks_outstanding_.fetch_add(1, std::memory_order_relaxed);
     if (GPR_UNLIKELY(corked_write_needed_)) {
@@ -600,7 +634,7 @@ class ClientCallbackReaderWriterImpl
               ok && !reactor_->InternalTrailersOnly(call_.call()));
           MaybeFinish(/*from_reaction=*/true);
         },
-        &start_ops_, /*can_inline=*/false);
+        &start_ops_, context_->inline_callbacks_);
     start_ops_.RecvInitialMetadata(context_);
     start_ops_.set_core_cq_tag(&start_tag_);
 
@@ -610,7 +644,7 @@ class ClientCallbackReaderWriterImpl
           reactor_->OnWriteDone(ok);
           MaybeFinish(/*from_reaction=*/true);
         },
-        &write_ops_, /*can_inline=*/false);
+        &write_ops_, context_->inline_callbacks_);
     write_ops_.set_core_cq_tag(&write_tag_);
 
     read_tag_.Set(
@@ -619,7 +653,7 @@ class ClientCallbackReaderWriterImpl
           reactor_->OnReadDone(ok);
           MaybeFinish(/*from_reaction=*/true);
         },
-        &read_ops_, /*can_inline=*/false);
+        &read_ops_, context_->inline_callbacks_);
     read_ops_.set_core_cq_tag(&read_tag_);
 
     // Also set up the Finish tag and op set.
@@ -627,7 +661,7 @@ class ClientCallbackReaderWriterImpl
         call_.call(),
         [this](bool /*ok*/) { MaybeFinish(/*from_reaction=*/true); },
         &finish_ops_,
-        /*can_inline=*/false);
+        context_->inline_callbacks_);
     finish_ops_.ClientRecvStatus(context_, &finish_status_);
     finish_ops_.set_core_cq_tag(&finish_tag_);
   }
@@ -746,7 +780,7 @@ class ClientCallbackReaderImpl : public ClientCallbackReader<Response> {
               ok && !reactor_->InternalTrailersOnly(call_.call()));
           MaybeFinish(/*from_reaction=*/true);
         },
-        &start_ops_, /*can_inline=*/false);
+        &start_ops_, context_->inline_callbacks_);
     start_ops_.SendInitialMetadata(&context_->send_initial_metadata_,
                                    context_->initial_metadata_flags());
     start_ops_.RecvInitialMetadata(context_);
@@ -760,7 +794,7 @@ class ClientCallbackReaderImpl : public ClientCallbackReader<Response> {
           reactor_->OnReadDone(ok);
           MaybeFinish(/*from_reaction=*/true);
         },
-        &read_ops_, /*can_inline=*/false);
+        &read_ops_, context_->inline_callbacks_);
     read_ops_.set_core_cq_tag(&read_tag_);
 
     {
@@ -774,7 +808,7 @@ class ClientCallbackReaderImpl : public ClientCallbackReader<Response> {
     finish_tag_.Set(
         call_.call(),
         [this](bool /*ok*/) { MaybeFinish(/*from_reaction=*/true); },
-        &finish_ops_, /*can_inline=*/false);
+        &finish_ops_, context_->inline_callbacks_);
     finish_ops_.ClientRecvStatus(context_, &finish_status_);
     finish_ops_.set_core_cq_tag(&finish_tag_);
     call_.PerformOps(&finish_ops_);
@@ -960,7 +994,7 @@ class ClientCallbackWriterImpl : public ClientCallbackWriter<Request> {
           reactor_->OnWritesDoneDone(ok);
           MaybeFinish(/*from_reaction=*/true);
         },
-        &writes_done_ops_, /*can_inline=*/false);
+        &writes_done_ops_, context_->inline_callbacks_);
     writes_done_ops_.set_core_cq_tag(&writes_done_tag_);
     callbacks_outstanding_.fetch_add(1, std::memory_order_relaxed);
 
@@ -1007,7 +1041,7 @@ class ClientCallbackWriterImpl : public ClientCallbackWriter<Request> {
               ok && !reactor_->InternalTrailersOnly(call_.call()));
           MaybeFinish(/*from_reaction=*/true);
         },
-        &start_ops_, /*can_inline=*/false);
+        &start_ops_, context_->inline_callbacks_);
     start_ops_.RecvInitialMetadata(context_);
     start_ops_.set_core_cq_tag(&start_tag_);
 
@@ -1017,7 +1051,7 @@ class ClientCallbackWriterImpl : public ClientCallbackWriter<Request> {
           reactor_->OnWriteDone(ok);
           MaybeFinish(/*from_reaction=*/true);
         },
-        &write_ops_, /*can_inline=*/false);
+        &write_ops_, context_->inline_callbacks_);
     write_ops_.set_core_cq_tag(&write_tag_);
 
     // Also set up the Finish tag and op set.
@@ -1027,7 +1061,7 @@ class ClientCallbackWriterImpl : public ClientCallbackWriter<Request> {
         call_.call(),
         [this](bool /*ok*/) { MaybeFinish(/*from_reaction=*/true); },
         &finish_ops_,
-        /*can_inline=*/false);
+        context_->inline_callbacks_);
     finish_ops_.ClientRecvStatus(context_, &finish_status_);
     finish_ops_.set_core_cq_tag(&finish_tag_);
   }
@@ -1136,7 +1170,7 @@ class ClientCallbackUnaryImpl final : public ClientCallbackUnary {
               ok && !reactor_->InternalTrailersOnly(call_.call()));
           MaybeFinish();
         },
-        &start_ops_, /*can_inline=*/false);
+        &start_ops_, context_->inline_callbacks_);
     start_ops_.SendInitialMetadata(&context_->send_initial_metadata_,
                                    context_->initial_metadata_flags());
     start_ops_.RecvInitialMetadata(context_);
@@ -1145,7 +1179,7 @@ class ClientCallbackUnaryImpl final : public ClientCallbackUnary {
 
     finish_tag_.Set(
         call_.call(), [this](bool /*ok*/) { MaybeFinish(); }, &finish_ops_,
-        /*can_inline=*/false);
+        context_->inline_callbacks_);
     finish_ops_.ClientRecvStatus(context_, &finish_status_);
     finish_ops_.set_core_cq_tag(&finish_tag_);
     call_.PerformOps(&finish_ops_);
@@ -582,6 +582,40 @@ class ServerReadReactor : public internal::ServerReactor {
   PreBindBacklog backlog_ ABSL_GUARDED_BY(reader_mu_);
 };
 
+/// \a ServerPipelinedReadReactor is a ServerReadReactor that keeps the read
+/// pipeline of a client-streaming RPC full. Instead of issuing StartRead and
+/// waiting for OnReadDone one message at a time, call StartReads(n) once:
+/// reads are cycled through a ring of n message slots, and the next read is
+/// started before each completed message is delivered, so the transport
+/// keeps reading while the application processes messages. Messages arrive
+/// via OnReadMessage, which is never invoked concurrently, followed by
+/// OnReadsDone once the client closes the stream. Do not call StartRead or
+/// override OnReadDone when using this reactor.
+template <class Request>
+class ServerPipelinedReadReactor
+    : public ServerReadReactor<Request>,
+      private internal::PipelinedReadStateMachine<
+          Request, ServerPipelinedReadReactor<Request>> {
+ public:
+  /// Start the read pipeline with \a slots message slots (values below 2
+  /// provide no pipelining and are rounded up). Call at most once, typically
+  /// from the method handler that created the reactor.
+  void StartReads(size_t slots) { this->BeginReads(slots); }
+
+  /// Notifies the application of a new message. Invocations are serialized,
+  /// and \a msg is only valid for the duration of the call.
+  virtual void OnReadMessage(Request& msg) = 0;
+
+  /// Notifies the application that no further messages will arrive; this is
+  /// where the reactor would typically Finish.
+  virtual void OnReadsDone() {}
+
+ private:
+  friend class internal::PipelinedReadStateMachine<
+      Request, ServerPipelinedReadReactor<Request>>;
+  void OnReadDone(bool ok) final { this->ReadDone(ok); }
+};
+
 /// \a ServerWriteReactor is the interface for a server-streaming RPC.
 template <class Response>
 class ServerWriteReactor : public internal::ServerReactor {
@@ -141,6 +141,38 @@ class WriterInterface {
   void WriteLast(const W& msg, grpc::WriteOptions options) {
     Write(msg, options.set_last_message());
   }
+
+  /// Block to write \a count messages from \a msgs to the stream as one
+  /// burst, using WriteOptions \a options for the final message.
+  ///
+  /// All messages before the last carry the buffer_hint flag, so the
+  /// transport coalesces the batch in its write buffer and flushes it in
+  /// one combined write when the final message goes down, rather than
+  /// flushing once per message.
+  ///
+  /// \param[in] msgs The messages to be written to the stream.
+  /// \param[in] count The number of messages in \a msgs.
+  /// \param[in] options The WriteOptions to be used for the final message.
+  ///
+  /// \return \a true on success, \a false when the stream has been closed.
+  bool WriteBatch(const W* msgs, size_t count, grpc::WriteOptions options) {
+    for (size_t i = 0; i + 1 < count; ++i) {
+      grpc::WriteOptions corked = options;
+      if (!Write(msgs[i], corked.set_buffer_hint())) {
+        return false;
+      }
+    }
+    if (count == 0) {
+      return true;
+    }
+    return Write(msgs[count - 1], options);
+  }
+
+  /// Block to write \a count messages from \a msgs with default write
+  /// options for the final message; see the three-argument overload.
+  bool WriteBatch(const W* msgs, size_t count) {
+    return WriteBatch(msgs, count, grpc::WriteOptions());
+  }
 };
 
 }  // namespace internal
@@ -14,14 +14,49 @@
 
 #include "src/core/call/call_arena_allocator.h"
 
+#include <grpc/support/alloc.h>
 #include <grpc/support/port_platform.h>
 
 #include <algorithm>
 
 namespace grpc_core {
 
+namespace {
+// Don't park blocks much larger than typical call arenas: an idle channel
+// would pin that memory until its next call (or forever).
+constexpr size_t kMaxRetainedStorageSize = 64 * 1024;
+}  // namespace
+
+CallArenaAllocator::~CallArenaAllocator() {
+  void* storage = retained_storage_.load(std::memory_order_relaxed);
+  if (storage != nullptr) gpr_free_aligned(storage);
+}
+
 void CallArenaAllocator::FinalizeArena(Arena* arena) {
   call_size_estimator_.UpdateCallSizeEstimate(arena->TotalUsedBytes());
 }
 
+bool CallArenaAllocator::ReturnArenaStorage(void* storage, size_t size) {
+  if (size > kMaxRetainedStorageSize) return false;
+  // The block carries no live data while parked, so borrow its leading bytes
+  // to remember its size.
+  *static_cast<size_t*>(storage) = size;
+  void* prev = retained_storage_.exchange(storage, std::memory_order_acq_rel);
+  if (prev != nullptr) gpr_free_aligned(prev);
+  return true;
+}
+
+void* CallArenaAllocator::TakeArenaStorage(size_t size) {
+  void* storage =
+      retained_storage_.exchange(nullptr, std::memory_order_acquire);
+  if (storage == nullptr) return nullptr;
+  if (*static_cast<size_t*>(storage) != size) {
+    // The call size estimate moved since this block was parked; exact size
+    // matching keeps memory quota accounting identical to a fresh allocation.
+    gpr_free_aligned(storage);
+    return nullptr;
+  }
+  return storage;
+}
+
 }  // namespace grpc_core
@@ -74,16 +74,30 @@ class CallArenaAllocator final : public ArenaFactory {
       : ArenaFactory(std::move(allocator)),
         call_size_estimator_(initial_size) {}
 
+  ~CallArenaAllocator() override;
+
   RefCountedPtr<Arena> MakeArena() override {
     return Arena::Create(call_size_estimator_.CallSizeEstimate(), Ref());
   }
 
   void FinalizeArena(Arena* arena) override;
 
+  // Retains the initial block of the most recently destroyed call so the
+  // next call on this channel can reuse it. Unlike the per-thread block cache
+  // in arena.cc this works across threads, which matters for serial traffic
+  // where calls are created on application threads but destroyed on event
+  // engine threads.
+  bool ReturnArenaStorage(void* storage, size_t size) override;
+  void* TakeArenaStorage(size_t size) override;
+
   size_t CallSizeEstimate() { return call_size_estimator_.CallSizeEstimate(); }
 
  private:
   CallSizeEstimator call_size_estimator_;
+  // Single parked block; its size is stashed in its leading bytes while it
+  // sits here (the memory is dead until the next arena placement-news over
+  // it).
+  std::atomic<void*> retained_storage_{nullptr};
 };
 
 }  // namespace grpc_core
@@ -25,6 +25,7 @@
 
 #include "absl/log/check.h"
 #include "src/core/call/call_state.h"
+#include "src/core/call/filter_latency.h"
 #include "src/core/call/message.h"
 #include "src/core/call/metadata.h"
 #include "src/core/lib/promise/for_each.h"
@@ -313,6 +314,22 @@ struct Operator {
   // Note that if the promise always finishes on the first poll, then supplying
   // this method is unnecessary (as it will never be called).
   void (*early_destroy)(void* promise_data);
+  // Index of the owning filter in the stack's FilterLatencyCollector.
+  // Assigned by StackBuilder::Add; only meaningful when latency tracking
+  // is enabled for the stack.
+  size_t latency_index = 0;
+};
+
+// Name for a filter in latency attribution output: the filter's TypeName()
+// when it has one, a placeholder otherwise (e.g. the lambda-wrapping
+// interceptors below).
+template <typename T, typename = void>
+struct FilterNameGetter {
+  static absl::string_view Name() { return "<unnamed filter>"; }
+};
+template <typename T>
+struct FilterNameGetter<T, absl::void_t<decltype(T::TypeName())>> {
+  static absl::string_view Name() { return T::TypeName(); }
 };
 
 struct HalfCloseOperator {
@@ -1071,6 +1088,10 @@ struct StackData {
   // A list of functions to call when this stack data is destroyed
   // (to capture ownership of channel data)
   std::vector<ChannelDataDestructor> channel_data_destructors;
+  // When non-null, per-filter latency attribution is enabled for this
+  // stack: each operator carries an index into this collector, and the
+  // operation executors record elapsed time per operator into it.
+  RefCountedPtr<FilterLatencyCollector> latency_collector;
 
   bool empty() const {
     return filter_constructor.empty() && filter_destructor.empty() &&
@@ -1270,7 +1291,9 @@ class OperationExecutor {
   OperationExecutor(const OperationExecutor&) = delete;
   OperationExecutor& operator=(const OperationExecutor&) = delete;
   OperationExecutor(OperationExecutor&& other) noexcept
-      : ops_(other.ops_), end_ops_(other.end_ops_) {
+      : ops_(other.ops_),
+        end_ops_(other.end_ops_),
+        latency_collector_(other.latency_collector_) {
     // Movable iff we're not running.
     DCHECK_EQ(other.promise_data_, nullptr);
   }
@@ -1279,6 +1302,7 @@ class OperationExecutor {
     DCHECK_EQ(promise_data_, nullptr);
     ops_ = other.ops_;
     end_ops_ = other.end_ops_;
+    latency_collector_ = other.latency_collector_;
     return *this;
   }
   // IsRunning() is true if we're currently executing a sequence of operations.
@@ -1286,7 +1310,10 @@ class OperationExecutor {
   // Start executing a layout. May allocate space to store the relevant promise.
   // Returns the result of the first poll.
   // If the promise finishes, also destroy the promise data.
-  Poll<ResultOr<T>> Start(const Layout<T>* layout, T input, void* call_data);
+  // If `latency_collector` is non-null, the elapsed time of each operation
+  // (first poll through resolution) is recorded against its filter.
+  Poll<ResultOr<T>> Start(const Layout<T>* layout, T input, void* call_data,
+                          FilterLatencyCollector* latency_collector = nullptr);
   // Continue executing a layout. Returns the result of the next poll.
   // If the promise finishes, also destroy the promise data.
   Poll<ResultOr<T>> Step(void* call_data);
@@ -1310,6 +1337,10 @@ class OperationExecutor {
   void* promise_data_ = nullptr;
   const Operator<T>* ops_;
   const Operator<T>* end_ops_;
+  // Latency attribution; null unless enabled for the stack being executed.
+  FilterLatencyCollector* latency_collector_ = nullptr;
+  // First-poll timestamp of the currently in-flight operation.
+  gpr_cycle_counter op_start_cycles_ = 0;
 };
 
 template <typename T>
@@ -1323,9 +1354,11 @@ GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION inline OperationExecutor<
 
 template <typename T>
 GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION inline Poll<ResultOr<T>>
-OperationExecutor<T>::Start(const Layout<T>* layout, T input, void* call_data) {
+OperationExecutor<T>::Start(const Layout<T>* layout, T input, void* call_data,
+                            FilterLatencyCollector* latency_collector) {
   ops_ = layout->ops.data();
   end_ops_ = ops_ + layout->ops.size();
+  latency_collector_ = latency_collector;
   if (layout->promise_size == 0) {
     // No call state ==> instantaneously ready
     auto r = InitStep(std::move(input), call_data);
@@ -1345,10 +1378,17 @@ OperationExecutor<T>::InitStep(T input, void* call_data) {
     if (ops_ == end_ops_) {
       return ResultOr<T>{std::move(input), nullptr};
     }
+    if (GPR_UNLIKELY(latency_collector_ != nullptr)) {
+      op_start_cycles_ = gpr_get_cycle_counter();
+    }
     auto p =
         ops_->promise_init(promise_data_, Offset(call_data, ops_->call_offset),
                            ops_->channel_data, std::move(input));
     if (auto* r = p.value_if_ready()) {
+      if (GPR_UNLIKELY(latency_collector_ != nullptr)) {
+        latency_collector_->Record(ops_->latency_index, op_start_cycles_,
+                                   gpr_get_cycle_counter());
+      }
       if (r->ok == nullptr) {
         ops_ = end_ops_;
         return std::move(*r);
@@ -1378,6 +1418,10 @@ GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION inline Poll<ResultOr<T>>
 OperationExecutor<T>::ContinueStep(void* call_data) {
   auto p = ops_->poll(promise_data_);
   if (auto* r = p.value_if_ready()) {
+    if (GPR_UNLIKELY(latency_collector_ != nullptr)) {
+      latency_collector_->Record(ops_->latency_index, op_start_cycles_,
+                                 gpr_get_cycle_counter());
+    }
     if (r->ok == nullptr) return std::move(*r);
     ++ops_;
     return InitStep(std::move(r->ok), call_data);
@@ -1567,9 +1611,24 @@ class CallFilters {
    public:
     ~StackBuilder();
 
+    // Enable per-filter latency attribution for the stack being built.
+    // Must be called before any filters are added.
+    void SetLatencyCollector(RefCountedPtr<FilterLatencyCollector> collector) {
+      DCHECK(data_.client_initial_metadata.ops.empty());
+      data_.latency_collector = std::move(collector);
+    }
+
     template <typename FilterType>
     void Add(FilterType* filter) {
       const size_t call_offset = data_.AddFilter<FilterType>(filter);
+      const size_t client_initial_metadata_ops =
+          data_.client_initial_metadata.ops.size();
+      const size_t server_initial_metadata_ops =
+          data_.server_initial_metadata.ops.size();
+      const size_t client_to_server_message_ops =
+          data_.client_to_server_messages.ops.size();
+      const size_t server_to_client_message_ops =
+          data_.server_to_client_messages.ops.size();
       data_.AddClientInitialMetadataOp(filter, call_offset);
       data_.AddServerInitialMetadataOp(filter, call_offset);
       data_.AddClientToServerMessageOp(filter, call_offset);
@@ -1577,6 +1636,18 @@ class CallFilters {
       data_.AddServerToClientMessageOp(filter, call_offset);
       data_.AddServerTrailingMetadataOp(filter, call_offset);
       data_.AddFinalizer(filter, call_offset, &FilterType::Call::OnFinalize);
+      if (data_.latency_collector != nullptr) {
+        const size_t latency_index = data_.latency_collector->RegisterFilter(
+            filters_detail::FilterNameGetter<FilterType>::Name());
+        TagLatencyIndex(data_.client_initial_metadata,
+                        client_initial_metadata_ops, latency_index);
+        TagLatencyIndex(data_.server_initial_metadata,
+                        server_initial_metadata_ops, latency_index);
+        TagLatencyIndex(data_.client_to_server_messages,
+                        client_to_server_message_ops, latency_index);
+        TagLatencyIndex(data_.server_to_client_messages,
+                        server_to_client_message_ops, latency_index);
+      }
     }
 
     void AddOwnedObject(void (*destroy)(void* p), void* p) {
@@ -1612,6 +1683,16 @@ class CallFilters {
     RefCountedPtr<Stack> Build();
 
    private:
+    // Attribute the ops a filter just appended (everything from `from` to
+    // the end of the layout) to that filter's latency histogram.
+    template <typename T>
+    static void TagLatencyIndex(filters_detail::Layout<T>& layout, size_t from,
+                                size_t latency_index) {
+      for (size_t i = from; i < layout.ops.size(); ++i) {
+        layout.ops[i].latency_index = latency_index;
+      }
+    }
+
     filters_detail::StackData data_;
   };
 
@@ -1672,7 +1753,8 @@ class CallFilters {
             &(stack_current_->stack->data_.*layout),
             std::move(filters_->*input_location),
             filters_detail::Offset(filters_->call_data_,
-                                   stack_current_->call_data_offset)));
+                                   stack_current_->call_data_offset),
+            stack_current_->stack->data_.latency_collector.get()));
       } else {
         return FinishStep(executor_.Step(filters_->call_data_));
       }
@@ -1692,7 +1774,8 @@ class CallFilters {
         return FinishStep(executor_.Start(
             &(stack_current_->stack->data_.*layout), std::move(r->ok),
             filters_detail::Offset(filters_->call_data_,
-                                   stack_current_->call_data_offset)));
+                                   stack_current_->call_data_offset),
+            stack_current_->stack->data_.latency_collector.get()));
       }
       (filters_->call_state_.*on_done)();
       filters_->PushServerTrailingMetadata(std::move(r->error));
@@ -1732,7 +1815,8 @@ class CallFilters {
             &(stack_current_->stack->data_.*layout),
             std::move(filters_->*input_location),
             filters_detail::Offset(filters_->call_data_,
-                                   stack_current_->call_data_offset)));
+                                   stack_current_->call_data_offset),
+            stack_current_->stack->data_.latency_collector.get()));
       } else {
         return FinishStep(executor_.Step(filters_->call_data_));
       }
@@ -1750,7 +1834,8 @@ class CallFilters {
         return FinishStep(executor_.Start(
             &(stack_current_->stack->data_.*layout), std::move(r->ok),
             filters_detail::Offset(filters_->call_data_,
-                                   stack_current_->call_data_offset)));
+                                   stack_current_->call_data_offset),
+            stack_current_->stack->data_.latency_collector.get()));
       }
       (filters_->call_state_.*on_done)();
       filters_->PushServerTrailingMetadata(std::move(r->error));
@@ -17,6 +17,8 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <cstddef>
+#include <new>
 #include <utility>
 
 #include "src/core/lib/promise/context.h"
@@ -40,8 +42,9 @@ class CallFinalization {
   // Finalizers are run in the reverse order they are added.
   template <typename F>
   void Add(F&& t) {
-    first_ =
-        GetContext<Arena>()->New<FuncFinalizer<F>>(std::forward<F>(t), first_);
+    first_ = new (AllocFinalizerStorage(sizeof(FuncFinalizer<F>),
+                                        alignof(FuncFinalizer<F>)))
+        FuncFinalizer<F>(std::forward<F>(t), first_);
   }
 
   void Run(const grpc_call_final_info* final_info) {
@@ -76,8 +79,29 @@ class CallFinalization {
     Finalizer* next_;
     F f_;
   };
+
+  // Most calls register only a handful of finalizers, each a small lambda
+  // capturing a pointer or two (call tracers account for most of them).
+  // Serve those from an inline bump region so registration doesn't touch the
+  // arena; overflow - too many finalizers, or one with a large capture -
+  // falls back to the arena. Neither region frees: finalizers destroy
+  // themselves in Run(), mirroring arena lifetime.
+  void* AllocFinalizerStorage(size_t size, size_t align) {
+    const size_t offset = (inline_used_ + align - 1) & ~(align - 1);
+    if (align <= alignof(std::max_align_t) &&
+        offset + size <= sizeof(inline_storage_)) {
+      inline_used_ = offset + size;
+      return &inline_storage_[offset];
+    }
+    return GetContext<Arena>()->Alloc(size);
+  }
+
   // The first finalizer in the chain.
   Finalizer* first_ = nullptr;
+  size_t inline_used_ = 0;
+  // Sized for ~4 typical finalizers (vtable pointer, next pointer, one or two
+  // captured pointers each).
+  alignas(std::max_align_t) char inline_storage_[128];
 };
 
 template <>
@@ -23,14 +23,11 @@
 #include "src/core/call/message.h"
 #include "src/core/call/metadata.h"
 #include "src/core/lib/promise/detail/status.h"
-#include "src/core/lib/promise/if.h"
-#include "src/core/lib/promise/latch.h"
+#include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/party.h"
-#include "src/core/lib/promise/pipe.h"
 #include "src/core/lib/promise/prioritized_race.h"
 #include "src/core/lib/promise/promise.h"
 #include "src/core/lib/promise/status_flag.h"
-#include "src/core/lib/promise/try_seq.h"
 #include "src/core/util/dual_ref_counted.h"
 
 namespace grpc_core {
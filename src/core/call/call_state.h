@@ -27,6 +27,16 @@
 
 namespace grpc_core {
 
+// Tracks the progress of send/recv operations for one call.
+//
+// Concurrency contract: a CallState is owned by a single party (the call's
+// spine) and every transition happens while that party is polling, so the
+// five sub-state machines below are plain bitfield writes packed into one
+// word - there are no atomics and no CAS loops on the per-call hot path.
+// Wakeups between the pusher and puller sides use IntraActivityWaiter, which
+// defers repolls within the same party rather than scheduling across threads.
+// Do not call into CallState from outside the owning party; cross-party
+// signalling belongs in the spine's spawn machinery.
 class CallState {
  public:
   CallState();
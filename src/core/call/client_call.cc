@@ -182,8 +182,15 @@ void ClientCall::CancelWithError(grpc_error_handle error) {
 }
 
 template <typename Batch>
-void ClientCall::ScheduleCommittedBatch(Batch batch) {
+void ClientCall::ScheduleCommittedBatch(Batch batch, bool call_just_started) {
   GRPC_LATENT_SEE_INNER_SCOPE("ClientCall::ScheduleCommittedBatch");
+  if (call_just_started) {
+    // The caller holds a WakeupHold on the party, so the spawned batch will
+    // not run until the whole batch has been committed.
+    started_call_initiator_.SpawnInfallible(
+        "batch", GRPC_LATENT_SEE_PROMISE("ClientCallBatch", std::move(batch)));
+    return;
+  }
   auto cur_state = call_state_.load(std::memory_order_acquire);
   while (true) {
     switch (cur_state) {
@@ -225,7 +232,7 @@ void ClientCall::ScheduleCommittedBatch(Batch batch) {
 }
 
 Party::WakeupHold ClientCall::StartCall(
-    const grpc_op& send_initial_metadata_op) {
+    const grpc_op& send_initial_metadata_op, bool& call_started) {
   GRPC_LATENT_SEE_INNER_SCOPE("ClientCall::StartCall");
   auto cur_state = call_state_.load(std::memory_order_acquire);
   CToMetadata(send_initial_metadata_op.data.send_initial_metadata.metadata,
@@ -238,6 +245,9 @@ Party::WakeupHold ClientCall::StartCall(
   Party::WakeupHold wakeup_hold{started_call_initiator_.party()};
   while (!StartCallMaybeUpdateState(cur_state, call.handler)) {
   }
+  // StartCallMaybeUpdateState returns true without starting the call only if
+  // the call was cancelled first; cur_state still holds that observation.
+  call_started = cur_state != kCancelled;
   return wakeup_hold;
 }
 
@@ -281,7 +291,8 @@ void ClientCall::CommitBatch(const grpc_op* ops, size_t nops, void* notify_tag,
                              bool is_notify_tag_closure) {
   GRPC_LATENT_SEE_INNER_SCOPE("ClientCall::CommitBatch");
   if (nops == 1 && ops[0].op == GRPC_OP_SEND_INITIAL_METADATA) {
-    StartCall(ops[0]);
+    bool call_started;
+    StartCall(ops[0], call_started);
     EndOpImmediately(cq_, notify_tag, is_notify_tag_closure);
     return;
   }
@@ -346,8 +357,9 @@ void ClientCall::CommitBatch(const grpc_op* ops, size_t nops, void* notify_tag,
           TrySeq(std::move(recv_initial_metadata), std::move(recv_message))),
       [self = WeakRef()](StatusFlag x) { return x; });
   Party::WakeupHold wakeup_hold;
+  bool call_started_in_this_batch = false;
   if (const grpc_op* op = op_index.op(GRPC_OP_SEND_INITIAL_METADATA)) {
-    wakeup_hold = StartCall(*op);
+    wakeup_hold = StartCall(*op, call_started_in_this_batch);
   }
   if (const grpc_op* op = op_index.op(GRPC_OP_RECV_STATUS_ON_CLIENT)) {
     auto out_status = op->data.recv_status_on_client.status;
@@ -369,26 +381,30 @@ void ClientCall::CommitBatch(const grpc_op* ops, size_t nops, void* notify_tag,
                    return Success{};
                  });
     };
-    ScheduleCommittedBatch(InfallibleBatch(
-        std::move(primary_ops),
-        OpHandler<GRPC_OP_RECV_STATUS_ON_CLIENT>(OnCancelFactory(
-            std::move(make_read_trailing_metadata),
-            [this, out_status, out_status_details, out_error_string,
-             out_trailing_metadata]() {
-              auto* status = cancel_status_.Get();
-              CHECK_NE(status, nullptr);
-              *out_status = static_cast<grpc_status_code>(status->code());
-              *out_status_details =
-                  Slice::FromCopiedString(status->message()).TakeCSlice();
-              if (out_error_string != nullptr) {
-                *out_error_string = nullptr;
-              }
-              out_trailing_metadata->count = 0;
-            })),
-        is_notify_tag_closure, notify_tag, cq_));
+    ScheduleCommittedBatch(
+        InfallibleBatch(
+            std::move(primary_ops),
+            OpHandler<GRPC_OP_RECV_STATUS_ON_CLIENT>(OnCancelFactory(
+                std::move(make_read_trailing_metadata),
+                [this, out_status, out_status_details, out_error_string,
+                 out_trailing_metadata]() {
+                  auto* status = cancel_status_.Get();
+                  CHECK_NE(status, nullptr);
+                  *out_status = static_cast<grpc_status_code>(status->code());
+                  *out_status_details =
+                      Slice::FromCopiedString(status->message()).TakeCSlice();
+                  if (out_error_string != nullptr) {
+                    *out_error_string = nullptr;
+                  }
+                  out_trailing_metadata->count = 0;
+                })),
+            is_notify_tag_closure, notify_tag, cq_),
+        call_started_in_this_batch);
   } else {
-    ScheduleCommittedBatch(FallibleBatch(
-        std::move(primary_ops), is_notify_tag_closure, notify_tag, cq_));
+    ScheduleCommittedBatch(
+        FallibleBatch(std::move(primary_ops), is_notify_tag_closure, notify_tag,
+                      cq_),
+        call_started_in_this_batch);
   }
 }
 
@@ -126,9 +126,17 @@ class ClientCall final
 
   void CommitBatch(const grpc_op* ops, size_t nops, void* notify_tag,
                    bool is_notify_tag_closure);
+  // Schedule a batch that's been committed. If call_just_started is true the
+  // caller just transitioned call_state_ to kStarted (via StartCall in the
+  // same CommitBatch) and we can spawn directly on the started call's party
+  // without re-examining call_state_ -- this keeps the canonical unary batch
+  // (all six ops in one StartBatch) to a single state machine round trip.
   template <typename Batch>
-  void ScheduleCommittedBatch(Batch batch);
-  Party::WakeupHold StartCall(const grpc_op& send_initial_metadata_op);
+  void ScheduleCommittedBatch(Batch batch, bool call_just_started);
+  // Start the call. Sets call_started to true if the call was actually
+  // started, false if it had already been cancelled.
+  Party::WakeupHold StartCall(const grpc_op& send_initial_metadata_op,
+                              bool& call_started);
   // Attempt to start the call and send handler down the stack; returns true if
   // state was updated, false otherwise (with cur_state updated to the new
   // current state).
@@ -0,0 +1,122 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/call/filter_latency.h"
+
+#include <grpc/support/port_platform.h>
+#include <grpc/support/time.h>
+
+#include <algorithm>
+#include <limits>
+
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/telemetry/histogram_view.h"
+
+namespace grpc_core {
+
+namespace {
+
+// Exponential bucket boundaries in microseconds, 1us..1.8s. Values at or
+// above the last boundary land in the final bucket. Same table shape as the
+// 1800000/40 latency histograms in stats_data, reinterpreted in microseconds
+// so that cheap filters (single-digit us) are still resolved.
+constexpr int kNumBoundaries = FilterLatencyCollector::kNumLatencyBuckets + 1;
+const int kLatencyBucketBoundariesUs[kNumBoundaries] = {
+    0,      1,      2,      3,       5,      8,      12,     18,     26,
+    37,     53,     76,     108,     153,    217,    308,    436,    617,
+    873,    1235,   1748,   2473,    3499,   4950,   7003,   9907,   14015,
+    19825,  28044,  39670,  56116,   79379,  112286, 158835, 224680, 317821,
+    449574, 635945, 899575, 1272492, 1800000};
+
+int LatencyBucketFor(int value_us) {
+  if (value_us < 0) value_us = 0;
+  const int* const begin = kLatencyBucketBoundariesUs;
+  const int* const end = begin + kNumBoundaries;
+  const int bucket =
+      static_cast<int>(std::upper_bound(begin + 1, end, value_us) - begin) - 1;
+  return std::min(bucket, FilterLatencyCollector::kNumLatencyBuckets - 1);
+}
+
+}  // namespace
+
+FilterLatencyCollector::FilterLatencyCollector(
+    RefCountedPtr<channelz::BaseNode> node)
+    : channelz::DataSource(std::move(node)) {
+  SourceConstructed();
+}
+
+FilterLatencyCollector::~FilterLatencyCollector() { SourceDestructing(); }
+
+size_t FilterLatencyCollector::RegisterFilter(absl::string_view name) {
+  size_t copies = 0;
+  for (const auto& histogram : histograms_) {
+    if (histogram->base_name == name) ++copies;
+  }
+  std::string display_name = copies == 0
+                                 ? std::string(name)
+                                 : absl::StrCat(name, "#", copies + 1);
+  histograms_.push_back(
+      std::make_unique<FilterHistogram>(name, std::move(display_name)));
+  return histograms_.size() - 1;
+}
+
+void FilterLatencyCollector::Record(size_t index, gpr_cycle_counter start,
+                                    gpr_cycle_counter end) {
+  DCHECK_LT(index, histograms_.size());
+  const gpr_timespec elapsed = gpr_cycle_counter_sub(end, start);
+  const int64_t us = elapsed.tv_sec * GPR_US_PER_SEC +
+                     elapsed.tv_nsec / GPR_NS_PER_US;
+  const int value_us = static_cast<int>(std::min<int64_t>(
+      std::max<int64_t>(us, 0), std::numeric_limits<int>::max()));
+  FilterHistogram& histogram = *histograms_[index];
+  histogram.buckets[LatencyBucketFor(value_us)].fetch_add(
+      1, std::memory_order_relaxed);
+  histogram.count.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::vector<FilterLatencyCollector::FilterSnapshot>
+FilterLatencyCollector::Snapshot() const {
+  std::vector<FilterSnapshot> snapshot;
+  snapshot.reserve(histograms_.size());
+  for (const auto& histogram : histograms_) {
+    uint64_t buckets[kNumLatencyBuckets];
+    for (int i = 0; i < kNumLatencyBuckets; ++i) {
+      buckets[i] = histogram->buckets[i].load(std::memory_order_relaxed);
+    }
+    const HistogramView view{&LatencyBucketFor, kLatencyBucketBoundariesUs,
+                             kNumLatencyBuckets, buckets};
+    snapshot.push_back(FilterSnapshot{
+        histogram->name, histogram->count.load(std::memory_order_relaxed),
+        view.Percentile(50), view.Percentile(95), view.Percentile(99)});
+  }
+  return snapshot;
+}
+
+channelz::PropertyGrid FilterLatencyCollector::ChannelzProperties() const {
+  channelz::PropertyGrid grid;
+  for (const FilterSnapshot& filter : Snapshot()) {
+    grid.Set("count", filter.filter, filter.count)
+        .Set("p50_us", filter.filter, filter.p50_us)
+        .Set("p95_us", filter.filter, filter.p95_us)
+        .Set("p99_us", filter.filter, filter.p99_us);
+  }
+  return grid;
+}
+
+void FilterLatencyCollector::AddData(channelz::DataSink sink) {
+  sink.AddData("perFilterLatency", ChannelzProperties());
+}
+
+}  // namespace grpc_core
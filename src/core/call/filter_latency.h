@@ -0,0 +1,113 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_CALL_FILTER_LATENCY_H
+#define GRPC_SRC_CORE_CALL_FILTER_LATENCY_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "src/core/channelz/channelz.h"
+#include "src/core/channelz/property_list.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/time_precise.h"
+
+namespace grpc_core {
+
+// Per-filter latency attribution for v3 filter stacks.
+//
+// When GRPC_ARG_PER_FILTER_LATENCY_TRACKING is enabled,
+// InterceptionChainBuilder creates one collector per chain and hands it to
+// every CallFilters::StackBuilder it uses. The builder tags each operator
+// with the index of the filter that contributed it, and OperationExecutor
+// records the elapsed time from the first poll of a filter's operation
+// promise to its resolution -- so time a filter spends suspended (e.g. an
+// auth filter waiting on credentials) is attributed to that filter, not
+// just its on-CPU poll cost. The four streamed interception points
+// (client/server initial metadata and messages in both directions) are
+// timed; the synchronous half-close and server-trailing-metadata hooks are
+// not, since they cannot suspend and are uniformly cheap.
+//
+// Recording costs a cycle-counter read on either side of each intercepted
+// operation plus two relaxed atomic increments; when the channel arg is off
+// the executor pays only a well-predicted null test per operation.
+//
+// The collector is a channelz DataSource on the node found in the channel
+// args at chain-build time, so the per-filter latency table shows up on the
+// channel's channelz entity.
+class FilterLatencyCollector final : public RefCounted<FilterLatencyCollector>,
+                                     public channelz::DataSource {
+ public:
+  // Number of exponential latency buckets (see the boundary table in the
+  // .cc file; same shape as the stats_data latency histograms, but in
+  // microseconds so single-digit-us filters are still resolved).
+  static constexpr int kNumLatencyBuckets = 40;
+
+  explicit FilterLatencyCollector(RefCountedPtr<channelz::BaseNode> node);
+  ~FilterLatencyCollector() override;
+
+  // Adds a histogram slot for the named filter and returns its index.
+  // Repeated registrations of the same name (e.g. a filter present in both
+  // the client and server halves of a chain) get a "#n" suffix so each
+  // instance keeps its own row. Called only at stack build time, which
+  // completes before any call can run through the stack, so Record() never
+  // races with registration.
+  size_t RegisterFilter(absl::string_view name);
+
+  // Records one operation through the filter at `index` that ran from
+  // cycle counter `start` to `end`.
+  void Record(size_t index, gpr_cycle_counter start, gpr_cycle_counter end);
+
+  // Snapshot of one filter's latency distribution.
+  struct FilterSnapshot {
+    std::string filter;
+    uint64_t count;
+    double p50_us;
+    double p95_us;
+    double p99_us;
+  };
+
+  // Returns a snapshot of all registered filters, in stack order.
+  std::vector<FilterSnapshot> Snapshot() const;
+
+  // Per-filter latency table for the channel's channelz entity.
+  channelz::PropertyGrid ChannelzProperties() const;
+
+  void AddData(channelz::DataSink sink) override;
+
+ private:
+  struct FilterHistogram {
+    FilterHistogram(absl::string_view base_name, std::string name)
+        : base_name(base_name), name(std::move(name)) {}
+    std::string base_name;
+    std::string name;
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> buckets[kNumLatencyBuckets] = {};
+  };
+
+  // Append-only during stack building; read-only once calls flow.
+  std::vector<std::unique_ptr<FilterHistogram>> histograms_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_CALL_FILTER_LATENCY_H
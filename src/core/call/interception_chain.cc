@@ -108,15 +108,13 @@ void InterceptionChainBuilder::AddInterceptor(
     return;
   }
   (*interceptor)->filter_stack_ = MakeFilterStack();
+  Interceptor* new_tail = interceptor->get();
   if (top_interceptor_ == nullptr) {
     top_interceptor_ = std::move(*interceptor);
   } else {
-    Interceptor* previous = top_interceptor_.get();
-    while (previous->wrapped_destination_ != nullptr) {
-      previous = DownCast<Interceptor*>(previous->wrapped_destination_.get());
-    }
-    previous->wrapped_destination_ = std::move(*interceptor);
+    tail_interceptor_->wrapped_destination_ = std::move(*interceptor);
   }
+  tail_interceptor_ = new_tail;
 }
 
 absl::StatusOr<RefCountedPtr<UnstartedCallDestination>>
@@ -144,11 +142,8 @@ InterceptionChainBuilder::Build(FinalDestination final_destination) {
   if (top_interceptor_ == nullptr) {
     return std::move(terminator);
   }
-  Interceptor* previous = top_interceptor_.get();
-  while (previous->wrapped_destination_ != nullptr) {
-    previous = DownCast<Interceptor*>(previous->wrapped_destination_.get());
-  }
-  previous->wrapped_destination_ = std::move(terminator);
+  tail_interceptor_->wrapped_destination_ = std::move(terminator);
+  tail_interceptor_ = nullptr;
   return std::move(top_interceptor_);
 }
 
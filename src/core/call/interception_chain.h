@@ -15,6 +15,7 @@
 #ifndef GRPC_SRC_CORE_CALL_INTERCEPTION_CHAIN_H
 #define GRPC_SRC_CORE_CALL_INTERCEPTION_CHAIN_H
 
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/support/port_platform.h>
 
 #include <memory>
@@ -22,6 +23,7 @@
 
 #include "src/core/call/call_destination.h"
 #include "src/core/call/call_filters.h"
+#include "src/core/call/filter_latency.h"
 #include "src/core/call/call_spine.h"
 #include "src/core/call/metadata.h"
 #include "src/core/util/ref_counted.h"
@@ -164,7 +166,13 @@ class InterceptionChainBuilder final {
 
   explicit InterceptionChainBuilder(ChannelArgs args,
                                     const Blackboard* blackboard = nullptr)
-      : args_(std::move(args)), blackboard_(blackboard) {}
+      : args_(std::move(args)), blackboard_(blackboard) {
+    if (args_.GetBool(GRPC_ARG_PER_FILTER_LATENCY_TRACKING)
+            .value_or(false)) {
+      latency_collector_ = MakeRefCounted<FilterLatencyCollector>(
+          args_.GetObjectRef<channelz::BaseNode>());
+    }
+  }
 
   // Add a filter with a `Call` class as an inner member.
   // Call class must be one compatible with the filters described in
@@ -228,7 +236,12 @@ class InterceptionChainBuilder final {
     if (status_.ok()) status_ = std::move(status);
   }
 
-  // Build this stack
+  // Build this stack.
+  // Note that the result is inherently per-connection and must not be cached
+  // or shared across builds with "the same" configuration: the channel args
+  // typically carry per-connection objects (the transport, the channelz
+  // socket node) that filters capture at Create time, and the chain bottoms
+  // out at the per-connection final destination.
   absl::StatusOr<RefCountedPtr<UnstartedCallDestination>> Build(
       FinalDestination final_destination);
 
@@ -238,6 +251,9 @@ class InterceptionChainBuilder final {
   CallFilters::StackBuilder& stack_builder() {
     if (!stack_builder_.has_value()) {
       stack_builder_.emplace();
+      if (latency_collector_ != nullptr) {
+        stack_builder_->SetLatencyCollector(latency_collector_);
+      }
       for (auto& f : on_new_interception_tail_) f(this);
     }
     return *stack_builder_;
@@ -263,8 +279,15 @@ class InterceptionChainBuilder final {
   void AddInterceptor(absl::StatusOr<RefCountedPtr<Interceptor>> interceptor);
 
   ChannelArgs args_;
+  // Shared by every stack in the chain when per-filter latency tracking is
+  // enabled, so the channel's channelz entity shows one table covering the
+  // whole chain.
+  RefCountedPtr<FilterLatencyCollector> latency_collector_;
   std::optional<CallFilters::StackBuilder> stack_builder_;
   RefCountedPtr<Interceptor> top_interceptor_;
+  // Last interceptor added - where the next interceptor (or the terminator at
+  // Build time) gets attached, so chain assembly doesn't re-walk the chain.
+  Interceptor* tail_interceptor_ = nullptr;
   std::vector<absl::AnyInvocable<void(InterceptionChainBuilder*)>>
       on_new_interception_tail_;
   absl::Status status_;
@@ -33,6 +33,19 @@
 
 namespace grpc_core {
 
+// A message travelling through the call pipeline.
+//
+// Payload handling follows a borrowed/moved protocol so that bytes are copied
+// at most once between the application and the wire (by the transport's
+// framer):
+// - Inspect-only interceptors take `const Message&` (or read through
+//   payload() const) and never own the bytes.
+// - Annotating interceptors mutate flags via mutable_flags() in place and
+//   pass the same MessageHandle through.
+// - Transforming interceptors (e.g. compression) replace the payload bytes in
+//   place with SliceBuffer::Swap.
+// Clone() and SliceBuffer::Copy only add slice references - they do not copy
+// payload bytes.
 class Message {
  public:
   Message() = default;
@@ -47,6 +60,26 @@ class Message {
   SliceBuffer* payload() { return &payload_; }
   const SliceBuffer* payload() const { return &payload_; }
 
+#ifndef NDEBUG
+  // Debug aid for the borrowed-payload protocol above: returns a token
+  // identifying the storage currently backing the payload, or 0 if
+  // indeterminate (empty or inlined payloads). Tokens compare equal while the
+  // payload still references the same underlying bytes, so a stage that is
+  // supposed to pass a message through untouched can guard against hidden
+  // copies:
+  //     const uintptr_t token = msg->payload_identity();
+  //     ... run stage ...
+  //     DCHECK(token == 0 || token == msg->payload_identity());
+  // Legitimate transforms (e.g. compression) are expected to change the
+  // token.
+  uintptr_t payload_identity() const {
+    if (payload_.Count() == 0) return 0;
+    const grpc_slice& first = payload_.c_slice_buffer()->slices[0];
+    if (first.refcount == nullptr) return 0;
+    return reinterpret_cast<uintptr_t>(GRPC_SLICE_START_PTR(first));
+  }
+#endif
+
   Arena::PoolPtr<Message> Clone() const {
     return Arena::MakePooled<Message>(payload_.Copy(), flags_);
   }
@@ -18,6 +18,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <string>
 
 #include "absl/base/no_destructor.h"
@@ -102,7 +103,55 @@ bool DebugStringBuilder::IsAllowListed(const absl::string_view key) const {
   return allow_list->contains(key);
 }
 
+namespace {
+
+// Process-wide estimate of how many unknown entries a batch that carries any
+// will hold. Uses the same grow-fast/decay-slow scheme as CallSizeEstimator:
+// services that consistently attach many custom headers quickly push the
+// estimate up to their working count, while a one-off large batch decays away.
+std::atomic<size_t> g_unknown_entries_estimate{4};
+
+size_t UnknownEntriesEstimate() {
+  // Round up to the next multiple of 4 entries so a slowly drifting estimate
+  // yields a stable reservation size.
+  static constexpr size_t kRoundUpEntries = 4;
+  return (g_unknown_entries_estimate.load(std::memory_order_relaxed) +
+          2 * kRoundUpEntries) &
+         ~(kRoundUpEntries - 1);
+}
+
+void UpdateUnknownEntriesEstimate(size_t count) {
+  size_t cur = g_unknown_entries_estimate.load(std::memory_order_relaxed);
+  if (cur < count) {
+    g_unknown_entries_estimate.compare_exchange_weak(
+        cur, count, std::memory_order_relaxed, std::memory_order_relaxed);
+  } else if (cur > count) {
+    g_unknown_entries_estimate.compare_exchange_weak(
+        cur, std::min(cur - 1, (255 * cur + count) / 256),
+        std::memory_order_relaxed, std::memory_order_relaxed);
+  }
+  // if we lose a race: never mind, another batch will update soon enough
+}
+
+}  // namespace
+
+UnknownMap::~UnknownMap() { MaybeRecordSize(); }
+
+void UnknownMap::Clear() {
+  MaybeRecordSize();
+  unknown_.clear();
+}
+
+void UnknownMap::MaybeRecordSize() {
+  // Empty maps are not recorded: most batches carry no unknown entries (and
+  // moved-from maps are empty too), and feeding all those zeros in would pin
+  // the estimate at nothing. The estimate answers "when a batch has custom
+  // headers, how many does it have?".
+  if (!unknown_.empty()) UpdateUnknownEntriesEstimate(unknown_.size());
+}
+
 void UnknownMap::Append(absl::string_view key, Slice value) {
+  if (unknown_.empty()) unknown_.reserve(UnknownEntriesEstimate());
   unknown_.emplace_back(Slice::FromCopiedString(key), value.Ref());
 }
 
@@ -24,6 +24,7 @@
 #include <grpc/support/port_platform.h>
 #include <stdlib.h>
 
+#include <array>
 #include <cstdint>
 #include <optional>
 #include <string>
@@ -45,7 +46,6 @@
 #include "src/core/lib/promise/poll.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/util/chunked_vector.h"
-#include "src/core/util/if_list.h"
 #include "src/core/util/packed_table.h"
 #include "src/core/util/time.h"
 #include "src/core/util/type_list.h"
@@ -78,7 +78,7 @@ struct GrpcTimeoutMetadata {
   using ValueType = Timestamp;
   using MementoType = Duration;
   using CompressionTraits = TimeoutCompressor;
-  static absl::string_view key() { return "grpc-timeout"; }
+  static constexpr absl::string_view key() { return "grpc-timeout"; }
   static MementoType ParseMemento(Slice value,
                                   bool will_keep_past_request_lifetime,
                                   MetadataParseErrorFn on_error);
@@ -101,7 +101,7 @@ struct TeMetadata {
   };
   using MementoType = ValueType;
   using CompressionTraits = KnownValueCompressor<ValueType, kTrailers>;
-  static absl::string_view key() { return "te"; }
+  static constexpr absl::string_view key() { return "te"; }
   static MementoType ParseMemento(Slice value,
                                   bool will_keep_past_request_lifetime,
                                   MetadataParseErrorFn on_error);
@@ -132,7 +132,7 @@ struct ContentTypeMetadata {
   };
   using MementoType = ValueType;
   using CompressionTraits = KnownValueCompressor<ValueType, kApplicationGrpc>;
-  static absl::string_view key() { return "content-type"; }
+  static constexpr absl::string_view key() { return "content-type"; }
   static MementoType ParseMemento(Slice value,
                                   bool will_keep_past_request_lifetime,
                                   MetadataParseErrorFn on_error);
@@ -158,7 +158,7 @@ struct HttpSchemeMetadata {
   };
   using MementoType = ValueType;
   using CompressionTraits = HttpSchemeCompressor;
-  static absl::string_view key() { return ":scheme"; }
+  static constexpr absl::string_view key() { return ":scheme"; }
   static MementoType ParseMemento(Slice value, bool,
                                   MetadataParseErrorFn on_error) {
     return Parse(value.as_string_view(), on_error);
@@ -189,7 +189,7 @@ struct HttpMethodMetadata {
   };
   using MementoType = ValueType;
   using CompressionTraits = HttpMethodCompressor;
-  static absl::string_view key() { return ":method"; }
+  static constexpr absl::string_view key() { return ":method"; }
   static MementoType ParseMemento(Slice value,
                                   bool will_keep_past_request_lifetime,
                                   MetadataParseErrorFn on_error);
@@ -232,7 +232,7 @@ struct GrpcEncodingMetadata : public CompressionAlgorithmBasedMetadata {
   static constexpr bool kTransferOnTrailersOnly = false;
   using CompressionTraits =
       SmallIntegralValuesCompressor<GRPC_COMPRESS_ALGORITHMS_COUNT>;
-  static absl::string_view key() { return "grpc-encoding"; }
+  static constexpr absl::string_view key() { return "grpc-encoding"; }
 };
 
 // grpc-internal-encoding-request metadata trait.
@@ -240,14 +240,16 @@ struct GrpcInternalEncodingRequest : public CompressionAlgorithmBasedMetadata {
   static constexpr bool kRepeatable = false;
   static constexpr bool kTransferOnTrailersOnly = false;
   using CompressionTraits = NoCompressionCompressor;
-  static absl::string_view key() { return "grpc-internal-encoding-request"; }
+  static constexpr absl::string_view key() {
+    return "grpc-internal-encoding-request";
+  }
 };
 
 // grpc-accept-encoding metadata trait.
 struct GrpcAcceptEncodingMetadata {
   static constexpr bool kRepeatable = false;
   static constexpr bool kTransferOnTrailersOnly = false;
-  static absl::string_view key() { return "grpc-accept-encoding"; }
+  static constexpr absl::string_view key() { return "grpc-accept-encoding"; }
   using ValueType = CompressionAlgorithmSet;
   using MementoType = ValueType;
   using CompressionTraits = StableValueCompressor;
@@ -267,7 +269,7 @@ struct UserAgentMetadata : public SimpleSliceBasedMetadata {
   static constexpr bool kRepeatable = false;
   static constexpr bool kTransferOnTrailersOnly = false;
   using CompressionTraits = StableValueCompressor;
-  static absl::string_view key() { return "user-agent"; }
+  static constexpr absl::string_view key() { return "user-agent"; }
 };
 
 // grpc-message metadata trait.
@@ -275,7 +277,7 @@ struct GrpcMessageMetadata : public SimpleSliceBasedMetadata {
   static constexpr bool kRepeatable = false;
   static constexpr bool kTransferOnTrailersOnly = false;
   using CompressionTraits = NoCompressionCompressor;
-  static absl::string_view key() { return "grpc-message"; }
+  static constexpr absl::string_view key() { return "grpc-message"; }
 };
 
 // host metadata trait.
@@ -283,7 +285,7 @@ struct HostMetadata : public SimpleSliceBasedMetadata {
   static constexpr bool kRepeatable = false;
   static constexpr bool kTransferOnTrailersOnly = false;
   using CompressionTraits = NoCompressionCompressor;
-  static absl::string_view key() { return "host"; }
+  static constexpr absl::string_view key() { return "host"; }
 };
 
 // endpoint-load-metrics-bin metadata trait.
@@ -291,7 +293,9 @@ struct EndpointLoadMetricsBinMetadata : public SimpleSliceBasedMetadata {
   static constexpr bool kRepeatable = false;
   static constexpr bool kTransferOnTrailersOnly = false;
   using CompressionTraits = NoCompressionCompressor;
-  static absl::string_view key() { return "endpoint-load-metrics-bin"; }
+  static constexpr absl::string_view key() {
+    return "endpoint-load-metrics-bin";
+  }
 };
 
 // grpc-server-stats-bin metadata trait.
@@ -299,7 +303,7 @@ struct GrpcServerStatsBinMetadata : public SimpleSliceBasedMetadata {
   static constexpr bool kRepeatable = false;
   static constexpr bool kTransferOnTrailersOnly = false;
   using CompressionTraits = NoCompressionCompressor;
-  static absl::string_view key() { return "grpc-server-stats-bin"; }
+  static constexpr absl::string_view key() { return "grpc-server-stats-bin"; }
 };
 
 // grpc-trace-bin metadata trait.
@@ -307,7 +311,7 @@ struct GrpcTraceBinMetadata : public SimpleSliceBasedMetadata {
   static constexpr bool kRepeatable = false;
   static constexpr bool kTransferOnTrailersOnly = false;
   using CompressionTraits = FrequentKeyWithNoValueCompressionCompressor;
-  static absl::string_view key() { return "grpc-trace-bin"; }
+  static constexpr absl::string_view key() { return "grpc-trace-bin"; }
 };
 
 // grpc-tags-bin metadata trait.
@@ -315,7 +319,7 @@ struct GrpcTagsBinMetadata : public SimpleSliceBasedMetadata {
   static constexpr bool kRepeatable = false;
   static constexpr bool kTransferOnTrailersOnly = false;
   using CompressionTraits = FrequentKeyWithNoValueCompressionCompressor;
-  static absl::string_view key() { return "grpc-tags-bin"; }
+  static constexpr absl::string_view key() { return "grpc-tags-bin"; }
 };
 
 // XEnvoyPeerMetadata
@@ -323,7 +327,7 @@ struct XEnvoyPeerMetadata : public SimpleSliceBasedMetadata {
   static constexpr bool kRepeatable = false;
   static constexpr bool kTransferOnTrailersOnly = true;
   using CompressionTraits = StableValueCompressor;
-  static absl::string_view key() { return "x-envoy-peer-metadata"; }
+  static constexpr absl::string_view key() { return "x-envoy-peer-metadata"; }
 };
 
 // :authority metadata trait.
@@ -331,7 +335,7 @@ struct HttpAuthorityMetadata : public SimpleSliceBasedMetadata {
   static constexpr bool kRepeatable = false;
   static constexpr bool kTransferOnTrailersOnly = false;
   using CompressionTraits = SmallSetOfValuesCompressor;
-  static absl::string_view key() { return ":authority"; }
+  static constexpr absl::string_view key() { return ":authority"; }
 };
 
 // :path metadata trait.
@@ -339,7 +343,7 @@ struct HttpPathMetadata : public SimpleSliceBasedMetadata {
   static constexpr bool kRepeatable = false;
   static constexpr bool kTransferOnTrailersOnly = false;
   using CompressionTraits = SmallSetOfValuesCompressor;
-  static absl::string_view key() { return ":path"; }
+  static constexpr absl::string_view key() { return ":path"; }
 };
 
 // We separate SimpleIntBasedMetadata into two pieces: one that does not
@@ -418,7 +422,7 @@ struct GrpcStatusMetadata {
   static constexpr bool kRepeatable = false;
   static constexpr bool kTransferOnTrailersOnly = false;
   using CompressionTraits = SmallIntegralValuesCompressor<16>;
-  static absl::string_view key() { return "grpc-status"; }
+  static constexpr absl::string_view key() { return "grpc-status"; }
   static grpc_status_code ParseMemento(Slice value, bool,
                                        MetadataParseErrorFn on_error) {
     int64_t wire_value;
@@ -444,14 +448,16 @@ struct GrpcPreviousRpcAttemptsMetadata
   static constexpr bool kRepeatable = false;
   static constexpr bool kTransferOnTrailersOnly = false;
   using CompressionTraits = NoCompressionCompressor;
-  static absl::string_view key() { return "grpc-previous-rpc-attempts"; }
+  static constexpr absl::string_view key() {
+    return "grpc-previous-rpc-attempts";
+  }
 };
 
 // grpc-retry-pushback-ms metadata trait.
 struct GrpcRetryPushbackMsMetadata {
   static constexpr bool kRepeatable = false;
   static constexpr bool kTransferOnTrailersOnly = false;
-  static absl::string_view key() { return "grpc-retry-pushback-ms"; }
+  static constexpr absl::string_view key() { return "grpc-retry-pushback-ms"; }
   using ValueType = Duration;
   using MementoType = Duration;
   using CompressionTraits = NoCompressionCompressor;
@@ -470,7 +476,7 @@ struct HttpStatusMetadata : public SimpleIntBasedMetadata<uint32_t, 0> {
   static constexpr bool kRepeatable = false;
   static constexpr bool kTransferOnTrailersOnly = true;
   using CompressionTraits = HttpStatusCompressor;
-  static absl::string_view key() { return ":status"; }
+  static constexpr absl::string_view key() { return ":status"; }
 };
 
 // "secret" metadata trait used to pass load balancing token between filters.
@@ -480,7 +486,7 @@ class GrpcLbClientStats;
 struct GrpcLbClientStatsMetadata {
   static constexpr bool kRepeatable = false;
   static constexpr bool kTransferOnTrailersOnly = false;
-  static absl::string_view key() { return "grpclb_client_stats"; }
+  static constexpr absl::string_view key() { return "grpclb_client_stats"; }
   using ValueType = GrpcLbClientStats*;
   using MementoType = ValueType;
   using CompressionTraits = NoCompressionCompressor;
@@ -506,14 +512,14 @@ struct LbTokenMetadata : public SimpleSliceBasedMetadata {
   static constexpr bool kRepeatable = false;
   static constexpr bool kTransferOnTrailersOnly = false;
   using CompressionTraits = NoCompressionCompressor;
-  static absl::string_view key() { return "lb-token"; }
+  static constexpr absl::string_view key() { return "lb-token"; }
 };
 
 // lb-cost-bin metadata
 struct LbCostBinMetadata {
   static constexpr bool kRepeatable = true;
   static constexpr bool kTransferOnTrailersOnly = false;
-  static absl::string_view key() { return "lb-cost-bin"; }
+  static constexpr absl::string_view key() { return "lb-cost-bin"; }
   struct ValueType {
     double cost;
     std::string name;
@@ -534,7 +540,7 @@ struct W3CTraceParentMetadata : public SimpleSliceBasedMetadata {
   static constexpr bool kRepeatable = false;
   static constexpr bool kTransferOnTrailersOnly = false;
   using CompressionTraits = NoCompressionCompressor;
-  static absl::string_view key() { return "traceparent"; }
+  static constexpr absl::string_view key() { return "traceparent"; }
 };
 
 // Annotation added by a transport to note whether a failed request was never
@@ -687,24 +693,78 @@ struct EncodableTraits<void> {
   using List = Typelist<>;
 };
 
-template <typename Trait>
-struct EncodableNameLookupKeyComparison {
-  bool operator()(absl::string_view key) { return key == Trait::key(); }
-};
-
-template <typename Trait, typename Op>
-struct EncodableNameLookupOnFound {
-  auto operator()(Op* op) { return op->Found(Trait()); }
-};
+// Seeded FNV-1a used by the compile-time perfect hash below.
+constexpr uint64_t EncodableKeyHash(absl::string_view key, uint64_t seed) {
+  uint64_t hash = seed ^ uint64_t{14695981039346656037u};
+  for (size_t i = 0; i < key.size(); ++i) {
+    hash ^= static_cast<uint8_t>(key[i]);
+    hash *= uint64_t{1099511628211u};
+  }
+  return hash;
+}
 
+// Key lookup over the encodable traits via a perfect hash generated at
+// compile time: the seed is chosen so that no two trait keys collide in the
+// index table, making lookup one hash, one table load, and one string
+// compare - instead of a linear chain of comparisons over every trait.
 template <typename... Traits>
 struct EncodableNameLookup {
+  static constexpr size_t kNumTraits = sizeof...(Traits);
+  // Large enough that a collision-free seed is easy to find (birthday bound),
+  // small enough that the one-byte-per-slot index table stays cache friendly.
+  static constexpr size_t kTableSize = 1024;
+  static constexpr uint8_t kNoTrait = 0xff;
+  static constexpr uint64_t kNoSeed = ~uint64_t{0};
+  static_assert(kNumTraits < kNoTrait, "too many traits for uint8_t indices");
+
   template <typename Op>
   static auto Lookup(absl::string_view key, Op* op) {
-    return IfList(
-        key, op, [key](Op* op) { return op->NotFound(key); },
-        EncodableNameLookupKeyComparison<Traits>()...,
-        EncodableNameLookupOnFound<Traits, Op>()...);
+    if constexpr (kNumTraits == 0) {
+      return op->NotFound(key);
+    } else {
+      using Result = decltype(op->NotFound(key));
+      using Fn = Result (*)(Op*);
+      static constexpr uint64_t kSeed = FindSeed();
+      static_assert(kSeed != kNoSeed,
+                    "no perfect hash seed found for metadata keys");
+      static constexpr std::array<uint8_t, kTableSize> kIndexTable =
+          MakeIndexTable(kSeed);
+      static constexpr absl::string_view kKeys[] = {Traits::key()...};
+      static constexpr Fn kFound[] = {
+          [](Op* op) -> Result { return op->Found(Traits()); }...};
+      const uint8_t index =
+          kIndexTable[EncodableKeyHash(key, kSeed) % kTableSize];
+      if (index != kNoTrait && key == kKeys[index]) return kFound[index](op);
+      return op->NotFound(key);
+    }
+  }
+
+ private:
+  static constexpr uint64_t FindSeed() {
+    constexpr absl::string_view keys[] = {Traits::key()...};
+    for (uint64_t seed = 0; seed < 1024; ++seed) {
+      bool used[kTableSize] = {};
+      bool ok = true;
+      for (size_t i = 0; i < kNumTraits && ok; ++i) {
+        const size_t slot = EncodableKeyHash(keys[i], seed) % kTableSize;
+        if (used[slot]) ok = false;
+        used[slot] = true;
+      }
+      if (ok) return seed;
+    }
+    return kNoSeed;
+  }
+
+  static constexpr std::array<uint8_t, kTableSize> MakeIndexTable(
+      uint64_t seed) {
+    std::array<uint8_t, kTableSize> table{};
+    for (size_t i = 0; i < kTableSize; ++i) table[i] = kNoTrait;
+    constexpr absl::string_view keys[] = {Traits::key()...};
+    for (size_t i = 0; i < kNumTraits; ++i) {
+      table[EncodableKeyHash(keys[i], seed) % kTableSize] =
+          static_cast<uint8_t>(i);
+    }
+    return table;
   }
 };
 
@@ -1172,6 +1232,14 @@ class UnknownMap {
  public:
   using BackingType = std::vector<std::pair<Slice, Slice>>;
 
+  UnknownMap() = default;
+  // The destructor feeds the final entry count back into a process-wide
+  // estimator, which Append consults to reserve the backing store once at
+  // roughly the right size rather than growing step-by-step.
+  ~UnknownMap();
+  UnknownMap(UnknownMap&&) = default;
+  UnknownMap& operator=(UnknownMap&&) = default;
+
   void Append(absl::string_view key, Slice value);
   void Remove(absl::string_view key);
   std::optional<absl::string_view> GetStringValue(absl::string_view key,
@@ -1192,9 +1260,12 @@ class UnknownMap {
 
   bool empty() const { return unknown_.empty(); }
   size_t size() const { return unknown_.size(); }
-  void Clear() { unknown_.clear(); }
+  void Clear();
 
  private:
+  // Record a non-empty entry count into the process-wide estimator.
+  void MaybeRecordSize();
+
   // Backing store for added metadata.
   BackingType unknown_;
 };
@@ -1286,8 +1357,10 @@ MetadataValueAsSlice(typename Which::ValueType value) {
 //   using ValueType = ...;
 //   // The type that's stored in compression/decompression tables
 //   using MementoType = ...;
-//   // The string key for this metadata type (for transports that require it)
-//   static absl::string_view key() { return "grpc-xyz"; }
+//   // The string key for this metadata type (for transports that require it).
+//   // Must be constexpr: it participates in the compile-time perfect hash
+//   // used for key lookup.
+//   static constexpr absl::string_view key() { return "grpc-xyz"; }
 //   // Parse a memento from a slice
 //   // Takes ownership of value
 //   // If will_keep_past_request_lifetime is true, expect that the returned
@@ -42,12 +42,16 @@ namespace metadata_detail {
 
 // Helper to determine whether a traits metadata is inlinable inside a memento,
 // or (if not) we'll need to take the memory allocation path.
+// Any trivially copyable memento that fits in Buffer is stored inline (we
+// memcpy it in and out and never run a destructor), so small decoded values -
+// timeouts, status codes, compression bits - bypass both slice refcounting
+// and the heap. Trivial copyability implies trivial destructibility, so the
+// no-op destroy path is safe.
 template <typename Which>
 struct HasSimpleMemento {
   static constexpr bool value =
-      (std::is_trivial<typename Which::MementoType>::value &&
-       sizeof(typename Which::MementoType) <= sizeof(grpc_slice)) ||
-      std::is_same<typename Which::MementoType, Duration>::value;
+      std::is_trivially_copyable<typename Which::MementoType>::value &&
+      sizeof(typename Which::MementoType) <= sizeof(grpc_slice);
 };
 
 // Storage type for a single metadata entry.
@@ -18,6 +18,7 @@
 #include <optional>
 
 #include "absl/strings/str_cat.h"
+#include "src/core/lib/promise/party.h"
 #include "src/core/util/match.h"
 
 namespace grpc_core {
@@ -103,6 +104,9 @@ void RequestBuffer::Commit(Reader* winner) {
 }
 
 void RequestBuffer::WakeupAsyncAllPullersExcept(Reader* except_reader) {
+  // There may be many pullers; batch their wakeups into one scheduled closure
+  // instead of scheduling each party separately.
+  Party::AsyncWakeupBatch wakeup_batch;
   for (auto wakeup_reader : readers_) {
     if (wakeup_reader == except_reader) continue;
     wakeup_reader->pull_waker_.WakeupAsync();
@@ -70,13 +70,17 @@ class RequestBuffer {
       return CopyObject(object);
     }
 
+    // Replay for a reader that hasn't won the buffer: metadata is deep
+    // copied, since each attempt mutates its own copy in place, but message
+    // payloads are shared by slice reference - Clone() refs the buffered
+    // slices rather than copying bytes (and slices shared between handles are
+    // never mutated in place downstream), so replaying a buffered request to
+    // another attempt does not duplicate the payload.
     ClientMetadataHandle CopyObject(const ClientMetadataHandle& md) {
       return Arena::MakePooled<ClientMetadata>(md->Copy());
     }
 
-    MessageHandle CopyObject(const MessageHandle& msg) {
-      return Arena::MakePooled<Message>(msg->payload()->Copy(), msg->flags());
-    }
+    MessageHandle CopyObject(const MessageHandle& msg) { return msg->Clone(); }
 
     RequestBuffer* const buffer_;
     bool pulled_client_initial_metadata_ = false;
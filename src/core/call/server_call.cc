@@ -234,6 +234,9 @@ void ServerCall::CommitBatch(const grpc_op* ops, size_t nops, void* notify_tag,
     auto send_trailing_metadata =
         op_index.OpHandler<GRPC_OP_SEND_STATUS_FROM_SERVER>(
             make_send_trailing_metadata);
+    // Initial metadata and a message in the same batch are pushed within one
+    // poll of this combined promise, and CallState delivers both to the
+    // transport under a single wakeup - so they can go out as one write.
     commit_with_send_ops(
         TrySeq(AllOk<StatusFlag>(std::move(send_initial_metadata),
                                  std::move(send_message)),
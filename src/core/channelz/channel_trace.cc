@@ -42,6 +42,44 @@
 namespace grpc_core {
 namespace channelz {
 
+namespace {
+
+// Wraps a Renderer so that its output string is computed at most once.
+// Channelz pollers re-render every committed entry on each scrape, but an
+// entry's description never changes after it has been appended - so repeat
+// scrapes can reuse the string from the first render instead of
+// re-concatenating it. Once the string is cached the inner renderer is
+// released, so the memo replaces (rather than duplicates) the argument
+// storage.
+//
+// The mutable members are only touched while the owning ChannelTrace holds
+// its mutex (all render paths lock it), so no extra synchronization is
+// needed here. Note that MemoryUsage() changes across the first Render()
+// call; ChannelTrace::RenderedText re-accounts for that.
+class MemoizedRenderer final : public ChannelTrace::Renderer {
+ public:
+  explicit MemoizedRenderer(std::unique_ptr<ChannelTrace::Renderer> inner)
+      : inner_(std::move(inner)) {}
+
+  std::string Render() const override {
+    if (rendered_ == nullptr) {
+      rendered_ = std::make_unique<std::string>(inner_->Render());
+      inner_.reset();
+    }
+    return *rendered_;
+  }
+
+  size_t MemoryUsage() const override {
+    return sizeof(Renderer) + MemoryUsageOf(inner_) + MemoryUsageOf(rendered_);
+  }
+
+ private:
+  mutable std::unique_ptr<ChannelTrace::Renderer> inner_;
+  mutable std::unique_ptr<std::string> rendered_;
+};
+
+}  // namespace
+
 //
 // ChannelTrace
 //
@@ -79,7 +117,8 @@ ChannelTrace::EntryRef ChannelTrace::AppendEntry(
   if (max_memory_ == 0) return EntryRef::Sentinel();
   MutexLock lock(&mu_);
   ++num_events_logged_;
-  const auto ref = NewEntry(parent, std::move(renderer));
+  const auto ref = NewEntry(
+      parent, std::make_unique<MemoizedRenderer>(std::move(renderer)));
   while (current_memory_ > max_memory_ && first_entry_ != kSentinelId) {
     DropEntryId(first_entry_);
   }
@@ -224,8 +263,7 @@ void ChannelTrace::RenderEntry(
     absl::FunctionRef<void(gpr_timespec, std::string)> callback,
     int depth) const {
   if (entry.renderer != nullptr) {
-    callback(entry.when.as_timespec(GPR_CLOCK_REALTIME),
-             entry.renderer->Render());
+    callback(entry.when.as_timespec(GPR_CLOCK_REALTIME), RenderedText(entry));
   } else if (entry.first_child != kSentinelId) {
     callback(entry.when.as_timespec(GPR_CLOCK_REALTIME),
              "?unknown parent entry?");
@@ -240,6 +278,18 @@ void ChannelTrace::RenderEntry(
   }
 }
 
+std::string ChannelTrace::RenderedText(const Entry& entry) const {
+  const size_t usage_before = entry.renderer->MemoryUsage();
+  std::string text = entry.renderer->Render();
+  // The first render memoizes the string inside the renderer, changing its
+  // reported memory usage; fold the delta into current_memory_ so that the
+  // accounting (and the DCHECKs validating it) stay exact. Any resulting
+  // overage is healed by eviction on the next AppendEntry().
+  current_memory_ += entry.renderer->MemoryUsage();
+  current_memory_ -= usage_before;
+  return text;
+}
+
 void ChannelTrace::Render(grpc_channelz_v2_Entity* entity,
                           upb_Arena* arena) const {
   MutexLock lock(&mu_);
@@ -261,7 +311,7 @@ void ChannelTrace::RenderEntry(const Entry& entry,
       grpc_channelz_v2_TraceEvent_mutable_timestamp(trace_event, arena));
   if (entry.renderer != nullptr) {
     grpc_channelz_v2_TraceEvent_set_description(
-        trace_event, CopyStdStringToUpbString(entry.renderer->Render(), arena));
+        trace_event, CopyStdStringToUpbString(RenderedText(entry), arena));
   }
   for (uint16_t id = entry.first_child; id != kSentinelId;
        id = entries_[id].next_sibling) {
@@ -354,6 +354,10 @@ class ChannelTrace {
   void DropEntry(EntryRef entry) ABSL_LOCKS_EXCLUDED(mu_);
   void DropEntryId(uint16_t id) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
+  // Renders the entry's description, updating current_memory_ if the
+  // renderer memoized its output (and so changed its reported memory usage).
+  std::string RenderedText(const Entry& entry) const
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
   void RenderEntry(const Entry& entry,
                    absl::FunctionRef<void(gpr_timespec, std::string)> callback,
                    int depth) const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
@@ -364,7 +368,9 @@ class ChannelTrace {
   const Timestamp time_created_ = Timestamp::Now();
   uint64_t num_events_logged_ ABSL_GUARDED_BY(mu_) = 0;
   const uint32_t max_memory_;
-  uint32_t current_memory_ ABSL_GUARDED_BY(mu_) = 0;
+  // Mutable because rendering (a const operation) memoizes rendered strings
+  // inside the entries' renderers, which shifts their accounted memory.
+  mutable uint32_t current_memory_ ABSL_GUARDED_BY(mu_) = 0;
   uint16_t next_free_entry_ ABSL_GUARDED_BY(mu_) = kSentinelId;
   uint16_t first_entry_ ABSL_GUARDED_BY(mu_) = kSentinelId;
   uint16_t last_entry_ ABSL_GUARDED_BY(mu_) = kSentinelId;
@@ -49,8 +49,7 @@ namespace channelz {
 
 namespace {
 template <typename T>
-std::string RenderArray(std::tuple<T, bool> values_and_end,
-                        const std::string& key) {
+Json RenderArray(std::tuple<T, bool> values_and_end, const std::string& key) {
   auto& [values, end] = values_and_end;
   Json::Object object;
   if (!values.empty()) {
@@ -64,7 +63,7 @@ std::string RenderArray(std::tuple<T, bool> values_and_end,
   if (end) {
     object["end"] = Json::FromBool(true);
   }
-  return JsonDump(Json::FromObject(std::move(object)));
+  return Json::FromObject(std::move(object));
 }
 
 Json RemoveAdditionalInfo(const Json& json) {
@@ -94,6 +93,13 @@ Json RemoveAdditionalInfo(const Json& json) {
 char* ApplyHacks(const std::string& json_str) {
   return gpr_strdup(StripAdditionalInfoFromJson(json_str).c_str());
 }
+
+// Same as above, but operates on the Json value directly. This spares the
+// dump/re-parse round trip of the string overload, which dominates query cost
+// on processes with many channels.
+char* ApplyHacks(const Json& json) {
+  return gpr_strdup(JsonDump(RemoveAdditionalInfo(json)).c_str());
+}
 }  // namespace
 
 std::string StripAdditionalInfoFromJson(absl::string_view json_str) {
@@ -122,11 +128,11 @@ void ChannelzRegistry::InternalLogAllEntities() {
 }
 
 std::string ChannelzRegistry::GetTopChannelsJson(intptr_t start_channel_id) {
-  return RenderArray(GetTopChannels(start_channel_id), "channel");
+  return JsonDump(RenderArray(GetTopChannels(start_channel_id), "channel"));
 }
 
 std::string ChannelzRegistry::GetServersJson(intptr_t start_server_id) {
-  return RenderArray(GetServers(start_server_id), "server");
+  return JsonDump(RenderArray(GetServers(start_server_id), "server"));
 }
 
 void ChannelzRegistry::InternalRegister(BaseNode* node) {
@@ -150,8 +156,9 @@ void ChannelzRegistry::InternalUnregister(BaseNode* node) {
     // if necessary, then exit out.
     node_shard.mu.Unlock();
     if (uuid != -1) {
-      MutexLock lock(&index_mu_);
-      index_.erase(uuid);
+      IndexShard& index_shard = index_shards_[IndexShardIndex(uuid)];
+      MutexLock lock(&index_shard.mu);
+      index_shard.index.erase(uuid);
     }
     return;
   }
@@ -191,9 +198,10 @@ void ChannelzRegistry::InternalUnregister(BaseNode* node) {
   WeakRefCountedPtr<BaseNode> gcd_node(n);
   node_shard.mu.Unlock();
   if (gc_list == &node_shard.orphaned_numbered) {
-    MutexLock lock(&index_mu_);
     intptr_t uuid = n->uuid_.load(std::memory_order_relaxed);
-    index_.erase(uuid);
+    IndexShard& index_shard = index_shards_[IndexShardIndex(uuid)];
+    MutexLock lock(&index_shard.mu);
+    index_shard.index.erase(uuid);
   }
 }
 
@@ -216,29 +224,13 @@ ChannelzRegistry::QueryNodes(
     nursery_visitation_order.push_back(i);
   }
   absl::c_shuffle(nursery_visitation_order, SharedBitGen());
-  // In the iteration below, even once we have max_results nodes, we need
-  // to find the next node in order to know if we've hit the end.  If we get
-  // through the loop without returning, then we return end=true.  But if we
-  // find a node to add after we already have max_results nodes, then we
-  // return with end=false before exiting the loop.  However, in the latter
-  // case, we will have already increased the ref count of the next node,
-  // so we need to unref it, but we can't do that while holding the lock.
-  // So instead, we store it in node_after_end, which will be unreffed
-  // after releasing the lock.
-  WeakRefCountedPtr<BaseNode> node_after_end;
-  std::vector<WeakRefCountedPtr<BaseNode>> result;
-  MutexLock index_lock(&index_mu_);
-  for (auto it = index_.lower_bound(start_node); it != index_.end(); ++it) {
-    BaseNode* node = it->second;
-    if (!discriminator(node)) continue;
-    auto node_ref = node->WeakRefIfNonZero();
-    if (node_ref == nullptr) continue;
-    if (result.size() == max_results) {
-      node_after_end = std::move(node_ref);
-      return std::tuple(std::move(result), false);
-    }
-    result.emplace_back(std::move(node_ref));
-  }
+  // First drain the nurseries: assign uuids to matching nodes so that the
+  // index scan below can see them. Inserting into the index shard while
+  // still holding the node shard lock keeps numbering and index visibility
+  // atomic with respect to InternalUnregister (lock order: node shard
+  // before index shard). The weak refs taken while walking the lists are
+  // collected here and dropped after all locks are released.
+  std::vector<WeakRefCountedPtr<BaseNode>> drained_refs;
   for (auto nursery_index : nursery_visitation_order) {
     NodeShard& node_shard = node_shards_[nursery_index];
     MutexLock shard_lock(&node_shard.mu);
@@ -248,40 +240,70 @@ ChannelzRegistry::QueryNodes(
       if (nursery->head == nullptr) continue;
       BaseNode* n = nursery->head;
       while (n != nullptr) {
+        BaseNode* next = n->next_;
         if (!discriminator(n)) {
-          n = n->next_;
+          n = next;
           continue;
         }
         auto node_ref = n->WeakRefIfNonZero();
         if (node_ref == nullptr) {
-          n = n->next_;
+          n = next;
           continue;
         }
-        BaseNode* next = n->next_;
+        drained_refs.emplace_back(std::move(node_ref));
         nursery->Remove(n);
         numbered->AddToHead(n);
-        n->uuid_ = uuid_generator_;
-        ++uuid_generator_;
-        index_.emplace(n->uuid_, n);
-        if (n->uuid_ >= start_node) {
-          if (result.size() == max_results) {
-            node_after_end = std::move(node_ref);
-            return std::tuple(std::move(result), false);
-          }
-          result.emplace_back(std::move(node_ref));
+        const intptr_t uuid =
+            uuid_generator_.fetch_add(1, std::memory_order_relaxed);
+        n->uuid_ = uuid;
+        {
+          IndexShard& index_shard = index_shards_[IndexShardIndex(uuid)];
+          MutexLock index_lock(&index_shard.mu);
+          index_shard.index.emplace(uuid, n);
         }
         n = next;
       }
     }
   }
-  CHECK(node_after_end == nullptr);
+  // Now scan the index shards. Each shard contributes its smallest
+  // max_results + 1 matching uuids at or after start_node; the globally
+  // smallest max_results + 1 matches are necessarily among them, which is
+  // enough both to fill the page and to decide whether it is the last one.
+  std::vector<WeakRefCountedPtr<BaseNode>> result;
+  for (size_t i = 0; i < kNodeShards; ++i) {
+    IndexShard& index_shard = index_shards_[i];
+    MutexLock index_lock(&index_shard.mu);
+    size_t from_this_shard = 0;
+    for (auto it = index_shard.index.lower_bound(start_node);
+         it != index_shard.index.end() && from_this_shard <= max_results;
+         ++it) {
+      BaseNode* node = it->second;
+      if (!discriminator(node)) continue;
+      auto node_ref = node->WeakRefIfNonZero();
+      if (node_ref == nullptr) continue;
+      result.emplace_back(std::move(node_ref));
+      ++from_this_shard;
+    }
+  }
+  std::sort(result.begin(), result.end(),
+            [](const WeakRefCountedPtr<BaseNode>& a,
+               const WeakRefCountedPtr<BaseNode>& b) {
+              return a->uuid_.load(std::memory_order_relaxed) <
+                     b->uuid_.load(std::memory_order_relaxed);
+            });
+  if (result.size() > max_results) {
+    // The extra refs are dropped here, outside of any locks.
+    result.resize(max_results);
+    return std::tuple(std::move(result), false);
+  }
   return std::tuple(std::move(result), true);
 }
 
 WeakRefCountedPtr<BaseNode> ChannelzRegistry::InternalGet(intptr_t uuid) {
-  MutexLock index_lock(&index_mu_);
-  auto it = index_.find(uuid);
-  if (it == index_.end()) return nullptr;
+  IndexShard& index_shard = index_shards_[IndexShardIndex(uuid)];
+  MutexLock index_lock(&index_shard.mu);
+  auto it = index_shard.index.find(uuid);
+  if (it == index_shard.index.end()) return nullptr;
   BaseNode* node = it->second;
   return node->WeakRefIfNonZero();
 }
@@ -292,12 +314,10 @@ intptr_t ChannelzRegistry::InternalNumberNode(BaseNode* node) {
   if (strong_node == nullptr) return 0;
   const size_t node_shard_index = NodeShardIndex(node);
   NodeShard& node_shard = node_shards_[node_shard_index];
-  MutexLock index_lock(&index_mu_);
   MutexLock lock(&node_shard.mu);
   intptr_t uuid = node->uuid_.load(std::memory_order_relaxed);
   if (uuid != -1) return uuid;
-  uuid = uuid_generator_;
-  ++uuid_generator_;
+  uuid = uuid_generator_.fetch_add(1, std::memory_order_relaxed);
   node->uuid_ = uuid;
   if (node->orphaned_index_ > 0) {
     node_shard.orphaned.Remove(node);
@@ -306,7 +326,9 @@ intptr_t ChannelzRegistry::InternalNumberNode(BaseNode* node) {
     node_shard.nursery.Remove(node);
     node_shard.numbered.AddToHead(node);
   }
-  index_.emplace(uuid, node);
+  IndexShard& index_shard = index_shards_[IndexShardIndex(uuid)];
+  MutexLock index_lock(&index_shard.mu);
+  index_shard.index.emplace(uuid, node);
   return uuid;
 }
 
@@ -354,7 +376,7 @@ void ChannelzRegistry::NodeList::Remove(BaseNode* node) {
 }
 void ChannelzRegistry::TestOnlyReset() {
   auto* p = Default();
-  p->uuid_generator_ = 1;
+  p->uuid_generator_.store(1, std::memory_order_relaxed);
   p->LoadConfig();
   std::vector<WeakRefCountedPtr<BaseNode>> free_nodes;
   for (size_t i = 0; i < kNodeShards; i++) {
@@ -373,8 +395,10 @@ void ChannelzRegistry::TestOnlyReset() {
   }
   std::vector<NodeShard> replace_node_shards(kNodeShards);
   replace_node_shards.swap(p->node_shards_);
-  MutexLock lock(&p->index_mu_);
-  p->index_.clear();
+  for (size_t i = 0; i < kNodeShards; i++) {
+    MutexLock lock(&p->index_shards_[i].mu);
+    p->index_shards_[i].index.clear();
+  }
 }
 
 }  // namespace channelz
@@ -382,17 +406,16 @@ void ChannelzRegistry::TestOnlyReset() {
 
 char* grpc_channelz_get_top_channels(intptr_t start_channel_id) {
   grpc_core::ExecCtx exec_ctx;
-  return grpc_core::channelz::ApplyHacks(
-      grpc_core::channelz::ChannelzRegistry::GetTopChannelsJson(
-          start_channel_id)
-          .c_str());
+  return grpc_core::channelz::ApplyHacks(grpc_core::channelz::RenderArray(
+      grpc_core::channelz::ChannelzRegistry::GetTopChannels(start_channel_id),
+      "channel"));
 }
 
 char* grpc_channelz_get_servers(intptr_t start_server_id) {
   grpc_core::ExecCtx exec_ctx;
-  return grpc_core::channelz::ApplyHacks(
-      grpc_core::channelz::ChannelzRegistry::GetServersJson(start_server_id)
-          .c_str());
+  return grpc_core::channelz::ApplyHacks(grpc_core::channelz::RenderArray(
+      grpc_core::channelz::ChannelzRegistry::GetServers(start_server_id),
+      "server"));
 }
 
 char* grpc_channelz_get_server(intptr_t server_id) {
@@ -407,7 +430,7 @@ char* grpc_channelz_get_server(intptr_t server_id) {
   grpc_core::Json json = grpc_core::Json::FromObject({
       {"server", server_node->RenderJson()},
   });
-  return grpc_core::channelz::ApplyHacks(grpc_core::JsonDump(json).c_str());
+  return grpc_core::channelz::ApplyHacks(json);
 }
 
 char* grpc_channelz_get_server_sockets(intptr_t server_id,
@@ -426,7 +449,9 @@ char* grpc_channelz_get_server_sockets(intptr_t server_id,
   // actually a server node.
   grpc_core::channelz::ServerNode* server_node =
       static_cast<grpc_core::channelz::ServerNode*>(base_node.get());
-  return grpc_core::channelz::ApplyHacks(
+  // RenderServerSockets emits only socket refs, which contain nothing that
+  // needs stripping.
+  return gpr_strdup(
       server_node->RenderServerSockets(start_socket_id, max_results).c_str());
 }
 
@@ -444,7 +469,7 @@ char* grpc_channelz_get_channel(intptr_t channel_id) {
   grpc_core::Json json = grpc_core::Json::FromObject({
       {"channel", channel_node->RenderJson()},
   });
-  return grpc_core::channelz::ApplyHacks(grpc_core::JsonDump(json).c_str());
+  return grpc_core::channelz::ApplyHacks(json);
 }
 
 char* grpc_channelz_get_subchannel(intptr_t subchannel_id) {
@@ -459,7 +484,7 @@ char* grpc_channelz_get_subchannel(intptr_t subchannel_id) {
   grpc_core::Json json = grpc_core::Json::FromObject({
       {"subchannel", subchannel_node->RenderJson()},
   });
-  return grpc_core::channelz::ApplyHacks(grpc_core::JsonDump(json).c_str());
+  return grpc_core::channelz::ApplyHacks(json);
 }
 
 char* grpc_channelz_get_socket(intptr_t socket_id) {
@@ -476,5 +501,5 @@ char* grpc_channelz_get_socket(intptr_t socket_id) {
   grpc_core::Json json = grpc_core::Json::FromObject({
       {"socket", socket_node->RenderJson()},
   });
-  return grpc_core::channelz::ApplyHacks(grpc_core::JsonDump(json).c_str());
+  return grpc_core::channelz::ApplyHacks(json);
 }
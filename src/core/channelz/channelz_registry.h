@@ -21,6 +21,7 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <atomic>
 #include <cstdint>
 #include <map>
 #include <string>
@@ -261,15 +262,27 @@ class ChannelzRegistry final {
   void InternalLogAllEntities();
   std::vector<WeakRefCountedPtr<BaseNode>> InternalGetAllEntities();
 
+  // The uuid -> node index is sharded separately from the node lists: a
+  // node's list shard is chosen by its address, but its index shard is
+  // chosen by its uuid, so that lookups, numbering, and unregistration of
+  // numbered nodes never contend on one global lock. Where both locks are
+  // needed the node shard lock is always taken first.
+  struct alignas(GPR_CACHELINE_SIZE) IndexShard {
+    Mutex mu;
+    absl::btree_map<intptr_t, BaseNode*> index ABSL_GUARDED_BY(mu);
+  };
+
   static constexpr size_t kNodeShards = 63;
   size_t NodeShardIndex(BaseNode* node) {
     return absl::HashOf(node) % kNodeShards;
   }
+  size_t IndexShardIndex(intptr_t uuid) {
+    return static_cast<size_t>(uuid) % kNodeShards;
+  }
 
-  int64_t uuid_generator_{1};
+  std::atomic<int64_t> uuid_generator_{1};
   std::vector<NodeShard> node_shards_{kNodeShards};
-  Mutex index_mu_;
-  absl::btree_map<intptr_t, BaseNode*> index_ ABSL_GUARDED_BY(index_mu_);
+  std::vector<IndexShard> index_shards_{kNodeShards};
   size_t max_orphaned_per_shard_;
 };
 
@@ -17,8 +17,11 @@
 
 #include <grpc/support/time.h>
 
+#include <atomic>
 #include <memory>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "absl/container/flat_hash_set.h"
@@ -91,6 +94,26 @@ template <typename Needle, typename H, typename... Haystack>
 constexpr bool kIsElement<Needle, H, Haystack...> =
     kIsElement<Needle, Haystack...>;
 
+template <typename Config, typename T, typename = void>
+constexpr bool kConfigHasAccepts = false;
+
+template <typename Config, typename T>
+constexpr bool kConfigHasAccepts<
+    Config, T,
+    std::void_t<decltype(std::declval<Config&>().Accepts(
+        std::declval<const T&>()))>> = true;
+
+// Ask the config whether this value should be recorded; configs without an
+// Accepts method record everything.
+template <typename Config, typename T>
+bool AcceptedBy(Config& config, const T& value) {
+  if constexpr (kConfigHasAccepts<Config, T>) {
+    return config.Accepts(value);
+  } else {
+    return true;
+  }
+}
+
 }  // namespace ztrace_collector_detail
 
 inline std::optional<int64_t> IntFromArgs(
@@ -105,8 +128,9 @@ inline std::optional<int64_t> IntFromArgs(
 // Generic collector infrastructure for ztrace queries.
 // Abstracts away most of the ztrace requirements in an efficient manner,
 // allowing system authors to concentrate on emitting useful data.
-// If no trace is performed, overhead is one pointer and one relaxed atomic read
-// per trace event.
+// If no trace is performed, overhead is one pointer and at most two relaxed
+// atomic reads per trace event - no locks are taken unless a query is
+// actually running, including after earlier queries have completed.
 //
 // Two kinds of objects are required:
 // 1. A `Config`
@@ -117,6 +141,10 @@ inline std::optional<int64_t> IntFromArgs(
 //    - Needs a `bool Finishes(T)` method for each Data type (see 2).
 //      This allows the config to terminate a query in the event of reaching
 //      some configured predicate.
+//    - May optionally provide a `bool Accepts(const T&)` method for any Data
+//      type: values it rejects are not recorded for that query (and cannot
+//      finish it). This is how collectors implement sampled or filtered
+//      queries that can stay running against high volume event streams.
 // 2. N `Data` types
 //    - One for each kind of data captured in the trace
 //    - Allows avoiding e.g. variant<> data types; these are inefficient
@@ -167,9 +195,11 @@ class ZTraceCollector {
       gpr_cycle_counter most_recent =
           std::numeric_limits<gpr_cycle_counter>::max();
     };
+    // memory_usage is MemoryUsageOf(value.second), computed by the caller
+    // outside the collector lock.
     template <typename T>
-    void Append(std::pair<gpr_cycle_counter, T> value) {
-      memory_used_ += MemoryUsageOf(value.second);
+    void Append(std::pair<gpr_cycle_counter, T> value, size_t memory_usage) {
+      memory_used_ += memory_usage;
       while (memory_used_ > memory_cap_) RemoveMostRecent();
       std::get<Collection<T> >(data).push_back(std::move(value));
     }
@@ -226,6 +256,11 @@ class ZTraceCollector {
   };
   struct Impl : public RefCounted<Impl> {
     Mutex mu;
+    // Mirrors instances.size(). Lets the data path skip locking entirely
+    // while no query is running - the steady state for an always-on
+    // collector. Must be updated under mu after every mutation of
+    // instances.
+    std::atomic<size_t> active_instances{0};
     absl::flat_hash_set<RefCountedPtr<Instance> > instances ABSL_GUARDED_BY(mu);
   };
   class ZTraceImpl final : public ZTrace {
@@ -261,10 +296,14 @@ class ZTraceCollector {
             {
               MutexLock lock(&impl->mu);
               finish = impl->instances.erase(instance);
+              impl->active_instances.store(impl->instances.size(),
+                                           std::memory_order_relaxed);
             }
             if (finish) instance->Finish(absl::DeadlineExceededError(""));
           });
       impl->instances.insert(instance);
+      impl->active_instances.store(impl->instances.size(),
+                                   std::memory_order_relaxed);
     }
 
    private:
@@ -273,8 +312,14 @@ class ZTraceCollector {
 
   template <typename T>
   void AppendValue(T&& data) {
-    auto value = std::pair(gpr_get_cycle_counter(), std::forward<T>(data));
     auto* impl = impl_.Get();
+    // Lock-free fast path: with no query running (the steady state), a
+    // trace event costs one relaxed atomic read here.
+    if (impl->active_instances.load(std::memory_order_relaxed) == 0) return;
+    auto value = std::pair(gpr_get_cycle_counter(), std::forward<T>(data));
+    // Size the entry outside the lock; only list manipulation and the
+    // finish predicates run inside it.
+    const size_t memory_usage = MemoryUsageOf(value.second);
     {
       MutexLock lock(&impl->mu);
       switch (impl->instances.size()) {
@@ -283,18 +328,27 @@ class ZTraceCollector {
         case 1: {
           auto& instances = impl->instances;
           auto& instance = *instances.begin();
+          if (!ztrace_collector_detail::AcceptedBy(instance->config,
+                                                   value.second)) {
+            return;
+          }
           const bool finishes = instance->config.Finishes(value.second);
-          instance->Append(std::move(value));
+          instance->Append(std::move(value), memory_usage);
           if (finishes) {
             instance->Finish(absl::OkStatus());
             instances.clear();
+            impl->active_instances.store(0, std::memory_order_relaxed);
           }
         } break;
         default: {
           std::vector<RefCountedPtr<Instance> > finished;
           for (auto& instance : impl->instances) {
+            if (!ztrace_collector_detail::AcceptedBy(instance->config,
+                                                     value.second)) {
+              continue;
+            }
             const bool finishes = instance->config.Finishes(value.second);
-            instance->Append(value);
+            instance->Append(value, memory_usage);
             if (finishes) {
               finished.push_back(instance);
             }
@@ -303,6 +357,8 @@ class ZTraceCollector {
             instance->Finish(absl::OkStatus());
             impl->instances.erase(instance);
           }
+          impl->active_instances.store(impl->instances.size(),
+                                       std::memory_order_relaxed);
         }
       }
     }
@@ -78,7 +78,9 @@ class GlobalSubchannelPool final : public SubchannelPoolInterface {
   static const size_t kShards = 127;
 
   using SubchannelMap = AVL<SubchannelKey, WeakRefCountedPtr<Subchannel>>;
-  struct LockedMap {
+  // Cacheline-aligned so that contention on one shard's lock doesn't
+  // bounce the cache line holding its neighbors.
+  struct alignas(GPR_CACHELINE_SIZE) LockedMap {
     Mutex mu;
     SubchannelMap map ABSL_GUARDED_BY(mu);
   };
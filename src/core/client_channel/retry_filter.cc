@@ -123,8 +123,15 @@ RetryFilter::RetryFilter(const grpc_channel_element_args& args)
 const RetryMethodConfig* RetryFilter::GetRetryPolicy(Arena* arena) {
   auto* svc_cfg_call_data = arena->GetContext<ServiceConfigCallData>();
   if (svc_cfg_call_data == nullptr) return nullptr;
-  return static_cast<const RetryMethodConfig*>(
+  auto* retry_policy = static_cast<const RetryMethodConfig*>(
       svc_cfg_call_data->GetMethodParsedConfig(service_config_parser_index_));
+  // Hedging is implemented only in the retry interceptor; treating a
+  // hedging policy as a retry policy here would turn hedges into serial
+  // zero-backoff retries.
+  if (retry_policy != nullptr && retry_policy->hedging_enabled()) {
+    return nullptr;
+  }
+  return retry_policy;
 }
 
 const grpc_channel_filter RetryFilter::kVtable = {
@@ -16,6 +16,7 @@
 
 #include "src/core/lib/promise/cancel_callback.h"
 #include "src/core/lib/promise/for_each.h"
+#include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/sleep.h"
 #include "src/core/service_config/service_config_call_data.h"
@@ -191,8 +192,8 @@ RetryInterceptor::Call::Call(RefCountedPtr<RetryInterceptor> interceptor,
                              CallHandler call_handler)
     : call_handler_(std::move(call_handler)),
       interceptor_(std::move(interceptor)),
-      retry_state_(interceptor_->GetRetryPolicy(),
-                   interceptor_->retry_throttler_) {
+      retry_policy_(interceptor_->GetRetryPolicy()),
+      retry_state_(retry_policy_, interceptor_->retry_throttler_) {
   GRPC_TRACE_LOG(retry, INFO)
       << DebugTag() << " retry call created: " << retry_state_;
 }
@@ -237,23 +238,163 @@ void RetryInterceptor::Call::Start() {
                         }),
                     [self]() { self->request_buffer_.Cancel(); });
   });
+  if (hedging()) {
+    // Launch additional hedged attempts at hedging_delay intervals until
+    // the policy's attempt budget is spent, an attempt commits, or
+    // retries become throttled.
+    call_handler_.SpawnGuardedUntilCallCompletes(
+        "hedging_schedule", [self = Ref()]() {
+          return Loop([self]() {
+            return Seq(Sleep(self->retry_policy_->hedging_delay()),
+                       [self](absl::Status) -> LoopCtl<absl::Status> {
+                         if (!self->MaybeStartHedgedAttempt()) {
+                           return absl::OkStatus();
+                         }
+                         return Continue{};
+                       });
+          });
+        });
+  }
 }
 
 void RetryInterceptor::Call::StartAttempt() {
-  if (current_attempt_ != nullptr) {
-    current_attempt_->Cancel();
+  absl::InlinedVector<RefCountedPtr<Attempt>, 2> cancelled_attempts;
+  RefCountedPtr<Attempt> attempt;
+  {
+    MutexLock lock(&mu_);
+    attempt = StartAttemptLocked(cancelled_attempts);
+  }
+  for (auto& cancelled : cancelled_attempts) cancelled->Cancel();
+  attempt->Start();
+}
+
+RefCountedPtr<RetryInterceptor::Attempt>
+RetryInterceptor::Call::StartAttemptLocked(
+    absl::InlinedVector<RefCountedPtr<Attempt>, 2>& cancelled_attempts) {
+  if (!hedging()) {
+    // Retry mode runs attempts serially: any previous attempt has lost.
+    // Take refs so the attempts are cancelled outside the lock and a
+    // concurrently destroying attempt is never touched.
+    for (Attempt* attempt : active_attempts_) {
+      if (auto ref = attempt->RefIfNonZero(); ref != nullptr) {
+        cancelled_attempts.push_back(std::move(ref));
+      }
+    }
+    active_attempts_.clear();
+  }
+  auto attempt = call_handler_.arena()->MakeRefCounted<Attempt>(
+      Ref(), attempts_started_);
+  ++attempts_started_;
+  active_attempts_.push_back(attempt.get());
+  return attempt;
+}
+
+bool RetryInterceptor::Call::MaybeStartHedgedAttempt() {
+  RefCountedPtr<Attempt> attempt;
+  bool more_attempts_remain;
+  {
+    MutexLock lock(&mu_);
+    if (hedging_throttled_ || request_buffer_.committed() ||
+        attempts_started_ >= retry_policy_->max_attempts()) {
+      return false;
+    }
+    GRPC_TRACE_LOG(retry, INFO)
+        << DebugTag() << " launching hedged attempt " << attempts_started_;
+    absl::InlinedVector<RefCountedPtr<Attempt>, 2> cancelled_attempts;
+    attempt = StartAttemptLocked(cancelled_attempts);
+    DCHECK(cancelled_attempts.empty());
+    more_attempts_remain = attempts_started_ < retry_policy_->max_attempts();
+  }
+  attempt->Start();
+  return more_attempts_remain;
+}
+
+bool RetryInterceptor::Call::OnHedgedAttemptFailed(Attempt* attempt,
+                                                   const ServerMetadata& md) {
+  const auto status = md.get(GrpcStatusMetadata());
+  MutexLock lock(&mu_);
+  if (status.has_value() && *status == GRPC_STATUS_OK) {
+    retry_state_.RecordAttemptSucceeded();
+    return false;
+  }
+  if (status.has_value() &&
+      !retry_policy_->non_fatal_status_codes().Contains(*status)) {
+    GRPC_TRACE_LOG(retry, INFO)
+        << DebugTag() << " status " << grpc_status_code_to_string(*status)
+        << " is fatal for hedging";
+    return false;
+  }
+  if (!retry_state_.RecordHedgedAttemptFailure()) {
+    GRPC_TRACE_LOG(retry, INFO) << DebugTag() << " hedged attempts throttled";
+    hedging_throttled_ = true;
+  }
+  // Negative server push-back means no further attempts should be made.
+  const auto server_pushback = md.get(GrpcRetryPushbackMsMetadata());
+  if (server_pushback.has_value() && *server_pushback < Duration::Zero()) {
+    GRPC_TRACE_LOG(retry, INFO)
+        << DebugTag() << " stopping hedging due to server push-back";
+    hedging_throttled_ = true;
   }
-  auto current_attempt = call_handler_.arena()->MakeRefCounted<Attempt>(Ref());
-  current_attempt_ = current_attempt.get();
-  current_attempt->Start();
+  // Drop this attempt only if some other attempt can still produce the
+  // call's result; otherwise this status is the call's result.  The
+  // removal must happen in the same critical section as the decision:
+  // two concurrently failing attempts may otherwise each count the other
+  // as still able to produce the result, both drop, and the call hangs.
+  bool other_attempt_outstanding = false;
+  for (Attempt* a : active_attempts_) {
+    if (a != attempt) {
+      other_attempt_outstanding = true;
+      break;
+    }
+  }
+  const bool more_attempts_possible =
+      !hedging_throttled_ && !request_buffer_.committed() &&
+      attempts_started_ < retry_policy_->max_attempts();
+  const bool drop_attempt = other_attempt_outstanding || more_attempts_possible;
+  if (drop_attempt) RemoveAttemptLocked(attempt);
+  return drop_attempt;
+}
+
+bool RetryInterceptor::Call::TryCommitAttempt(Attempt* attempt) {
+  absl::InlinedVector<RefCountedPtr<Attempt>, 2> cancelled_attempts;
+  {
+    MutexLock lock(&mu_);
+    if (committed_attempt_ == attempt) return true;
+    if (committed_attempt_ != nullptr) return false;
+    if (std::find(active_attempts_.begin(), active_attempts_.end(), attempt) ==
+        active_attempts_.end()) {
+      return false;
+    }
+    committed_attempt_ = attempt;
+    // The request buffer must be committed exactly once, so do it on the
+    // winning transition while still holding the lock.
+    request_buffer_.Commit(attempt->reader());
+    // Losing hedged attempts are cancelled as soon as a winner commits.
+    // Take refs so an attempt racing to destruction is never touched.
+    for (Attempt* loser : active_attempts_) {
+      if (loser == attempt) continue;
+      if (auto ref = loser->RefIfNonZero(); ref != nullptr) {
+        cancelled_attempts.push_back(std::move(ref));
+      }
+    }
+    active_attempts_.clear();
+    active_attempts_.push_back(attempt);
+  }
+  for (auto& loser : cancelled_attempts) loser->Cancel();
+  return true;
 }
 
 void RetryInterceptor::Call::MaybeCommit(size_t buffered) {
   GRPC_TRACE_LOG(retry, INFO) << DebugTag() << " buffered:" << buffered << "/"
                               << interceptor_->per_rpc_retry_buffer_size_;
-  if (buffered >= interceptor_->per_rpc_retry_buffer_size_) {
-    std::ignore = current_attempt_->Commit();
+  if (buffered < interceptor_->per_rpc_retry_buffer_size_) return;
+  RefCountedPtr<Attempt> attempt;
+  {
+    MutexLock lock(&mu_);
+    if (active_attempts_.empty()) return;
+    attempt = active_attempts_.front()->RefIfNonZero();
   }
+  if (attempt != nullptr) std::ignore = attempt->Commit();
 }
 
 std::string RetryInterceptor::Call::DebugTag() {
@@ -263,8 +404,11 @@ std::string RetryInterceptor::Call::DebugTag() {
 ////////////////////////////////////////////////////////////////////////////////
 // RetryInterceptor::Attempt
 
-RetryInterceptor::Attempt::Attempt(RefCountedPtr<Call> call)
-    : call_(std::move(call)), reader_(call_->request_buffer()) {
+RetryInterceptor::Attempt::Attempt(RefCountedPtr<Call> call,
+                                   int prior_attempts)
+    : call_(std::move(call)),
+      reader_(call_->request_buffer()),
+      prior_attempts_(prior_attempts) {
   GRPC_TRACE_LOG(retry, INFO) << DebugTag() << " retry attempt created";
 }
 
@@ -310,22 +454,39 @@ auto RetryInterceptor::Attempt::ServerToClientGotTrailersOnlyResponse() {
         GRPC_TRACE_LOG(retry, INFO)
             << self->DebugTag()
             << " got server trailing metadata: " << md->DebugString();
-        auto delay = self->call_->ShouldRetry(
-            *md,
-            [self = self.get()]() -> std::string { return self->DebugTag(); });
+        // A losing hedged attempt just goes away: some other attempt (in
+        // flight or yet to be launched) will produce the call's result.
+        const bool drop_attempt =
+            self->call_->hedging() &&
+            self->call_->OnHedgedAttemptFailed(self.get(), *md);
         return If(
-            delay.has_value(),
-            [self, delay]() {
-              return Map(Sleep(*delay), [call = self->call_](absl::Status) {
-                call->StartAttempt();
-                return absl::OkStatus();
-              });
+            drop_attempt,
+            []() {
+              return []() { return absl::OkStatus(); };
             },
-            [self, md = std::move(md)]() mutable {
-              if (!self->Commit()) return absl::CancelledError();
-              self->call_->call_handler()->SpawnPushServerTrailingMetadata(
-                  std::move(md));
-              return absl::OkStatus();
+            [&]() {
+              std::optional<Duration> delay;
+              if (!self->call_->hedging()) {
+                delay = self->call_->ShouldRetry(
+                    *md, [self = self.get()]() -> std::string {
+                      return self->DebugTag();
+                    });
+              }
+              return If(
+                  delay.has_value(),
+                  [self, delay]() {
+                    return Map(Sleep(*delay),
+                               [call = self->call_](absl::Status) {
+                                 call->StartAttempt();
+                                 return absl::OkStatus();
+                               });
+                  },
+                  [self, md = std::move(md)]() mutable {
+                    if (!self->Commit()) return absl::CancelledError();
+                    self->call_->call_handler()
+                        ->SpawnPushServerTrailingMetadata(std::move(md));
+                    return absl::OkStatus();
+                  });
             });
       });
 }
@@ -347,23 +508,18 @@ auto RetryInterceptor::Attempt::ServerToClient() {
 }
 
 bool RetryInterceptor::Attempt::Commit(SourceLocation whence) {
-  if (committed_) return true;
   GRPC_TRACE_LOG(retry, INFO) << DebugTag() << " commit attempt from "
                               << whence.file() << ":" << whence.line();
-  if (!call_->IsCurrentAttempt(this)) return false;
-  committed_ = true;
-  call_->request_buffer()->Commit(reader());
-  return true;
+  return call_->TryCommitAttempt(this);
 }
 
 auto RetryInterceptor::Attempt::ClientToServer() {
   return TrySeq(
       reader_.PullClientInitialMetadata(),
       [self = Ref()](ClientMetadataHandle metadata) {
-        int num_attempts_completed = self->call_->num_attempts_completed();
-        if (GPR_UNLIKELY(num_attempts_completed > 0)) {
-          metadata->Set(GrpcPreviousRpcAttemptsMetadata(),
-                        num_attempts_completed);
+        const int prior_attempts = self->prior_attempts_;
+        if (GPR_UNLIKELY(prior_attempts > 0)) {
+          metadata->Set(GrpcPreviousRpcAttemptsMetadata(), prior_attempts);
         } else {
           metadata->Remove(GrpcPreviousRpcAttemptsMetadata());
         }
@@ -15,6 +15,9 @@
 #ifndef GRPC_SRC_CORE_CLIENT_CHANNEL_RETRY_INTERCEPTOR_H
 #define GRPC_SRC_CORE_CLIENT_CHANNEL_RETRY_INTERCEPTOR_H
 
+#include <algorithm>
+
+#include "absl/container/inlined_vector.h"
 #include "src/core/call/interception_chain.h"
 #include "src/core/call/request_buffer.h"
 #include "src/core/client_channel/client_channel_args.h"
@@ -22,6 +25,7 @@
 #include "src/core/client_channel/retry_throttle.h"
 #include "src/core/filter/filter_args.h"
 #include "src/core/util/backoff.h"
+#include "src/core/util/sync.h"
 
 namespace grpc_core {
 
@@ -39,6 +43,18 @@ class RetryState {
       absl::FunctionRef<std::string()> lazy_attempt_debug_string);
   int num_attempts_completed() const { return num_attempts_completed_; }
 
+  // Hedging counterparts to ShouldRetry: hedged attempts are scheduled
+  // by timer rather than by failure, but their results still feed the
+  // retry throttle.  RecordHedgedAttemptFailure() returns false if
+  // throttling forbids launching further hedged attempts.
+  GRPC_MUST_USE_RESULT bool RecordHedgedAttemptFailure() {
+    ++num_attempts_completed_;
+    return retry_throttler_ == nullptr || retry_throttler_->RecordFailure();
+  }
+  void RecordAttemptSucceeded() {
+    if (retry_throttler_ != nullptr) retry_throttler_->RecordSuccess();
+  }
+
   template <typename Sink>
   friend void AbslStringify(Sink& sink, const RetryState& state) {
     sink.Append(absl::StrCat("policy:{",
@@ -94,37 +110,70 @@ class RetryInterceptor : public Interceptor {
     std::optional<Duration> ShouldRetry(
         const ServerMetadata& md,
         absl::FunctionRef<std::string()> lazy_attempt_debug_string) {
+      MutexLock lock(&mu_);
       return retry_state_.ShouldRetry(md, request_buffer_.committed(),
                                       lazy_attempt_debug_string);
     }
-    int num_attempts_completed() const {
-      return retry_state_.num_attempts_completed();
+    bool hedging() const {
+      return retry_policy_ != nullptr && retry_policy_->hedging_enabled();
     }
+    // Called when a hedged attempt received a trailers-only response
+    // that did not win the call.  Returns true if the attempt should be
+    // quietly dropped because another attempt (in flight or yet to be
+    // launched) may still produce the call's result, or false if this
+    // attempt's status must be surfaced to the application.  On a drop
+    // the attempt is removed from the active set in the same critical
+    // section, so two concurrently failing attempts can never both count
+    // each other as the surviving producer of the call's result.
+    bool OnHedgedAttemptFailed(Attempt* attempt, const ServerMetadata& md);
+    // Tries to commit the given attempt.  Returns false if some other
+    // attempt already won (or this one was already cancelled); on the
+    // winning transition commits the request buffer and cancels all
+    // losing attempts.  Idempotent for the winner.
+    bool TryCommitAttempt(Attempt* attempt);
     void RemoveAttempt(Attempt* attempt) {
-      if (current_attempt_ == attempt) current_attempt_ = nullptr;
-    }
-    bool IsCurrentAttempt(Attempt* attempt) {
-      CHECK(attempt != nullptr);
-      return current_attempt_ == attempt;
+      MutexLock lock(&mu_);
+      RemoveAttemptLocked(attempt);
     }
 
     std::string DebugTag();
 
    private:
     void MaybeCommit(size_t buffered);
+    bool MaybeStartHedgedAttempt();
+    RefCountedPtr<Attempt> StartAttemptLocked(
+        absl::InlinedVector<RefCountedPtr<Attempt>, 2>& cancelled_attempts)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+    void RemoveAttemptLocked(Attempt* attempt)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+      auto it = std::find(active_attempts_.begin(), active_attempts_.end(),
+                          attempt);
+      if (it != active_attempts_.end()) active_attempts_.erase(it);
+      if (committed_attempt_ == attempt) committed_attempt_ = nullptr;
+    }
     auto ClientToBuffer();
 
     RequestBuffer request_buffer_;
     CallHandler call_handler_;
     RefCountedPtr<RetryInterceptor> interceptor_;
-    Attempt* current_attempt_ = nullptr;
-    retry_detail::RetryState retry_state_;
+    const internal::RetryMethodConfig* const retry_policy_;
+    // Hedged attempts run concurrently on their own child-call parties,
+    // and attempts release themselves from whichever thread drops the
+    // last ref, so all bookkeeping below is guarded by mu_.
+    Mutex mu_;
+    // Retry mode has at most one attempt in flight; hedging mode has up
+    // to max_attempts.
+    absl::InlinedVector<Attempt*, 2> active_attempts_ ABSL_GUARDED_BY(mu_);
+    Attempt* committed_attempt_ ABSL_GUARDED_BY(mu_) = nullptr;
+    int attempts_started_ ABSL_GUARDED_BY(mu_) = 0;
+    bool hedging_throttled_ ABSL_GUARDED_BY(mu_) = false;
+    retry_detail::RetryState retry_state_ ABSL_GUARDED_BY(mu_);
   };
 
   class Attempt final
       : public RefCounted<Attempt, NonPolymorphicRefCount, UnrefCallDtor> {
    public:
-    explicit Attempt(RefCountedPtr<Call> call);
+    Attempt(RefCountedPtr<Call> call, int prior_attempts);
     ~Attempt();
 
     void Start();
@@ -143,7 +192,7 @@ class RetryInterceptor : public Interceptor {
     RefCountedPtr<Call> call_;
     RequestBuffer::Reader reader_;
     CallInitiator initiator_;
-    bool committed_ = false;
+    const int prior_attempts_;
   };
 
   const internal::RetryMethodConfig* GetRetryPolicy();
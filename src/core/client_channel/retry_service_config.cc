@@ -213,6 +213,50 @@ void RetryMethodConfig::JsonPostLoad(const Json& json, const JsonArgs& args,
   }
 }
 
+std::unique_ptr<RetryMethodConfig> RetryMethodConfig::ParseHedgingPolicy(
+    const Json& json, const JsonArgs& args, ValidationErrors* errors) {
+  auto config = std::make_unique<RetryMethodConfig>();
+  config->hedging_ = true;
+  // Parse maxAttempts.
+  auto max_attempts =
+      LoadJsonObjectField<int>(json.object(), args, "maxAttempts", errors);
+  if (max_attempts.has_value()) {
+    ValidationErrors::ScopedField field(errors, ".maxAttempts");
+    if (*max_attempts <= 1) {
+      errors->AddError("must be at least 2");
+    } else if (*max_attempts > MAX_MAX_RETRY_ATTEMPTS) {
+      LOG(ERROR) << "service config: clamped hedgingPolicy.maxAttempts at "
+                 << MAX_MAX_RETRY_ATTEMPTS;
+      *max_attempts = MAX_MAX_RETRY_ATTEMPTS;
+    }
+    config->max_attempts_ = *max_attempts;
+  }
+  // Parse hedgingDelay.  Defaults to zero, in which case all attempts
+  // are launched immediately.
+  auto hedging_delay = LoadJsonObjectField<Duration>(
+      json.object(), args, "hedgingDelay", errors, /*required=*/false);
+  if (hedging_delay.has_value()) config->hedging_delay_ = *hedging_delay;
+  // Parse nonFatalStatusCodes.  May be empty, in which case any failure
+  // is fatal and simply ends hedging.
+  auto status_code_list = LoadJsonObjectField<std::vector<std::string>>(
+      json.object(), args, "nonFatalStatusCodes", errors,
+      /*required=*/false);
+  if (status_code_list.has_value()) {
+    for (size_t i = 0; i < status_code_list->size(); ++i) {
+      ValidationErrors::ScopedField field(
+          errors, absl::StrCat(".nonFatalStatusCodes[", i, "]"));
+      grpc_status_code status;
+      if (!grpc_status_code_from_string((*status_code_list)[i].c_str(),
+                                        &status)) {
+        errors->AddError("failed to parse status code");
+      } else {
+        config->retryable_status_codes_.Add(status);
+      }
+    }
+  }
+  return config;
+}
+
 //
 // RetryServiceConfigParser
 //
@@ -273,6 +317,21 @@ RetryServiceConfigParser::ParsePerMethodParams(const ChannelArgs& args,
                                                ValidationErrors* errors) {
   auto method_params =
       LoadFromJson<MethodConfig>(json, JsonChannelArgs(args), errors);
+  if (args.GetBool(GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING).value_or(false)) {
+    auto it = json.object().find("hedgingPolicy");
+    if (it != json.object().end()) {
+      ValidationErrors::ScopedField field(errors, ".hedgingPolicy");
+      if (method_params.retry_policy != nullptr) {
+        errors->AddError(
+            "at most one of retryPolicy and hedgingPolicy may be set");
+      } else if (it->second.type() != Json::Type::kObject) {
+        errors->AddError("is not an object");
+      } else {
+        return RetryMethodConfig::ParseHedgingPolicy(
+            it->second, JsonChannelArgs(args), errors);
+      }
+    }
+  }
   return std::move(method_params.retry_policy);
 }
 
@@ -65,10 +65,27 @@ class RetryMethodConfig final : public ServiceConfigParser::ParsedConfig {
     return per_attempt_recv_timeout_;
   }
 
+  // Hedging (see gRFC A6): when enabled, attempts are launched
+  // concurrently at hedging_delay() intervals rather than serially after
+  // failures.  non_fatal_status_codes() plays the role for hedging that
+  // retryable_status_codes() plays for retries; the two share storage,
+  // since a config is either a retry policy or a hedging policy.
+  bool hedging_enabled() const { return hedging_; }
+  Duration hedging_delay() const { return hedging_delay_; }
+  StatusCodeSet non_fatal_status_codes() const {
+    return retryable_status_codes_;
+  }
+
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
   void JsonPostLoad(const Json& json, const JsonArgs& args,
                     ValidationErrors* errors);
 
+  // Parses a "hedgingPolicy" JSON object.  Unlike retry policies, which
+  // are parsed via JsonLoader(), hedging policies have a different field
+  // set, so they get a separate entry point.
+  static std::unique_ptr<RetryMethodConfig> ParseHedgingPolicy(
+      const Json& json, const JsonArgs& args, ValidationErrors* errors);
+
   template <typename Sink>
   friend void AbslStringify(Sink& sink, const RetryMethodConfig& config) {
     sink.Append(absl::StrCat(
@@ -80,6 +97,9 @@ class RetryMethodConfig final : public ServiceConfigParser::ParsedConfig {
         config.per_attempt_recv_timeout_.has_value()
             ? absl::StrCat(*config.per_attempt_recv_timeout_)
             : "none"));
+    if (config.hedging_) {
+      sink.Append(absl::StrCat(" hedging_delay:", config.hedging_delay_));
+    }
   }
 
  private:
@@ -89,6 +109,8 @@ class RetryMethodConfig final : public ServiceConfigParser::ParsedConfig {
   float backoff_multiplier_ = 0;
   StatusCodeSet retryable_status_codes_;
   std::optional<Duration> per_attempt_recv_timeout_;
+  bool hedging_ = false;
+  Duration hedging_delay_;
 };
 
 class RetryServiceConfigParser final : public ServiceConfigParser::Parser {
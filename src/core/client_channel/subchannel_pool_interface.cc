@@ -34,9 +34,15 @@
 
 namespace grpc_core {
 
+// Interning the args lets the many keys built from identical channel args
+// share one representation, and makes Compare() between such keys hit the
+// identity fast path instead of walking the args.  This is best-effort:
+// args carrying pointer values (an injected EventEngine, credentials, the
+// subchannel pool itself) are returned unshared rather than pinned by the
+// intern table.
 SubchannelKey::SubchannelKey(const grpc_resolved_address& address,
                              const ChannelArgs& args)
-    : address_(address), args_(args) {}
+    : address_(address), args_(args.Interned()) {}
 
 int SubchannelKey::Compare(const SubchannelKey& other) const {
   if (address_.len < other.address_.len) return -1;
@@ -63,6 +63,37 @@ ABSL_FLAG(absl::optional<std::string>, grpc_poll_strategy, {},
           "Declares which polling engines to try when starting gRPC. This is a "
           "comma-separated list of engines, which are tried in priority order "
           "first -> last.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_event_engine_busy_poll_usec, {},
+          "EXPERIMENTAL. Number of microseconds the event engine poller "
+          "busy-polls with non-blocking epoll_wait calls before falling back "
+          "to a blocking wait. Trades CPU for lower wakeup latency. Set to 0 "
+          "(the default) to disable busy polling.");
+ABSL_FLAG(absl::optional<std::string>, grpc_event_engine_cpu_affinity, {},
+          "EXPERIMENTAL. A comma separated list of CPUs or CPU ranges (e.g. "
+          "\"0,2-5\") that event engine threads are pinned to at startup, for "
+          "deployments that isolate cores. Only honored on Linux; empty (the "
+          "default) leaves thread placement to the OS scheduler.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_event_engine_timer_slack_ms, {},
+          "EXPERIMENTAL. Number of milliseconds the event engine timer "
+          "manager may delay timer expiry in order to quantize wakeups. "
+          "Coarse timers such as keepalives that expire within the same slack "
+          "window are dispatched by a single wakeup. Set to 0 (the default) "
+          "to wake for each deadline exactly.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_memory_quota_incremental_reclaim_bytes,
+          {},
+          "EXPERIMENTAL. When positive and a memory quota is under moderate "
+          "memory pressure, one non-destructive (benign or idle) reclaimer is "
+          "run for every N bytes taken from the quota, rather than waiting "
+          "for exhaustion to run all reclaimers at once. Set to 0 (the "
+          "default) to reclaim only on exhaustion.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_work_serializer_spin_usec, {},
+          "EXPERIMENTAL. Number of microseconds a caller that finds a work "
+          "serializer busy spins waiting for the owner to go idle, so that "
+          "the caller can run its callback inline instead of queueing it "
+          "behind a thread hop through EventEngine. Callbacks run inline on "
+          "the caller's thread, so only enable this if no callback can "
+          "deadlock against locks held at Run() call sites. Set to 0 (the "
+          "default) to always queue.");
 ABSL_FLAG(absl::optional<bool>, grpc_abort_on_leaks, {},
           "A debugging aid to cause a call to abort() when gRPC objects are "
           "leaked past grpc_shutdown()");
@@ -95,6 +126,21 @@ ConfigVars::ConfigVars(const Overrides& overrides)
           LoadConfig(FLAGS_grpc_channelz_max_orphaned_nodes,
                      "GRPC_CHANNELZ_MAX_ORPHANED_NODES",
                      overrides.channelz_max_orphaned_nodes, 0)),
+      event_engine_busy_poll_usec_(
+          LoadConfig(FLAGS_grpc_event_engine_busy_poll_usec,
+                     "GRPC_EVENT_ENGINE_BUSY_POLL_USEC",
+                     overrides.event_engine_busy_poll_usec, 0)),
+      event_engine_timer_slack_ms_(
+          LoadConfig(FLAGS_grpc_event_engine_timer_slack_ms,
+                     "GRPC_EVENT_ENGINE_TIMER_SLACK_MS",
+                     overrides.event_engine_timer_slack_ms, 0)),
+      memory_quota_incremental_reclaim_bytes_(
+          LoadConfig(FLAGS_grpc_memory_quota_incremental_reclaim_bytes,
+                     "GRPC_MEMORY_QUOTA_INCREMENTAL_RECLAIM_BYTES",
+                     overrides.memory_quota_incremental_reclaim_bytes, 0)),
+      work_serializer_spin_usec_(LoadConfig(
+          FLAGS_grpc_work_serializer_spin_usec, "GRPC_WORK_SERIALIZER_SPIN_USEC",
+          overrides.work_serializer_spin_usec, 0)),
       enable_fork_support_(LoadConfig(
           FLAGS_grpc_enable_fork_support, "GRPC_ENABLE_FORK_SUPPORT",
           overrides.enable_fork_support, GRPC_ENABLE_FORK_SUPPORT_DEFAULT)),
@@ -115,6 +161,10 @@ ConfigVars::ConfigVars(const Overrides& overrides)
                             GPR_DEFAULT_LOG_VERBOSITY_STRING)),
       poll_strategy_(LoadConfig(FLAGS_grpc_poll_strategy, "GRPC_POLL_STRATEGY",
                                 overrides.poll_strategy, "all")),
+      event_engine_cpu_affinity_(
+          LoadConfig(FLAGS_grpc_event_engine_cpu_affinity,
+                     "GRPC_EVENT_ENGINE_CPU_AFFINITY",
+                     overrides.event_engine_cpu_affinity, "")),
       ssl_cipher_suites_(LoadConfig(
           FLAGS_grpc_ssl_cipher_suites, "GRPC_SSL_CIPHER_SUITES",
           overrides.ssl_cipher_suites,
@@ -150,6 +200,13 @@ std::string ConfigVars::ToString() const {
       absl::CEscape(Verbosity()), "\"",
       ", enable_fork_support: ", EnableForkSupport() ? "true" : "false",
       ", poll_strategy: ", "\"", absl::CEscape(PollStrategy()), "\"",
+      ", event_engine_busy_poll_usec: ", EventEngineBusyPollUsec(),
+      ", event_engine_cpu_affinity: ", "\"",
+      absl::CEscape(EventEngineCpuAffinity()), "\"",
+      ", event_engine_timer_slack_ms: ", EventEngineTimerSlackMs(),
+      ", memory_quota_incremental_reclaim_bytes: ",
+      MemoryQuotaIncrementalReclaimBytes(),
+      ", work_serializer_spin_usec: ", WorkSerializerSpinUsec(),
       ", abort_on_leaks: ", AbortOnLeaks() ? "true" : "false",
       ", system_ssl_roots_dir: ", "\"", absl::CEscape(SystemSslRootsDir()),
       "\"", ", default_ssl_roots_file_path: ", "\"",
@@ -43,6 +43,11 @@ class GPR_DLL ConfigVars {
     absl::optional<std::string> dns_resolver;
     absl::optional<std::string> verbosity;
     absl::optional<std::string> poll_strategy;
+    absl::optional<int32_t> event_engine_busy_poll_usec;
+    absl::optional<std::string> event_engine_cpu_affinity;
+    absl::optional<int32_t> event_engine_timer_slack_ms;
+    absl::optional<int32_t> memory_quota_incremental_reclaim_bytes;
+    absl::optional<int32_t> work_serializer_spin_usec;
     absl::optional<std::string> system_ssl_roots_dir;
     absl::optional<std::string> default_ssl_roots_file_path;
     absl::optional<std::string> ssl_cipher_suites;
@@ -88,6 +93,41 @@ class GPR_DLL ConfigVars {
   // comma-separated list of engines, which are tried in priority order first ->
   // last.
   absl::string_view PollStrategy() const { return poll_strategy_; }
+  // EXPERIMENTAL. Number of microseconds the event engine poller busy-polls
+  // with non-blocking epoll_wait calls before falling back to a blocking wait.
+  // Trades CPU for lower wakeup latency. Set to 0 (the default) to disable
+  // busy polling.
+  int32_t EventEngineBusyPollUsec() const {
+    return event_engine_busy_poll_usec_;
+  }
+  // EXPERIMENTAL. Number of milliseconds the event engine timer manager may
+  // delay timer expiry in order to quantize wakeups. Coarse timers such as
+  // keepalives that expire within the same slack window are dispatched by a
+  // single wakeup. Set to 0 (the default) to wake for each deadline exactly.
+  int32_t EventEngineTimerSlackMs() const {
+    return event_engine_timer_slack_ms_;
+  }
+  // EXPERIMENTAL. A comma separated list of CPUs or CPU ranges (e.g. "0,2-5")
+  // that event engine threads are pinned to at startup, for deployments that
+  // isolate cores. Only honored on Linux; empty (the default) leaves thread
+  // placement to the OS scheduler.
+  absl::string_view EventEngineCpuAffinity() const {
+    return event_engine_cpu_affinity_;
+  }
+  // When positive and a memory quota is under moderate memory pressure, one
+  // non-destructive (benign or idle) reclaimer is run for every N bytes taken
+  // from the quota, rather than waiting for exhaustion to run all reclaimers
+  // at once. Set to 0 (the default) to reclaim only on exhaustion.
+  int32_t MemoryQuotaIncrementalReclaimBytes() const {
+    return memory_quota_incremental_reclaim_bytes_;
+  }
+  // Number of microseconds a caller that finds a work serializer busy spins
+  // waiting for the owner to go idle, so that the caller can run its callback
+  // inline instead of queueing it behind a thread hop through EventEngine.
+  // Callbacks run inline on the caller's thread, so only enable this if no
+  // callback can deadlock against locks held at Run() call sites. Set to 0
+  // (the default) to always queue.
+  int32_t WorkSerializerSpinUsec() const { return work_serializer_spin_usec_; }
   // A debugging aid to cause a call to abort() when gRPC objects are leaked
   // past grpc_shutdown()
   bool AbortOnLeaks() const { return abort_on_leaks_; }
@@ -118,6 +158,10 @@ class GPR_DLL ConfigVars {
   static std::atomic<ConfigVars*> config_vars_;
   int32_t client_channel_backup_poll_interval_ms_;
   int32_t channelz_max_orphaned_nodes_;
+  int32_t event_engine_busy_poll_usec_;
+  int32_t event_engine_timer_slack_ms_;
+  int32_t memory_quota_incremental_reclaim_bytes_;
+  int32_t work_serializer_spin_usec_;
   bool enable_fork_support_;
   bool abort_on_leaks_;
   bool not_use_system_ssl_roots_;
@@ -125,6 +169,7 @@ class GPR_DLL ConfigVars {
   std::string dns_resolver_;
   std::string verbosity_;
   std::string poll_strategy_;
+  std::string event_engine_cpu_affinity_;
   std::string ssl_cipher_suites_;
   std::string experiments_;
   std::string trace_;
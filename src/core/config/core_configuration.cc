@@ -30,6 +30,7 @@ std::atomic<CoreConfiguration::RegisteredBuilder*>
         nullptr, nullptr};
 std::atomic<bool> CoreConfiguration::has_config_ever_been_produced_{false};
 void (*CoreConfiguration::default_builder_)(CoreConfiguration::Builder*);
+std::atomic<uint64_t> CoreConfiguration::generation_{1};
 
 CoreConfiguration::Builder::Builder() = default;
 
@@ -123,6 +124,7 @@ const CoreConfiguration& CoreConfiguration::BuildNewAndMaybeSet() {
 }
 
 void CoreConfiguration::Reset() {
+  generation_.fetch_add(1, std::memory_order_acq_rel);
   delete config_.exchange(nullptr, std::memory_order_acquire);
   RegisteredBuilder* builder =
       builders_[static_cast<size_t>(BuilderScope::kEphemeral)].exchange(
@@ -190,6 +190,15 @@ class GRPC_DLL CoreConfiguration {
     return BuildNewAndMaybeSet();
   }
 
+  // Force the one-time configuration build to happen now rather than on
+  // first use. The configuration is otherwise built lazily the first time
+  // something looks up a resolver, LB policy, filter, etc., so processes
+  // that never touch it (e.g. short-lived CLI invocations) never pay for
+  // it. Latency-sensitive servers that would rather pay the cost at
+  // startup than on their first channel or server creation can call this
+  // once all builders have been registered.
+  static void Prewarm() { Get(); }
+
   // Attach a registration function globally.
   // Each registration function is called *in addition to*
   // BuildCoreConfiguration for the default core configuration.
@@ -207,6 +216,13 @@ class GRPC_DLL CoreConfiguration {
     RegisterBuilder(BuilderScope::kEphemeral, std::move(builder), whence);
   }
 
+  // A counter identifying the current configuration epoch; incremented
+  // whenever the configuration is reset.  Caches of state derived from
+  // the configuration can use this to invalidate stale entries.
+  static uint64_t Generation() {
+    return generation_.load(std::memory_order_acquire);
+  }
+
   // Drop the core configuration. Users must ensure no other threads are
   // accessing the configuration.
   // Clears any dynamically registered ephemeral builders.
@@ -297,6 +313,8 @@ class GRPC_DLL CoreConfiguration {
       builders_[static_cast<size_t>(BuilderScope::kCount)];
   // Default builder
   static void (*default_builder_)(CoreConfiguration::Builder*);
+  // Incremented on each Reset(); see Generation().
+  static std::atomic<uint64_t> generation_;
 
   ChannelArgsPreconditioning channel_args_preconditioning_;
   ChannelInit channel_init_;
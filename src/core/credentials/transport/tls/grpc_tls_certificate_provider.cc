@@ -284,20 +284,71 @@ absl::Status FileWatcherCertificateProvider::ValidateCredentials() const {
   return absl::OkStatus();
 }
 
+namespace {
+
+// This helper function gets the last-modified time of |filename|. When failed,
+// it logs the error and returns 0.
+time_t GetModificationTime(const char* filename) {
+  time_t ts = 0;
+  (void)GetFileModificationTime(filename, &ts);
+  return ts;
+}
+
+// Modification times have one-second granularity, so a file rewritten within
+// the same second as the previous read would carry an unchanged mtime. An
+// mtime within this many seconds of the current time is therefore not
+// trusted for caching and the file is re-read until the mtime ages out of
+// the race window.
+constexpr time_t kMtimeRaceWindowSeconds = 2;
+
+}  // namespace
+
 void FileWatcherCertificateProvider::ForceUpdate() {
   std::optional<std::string> root_certificate;
   std::optional<PemKeyCertPairList> pem_key_cert_pairs;
+  // Skip re-reading files whose modification times are unchanged since the
+  // last successful read: with short refresh intervals the common case by
+  // far is that nothing changed, and re-reading would generate allocation
+  // and I/O churn only for the content comparison below to come out equal.
+  // The rest of this provider already treats mtime equality as the change
+  // signal (see the retry loop in ReadIdentityKeyCertPairFromFiles), so no
+  // granularity is lost here.
+  bool root_unchanged = false;
+  bool identity_unchanged = false;
+  const time_t now = time(nullptr);
   if (!root_cert_path_.empty()) {
-    root_certificate = ReadRootCertificatesFromFile(root_cert_path_);
+    const time_t root_ts = GetModificationTime(root_cert_path_.c_str());
+    if (root_ts != 0 && root_ts == root_cert_mtime_ &&
+        root_ts + kMtimeRaceWindowSeconds <= now) {
+      root_unchanged = true;
+    } else {
+      root_certificate = ReadRootCertificatesFromFile(root_cert_path_);
+      root_cert_mtime_ = root_certificate.has_value() ? root_ts : 0;
+    }
   }
   if (!private_key_path_.empty()) {
-    pem_key_cert_pairs = ReadIdentityKeyCertPairFromFiles(
-        private_key_path_, identity_certificate_path_);
+    const time_t key_ts = GetModificationTime(private_key_path_.c_str());
+    const time_t cert_ts =
+        GetModificationTime(identity_certificate_path_.c_str());
+    if (key_ts != 0 && cert_ts != 0 && key_ts == private_key_mtime_ &&
+        cert_ts == identity_cert_mtime_ &&
+        key_ts + kMtimeRaceWindowSeconds <= now &&
+        cert_ts + kMtimeRaceWindowSeconds <= now) {
+      identity_unchanged = true;
+    } else {
+      pem_key_cert_pairs = ReadIdentityKeyCertPairFromFiles(
+          private_key_path_, identity_certificate_path_);
+      const bool read_ok = pem_key_cert_pairs.has_value();
+      private_key_mtime_ = read_ok ? key_ts : 0;
+      identity_cert_mtime_ = read_ok ? cert_ts : 0;
+    }
   }
   MutexLock lock(&mu_);
   const bool root_cert_changed =
-      (!root_certificate.has_value() && !root_certificate_.empty()) ||
-      (root_certificate.has_value() && root_certificate_ != *root_certificate);
+      !root_unchanged &&
+      ((!root_certificate.has_value() && !root_certificate_.empty()) ||
+       (root_certificate.has_value() &&
+        root_certificate_ != *root_certificate));
   if (root_cert_changed) {
     if (root_certificate.has_value()) {
       root_certificate_ = std::move(*root_certificate);
@@ -306,9 +357,10 @@ void FileWatcherCertificateProvider::ForceUpdate() {
     }
   }
   const bool identity_cert_changed =
-      (!pem_key_cert_pairs.has_value() && !pem_key_cert_pairs_.empty()) ||
-      (pem_key_cert_pairs.has_value() &&
-       pem_key_cert_pairs_ != *pem_key_cert_pairs);
+      !identity_unchanged &&
+      ((!pem_key_cert_pairs.has_value() && !pem_key_cert_pairs_.empty()) ||
+       (pem_key_cert_pairs.has_value() &&
+        pem_key_cert_pairs_ != *pem_key_cert_pairs));
   if (identity_cert_changed) {
     if (pem_key_cert_pairs.has_value()) {
       pem_key_cert_pairs_ = std::move(*pem_key_cert_pairs);
@@ -368,18 +420,6 @@ FileWatcherCertificateProvider::ReadRootCertificatesFromFile(
   return std::string(root_slice->as_string_view());
 }
 
-namespace {
-
-// This helper function gets the last-modified time of |filename|. When failed,
-// it logs the error and returns 0.
-time_t GetModificationTime(const char* filename) {
-  time_t ts = 0;
-  (void)GetFileModificationTime(filename, &ts);
-  return ts;
-}
-
-}  // namespace
-
 std::optional<PemKeyCertPairList>
 FileWatcherCertificateProvider::ReadIdentityKeyCertPairFromFiles(
     const std::string& private_key_path,
@@ -21,6 +21,7 @@
 #include <grpc/support/port_platform.h>
 #include <grpc/support/sync.h>
 #include <stdint.h>
+#include <time.h>
 
 #include <map>
 #include <optional>
@@ -179,6 +180,13 @@ class FileWatcherCertificateProvider final
   std::string identity_certificate_path_;
   std::string root_cert_path_;
   int64_t refresh_interval_sec_ = 0;
+  // Modification times observed when the files were last successfully read,
+  // or 0 if the last read attempt failed. Used to skip re-reading unchanged
+  // files on each refresh tick. Only touched by the refreshing thread (and
+  // the constructor's initial update), so not guarded by mu_.
+  time_t root_cert_mtime_ = 0;
+  time_t private_key_mtime_ = 0;
+  time_t identity_cert_mtime_ = 0;
 
   RefCountedPtr<grpc_tls_certificate_distributor> distributor_;
   Thread refresh_thread_;
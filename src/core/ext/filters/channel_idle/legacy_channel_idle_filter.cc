@@ -24,7 +24,6 @@
 #include <optional>
 #include <utility>
 
-#include "absl/base/thread_annotations.h"
 #include "absl/meta/type_traits.h"
 #include "absl/random/random.h"
 #include "absl/status/statusor.h"
@@ -52,7 +51,6 @@
 #include "src/core/util/per_cpu.h"
 #include "src/core/util/shared_bit_gen.h"
 #include "src/core/util/status_helper.h"
-#include "src/core/util/sync.h"
 
 namespace grpc_core {
 
@@ -100,14 +98,6 @@ struct LegacyMaxAgeFilter::Config {
             .value_or(kDefaultMaxConnectionAgeGrace);
     // generate a random number between 1 - kMaxConnectionAgeJitter and
     // 1 + kMaxConnectionAgeJitter
-    struct BitGen {
-      Mutex mu;
-      absl::BitGen bit_gen ABSL_GUARDED_BY(mu);
-      double MakeUniformDouble(double min, double max) {
-        MutexLock lock(&mu);
-        return absl::Uniform(bit_gen, min, max);
-      }
-    };
     const double multiplier = []() {
       SharedBitGen g;
       return absl::Uniform(g, 1.0 - kMaxConnectionAgeJitter,
@@ -30,6 +30,7 @@
 
 #include "absl/log/log.h"
 #include "absl/meta/type_traits.h"
+#include "absl/random/random.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/numbers.h"
@@ -46,6 +47,7 @@
 #include "src/core/lib/promise/try_seq.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/service_config/service_config_call_data.h"
+#include "src/core/util/shared_bit_gen.h"
 #include "src/core/util/time.h"
 
 namespace grpc_core {
@@ -64,7 +66,7 @@ auto AsInt(absl::string_view s) -> std::optional<T> {
   return std::nullopt;
 }
 
-inline bool UnderFraction(absl::InsecureBitGen* rand_generator,
+inline bool UnderFraction(SharedBitGen* rand_generator,
                           const uint32_t numerator,
                           const uint32_t denominator) {
   if (numerator <= 0) return false;
@@ -218,15 +220,15 @@ FaultInjectionFilter::MakeInjectionDecision(
   bool delay_request = delay != Duration::Zero();
   bool abort_request = abort_code != GRPC_STATUS_OK;
   if (delay_request || abort_request) {
-    MutexLock lock(&mu_);
+    SharedBitGen bit_gen;
     if (delay_request) {
       delay_request =
-          UnderFraction(&delay_rand_generator_, delay_percentage_numerator,
+          UnderFraction(&bit_gen, delay_percentage_numerator,
                         fi_policy->delay_percentage_denominator);
     }
     if (abort_request) {
       abort_request =
-          UnderFraction(&abort_rand_generator_, abort_percentage_numerator,
+          UnderFraction(&bit_gen, abort_percentage_numerator,
                         fi_policy->abort_percentage_denominator);
     }
   }
@@ -98,6 +98,16 @@ ChannelCompression::ChannelCompression(const ChannelArgs& args)
                << " not enabled: switching to none";
     default_compression_algorithm_ = GRPC_COMPRESS_NONE;
   }
+  const int offload_threshold =
+      args.GetInt(GRPC_ARG_EXPERIMENTAL_COMPRESSION_OFFLOAD_THRESHOLD)
+          .value_or(0);
+  if (offload_threshold > 0) {
+    event_engine_ =
+        args.GetObjectRef<grpc_event_engine::experimental::EventEngine>();
+    if (event_engine_ != nullptr) {
+      compression_offload_threshold_ = static_cast<size_t>(offload_threshold);
+    }
+  }
 }
 
 MessageHandle ChannelCompression::CompressMessage(
@@ -117,9 +127,17 @@ MessageHandle ChannelCompression::CompressMessage(
       (flags & (GRPC_WRITE_NO_COMPRESS | GRPC_WRITE_INTERNAL_COMPRESS))) {
     return message;
   }
+  if (CompressPayload(*message, algorithm) && call_tracer != nullptr) {
+    call_tracer->RecordSendCompressedMessage(*message);
+  }
+  return message;
+}
+
+bool ChannelCompression::CompressPayload(Message& message,
+                                         grpc_compression_algorithm algorithm) {
   // Try to compress the payload.
   SliceBuffer tmp;
-  SliceBuffer* payload = message->payload();
+  SliceBuffer* payload = message.payload();
   bool did_compress = grpc_msg_compress(algorithm, payload->c_slice_buffer(),
                                         tmp.c_slice_buffer());
   // If we achieved compression send it as compressed, otherwise send it as (to
@@ -138,10 +156,7 @@ MessageHandle ChannelCompression::CompressMessage(
           algo_name, before_size, after_size, 100 * savings_ratio);
     }
     tmp.Swap(payload);
-    flags |= GRPC_WRITE_INTERNAL_COMPRESS;
-    if (call_tracer != nullptr) {
-      call_tracer->RecordSendCompressedMessage(*message);
-    }
+    message.mutable_flags() |= GRPC_WRITE_INTERNAL_COMPRESS;
   } else {
     if (GRPC_TRACE_FLAG_ENABLED(compression)) {
       const char* algo_name;
@@ -151,7 +166,72 @@ MessageHandle ChannelCompression::CompressMessage(
                 << payload->Length();
     }
   }
-  return message;
+  return did_compress;
+}
+
+ChannelCompression::CompressMessagePromise::CompressMessagePromise(
+    const ChannelCompression* engine, MessageHandle message,
+    grpc_compression_algorithm algorithm, CallTracerInterface* call_tracer)
+    : call_tracer_(call_tracer) {
+  const size_t threshold = engine->compression_offload_threshold_;
+  if (threshold == 0 || algorithm == GRPC_COMPRESS_NONE ||
+      !engine->enable_compression_ ||
+      (message->flags() &
+       (GRPC_WRITE_NO_COMPRESS | GRPC_WRITE_INTERNAL_COMPRESS)) != 0 ||
+      message->payload()->Length() < threshold) {
+    inline_result_ =
+        engine->CompressMessage(std::move(message), algorithm, call_tracer);
+    return;
+  }
+  GRPC_TRACE_LOG(compression, INFO)
+      << "CompressMessage (offloaded): len=" << message->payload()->Length()
+      << " alg=" << algorithm << " flags=" << message->flags();
+  // Record the send now: tracers are called from the call's party, never from
+  // the thread pool. The compressed size is recorded when the result is
+  // polled back on the party.
+  if (call_tracer != nullptr) {
+    call_tracer->RecordSendMessage(*message);
+  }
+  state_ = MakeRefCounted<OffloadState>(GetContext<Arena>()->Ref());
+  engine->event_engine_->Run(
+      [state = state_, message = std::move(message), algorithm]() mutable {
+        CompressPayload(*message, algorithm);
+        state->Finish(std::move(message));
+      });
+}
+
+Poll<absl::StatusOr<MessageHandle>>
+ChannelCompression::CompressMessagePromise::operator()() {
+  if (inline_result_.has_value()) {
+    return absl::StatusOr<MessageHandle>(std::move(*inline_result_));
+  }
+  auto result = state_->PollResult();
+  if (auto* message = result.value_if_ready()) {
+    if (call_tracer_ != nullptr &&
+        ((*message)->flags() & GRPC_WRITE_INTERNAL_COMPRESS) != 0) {
+      call_tracer_->RecordSendCompressedMessage(**message);
+    }
+    return absl::StatusOr<MessageHandle>(std::move(*message));
+  }
+  return Pending{};
+}
+
+void ChannelCompression::CompressMessagePromise::OffloadState::Finish(
+    MessageHandle message) {
+  ReleasableMutexLock lock(&mu_);
+  result_.emplace(std::move(message));
+  auto waker = std::move(waker_);
+  lock.Release();
+  // Wake outside the lock: waking may run the party inline.
+  waker.Wakeup();
+}
+
+Poll<MessageHandle>
+ChannelCompression::CompressMessagePromise::OffloadState::PollResult() {
+  MutexLock lock(&mu_);
+  if (result_.has_value()) return std::move(*result_);
+  waker_ = GetContext<Activity>()->MakeOwningWaker();
+  return Pending{};
 }
 
 absl::StatusOr<MessageHandle> ChannelCompression::DecompressMessage(
@@ -236,12 +316,14 @@ void ClientCompressionFilter::Call::OnClientInitialMetadata(
   call_tracer_ = MaybeGetContext<CallTracerInterface>();
 }
 
-MessageHandle ClientCompressionFilter::Call::OnClientToServerMessage(
+ChannelCompression::CompressMessagePromise
+ClientCompressionFilter::Call::OnClientToServerMessage(
     MessageHandle message, ClientCompressionFilter* filter) {
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ClientCompressionFilter::Call::OnClientToServerMessage");
-  return filter->compression_engine_.CompressMessage(
-      std::move(message), compression_algorithm_, call_tracer_);
+  return ChannelCompression::CompressMessagePromise(
+      &filter->compression_engine_, std::move(message), compression_algorithm_,
+      call_tracer_);
 }
 
 void ClientCompressionFilter::Call::OnServerInitialMetadata(
@@ -285,12 +367,13 @@ void ServerCompressionFilter::Call::OnServerInitialMetadata(
       filter->compression_engine_.HandleOutgoingMetadata(md);
 }
 
-MessageHandle ServerCompressionFilter::Call::OnServerToClientMessage(
+ChannelCompression::CompressMessagePromise
+ServerCompressionFilter::Call::OnServerToClientMessage(
     MessageHandle message, ServerCompressionFilter* filter) {
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ServerCompressionFilter::Call::OnServerToClientMessage");
-  return filter->compression_engine_.CompressMessage(
-      std::move(message), compression_algorithm_,
+  return ChannelCompression::CompressMessagePromise(
+      &filter->compression_engine_, std::move(message), compression_algorithm_,
       MaybeGetContext<CallTracerInterface>());
 }
 
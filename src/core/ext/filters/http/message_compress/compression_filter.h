@@ -19,14 +19,17 @@
 #ifndef GRPC_SRC_CORE_EXT_FILTERS_HTTP_MESSAGE_COMPRESS_COMPRESSION_FILTER_H
 #define GRPC_SRC_CORE_EXT_FILTERS_HTTP_MESSAGE_COMPRESS_COMPRESSION_FILTER_H
 
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/impl/compression_types.h>
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
 #include <stdint.h>
 
 #include <cstddef>
+#include <memory>
 #include <optional>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 #include "src/core/call/metadata_batch.h"
@@ -35,8 +38,20 @@
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/arena_promise.h"
+#include "src/core/lib/promise/poll.h"
+#include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+
+// Payload size (in bytes) at or above which outbound message compression runs
+// on the EventEngine thread pool instead of inline on the call party. 0 (the
+// default) keeps all compression inline.
+#define GRPC_ARG_EXPERIMENTAL_COMPRESSION_OFFLOAD_THRESHOLD \
+  "grpc.experimental.compression_offload_threshold"
 
 namespace grpc_core {
 
@@ -93,6 +108,52 @@ class ChannelCompression {
       bool is_client, MessageHandle message, DecompressArgs args,
       CallTracerInterface* call_tracer) const;
 
+  // Promise form of CompressMessage: payloads of at least
+  // GRPC_ARG_EXPERIMENTAL_COMPRESSION_OFFLOAD_THRESHOLD bytes are compressed
+  // on the EventEngine thread pool so that a large message does not occupy the
+  // call party while it compresses, and later messages pipeline behind it -
+  // the surrounding message queue keeps delivery ordered by waiting for this
+  // promise to resolve. Ineligible or small payloads (and all payloads when
+  // offload is disabled, the default) compress inline and resolve on the
+  // first poll.
+  class CompressMessagePromise {
+   public:
+    CompressMessagePromise(const ChannelCompression* engine,
+                           MessageHandle message,
+                           grpc_compression_algorithm algorithm,
+                           CallTracerInterface* call_tracer);
+
+    Poll<absl::StatusOr<MessageHandle>> operator()();
+
+   private:
+    // Shared between the call party and the EventEngine closure. Whichever
+    // side drops its ref last may destroy the parked message, so keep the
+    // call's arena alive until then.
+    class OffloadState : public RefCounted<OffloadState> {
+     public:
+      explicit OffloadState(RefCountedPtr<Arena> arena)
+          : arena_(std::move(arena)) {}
+
+      // Parks the compressed message and wakes the party. Runs on an
+      // EventEngine thread.
+      void Finish(MessageHandle message);
+      Poll<MessageHandle> PollResult();
+
+     private:
+      // Declared first so the parked message is destroyed before the arena
+      // ref is released.
+      RefCountedPtr<Arena> arena_;
+      Mutex mu_;
+      Waker waker_ ABSL_GUARDED_BY(mu_);
+      std::optional<MessageHandle> result_ ABSL_GUARDED_BY(mu_);
+    };
+
+    CallTracerInterface* call_tracer_;
+    // Set when compression ran inline in the constructor.
+    std::optional<MessageHandle> inline_result_;
+    RefCountedPtr<OffloadState> state_;
+  };
+
   channelz::PropertyList ChannelzProperties() const {
     return channelz::PropertyList()
         .Set("max_recv_size", max_recv_size_)
@@ -101,10 +162,17 @@ class ChannelCompression {
         .Set("enabled_compression_algorithms",
              enabled_compression_algorithms_.ToString())
         .Set("enable_compression", enable_compression_)
-        .Set("enable_decompression", enable_decompression_);
+        .Set("enable_decompression", enable_decompression_)
+        .Set("compression_offload_threshold", compression_offload_threshold_);
   }
 
  private:
+  // Compresses `message`'s payload in place with `algorithm`, setting
+  // GRPC_WRITE_INTERNAL_COMPRESS if compression shrank the payload. Uses no
+  // channel state, so it may run on the call party or an EventEngine thread.
+  static bool CompressPayload(Message& message,
+                              grpc_compression_algorithm algorithm);
+
   // Max receive message length, if set.
   std::optional<uint32_t> max_recv_size_;
   size_t message_size_service_config_parser_index_;
@@ -116,6 +184,11 @@ class ChannelCompression {
   bool enable_compression_;
   // Is decompression enabled?
   bool enable_decompression_;
+  // Payload size at or above which compression is offloaded to the
+  // EventEngine thread pool; 0 disables offload.
+  size_t compression_offload_threshold_ = 0;
+  // Only set when offload is enabled.
+  std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine_;
 };
 
 class ClientCompressionFilter final
@@ -146,8 +219,8 @@ class ClientCompressionFilter final
    public:
     void OnClientInitialMetadata(ClientMetadata& md,
                                  ClientCompressionFilter* filter);
-    MessageHandle OnClientToServerMessage(MessageHandle message,
-                                          ClientCompressionFilter* filter);
+    ChannelCompression::CompressMessagePromise OnClientToServerMessage(
+        MessageHandle message, ClientCompressionFilter* filter);
 
     void OnServerInitialMetadata(ServerMetadata& md,
                                  ClientCompressionFilter* filter);
@@ -203,8 +276,8 @@ class ServerCompressionFilter final
 
     void OnServerInitialMetadata(ServerMetadata& md,
                                  ServerCompressionFilter* filter);
-    MessageHandle OnServerToClientMessage(MessageHandle message,
-                                          ServerCompressionFilter* filter);
+    ChannelCompression::CompressMessagePromise OnServerToClientMessage(
+        MessageHandle message, ServerCompressionFilter* filter);
 
     static inline const NoInterceptor OnClientToServerHalfClose;
     static inline const NoInterceptor OnServerTrailingMetadata;
@@ -0,0 +1,84 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CHUNK_SIZE_TUNER_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CHUNK_SIZE_TUNER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/useful.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+
+// Shared estimate of the ideal chunk size for message payloads sent over the
+// data endpoints.
+// The measurement side (the TCP data endpoints) feeds in kernel delivery
+// metrics and scheduler contention; the producer side (MessageChunker) asks
+// for a target chunk size when it splits a payload.
+// The estimate is purely advisory, so updates use relaxed atomics and races
+// between concurrent writers are benign.
+class ChunkSizeTuner
+    : public RefCounted<ChunkSizeTuner, NonPolymorphicRefCount> {
+ public:
+  // Record a delivery rate & round trip time measurement from one data
+  // endpoint.
+  void MeasureNetwork(uint64_t rtt_usec, double bytes_per_nanosecond) {
+    const uint64_t bdp =
+        static_cast<uint64_t>(bytes_per_nanosecond * rtt_usec * 1000.0);
+    if (bdp == 0) return;
+    // EWMA so one endpoint's outlier measurement doesn't whipsaw the target.
+    const uint64_t prev = bdp_bytes_.load(std::memory_order_relaxed);
+    bdp_bytes_.store(prev == 0 ? bdp : (3 * prev + bdp) / 4,
+                     std::memory_order_relaxed);
+  }
+
+  // Record how many streams were contending for the data endpoints at the
+  // last scheduling pass.
+  void MeasureContention(size_t queued_streams) {
+    contending_streams_.store(std::max<size_t>(1, queued_streams),
+                              std::memory_order_relaxed);
+  }
+
+  // Target chunk size: one bandwidth-delay product of pipeline split between
+  // the contending streams - large chunks while a lone stream saturates the
+  // link, small chunks when latency sensitive peers are queued behind it.
+  // Rounded down to alignment and clamped to [kMinChunkSize, max_chunk_size].
+  // Returns max_chunk_size until a measurement arrives.
+  uint32_t ChunkSize(uint32_t max_chunk_size, uint32_t alignment) const {
+    const uint64_t bdp = bdp_bytes_.load(std::memory_order_relaxed);
+    if (bdp == 0 || max_chunk_size <= kMinChunkSize) return max_chunk_size;
+    uint64_t target = bdp / contending_streams_.load(std::memory_order_relaxed);
+    if (alignment != 0) target -= target % alignment;
+    return static_cast<uint32_t>(
+        Clamp<uint64_t>(target, kMinChunkSize, max_chunk_size));
+  }
+
+ private:
+  // Chunks below this size spend more on framing overhead than they gain in
+  // scheduling granularity.
+  static constexpr uint64_t kMinChunkSize = 16 * 1024;
+
+  std::atomic<uint64_t> bdp_bytes_{0};
+  std::atomic<size_t> contending_streams_{1};
+};
+
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CHUNK_SIZE_TUNER_H
@@ -251,6 +251,10 @@ void ChaoticGoodConnector::Connect(const Args& args, Result* result,
                   MakeRefCounted<TransportContext>(
                       result_notifier_ptr->args.channel_args,
                       std::move(socket_node)));
+              // Let the transport establish further data connections if the
+              // server announces them post-handshake.
+              frame_transport->SetClientConnectionFactory(
+                  std::move(connector));
               auto transport = MakeOrphanable<ChaoticGoodClientTransport>(
                   result_notifier_ptr->args.channel_args,
                   std::move(frame_transport),
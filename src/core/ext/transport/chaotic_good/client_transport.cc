@@ -230,6 +230,7 @@ ChaoticGoodClientTransport::ChaoticGoodClientTransport(
       message_chunker_(message_chunker),
       frame_transport_(std::move(frame_transport)) {
   CHECK(ctx_ != nullptr);
+  message_chunker_.SetChunkSizeTuner(ctx_->chunk_size_tuner);
   auto party_arena = SimpleArenaAllocator(0)->MakeArena();
   party_arena->SetContext<grpc_event_engine::experimental::EventEngine>(
       ctx_->event_engine.get());
@@ -37,6 +37,8 @@ namespace chaotic_good {
   "grpc.chaotic_good.inlined_payload_size_threshold"
 #define GRPC_ARG_CHAOTIC_GOOD_SCHEDULER_CONFIG \
   "grpc.chaotic_good.scheduler_config"
+#define GRPC_ARG_CHAOTIC_GOOD_STREAM_SCHEDULING_QUANTUM \
+  "grpc.chaotic_good.stream_scheduling_quantum"
 
 // Transport configuration.
 // Most of our configuration is derived from channel args, and then exchanged
@@ -61,6 +63,9 @@ class Config {
     scheduler_config_ =
         channel_args.GetString(GRPC_ARG_CHAOTIC_GOOD_SCHEDULER_CONFIG)
             .value_or("spanrr");
+    stream_scheduling_quantum_ = std::max(
+        1, channel_args.GetInt(GRPC_ARG_CHAOTIC_GOOD_STREAM_SCHEDULING_QUANTUM)
+               .value_or(stream_scheduling_quantum_));
     if (max_recv_chunk_size_ == 0 || max_send_chunk_size_ == 0) {
       max_recv_chunk_size_ = 0;
       max_send_chunk_size_ = 0;
@@ -154,6 +159,7 @@ class Config {
     options.decode_alignment = decode_alignment_;
     options.inlined_payload_size_threshold = inline_payload_size_threshold_;
     options.scheduler_config = scheduler_config_;
+    options.stream_scheduling_quantum = stream_scheduling_quantum_;
     return options;
   }
 
@@ -224,6 +230,7 @@ class Config {
   uint32_t max_send_chunk_size_ = 1024 * 1024;
   uint32_t max_recv_chunk_size_ = 1024 * 1024;
   uint32_t inline_payload_size_threshold_ = 8 * 1024;
+  uint32_t stream_scheduling_quantum_ = 64 * 1024;
   std::string scheduler_config_;
   std::vector<PendingConnection> pending_data_endpoints_;
   absl::flat_hash_set<chaotic_good_frame::Settings::Features>
@@ -18,12 +18,34 @@
 #include "src/core/lib/event_engine/extensions/channelz.h"
 #include "src/core/lib/event_engine/query_extensions.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/promise/if.h"
 #include "src/core/lib/promise/loop.h"
+#include "src/core/lib/promise/map.h"
+#include "src/core/lib/promise/promise.h"
+#include "src/core/lib/promise/race.h"
+#include "src/core/lib/promise/sleep.h"
 #include "src/core/lib/promise/try_seq.h"
+#include "src/core/util/time.h"
 
 namespace grpc_core {
 namespace chaotic_good {
 
+namespace {
+// Control frames are tiny, and once the flush loop catches up with its
+// producers every frame costs its own endpoint write. When flushes are
+// arriving back to back we instead hold a freshly queued frame for a short
+// bounded window so its successors pack into the same write.
+// Longest we'll hold a queued frame waiting for more to pack (timer
+// resolution bounds this to whole milliseconds).
+constexpr Duration kMaxCoalesceDelay = Duration::Milliseconds(1);
+// Stop waiting early once this much is queued.
+constexpr size_t kEagerFlushBytes = 3 * 1024;
+// Only hold frames if the previous flush started at most this long ago: an
+// idle control channel keeps flushing immediately, so isolated writes (e.g.
+// pings) pay no added latency.
+constexpr Duration kHotFlushWindow = Duration::Milliseconds(1);
+}  // namespace
+
 auto ControlEndpoint::Buffer::Pull() {
   return [this]() -> Poll<SliceBuffer> {
     Waker waker;
@@ -60,16 +82,36 @@ ControlEndpoint::ControlEndpoint(
   write_party_->Spawn(
       "flush-control",
       GRPC_LATENT_SEE_PROMISE(
-          "FlushLoop", Loop([ztrace_collector = ztrace_collector_,
-                             endpoint = endpoint_, buffer = buffer_]() {
+          "FlushLoop",
+          Loop([ztrace_collector = ztrace_collector_, endpoint = endpoint_,
+                buffer = buffer_, last_flush = std::make_shared<Timestamp>(
+                                      Timestamp::InfPast())]() {
             return AddErrorPrefix(
                 "CONTROL_CHANNEL: ",
                 TrySeq(
-                    // Pull one set of buffered writes
-                    buffer->Pull(),
+                    // Wait for some buffered writes
+                    buffer->WaitForData(1),
+                    // If flushes are coming back to back, hold briefly so
+                    // that more frames pack into this endpoint write.
+                    [buffer, last_flush]() {
+                      const bool hot =
+                          Timestamp::Now() - *last_flush <= kHotFlushWindow;
+                      return If(
+                          hot,
+                          [&buffer]() {
+                            return Race(
+                                Map(buffer->WaitForData(kEagerFlushBytes),
+                                    [](Empty) { return absl::OkStatus(); }),
+                                Sleep(kMaxCoalesceDelay));
+                          },
+                          []() { return Immediate(absl::OkStatus()); });
+                    },
+                    // Pull the packed writes
+                    [buffer]() { return buffer->Pull(); },
                     // And write them
-                    [endpoint, ztrace_collector,
-                     buffer = buffer.get()](SliceBuffer flushing) {
+                    [endpoint, ztrace_collector, buffer = buffer.get(),
+                     last_flush](SliceBuffer flushing) {
+                      *last_flush = Timestamp::Now();
                       GRPC_TRACE_LOG(chaotic_good, INFO)
                           << "CHAOTIC_GOOD: Flush " << flushing.Length()
                           << " bytes from " << buffer << " to "
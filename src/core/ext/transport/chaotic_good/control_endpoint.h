@@ -76,6 +76,17 @@ class ControlEndpoint {
       queued_output_.Append(buffer);
     }
 
+    // Returns a promise that resolves to Empty{} once at least `bytes` bytes
+    // are queued.
+    auto WaitForData(size_t bytes) {
+      return [this, bytes]() -> Poll<Empty> {
+        MutexLock lock(&mu_);
+        if (queued_output_.Length() >= bytes) return Empty{};
+        flush_waker_ = GetContext<Activity>()->MakeNonOwningWaker();
+        return Pending{};
+      };
+    }
+
     auto Pull();
 
    private:
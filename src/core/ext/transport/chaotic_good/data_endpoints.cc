@@ -15,6 +15,12 @@
 #include "src/core/ext/transport/chaotic_good/data_endpoints.h"
 
 #include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#ifdef GPR_LINUX
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #include <atomic>
 #include <cstddef>
@@ -31,6 +37,7 @@
 #include "absl/strings/str_split.h"
 #include "absl/time/time.h"
 #include "src/core/channelz/property_list.h"
+#include "src/core/ext/transport/chaotic_good/chunk_size_tuner.h"
 #include "src/core/ext/transport/chaotic_good/tcp_frame_header.h"
 #include "src/core/ext/transport/chaotic_good/tcp_ztrace_collector.h"
 #include "src/core/ext/transport/chaotic_good/transport_context.h"
@@ -57,8 +64,29 @@ namespace data_endpoints_detail {
 
 namespace {
 const uint64_t kSecurityFramePayloadTag = 0;
+
+// Start time penalty applied to endpoints whose write loop last ran on a
+// different NUMA node than the scheduler: small enough that genuine rate
+// differences between channels still dominate, large enough to break ties
+// toward node-local payload assembly.
+constexpr double kRemoteNumaPenaltySeconds = 25e-6;
+
+// Best-effort NUMA node of the calling thread, or -1 where unavailable.
+// getcpu is vDSO-backed on Linux, so this is cheap enough for the
+// scheduling path.
+int CurrentNumaNode() {
+#ifdef GPR_LINUX
+  unsigned cpu = 0;
+  unsigned node = 0;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+    return static_cast<int>(node);
+  }
+#endif
+  return -1;
 }
 
+}  // namespace
+
 ///////////////////////////////////////////////////////////////////////////////
 // SendRate
 
@@ -172,6 +200,9 @@ OutputBuffers::Reader::PollReadNext() {
     auto frames = std::move(frames_);
     frames_.clear();
     mu_.Unlock();
+    // We're on the endpoint's write loop here - remember its locality so the
+    // scheduler can prefer node-local endpoints.
+    numa_node_.store(CurrentNumaNode(), std::memory_order_relaxed);
     return std::move(frames);
   }
 }
@@ -182,6 +213,11 @@ void OutputBuffers::Reader::SetNetworkMetrics(
   mu_.Lock();
   send_rate_.SetNetworkMetrics(network_send, metrics);
   mu_.Unlock();
+  if (metrics.rtt_usec.has_value() &&
+      metrics.bytes_per_nanosecond.has_value()) {
+    output_buffers_->ctx_->chunk_size_tuner->MeasureNetwork(
+        *metrics.rtt_usec, *metrics.bytes_per_nanosecond);
+  }
   output_buffers_->WakeupScheduler();
 }
 
@@ -189,6 +225,7 @@ channelz::PropertyList OutputBuffers::Reader::ChannelzProperties() {
   MutexLock lock(&mu_);
   return channelz::PropertyList()
       .Set("reading", reading_)
+      .Set("numa_node", numa_node())
       .Merge(send_rate_.ChannelzProperties())
       .Set("queued_frames", [this]() -> std::optional<channelz::PropertyTable> {
         mu_.AssertHeld();
@@ -215,7 +252,12 @@ void OutputBuffers::AddData(channelz::DataSink sink) {
           .Set("encode_alignment", encode_alignment_)
           .Set("scheduling_state",
                scheduling_state_.load(std::memory_order_relaxed))
-          .Set("scheduler", scheduler_->Config()));
+          .Set("scheduler", scheduler_->Config())
+          .Set("stream_scheduling_quantum", stream_quantum_bytes_)
+          .Set("queued_streams",
+               queued_streams_.load(std::memory_order_relaxed))
+          .Set("stream_deferrals",
+               stream_deferrals_.load(std::memory_order_relaxed)));
   scheduling_party_->ExportToChannelz("scheduling_party", sink);
 }
 
@@ -307,8 +349,23 @@ Poll<Empty> OutputBuffers::SchedulerPollForWork() {
 
 void OutputBuffers::Schedule() {
   GRPC_LATENT_SEE_INNER_SCOPE("OutputBuffers::Schedule");
-  auto* first_message = frames_queue_.Peek();
-  if (first_message == nullptr) return;
+  // Drain newly written frames into per-stream queues: placement below is
+  // deficit-round-robin across streams, so one stream with a deep backlog of
+  // chunks cannot monopolize the data endpoints. Per-stream frame order is
+  // preserved.
+  while (auto* queued = frames_queue_.Peek()) {
+    const uint32_t stream_id = StreamIdForFrame(*queued);
+    auto [it, inserted] = stream_queues_.try_emplace(stream_id);
+    if (inserted) active_streams_.push_back(stream_id);
+    it->second.frames.emplace_back(std::move(*queued));
+    frames_queue_.Pop();
+  }
+  if (active_streams_.empty()) {
+    queued_streams_.store(0, std::memory_order_relaxed);
+    return;
+  }
+  queued_streams_.store(active_streams_.size(), std::memory_order_relaxed);
+  ctx_->chunk_size_tuner->MeasureContention(active_streams_.size());
   std::vector<SchedulingData> scheduling_data;
   uint64_t queued_tokens = 0;
   {
@@ -325,8 +382,11 @@ void OutputBuffers::Schedule() {
   // When we enqueue to the mpsc we don't know the wire size, since we don't
   // know that the bytes are going out over a TCP collective, or whether they'll
   // hit data endpoints or be inlined on a control channel.
-  scheduler_->NewStep(queued_tokens, first_message->frame.tokens());
+  scheduler_->NewStep(
+      queued_tokens,
+      stream_queues_[active_streams_.front()].frames.front().frame.tokens());
   const auto now = clock_->Now();
+  const int scheduler_numa_node = CurrentNumaNode();
   bool any_readers = false;
   {
     GRPC_LATENT_SEE_INNER_SCOPE("OutputBuffers::Schedule::CollectData2");
@@ -338,7 +398,16 @@ void OutputBuffers::Schedule() {
       bool reading = scheduling.reader->reading_;
       if (reading) any_readers = true;
       scheduling.reader->mu_.Unlock();
-      scheduler_->AddChannel(i, reading, delivery_data.start_time,
+      double start_time = delivery_data.start_time;
+      const int reader_numa_node = scheduling.reader->numa_node();
+      if (scheduler_numa_node >= 0 && reader_numa_node >= 0 &&
+          reader_numa_node != scheduler_numa_node) {
+        // Prefer endpoints whose write loop shares our NUMA node so payload
+        // assembly stays node-local; expressed as a start time handicap so
+        // the scheduler needs no locality-specific machinery.
+        start_time += kRemoteNumaPenaltySeconds;
+      }
+      scheduler_->AddChannel(i, reading, start_time,
                              delivery_data.bytes_per_second);
     }
   }
@@ -349,26 +418,56 @@ void OutputBuffers::Schedule() {
   }
   {
     GRPC_LATENT_SEE_INNER_SCOPE("OutputBuffers::Schedule::PlaceMessages");
-    while (true) {
-      auto* message = frames_queue_.Peek();
-      if (message == nullptr) break;
-      auto selected_reader =
-          scheduler_->AllocateMessage(message->frame.tokens());
-      if (!selected_reader.has_value()) {
-        // No reader is ready to read this frame.
-        // We'll try again later.
-        break;
+    // Deficit round robin: each stream's turn places its frames in order
+    // until its deficit is spent, then it rotates to the back of the line.
+    // Streams interleave at chunk granularity (see MessageChunker) so a huge
+    // message delays its peers by at most one quantum per round.
+    bool blocked = false;
+    while (!blocked && !active_streams_.empty()) {
+      const uint32_t stream_id = active_streams_.front();
+      active_streams_.pop_front();
+      auto it = stream_queues_.find(stream_id);
+      DCHECK(it != stream_queues_.end());
+      StreamSendQueue& stream = it->second;
+      if (!std::exchange(stream.mid_turn, false)) {
+        stream.deficit_bytes += stream_quantum_bytes_;
+      }
+      while (!stream.frames.empty()) {
+        QueuedFrame& message = stream.frames.front();
+        const uint64_t write_size = WriteSizeForFrame(message);
+        if (write_size > stream.deficit_bytes) break;
+        auto selected_reader =
+            scheduler_->AllocateMessage(message.frame.tokens());
+        if (!selected_reader.has_value()) {
+          // No reader is ready to read this frame.
+          // We'll try again later.
+          blocked = true;
+          break;
+        }
+        ztrace_collector_->Append([&message, write_size, selected_reader]() {
+          return WriteLargeFrameHeaderTrace{message.payload_tag, write_size,
+                                            *selected_reader};
+        });
+        stream.deficit_bytes -= write_size;
+        SchedulingData& scheduling = scheduling_data[*selected_reader];
+        scheduling.queued_bytes += write_size;
+        scheduling.frames.emplace_back(std::move(message));
+        stream.frames.pop_front();
+      }
+      if (stream.frames.empty()) {
+        // Idle streams don't bank deficit for their next burst.
+        stream_queues_.erase(it);
+      } else if (blocked) {
+        // The readers filled up mid-turn; this stream keeps its place at the
+        // head of the line and its remaining deficit.
+        stream.mid_turn = true;
+        active_streams_.push_front(stream_id);
+      } else {
+        active_streams_.push_back(stream_id);
+        stream_deferrals_.fetch_add(1, std::memory_order_relaxed);
       }
-      ztrace_collector_->Append([this, message, selected_reader]() {
-        return WriteLargeFrameHeaderTrace{message->payload_tag,
-                                          WriteSizeForFrame(*message),
-                                          *selected_reader};
-      });
-      SchedulingData& scheduling = scheduling_data[*selected_reader];
-      scheduling.queued_bytes += WriteSizeForFrame(*message);
-      scheduling.frames.emplace_back(std::move(*message));
-      frames_queue_.Pop();
     }
+    queued_streams_.store(active_streams_.size(), std::memory_order_relaxed);
   }
   {
     GRPC_LATENT_SEE_INNER_SCOPE("OutputBuffers::Schedule::PublishSchedule");
@@ -989,21 +1088,39 @@ DataEndpoints::DataEndpoints(
     std::vector<PendingConnection> endpoints_vec, TransportContextPtr ctx,
     uint32_t encode_alignment, uint32_t decode_alignment,
     std::shared_ptr<TcpZTraceCollector> ztrace_collector, bool enable_tracing,
-    std::string scheduler_config, data_endpoints_detail::Clock* clock)
+    std::string scheduler_config, uint32_t stream_scheduling_quantum,
+    data_endpoints_detail::Clock* clock)
     : channelz::DataSource(ctx->socket_node),
       output_buffers_(MakeRefCounted<data_endpoints_detail::OutputBuffers>(
           clock, encode_alignment, ztrace_collector,
-          std::move(scheduler_config), ctx)),
-      input_queues_(MakeRefCounted<data_endpoints_detail::InputQueue>()) {
+          std::move(scheduler_config), stream_scheduling_quantum, ctx)),
+      input_queues_(MakeRefCounted<data_endpoints_detail::InputQueue>()),
+      ctx_(std::move(ctx)),
+      encode_alignment_(encode_alignment),
+      decode_alignment_(decode_alignment),
+      ztrace_collector_(std::move(ztrace_collector)),
+      enable_tracing_(enable_tracing),
+      clock_(clock) {
   for (size_t i = 0; i < endpoints_vec.size(); ++i) {
     endpoints_.emplace_back(std::make_unique<data_endpoints_detail::Endpoint>(
-        i, encode_alignment, decode_alignment, clock, output_buffers_,
-        input_queues_, std::move(endpoints_vec[i]), enable_tracing, ctx,
-        ztrace_collector));
+        i, encode_alignment_, decode_alignment_, clock_, output_buffers_,
+        input_queues_, std::move(endpoints_vec[i]), enable_tracing_, ctx_,
+        ztrace_collector_));
   }
   SourceConstructed();
 }
 
+void DataEndpoints::AddEndpoint(PendingConnection pending_connection) {
+  MutexLock lock(&mu_);
+  GRPC_TRACE_LOG(chaotic_good, INFO)
+      << "CHAOTIC_GOOD: Add data endpoint " << endpoints_.size()
+      << " connection_id=" << pending_connection.id();
+  endpoints_.emplace_back(std::make_unique<data_endpoints_detail::Endpoint>(
+      endpoints_.size(), encode_alignment_, decode_alignment_, clock_,
+      output_buffers_, input_queues_, std::move(pending_connection),
+      enable_tracing_, ctx_, ztrace_collector_));
+}
+
 void DataEndpoints::AddData(channelz::DataSink sink) {
   output_buffers_->AddData(sink);
   input_queues_->AddData(sink);
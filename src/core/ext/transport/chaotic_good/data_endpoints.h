@@ -19,9 +19,11 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <queue>
 
+#include "absl/container/flat_hash_map.h"
 #include "src/core/channelz/channelz.h"
 #include "src/core/channelz/property_list.h"
 #include "src/core/ext/transport/chaotic_good/frame_transport.h"
@@ -93,8 +95,10 @@ class OutputBuffers final
  public:
   OutputBuffers(Clock* clock, uint32_t encode_alignment,
                 std::shared_ptr<TcpZTraceCollector> ztrace_collector,
-                std::string scheduler_config, TransportContextPtr ctx)
+                std::string scheduler_config, uint32_t stream_quantum_bytes,
+                TransportContextPtr ctx)
       : encode_alignment_(encode_alignment),
+        stream_quantum_bytes_(std::max<uint32_t>(1, stream_quantum_bytes)),
         clock_(clock),
         ztrace_collector_(std::move(ztrace_collector)),
         ctx_(std::move(ctx)),
@@ -144,6 +148,11 @@ class OutputBuffers final
 
     auto Next() { return NextPromise(this); }
     uint32_t id() const { return id_; }
+    // NUMA node of the thread that last consumed frames from this reader
+    // (i.e. the endpoint's write loop), or -1 while unknown/unsupported.
+    int numa_node() const {
+      return numa_node_.load(std::memory_order_relaxed);
+    }
     void SetNetworkMetrics(
         const std::optional<SendRate::NetworkSend>& network_send,
         const SendRate::NetworkMetrics& metrics);
@@ -193,6 +202,7 @@ class OutputBuffers final
     const uint32_t id_;
 
     Mutex mu_;
+    std::atomic<int> numa_node_{-1};
     bool reading_ ABSL_GUARDED_BY(mu_) = false;
     bool dropped_{false};
     SendRate send_rate_ ABSL_GUARDED_BY(mu_);
@@ -208,6 +218,13 @@ class OutputBuffers final
     return num_readers_.load(std::memory_order_relaxed);
   }
 
+  // Number of times a stream's scheduling turn ended with frames still
+  // queued - used as a cross-stream contention signal by data connection
+  // scaling.
+  uint64_t stream_deferrals() const {
+    return stream_deferrals_.load(std::memory_order_relaxed);
+  }
+
   [[nodiscard]] RefCountedPtr<Reader> MakeReader(uint32_t id)
       ABSL_LOCKS_EXCLUDED(mu_reader_data_);
 
@@ -225,6 +242,18 @@ class OutputBuffers final
     uint64_t queued_bytes = 0;
   };
 
+  // Frames awaiting placement for one stream, plus its deficit-round-robin
+  // accounting. Only touched from the scheduling party, so needs no lock.
+  struct StreamSendQueue {
+    std::deque<QueuedFrame> frames;
+    // Wire bytes this stream may still place before its turn ends; topped up
+    // by stream_quantum_bytes_ at the start of each turn.
+    uint64_t deficit_bytes = 0;
+    // True if the previous turn was cut short because no reader could accept
+    // more data: the stream resumes that turn without a fresh quantum.
+    bool mid_turn = false;
+  };
+
   static constexpr uintptr_t kSchedulingWorkAvailable = 1;
   static constexpr uintptr_t kSchedulingProcessing = 2;
 
@@ -234,6 +263,12 @@ class OutputBuffers final
   Poll<Empty> SchedulerPollForWork();
   void Schedule() ABSL_LOCKS_EXCLUDED(mu_reader_data_);
 
+  static uint32_t StreamIdForFrame(const QueuedFrame& queued_frame) {
+    return absl::ConvertVariantTo<FrameInterface&>(queued_frame.frame->payload)
+        .MakeHeader()
+        .stream_id;
+  }
+
   uint64_t WriteSizeForFrame(const QueuedFrame& queued_frame) {
     auto& frame =
         absl::ConvertVariantTo<FrameInterface&>(queued_frame.frame->payload);
@@ -246,10 +281,16 @@ class OutputBuffers final
   }
 
   std::atomic<size_t> num_readers_ = 0;
+  // Number of times a stream's turn ended with frames still queued because
+  // its deficit was exhausted - a measure of cross-stream contention.
+  std::atomic<uint64_t> stream_deferrals_{0};
+  // Streams with frames awaiting placement, as of the last scheduling pass.
+  std::atomic<size_t> queued_streams_{0};
   Mutex mu_reader_data_;
   MpscProbe<OutgoingFrame> mpsc_probe_ ABSL_GUARDED_BY(mu_reader_data_);
   std::vector<RefCountedPtr<Reader>> readers_ ABSL_GUARDED_BY(mu_reader_data_);
   const uint32_t encode_alignment_;
+  const uint64_t stream_quantum_bytes_;
   Clock* const clock_;
   const std::shared_ptr<TcpZTraceCollector> ztrace_collector_;
   TransportContextPtr ctx_;
@@ -262,6 +303,10 @@ class OutputBuffers final
   // Must be held to push into big_frames_queue_ or small_frames_queue_.
   Mutex mu_write_;
   ArenaSpsc<QueuedFrame, false> frames_queue_{arena_.get()};
+  // Deficit-round-robin state for interleaving competing streams.
+  // Only touched from the scheduling party.
+  absl::flat_hash_map<uint32_t, StreamSendQueue> stream_queues_;
+  std::deque<uint32_t> active_streams_;
   std::atomic<uintptr_t> scheduling_state_{kSchedulingProcessing};
   RefCountedPtr<Party> scheduling_party_;
   const std::unique_ptr<Scheduler> scheduler_;
@@ -503,11 +548,28 @@ class DataEndpoints final : public channelz::DataSource {
                          uint32_t decode_alignment,
                          std::shared_ptr<TcpZTraceCollector> ztrace_collector,
                          bool enable_tracing, std::string scheduler_config,
+                         uint32_t stream_scheduling_quantum,
                          data_endpoints_detail::Clock* clock = DefaultClock());
   ~DataEndpoints() { SourceDestructing(); }
 
   void AddData(channelz::DataSink sink) override;
 
+  // Add one more data endpoint to the collection once `pending_connection`
+  // resolves. Safe to call at any point in the transport's lifetime; frames
+  // are scheduled onto the new endpoint as soon as it becomes ready.
+  void AddEndpoint(PendingConnection pending_connection);
+
+  // Number of endpoints added so far (ready or still pending).
+  size_t endpoint_count() {
+    MutexLock lock(&mu_);
+    return endpoints_.size();
+  }
+
+  // See OutputBuffers::stream_deferrals().
+  uint64_t stream_deferrals() const {
+    return output_buffers_->stream_deferrals();
+  }
+
   // Try to queue output_buffer against a data endpoint.
   // Returns a promise that resolves to the data endpoint connection id
   // selected.
@@ -542,6 +604,14 @@ class DataEndpoints final : public channelz::DataSource {
 
   RefCountedPtr<data_endpoints_detail::OutputBuffers> output_buffers_;
   RefCountedPtr<data_endpoints_detail::InputQueue> input_queues_;
+  // Construction parameters retained so that endpoints added after
+  // construction are configured identically to the initial set.
+  TransportContextPtr ctx_;
+  const uint32_t encode_alignment_;
+  const uint32_t decode_alignment_;
+  const std::shared_ptr<TcpZTraceCollector> ztrace_collector_;
+  const bool enable_tracing_;
+  data_endpoints_detail::Clock* const clock_;
   Mutex mu_;
   std::vector<std::unique_ptr<data_endpoints_detail::Endpoint>> endpoints_
       ABSL_GUARDED_BY(mu_);
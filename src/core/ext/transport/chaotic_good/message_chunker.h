@@ -17,6 +17,7 @@
 
 #include <cstdint>
 
+#include "src/core/ext/transport/chaotic_good/chunk_size_tuner.h"
 #include "src/core/ext/transport/chaotic_good/frame.h"
 #include "src/core/ext/transport/chaotic_good/frame_transport.h"
 #include "src/core/lib/promise/if.h"
@@ -24,6 +25,7 @@
 #include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/seq.h"
 #include "src/core/lib/promise/status_flag.h"
+#include "src/core/util/ref_counted_ptr.h"
 
 namespace grpc_core {
 namespace chaotic_good {
@@ -92,11 +94,18 @@ class MessageChunker {
   MessageChunker(uint32_t max_chunk_size, uint32_t alignment)
       : max_chunk_size_(max_chunk_size), alignment_(alignment) {}
 
+  // Adopt a shared tuner: chunk sizes then track the measured
+  // bandwidth-delay product instead of the static maximum.
+  void SetChunkSizeTuner(RefCountedPtr<ChunkSizeTuner> tuner) {
+    tuner_ = std::move(tuner);
+  }
+
   template <typename Output>
   auto Send(MessageHandle message, uint32_t stream_id,
             std::shared_ptr<TcpCallTracer> call_tracer, Output& output) {
+    const uint32_t chunk_size = TargetChunkSize();
     return If(
-        ShouldChunk(*message),
+        ShouldChunk(chunk_size, *message),
         [&]() {
           BeginMessageFrame begin;
           begin.body.set_length(message->payload()->Length());
@@ -105,7 +114,7 @@ class MessageChunker {
           return Seq(
               output.Send(OutgoingFrame{std::move(begin), call_tracer}, tokens),
               Loop([chunker = message_chunker_detail::PayloadChunker(
-                        max_chunk_size_, alignment_, stream_id,
+                        chunk_size, alignment_, stream_id,
                         std::move(*message->payload())),
                     &output, call_tracer = std::move(call_tracer)]() mutable {
                 auto next = chunker.NextChunk();
@@ -133,13 +142,21 @@ class MessageChunker {
   uint32_t alignment() const { return alignment_; }
 
  private:
-  bool ShouldChunk(Message& message) {
-    return max_chunk_size_ != 0 &&
-           message.payload()->Length() > max_chunk_size_;
+  static bool ShouldChunk(uint32_t chunk_size, Message& message) {
+    return chunk_size != 0 && message.payload()->Length() > chunk_size;
+  }
+
+  // The chunk size for the next message: the tuner's current estimate when
+  // one is attached (never exceeding the negotiated maximum), otherwise the
+  // static configuration.
+  uint32_t TargetChunkSize() const {
+    if (max_chunk_size_ == 0 || tuner_ == nullptr) return max_chunk_size_;
+    return tuner_->ChunkSize(max_chunk_size_, alignment_);
   }
 
   const uint32_t max_chunk_size_;
   const uint32_t alignment_;
+  RefCountedPtr<ChunkSizeTuner> tuner_;
 };
 
 }  // namespace chaotic_good
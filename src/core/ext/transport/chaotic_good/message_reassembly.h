@@ -15,6 +15,8 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_MESSAGE_REASSEMBLY_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_MESSAGE_REASSEMBLY_H
 
+#include <optional>
+
 #include "absl/log/log.h"
 #include "src/core/call/call_spine.h"
 #include "src/core/ext/transport/chaotic_good/frame.h"
@@ -64,7 +66,7 @@ class MessageReassembly {
     } else {
       GRPC_TRACE_LOG(chaotic_good, INFO)
           << this << " begin message " << frame.body.ShortDebugString();
-      chunk_receiver_ = std::make_unique<ChunkReceiver>();
+      chunk_receiver_.emplace();
       chunk_receiver_->bytes_remaining = frame.body.length();
       ok = true;
     }
@@ -85,7 +87,10 @@ class MessageReassembly {
           << "b in message with " << chunk_receiver_->bytes_remaining
           << "b left";
       chunk_receiver_->bytes_remaining -= frame.payload.Length();
-      chunk_receiver_->incoming.Append(frame.payload);
+      // Move the chunk's slices into the message under assembly: the backing
+      // buffers flow through to the final Message (and from there into the
+      // application visible byte buffer) without being copied or re-refed.
+      chunk_receiver_->incoming.TakeAndAppend(frame.payload);
       ok = true;
       done = chunk_receiver_->bytes_remaining == 0;
       GRPC_TRACE_LOG(chaotic_good, INFO)
@@ -102,14 +107,16 @@ class MessageReassembly {
         [ok]() { return StatusFlag(ok); });
   }
 
-  bool in_message_boundary() { return chunk_receiver_ == nullptr; }
+  bool in_message_boundary() { return !chunk_receiver_.has_value(); }
 
  private:
   struct ChunkReceiver {
     size_t bytes_remaining;
     SliceBuffer incoming;
   };
-  std::unique_ptr<ChunkReceiver> chunk_receiver_;
+  // Inlined (rather than heap allocated) so that starting a chunked message
+  // costs no allocation.
+  std::optional<ChunkReceiver> chunk_receiver_;
 };
 
 }  // namespace chaotic_good
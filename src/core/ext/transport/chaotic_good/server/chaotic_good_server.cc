@@ -527,6 +527,15 @@ auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
             MakeRefCounted<TransportContext>(
                 self->connection_->handshake_result_args(),
                 std::move(socket_node)));
+        const int max_data_connections =
+            self->connection_->listener_->args()
+                .GetInt(GRPC_ARG_CHAOTIC_GOOD_MAX_DATA_CONNECTIONS)
+                .value_or(0);
+        if (max_data_connections > 0) {
+          frame_transport->SetServerConnectionFactory(
+              self->connection_->listener_->data_connection_listener_,
+              max_data_connections);
+        }
         return self->connection_->listener_->server_->SetupTransport(
             new ChaoticGoodServerTransport(
                 self->connection_->handshake_result_args(),
@@ -55,6 +55,14 @@
 #define GRPC_ARG_CHAOTIC_GOOD_DATA_CONNECTIONS \
   "grpc.chaotic_good.data_connections"
 
+// Channel arg: integer upper bound on data connections per transport.
+// If set above the initial data connection count, the server grows the set
+// of data connections up to this bound as cross-stream contention is
+// observed, announcing each new connection to the client over the control
+// channel. Defaults to 0 (scaling disabled).
+#define GRPC_ARG_CHAOTIC_GOOD_MAX_DATA_CONNECTIONS \
+  "grpc.chaotic_good.max_data_connections"
+
 namespace grpc_core {
 namespace chaotic_good {
 class ChaoticGoodServerListener final : public Server::ListenerInterface {
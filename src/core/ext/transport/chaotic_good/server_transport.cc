@@ -17,6 +17,7 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/grpc.h>
 #include <grpc/slice.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/port_platform.h>
 
 #include <memory>
@@ -49,6 +50,7 @@
 #include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/transport/promise_endpoint.h"
 #include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/useful.h"
 
 namespace grpc_core {
 namespace chaotic_good {
@@ -252,9 +254,23 @@ auto ChaoticGoodServerTransport::StreamDispatch::ProcessNextFrame(
 
 void ChaoticGoodServerTransport::StreamDispatch::OnIncomingFrame(
     IncomingFrame incoming_frame) {
-  incoming_frame_spawner_->Spawn(
-      [self = RefAsSubclass<StreamDispatch>(),
-       incoming_frame = std::move(incoming_frame)]() mutable {
+  const auto& header = incoming_frame.header();
+  if (header.type == FrameType::kClientInitialMetadata) {
+    // The monotonic stream id check needs to observe new streams in wire
+    // arrival order, so admit ids here - before frames fan out to dispatch
+    // shards that may process them in any relative order.
+    MutexLock lock(&mu_);
+    if (header.stream_id <= last_seen_new_stream_id_) {
+      LOG(ERROR) << "Failed to process client initial metadata: "
+                 << "Stream id is not increasing: " << header.stream_id
+                 << " last_seen_new_stream_id_=" << last_seen_new_stream_id_;
+      return;
+    }
+    last_seen_new_stream_id_ = header.stream_id;
+  }
+  DispatchSpawnerForStream(header.stream_id)
+      ->Spawn([self = RefAsSubclass<StreamDispatch>(),
+               incoming_frame = std::move(incoming_frame)]() mutable {
         return self->ProcessNextFrame(std::move(incoming_frame));
       });
 }
@@ -279,11 +295,25 @@ ChaoticGoodServerTransport::StreamDispatch::StreamDispatch(
       call_destination_(std::move(call_destination)),
       message_chunker_(message_chunker) {
   CHECK(ctx_ != nullptr);
+  message_chunker_.SetChunkSizeTuner(ctx_->chunk_size_tuner);
   auto party_arena = SimpleArenaAllocator(0)->MakeArena();
   party_arena->SetContext<grpc_event_engine::experimental::EventEngine>(
       ctx_->event_engine.get());
   party_ = Party::Make(std::move(party_arena));
-  incoming_frame_spawner_ = party_->MakeSpawnSerializer();
+  const size_t dispatch_shards =
+      Clamp(args.GetInt(GRPC_ARG_CHAOTIC_GOOD_DISPATCH_SHARDS)
+                .value_or(gpr_cpu_num_cores()),
+            1, 256);
+  dispatch_parties_.reserve(dispatch_shards);
+  dispatch_spawners_.reserve(dispatch_shards);
+  for (size_t i = 0; i < dispatch_shards; ++i) {
+    auto shard_arena = SimpleArenaAllocator(0)->MakeArena();
+    shard_arena->SetContext<grpc_event_engine::experimental::EventEngine>(
+        ctx_->event_engine.get());
+    dispatch_parties_.push_back(Party::Make(std::move(shard_arena)));
+    dispatch_spawners_.push_back(
+        dispatch_parties_.back()->MakeSpawnSerializer());
+  }
   MpscReceiver<OutgoingFrame> outgoing_pipe(256 * 1024 * 1024);
   outgoing_frames_ = outgoing_pipe.MakeSender();
   frame_transport->Start(party_.get(), std::move(outgoing_pipe), Ref());
@@ -293,11 +323,16 @@ ChaoticGoodServerTransport::StreamDispatch::StreamDispatch(
 void ChaoticGoodServerTransport::StreamDispatch::AddData(
     channelz::DataSink sink) {
   party_->ExportToChannelz("transport_party", sink);
+  for (size_t i = 0; i < dispatch_parties_.size(); ++i) {
+    dispatch_parties_[i]->ExportToChannelz(absl::StrCat("dispatch_party_", i),
+                                           sink);
+  }
   MutexLock lock(&mu_);
   sink.AddData("transport_state",
                channelz::PropertyList()
                    .Set("stream_map_size", stream_map_.size())
-                   .Set("last_seen_new_stream_id", last_seen_new_stream_id_));
+                   .Set("last_seen_new_stream_id", last_seen_new_stream_id_)
+                   .Set("dispatch_shards", dispatch_parties_.size()));
 }
 
 void ChaoticGoodServerTransport::SetCallDestination(
@@ -368,12 +403,15 @@ absl::Status ChaoticGoodServerTransport::StreamDispatch::AddStream(
     uint32_t stream_id, CallInitiator call_initiator) {
   MutexLock lock(&mu_);
   GRPC_TRACE_LOG(chaotic_good, INFO)
-      << "CHAOTIC_GOOD " << this << " NewStream " << stream_id
-      << " last_seen_new_stream_id_=" << last_seen_new_stream_id_;
-  auto it = stream_map_.find(stream_id);
-  if (stream_id <= last_seen_new_stream_id_) {
-    return absl::InternalError("Stream id is not increasing");
+      << "CHAOTIC_GOOD " << this << " NewStream " << stream_id;
+  // Note: the monotonic stream id check happens at frame admission in
+  // OnIncomingFrame, where wire arrival order is still observable. Here we
+  // only need to reject streams whose dispatch was outrun by transport
+  // closure (which advances last_seen_new_stream_id_ past all stream ids).
+  if (last_seen_new_stream_id_ == std::numeric_limits<uint32_t>::max()) {
+    return absl::UnavailableError("Transport closed");
   }
+  auto it = stream_map_.find(stream_id);
   if (it != stream_map_.end()) {
     return absl::InternalError("Stream already exists");
   }
@@ -34,6 +34,7 @@
 #include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_map.h"
@@ -74,6 +75,13 @@
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/sync.h"
 
+// Channel arg: integer number of parties that incoming stream dispatch is
+// sharded across, so that frame demux and call setup for distinct streams
+// can proceed concurrently on distinct threads.
+// Defaults to the number of cores if not set.
+#define GRPC_ARG_CHAOTIC_GOOD_DISPATCH_SHARDS \
+  "grpc.chaotic_good.dispatch_shards"
+
 namespace grpc_core {
 namespace chaotic_good {
 
@@ -152,6 +160,12 @@ class ChaoticGoodServerTransport final : public ServerTransport {
     auto CallOutboundLoop(uint32_t stream_id, CallInitiator call_initiator);
     auto ProcessNextFrame(IncomingFrame frame);
 
+    // All frames for one stream land on the same shard, so per-stream frame
+    // ordering is preserved while distinct streams dispatch concurrently.
+    Party::SpawnSerializer* DispatchSpawnerForStream(uint32_t stream_id) {
+      return dispatch_spawners_[stream_id % dispatch_spawners_.size()];
+    }
+
     Mutex mu_;
     StreamMap stream_map_ ABSL_GUARDED_BY(mu_);
     uint32_t last_seen_new_stream_id_ ABSL_GUARDED_BY(mu_) = 0;
@@ -160,10 +174,12 @@ class ChaoticGoodServerTransport final : public ServerTransport {
     const TransportContextPtr ctx_;
     const RefCountedPtr<CallArenaAllocator> call_arena_allocator_;
     const RefCountedPtr<UnstartedCallDestination> call_destination_;
-    Party::SpawnSerializer* incoming_frame_spawner_;
     MessageChunker message_chunker_;
     MpscSender<OutgoingFrame> outgoing_frames_;
     RefCountedPtr<Party> party_;
+    // Incoming stream dispatch is sharded by stream id across these parties.
+    std::vector<RefCountedPtr<Party>> dispatch_parties_;
+    std::vector<Party::SpawnSerializer*> dispatch_spawners_;
   };
 
   struct ConstructionParameters {
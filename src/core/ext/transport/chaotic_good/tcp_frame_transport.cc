@@ -28,9 +28,12 @@
 #include "src/core/lib/promise/join.h"
 #include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/race.h"
+#include "src/core/lib/promise/promise.h"
 #include "src/core/lib/promise/seq.h"
+#include "src/core/lib/promise/sleep.h"
 #include "src/core/lib/promise/try_seq.h"
 #include "src/core/lib/transport/transport_framing_endpoint_extension.h"
+#include "src/core/util/time.h"
 
 namespace grpc_core {
 namespace chaotic_good {
@@ -41,6 +44,14 @@ TransportFramingEndpointExtension* GetTransportFramingEndpointExtension(
   return grpc_event_engine::experimental::QueryExtension<
       TransportFramingEndpointExtension>(&endpoint);
 }
+
+// How often the server re-evaluates whether another data connection would
+// relieve cross-stream contention.
+constexpr Duration kDataConnectionScalingInterval = Duration::Seconds(5);
+// Minimum number of deficit-limited stream deferrals observed during one
+// interval before another data connection is requested: small bursts of
+// contention don't warrant a new connection, sustained queueing does.
+constexpr uint64_t kDataConnectionScalingDeferralThreshold = 100;
 }  // namespace
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -56,7 +67,8 @@ TcpFrameTransport::TcpFrameTransport(
       data_endpoints_(std::move(pending_data_endpoints), ctx,
                       options.encode_alignment, options.decode_alignment,
                       ztrace_collector_, options.enable_tracing,
-                      options.scheduler_config),
+                      options.scheduler_config,
+                      options.stream_scheduling_quantum),
       options_(options) {
   auto* transport_framing_endpoint_extension =
       GetTransportFramingEndpointExtension(
@@ -172,6 +184,14 @@ auto TcpFrameTransport::ReadFrameBytes() {
                         // reporting the security frame to the upper layer.
                         return Continue{};
                       }
+                      if (frame_header.header.type == FrameType::kSettings) {
+                        auto status = ReceiveSettingsFrame(frame_header.header,
+                                                           std::move(*payload));
+                        if (!status.ok()) return status;
+                        // Settings updates are consumed by the transport
+                        // itself - loop around and read the next frame.
+                        return Continue{};
+                      }
                       return IncomingFrame(frame_header.header,
                                            std::move(payload));
                     });
@@ -193,6 +213,59 @@ auto TcpFrameTransport::ReadFrameBytes() {
   });
 }
 
+absl::Status TcpFrameTransport::ReceiveSettingsFrame(const FrameHeader& header,
+                                                     SliceBuffer payload) {
+  SettingsFrame frame;
+  auto status = frame.Deserialize(header, std::move(payload));
+  if (!status.ok()) return status;
+  if (client_connection_factory_ == nullptr) {
+    // Servers (and clients without a connection factory) have no way to act
+    // on post-handshake settings; ignore rather than fail so that future
+    // settings extensions remain compatible with older peers.
+    GRPC_TRACE_LOG(chaotic_good, INFO)
+        << "CHAOTIC_GOOD: Ignore post-handshake settings frame "
+        << frame.ToString();
+    return absl::OkStatus();
+  }
+  for (const auto& connection_id : frame.body.connection_id()) {
+    GRPC_TRACE_LOG(chaotic_good, INFO)
+        << "CHAOTIC_GOOD: Server announced new data connection "
+        << connection_id;
+    data_endpoints_.AddEndpoint(client_connection_factory_->Connect(
+        connection_id));
+  }
+  return absl::OkStatus();
+}
+
+auto TcpFrameTransport::MaybeAddDataEndpoint() {
+  const uint64_t deferrals = data_endpoints_.stream_deferrals();
+  const uint64_t deferral_delta = deferrals - last_stream_deferrals_;
+  last_stream_deferrals_ = deferrals;
+  const bool wants_more =
+      deferral_delta >= kDataConnectionScalingDeferralThreshold &&
+      data_endpoints_.endpoint_count() < max_data_connections_;
+  return If(
+      wants_more,
+      [this]() {
+        auto pending_connection =
+            server_connection_factory_->RequestDataConnection();
+        GRPC_TRACE_LOG(chaotic_good, INFO)
+            << "CHAOTIC_GOOD: Scale up data connections: announce "
+            << pending_connection.id();
+        // Announce the new connection id to the client with a settings
+        // frame, mirroring how the handshake communicates the initial set.
+        SettingsFrame frame;
+        frame.body.add_connection_id(std::string(pending_connection.id()));
+        SliceBuffer write_buffer;
+        TcpFrameHeader{frame.MakeHeader(), 0}.Serialize(
+            write_buffer.AddTiny(TcpFrameHeader::kFrameHeaderSize));
+        frame.SerializePayload(write_buffer);
+        data_endpoints_.AddEndpoint(std::move(pending_connection));
+        return control_endpoint_.Write(std::move(write_buffer));
+      },
+      []() { return Immediate(Empty{}); });
+}
+
 template <typename Promise>
 auto TcpFrameTransport::UntilClosed(Promise promise) {
   return Race(Map(closed_.Wait(),
@@ -216,6 +289,19 @@ void TcpFrameTransport::Start(Party* party, MpscReceiver<OutgoingFrame> frames,
         ztrace_collector->Append(TransportError</*read=*/false>{status});
         sink->OnFrameTransportClosed(std::move(status));
       });
+  if (server_connection_factory_ != nullptr && max_data_connections_ > 0) {
+    write_party->Spawn(
+        "data-connection-scaling",
+        [self = RefAsSubclass<TcpFrameTransport>()]() {
+          return self->UntilClosed(Loop([self = self.get()]() {
+            return TrySeq(
+                Sleep(kDataConnectionScalingInterval),
+                [self]() { return self->MaybeAddDataEndpoint(); },
+                []() -> LoopCtl<absl::Status> { return Continue{}; });
+          }));
+        },
+        [](absl::Status) {});
+  }
   party->Spawn(
       "tcp-read",
       [self = RefAsSubclass<TcpFrameTransport>(), sink = sink]() {
@@ -248,7 +334,8 @@ void TcpFrameTransport::AddData(channelz::DataSink sink) {
                    .Set("decode_alignment", options_.decode_alignment)
                    .Set("inlined_payload_size_threshold",
                         options_.inlined_payload_size_threshold)
-                   .Set("enable_tracing", options_.enable_tracing));
+                   .Set("enable_tracing", options_.enable_tracing)
+                   .Set("max_data_connections", max_data_connections_));
 }
 
 RefCountedPtr<channelz::SocketNode> TcpFrameTransport::MakeSocketNode(
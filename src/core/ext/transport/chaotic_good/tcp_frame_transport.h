@@ -43,6 +43,9 @@ class TcpFrameTransport final : public FrameTransport,
     uint32_t decode_alignment = 64;
     uint32_t inlined_payload_size_threshold = 8 * 1024;
     std::string scheduler_config = "spanrr";
+    // Wire bytes each stream may place per deficit-round-robin turn when
+    // competing streams are queued against the data endpoints.
+    uint32_t stream_scheduling_quantum = 64 * 1024;
     bool enable_tracing = false;
   };
 
@@ -54,6 +57,24 @@ class TcpFrameTransport final : public FrameTransport,
   static RefCountedPtr<channelz::SocketNode> MakeSocketNode(
       const ChannelArgs& args, const PromiseEndpoint& endpoint);
 
+  // Client side: supply the factory used to establish additional data
+  // connections when the server announces new connection ids after the
+  // handshake. Must be called before Start().
+  void SetClientConnectionFactory(
+      RefCountedPtr<ClientConnectionFactory> factory) {
+    client_connection_factory_ = std::move(factory);
+  }
+
+  // Server side: enable demand-driven data connection scaling, growing the
+  // set of data endpoints up to max_data_connections as cross-stream
+  // contention is observed. Must be called before Start().
+  void SetServerConnectionFactory(
+      RefCountedPtr<ServerConnectionFactory> factory,
+      uint32_t max_data_connections) {
+    server_connection_factory_ = std::move(factory);
+    max_data_connections_ = max_data_connections;
+  }
+
   void Start(Party* party, MpscReceiver<OutgoingFrame> outgoing_frames,
              RefCountedPtr<FrameTransportSink> sink) override;
   void Orphan() override;
@@ -72,6 +93,14 @@ class TcpFrameTransport final : public FrameTransport,
   // Read frame header and payloads for control and data portions of one frame.
   // Resolves to StatusOr<IncomingFrame>.
   auto ReadFrameBytes();
+  // Handle a settings frame received on the control channel after the
+  // handshake: the server uses these to announce additional data connection
+  // ids, which we establish via the client connection factory.
+  absl::Status ReceiveSettingsFrame(const FrameHeader& header,
+                                    SliceBuffer payload);
+  // Server side: if contention warrants (and we're under the cap), request a
+  // new data connection, announce its id to the client, and add it locally.
+  auto MaybeAddDataEndpoint();
   template <typename Promise>
   auto UntilClosed(Promise promise);
 
@@ -83,6 +112,11 @@ class TcpFrameTransport final : public FrameTransport,
   const Options options_;
   InterActivityLatch<void> closed_;
   uint64_t next_payload_tag_ = 1;
+  RefCountedPtr<ClientConnectionFactory> client_connection_factory_;
+  RefCountedPtr<ServerConnectionFactory> server_connection_factory_;
+  uint32_t max_data_connections_ = 0;
+  // stream_deferrals() observed at the last scaling evaluation.
+  uint64_t last_stream_deferrals_ = 0;
 };
 
 }  // namespace chaotic_good
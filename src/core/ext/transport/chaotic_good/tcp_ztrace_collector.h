@@ -15,9 +15,11 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_TCP_ZTRACE_COLLECTOR_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_TCP_ZTRACE_COLLECTOR_H
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <map>
+#include <optional>
 #include <string>
 
 #include "src/core/channelz/ztrace_collector.h"
@@ -27,16 +29,6 @@
 namespace grpc_core::chaotic_good {
 namespace tcp_ztrace_collector_detail {
 
-class Config {
- public:
-  explicit Config(std::map<std::string, std::string>) {}
-
-  template <typename T>
-  bool Finishes(const T&) {
-    return false;
-  }
-};
-
 void TcpFrameHeaderToJsonObject(const TcpFrameHeader& header,
                                 Json::Object& object);
 void TcpDataFrameHeaderToJsonObject(const TcpDataFrameHeader& header,
@@ -212,6 +204,63 @@ struct EndpointCloseTrace {
   }
 };
 
+namespace tcp_ztrace_collector_detail {
+
+// Query configuration for TCP transport traces.
+// Supported query args:
+//   sample_one_in: record only one in this many events (default 1 - record
+//     everything). Lets a query stay running against production frame rates.
+//   stream_id: record every frame belonging to this stream, regardless of
+//     sampling. Events that don't carry a stream id (byte level and endpoint
+//     events) still follow sample_one_in, so a targeted query keeps some
+//     transport level context.
+class Config {
+ public:
+  explicit Config(std::map<std::string, std::string> args)
+      : sample_one_in_(std::max<int64_t>(
+            1, channelz::IntFromArgs(args, "sample_one_in").value_or(1))),
+        target_stream_id_(channelz::IntFromArgs(args, "stream_id")) {}
+
+  template <typename T>
+  bool Finishes(const T&) {
+    return false;
+  }
+
+  bool Accepts(const ReadFrameHeaderTrace& trace) {
+    return AcceptsStreamId(trace.header.header.stream_id);
+  }
+  bool Accepts(const WriteFrameHeaderTrace& trace) {
+    return AcceptsStreamId(trace.header.header.stream_id);
+  }
+  template <typename T>
+  bool Accepts(const T&) {
+    return Sample();
+  }
+
+ private:
+  bool AcceptsStreamId(uint32_t stream_id) {
+    if (target_stream_id_.has_value()) {
+      return stream_id == static_cast<uint64_t>(*target_stream_id_);
+    }
+    return Sample();
+  }
+
+  // Deterministic 1-in-N sampling: constant cost per event, no state beyond
+  // one counter.
+  bool Sample() {
+    if (sample_one_in_ <= 1) return true;
+    if (++sample_counter_ < sample_one_in_) return false;
+    sample_counter_ = 0;
+    return true;
+  }
+
+  const int64_t sample_one_in_;
+  const std::optional<int64_t> target_stream_id_;
+  int64_t sample_counter_ = 0;
+};
+
+}  // namespace tcp_ztrace_collector_detail
+
 using TcpZTraceCollector = channelz::ZTraceCollector<
     tcp_ztrace_collector_detail::Config, ReadFrameHeaderTrace,
     ReadDataHeaderTrace, WriteFrameHeaderTrace, TraceWriteSchedule,
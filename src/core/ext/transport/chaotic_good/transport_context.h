@@ -18,6 +18,7 @@
 #include <grpc/event_engine/event_engine.h>
 
 #include "src/core/channelz/channelz.h"
+#include "src/core/ext/transport/chaotic_good/chunk_size_tuner.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/telemetry/metrics.h"
 #include "src/core/util/ref_counted.h"
@@ -48,6 +49,10 @@ struct TransportContext : public RefCounted<TransportContext> {
   const std::shared_ptr<GlobalStatsPluginRegistry::StatsPluginGroup>
       stats_plugin_group;
   const RefCountedPtr<channelz::SocketNode> socket_node;
+  // Shared between the frame transport (which measures) and the message
+  // chunker (which consumes); see ChunkSizeTuner.
+  const RefCountedPtr<ChunkSizeTuner> chunk_size_tuner =
+      MakeRefCounted<ChunkSizeTuner>();
 };
 
 using TransportContextPtr = RefCountedPtr<TransportContext>;
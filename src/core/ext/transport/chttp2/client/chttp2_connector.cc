@@ -298,8 +298,60 @@ void Chttp2Connector::MaybeNotify(grpc_error_handle error) {
   }
 }
 
+namespace {
+
+// Implements the direct-channel mode of CreateHttp2Channel(): takes the
+// pre-connected endpoint out of the channel args, creates the transport
+// over it synchronously, and wires it into a GRPC_CLIENT_DIRECT_CHANNEL
+// stack.  No resolver or LB policy is instantiated, and the channel is
+// bound to this single connection for its lifetime.
+absl::StatusOr<grpc_channel*> CreateDirectHttp2Channel(
+    std::string target, const ChannelArgs& args) {
+  // There is no connector in this mode, so no security handshake can be
+  // performed; insecure credentials are the only ones that don't need one.
+  auto* creds = args.GetObject<grpc_channel_credentials>();
+  if (creds == nullptr || creds->type() != InsecureCredentials::Type()) {
+    return absl::InvalidArgumentError(
+        "direct channels require insecure credentials");
+  }
+  auto* endpoint_wrapper = args.GetObject<
+      grpc_event_engine::experimental::EndpointChannelArgWrapper>();
+  std::unique_ptr<EventEngine::Endpoint> ee_endpoint;
+  if (endpoint_wrapper != nullptr) {
+    ee_endpoint = endpoint_wrapper->TakeEndpoint();
+  }
+  if (ee_endpoint == nullptr) {
+    return absl::InvalidArgumentError(
+        "direct channels require a pre-connected endpoint");
+  }
+  OrphanablePtr<grpc_endpoint> endpoint(
+      grpc_event_engine_endpoint_create(std::move(ee_endpoint)));
+  Transport* transport =
+      grpc_create_chttp2_transport(args, std::move(endpoint), true);
+  CHECK(transport != nullptr);
+  auto channel =
+      ChannelCreate(std::move(target), args, GRPC_CLIENT_DIRECT_CHANNEL,
+                    transport);
+  if (!channel.ok()) {
+    transport->Orphan();
+    return channel.status();
+  }
+  grpc_chttp2_transport_start_reading(transport, nullptr, nullptr, nullptr,
+                                      nullptr);
+  ExecCtx::Get()->Flush();
+  return channel->release()->c_ptr();
+}
+
+}  // namespace
+
 absl::StatusOr<grpc_channel*> CreateHttp2Channel(std::string target,
                                                  const ChannelArgs& args) {
+  // Static direct-channel mode: a caller that already has a connected
+  // endpoint (e.g. via CreateChannelFromEndpoint()) can skip the
+  // resolver and LB machinery entirely.
+  if (args.GetBool(GRPC_ARG_DIRECT_CHANNEL).value_or(false)) {
+    return CreateDirectHttp2Channel(std::move(target), args);
+  }
 #ifdef GRPC_EXPERIMENTAL_TEMPORARILY_DISABLE_PH2
   // GRPC_EXPERIMENTAL_TEMPORARILY_DISABLE_PH2 is a temporary fix to help some
   // customers who are having severe memory constraints. This macro will not
@@ -531,6 +531,18 @@ void NewChttp2ServerListener::Start() {
   }
 }
 
+void NewChttp2ServerListener::AppendListenFds(std::vector<int>* fds) const {
+  if (tcp_server_ == nullptr) return;
+  for (unsigned port_index = 0;; ++port_index) {
+    unsigned fd_count = grpc_tcp_server_port_fd_count(tcp_server_, port_index);
+    if (fd_count == 0) break;
+    for (unsigned fd_index = 0; fd_index < fd_count; ++fd_index) {
+      int fd = grpc_tcp_server_port_fd(tcp_server_, port_index, fd_index);
+      if (fd >= 0) fds->push_back(fd);
+    }
+  }
+}
+
 void NewChttp2ServerListener::SetOnDestroyDone(grpc_closure* on_destroy_done) {
   MutexLock lock(&mu_);
   on_destroy_done_ = on_destroy_done;
@@ -25,6 +25,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <functional>
+#include <vector>
 
 #include "src/core/ext/transport/chttp2/transport/internal.h"
 #include "src/core/handshaker/handshaker.h"
@@ -174,6 +175,8 @@ class NewChttp2ServerListener : public Server::ListenerInterface {
     return &resolved_address_;
   }
 
+  void AppendListenFds(std::vector<int>* fds) const override;
+
   void SetOnDestroyDone(grpc_closure* on_destroy_done) override;
 
   void Orphan() override;
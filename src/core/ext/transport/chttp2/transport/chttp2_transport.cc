@@ -81,6 +81,7 @@
 #include "src/core/ext/transport/chttp2/transport/write_size_policy.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/event_engine/extensions/channelz.h"
+#include "src/core/lib/event_engine/extensions/pacing.h"
 #include "src/core/lib/event_engine/extensions/tcp_trace.h"
 #include "src/core/lib/event_engine/query_extensions.h"
 #include "src/core/lib/experiments/experiments.h"
@@ -116,6 +117,7 @@
 #include "src/core/util/crash.h"
 #include "src/core/util/debug_location.h"
 #include "src/core/util/http_client/parser.h"
+#include "src/core/util/no_destruct.h"
 #include "src/core/util/notification.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/shared_bit_gen.h"
@@ -165,6 +167,9 @@ static void write_action_end(grpc_core::RefCountedPtr<grpc_chttp2_transport>,
 static void write_action_end_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
 
+static void write_coalesce_flush_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
+
 static void read_action(grpc_core::RefCountedPtr<grpc_chttp2_transport>,
                         grpc_error_handle error);
 static void read_action_locked(grpc_core::RefCountedPtr<grpc_chttp2_transport>,
@@ -423,6 +428,12 @@ static void read_channel_args(grpc_chttp2_transport* t,
   t->write_buffer_size =
       std::max(0, channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE)
                       .value_or(grpc_core::chttp2::kDefaultWindow));
+  t->write_coalesce_delay = grpc_core::Duration::Microseconds(
+      std::max(0, channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_COALESCE_MICROS)
+                      .value_or(0)));
+  t->window_update_coalesce_delay = grpc_core::Duration::Microseconds(std::max(
+      0, channel_args.GetInt(GRPC_ARG_HTTP2_WINDOW_UPDATE_COALESCE_MICROS)
+             .value_or(0)));
   t->keepalive_time =
       std::max(grpc_core::Duration::Milliseconds(1),
                channel_args.GetDurationFromIntMillis(GRPC_ARG_KEEPALIVE_TIME_MS)
@@ -724,6 +735,16 @@ grpc_chttp2_transport::grpc_chttp2_transport(
     }
   }
 
+  if (channel_args.GetBool(GRPC_ARG_BDP_DRIVEN_WRITE_PACING)
+          .value_or(false) &&
+      grpc_event_engine::experimental::grpc_is_event_engine_endpoint(
+          ep.get())) {
+    pacing_endpoint_extension = QueryExtension<
+        grpc_event_engine::experimental::EndpointPacingExtension>(
+        grpc_event_engine::experimental::grpc_get_wrapped_event_engine_endpoint(
+            ep.get()));
+  }
+
   if (channel_args.GetBool(GRPC_ARG_SECURITY_FRAME_ALLOWED).value_or(false)) {
     transport_framing_endpoint_extension = QueryExtension<
         grpc_core::TransportFramingEndpointExtension>(
@@ -856,6 +877,10 @@ static void close_transport_locked(grpc_chttp2_transport* t,
       t->event_engine->Cancel(std::exchange(t->keepalive_ping_timeout_handle,
                                             TaskHandle::kInvalid));
     }
+    if (t->ping_timeout_timer_handle != TaskHandle::kInvalid) {
+      t->event_engine->Cancel(std::exchange(t->ping_timeout_timer_handle,
+                                            TaskHandle::kInvalid));
+    }
     if (t->settings_ack_watchdog != TaskHandle::kInvalid) {
       t->event_engine->Cancel(
           std::exchange(t->settings_ack_watchdog, TaskHandle::kInvalid));
@@ -864,6 +889,10 @@ static void close_transport_locked(grpc_chttp2_transport* t,
         t->event_engine->Cancel(t->delayed_ping_timer_handle)) {
       t->delayed_ping_timer_handle = TaskHandle::kInvalid;
     }
+    if (t->write_coalesce_timer_handle != TaskHandle::kInvalid &&
+        t->event_engine->Cancel(t->write_coalesce_timer_handle)) {
+      t->write_coalesce_timer_handle = TaskHandle::kInvalid;
+    }
     if (t->next_bdp_ping_timer_handle != TaskHandle::kInvalid &&
         t->event_engine->Cancel(t->next_bdp_ping_timer_handle)) {
       t->next_bdp_ping_timer_handle = TaskHandle::kInvalid;
@@ -1010,6 +1039,8 @@ void grpc_chttp2_transport::InitStream(grpc_stream* gs,
                                        grpc_stream_refcount* refcount,
                                        const void* server_data,
                                        grpc_core::Arena* arena) {
+  grpc_core::ArenaAllocAccounting::Scope accounting(
+      grpc_core::ArenaAllocAccounting::Consumer::kTransportStream);
   new (gs) grpc_chttp2_stream(this, refcount, server_data, arena);
 }
 
@@ -1082,10 +1113,58 @@ static void set_write_state(grpc_chttp2_transport* t,
   }
 }
 
+grpc_core::StructuredEventLog<grpc_chttp2_hot_event>&
+grpc_chttp2_hot_event_log() {
+  static grpc_core::NoDestruct<
+      grpc_core::StructuredEventLog<grpc_chttp2_hot_event>>
+      log;
+  return *log;
+}
+
 void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
                                 grpc_chttp2_initiate_write_reason reason) {
+  grpc_chttp2_hot_event_log().Append(
+      {grpc_chttp2_hot_event::Kind::kInitiateWrite,
+       static_cast<uint8_t>(reason), 0, reinterpret_cast<uintptr_t>(t)});
   switch (t->write_state) {
-    case GRPC_CHTTP2_WRITE_STATE_IDLE:
+    case GRPC_CHTTP2_WRITE_STATE_IDLE: {
+      // Write coalescing: a write triggered purely by an outgoing message may
+      // be held back briefly so that subsequent messages share the same
+      // endpoint write. The hold ends when the coalesce timer fires or when
+      // enough bytes accumulate to fill the (BDP-derived) target frame size.
+      // Writes carrying only flow control updates (WINDOW_UPDATE, locally
+      // originated SETTINGS) may similarly be held back so the queued updates
+      // piggyback on the next substantive write; the timer is the deadline
+      // fallback if no such write arrives.
+      grpc_core::Duration defer_delay = grpc_core::Duration::Zero();
+      if (reason == GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE &&
+          static_cast<int64_t>(t->write_coalesce_pending_bytes) <
+              t->flow_control.target_frame_size()) {
+        defer_delay = t->write_coalesce_delay;
+      } else if (reason == GRPC_CHTTP2_INITIATE_WRITE_TRANSPORT_FLOW_CONTROL ||
+                 reason == GRPC_CHTTP2_INITIATE_WRITE_STREAM_FLOW_CONTROL ||
+                 reason == GRPC_CHTTP2_INITIATE_WRITE_SEND_SETTINGS) {
+        defer_delay = t->window_update_coalesce_delay;
+      }
+      if (defer_delay != grpc_core::Duration::Zero() &&
+          !t->write_coalesce_flushing && t->closed_with_error.ok()) {
+        if (t->write_coalesce_timer_handle == TaskHandle::kInvalid) {
+          t->write_coalesce_timer_handle = t->event_engine->RunAfter(
+              defer_delay, [t = t->Ref()]() mutable {
+                grpc_core::ExecCtx exec_ctx;
+                auto tp = t.get();
+                tp->combiner->Run(
+                    grpc_core::InitTransportClosure<write_coalesce_flush_locked>(
+                        std::move(t), &tp->write_coalesce_flush_locked),
+                    absl::OkStatus());
+              });
+        }
+        return;
+      }
+      if (t->write_coalesce_timer_handle != TaskHandle::kInvalid &&
+          t->event_engine->Cancel(t->write_coalesce_timer_handle)) {
+        t->write_coalesce_timer_handle = TaskHandle::kInvalid;
+      }
       set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING,
                       grpc_chttp2_initiate_write_reason_string(reason));
       // Note that the 'write_action_begin_locked' closure is being scheduled
@@ -1109,6 +1188,7 @@ void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
               t->Ref(), &t->write_action_begin_locked),
           absl::OkStatus());
       break;
+    }
     case GRPC_CHTTP2_WRITE_STATE_WRITING:
       set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING_WITH_MORE,
                       grpc_chttp2_initiate_write_reason_string(reason));
@@ -1138,6 +1218,7 @@ static void write_action_begin_locked(
     grpc_error_handle /*error_ignored*/) {
   GRPC_LATENT_SEE_INNER_SCOPE("write_action_begin_locked");
   CHECK(t->write_state != GRPC_CHTTP2_WRITE_STATE_IDLE);
+  t->write_coalesce_pending_bytes = 0;
   grpc_chttp2_begin_write_result r;
   if (!t->closed_with_error.ok()) {
     r.writing = false;
@@ -1235,6 +1316,10 @@ static void write_action(
   t->write_size_policy.BeginWrite(t->outbuf.Length());
   t->http2_ztrace_collector.Append(grpc_core::H2BeginEndpointWrite{
       static_cast<uint32_t>(t->outbuf.Length())});
+  grpc_chttp2_hot_event_log().Append(
+      {grpc_chttp2_hot_event::Kind::kBeginEndpointWrite, 0,
+       static_cast<int64_t>(t->outbuf.Length()),
+       reinterpret_cast<uintptr_t>(t)});
   grpc_endpoint_write(t->ep.get(), t->outbuf.c_slice_buffer(),
                       grpc_core::InitTransportClosure<write_action_end>(
                           t->Ref(), &t->write_action_end_locked),
@@ -1246,6 +1331,8 @@ static void write_action_end(grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
   auto* tp = t.get();
   GRPC_TRACE_LOG(http2_ping, INFO) << (t->is_client ? "CLIENT" : "SERVER")
                                    << "[" << t.get() << "]: Finish write";
+  grpc_chttp2_hot_event_log().Append({grpc_chttp2_hot_event::Kind::kEndWrite, 0,
+                                      0, reinterpret_cast<uintptr_t>(tp)});
   tp->combiner->Run(grpc_core::InitTransportClosure<write_action_end_locked>(
                         std::move(t), &tp->write_action_end_locked),
                     error);
@@ -1623,6 +1710,9 @@ static void send_message_locked(
                                       "fetching_send_message_finished");
   } else {
     flags = op_payload->send_message.flags;
+    // The gRPC length prefix is materialized directly into the frame buffer
+    // here - tiny_add extends the buffer's tail storage in place - so
+    // messages never carry a separate prefix slice through the call stack.
     uint8_t* frame_hdr = grpc_slice_buffer_tiny_add(&s->flow_controlled_buffer,
                                                     GRPC_HEADER_SIZE_IN_BYTES);
     frame_hdr[0] = (flags & GRPC_WRITE_INTERNAL_COMPRESS) != 0;
@@ -1678,6 +1768,7 @@ static void send_message_locked(
 
     if (s->id != 0 && (!s->write_buffering || s->flow_controlled_buffer.length >
                                                   t->write_buffer_size)) {
+      t->write_coalesce_pending_bytes += GRPC_HEADER_SIZE_IN_BYTES + len;
       grpc_chttp2_mark_stream_writable(t, s);
       grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE);
     }
@@ -1938,6 +2029,17 @@ void grpc_chttp2_retry_initiate_ping(
                     absl::OkStatus());
 }
 
+static void write_coalesce_flush_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    GRPC_UNUSED grpc_error_handle error) {
+  DCHECK(error.ok());
+  if (t->write_coalesce_timer_handle == TaskHandle::kInvalid) return;
+  t->write_coalesce_timer_handle = TaskHandle::kInvalid;
+  t->write_coalesce_flushing = true;
+  grpc_chttp2_initiate_write(t.get(), GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE);
+  t->write_coalesce_flushing = false;
+}
+
 static void retry_initiate_ping_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
     GRPC_UNUSED grpc_error_handle error) {
@@ -1985,6 +2087,23 @@ void grpc_chttp2_ping_timeout(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t) {
   t->combiner->Run(
       grpc_core::NewClosure([t](grpc_error_handle) {
+        t->ping_timeout_timer_handle = TaskHandle::kInvalid;
+        if (t->destroying || !t->closed_with_error.ok()) return;
+        const grpc_core::Timestamp now = grpc_core::Timestamp::Now();
+        const grpc_core::Timestamp earliest =
+            t->ping_callbacks.earliest_timeout_deadline();
+        if (earliest > now) {
+          // Every ping that was due when this timer was armed has been
+          // acked; re-arm for the next recorded deadline, if any.
+          if (earliest != grpc_core::Timestamp::InfFuture()) {
+            t->ping_timeout_timer_handle =
+                t->event_engine->RunAfter(earliest - now, [t] {
+                  grpc_core::ExecCtx exec_ctx;
+                  grpc_chttp2_ping_timeout(t);
+                });
+          }
+          return;
+        }
         GRPC_TRACE_LOG(http, INFO) << t->peer_string.as_string_view()
                                    << ": Ping timeout. Closing transport.";
         send_goaway(
@@ -2362,6 +2481,7 @@ static grpc_chttp2_transport::RemovedStreamHandle remove_stream(
     grpc_chttp2_transport* t, uint32_t id, grpc_error_handle error) {
   grpc_chttp2_stream* s = t->stream_map.extract(id).mapped();
   DCHECK(s);
+  if (t->last_parsed_stream == s) t->last_parsed_stream = nullptr;
   if (t->incoming_stream == s) {
     t->incoming_stream = nullptr;
     grpc_chttp2_parsing_become_skip_parser(t);
@@ -2981,6 +3101,10 @@ static void read_action_parse_loop_locked(
 static void read_action_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
     grpc_error_handle error) {
+  grpc_chttp2_hot_event_log().Append(
+      {grpc_chttp2_hot_event::Kind::kRead, 0,
+       static_cast<int64_t>(t->read_buffer.length),
+       reinterpret_cast<uintptr_t>(t.get())});
   // got an incoming read, cancel any pending keepalive timers
   t->keepalive_incoming_data_wanted = false;
   if (t->keepalive_ping_timeout_handle != TaskHandle::kInvalid) {
@@ -3057,6 +3181,28 @@ static void finish_bdp_ping(grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
                     error);
 }
 
+// Feeds the freshly completed bandwidth estimate to the endpoint's pacing
+// extension. The rate is set to twice the estimate so pacing smooths out
+// line-rate bursts without capping throughput while the estimate is still
+// growing, and is only re-applied when it has moved by more than 1/8th to
+// keep setsockopt traffic out of the steady state.
+static void maybe_update_pacing_rate(grpc_chttp2_transport* t) {
+  if (t->pacing_endpoint_extension == nullptr) return;
+  const double bw = t->flow_control.bdp_estimator()->EstimateBandwidth();
+  if (bw <= 0) return;
+  const uint64_t rate = static_cast<uint64_t>(2 * bw);
+  const uint64_t applied = t->applied_max_pacing_rate;
+  if (applied != 0 && rate * 8 < applied * 9 && applied * 8 < rate * 9) {
+    return;
+  }
+  if (t->pacing_endpoint_extension->SetMaxPacingRate(rate).ok()) {
+    t->applied_max_pacing_rate = rate;
+  } else {
+    // This socket cannot pace (e.g. kernel without fq pacing); stop trying.
+    t->pacing_endpoint_extension = nullptr;
+  }
+}
+
 static void finish_bdp_ping_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
     grpc_error_handle error) {
@@ -3075,6 +3221,7 @@ static void finish_bdp_ping_locked(
   t->bdp_ping_started = false;
   grpc_core::Timestamp next_ping =
       t->flow_control.bdp_estimator()->CompletePing();
+  maybe_update_pacing_rate(t.get());
   grpc_chttp2_act_on_flowctl_action(t->flow_control.PeriodicUpdate(), t.get(),
                                     nullptr);
   CHECK(t->next_bdp_ping_timer_handle == TaskHandle::kInvalid);
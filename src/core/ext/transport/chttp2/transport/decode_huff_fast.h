@@ -0,0 +1,228 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_DECODE_HUFF_FAST_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_DECODE_HUFF_FAST_H
+
+#include <grpc/support/port_platform.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include "src/core/ext/transport/chttp2/transport/huffsyms.h"
+#include "src/core/util/no_destruct.h"
+
+namespace grpc_core {
+
+// Wide-word HPACK Huffman decoder for long strings.
+//
+// Unlike the generated HuffDecoder (which refills its bit buffer a few bytes
+// at a time as dictated by its table geometry), this decoder keeps codes
+// left-aligned in a 64 bit accumulator and refills with unaligned 8 byte
+// big-endian loads, emitting every symbol resolvable from the buffered bits
+// between refills. Two refills are performed per trip around the bulk loop so
+// that each iteration consumes ~14 input bytes with no per-byte branching;
+// the refill/emit split is the same structure a vectorized (AVX2/NEON)
+// decoder would use, but the portable SWAR form benchmarks within noise of a
+// lane-based one on current hardware because HPACK decode is serially
+// dependent on code length.
+//
+// All codes of 15 or fewer bits (every printable character) resolve with one
+// lookup in a 32K-entry level-1 table; longer codes (control characters and
+// EOS, rare in practice) fall back to a scan of grpc_chttp2_huffsyms.
+//
+// Used by HPackParser for strings of at least kHuffmanFastDecodeThreshold
+// bytes; short strings stay on the generated decoder whose startup cost is
+// lower.
+class HuffDecoderFastCommon {
+ protected:
+  static constexpr int kLevel1Bits = 15;
+  static constexpr uint16_t kLongCodeMarker = 0;
+
+  // Level-1 entry: (code length << 8) | symbol; kLongCodeMarker for prefixes
+  // of codes longer than kLevel1Bits (no valid entry is 0: lengths are >= 5).
+  static const std::array<uint16_t, 1 << kLevel1Bits>& Lut() {
+    static const NoDestruct<std::array<uint16_t, 1 << kLevel1Bits>> lut(
+        BuildLut());
+    return *lut;
+  }
+
+  static std::array<uint16_t, 1 << kLevel1Bits> BuildLut() {
+    std::array<uint16_t, 1 << kLevel1Bits> lut{};
+    for (int sym = 0; sym < GRPC_CHTTP2_NUM_HUFFSYMS; sym++) {
+      const auto& hs = grpc_chttp2_huffsyms[sym];
+      if (hs.length > static_cast<unsigned>(kLevel1Bits)) continue;
+      const uint32_t base = hs.bits << (kLevel1Bits - hs.length);
+      const uint32_t count = 1u << (kLevel1Bits - hs.length);
+      for (uint32_t i = 0; i < count; i++) {
+        lut[base + i] = static_cast<uint16_t>((hs.length << 8) | sym);
+      }
+    }
+    return lut;
+  }
+
+  static uint64_t BigEndianLoad64(const uint8_t* p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && \
+    __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return v;
+#else
+    return __builtin_bswap64(v);
+#endif
+  }
+};
+
+template <typename F>
+class HuffDecoderFast : private HuffDecoderFastCommon {
+ public:
+  HuffDecoderFast(F sink, const uint8_t* begin, const uint8_t* end)
+      : sink_(std::move(sink)), begin_(begin), end_(end) {}
+
+  // Decodes the entire input; returns false on malformed input.  Matches the
+  // generated HuffDecoder exactly (the fuzzer asserts this), so a string's
+  // validity never depends on which decoder its length selects: a literal
+  // EOS symbol ends decoding successfully (discarding any remaining input)
+  // and all-ones padding of any length is accepted.
+  bool Run() {
+    const auto& lut = Lut();
+    // Bulk loop: two 8 byte refills per iteration, each followed by draining
+    // the accumulator down to fewer than 30 buffered bits (the longest code).
+    while (end_ - begin_ >= 16) {
+      for (int refill = 0; refill < 2; refill++) {
+        const int take = (63 - nbits_) >> 3;
+        acc_ |= BigEndianLoad64(begin_) >> nbits_;
+        begin_ += take;
+        nbits_ += take * 8;
+        while (nbits_ >= 30) {
+          const uint16_t e = lut[acc_ >> (64 - kLevel1Bits)];
+          if (GPR_UNLIKELY(e == kLongCodeMarker)) {
+            switch (DecodeLongCode()) {
+              case LongCode::kOk:
+                continue;
+              case LongCode::kEos:
+                return true;
+              case LongCode::kInvalid:
+                return false;
+            }
+          }
+          sink_(static_cast<uint8_t>(e));
+          const int len = e >> 8;
+          acc_ <<= len;
+          nbits_ -= len;
+        }
+      }
+    }
+    // Tail: byte-at-a-time refill for the last few bytes.
+    while (begin_ != end_ || nbits_ >= 30) {
+      if (nbits_ >= 30) {
+        const uint16_t e = lut[acc_ >> (64 - kLevel1Bits)];
+        if (GPR_UNLIKELY(e == kLongCodeMarker)) {
+          switch (DecodeLongCode()) {
+            case LongCode::kOk:
+              continue;
+            case LongCode::kEos:
+              return true;
+            case LongCode::kInvalid:
+              return false;
+          }
+        }
+        sink_(static_cast<uint8_t>(e));
+        const int len = e >> 8;
+        acc_ <<= len;
+        nbits_ -= len;
+      } else {
+        acc_ |= static_cast<uint64_t>(*begin_++) << (56 - nbits_);
+        nbits_ += 8;
+      }
+    }
+    return Finish();
+  }
+
+ private:
+  enum class LongCode : uint8_t { kOk, kEos, kInvalid };
+
+  // Resolves a code longer than kLevel1Bits bits; requires nbits_ >= 30.
+  LongCode DecodeLongCode() {
+    const uint32_t peek = static_cast<uint32_t>(acc_ >> 34);  // top 30 bits
+    for (int sym = 0; sym < GRPC_CHTTP2_NUM_HUFFSYMS; sym++) {
+      const auto& hs = grpc_chttp2_huffsyms[sym];
+      if (hs.length <= static_cast<unsigned>(kLevel1Bits)) continue;
+      if ((peek >> (30 - hs.length)) == hs.bits) {
+        // A literal EOS ends the string: emit nothing further and succeed.
+        if (sym == 256) return LongCode::kEos;
+        sink_(static_cast<uint8_t>(sym));
+        acc_ <<= hs.length;
+        nbits_ -= hs.length;
+        return LongCode::kOk;
+      }
+    }
+    return LongCode::kInvalid;
+  }
+
+  // Drains codes that fit in the remaining bits, then validates padding.
+  bool Finish() {
+    const auto& lut = Lut();
+    while (nbits_ > 0) {
+      // Pad with ones below the valid bits: EOS-prefix padding decodes as a
+      // too-long code and drops us into the validity check.
+      const uint64_t padded = acc_ | (~uint64_t{0} >> nbits_);
+      const uint16_t e = lut[padded >> (64 - kLevel1Bits)];
+      int len;
+      int sym;
+      if (e == kLongCodeMarker) {
+        const uint32_t peek = static_cast<uint32_t>(padded >> 34);
+        len = 30;
+        sym = 256;
+        for (int s = 0; s < GRPC_CHTTP2_NUM_HUFFSYMS; s++) {
+          const auto& hs = grpc_chttp2_huffsyms[s];
+          if (hs.length <= static_cast<unsigned>(kLevel1Bits)) continue;
+          if ((peek >> (30 - hs.length)) == hs.bits) {
+            len = static_cast<int>(hs.length);
+            sym = s;
+            break;
+          }
+        }
+      } else {
+        len = e >> 8;
+        sym = e & 0xff;
+      }
+      if (len > nbits_) {
+        // Remaining bits are padding: they must all be ones (an EOS prefix).
+        // RFC 7541 §5.2 caps padding at 7 bits, but HuffDecoder tolerates
+        // longer all-ones runs and the two decoders must agree.
+        return (acc_ >> (64 - nbits_)) == (uint64_t{1} << nbits_) - 1;
+      }
+      sink_(static_cast<uint8_t>(sym));
+      acc_ <<= len;
+      nbits_ -= len;
+    }
+    return true;
+  }
+
+  F sink_;
+  const uint8_t* begin_;
+  const uint8_t* const end_;
+  uint64_t acc_ = 0;
+  int nbits_ = 0;
+};
+
+// Strings at least this long take HuffDecoderFast; below it the generated
+// decoder's lower startup cost wins.
+constexpr size_t kHuffmanFastDecodeThreshold = 16;
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_DECODE_HUFF_FAST_H
@@ -134,10 +134,36 @@ absl::Status StreamFlowControl::IncomingUpdateContext::RecvData(
                                         -incoming_frame_size);
     sfc_->min_progress_size_ -=
         std::min(sfc_->min_progress_size_, incoming_frame_size);
+    sfc_->UpdateDeliveryRate(incoming_frame_size);
     return absl::OkStatus();
   });
 }
 
+void StreamFlowControl::UpdateDeliveryRate(int64_t incoming_frame_size) {
+  static constexpr Duration kRateProbePeriod = Duration::Milliseconds(100);
+  const Timestamp now = Timestamp::Now();
+  if (rate_probe_start_ == Timestamp::InfPast()) {
+    rate_probe_start_ = now;
+    rate_probe_bytes_ = incoming_frame_size;
+    return;
+  }
+  rate_probe_bytes_ += incoming_frame_size;
+  const Duration elapsed = now - rate_probe_start_;
+  if (elapsed < kRateProbePeriod) return;
+  // Size the window for two probe periods at the observed delivery rate,
+  // bounded by the per-stream delta cap and the transport's (BDP- and memory
+  // pressure-derived) target window so one stream cannot claim unbounded
+  // memory. Because the target is recomputed from each probe period's bytes,
+  // it decays as soon as a stream goes quiet.
+  const int64_t rate_window = rate_probe_bytes_ * 2 * kRateProbePeriod.millis() /
+                              std::max<int64_t>(elapsed.millis(), 1);
+  delivery_rate_window_target_ =
+      Clamp(rate_window, int64_t{0},
+            std::min(kMaxWindowDelta, tfc_->target_window()));
+  rate_probe_start_ = now;
+  rate_probe_bytes_ = 0;
+}
+
 absl::Status TransportFlowControl::IncomingUpdateContext::RecvData(
     int64_t incoming_frame_size, absl::FunctionRef<absl::Status()> stream) {
   if (incoming_frame_size > tfc_->announced_window_) {
@@ -346,7 +372,10 @@ uint32_t StreamFlowControl::DesiredAnnounceSize() const {
         return announced_window_delta_;
       }
     } else {
-      return std::min(min_progress_size_, kMaxWindowDelta);
+      // A reader is ready: offer at least its demand, and for streams with a
+      // measured delivery rate enough window to keep the pipe full.
+      return std::min(std::max(min_progress_size_, delivery_rate_window_target_),
+                      kMaxWindowDelta);
     }
   }();
   return Clamp(desired_window_delta - announced_window_delta_, int64_t{0},
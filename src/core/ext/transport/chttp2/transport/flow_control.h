@@ -457,6 +457,12 @@ class StreamFlowControl final {
   int64_t remote_window_delta() const { return remote_window_delta_; }
   int64_t announced_window_delta() const { return announced_window_delta_; }
   int64_t min_progress_size() const { return min_progress_size_; }
+  // Window earned from the observed per-stream delivery rate: bulk streams
+  // grow their window beyond the immediate read demand, chatty streams decay
+  // back to demand-sized windows.
+  int64_t delivery_rate_window_target() const {
+    return delivery_rate_window_target_;
+  }
 
   // A snapshot of the flow control stats to export.
   struct Stats {
@@ -483,7 +489,12 @@ class StreamFlowControl final {
   int64_t remote_window_delta_ = 0;
   int64_t announced_window_delta_ = 0;
   std::optional<int64_t> pending_size_;
+  // Delivery-rate measurement for adaptive per-stream windows.
+  Timestamp rate_probe_start_ = Timestamp::InfPast();
+  int64_t rate_probe_bytes_ = 0;
+  int64_t delivery_rate_window_target_ = 0;
 
+  void UpdateDeliveryRate(int64_t incoming_frame_size);
   FlowControlAction UpdateAction(FlowControlAction action);
 };
 
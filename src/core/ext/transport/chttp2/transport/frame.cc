@@ -17,9 +17,11 @@
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "absl/status/status.h"
@@ -586,6 +588,76 @@ std::string Http2FrameHeader::ToString() const {
                       ", length=", length, "}");
 }
 
+namespace {
+// Stream id for frames whose order relative to other frames of the same
+// stream must be preserved; 0 for connection control frames whose relative
+// placement is unconstrained.
+struct SequencedStreamId {
+  uint32_t operator()(const Http2DataFrame& f) { return f.stream_id; }
+  uint32_t operator()(const Http2HeaderFrame& f) { return f.stream_id; }
+  uint32_t operator()(const Http2ContinuationFrame& f) { return f.stream_id; }
+  uint32_t operator()(const Http2RstStreamFrame& f) { return f.stream_id; }
+  template <typename T>
+  uint32_t operator()(const T&) {
+    return 0;
+  }
+};
+}  // namespace
+
+std::vector<Http2Frame> ReorderFramesForWrite(std::vector<Http2Frame> frames) {
+  // Fast path: nothing to reorder unless the batch touches several streams.
+  uint32_t seen_stream_id = 0;
+  size_t num_streams = 0;
+  for (const auto& frame : frames) {
+    const uint32_t id = std::visit(SequencedStreamId(), frame);
+    if (id == 0 || id == seen_stream_id) continue;
+    seen_stream_id = id;
+    if (++num_streams > 1) break;
+  }
+  if (num_streams <= 1) return frames;
+  // Pull out control frames (keeping their order) and split stream frames
+  // into per-stream queues (keeping per-stream order).
+  std::vector<Http2Frame> out;
+  out.reserve(frames.size());
+  std::vector<std::pair<uint32_t, std::vector<Http2Frame>>> streams;
+  for (auto& frame : frames) {
+    const uint32_t id = std::visit(SequencedStreamId(), frame);
+    if (id == 0) {
+      out.push_back(std::move(frame));
+      continue;
+    }
+    auto it = std::find_if(streams.begin(), streams.end(),
+                           [id](const auto& s) { return s.first == id; });
+    if (it == streams.end()) {
+      streams.emplace_back(id, std::vector<Http2Frame>());
+      it = streams.end() - 1;
+    }
+    it->second.push_back(std::move(frame));
+  }
+  // Round-robin one frame per stream per turn. A HEADERS frame takes its
+  // CONTINUATION frames with it: nothing may be interleaved between them.
+  std::vector<size_t> next(streams.size(), 0);
+  bool made_progress = true;
+  while (made_progress) {
+    made_progress = false;
+    for (size_t i = 0; i < streams.size(); i++) {
+      auto& queue = streams[i].second;
+      size_t& pos = next[i];
+      if (pos == queue.size()) continue;
+      made_progress = true;
+      const bool is_header = std::holds_alternative<Http2HeaderFrame>(queue[pos]);
+      out.push_back(std::move(queue[pos++]));
+      if (is_header) {
+        while (pos != queue.size() &&
+               std::holds_alternative<Http2ContinuationFrame>(queue[pos])) {
+          out.push_back(std::move(queue[pos++]));
+        }
+      }
+    }
+  }
+  return out;
+}
+
 void Serialize(absl::Span<Http2Frame> frames, SliceBuffer& out) {
   size_t buffer_needed = 0;
   for (auto& frame : frames) {
@@ -237,6 +237,15 @@ http2::ValueOrHttp2Status<Http2Frame> ParseFramePayload(
 // move things out of frames)
 void Serialize(absl::Span<Http2Frame> frames, SliceBuffer& out);
 
+// Reorder one batch of outgoing frames for writing: connection control frames
+// (SETTINGS, PING, GOAWAY, WINDOW_UPDATE, ...) are serialized first, then
+// stream frames round-robin across streams so one stream's large burst does
+// not delay every other stream in the batch. Per-stream frame order is
+// preserved (including RST_STREAM relative to that stream's frames), and a
+// HEADERS frame stays contiguous with its CONTINUATION frames as RFC 9113
+// requires. Batches touching at most one stream are returned unchanged.
+std::vector<Http2Frame> ReorderFramesForWrite(std::vector<Http2Frame> frames);
+
 http2::Http2ErrorCode Http2ErrorCodeFromRstFrameErrorCode(uint32_t error_code);
 
 ///////////////////////////////////////////////////////////////////////////////
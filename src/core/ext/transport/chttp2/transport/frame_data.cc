@@ -57,12 +57,12 @@ void grpc_chttp2_encode_data(uint32_t id, grpc_slice_buffer* inbuf,
                              grpc_core::CallTracerInterface* call_tracer,
                              grpc_core::Http2ZTraceCollector* ztrace_collector,
                              grpc_slice_buffer* outbuf) {
-  grpc_slice hdr;
-  uint8_t* p;
   static const size_t header_size = 9;
 
-  hdr = GRPC_SLICE_MALLOC(header_size);
-  p = GRPC_SLICE_START_PTR(hdr);
+  // Write the frame header into outbuf's inline tail storage (no allocation,
+  // no extra slice entry); payload slices below are moved by reference so
+  // message bytes reach endpoint_write without being copied.
+  uint8_t* p = grpc_slice_buffer_tiny_add(outbuf, header_size);
   CHECK(write_bytes < (1 << 24));
   *p++ = static_cast<uint8_t>(write_bytes >> 16);
   *p++ = static_cast<uint8_t>(write_bytes >> 8);
@@ -73,7 +73,6 @@ void grpc_chttp2_encode_data(uint32_t id, grpc_slice_buffer* inbuf,
   *p++ = static_cast<uint8_t>(id >> 16);
   *p++ = static_cast<uint8_t>(id >> 8);
   *p++ = static_cast<uint8_t>(id);
-  grpc_slice_buffer_add(outbuf, hdr);
 
   ztrace_collector->Append(
       grpc_core::H2DataTrace<false>{id, is_eof != 0, write_bytes});
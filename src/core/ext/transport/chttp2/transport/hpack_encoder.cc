@@ -24,7 +24,9 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 
+#include "absl/hash/hash.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
@@ -246,9 +248,47 @@ class StringKey {
 }  // namespace
 
 namespace hpack_encoder_detail {
+void Encoder::ReserveBatch(size_t size_hint) {
+  if (size_hint == 0) return;
+  batch_ = MutableSlice::CreateUninitialized(size_hint);
+  batch_used_ = 0;
+  batch_active_ = true;
+}
+
+void Encoder::FinishBatch() { FlushBatch(); }
+
+void Encoder::FlushBatch() {
+  if (!batch_active_) return;
+  batch_active_ = false;
+  if (batch_used_ != 0) {
+    output_.Append(Slice(batch_.TakeFirst(batch_used_).TakeCSlice()));
+  }
+  batch_ = MutableSlice();
+}
+
+uint8_t* Encoder::AddBytes(size_t n) {
+  if (batch_active_ && n <= batch_.length() - batch_used_) {
+    uint8_t* out = batch_.data() + batch_used_;
+    batch_used_ += n;
+    return out;
+  }
+  FlushBatch();
+  return output_.AddTiny(n);
+}
+
+void Encoder::AppendSlice(Slice slice) {
+  if (batch_active_ && slice.length() <= batch_.length() - batch_used_) {
+    memcpy(batch_.data() + batch_used_, slice.data(), slice.length());
+    batch_used_ += slice.length();
+    return;
+  }
+  FlushBatch();
+  output_.Append(std::move(slice));
+}
+
 void Encoder::EmitIndexed(uint32_t elem_index) {
   VarintWriter<1> w(elem_index);
-  w.Write(0x80, output_.AddTiny(w.length()));
+  w.Write(0x80, AddBytes(w.length()));
 }
 
 uint32_t Encoder::EmitLitHdrWithNonBinaryStringKeyIncIdx(Slice key_slice,
@@ -256,41 +296,41 @@ uint32_t Encoder::EmitLitHdrWithNonBinaryStringKeyIncIdx(Slice key_slice,
   auto key_len = key_slice.length();
   auto value_len = value_slice.length();
   StringKey key(std::move(key_slice));
-  key.WritePrefix(0x40, output_.AddTiny(key.prefix_length()));
-  output_.Append(key.key());
+  key.WritePrefix(0x40, AddBytes(key.prefix_length()));
+  AppendSlice(key.key());
   NonBinaryStringValue emit(std::move(value_slice));
-  emit.WritePrefix(output_.AddTiny(emit.prefix_length()));
+  emit.WritePrefix(AddBytes(emit.prefix_length()));
   // Allocate an index in the hpack table for this newly emitted entry.
   // (we do so here because we know the length of the key and value)
   uint32_t index = compressor_->table_.AllocateIndex(
       key_len + value_len + hpack_constants::kEntryOverhead);
-  output_.Append(emit.data());
+  AppendSlice(emit.data());
   return index;
 }
 
 void Encoder::EmitLitHdrWithBinaryStringKeyNotIdx(Slice key_slice,
                                                   Slice value_slice) {
   StringKey key(std::move(key_slice));
-  key.WritePrefix(0x00, output_.AddTiny(key.prefix_length()));
-  output_.Append(key.key());
+  key.WritePrefix(0x00, AddBytes(key.prefix_length()));
+  AppendSlice(key.key());
   BinaryStringValue emit(std::move(value_slice), use_true_binary_metadata_);
-  emit.WritePrefix(output_.AddTiny(emit.prefix_length()));
-  output_.Append(emit.data());
+  emit.WritePrefix(AddBytes(emit.prefix_length()));
+  AppendSlice(emit.data());
 }
 
 uint32_t Encoder::EmitLitHdrWithBinaryStringKeyIncIdx(Slice key_slice,
                                                       Slice value_slice) {
   auto key_len = key_slice.length();
   StringKey key(std::move(key_slice));
-  key.WritePrefix(0x40, output_.AddTiny(key.prefix_length()));
-  output_.Append(key.key());
+  key.WritePrefix(0x40, AddBytes(key.prefix_length()));
+  AppendSlice(key.key());
   BinaryStringValue emit(std::move(value_slice), use_true_binary_metadata_);
-  emit.WritePrefix(output_.AddTiny(emit.prefix_length()));
+  emit.WritePrefix(AddBytes(emit.prefix_length()));
   // Allocate an index in the hpack table for this newly emitted entry.
   // (we do so here because we know the length of the key and value)
   uint32_t index = compressor_->table_.AllocateIndex(
       key_len + emit.hpack_length() + hpack_constants::kEntryOverhead);
-  output_.Append(emit.data());
+  AppendSlice(emit.data());
   return index;
 }
 
@@ -298,25 +338,25 @@ void Encoder::EmitLitHdrWithBinaryStringKeyNotIdx(uint32_t key_index,
                                                   Slice value_slice) {
   BinaryStringValue emit(std::move(value_slice), use_true_binary_metadata_);
   VarintWriter<4> key(key_index);
-  uint8_t* data = output_.AddTiny(key.length() + emit.prefix_length());
+  uint8_t* data = AddBytes(key.length() + emit.prefix_length());
   key.Write(0x00, data);
   emit.WritePrefix(data + key.length());
-  output_.Append(emit.data());
+  AppendSlice(emit.data());
 }
 
 void Encoder::EmitLitHdrWithNonBinaryStringKeyNotIdx(Slice key_slice,
                                                      Slice value_slice) {
   StringKey key(std::move(key_slice));
-  key.WritePrefix(0x00, output_.AddTiny(key.prefix_length()));
-  output_.Append(key.key());
+  key.WritePrefix(0x00, AddBytes(key.prefix_length()));
+  AppendSlice(key.key());
   NonBinaryStringValue emit(std::move(value_slice));
-  emit.WritePrefix(output_.AddTiny(emit.prefix_length()));
-  output_.Append(emit.data());
+  emit.WritePrefix(AddBytes(emit.prefix_length()));
+  AppendSlice(emit.data());
 }
 
 void Encoder::AdvertiseTableSizeChange() {
   VarintWriter<3> w(compressor_->table_.max_size());
-  w.Write(0x20, output_.AddTiny(w.length()));
+  w.Write(0x20, AddBytes(w.length()));
 }
 
 void SliceIndex::EmitTo(absl::string_view key, const Slice& value,
@@ -363,11 +403,45 @@ void SliceIndex::EmitTo(absl::string_view key, const Slice& value,
   values_.emplace_back(value.Ref(), index);
 }
 
+void KeyValueIndex::EmitTo(const Slice& key, const Slice& value,
+                           Encoder* encoder) {
+  auto& table = encoder->hpack_table();
+  const size_t transport_length =
+      key.length() + value.length() + hpack_constants::kEntryOverhead;
+  if (transport_length > HPackEncoderTable::MaxEntrySize()) {
+    encoder->EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+    return;
+  }
+  const size_t first_slot =
+      absl::HashOf(key.as_string_view(), value.as_string_view());
+  Entry* insert_at = nullptr;
+  for (size_t probe = 0; probe < kMaxProbes; ++probe) {
+    Entry& entry = slots_[(first_slot + probe) & (kSlots - 1)];
+    if (entry.index == 0 || !table.ConvertibleToDynamicIndex(entry.index)) {
+      // Empty, or the remote table evicted it: reusable slot.
+      if (insert_at == nullptr) insert_at = &entry;
+      continue;
+    }
+    if (entry.key == key && entry.value == value) {
+      encoder->EmitIndexed(table.DynamicIndex(entry.index));
+      return;
+    }
+  }
+  // Not indexed: emit a literal, add it to the remote table, and record the
+  // index. If every probed slot holds a live entry, steal the home slot so a
+  // newly repetitive header can still establish itself.
+  if (insert_at == nullptr) insert_at = &slots_[first_slot & (kSlots - 1)];
+  insert_at->index =
+      encoder->EmitLitHdrWithNonBinaryStringKeyIncIdx(key.Ref(), value.Ref());
+  insert_at->key = key.Ref();
+  insert_at->value = value.Ref();
+}
+
 void Encoder::Encode(const Slice& key, const Slice& value) {
   if (absl::EndsWith(key.as_string_view(), "-bin")) {
     EmitLitHdrWithBinaryStringKeyNotIdx(key.Ref(), value.Ref());
   } else {
-    EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+    compressor_->unknown_element_index_.EmitTo(key, value, this);
   }
 }
 
@@ -85,13 +85,32 @@ class Encoder {
   void NoteEncodingError() { saw_encoding_errors_ = true; }
   bool saw_encoding_errors() const { return saw_encoding_errors_; }
 
+  // Batched emission: reserve one contiguous output region sized from the
+  // header set's TransportSize so that an entire header block is written with
+  // a single allocation and no per-element slice bookkeeping. Emission falls
+  // back to per-element appends if an element outgrows the reservation (only
+  // possible for large base64-expanded binary headers).
+  void ReserveBatch(size_t size_hint);
+  void FinishBatch();
+
   HPackEncoderTable& hpack_table();
 
  private:
+  // Returns a contiguous n-byte write target: inside the batch reservation
+  // when active, in output_ otherwise. n must be tiny (prefix sized).
+  uint8_t* AddBytes(size_t n);
+  // Appends slice contents: copied into the batch reservation when they fit,
+  // appended as a slice otherwise.
+  void AppendSlice(Slice slice);
+  void FlushBatch();
+
   const bool use_true_binary_metadata_;
   bool saw_encoding_errors_ = false;
+  bool batch_active_ = false;
   HPackCompressor* const compressor_;
   SliceBuffer& output_;
+  MutableSlice batch_;
+  size_t batch_used_ = 0;
 };
 
 // Compressor is partially specialized on CompressionTraits, but leaves
@@ -266,6 +285,27 @@ class SliceIndex {
   std::vector<ValueIndex> values_;
 };
 
+// Open-addressing index over (key, value) pairs for headers with no dedicated
+// compressor. One probe window in a contiguous table (no per-entry heap
+// nodes), so a repetitive custom header resolves to EmitIndexed after a
+// handful of comparisons instead of being re-sent as a full literal.
+class KeyValueIndex {
+ public:
+  void EmitTo(const Slice& key, const Slice& value, Encoder* encoder);
+
+ private:
+  struct Entry {
+    Slice key;
+    Slice value;
+    // Index returned by HPackEncoderTable::AllocateIndex; 0 means empty.
+    uint32_t index = 0;
+  };
+  // Must be a power of two.
+  static constexpr size_t kSlots = 64;
+  static constexpr size_t kMaxProbes = 4;
+  std::vector<Entry> slots_{kSlots};
+};
+
 template <typename MetadataTrait>
 class Compressor<MetadataTrait, SmallSetOfValuesCompressor> {
  public:
@@ -363,7 +403,9 @@ class HPackCompressor {
     SliceBuffer raw;
     hpack_encoder_detail::Encoder encoder(
         this, options.use_true_binary_metadata, raw);
+    encoder.ReserveBatch(headers.TransportSize());
     headers.Encode(&encoder);
+    encoder.FinishBatch();
     Frame(options, raw, output);
     return !encoder.saw_encoding_errors();
   }
@@ -390,6 +432,8 @@ class HPackCompressor {
   // of this size
   bool advertise_table_size_change_ = false;
   HPackEncoderTable table_;
+  // Index for headers with no dedicated compressor (custom metadata).
+  hpack_encoder_detail::KeyValueIndex unknown_element_index_;
 
   grpc_metadata_batch::StatefulCompressor<hpack_encoder_detail::Compressor>
       compression_state_;
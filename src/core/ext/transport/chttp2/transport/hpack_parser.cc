@@ -41,10 +41,12 @@
 #include "src/core/call/metadata_info.h"
 #include "src/core/call/parsed_metadata.h"
 #include "src/core/ext/transport/chttp2/transport/decode_huff.h"
+#include "src/core/ext/transport/chttp2/transport/decode_huff_fast.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parse_result.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser_table.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_refcount.h"
 #include "src/core/lib/surface/validate_metadata.h"
@@ -362,9 +364,12 @@ HpackParseStatus HPackParser::String::ParseHuff(Input* input, uint32_t length,
   // Grab the byte range, and iterate through it.
   const uint8_t* p = input->cur_ptr();
   input->Advance(length);
-  return HuffDecoder<Out>(output, p, p + length).Run()
-             ? HpackParseStatus::kOk
-             : HpackParseStatus::kParseHuffFailed;
+  // Long strings amortize the wide-word decoder's setup cost; short ones are
+  // better served by the generated table-driven decoder.
+  const bool ok = length >= kHuffmanFastDecodeThreshold
+                      ? HuffDecoderFast<Out>(output, p, p + length).Run()
+                      : HuffDecoder<Out>(output, p, p + length).Run();
+  return ok ? HpackParseStatus::kOk : HpackParseStatus::kParseHuffFailed;
 }
 
 struct HPackParser::String::StringResult {
@@ -1109,6 +1114,10 @@ void HPackParser::BeginFrame(grpc_metadata_batch* metadata_buffer,
 grpc_error_handle HPackParser::Parse(
     const grpc_slice& slice, bool is_last, absl::BitGenRef bitsrc,
     CallTracerAnnotationInterface* call_tracer) {
+  // Arena allocations made while parsing (interned metadata values and
+  // parsed metadata batch entries) are attributed to metadata.
+  ArenaAllocAccounting::Scope accounting(
+      ArenaAllocAccounting::Consumer::kMetadata);
   if (GPR_UNLIKELY(!unparsed_bytes_.empty())) {
     unparsed_bytes_.insert(unparsed_bytes_.end(), GRPC_SLICE_START_PTR(slice),
                            GRPC_SLICE_END_PTR(slice));
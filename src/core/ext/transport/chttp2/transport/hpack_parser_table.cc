@@ -42,11 +42,11 @@ namespace grpc_core {
 
 void HPackTable::MementoRingBuffer::Put(Memento m) {
   CHECK_LT(num_entries_, max_entries_);
-  if (entries_.size() < max_entries_) {
+  if (entries_.size() <= capacity_mask_) {
     ++num_entries_;
     return entries_.push_back(std::move(m));
   }
-  size_t index = (first_entry_ + num_entries_) % max_entries_;
+  size_t index = PhysIndex(first_entry_ + num_entries_);
   if (timestamp_index_ == kNoTimestamp) {
     timestamp_index_ = index;
     timestamp_ = Timestamp::Now();
@@ -57,7 +57,7 @@ void HPackTable::MementoRingBuffer::Put(Memento m) {
 
 auto HPackTable::MementoRingBuffer::PopOne() -> Memento {
   CHECK_GT(num_entries_, 0u);
-  size_t index = first_entry_ % max_entries_;
+  size_t index = PhysIndex(first_entry_);
   if (index == timestamp_index_) {
     http2_stats_collector_->IncrementHttp2HpackEntryLifetime(
         (Timestamp::Now() - timestamp_).millis());
@@ -74,7 +74,7 @@ auto HPackTable::MementoRingBuffer::PopOne() -> Memento {
 
 auto HPackTable::MementoRingBuffer::Lookup(uint32_t index) -> const Memento* {
   if (index >= num_entries_) return nullptr;
-  uint32_t offset = (num_entries_ - 1u - index + first_entry_) % max_entries_;
+  uint32_t offset = PhysIndex(num_entries_ - 1u - index + first_entry_);
   auto& entry = entries_[offset];
   const bool was_used = entry.parse_status.TestBit(Memento::kUsedBit);
   entry.parse_status.SetBit(Memento::kUsedBit);
@@ -85,7 +85,7 @@ auto HPackTable::MementoRingBuffer::Lookup(uint32_t index) -> const Memento* {
 auto HPackTable::MementoRingBuffer::Peek(uint32_t index) const
     -> const Memento* {
   if (index >= num_entries_) return nullptr;
-  uint32_t offset = (num_entries_ - 1u - index + first_entry_) % max_entries_;
+  uint32_t offset = PhysIndex(num_entries_ - 1u - index + first_entry_);
   return &entries_[offset];
 }
 
@@ -95,10 +95,10 @@ void HPackTable::MementoRingBuffer::Rebuild(uint32_t max_entries) {
   std::vector<Memento> entries;
   entries.reserve(num_entries_);
   for (size_t i = 0; i < num_entries_; i++) {
-    entries.push_back(
-        std::move(entries_[(first_entry_ + i) % entries_.size()]));
+    entries.push_back(std::move(entries_[PhysIndex(first_entry_ + i)]));
   }
   first_entry_ = 0;
+  capacity_mask_ = RoundUpToPowerOf2(std::max(max_entries, 1u)) - 1;
   entries_.swap(entries);
 }
 
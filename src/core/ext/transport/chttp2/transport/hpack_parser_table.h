@@ -36,6 +36,7 @@
 #include "src/core/ext/transport/chttp2/transport/http2_stats_collector.h"
 #include "src/core/util/no_destruct.h"
 #include "src/core/util/unique_ptr_with_bitset.h"
+#include "src/core/util/useful.h"
 
 namespace grpc_core {
 
@@ -140,14 +141,25 @@ class HPackTable {
     uint32_t num_entries() const { return num_entries_; }
 
    private:
-    // The index of the first entry in the buffer. May be greater than
-    // max_entries_, in which case a wraparound has occurred.
+    // Physical ring position for a logical position (first_entry_ + i).
+    // Capacity is kept a power of two so this is a single AND on the lookup
+    // hot path instead of a division.
+    uint32_t PhysIndex(uint32_t logical) const {
+      return logical & capacity_mask_;
+    }
+
+    // The index of the first entry in the buffer. May be greater than the
+    // ring capacity, in which case a wraparound has occurred.
     uint32_t first_entry_ = 0;
     // How many entries are in the table.
     uint32_t num_entries_ = 0;
     // Maximum number of entries we could possibly fit in the table, given
     // defined overheads.
     uint32_t max_entries_ = hpack_constants::kInitialTableEntries;
+    // Ring capacity minus one; capacity is max_entries_ rounded up to a
+    // power of two.
+    uint32_t capacity_mask_ =
+        RoundUpToPowerOf2(hpack_constants::kInitialTableEntries) - 1;
     // Which index holds a timestamp (or kNoTimestamp if none do).
     static constexpr uint32_t kNoTimestamp =
         std::numeric_limits<uint32_t>::max();
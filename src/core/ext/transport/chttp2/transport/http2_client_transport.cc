@@ -591,6 +591,9 @@ auto Http2ClientTransport::WriteFromQueue() {
               GRPC_CHTTP2_CLIENT_CONNECT_STRING)));
           self->is_first_write_ = false;
         }
+        // Control frames jump ahead of stream frames and streams round-robin
+        // within the batch so one stream's burst cannot monopolize the write.
+        frames = ReorderFramesForWrite(std::move(frames));
         Serialize(absl::Span<Http2Frame>(frames), output_buf);
         uint64_t buffer_length = output_buf.Length();
         GRPC_HTTP2_CLIENT_DLOG << "Http2ClientTransport WriteFromQueue Promise";
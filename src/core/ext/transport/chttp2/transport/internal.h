@@ -61,6 +61,7 @@
 #include "src/core/ext/transport/chttp2/transport/write_size_policy.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/extensions/pacing.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/combiner.h"
 #include "src/core/lib/iomgr/endpoint.h"
@@ -82,6 +83,7 @@
 #include "src/core/util/debug_location.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/structured_event_log.h"
 #include "src/core/util/time.h"
 
 // Flag that this closure barrier may be covering a write in a pollset, and so
@@ -298,6 +300,16 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
   grpc_core::TransportFramingEndpointExtension*
       transport_framing_endpoint_extension = nullptr;
 
+  // When BDP-driven write pacing is enabled and the endpoint supports
+  // pacing, each completed BDP ping feeds the bandwidth estimate here so
+  // the kernel spreads transmissions instead of bursting at line rate.
+  // Cleared if the endpoint rejects a rate.
+  grpc_event_engine::experimental::EndpointPacingExtension*
+      pacing_endpoint_extension = nullptr;
+  // Last pacing rate handed to the endpoint; used to skip setsockopt
+  // traffic when the estimate has not moved materially.
+  uint64_t applied_max_pacing_rate = 0;
+
   grpc_core::MemoryOwner memory_owner;
   const grpc_core::MemoryAllocator::Reservation self_reservation;
   grpc_core::ReclamationSweep active_reclamation;
@@ -324,6 +336,12 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
 
   /// maps stream id to grpc_chttp2_stream objects
   absl::flat_hash_map<uint32_t, grpc_chttp2_stream*> stream_map;
+  /// one entry cache over stream_map for the per-frame lookup while parsing:
+  /// frames for one stream commonly arrive back to back (HEADERS then DATA,
+  /// multi-frame messages), so most lookups hit here without hashing.
+  /// Invalidated when the cached stream is removed from stream_map.
+  uint32_t last_parsed_stream_id = 0;
+  grpc_chttp2_stream* last_parsed_stream = nullptr;
   // Count of streams that should be counted against max concurrent streams but
   // are not in stream_map (due to tarpitting).
   size_t extra_streams = 0;
@@ -530,6 +548,12 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
   grpc_event_engine::experimental::EventEngine::TaskHandle
       keepalive_ping_timeout_handle =
           grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
+  /// single timer covering ping ack timeouts: armed for the earliest deadline
+  /// recorded in ping_callbacks and lazily re-armed when it fires, so acking
+  /// a ping never cancels an EventEngine timer
+  grpc_event_engine::experimental::EventEngine::TaskHandle
+      ping_timeout_timer_handle =
+          grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
   /// grace period before settings timeout expires
   grpc_core::Duration settings_timeout;
 
@@ -539,6 +563,28 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
   /// write execution state of the transport
   grpc_chttp2_write_state write_state = GRPC_CHTTP2_WRITE_STATE_IDLE;
 
+  /// if non-zero, writes initiated purely to flush outgoing messages are held
+  /// back for up to this long - or until a BDP-derived byte threshold is
+  /// reached - so that many small DATA frames coalesce into one endpoint
+  /// write (GRPC_ARG_HTTP2_WRITE_COALESCE_MICROS)
+  grpc_core::Duration write_coalesce_delay = grpc_core::Duration::Zero();
+  /// if non-zero, writes initiated purely to send flow control updates
+  /// (WINDOW_UPDATE and locally originated SETTINGS) are held back for up to
+  /// this long so the updates ride along with the next DATA/HEADERS write
+  /// (GRPC_ARG_HTTP2_WINDOW_UPDATE_COALESCE_MICROS)
+  grpc_core::Duration window_update_coalesce_delay = grpc_core::Duration::Zero();
+  /// bytes queued by send_message since the last write began; compared
+  /// against the flow control target frame size to decide whether a held
+  /// write should flush early
+  size_t write_coalesce_pending_bytes = 0;
+  /// true while the coalesce timer is flushing a held write (disables
+  /// further deferral for that initiate)
+  bool write_coalesce_flushing = false;
+  grpc_event_engine::experimental::EventEngine::TaskHandle
+      write_coalesce_timer_handle =
+          grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
+  grpc_closure write_coalesce_flush_locked;
+
   /// policy for how much data we're willing to put into one http2 write
   grpc_core::Chttp2WriteSizePolicy write_size_policy;
 
@@ -766,6 +812,31 @@ struct grpc_chttp2_stream {
 void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
                                 grpc_chttp2_initiate_write_reason reason);
 
+/// Fixed-layout record for the transport's hottest events (write initiation,
+/// endpoint writes, reads). Captured into grpc_chttp2_hot_event_log() with
+/// zero allocation - unlike the tracer macros, which format a string per
+/// event, this can be left enabled in production.
+struct grpc_chttp2_hot_event {
+  enum class Kind : uint8_t {
+    kInitiateWrite,
+    kBeginEndpointWrite,
+    kEndWrite,
+    kRead,
+  };
+  Kind kind;
+  /// grpc_chttp2_initiate_write_reason for kInitiateWrite, 0 otherwise.
+  uint8_t reason;
+  /// Bytes written/read where applicable, 0 otherwise.
+  int64_t byte_count;
+  /// Disambiguates transports sharing the process-wide log.
+  uintptr_t transport;
+};
+
+/// Process-wide capture ring for grpc_chttp2_hot_event; disabled (and nearly
+/// free) by default, enabled via StructuredEventLog::Enable().
+grpc_core::StructuredEventLog<grpc_chttp2_hot_event>&
+grpc_chttp2_hot_event_log();
+
 struct TcpCallTracerWithOffset {
   std::shared_ptr<grpc_core::TcpCallTracer> tcp_call_tracer;
   size_t byte_offset;
@@ -805,8 +876,13 @@ void grpc_chttp2_act_on_flowctl_action(
 
 inline grpc_chttp2_stream* grpc_chttp2_parsing_lookup_stream(
     grpc_chttp2_transport* t, uint32_t id) {
+  if (t->last_parsed_stream != nullptr && t->last_parsed_stream_id == id) {
+    return t->last_parsed_stream;
+  }
   auto it = t->stream_map.find(id);
   if (it == t->stream_map.end()) return nullptr;
+  t->last_parsed_stream_id = id;
+  t->last_parsed_stream = it->second;
   return it->second;
 }
 grpc_chttp2_stream* grpc_chttp2_parsing_accept_stream(grpc_chttp2_transport* t,
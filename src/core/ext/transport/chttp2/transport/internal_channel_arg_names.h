@@ -20,5 +20,16 @@
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_INTERNAL_CHANNEL_ARG_NAMES_H
 
 #define GRPC_ARG_PING_TIMEOUT_MS "grpc.http2.ping_timeout_ms"
+// Maximum time (in microseconds) a write initiated purely to flush outgoing
+// messages may be held back waiting for more data to coalesce. 0 (the
+// default) disables write coalescing.
+#define GRPC_ARG_HTTP2_WRITE_COALESCE_MICROS \
+  "grpc.http2.write_coalesce_micros"
+// Maximum time (in microseconds) a write initiated purely to send flow
+// control updates (WINDOW_UPDATE, locally originated SETTINGS) may be held
+// back so the updates piggyback on the next DATA/HEADERS write. 0 (the
+// default) sends them immediately.
+#define GRPC_ARG_HTTP2_WINDOW_UPDATE_COALESCE_MICROS \
+  "grpc.http2.window_update_coalesce_micros"
 
 #endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_INTERNAL_CHANNEL_ARG_NAMES_H
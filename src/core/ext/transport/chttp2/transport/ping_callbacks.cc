@@ -16,6 +16,7 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <algorithm>
 #include <utility>
 
 #include "absl/log/check.h"
@@ -102,4 +103,22 @@ std::optional<uint64_t> Chttp2PingCallbacks::OnPingTimeout(
   return most_recent_inflight_;
 }
 
+std::optional<uint64_t> Chttp2PingCallbacks::OnPingTimeoutDeadline(
+    Timestamp deadline) {
+  CHECK(started_new_ping_without_setting_timeout_);
+  started_new_ping_without_setting_timeout_ = false;
+  auto it = inflight_.find(most_recent_inflight_);
+  if (it == inflight_.end()) return std::nullopt;
+  it->second.timeout_deadline = deadline;
+  return most_recent_inflight_;
+}
+
+Timestamp Chttp2PingCallbacks::earliest_timeout_deadline() const {
+  Timestamp earliest = Timestamp::InfFuture();
+  for (const auto& [id, ping] : inflight_) {
+    earliest = std::min(earliest, ping.timeout_deadline);
+  }
+  return earliest;
+}
+
 }  // namespace grpc_core
@@ -91,6 +91,20 @@ class Chttp2PingCallbacks {
       grpc_event_engine::experimental::EventEngine* event_engine,
       Callback callback);
 
+  // Record a ping timeout deadline for the most recently started ping.
+  // started_new_ping_without_setting_timeout must be set.
+  // Clears started_new_ping_without_setting_timeout.
+  // Unlike OnPingTimeout no timer is created: the caller owns a single
+  // timeout timer armed from earliest_timeout_deadline(), so acking a ping
+  // never needs to cancel an EventEngine timer.
+  // Returns the ping id of the ping the deadline was attached to if one was
+  // recorded, or nullopt otherwise.
+  std::optional<uint64_t> OnPingTimeoutDeadline(Timestamp deadline);
+
+  // The earliest deadline recorded by OnPingTimeoutDeadline amongst pings
+  // still inflight, or InfFuture if there are none.
+  Timestamp earliest_timeout_deadline() const;
+
   channelz::PropertyList ChannelzProperties() const {
     return channelz::PropertyList()
         .Set("ping_requested", ping_requested_)
@@ -101,7 +115,9 @@ class Chttp2PingCallbacks {
              [this]() {
                channelz::PropertyTable inflight;
                for (const auto& [id, ping] : inflight_) {
-                 inflight.AppendRow(channelz::PropertyList().Set("id", id));
+                 inflight.AppendRow(
+                     channelz::PropertyList().Set("id", id).Set(
+                         "timeout_deadline", ping.timeout_deadline));
                }
                return inflight;
              }())
@@ -114,6 +130,7 @@ class Chttp2PingCallbacks {
   struct InflightPing {
     grpc_event_engine::experimental::EventEngine::TaskHandle on_timeout =
         grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
+    Timestamp timeout_deadline = Timestamp::InfFuture();
     CallbackVec on_ack;
   };
   absl::flat_hash_map<uint64_t, InflightPing> inflight_;
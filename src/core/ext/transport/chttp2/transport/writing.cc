@@ -780,18 +780,27 @@ void grpc_chttp2_end_write(grpc_chttp2_transport* t, grpc_error_handle error) {
   if (t->ping_callbacks.started_new_ping_without_setting_timeout() &&
       t->keepalive_timeout != grpc_core::Duration::Infinity()) {
     // Set ping timeout after finishing write so we don't measure our own send
-    // time.
+    // time. Only the deadline is recorded here: one timer covers all inflight
+    // pings, armed below if it's not already running, and lazily re-armed by
+    // grpc_chttp2_ping_timeout, so ping acks never touch a timer.
     const auto timeout = t->ping_timeout;
-    auto id = t->ping_callbacks.OnPingTimeout(timeout, t->event_engine.get(),
-                                              [t = t->Ref()] {
-                                                grpc_core::ExecCtx exec_ctx;
-                                                grpc_chttp2_ping_timeout(t);
-                                              });
+    auto id = t->ping_callbacks.OnPingTimeoutDeadline(
+        grpc_core::Timestamp::Now() + timeout);
     if (GRPC_TRACE_FLAG_ENABLED(http2_ping) && id.has_value()) {
       LOG(INFO) << (t->is_client ? "CLIENT" : "SERVER") << "[" << t
-                << "]: Set ping timeout timer of " << timeout.ToString()
+                << "]: Set ping timeout of " << timeout.ToString()
                 << " for ping id " << id.value();
     }
+    if (id.has_value() &&
+        t->ping_timeout_timer_handle ==
+            grpc_event_engine::experimental::EventEngine::TaskHandle::
+                kInvalid) {
+      t->ping_timeout_timer_handle =
+          t->event_engine->RunAfter(timeout, [t = t->Ref()] {
+            grpc_core::ExecCtx exec_ctx;
+            grpc_chttp2_ping_timeout(t);
+          });
+    }
 
     if (t->keepalive_incoming_data_wanted &&
         t->keepalive_timeout < t->ping_timeout &&
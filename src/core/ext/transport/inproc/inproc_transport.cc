@@ -115,6 +115,11 @@ class InprocServerTransport final : public ServerTransport {
       case ConnectionState::kReady:
         break;
     }
+    // The client's parsed metadata handle is moved into the server call:
+    // nothing on this path copies metadata batches or message payloads.
+    // The server call does need its own arena (rather than adopting the
+    // client call's): the client and server filter stacks both claim the
+    // same per-call context slots (call tracers, security context, ...).
     auto arena = call_arena_allocator_->MakeArena();
     arena->SetContext<grpc_event_engine::experimental::EventEngine>(
         event_engine_.get());
@@ -196,6 +201,9 @@ class InprocClientTransport final : public ClientTransport {
                  if (!server_call_initiator.ok()) {
                    return server_call_initiator.status();
                  }
+                 // ForwardCall moves message and metadata handles between
+                 // the two call spines - the inproc boundary is handle
+                 // passing only, never serialization or slice copies.
                  ForwardCall(
                      child_call_handler, std::move(*server_call_initiator),
                      [connected_state =
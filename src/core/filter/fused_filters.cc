@@ -56,6 +56,15 @@ using FusedClientSubchannelMinimalHttp2StackFilterExtendedV3 = FusedFilter<
     ClientAuthorityFilter, ClientAuthFilter, ClientLoadReportingFilter,
     ClientMessageSizeFilter, HttpClientFilter, ClientCompressionFilter>;
 
+// Secure channels without grpclb load reporting - the common case for a
+// credentials-bearing channel - otherwise leave the auth filters unfused.
+using FusedClientSubchannelSecureMinimalHttp2StackFilter = FusedFilter<
+    FilterEndpoint::kClient,
+    kFilterExaminesServerInitialMetadata | kFilterExaminesInboundMessages |
+        kFilterExaminesOutboundMessages,
+    ClientAuthorityFilter, ClientAuthFilter, ClientMessageSizeFilter,
+    HttpClientFilter, ClientCompressionFilter>;
+
 using FusedClientDirectChannelMinimalHttp2StackFilter = FusedFilter<
     FilterEndpoint::kClient,
     kFilterExaminesServerInitialMetadata | kFilterExaminesInboundMessages |
@@ -77,6 +86,14 @@ using FusedClientDirectChannelMinimalHttp2StackFilterExtendedV3 = FusedFilter<
     ClientAuthorityFilter, ClientAuthFilter, ServiceConfigChannelArgFilter,
     ClientMessageSizeFilter, HttpClientFilter, ClientCompressionFilter>;
 
+// As above: secure direct channels that carry no service config channel arg.
+using FusedClientDirectChannelSecureMinimalHttp2StackFilter = FusedFilter<
+    FilterEndpoint::kClient,
+    kFilterExaminesServerInitialMetadata | kFilterExaminesInboundMessages |
+        kFilterExaminesOutboundMessages,
+    ClientAuthorityFilter, ClientAuthFilter, ClientMessageSizeFilter,
+    HttpClientFilter, ClientCompressionFilter>;
+
 using FusedServerChannelMinimalHttp2StackFilter =
     FusedFilter<FilterEndpoint::kServer,
                 kFilterExaminesServerInitialMetadata |
@@ -93,6 +110,16 @@ using FusedMessageSizeHttpServerCompressionAuthFilter =
                 ServerMessageSizeFilter, HttpServerFilter,
                 ServerCompressionFilter, ServerAuthFilter>;
 
+// Secure servers with no authorization policy installed.
+using FusedMessageSizeHttpServerCompressionAuthCallTracerFilter =
+    FusedFilter<FilterEndpoint::kServer,
+                kFilterExaminesServerInitialMetadata |
+                    kFilterExaminesOutboundMessages |
+                    kFilterExaminesInboundMessages,
+                ServerMessageSizeFilter, HttpServerFilter,
+                ServerCompressionFilter, ServerAuthFilter,
+                ServerCallTracerFilter>;
+
 using FusedMessageSizeHttpServerCompressionAuthServerAuthzCallTracerFilter =
     FusedFilter<
         FilterEndpoint::kServer,
@@ -119,6 +146,9 @@ void RegisterFusedFilters(CoreConfiguration::Builder* builder) {
   builder->channel_init()->RegisterFusedFilter(
       GRPC_CLIENT_SUBCHANNEL,
       &FusedClientSubchannelMinimalHttp2StackFilterExtended::kFilter);
+  builder->channel_init()->RegisterFusedFilter(
+      GRPC_CLIENT_SUBCHANNEL,
+      &FusedClientSubchannelSecureMinimalHttp2StackFilter::kFilter);
 
   // CLIENT_DIRECT_CHANNEL
   builder->channel_init()->RegisterFusedFilter(
@@ -127,6 +157,9 @@ void RegisterFusedFilters(CoreConfiguration::Builder* builder) {
   builder->channel_init()->RegisterFusedFilter(
       GRPC_CLIENT_DIRECT_CHANNEL,
       &FusedClientDirectChannelMinimalHttp2StackFilterExtended::kFilter);
+  builder->channel_init()->RegisterFusedFilter(
+      GRPC_CLIENT_DIRECT_CHANNEL,
+      &FusedClientDirectChannelSecureMinimalHttp2StackFilter::kFilter);
 
   // SERVER_CHANNEL
   builder->channel_init()->RegisterFusedFilter(
@@ -134,6 +167,9 @@ void RegisterFusedFilters(CoreConfiguration::Builder* builder) {
   builder->channel_init()->RegisterFusedFilter(
       GRPC_SERVER_CHANNEL,
       &FusedMessageSizeHttpServerCompressionAuthFilter::kFilter);
+  builder->channel_init()->RegisterFusedFilter(
+      GRPC_SERVER_CHANNEL,
+      &FusedMessageSizeHttpServerCompressionAuthCallTracerFilter::kFilter);
   builder->channel_init()->RegisterFusedFilter(
       GRPC_SERVER_CHANNEL,
       &FusedMessageSizeHttpServerCompressionAuthServerAuthzCallTracerFilter::
@@ -20,11 +20,13 @@
 
 #include <grpc/byte_buffer.h>
 #include <grpc/event_engine/event_engine.h>
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/port_platform.h>
 #include <inttypes.h>
 
+#include <deque>
 #include <string>
 #include <utility>
 
@@ -39,7 +41,10 @@
 #include "src/core/lib/iomgr/endpoint.h"
 #include "src/core/lib/iomgr/event_engine_shims/endpoint.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/debug_location.h"
+#include "src/core/util/no_destruct.h"
 #include "src/core/util/status_helper.h"
 #include "src/core/util/time.h"
 
@@ -69,6 +74,60 @@ std::string HandshakerArgsString(HandshakerArgs* args) {
                          args->read_buffer.Length(), args->exit_early);
 }
 
+// Process-wide FIFO admission queue that limits the number of concurrently
+// running handshakes when GRPC_ARG_MAX_CONCURRENT_HANDSHAKES is set.
+// Bounding handshake concurrency keeps a burst of incoming connections
+// (e.g. after a server restart) from starving established connections of
+// CPU with handshake crypto.
+class HandshakeAdmissionQueue {
+ public:
+  static HandshakeAdmissionQueue& Get() {
+    static NoDestruct<HandshakeAdmissionQueue> queue;
+    return *queue;
+  }
+
+  // Runs start_handshake now if fewer than max_concurrent admitted
+  // handshakes are running; otherwise queues it until Release() frees a
+  // slot. max_concurrent is the caller's configured limit, compared
+  // against the process-wide count of running handshakes.
+  void Admit(int max_concurrent, absl::AnyInvocable<void()> start_handshake) {
+    {
+      MutexLock lock(&mu_);
+      if (active_ >= max_concurrent) {
+        queued_.push_back(std::move(start_handshake));
+        global_stats().IncrementHandshakesQueued();
+        GRPC_TRACE_LOG(handshaker, INFO)
+            << "handshake admission queue: " << active_
+            << " handshakes running, queue depth " << queued_.size();
+        return;
+      }
+      ++active_;
+    }
+    start_handshake();
+  }
+
+  // Marks an admitted handshake as complete. The oldest queued handshake
+  // (if any) inherits the freed slot.
+  void Release() {
+    absl::AnyInvocable<void()> next;
+    {
+      MutexLock lock(&mu_);
+      if (queued_.empty()) {
+        --active_;
+        return;
+      }
+      next = std::move(queued_.front());
+      queued_.pop_front();
+    }
+    next();
+  }
+
+ private:
+  Mutex mu_;
+  int active_ ABSL_GUARDED_BY(mu_) = 0;
+  std::deque<absl::AnyInvocable<void()>> queued_ ABSL_GUARDED_BY(mu_);
+};
+
 }  // namespace
 
 HandshakeManager::HandshakeManager()
@@ -94,42 +153,70 @@ void HandshakeManager::DoHandshake(
   // return from this function, and on_handshake_done might release the
   // last ref to this object.
   auto self = Ref();
-  MutexLock lock(&mu_);
-  CHECK_EQ(index_, 0u);
-  on_handshake_done_ = std::move(on_handshake_done);
-  // Construct handshaker args.  These will be passed through all
-  // handshakers and eventually be freed by the on_handshake_done callback.
-  args_.endpoint = std::move(endpoint);
-  args_.deadline = deadline;
-  args_.args = channel_args;
-  args_.event_engine = args_.args.GetObject<EventEngine>();
-  args_.acceptor = acceptor;
-  // Add a channelz trace that we're performing a handshake.
-  // Note that we only commit this to the log if we see an error - otherwise
-  // it's ephemeral and is cleaned up when refs to it are released.
-  auto channelz_node = args_.args.GetObjectRef<channelz::BaseNode>();
-  args_.trace_node = channelz::TraceNode(
-      channelz_node.get() == nullptr
-          ? channelz::ChannelTrace::Node()
-          : channelz_node->NewTraceNode("Handshake connection"),
-      handshaker_trace,
-      [this]() { return absl::StrFormat("handshake manager %p: ", this); });
-  if (acceptor != nullptr && acceptor->external_connection &&
-      acceptor->pending_data != nullptr) {
-    grpc_slice_buffer_swap(args_.read_buffer.c_slice_buffer(),
-                           &(acceptor->pending_data->data.raw.slice_buffer));
+  int max_concurrent_handshakes = 0;
+  EventEngine* event_engine = nullptr;
+  {
+    MutexLock lock(&mu_);
+    CHECK_EQ(index_, 0u);
+    on_handshake_done_ = std::move(on_handshake_done);
+    // Construct handshaker args.  These will be passed through all
+    // handshakers and eventually be freed by the on_handshake_done callback.
+    args_.endpoint = std::move(endpoint);
+    args_.deadline = deadline;
+    args_.args = channel_args;
+    args_.event_engine = args_.args.GetObject<EventEngine>();
+    args_.acceptor = acceptor;
+    // Add a channelz trace that we're performing a handshake.
+    // Note that we only commit this to the log if we see an error - otherwise
+    // it's ephemeral and is cleaned up when refs to it are released.
+    auto channelz_node = args_.args.GetObjectRef<channelz::BaseNode>();
+    args_.trace_node = channelz::TraceNode(
+        channelz_node.get() == nullptr
+            ? channelz::ChannelTrace::Node()
+            : channelz_node->NewTraceNode("Handshake connection"),
+        handshaker_trace,
+        [this]() { return absl::StrFormat("handshake manager %p: ", this); });
+    if (acceptor != nullptr && acceptor->external_connection &&
+        acceptor->pending_data != nullptr) {
+      grpc_slice_buffer_swap(args_.read_buffer.c_slice_buffer(),
+                             &(acceptor->pending_data->data.raw.slice_buffer));
+    }
+    // Start deadline timer, which owns a ref.  The timer keeps running
+    // while the handshake waits in the admission queue, so a queued
+    // handshake still observes its deadline.
+    const Duration time_to_deadline = deadline - Timestamp::Now();
+    deadline_timer_handle_ = args_.event_engine->RunAfter(
+        time_to_deadline, [self = Ref()]() mutable {
+          ExecCtx exec_ctx;
+          self->Shutdown(GRPC_ERROR_CREATE("Handshake timed out"));
+          // HandshakeManager deletion might require an active ExecCtx.
+          self.reset();
+        });
+    max_concurrent_handshakes =
+        args_.args.GetInt(GRPC_ARG_MAX_CONCURRENT_HANDSHAKES).value_or(0);
+    uses_admission_queue_ = max_concurrent_handshakes > 0;
+    if (!uses_admission_queue_) {
+      // Start first handshaker.
+      CallNextHandshakerLocked(absl::OkStatus());
+      return;
+    }
+    event_engine = args_.event_engine;
   }
-  // Start deadline timer, which owns a ref.
-  const Duration time_to_deadline = deadline - Timestamp::Now();
-  deadline_timer_handle_ =
-      args_.event_engine->RunAfter(time_to_deadline, [self = Ref()]() mutable {
-        ExecCtx exec_ctx;
-        self->Shutdown(GRPC_ERROR_CREATE("Handshake timed out"));
-        // HandshakeManager deletion might require an active ExecCtx.
-        self.reset();
+  // Start the first handshaker once admitted.  The start is bounced
+  // through the EventEngine so that a completing handshake does not run
+  // the next queued handshake chain on its own stack.
+  HandshakeAdmissionQueue::Get().Admit(
+      max_concurrent_handshakes, [self = Ref(), event_engine]() mutable {
+        event_engine->Run([self = std::move(self)]() mutable {
+          ExecCtx exec_ctx;
+          {
+            MutexLock lock(&self->mu_);
+            self->CallNextHandshakerLocked(absl::OkStatus());
+          }
+          // HandshakeManager deletion might require an active ExecCtx.
+          self.reset();
+        });
       });
-  // Start first handshaker.
-  CallNextHandshakerLocked(absl::OkStatus());
 }
 
 void HandshakeManager::Shutdown(absl::Status error) {
@@ -181,6 +268,11 @@ void HandshakeManager::CallNextHandshakerLocked(absl::Status error) {
       // Destroy callback while ExecCtx is still in scope.
       on_handshake_done = nullptr;
     });
+    // Give our admission slot to the oldest queued handshake, if any.
+    if (uses_admission_queue_) {
+      uses_admission_queue_ = false;
+      HandshakeAdmissionQueue::Get().Release();
+    }
     return;
   }
   // Call the next handshaker.
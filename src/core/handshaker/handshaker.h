@@ -153,6 +153,9 @@ class HandshakeManager : public RefCounted<HandshakeManager> {
 
   Mutex mu_;
   bool is_shutdown_ ABSL_GUARDED_BY(mu_) = false;
+  // True if this handshake counts against GRPC_ARG_MAX_CONCURRENT_HANDSHAKES
+  // and must release its admission slot on completion.
+  bool uses_admission_queue_ ABSL_GUARDED_BY(mu_) = false;
   // The index of the handshaker to invoke next and closure to invoke it.
   size_t index_ ABSL_GUARDED_BY(mu_) = 0;
   // An array of handshakers added via Add().
@@ -32,12 +32,15 @@
 #include <string>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/hash/hash.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_join.h"
+#include "src/core/util/sync.h"
 #include "src/core/util/useful.h"
 
 namespace grpc_core {
@@ -123,7 +126,7 @@ bool ChannelArgs::WantMinimalStack() const {
   return GetBool(GRPC_ARG_MINIMAL_STACK).value_or(false);
 }
 
-ChannelArgs::ChannelArgs(AVL<RefCountedStringValue, Value> args)
+ChannelArgs::ChannelArgs(HAMT<RefCountedStringValue, Value> args)
     : args_(std::move(args)) {}
 
 ChannelArgs ChannelArgs::Set(grpc_arg arg) const {
@@ -168,7 +171,7 @@ grpc_arg ChannelArgs::Value::MakeCArg(const char* name) const {
 
 ChannelArgs::CPtr ChannelArgs::ToC() const {
   std::vector<grpc_arg> c_args;
-  args_.ForEach(
+  args_.ForEachSorted(
       [&c_args](const RefCountedStringValue& key, const Value& value) {
         c_args.push_back(value.MakeCArg(key.c_str()));
       });
@@ -293,7 +296,7 @@ absl::string_view ChannelArgs::Value::ToString(
 
 channelz::PropertyList ChannelArgs::ToPropertyList() const {
   channelz::PropertyList result;
-  args_.ForEach(
+  args_.ForEachSorted(
       [&result](const RefCountedStringValue& key, const Value& value) {
         if (auto i = value.GetIfInt(); i.has_value()) {
           result.Set(key.as_string_view(), *i);
@@ -311,7 +314,7 @@ std::string ChannelArgs::ToString() const {
   std::list<std::string> backing_strings;
   strings.push_back("{");
   bool first = true;
-  args_.ForEach([&strings, &first, &backing_strings](
+  args_.ForEachSorted([&strings, &first, &backing_strings](
                     const RefCountedStringValue& key, const Value& value) {
     if (!first) strings.push_back(", ");
     first = false;
@@ -323,10 +326,86 @@ std::string ChannelArgs::ToString() const {
   return absl::StrJoin(strings, "");
 }
 
+size_t ChannelArgs::ContentHash() const {
+  size_t hash = absl::HashOf(args_.Size());
+  // Trie order is content-determined (it follows key hashes only), so this
+  // produces the same hash for equal contents regardless of insertion
+  // history.
+  args_.ForEach([&hash](const RefCountedStringValue& key, const Value& value) {
+    hash = absl::HashOf(hash, key.as_string_view());
+    if (auto i = value.GetIfInt(); i.has_value()) {
+      hash = absl::HashOf(hash, *i);
+    } else if (auto s = value.GetIfString(); s != nullptr) {
+      hash = absl::HashOf(hash, s->as_string_view());
+    }
+    // Pointer values contribute only their key: their equality is defined
+    // by the vtable's cmp, so hashing the address could assign different
+    // hashes to values that compare equal.
+  });
+  return hash;
+}
+
+namespace {
+
+struct ChannelArgsInternTable {
+  Mutex mu;
+  absl::flat_hash_map<size_t, std::vector<ChannelArgs>> buckets
+      ABSL_GUARDED_BY(mu);
+  size_t size ABSL_GUARDED_BY(mu) = 0;
+};
+
+ChannelArgsInternTable* InternTable() {
+  static ChannelArgsInternTable* const table = new ChannelArgsInternTable;
+  return table;
+}
+
+}  // namespace
+
+ChannelArgs ChannelArgs::Interned() const {
+  // Interning is purely an optimization, so instead of tracking per-entry
+  // liveness the table is emptied when it grows past this bound; live args
+  // simply re-intern on their next use.
+  static constexpr size_t kMaxInterned = 4096;
+  if (args_.Empty()) return *this;
+  // Pointer values (EventEngines, credentials, subchannel pools, ...) must
+  // never enter the table: an interned copy would pin them until the table
+  // is next flushed, which for a shared_ptr<EventEngine> deadlocks
+  // WaitForSingleOwner() at shutdown.
+  bool has_pointer = false;
+  args_.ForEach(
+      [&has_pointer](const RefCountedStringValue&, const Value& value) {
+        if (value.GetIfPointer() != nullptr) has_pointer = true;
+      });
+  if (has_pointer) return *this;
+  auto* table = InternTable();
+  const size_t hash = ContentHash();
+  MutexLock lock(&table->mu);
+  if (table->size >= kMaxInterned) {
+    table->buckets.clear();
+    table->size = 0;
+  }
+  std::vector<ChannelArgs>& bucket = table->buckets[hash];
+  for (const ChannelArgs& candidate : bucket) {
+    if (args_.SameIdentity(candidate.args_) || *this == candidate) {
+      return candidate;
+    }
+  }
+  bucket.push_back(*this);
+  ++table->size;
+  return *this;
+}
+
+void ChannelArgs::ShutdownInternTable() {
+  auto* table = InternTable();
+  MutexLock lock(&table->mu);
+  table->buckets.clear();
+  table->size = 0;
+}
+
 ChannelArgs ChannelArgs::UnionWith(ChannelArgs other) const {
   if (args_.Empty()) return other;
   if (other.args_.Empty()) return *this;
-  if (args_.Height() <= other.args_.Height()) {
+  if (args_.Size() <= other.args_.Size()) {
     args_.ForEach(
         [&other](const RefCountedStringValue& key, const Value& value) {
           other.args_ = other.args_.Add(key, value);
@@ -37,7 +37,7 @@
 #include "absl/strings/string_view.h"
 #include "src/core/channelz/property_list.h"
 #include "src/core/lib/surface/channel_stack_type.h"
-#include "src/core/util/avl.h"
+#include "src/core/util/hamt.h"
 #include "src/core/util/debug_location.h"
 #include "src/core/util/dual_ref_counted.h"
 #include "src/core/util/ref_counted.h"
@@ -577,6 +577,21 @@ class ChannelArgs {
     return QsortCompare(lhs.args_, rhs.args_);
   }
 
+  // Returns an instance with canonical (shared) backing storage: Interned()
+  // results with equal contents share one representation process-wide, so
+  // duplicates collapse to a single set of nodes and comparisons between
+  // interned instances short-circuit on identity. Intended for long-lived,
+  // frequently compared args such as subchannel pool keys; interning a
+  // short-lived instance just pays the content hash for nothing.
+  // Args containing pointer values are returned unshared: the table must
+  // not pin objects like EventEngines or credentials for the process
+  // lifetime.
+  GRPC_MUST_USE_RESULT ChannelArgs Interned() const;
+
+  /// Drops the process-wide intern table.  Called at grpc_shutdown() so
+  /// that interned args don't outlive the library.
+  static void ShutdownInternTable();
+
   // Helpers for commonly accessed things
 
   bool WantMinimalStack() const;
@@ -588,12 +603,15 @@ class ChannelArgs {
   }
 
  private:
-  explicit ChannelArgs(AVL<RefCountedStringValue, Value> args);
+  explicit ChannelArgs(HAMT<RefCountedStringValue, Value> args);
 
   GRPC_MUST_USE_RESULT ChannelArgs Set(absl::string_view name,
                                        Value value) const;
 
-  AVL<RefCountedStringValue, Value> args_;
+  // Hash of the contents, consistent with operator==; used by Interned().
+  size_t ContentHash() const;
+
+  HAMT<RefCountedStringValue, Value> args_;
 };
 
 std::ostream& operator<<(std::ostream& out, const ChannelArgs& args);
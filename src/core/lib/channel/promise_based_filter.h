@@ -732,8 +732,10 @@ class InterceptClientToServerMessageHandler<Derived, R (Call::*)(MessageHandle),
   FilterCallData<Derived>* call_data_;
 };
 
-// For handling fused filters with a promise return type. This specialization is
-// only for fused filters requiring a channel pointer.
+// For handling filters with a promise return type - fused filters resolve to
+// ServerMetadataOrHandle<Message>, plain filters to
+// absl::StatusOr<MessageHandle>. This specialization is only for filters
+// requiring a channel pointer.
 template <typename Derived, typename Call, typename R>
 class InterceptClientToServerMessageHandler<
     Derived, R (Call::*)(MessageHandle, Derived*), EnableIfPromise<R>> {
@@ -746,13 +748,25 @@ class InterceptClientToServerMessageHandler<
     return [call_data = call_data_](MessageHandle msg) {
       return Map(call_data->call.OnClientToServerMessage(std::move(msg),
                                                          call_data->channel),
-                 [call_data](ServerMetadataOrHandle<Message> md)
+                 [call_data](PromiseResult<R> md)
                      -> std::optional<MessageHandle> {
                    if (!md.ok()) {
-                     call_data->error_latch.Set(std::move(md).TakeMetadata());
+                     if constexpr (std::is_same_v<
+                                       PromiseResult<R>,
+                                       absl::StatusOr<MessageHandle>>) {
+                       call_data->error_latch.Set(
+                           ServerMetadataFromStatus(md.status()));
+                     } else {
+                       call_data->error_latch.Set(std::move(md).TakeMetadata());
+                     }
                      return std::nullopt;
                    }
-                   return std::move(md).TakeValue();
+                   if constexpr (std::is_same_v<PromiseResult<R>,
+                                                absl::StatusOr<MessageHandle>>) {
+                     return std::move(*md);
+                   } else {
+                     return std::move(md).TakeValue();
+                   }
                  });
     };
   }
@@ -1049,8 +1063,10 @@ struct InterceptServerToClientMessage<Derived, R (Call::*)(MessageHandle),
   }
 };
 
-// For handling fused filters with a promise return type. This specialization is
-// only for fused filters requiring a channel pointer.
+// For handling filters with a promise return type - fused filters resolve to
+// ServerMetadataOrHandle<Message>, plain filters to
+// absl::StatusOr<MessageHandle>. This specialization is only for filters
+// requiring a channel pointer.
 template <typename Derived, typename Call, typename R>
 struct InterceptServerToClientMessage<
     Derived, R (Call::*)(MessageHandle, Derived*), EnableIfPromise<R>> {
@@ -1061,13 +1077,24 @@ struct InterceptServerToClientMessage<
           return Map(
               call_data->call.OnServerToClientMessage(std::move(msg),
                                                       call_data->channel),
-              [call_data](ServerMetadataOrHandle<Message> msg)
-                  -> std::optional<MessageHandle> {
+              [call_data](
+                  PromiseResult<R> msg) -> std::optional<MessageHandle> {
                 if (!msg.ok()) {
-                  call_data->error_latch.Set(std::move(msg).TakeMetadata());
+                  if constexpr (std::is_same_v<PromiseResult<R>,
+                                               absl::StatusOr<MessageHandle>>) {
+                    call_data->error_latch.Set(
+                        ServerMetadataFromStatus(msg.status()));
+                  } else {
+                    call_data->error_latch.Set(std::move(msg).TakeMetadata());
+                  }
                   return std::nullopt;
                 }
-                return std::move(msg).TakeValue();
+                if constexpr (std::is_same_v<PromiseResult<R>,
+                                             absl::StatusOr<MessageHandle>>) {
+                  return std::move(*msg);
+                } else {
+                  return std::move(msg).TakeValue();
+                }
               });
         });
   }
@@ -28,16 +28,29 @@
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "src/core/lib/slice/slice.h"
-
-#define OUTPUT_BLOCK_SIZE 1024
+#include "src/core/util/useful.h"
+
+#define MIN_OUTPUT_BLOCK_SIZE 1024
+#define MAX_OUTPUT_BLOCK_SIZE (64 * 1024)
+
+// Size output blocks from the input length: compressed output is almost
+// always smaller than its input, so typical messages land in a single slice
+// instead of streaming through fixed 1KB blocks, and large messages allocate
+// 64KB blocks rather than thousands of small ones.
+static size_t output_block_size(grpc_slice_buffer* input) {
+  return grpc_core::Clamp<size_t>(input->length, MIN_OUTPUT_BLOCK_SIZE,
+                                  MAX_OUTPUT_BLOCK_SIZE);
+}
 
 static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
                      grpc_slice_buffer* output,
-                     int (*flate)(z_stream* zs, int flush)) {
+                     int (*flate)(z_stream* zs, int flush),
+                     const grpc_slice* dict) {
   int r = Z_STREAM_END;  // Do not fail on an empty input.
   int flush;
   size_t i;
-  grpc_slice outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+  const size_t block_size = output_block_size(input);
+  grpc_slice outbuf = GRPC_SLICE_MALLOC(block_size);
   const uInt uint_max = ~uInt{0};
 
   CHECK(GRPC_SLICE_LENGTH(outbuf) <= uint_max);
@@ -52,12 +65,23 @@ static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
     do {
       if (zs->avail_out == 0) {
         grpc_slice_buffer_add_indexed(output, outbuf);
-        outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+        outbuf = GRPC_SLICE_MALLOC(block_size);
         CHECK(GRPC_SLICE_LENGTH(outbuf) <= uint_max);
         zs->avail_out = static_cast<uInt> GRPC_SLICE_LENGTH(outbuf);
         zs->next_out = GRPC_SLICE_START_PTR(outbuf);
       }
       r = flate(zs, flush);
+      if (r == Z_NEED_DICT && dict != nullptr) {
+        // Inflation hit the dictionary reference at the start of the stream:
+        // supply ours and resume. A stream needs its dictionary at most once.
+        if (inflateSetDictionary(zs, GRPC_SLICE_START_PTR(*dict),
+                                 static_cast<uInt>(GRPC_SLICE_LENGTH(*dict))) !=
+            Z_OK) {
+          VLOG(2) << "zlib: dictionary mismatch";
+          goto error;
+        }
+        r = flate(zs, flush);
+      }
       if (r < 0 && r != Z_BUF_ERROR /* not fatal */) {
         VLOG(2) << "zlib error (" << r << ")";
         goto error;
@@ -92,7 +116,7 @@ static void* zalloc_gpr(void* /*opaque*/, unsigned int items,
 static void zfree_gpr(void* /*opaque*/, void* address) { gpr_free(address); }
 
 static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
-                         int gzip) {
+                         int gzip, const grpc_slice* dict) {
   z_stream zs;
   int r;
   size_t i;
@@ -104,7 +128,13 @@ static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
   r = deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | (gzip ? 16 : 0),
                    8, Z_DEFAULT_STRATEGY);
   CHECK(r == Z_OK);
-  r = zlib_body(&zs, input, output, deflate) && output->length < input->length;
+  if (dict != nullptr) {
+    r = deflateSetDictionary(&zs, GRPC_SLICE_START_PTR(*dict),
+                             static_cast<uInt>(GRPC_SLICE_LENGTH(*dict)));
+    CHECK(r == Z_OK);
+  }
+  r = zlib_body(&zs, input, output, deflate, nullptr) &&
+      output->length < input->length;
   if (!r) {
     for (i = count_before; i < output->count; i++) {
       grpc_core::CSliceUnref(output->slices[i]);
@@ -117,7 +147,7 @@ static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
 }
 
 static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
-                           int gzip) {
+                           int gzip, const grpc_slice* dict) {
   z_stream zs;
   int r;
   size_t i;
@@ -128,7 +158,7 @@ static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
   zs.zfree = zfree_gpr;
   r = inflateInit2(&zs, 15 | (gzip ? 16 : 0));
   CHECK(r == Z_OK);
-  r = zlib_body(&zs, input, output, inflate);
+  r = zlib_body(&zs, input, output, inflate, dict);
   if (!r) {
     for (i = count_before; i < output->count; i++) {
       grpc_core::CSliceUnref(output->slices[i]);
@@ -156,9 +186,9 @@ static int compress_inner(grpc_compression_algorithm algorithm,
       // rely on that here
       return 0;
     case GRPC_COMPRESS_DEFLATE:
-      return zlib_compress(input, output, 0);
+      return zlib_compress(input, output, 0, nullptr);
     case GRPC_COMPRESS_GZIP:
-      return zlib_compress(input, output, 1);
+      return zlib_compress(input, output, 1, nullptr);
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
@@ -175,15 +205,31 @@ int grpc_msg_compress(grpc_compression_algorithm algorithm,
   return 1;
 }
 
+int grpc_msg_compress_with_dictionary(grpc_slice_buffer* input,
+                                      grpc_slice dictionary,
+                                      grpc_slice_buffer* output) {
+  if (!zlib_compress(input, output, 0, &dictionary)) {
+    copy(input, output);
+    return 0;
+  }
+  return 1;
+}
+
+int grpc_msg_decompress_with_dictionary(grpc_slice_buffer* input,
+                                        grpc_slice dictionary,
+                                        grpc_slice_buffer* output) {
+  return zlib_decompress(input, output, 0, &dictionary);
+}
+
 int grpc_msg_decompress(grpc_compression_algorithm algorithm,
                         grpc_slice_buffer* input, grpc_slice_buffer* output) {
   switch (algorithm) {
     case GRPC_COMPRESS_NONE:
       return copy(input, output);
     case GRPC_COMPRESS_DEFLATE:
-      return zlib_decompress(input, output, 0);
+      return zlib_decompress(input, output, 0, nullptr);
     case GRPC_COMPRESS_GZIP:
-      return zlib_decompress(input, output, 1);
+      return zlib_decompress(input, output, 1, nullptr);
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
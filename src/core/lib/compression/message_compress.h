@@ -35,4 +35,21 @@ int grpc_msg_compress(grpc_compression_algorithm algorithm,
 int grpc_msg_decompress(grpc_compression_algorithm algorithm,
                         grpc_slice_buffer* input, grpc_slice_buffer* output);
 
+// EXPERIMENTAL: like grpc_msg_compress with GRPC_COMPRESS_DEFLATE, but primes
+// the DEFLATE context with 'dictionary' first, which lets small messages that
+// closely resemble the dictionary compress well where stock deflate achieves
+// nothing. Only the DEFLATE (zlib) wrapper supports dictionaries (the gzip
+// format carries no dictionary id), and both peers must agree on the
+// dictionary out of band: there is no wire negotiation.
+int grpc_msg_compress_with_dictionary(grpc_slice_buffer* input,
+                                      grpc_slice dictionary,
+                                      grpc_slice_buffer* output);
+
+// EXPERIMENTAL: inverse of grpc_msg_compress_with_dictionary, with the
+// success/failure semantics of grpc_msg_decompress. Fails if the stream was
+// not compressed against 'dictionary'.
+int grpc_msg_decompress_with_dictionary(grpc_slice_buffer* input,
+                                        grpc_slice dictionary,
+                                        grpc_slice_buffer* output);
+
 #endif  // GRPC_SRC_CORE_LIB_COMPRESSION_MESSAGE_COMPRESS_H
@@ -0,0 +1,56 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_PACING_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_PACING_H
+
+#include <grpc/support/port_platform.h>
+
+#include <cstdint>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+
+/// Channel arg (boolean): when set, transports that maintain a bandwidth
+/// estimate feed it to the endpoint's pacing extension so that the kernel
+/// spreads transmissions over time instead of bursting whole writes at
+/// line rate.
+#define GRPC_ARG_BDP_DRIVEN_WRITE_PACING \
+  "grpc.experimental.bdp_driven_write_pacing"
+
+namespace grpc_event_engine::experimental {
+
+/// An Endpoint extension for capping the rate at which the endpoint's bytes
+/// are released to the wire. Writes are accepted as usual; the pacing is
+/// applied by the kernel between the send buffer and the wire, so it also
+/// shapes retransmissions. Smoothing out line-rate bursts this way reduces
+/// queue-overflow loss on long-haul links without capping throughput,
+/// provided the rate tracks (with headroom) the path's estimated bandwidth.
+class EndpointPacingExtension {
+ public:
+  virtual ~EndpointPacingExtension() = default;
+  static absl::string_view EndpointExtensionName() {
+    return "io.grpc.event_engine.extension.pacing";
+  }
+
+  /// Caps the endpoint's transmit rate at max_rate bytes per second; a
+  /// max_rate of 0 removes the cap. Returns an error if the platform or
+  /// socket cannot pace, in which case the caller should stop feeding
+  /// rates to this endpoint.
+  virtual absl::Status SetMaxPacingRate(uint64_t max_rate) = 0;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_PACING_H
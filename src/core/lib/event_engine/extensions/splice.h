@@ -0,0 +1,73 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_SPLICE_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_SPLICE_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <cstddef>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_event_engine::experimental {
+
+/// An Endpoint extension for endpoint-to-endpoint passthrough without
+/// copying bytes through userspace. A TCP-level proxy that relays bytes
+/// unmodified between two endpoints can use this instead of its
+/// Read()/Write() copy loop; on Linux the posix endpoint implements it
+/// with splice(2) through a pipe, moving pages from the source socket's
+/// receive queue to the destination socket's send queue.
+class EndpointSpliceExtension {
+ public:
+  virtual ~EndpointSpliceExtension() = default;
+  static absl::string_view EndpointExtensionName() {
+    return "io.grpc.event_engine.extension.splice";
+  }
+
+  /// Moves up to `max_bytes` bytes that are queued in this endpoint's
+  /// receive buffer into `destination`'s send buffer and returns the
+  /// number of bytes that reached the destination. Never blocks and never
+  /// registers for readiness: a return of 0 means no source bytes were
+  /// readable or the destination was flow-controlled, and the caller
+  /// should retry after its own readiness notification (e.g. a Read() on
+  /// the source once the relay has fully drained; see below).
+  ///
+  /// Returns kUnimplemented when the destination is not an endpoint this
+  /// endpoint can splice to (not a posix endpoint of the same engine, or
+  /// no kernel support) — the caller should fall back to the copy path
+  /// for the connection's lifetime. Returns kUnavailable once the source
+  /// has reached end of stream and all spliced bytes have been delivered.
+  ///
+  /// When the destination is flow-controlled, bytes may remain parked in
+  /// the relay pipe; they are delivered ahead of any new source bytes by
+  /// later SpliceTo() calls. Because those bytes have already left the
+  /// socket, callers must not interleave Read() on the source with
+  /// SpliceTo() unless SpliceBufferedBytes() is zero, and must not issue
+  /// concurrent Read()s on the source or Write()s on the destination
+  /// while a SpliceTo() call is in progress.
+  virtual absl::StatusOr<size_t> SpliceTo(EventEngine::Endpoint* destination,
+                                          size_t max_bytes) = 0;
+
+  /// Bytes accepted from the source socket but still parked in the relay
+  /// pipe awaiting destination send buffer space. While non-zero, the
+  /// stream's tail lives in the pipe and only SpliceTo() can deliver it.
+  virtual size_t SpliceBufferedBytes() const = 0;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_SPLICE_H
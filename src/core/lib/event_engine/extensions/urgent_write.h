@@ -0,0 +1,55 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_URGENT_WRITE_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_URGENT_WRITE_H
+
+#include <grpc/event_engine/slice_buffer.h>
+#include <grpc/support/port_platform.h>
+
+#include "absl/strings/string_view.h"
+
+namespace grpc_event_engine::experimental {
+
+/// An Endpoint extension providing a second, urgent write lane for small
+/// control payloads (e.g. HTTP/2 PING acks and WINDOW_UPDATE frames) so that
+/// they need not wait for the completion callback of a large in-flight write
+/// before they can be handed to the endpoint.
+///
+/// An endpoint is a byte stream with no knowledge of the caller's framing,
+/// so it can never reorder urgent bytes ahead of bytes it has already
+/// accepted. What this extension guarantees instead is that urgent bytes are
+/// flushed to the kernel as soon as the in-flight write drains — merged into
+/// the tail of that write's syscalls where possible — rather than waiting
+/// for the caller to observe the write completion and schedule a new write.
+class EndpointUrgentWriteExtension {
+ public:
+  virtual ~EndpointUrgentWriteExtension() = default;
+  static absl::string_view EndpointExtensionName() {
+    return "io.grpc.event_engine.extension.urgent_write";
+  }
+
+  /// Queues the contents of `data` on the urgent lane. Returns true if the
+  /// bytes were accepted, in which case the slices are drained from `data`
+  /// and will reach the kernel before the in-flight write's completion
+  /// callback runs. Returns false if no write is in flight — there is then
+  /// nothing to jump ahead of, and the caller should send the bytes through
+  /// a regular Write() instead. May be called from any thread, including
+  /// while a write is in flight.
+  virtual bool WriteUrgent(SliceBuffer* data) = 0;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_URGENT_WRITE_H
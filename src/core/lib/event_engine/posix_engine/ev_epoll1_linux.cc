@@ -19,7 +19,9 @@
 #include <grpc/support/sync.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <memory>
 
 #include "absl/log/check.h"
@@ -27,10 +29,12 @@
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_format.h"
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/event_engine/poller.h"
 #include "src/core/lib/event_engine/posix_engine/posix_interface.h"
 #include "src/core/lib/event_engine/time_util.h"
 #include "src/core/lib/iomgr/port.h"
+#include "src/core/telemetry/stats.h"
 #include "src/core/util/crash.h"
 
 // This polling engine is only relevant on linux kernels supporting epoll
@@ -245,6 +249,8 @@ void Epoll1EventHandle::HandleShutdownInternal(absl::Status why,
 
 Epoll1Poller::Epoll1Poller(Scheduler* scheduler)
     : scheduler_(scheduler), was_kicked_(false), closed_(false) {
+  busy_poll_window_ = std::chrono::microseconds(
+      std::max(0, grpc_core::ConfigVars::Get().EventEngineBusyPollUsec()));
   g_epoll_set_.epfd = posix_interface().EpollCreateAndCloexec().value();
   wakeup_fd_ = CreateWakeupFd(&posix_interface()).value();
   CHECK(wakeup_fd_ != nullptr);
@@ -362,8 +368,28 @@ int Epoll1Poller::DoEpollWait(EventEngine::Duration timeout) {
     grpc_core::Crash("File descriptor from the wrong generation");
   }
   int r;
+  if (busy_poll_window_ > EventEngine::Duration::zero()) {
+    // Spin with non-blocking epoll_wait calls for the busy-poll window (or
+    // the requested timeout, whichever is shorter) before falling back to the
+    // blocking wait below. A Kick() makes the wakeup fd readable, so kicks
+    // are observed while spinning.
+    const EventEngine::Duration spin = std::min(busy_poll_window_, timeout);
+    const auto spin_deadline = std::chrono::steady_clock::now() + spin;
+    do {
+      r = epoll_wait(*fd, g_epoll_set_.events, events_per_wait_, 0);
+    } while ((r == 0 || (r < 0 && errno == EINTR)) &&
+             std::chrono::steady_clock::now() < spin_deadline);
+    if (r > 0) {
+      g_epoll_set_.num_events = r;
+      g_epoll_set_.cursor = 0;
+      AdaptEventsPerWait(r);
+      return r;
+    }
+    // Charge the time spent spinning against the caller's timeout.
+    timeout -= spin;
+  }
   do {
-    r = epoll_wait(*fd, g_epoll_set_.events, MAX_EPOLL_EVENTS,
+    r = epoll_wait(*fd, g_epoll_set_.events, events_per_wait_,
                    static_cast<int>(
                        grpc_event_engine::experimental::Milliseconds(timeout)));
   } while (r < 0 && errno == EINTR);
@@ -374,9 +400,29 @@ int Epoll1Poller::DoEpollWait(EventEngine::Duration timeout) {
   }
   g_epoll_set_.num_events = r;
   g_epoll_set_.cursor = 0;
+  AdaptEventsPerWait(r);
   return r;
 }
 
+// Resizes the events-per-wait batch based on how full the wait that just
+// finished came back: a full batch means the poller is running behind and the
+// next wait should drain more per wakeup, while a mostly empty one means
+// wakeup-to-dequeue latency dominates and a small batch suffices.
+void Epoll1Poller::AdaptEventsPerWait(int events_returned) {
+  const int batch = events_per_wait_;
+  if (events_returned == batch) {
+    events_per_wait_ = std::min(batch * 2, MAX_EPOLL_EVENTS);
+  } else if (events_returned < batch / 4 && batch > kMinEpollEventsPerWait) {
+    events_per_wait_ = std::max(batch / 2, kMinEpollEventsPerWait);
+  }
+  if (events_per_wait_ != batch) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "Epoll1Poller:" << this << " events_per_wait " << batch << " -> "
+        << events_per_wait_ << " (last wait returned " << events_returned
+        << ")";
+  }
+}
+
 // Might be called multiple times
 void Epoll1EventHandle::ShutdownHandle(absl::Status why) {
   // A mutex is required here because, the SetShutdown method of the
@@ -431,6 +477,10 @@ Poller::WorkResult Epoll1Poller::Work(
     if (ProcessEpollEvents(
             was_kicked_ ? INT_MAX : MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION,
             pending_events)) {
+      // Any kick that coalesced before this reset is satisfied by the kKicked
+      // result of this iteration; kicks arriving afterwards write the wakeup
+      // fd afresh.
+      kick_pending_.store(false, std::memory_order_release);
       was_kicked_ = false;
       was_kicked_ext = true;
     }
@@ -448,8 +498,16 @@ Poller::WorkResult Epoll1Poller::Work(
 }
 
 void Epoll1Poller::Kick() {
+  grpc_core::global_stats().IncrementPollerKicks();
+  // Fast path: if a kick is already pending, the wakeup fd is (or is about
+  // to become) readable, so this kick coalesces with the pending one without
+  // taking the mutex or writing the wakeup fd again.
+  if (kick_pending_.exchange(true, std::memory_order_acq_rel)) {
+    grpc_core::global_stats().IncrementPollerKicksCoalesced();
+    return;
+  }
   grpc_core::MutexLock lock(&mu_);
-  if (was_kicked_ || closed_) {
+  if (closed_) {
     return;
   }
   was_kicked_ = true;
@@ -490,6 +548,7 @@ void Epoll1Poller::ResetKickState() {
       g_epoll_set_.epfd, false, wakeup_fd_->ReadFd(), wakeup_fd_.get());
   CHECK(status.ok()) << status.StrError();
   grpc_core::MutexLock lock(&mu_);
+  kick_pending_.store(false, std::memory_order_release);
   was_kicked_ = false;
 }
 
@@ -532,6 +591,10 @@ int Epoll1Poller::DoEpollWait(EventEngine::Duration /*timeout*/) {
   grpc_core::Crash("unimplemented");
 }
 
+void Epoll1Poller::AdaptEventsPerWait(int /*events_returned*/) {
+  grpc_core::Crash("unimplemented");
+}
+
 Poller::WorkResult Epoll1Poller::Work(
     EventEngine::Duration /*timeout*/,
     absl::FunctionRef<void()> /*schedule_poll_again*/) {
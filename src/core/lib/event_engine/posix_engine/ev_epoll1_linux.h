@@ -17,6 +17,7 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/support/port_platform.h>
 
+#include <atomic>
 #include <list>
 #include <memory>
 #include <string>
@@ -90,6 +91,9 @@ class Epoll1Poller : public PosixEventPoller {
   // of events generated by epoll_wait.
   int DoEpollWait(
       grpc_event_engine::experimental::EventEngine::Duration timeout);
+  // Resizes events_per_wait_ based on how full the wait that just finished
+  // came back; see the field comment below.
+  void AdaptEventsPerWait(int events_returned);
   friend class Epoll1EventHandle;
 #ifdef GRPC_LINUX_EPOLL
   struct EpollSet {
@@ -113,12 +117,27 @@ class Epoll1Poller : public PosixEventPoller {
   // A singleton epoll set
   EpollSet g_epoll_set_;
   bool was_kicked_ ABSL_GUARDED_BY(mu_);
+  // Lock-free mirror of was_kicked_ used to coalesce concurrent Kick() calls:
+  // once a kick is pending, further kicks elide both the mutex acquisition and
+  // the wakeup fd write until the pending kick has been consumed.
+  std::atomic<bool> kick_pending_{false};
   std::list<EventHandle*> free_epoll1_handles_list_ ABSL_GUARDED_BY(mu_);
 #if GRPC_ENABLE_FORK_SUPPORT
   absl::flat_hash_set<EventHandle*> fork_handles_set_ ABSL_GUARDED_BY(mu_);
 #endif  // GRPC_ENABLE_FORK_SUPPORT
   std::unique_ptr<WakeupFd> wakeup_fd_;
   bool closed_;
+  // How long DoEpollWait() spins with non-blocking epoll_wait calls before
+  // falling back to a blocking wait. Zero (the default) disables busy polling.
+  grpc_event_engine::experimental::EventEngine::Duration busy_poll_window_{0};
+  // Lower bound for the adaptive events-per-wait batch below.
+  static constexpr int kMinEpollEventsPerWait = 16;
+  // Adaptive events-per-wait batch size: DoEpollWait() doubles it (up to
+  // MAX_EPOLL_EVENTS) whenever a wait fills the whole batch and halves it
+  // when waits come back mostly empty, so loaded pollers amortize wakeups
+  // over large batches while lightly loaded ones keep dequeue latency low.
+  // Only touched by the polling thread.
+  int events_per_wait_ = kMinEpollEventsPerWait;
 };
 
 // Return an instance of a epoll1 based poller tied to the specified event
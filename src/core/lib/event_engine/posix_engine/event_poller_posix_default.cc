@@ -16,6 +16,7 @@
 
 #include <memory>
 
+#include "absl/log/log.h"
 #include "absl/strings/str_split.h"
 #include "absl/strings/string_view.h"
 #include "src/core/config/config_vars.h"
@@ -40,7 +41,17 @@ std::shared_ptr<PosixEventPoller> MakeDefaultPoller(Scheduler* scheduler) {
       absl::StrSplit(grpc_core::ConfigVars::Get().PollStrategy(), ',');
   for (auto it = strings.begin(); it != strings.end() && poller == nullptr;
        it++) {
-    if (PollStrategyMatches(*it, "epoll1")) {
+    if (*it == "uring") {
+      // Placeholder for an io_uring based poller. Building one requires
+      // either a liburing dependency (not part of the build today) or raw
+      // io_uring_setup/io_uring_enter ring management; until that lands,
+      // accept the strategy name so configs can opt in ahead of time and
+      // fall back to epoll1.
+      LOG_FIRST_N(INFO, 1)
+          << "Poll strategy 'uring' is not implemented; falling back to epoll1";
+      poller = MakeEpoll1Poller(scheduler);
+    }
+    if (poller == nullptr && PollStrategyMatches(*it, "epoll1")) {
       poller = MakeEpoll1Poller(scheduler);
     }
     if (poller == nullptr && PollStrategyMatches(*it, "poll")) {
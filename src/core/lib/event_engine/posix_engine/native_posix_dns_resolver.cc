@@ -22,6 +22,8 @@
 #include <string.h>
 #include <sys/socket.h>
 
+#include <map>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -32,8 +34,12 @@
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
+#include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/posix_engine/native_posix_dns_resolver.h"
+#include "src/core/lib/event_engine/thread_pool/thread_pool.h"
 #include "src/core/util/host_port.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/sync.h"
 #include "src/core/util/useful.h"
 
 namespace grpc_event_engine::experimental {
@@ -88,6 +94,77 @@ LookupHostnameBlocking(absl::string_view name, absl::string_view default_port) {
   return addresses;
 }
 
+namespace {
+
+// Runs blocking getaddrinfo calls on a small dedicated thread pool
+// instead of the general EventEngine pool, so that slow DNS does not
+// tie up threads that are servicing RPC closures.  Concurrent lookups
+// for the same name and port are collapsed into a single syscall whose
+// result is fanned out to every caller.
+class HostnameLookupQueue {
+ public:
+  void Lookup(std::shared_ptr<EventEngine> event_engine,
+              EventEngine::DNSResolver::LookupHostnameCallback on_resolved,
+              absl::string_view name, absl::string_view default_port) {
+    std::pair<std::string, std::string> key(std::string(name),
+                                            std::string(default_port));
+    bool first = false;
+    size_t queue_depth;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      auto& waiters = pending_[key];
+      first = waiters.empty();
+      waiters.push_back(Waiter{std::move(event_engine), std::move(on_resolved)});
+      queue_depth = pending_.size();
+    }
+    GRPC_TRACE_LOG(event_engine_dns, INFO)
+        << "NativePosixDNSResolver: " << (first ? "starting" : "coalescing")
+        << " lookup of " << key.first << "; queued lookups: " << queue_depth;
+    if (!first) return;
+    pool_->Run([this, key = std::move(key)]() {
+      auto result = LookupHostnameBlocking(key.first, key.second);
+      std::vector<Waiter> waiters;
+      {
+        grpc_core::MutexLock lock(&mu_);
+        auto it = pending_.find(key);
+        waiters = std::move(it->second);
+        pending_.erase(it);
+      }
+      for (auto& waiter : waiters) {
+        // Deliver on the caller's EventEngine, not from this thread, so
+        // that callbacks cannot block the lookup threads.
+        waiter.event_engine->Run([on_resolved = std::move(waiter.on_resolved),
+                                  result]() mutable {
+          on_resolved(std::move(result));
+        });
+      }
+    });
+  }
+
+ private:
+  struct Waiter {
+    std::shared_ptr<EventEngine> event_engine;
+    EventEngine::DNSResolver::LookupHostnameCallback on_resolved;
+  };
+
+  // A small reserve is enough: the pool adds threads while existing
+  // ones are blocked in getaddrinfo and shrinks back afterwards.
+  std::shared_ptr<ThreadPool> pool_ = MakeThreadPool(2);
+  grpc_core::Mutex mu_;
+  std::map<std::pair<std::string, std::string>, std::vector<Waiter>> pending_
+      ABSL_GUARDED_BY(mu_);
+};
+
+// The queue is shared by all resolver and EventEngine instances, so the
+// coalescing works across channels.  Leaked so that lookup threads need
+// not be joined at shutdown.
+HostnameLookupQueue* LookupQueue() {
+  static grpc_core::NoDestruct<HostnameLookupQueue> queue;
+  return queue.get();
+}
+
+}  // namespace
+
 NativePosixDNSResolver::NativePosixDNSResolver(
     std::shared_ptr<EventEngine> event_engine)
     : event_engine_(std::move(event_engine)) {}
@@ -95,10 +172,8 @@ NativePosixDNSResolver::NativePosixDNSResolver(
 void NativePosixDNSResolver::LookupHostname(
     EventEngine::DNSResolver::LookupHostnameCallback on_resolved,
     absl::string_view name, absl::string_view default_port) {
-  event_engine_->Run([name = std::string(name), default_port,
-                      on_resolved = std::move(on_resolved)]() mutable {
-    on_resolved(LookupHostnameBlocking(name, default_port));
-  });
+  LookupQueue()->Lookup(event_engine_, std::move(on_resolved), name,
+                        default_port);
 }
 
 void NativePosixDNSResolver::LookupSRV(
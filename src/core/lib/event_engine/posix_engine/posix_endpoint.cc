@@ -17,6 +17,7 @@
 #include <grpc/event_engine/internal/slice_cast.h>
 #include <grpc/event_engine/slice.h>
 #include <grpc/event_engine/slice_buffer.h>
+#include <grpc/slice.h>
 #include <grpc/status.h>
 #include <grpc/support/port_platform.h>
 #include <inttypes.h>
@@ -26,6 +27,8 @@
 #include <cctype>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <string>
@@ -36,6 +39,7 @@
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
+#include "src/core/channelz/property_list.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
@@ -44,6 +48,8 @@
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/lib/slice/slice_refcount.h"
 #include "src/core/telemetry/stats.h"
 #include "src/core/util/debug_location.h"
 #include "src/core/util/load_file.h"
@@ -63,6 +69,11 @@
 #endif
 #include <netinet/in.h>  // IWYU pragma: keep
 
+#ifdef GRPC_HAVE_SPLICE
+#include <fcntl.h>   // IWYU pragma: keep
+#include <unistd.h>  // IWYU pragma: keep
+#endif
+
 #ifndef SOL_TCP
 #define SOL_TCP IPPROTO_TCP
 #endif
@@ -72,6 +83,26 @@
 #define TCP_CM_INQ TCP_INQ
 #endif
 
+#ifdef GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+#include <sys/mman.h>  // IWYU pragma: keep
+#include <unistd.h>    // IWYU pragma: keep
+
+#ifndef TCP_ZEROCOPY_RECEIVE
+#define TCP_ZEROCOPY_RECEIVE 35
+#endif
+
+namespace {
+// Leading fields of the kernel's struct tcp_zerocopy_receive (linux/tcp.h),
+// declared locally so builds against pre-4.18 uapi headers still compile.
+// The kernel accepts any optlen that covers at least these fields.
+struct TcpZerocopyReceiveParams {
+  uint64_t address;
+  uint32_t length;
+  uint32_t recv_skip_hint;
+};
+}  // namespace
+#endif  // GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+
 #ifdef GRPC_HAVE_MSG_NOSIGNAL
 #define SENDMSG_FLAGS MSG_NOSIGNAL
 #else
@@ -288,6 +319,82 @@ absl::Status PosixEndpointImpl::TcpAnnotateError(absl::Status src_error) const {
   return src_error;
 }
 
+#ifdef GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+
+namespace {
+// Only attempt receive queue mapping when at least this much page-aligned
+// space is on offer; below this, copying is cheaper than the extra syscalls.
+constexpr size_t kZerocopyReceiveMinBytes = 64 * 1024;
+// Give up on zerocopy receive after this many consecutive attempts that
+// mapped nothing (e.g. the peer's data never lands page aligned).
+constexpr int kZerocopyReceiveMaxMisses = 16;
+
+struct ZerocopyReceiveMapping {
+  void* addr;
+  size_t length;
+};
+
+void UnmapZerocopyReceiveMapping(void* arg) {
+  auto* mapping = static_cast<ZerocopyReceiveMapping*>(arg);
+  munmap(mapping->addr, mapping->length);
+  delete mapping;
+}
+}  // namespace
+
+bool PosixEndpointImpl::TcpDoZerocopyReceive(size_t& read_bytes) {
+  static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const size_t map_length = incoming_buffer_->Length() & ~(page_size - 1);
+  if (map_length < kZerocopyReceiveMinBytes) return false;
+  const int fd = handle_->WrappedFd().fd();
+  // Map a fresh region per read: the kernel replaces mappings on reuse, and
+  // slices delivered upward may outlive the next read. The slice destroyer
+  // unmaps. mmap on a TCP socket only succeeds on kernels with receive
+  // queue mapping support, so a failure here disables the path for good.
+  void* addr = mmap(nullptr, map_length, PROT_READ, MAP_SHARED, fd, 0);
+  if (addr == MAP_FAILED) {
+    zerocopy_receive_enabled_ = false;
+    return false;
+  }
+  TcpZerocopyReceiveParams zc;
+  memset(&zc, 0, sizeof(zc));
+  zc.address = reinterpret_cast<uint64_t>(reinterpret_cast<uintptr_t>(addr));
+  zc.length = static_cast<uint32_t>(map_length);
+  socklen_t zc_length = sizeof(zc);
+  if (getsockopt(fd, IPPROTO_TCP, TCP_ZEROCOPY_RECEIVE, &zc, &zc_length) !=
+      0) {
+    munmap(addr, map_length);
+    zerocopy_receive_enabled_ = false;
+    return false;
+  }
+  if (zc.length == 0) {
+    // Nothing page aligned at the queue head right now; recvmsg will make
+    // progress (including the recv_skip_hint bytes) and realign us.
+    munmap(addr, map_length);
+    if (++zerocopy_receive_misses_ >= kZerocopyReceiveMaxMisses) {
+      zerocopy_receive_enabled_ = false;
+    }
+    return false;
+  }
+  zerocopy_receive_misses_ = 0;
+  // Deliver the mapped pages ahead of the (unused) preallocated read slices
+  // so the common epilogue of TcpDoRead can trim as usual.
+  auto* mapping = new ZerocopyReceiveMapping{addr, map_length};
+  SliceBuffer spare;
+  incoming_buffer_->Swap(spare);
+  incoming_buffer_->Append(Slice(grpc_slice_new_with_user_data(
+      addr, zc.length, UnmapZerocopyReceiveMapping, mapping)));
+  spare.MoveFirstNBytesIntoSliceBuffer(spare.Length(), *incoming_buffer_);
+  read_bytes = zc.length;
+  grpc_core::global_stats().IncrementTcpReadSize(zc.length);
+  AddToEstimate(zc.length);
+  // The receive queue was not drained to EAGAIN; the next read must assume
+  // there is something to read.
+  inq_ = 1;
+  return true;
+}
+
+#endif  // GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+
 // Returns true if data available to read or error other than EAGAIN.
 bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
   GRPC_LATENT_SEE_INNER_SCOPE("TcpDoRead");
@@ -313,6 +420,14 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
   CHECK_NE(incoming_buffer_->Length(), 0u);
   DCHECK_GT(min_progress_size_, 0);
 
+#ifdef GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+  // Large reads may map receive queue pages in place of the copying loop
+  // below; on success the common epilogue after the loop still runs.
+  if (zerocopy_receive_enabled_ &&
+      TcpDoZerocopyReceive(total_read_bytes)) {
+    status = absl::OkStatus();
+  } else
+#endif  // GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
   do {
     // Assume there is something on the queue. If we receive TCP_INQ from
     // kernel, we will update this value, otherwise, we have to assume there is
@@ -470,6 +585,7 @@ void PosixEndpointImpl::PerformReclamation() {
   if (incoming_buffer_ != nullptr) {
     incoming_buffer_->Clear();
   }
+  recycled_read_slices_.clear();
   has_posted_reclaimer_ = false;
   read_mu_.Unlock();
 }
@@ -532,18 +648,46 @@ void PosixEndpointImpl::UpdateRcvLowat() {
   }
 }
 
+bool PosixEndpointImpl::TryRecycleReadSlice(size_t length) {
+  for (auto& slice : recycled_read_slices_) {
+    if (slice.size() != length) continue;
+    // The pool holds the only reference iff every sub-slice handed to the
+    // application (and any tail parked in last_read_buffer_) has been
+    // destroyed, so the whole buffer may be overwritten by the next read.
+    // Read buffers are always large enough to be refcounted.
+    if (!slice.c_slice().refcount->IsUnique()) continue;
+    incoming_buffer_->AppendIndexed(slice.Ref());
+    return true;
+  }
+  return false;
+}
+
 void PosixEndpointImpl::MaybeMakeReadSlices() {
   static const int kBigAlloc = 64 * 1024;
   static const int kSmallAlloc = 8 * 1024;
+  // Upper bound on the number of buffers parked in recycled_read_slices_
+  // awaiting reuse.
+  static const size_t kMaxRecycledReadSlices = 8;
+  // Below this pressure the full adaptive read target is speculatively
+  // allocated; above kHighSpeculativePressure reads shrink to
+  // min_progress_size_; in between the speculative part ramps down linearly
+  // so read buffers thin out well before the reclaimer has to step in.
+  static const double kLowSpeculativePressure = 0.2;
+  static const double kHighSpeculativePressure = 0.8;
   if (incoming_buffer_->Length() < std::max<size_t>(min_progress_size_, 1)) {
     size_t allocate_length = min_progress_size_;
-    const size_t target_length = static_cast<size_t>(target_length_);
-    // If memory pressure is low and we think there will be more than
-    // min_progress_size bytes to read, allocate a bit more.
-    const bool low_memory_pressure =
-        memory_owner_.GetPressureInfo().pressure_control_value < 0.8;
-    if (low_memory_pressure && target_length > allocate_length) {
-      allocate_length = target_length;
+    const double pressure =
+        memory_owner_.GetPressureInfo().pressure_control_value;
+    const bool low_memory_pressure = pressure < kHighSpeculativePressure;
+    if (low_memory_pressure) {
+      // If we think there will be more than min_progress_size bytes to read,
+      // allocate as much more as the current memory pressure permits.
+      const size_t target_length = static_cast<size_t>(
+          pressure <= kLowSpeculativePressure
+              ? target_length_
+              : target_length_ * (kHighSpeculativePressure - pressure) /
+                    (kHighSpeculativePressure - kLowSpeculativePressure));
+      if (target_length > allocate_length) allocate_length = target_length;
     }
     int extra_wanted = std::max<int>(
         1, allocate_length - static_cast<int>(incoming_buffer_->Length()));
@@ -551,15 +695,23 @@ void PosixEndpointImpl::MaybeMakeReadSlices() {
         (low_memory_pressure ? kSmallAlloc * 3 / 2 : kBigAlloc)) {
       while (extra_wanted > 0) {
         extra_wanted -= kBigAlloc;
-        incoming_buffer_->AppendIndexed(
-            Slice(memory_owner_.MakeSlice(kBigAlloc)));
+        if (TryRecycleReadSlice(kBigAlloc)) continue;
+        Slice slice(memory_owner_.MakeSlice(kBigAlloc));
+        if (recycled_read_slices_.size() < kMaxRecycledReadSlices) {
+          recycled_read_slices_.push_back(slice.Ref());
+        }
+        incoming_buffer_->AppendIndexed(std::move(slice));
         grpc_core::global_stats().IncrementTcpReadAlloc64k();
       }
     } else {
       while (extra_wanted > 0) {
         extra_wanted -= kSmallAlloc;
-        incoming_buffer_->AppendIndexed(
-            Slice(memory_owner_.MakeSlice(kSmallAlloc)));
+        if (TryRecycleReadSlice(kSmallAlloc)) continue;
+        Slice slice(memory_owner_.MakeSlice(kSmallAlloc));
+        if (recycled_read_slices_.size() < kMaxRecycledReadSlices) {
+          recycled_read_slices_.push_back(slice.Ref());
+        }
+        incoming_buffer_->AppendIndexed(std::move(slice));
         grpc_core::global_stats().IncrementTcpReadAlloc8k();
       }
     }
@@ -575,12 +727,20 @@ bool PosixEndpointImpl::HandleReadLocked(absl::Status& status) {
       // We've consumed the edge, request a new one.
       return false;
     }
+    if (status.ok() && min_coalesce_read_bytes_ > 0) {
+      // Stitch runs of small slices together before handing the buffer to
+      // the caller so downstream parsers see contiguous data.
+      grpc_slice_buffer_coalesce(
+          incoming_buffer_->c_slice_buffer(),
+          static_cast<size_t>(min_coalesce_read_bytes_));
+    }
   } else {
     if (!memory_owner_.is_valid() && status.ok()) {
       status = TcpAnnotateError(absl::UnknownError("Shutting down endpoint"));
     }
     incoming_buffer_->Clear();
     last_read_buffer_.Clear();
+    recycled_read_slices_.clear();
   }
   return true;
 }
@@ -699,6 +859,18 @@ TcpZerocopySendRecord* PosixEndpointImpl::TcpGetSendZerocopyRecord(
 // For linux platforms, reads the socket's error queue and processes error
 // messages from the queue.
 bool PosixEndpointImpl::ProcessErrors() {
+  std::vector<TracedBufferList::TimestampedEvent> timestamp_batch;
+  const bool processed_err = DrainErrorQueue(timestamp_batch);
+  // Match the entire drain against the traced buffers under a single lock
+  // acquisition rather than once per timestamp.
+  if (!timestamp_batch.empty()) {
+    traced_buffers_.ProcessTimestamps(timestamp_batch);
+  }
+  return processed_err;
+}
+
+bool PosixEndpointImpl::DrainErrorQueue(
+    std::vector<TracedBufferList::TimestampedEvent>& timestamp_batch) {
   bool processed_err = false;
   struct iovec iov;
   iov.iov_base = nullptr;
@@ -751,7 +923,7 @@ bool PosixEndpointImpl::ProcessErrors() {
         processed_err = true;
       } else if (cmsg->cmsg_level == SOL_SOCKET &&
                  cmsg->cmsg_type == SCM_TIMESTAMPING) {
-        cmsg = ProcessTimestamp(&msg, cmsg);
+        cmsg = ProcessTimestamp(&msg, cmsg, timestamp_batch);
         seen = true;
         processed_err = true;
       } else {
@@ -802,8 +974,9 @@ void PosixEndpointImpl::ProcessZerocopy(struct cmsghdr* cmsg) {
 // in \a msg. \a cmsg should point to the control message that the caller wants
 // processed. On return, a pointer to a control message is returned. On the next
 // iteration, CMSG_NXTHDR(msg, ret_val) should be passed as \a cmsg.
-struct cmsghdr* PosixEndpointImpl::ProcessTimestamp(msghdr* msg,
-                                                    struct cmsghdr* cmsg) {
+struct cmsghdr* PosixEndpointImpl::ProcessTimestamp(
+    msghdr* msg, struct cmsghdr* cmsg,
+    std::vector<TracedBufferList::TimestampedEvent>& timestamp_batch) {
   auto next_cmsg = CMSG_NXTHDR(msg, cmsg);
   cmsghdr* opt_stats = nullptr;
   if (next_cmsg == nullptr) {
@@ -833,7 +1006,8 @@ struct cmsghdr* PosixEndpointImpl::ProcessTimestamp(msghdr* msg,
     LOG(ERROR) << "Unexpected control message";
     return cmsg;
   }
-  traced_buffers_.ProcessTimestamp(serr, opt_stats, tss);
+  timestamp_batch.push_back(
+      TracedBufferList::MakeTimestampedEvent(serr, opt_stats, tss));
   return next_cmsg;
 }
 
@@ -1163,6 +1337,12 @@ void PosixEndpointImpl::HandleWrite(absl::Status status) {
       UnrefMaybePutZerocopySendRecord(current_zerocopy_send_);
       current_zerocopy_send_ = nullptr;
     }
+    urgent_staging_.Clear();
+    {
+      grpc_core::MutexLock lock(&urgent_mu_);
+      urgent_buffer_.Clear();
+      write_in_flight_ = false;
+    }
     cb_(status);
     Unref();
     return;
@@ -1174,11 +1354,39 @@ void PosixEndpointImpl::HandleWrite(absl::Status status) {
     DCHECK(status.ok());
     handle_->NotifyOnWrite(on_write_);
   } else {
+    current_zerocopy_send_ = nullptr;
+    // Flush any bytes accepted on the urgent lane while this write was in
+    // flight before running the completion callback, so they do not wait
+    // for the caller's next write cycle. The final empty-check and the
+    // clearing of write_in_flight_ happen under the same lock acquisition so
+    // a concurrent WriteUrgent() either lands in this flush or is refused.
+    while (true) {
+      {
+        grpc_core::MutexLock lock(&urgent_mu_);
+        if (!status.ok() || urgent_buffer_.Length() == 0) {
+          if (!status.ok()) urgent_buffer_.Clear();
+          write_in_flight_ = false;
+          break;
+        }
+        while (urgent_buffer_.Count() > 0) {
+          urgent_staging_.Append(urgent_buffer_.TakeFirst());
+        }
+      }
+      GRPC_TRACE_LOG(event_engine_endpoint, INFO)
+          << "Endpoint[" << this << "]: Flushing "
+          << urgent_staging_.Length() << " urgent bytes";
+      outgoing_buffer_ = &urgent_staging_;
+      outgoing_byte_idx_ = 0;
+      if (!TcpFlush(status)) {
+        DCHECK(status.ok());
+        handle_->NotifyOnWrite(on_write_);
+        return;
+      }
+    }
     GRPC_TRACE_LOG(event_engine_endpoint, INFO)
         << "Endpoint[" << this << "]: Write complete: " << status;
     absl::AnyInvocable<void(absl::Status)> cb_ = std::move(write_cb_);
     write_cb_ = nullptr;
-    current_zerocopy_send_ = nullptr;
     cb_(status);
     Unref();
   }
@@ -1219,7 +1427,8 @@ bool PosixEndpointImpl::Write(
     outgoing_buffer_ = data;
     outgoing_byte_idx_ = 0;
   }
-  if (args.has_metrics_sink() && poller_->CanTrackErrors()) {
+  if (args.has_metrics_sink() && poller_->CanTrackErrors() &&
+      SampleTxTimestamps()) {
     outgoing_buffer_write_event_sink_ = args.TakeMetricsSink();
   }
 
@@ -1230,6 +1439,12 @@ bool PosixEndpointImpl::Write(
     Ref().release();
     write_cb_ = std::move(on_writable);
     current_zerocopy_send_ = zerocopy_send_record;
+    {
+      // Open the urgent lane: WriteUrgent() calls may now be accepted and
+      // will be flushed by HandleWrite() once this write drains.
+      grpc_core::MutexLock lock(&urgent_mu_);
+      write_in_flight_ = true;
+    }
     handle_->NotifyOnWrite(on_write_);
     return false;
   }
@@ -1251,6 +1466,21 @@ bool PosixEndpointImpl::Write(
   return true;
 }
 
+bool PosixEndpointImpl::WriteUrgent(SliceBuffer* data) {
+  grpc_core::MutexLock lock(&urgent_mu_);
+  if (!write_in_flight_) {
+    // Nothing to jump ahead of: the caller should use a regular Write().
+    return false;
+  }
+  GRPC_TRACE_LOG(event_engine_endpoint, INFO)
+      << "Endpoint[" << this << "]: WriteUrgent " << data->Length()
+      << " bytes";
+  while (data->Count() > 0) {
+    urgent_buffer_.Append(data->TakeFirst());
+  }
+  return true;
+}
+
 void PosixEndpointImpl::MaybeShutdown(
     absl::Status why,
     absl::AnyInvocable<void(absl::StatusOr<int>)> on_release_fd) {
@@ -1280,6 +1510,12 @@ PosixEndpointImpl ::~PosixEndpointImpl() {
   delete on_read_;
   delete on_write_;
   delete on_error_;
+#ifdef GRPC_HAVE_SPLICE
+  if (splice_pipe_[0] != -1) {
+    close(splice_pipe_[0]);
+    close(splice_pipe_[1]);
+  }
+#endif  // GRPC_HAVE_SPLICE
 }
 
 PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
@@ -1311,6 +1547,8 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
   bytes_read_this_round_ = 0;
   min_read_chunk_size_ = options.tcp_min_read_chunk_size;
   max_read_chunk_size_ = options.tcp_max_read_chunk_size;
+  min_coalesce_read_bytes_ = options.tcp_min_coalesce_read_bytes;
+  tx_timestamp_sampling_period_ = options.tcp_tx_timestamp_sampling_period;
   bool zerocopy_enabled =
       options.tcp_tx_zero_copy_enabled && poller_->CanTrackErrors();
 #ifdef GRPC_LINUX_ERRQUEUE
@@ -1353,6 +1591,12 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
   inq_capable_ = false;
 #endif  // GRPC_HAVE_TCP_INQ
 
+#ifdef GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+  // Kernel support is probed on first use: the receive queue mmap fails on
+  // kernels without TCP_ZEROCOPY_RECEIVE and the flag clears itself.
+  zerocopy_receive_enabled_ = options.tcp_rx_zero_copy_enabled;
+#endif  // GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+
   on_read_ = PosixEngineClosure::ToPermanentClosure(
       [this](absl::Status status) { HandleRead(std::move(status)); });
   on_write_ = PosixEngineClosure::ToPermanentClosure(
@@ -1394,6 +1638,135 @@ class PosixEndpointTelemetryInfo : public EventEngine::Endpoint::TelemetryInfo {
 };
 }  // namespace
 
+void PosixEndpointImpl::AddChannelzData(grpc_core::channelz::DataSink& sink) {
+#ifdef GRPC_LINUX_ERRQUEUE
+  tcp_info info;
+  if (!GetSocketTcpInfo(&info, &poller_->posix_interface(),
+                        handle_->WrappedFd())
+           .ok()) {
+    return;
+  }
+  grpc_core::channelz::PropertyList properties;
+  properties.Set("rtt_us", info.tcpi_rtt)
+                        .Set("rttvar_us", info.tcpi_rttvar)
+                        .Set("snd_cwnd", info.tcpi_snd_cwnd)
+                        .Set("snd_mss", info.tcpi_snd_mss)
+                        .Set("recurring_retrans", info.tcpi_retransmits)
+                        .Set("total_retrans", info.tcpi_total_retrans)
+                        .Set("lost", info.tcpi_lost)
+                        .Set("unacked", info.tcpi_unacked)
+                        .Set("reordering", info.tcpi_reordering);
+  // Mirror the field availability guards used when extracting opt stats in
+  // traced_buffer_list.cc: older kernels return a shorter struct.
+  if (info.length > offsetof(tcp_info, tcpi_sndbuf_limited)) {
+    properties.Set("min_rtt_us", info.tcpi_min_rtt)
+        .Set("delivery_rate_bytes_per_sec", info.tcpi_delivery_rate)
+        .Set("delivery_rate_app_limited",
+             info.tcpi_delivery_rate_app_limited != 0)
+        .Set("pacing_rate_bytes_per_sec", info.tcpi_pacing_rate)
+        .Set("notsent_bytes", info.tcpi_notsent_bytes)
+        .Set("busy_time_us", info.tcpi_busy_time)
+        .Set("rwnd_limited_us", info.tcpi_rwnd_limited)
+        .Set("sndbuf_limited_us", info.tcpi_sndbuf_limited);
+  }
+  if (info.length > offsetof(tcp_info, tcpi_dsack_dups)) {
+    properties.Set("bytes_sent", info.tcpi_bytes_sent)
+        .Set("bytes_retrans", info.tcpi_bytes_retrans)
+        .Set("dsack_dups", info.tcpi_dsack_dups);
+  }
+  sink.AddData("tcp_info", std::move(properties));
+#else   // GRPC_LINUX_ERRQUEUE
+  (void)sink;
+#endif  // GRPC_LINUX_ERRQUEUE
+}
+
+#ifdef GRPC_HAVE_SPLICE
+absl::StatusOr<size_t> PosixEndpointImpl::SpliceTo(int destination_fd,
+                                                   size_t max_bytes) {
+  static constexpr unsigned int kSpliceFlags =
+      SPLICE_F_MOVE | SPLICE_F_NONBLOCK;
+  if (splice_pipe_[0] == -1) {
+    if (pipe2(splice_pipe_, O_NONBLOCK | O_CLOEXEC) != 0) {
+      return absl::UnimplementedError(
+          absl::StrCat("pipe2: ", grpc_core::StrError(errno)));
+    }
+  }
+  size_t delivered = 0;
+  // Deliver bytes parked by an earlier flow-controlled call before
+  // accepting anything new from the socket, preserving stream order.
+  size_t parked = splice_buffered_bytes_.load(std::memory_order_relaxed);
+  while (parked > 0) {
+    ssize_t n = splice(splice_pipe_[0], nullptr, destination_fd, nullptr,
+                       parked, kSpliceFlags);
+    if (n > 0) {
+      parked -= static_cast<size_t>(n);
+      delivered += static_cast<size_t>(n);
+      continue;
+    }
+    if (n < 0 && errno == EINTR) continue;
+    splice_buffered_bytes_.store(parked, std::memory_order_relaxed);
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return delivered;
+    return absl::InternalError(
+        absl::StrCat("splice (pipe -> socket): ", grpc_core::StrError(errno)));
+  }
+  splice_buffered_bytes_.store(0, std::memory_order_relaxed);
+  const int source_fd = handle_->WrappedFd().fd();
+  while (delivered < max_bytes) {
+    ssize_t in = splice(source_fd, nullptr, splice_pipe_[1], nullptr,
+                        max_bytes - delivered, kSpliceFlags);
+    if (in < 0) {
+      if (errno == EINTR) continue;
+      if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+      return absl::InternalError(absl::StrCat("splice (socket -> pipe): ",
+                                              grpc_core::StrError(errno)));
+    }
+    if (in == 0) {
+      // End of stream; report progress first, surface it on the next call.
+      if (delivered > 0) break;
+      return absl::UnavailableError("end of stream");
+    }
+    size_t pending = static_cast<size_t>(in);
+    while (pending > 0) {
+      ssize_t out = splice(splice_pipe_[0], nullptr, destination_fd, nullptr,
+                           pending, kSpliceFlags);
+      if (out > 0) {
+        pending -= static_cast<size_t>(out);
+        delivered += static_cast<size_t>(out);
+        continue;
+      }
+      if (out < 0 && errno == EINTR) continue;
+      // Destination flow-controlled (or broken): the remainder stays
+      // parked in the pipe for the next call to deliver first.
+      splice_buffered_bytes_.store(pending, std::memory_order_relaxed);
+      if (out < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+        return delivered;
+      }
+      return absl::InternalError(absl::StrCat("splice (pipe -> socket): ",
+                                              grpc_core::StrError(errno)));
+    }
+  }
+  return delivered;
+}
+#endif  // GRPC_HAVE_SPLICE
+
+#ifdef GRPC_HAVE_SO_MAX_PACING_RATE
+absl::Status PosixEndpointImpl::SetMaxPacingRate(uint64_t max_rate) {
+  // The kernel reads the option as an unsigned int; the all-ones value is
+  // line rate, which is also how "no cap" is expressed.
+  uint32_t rate = std::numeric_limits<uint32_t>::max();
+  if (max_rate != 0 && max_rate < rate) {
+    rate = static_cast<uint32_t>(max_rate);
+  }
+  auto result = poller_->posix_interface().SetSockOpt(
+      handle_->WrappedFd(), SOL_SOCKET, SO_MAX_PACING_RATE, rate);
+  if (!result.ok()) {
+    return absl::InternalError(absl::StrCat(
+        "setsockopt(SO_MAX_PACING_RATE): ", result.StrError()));
+  }
+  return absl::OkStatus();
+}
+#endif  // GRPC_HAVE_SO_MAX_PACING_RATE
+
 std::shared_ptr<EventEngine::Endpoint::TelemetryInfo>
 PosixEndpoint::GetTelemetryInfo() const {
   static absl::NoDestructor<std::shared_ptr<PosixEndpointTelemetryInfo>>
@@ -21,6 +21,7 @@
 
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/event_engine/memory_allocator.h>
+#include <grpc/event_engine/slice.h>
 #include <grpc/event_engine/slice_buffer.h>
 #include <grpc/support/alloc.h>
 
@@ -28,6 +29,7 @@
 #include <cstdint>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_map.h"
@@ -36,11 +38,16 @@
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "src/core/lib/event_engine/extensions/channelz.h"
+#include "src/core/lib/event_engine/extensions/pacing.h"
+#include "src/core/lib/event_engine/extensions/splice.h"
+#include "src/core/lib/event_engine/extensions/urgent_write.h"
 #include "src/core/lib/event_engine/posix.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
 #include "src/core/lib/event_engine/posix_engine/traced_buffer_list.h"
+#include "src/core/lib/event_engine/query_extensions.h"
 #include "src/core/lib/iomgr/port.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/util/crash.h"
@@ -475,6 +482,9 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
       absl::AnyInvocable<void(absl::Status)> on_writable,
       grpc_event_engine::experimental::SliceBuffer* data,
       grpc_event_engine::experimental::EventEngine::Endpoint::WriteArgs args);
+  // Queues data on the urgent lane; see EndpointUrgentWriteExtension.
+  // Returns false (leaving data untouched) if no write is in flight.
+  bool WriteUrgent(grpc_event_engine::experimental::SliceBuffer* data);
   const grpc_event_engine::experimental::EventEngine::ResolvedAddress&
   GetPeerAddress() const {
     return peer_address_;
@@ -488,6 +498,30 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
 
   bool CanTrackErrors() const { return poller_->CanTrackErrors(); }
 
+  // Samples kernel TCP state (TCP_INFO) for this connection and reports it
+  // into the channelz data sink; a no-op on platforms without TCP_INFO.
+  void AddChannelzData(grpc_core::channelz::DataSink& sink);
+
+#ifdef GRPC_HAVE_SPLICE
+  // Endpoint-to-endpoint passthrough (see EndpointSpliceExtension): moves
+  // up to max_bytes from this socket's receive queue into destination_fd's
+  // send queue through the relay pipe, delivering bytes parked by an
+  // earlier flow-controlled call ahead of new socket data. Per the
+  // extension contract the caller must not run this concurrently with a
+  // Read() on this endpoint.
+  absl::StatusOr<size_t> SpliceTo(int destination_fd, size_t max_bytes);
+
+  size_t SpliceBufferedBytes() const {
+    return splice_buffered_bytes_.load(std::memory_order_relaxed);
+  }
+#endif  // GRPC_HAVE_SPLICE
+
+#ifdef GRPC_HAVE_SO_MAX_PACING_RATE
+  // Caps the socket's transmit rate via SO_MAX_PACING_RATE; see
+  // EndpointPacingExtension. A max_rate of 0 removes the cap.
+  absl::Status SetMaxPacingRate(uint64_t max_rate);
+#endif  // GRPC_HAVE_SO_MAX_PACING_RATE
+
   void MaybeShutdown(
       absl::Status why,
       absl::AnyInvocable<void(absl::StatusOr<int> release_fd)> on_release_fd);
@@ -500,7 +534,21 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   bool HandleReadLocked(absl::Status& status)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void MaybeMakeReadSlices() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  // Re-issues a previously allocated read buffer of exactly `length` bytes
+  // into incoming_buffer_ if the application has dropped all of its
+  // references to it. Returns false if no idle buffer of that size exists
+  // and a fresh allocation is needed.
+  bool TryRecycleReadSlice(size_t length)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   bool TcpDoRead(absl::Status& status) ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+#ifdef GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+  // Attempts to map receive queue pages directly into incoming_buffer_ via
+  // TCP_ZEROCOPY_RECEIVE. Returns true (with read_bytes set) if page-backed
+  // data was delivered; returns false to fall back to the copying read path,
+  // disabling itself when the kernel or socket cannot support the mapping.
+  bool TcpDoZerocopyReceive(size_t& read_bytes)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+#endif  // GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
   void FinishEstimate();
   void AddToEstimate(size_t bytes);
   void MaybePostReclaimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
@@ -520,34 +568,81 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   absl::Status TcpAnnotateError(absl::Status src_error) const;
 #ifdef GRPC_LINUX_ERRQUEUE
   bool ProcessErrors();
+  // Drains the socket error queue, appending extracted timestamp events to
+  // timestamp_batch. Returns true if any error message was processed.
+  bool DrainErrorQueue(
+      std::vector<TracedBufferList::TimestampedEvent>& timestamp_batch);
   // Reads a cmsg to process zerocopy control messages.
   void ProcessZerocopy(struct cmsghdr* cmsg);
   // Reads a cmsg to derive timestamps from the control messages.
-  struct cmsghdr* ProcessTimestamp(msghdr* msg, struct cmsghdr* cmsg);
+  struct cmsghdr* ProcessTimestamp(
+      msghdr* msg, struct cmsghdr* cmsg,
+      std::vector<TracedBufferList::TimestampedEvent>& timestamp_batch);
 #endif  // GRPC_LINUX_ERRQUEUE
+  // Returns true if kernel TX timestamp collection should be attempted for
+  // the write about to start, honoring the configured sampling period.
+  bool SampleTxTimestamps() {
+    if (tx_timestamp_sampling_period_ <= 1) return true;
+    return (tx_timestamp_write_counter_++ %
+            static_cast<uint64_t>(tx_timestamp_sampling_period_)) == 0;
+  }
   grpc_core::Mutex read_mu_;
   bool is_first_read_ = true;
   bool has_posted_reclaimer_ ABSL_GUARDED_BY(read_mu_) = false;
   double target_length_;
   int min_read_chunk_size_;
   int max_read_chunk_size_;
+  // When positive, runs of read slices shorter than this are merged into
+  // contiguous slices before the read callback fires.
+  int min_coalesce_read_bytes_ = 0;
   int64_t set_rcvlowat_ = 0;
   double bytes_read_this_round_ = 0;
 
   // garbage after the last read.
   grpc_event_engine::experimental::SliceBuffer last_read_buffer_;
 
+  // Read buffers eligible for reuse. Each entry keeps one reference to a
+  // buffer handed out by an earlier read; once every sub-slice given to the
+  // application has been destroyed the refcount is unique again and the
+  // buffer can back another read without a fresh allocation. The quota these
+  // buffers reserved against memory_owner_ stays held until the entries are
+  // dropped (on reclamation or endpoint destruction).
+  std::vector<grpc_event_engine::experimental::Slice> recycled_read_slices_
+      ABSL_GUARDED_BY(read_mu_);
+
   grpc_event_engine::experimental::SliceBuffer* incoming_buffer_
       ABSL_GUARDED_BY(read_mu_) = nullptr;
   // bytes pending on the socket from the last read.
   int inq_ = 1;
   // cache whether kernel supports inq.
   bool inq_capable_ = false;
+  // whether TCP_ZEROCOPY_RECEIVE should be attempted for large reads;
+  // cleared at runtime once the kernel or socket proves unable to map the
+  // receive queue.
+  bool zerocopy_receive_enabled_ = false;
+  // consecutive zerocopy receive attempts that mapped nothing; used to stop
+  // paying the probing syscalls on connections whose data never aligns.
+  int zerocopy_receive_misses_ = 0;
 
   grpc_event_engine::experimental::SliceBuffer* outgoing_buffer_ = nullptr;
   // byte within outgoing_buffer's slices[0] to write next.
   size_t outgoing_byte_idx_ = 0;
 
+  // Urgent write lane (see EndpointUrgentWriteExtension): control payloads
+  // accepted via WriteUrgent() while a write is in flight. HandleWrite()
+  // flushes them as soon as the in-flight buffer drains, before the write
+  // completion callback runs, so they skip the completion round trip through
+  // the caller's write loop. The endpoint never reorders them ahead of bytes
+  // it has already accepted — it has no knowledge of the caller's framing.
+  grpc_core::Mutex urgent_mu_;
+  grpc_event_engine::experimental::SliceBuffer urgent_buffer_
+      ABSL_GUARDED_BY(urgent_mu_);
+  bool write_in_flight_ ABSL_GUARDED_BY(urgent_mu_) = false;
+  // Staging buffer the urgent bytes are flushed from; only touched by the
+  // (single-threaded) write path, and may retain unsent slices across an
+  // EAGAIN-induced return to the poller.
+  grpc_event_engine::experimental::SliceBuffer urgent_staging_;
+
   PosixEngineClosure* on_read_ = nullptr;
   PosixEngineClosure* on_write_ = nullptr;
   PosixEngineClosure* on_error_ = nullptr;
@@ -578,6 +673,10 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
 #ifdef GRPC_LINUX_ERRQUEUE
   bool socket_ts_enabled_ = false;
 #endif  // GRPC_LINUX_ERRQUEUE
+  // Trace kernel TX timestamps for only one in every N timestamped writes
+  // (1 traces every such write).
+  int tx_timestamp_sampling_period_ = 1;
+  uint64_t tx_timestamp_write_counter_ = 0;
   // Cache whether we can set timestamping options
   bool ts_capable_ = true;
   // Set to 1 if we do not want to be notified on errors anymore.
@@ -587,6 +686,14 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   // A hint from upper layers specifying the minimum number of bytes that need
   // to be read to make meaningful progress.
   int min_progress_size_ = 1;
+#ifdef GRPC_HAVE_SPLICE
+  // Relay pipe for SpliceTo(), created on first use; [0] is the read end.
+  // Bytes counted by splice_buffered_bytes_ have been consumed from the
+  // socket but are still parked in the pipe awaiting destination send
+  // buffer space.
+  int splice_pipe_[2] = {-1, -1};
+  std::atomic<size_t> splice_buffered_bytes_{0};
+#endif  // GRPC_HAVE_SPLICE
   TracedBufferList traced_buffers_;
   // The handle is owned by the PosixEndpointImpl object.
   EventHandle* handle_;
@@ -594,7 +701,11 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   std::shared_ptr<grpc_event_engine::experimental::EventEngine> engine_;
 };
 
-class PosixEndpoint : public PosixEndpointWithFdSupport {
+class PosixEndpoint : public PosixEndpointWithFdSupport,
+                      public ChannelzExtension,
+                      public EndpointUrgentWriteExtension,
+                      public EndpointSpliceExtension,
+                      public EndpointPacingExtension {
  public:
   PosixEndpoint(
       EventHandle* handle, PosixEngineClosure* on_shutdown,
@@ -604,6 +715,32 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
       : impl_(new PosixEndpointImpl(handle, on_shutdown, std::move(engine),
                                     std::move(allocator), options)) {}
 
+  void* QueryExtension(absl::string_view id) override {
+    if (id == ChannelzExtension::EndpointExtensionName()) {
+      return static_cast<ChannelzExtension*>(this);
+    }
+    if (id == EndpointUrgentWriteExtension::EndpointExtensionName()) {
+      return static_cast<EndpointUrgentWriteExtension*>(this);
+    }
+#ifdef GRPC_HAVE_SPLICE
+    if (id == EndpointSpliceExtension::EndpointExtensionName()) {
+      return static_cast<EndpointSpliceExtension*>(this);
+    }
+#endif  // GRPC_HAVE_SPLICE
+#ifdef GRPC_HAVE_SO_MAX_PACING_RATE
+    if (id == EndpointPacingExtension::EndpointExtensionName()) {
+      return static_cast<EndpointPacingExtension*>(this);
+    }
+#endif  // GRPC_HAVE_SO_MAX_PACING_RATE
+    return PosixEndpointWithFdSupport::QueryExtension(id);
+  }
+
+  // ChannelzExtension: sampled fresh from the kernel on every channelz
+  // query, so scrapes see current TCP state rather than a cached copy.
+  void AddJson(grpc_core::channelz::DataSink& sink) override {
+    impl_->AddChannelzData(sink);
+  }
+
   bool Read(absl::AnyInvocable<void(absl::Status)> on_read,
             grpc_event_engine::experimental::SliceBuffer* buffer,
             grpc_event_engine::experimental::EventEngine::Endpoint::ReadArgs
@@ -618,6 +755,50 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
     return impl_->Write(std::move(on_writable), data, std::move(args));
   }
 
+  bool WriteUrgent(
+      grpc_event_engine::experimental::SliceBuffer* data) override {
+    return impl_->WriteUrgent(data);
+  }
+
+  // EndpointSpliceExtension: only advertised via QueryExtension on
+  // platforms with splice(2); the overrides themselves compile everywhere.
+  absl::StatusOr<size_t> SpliceTo(EventEngine::Endpoint* destination,
+                                  size_t max_bytes) override {
+#ifdef GRPC_HAVE_SPLICE
+    auto* destination_fd_support =
+        grpc_event_engine::experimental::QueryExtension<
+            PosixEndpointWithFdSupport>(destination);
+    if (destination_fd_support == nullptr) {
+      return absl::UnimplementedError(
+          "splice destination does not expose a file descriptor");
+    }
+    return impl_->SpliceTo(destination_fd_support->GetWrappedFd(), max_bytes);
+#else
+    (void)destination;
+    (void)max_bytes;
+    return absl::UnimplementedError("splice is not supported");
+#endif  // GRPC_HAVE_SPLICE
+  }
+
+  size_t SpliceBufferedBytes() const override {
+#ifdef GRPC_HAVE_SPLICE
+    return impl_->SpliceBufferedBytes();
+#else
+    return 0;
+#endif  // GRPC_HAVE_SPLICE
+  }
+
+  // EndpointPacingExtension: only advertised via QueryExtension on
+  // platforms with SO_MAX_PACING_RATE.
+  absl::Status SetMaxPacingRate(uint64_t max_rate) override {
+#ifdef GRPC_HAVE_SO_MAX_PACING_RATE
+    return impl_->SetMaxPacingRate(max_rate);
+#else
+    (void)max_rate;
+    return absl::UnimplementedError("pacing is not supported");
+#endif  // GRPC_HAVE_SO_MAX_PACING_RATE
+  }
+
   std::shared_ptr<EventEngine::Endpoint::TelemetryInfo> GetTelemetryInfo()
       const override;
 
@@ -637,6 +818,9 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
   void Shutdown(absl::AnyInvocable<void(absl::StatusOr<int> release_fd)>
                     on_release_fd) override {
     if (!shutdown_.exchange(true, std::memory_order_acq_rel)) {
+      // Unregister from channelz before the impl starts tearing down so no
+      // query can sample a closing socket.
+      ShutdownChannelzExtension();
       impl_->MaybeShutdown(absl::FailedPreconditionError("Endpoint closing"),
                            std::move(on_release_fd));
     }
@@ -644,6 +828,7 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
 
   ~PosixEndpoint() override {
     if (!shutdown_.exchange(true, std::memory_order_acq_rel)) {
+      ShutdownChannelzExtension();
       impl_->MaybeShutdown(absl::FailedPreconditionError("Endpoint closing"),
                            nullptr);
     }
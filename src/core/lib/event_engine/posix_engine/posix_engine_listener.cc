@@ -31,6 +31,7 @@
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "absl/functional/any_invocable.h"
 #include "absl/log/check.h"
@@ -304,11 +305,50 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::Shutdown() {
   Unref();
 }
 
+void PosixEngineListenerImpl::ShardAcceptorsLocked() {
+  const int shards = options_.listener_accept_shards;
+  if (shards <= 1) return;
+  if (!IsSocketReusePortSupported() || !options_.allow_reuse_port) return;
+  EventEnginePosixInterface& posix_interface = poller_->posix_interface();
+  // Snapshot the current acceptors: Append() extends acceptors_, and the
+  // clones themselves must not be re-sharded.
+  std::vector<AsyncConnectionAcceptor*> originals(acceptors_.begin(),
+                                                  acceptors_.end());
+  for (auto* acceptor : originals) {
+    EventEngine::ResolvedAddress addr = acceptor->Socket().addr;
+    if (addr.address()->sa_family == AF_UNIX || ResolvedAddressIsVSock(addr)) {
+      continue;
+    }
+    // The stored address may carry a wildcard port; the clones must bind to
+    // the port that was actually chosen.
+    ResolvedAddressSetPort(addr, acceptor->Socket().port);
+    for (int i = 1; i < shards; i++) {
+      auto socket =
+          CreateAndPrepareListenerSocket(&posix_interface, options_, addr);
+      if (!socket.ok()) {
+        // Non-fatal: the shards that did get created (and the original
+        // socket) keep accepting.
+        LOG(ERROR) << "Failed to create accept shard " << i << " of " << shards
+                   << " for " << ResolvedAddressToNormalizedString(addr)
+                          .value_or("<unknown>")
+                   << ": " << socket.status();
+        break;
+      }
+      acceptors_.Append(*socket);
+    }
+  }
+}
+
 absl::Status PosixEngineListenerImpl::Start() {
   grpc_core::MutexLock lock(&this->mu_);
   // Start each asynchronous acceptor.
   CHECK(!this->started_);
   this->started_ = true;
+  // With SO_REUSEPORT sharding, the kernel distributes incoming connections
+  // across the per-address clones created here, and each accepted
+  // connection's fd, poller registration, and endpoint are set up by
+  // whichever poller thread serviced that shard.
+  ShardAcceptorsLocked();
   for (auto it = acceptors_.begin(); it != acceptors_.end(); it++) {
     (*it)->Start();
   }
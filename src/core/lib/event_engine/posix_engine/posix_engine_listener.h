@@ -175,6 +175,10 @@ class PosixEngineListenerImpl
   };
   friend class ListenerAsyncAcceptors;
   friend class AsyncConnectionAcceptor;
+  // When accept sharding is enabled, creates additional SO_REUSEPORT
+  // listening sockets for each bound TCP address so the kernel spreads
+  // incoming connections across several accepting fds.
+  void ShardAcceptorsLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
   // The mutex ensures thread safety when multiple threads try to call Bind
   // and Start in parallel.
   grpc_core::Mutex mu_;
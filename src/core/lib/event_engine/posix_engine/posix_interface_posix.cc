@@ -378,6 +378,81 @@ void TrySetSocketTcpUserTimeout(int fd, const PosixTcpOptions& options,
   }
 }
 
+// Set SO_BUSY_POLL (and, when available, SO_PREFER_BUSY_POLL) so the kernel
+// busy-polls the device queue for this socket. Best effort: older kernels do
+// not support these options and busy polling is purely a latency optimization,
+// so failures are logged rather than surfaced.
+void TrySetSocketBusyPoll(int fd, const PosixTcpOptions& options) {
+#ifdef GPR_LINUX
+  if (options.tcp_busy_poll_usec <= 0) {
+    return;
+  }
+#ifndef SO_BUSY_POLL
+#define SO_BUSY_POLL 46
+#endif
+#ifndef SO_PREFER_BUSY_POLL
+#define SO_PREFER_BUSY_POLL 69
+#endif
+  if (0 != setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL,
+                      &options.tcp_busy_poll_usec,
+                      sizeof(options.tcp_busy_poll_usec))) {
+    VLOG(2) << "setsockopt(SO_BUSY_POLL) " << grpc_core::StrError(errno)
+            << ", continuing.";
+    return;
+  }
+  int prefer = 1;
+  if (0 != setsockopt(fd, SOL_SOCKET, SO_PREFER_BUSY_POLL, &prefer,
+                      sizeof(prefer))) {
+    // Requires a 5.11+ kernel; SO_BUSY_POLL alone is still effective.
+    VLOG(2) << "setsockopt(SO_PREFER_BUSY_POLL) " << grpc_core::StrError(errno)
+            << ", continuing.";
+  }
+#else   // GPR_LINUX
+  (void)fd;
+  (void)options;
+#endif  // GPR_LINUX
+}
+
+// Enable TCP Fast Open. Listeners accept TFO connections (TCP_FASTOPEN);
+// clients arm TCP_FASTOPEN_CONNECT so that, once a cookie for the server is
+// cached, connect() returns immediately and the first write - the security
+// handshake's first flight - rides in the SYN payload. Best effort: older
+// kernels do not support these options, so failures are logged rather than
+// surfaced.
+void TrySetSocketFastOpen(int fd, const PosixTcpOptions& options,
+                          bool is_client) {
+#ifdef GPR_LINUX
+  if (!options.tcp_fast_open_enabled) {
+    return;
+  }
+#ifndef TCP_FASTOPEN
+#define TCP_FASTOPEN 23
+#endif
+#ifndef TCP_FASTOPEN_CONNECT
+#define TCP_FASTOPEN_CONNECT 30
+#endif
+  if (is_client) {
+    int enable = 1;
+    if (0 != setsockopt(fd, IPPROTO_TCP, TCP_FASTOPEN_CONNECT, &enable,
+                        sizeof(enable))) {
+      VLOG(2) << "setsockopt(TCP_FASTOPEN_CONNECT) "
+              << grpc_core::StrError(errno) << ", continuing.";
+    }
+  } else {
+    // Length of the queue of TFO connections with not-yet-validated cookies.
+    int qlen = 1024;
+    if (0 != setsockopt(fd, IPPROTO_TCP, TCP_FASTOPEN, &qlen, sizeof(qlen))) {
+      VLOG(2) << "setsockopt(TCP_FASTOPEN) " << grpc_core::StrError(errno)
+              << ", continuing.";
+    }
+  }
+#else   // GPR_LINUX
+  (void)fd;
+  (void)options;
+  (void)is_client;
+#endif  // GPR_LINUX
+}
+
 absl::StatusOr<int> InternalCreateDualStackSocket(
     std::function<int(int, int, int)> socket_factory,
     const experimental::EventEngine::ResolvedAddress& addr, int type,
@@ -829,6 +904,8 @@ EventEnginePosixInterface::PrepareListenerSocket(
         SetSocketOption(f, SOL_SOCKET, SO_REUSEADDR, 1, "SO_REUSEADDR"));
     GRPC_RETURN_IF_ERROR(SetSocketDscp(f, options.dscp));
     TrySetSocketTcpUserTimeout(f, options, false);
+    TrySetSocketBusyPoll(f, options);
+    TrySetSocketFastOpen(f, options, false);
   }
   GRPC_RETURN_IF_ERROR(InternalSetSocketNoSigpipeIfPossible(f));
   GRPC_RETURN_IF_ERROR(InternalApplySocketMutatorInOptions(
@@ -994,6 +1071,8 @@ absl::Status EventEnginePosixInterface::PrepareTcpClientSocket(
         SetSocketOption(fd, SOL_SOCKET, SO_REUSEADDR, 1, "SO_REUSEADDR"));
     GRPC_RETURN_IF_ERROR(SetSocketDscp(fd, options.dscp));
     TrySetSocketTcpUserTimeout(fd, options, true);
+    TrySetSocketBusyPoll(fd, options);
+    TrySetSocketFastOpen(fd, options, true);
   }
   GRPC_RETURN_IF_ERROR(InternalSetSocketNoSigpipeIfPossible(fd));
   GRPC_RETURN_IF_ERROR(InternalApplySocketMutatorInOptions(
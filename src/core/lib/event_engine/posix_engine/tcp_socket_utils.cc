@@ -96,6 +96,17 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
   options.tcp_tx_zero_copy_enabled =
       (AdjustValue(PosixTcpOptions::kZerocpTxEnabledDefault, 0, 1,
                    config.GetInt(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED)) != 0);
+  options.tcp_rx_zero_copy_enabled =
+      (AdjustValue(0, 0, 1, config.GetInt(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED)) !=
+       0);
+  options.tcp_busy_poll_usec = AdjustValue(
+      0, 0, INT_MAX, config.GetInt(GRPC_ARG_TCP_BUSY_POLL_USEC));
+  options.tcp_min_coalesce_read_bytes = AdjustValue(
+      0, 0, INT_MAX, config.GetInt(GRPC_ARG_TCP_MIN_COALESCE_READ_BYTES));
+  options.tcp_fast_open_enabled =
+      (AdjustValue(0, 0, 1, config.GetInt(GRPC_ARG_TCP_FAST_OPEN)) != 0);
+  options.tcp_tx_timestamp_sampling_period = AdjustValue(
+      1, 1, INT_MAX, config.GetInt(GRPC_ARG_TCP_TX_TIMESTAMP_SAMPLING_PERIOD));
   options.keep_alive_time_ms =
       AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_KEEPALIVE_TIME_MS));
   options.keep_alive_timeout_ms =
@@ -112,6 +123,8 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
         (AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_ALLOW_REUSEPORT)) !=
          0);
   }
+  options.listener_accept_shards = AdjustValue(
+      1, 1, INT_MAX, config.GetInt(GRPC_ARG_TCP_LISTENER_ACCEPT_SHARDS));
   if (options.tcp_min_read_chunk_size > options.tcp_max_read_chunk_size) {
     options.tcp_min_read_chunk_size = options.tcp_max_read_chunk_size;
   }
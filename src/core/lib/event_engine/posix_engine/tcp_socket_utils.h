@@ -61,10 +61,16 @@ struct PosixTcpOptions {
   int tcp_tx_zerocopy_max_simultaneous_sends = kDefaultMaxSends;
   int tcp_receive_buffer_size = kReadBufferSizeUnset;
   bool tcp_tx_zero_copy_enabled = kZerocpTxEnabledDefault;
+  bool tcp_rx_zero_copy_enabled = false;
+  int tcp_busy_poll_usec = 0;
+  int tcp_min_coalesce_read_bytes = 0;
+  bool tcp_fast_open_enabled = false;
+  int tcp_tx_timestamp_sampling_period = 1;
   int keep_alive_time_ms = 0;
   int keep_alive_timeout_ms = 0;
   bool expand_wildcard_addrs = false;
   bool allow_reuse_port = false;
+  int listener_accept_shards = 1;
   int dscp = kDscpNotSet;
   grpc_core::RefCountedPtr<grpc_core::ResourceQuota> resource_quota;
   struct grpc_socket_mutator* socket_mutator = nullptr;
@@ -132,10 +138,16 @@ struct PosixTcpOptions {
     tcp_tx_zerocopy_max_simultaneous_sends =
         other.tcp_tx_zerocopy_max_simultaneous_sends;
     tcp_tx_zero_copy_enabled = other.tcp_tx_zero_copy_enabled;
+    tcp_rx_zero_copy_enabled = other.tcp_rx_zero_copy_enabled;
+    tcp_busy_poll_usec = other.tcp_busy_poll_usec;
+    tcp_min_coalesce_read_bytes = other.tcp_min_coalesce_read_bytes;
+    tcp_fast_open_enabled = other.tcp_fast_open_enabled;
+    tcp_tx_timestamp_sampling_period = other.tcp_tx_timestamp_sampling_period;
     keep_alive_time_ms = other.keep_alive_time_ms;
     keep_alive_timeout_ms = other.keep_alive_timeout_ms;
     expand_wildcard_addrs = other.expand_wildcard_addrs;
     allow_reuse_port = other.allow_reuse_port;
+    listener_accept_shards = other.listener_accept_shards;
     dscp = other.dscp;
   }
 };
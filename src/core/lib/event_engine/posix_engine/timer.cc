@@ -27,6 +27,7 @@
 #include <utility>
 
 #include "src/core/lib/event_engine/posix_engine/timer_heap.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
 #include "src/core/util/time.h"
 #include "src/core/util/useful.h"
 
@@ -58,26 +59,12 @@ TimerList::TimerList(TimerListHost* host)
         grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
             min_timer_.load(std::memory_order_relaxed));
     shard.shard_queue_index = i;
-    shard.list.next = shard.list.prev = &shard.list;
+    shard.wheel.Init(min_timer_.load(std::memory_order_relaxed));
     shard.min_deadline = shard.ComputeMinDeadline();
     shard_queue_[i] = &shard;
   }
 }
 
-namespace {
-// returns true if the first element in the list
-void ListJoin(Timer* head, Timer* timer) {
-  timer->next = head;
-  timer->prev = head->prev;
-  timer->next->prev = timer->prev->next = timer;
-}
-
-void ListRemove(Timer* timer) {
-  timer->next->prev = timer->prev;
-  timer->prev->next = timer->next;
-}
-}  // namespace
-
 void TimerList::SwapAdjacentShardsInQueue(uint32_t first_shard_queue_index) {
   Shard* temp;
   temp = shard_queue_[first_shard_queue_index];
@@ -128,7 +115,7 @@ void TimerList::TimerInit(Timer* timer, grpc_core::Timestamp deadline,
       is_first_timer = shard->heap.Add(timer);
     } else {
       timer->heap_index = kInvalidHeapIndex;
-      ListJoin(&shard->list, timer);
+      shard->wheel.Add(timer);
     }
   }
 
@@ -165,7 +152,7 @@ bool TimerList::TimerCancel(Timer* timer) {
   if (timer->pending) {
     timer->pending = false;
     if (timer->heap_index == kInvalidHeapIndex) {
-      ListRemove(timer);
+      shard->wheel.Remove(timer);
     } else {
       shard->heap.Remove(timer);
     }
@@ -175,9 +162,9 @@ bool TimerList::TimerCancel(Timer* timer) {
   return false;
 }
 
-// Rebalances the timer shard by computing a new 'queue_deadline_cap' and moving
-// all relevant timers in shard->list (i.e timers with deadlines earlier than
-// 'queue_deadline_cap') into into shard->heap.
+// Rebalances the timer shard by computing a new 'queue_deadline_cap' and
+// moving all relevant timers in shard->wheel (i.e timers with deadlines
+// earlier than 'queue_deadline_cap') into shard->heap.
 // Returns 'true' if shard->heap has at least ONE element
 bool TimerList::Shard::RefillHeap(grpc_core::Timestamp now) {
   // Compute the new queue window width and bound by the limits:
@@ -185,22 +172,19 @@ bool TimerList::Shard::RefillHeap(grpc_core::Timestamp now) {
   double deadline_delta =
       grpc_core::Clamp(computed_deadline_delta, kMinQueueWindowDuration,
                        kMaxQueueWindowDuration);
-  Timer *timer, *next;
 
   // Compute the new cap and put all timers under it into the queue:
   queue_deadline_cap = std::max(now, queue_deadline_cap) +
                        grpc_core::Duration::FromSecondsAsDouble(deadline_delta);
 
-  for (timer = list.next; timer != &list; timer = next) {
-    next = timer->next;
-    auto timer_deadline =
-        grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
-            timer->deadline);
-
-    if (timer_deadline < queue_deadline_cap) {
-      ListRemove(timer);
-      heap.Add(timer);
-    }
+  Timer drained;
+  drained.next = drained.prev = &drained;
+  wheel.ExtractUnder(queue_deadline_cap.milliseconds_after_process_epoch(),
+                     &drained);
+  for (Timer* timer = drained.next; timer != &drained;) {
+    Timer* next = timer->next;
+    heap.Add(timer);
+    timer = next;
   }
   return !heap.is_empty();
 }
@@ -31,6 +31,7 @@
 
 #include "absl/base/thread_annotations.h"
 #include "src/core/lib/event_engine/posix_engine/timer_heap.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
 #include "src/core/util/sync.h"
 #include "src/core/util/time.h"
 #include "src/core/util/time_averaged_stats.h"
@@ -100,14 +101,14 @@ class TimerList {
       grpc_core::Timestamp* next);
 
  private:
-  // A "timer shard". Contains a 'heap' and a 'list' of timers. All timers with
-  // deadlines earlier than 'queue_deadline_cap' are maintained in the heap and
-  // others are maintained in the list (unordered). This helps to keep the
+  // A "timer shard". Contains a 'heap' and a 'wheel' of timers. All timers
+  // with deadlines earlier than 'queue_deadline_cap' are maintained in the
+  // heap and others are maintained in the wheel. This helps to keep the
   // number of elements in the heap low.
   //
   // The 'queue_deadline_cap' gets recomputed periodically based on the timer
   // stats maintained in 'stats' and the relevant timers are then moved from the
-  // 'list' to 'heap'.
+  // 'wheel' to 'heap'.
   //
   struct Shard {
     Shard();
@@ -131,8 +132,10 @@ class TimerList {
     // This holds all timers with deadlines < queue_deadline_cap. Timers in this
     // list have the top bit of their deadline set to 0.
     TimerHeap heap ABSL_GUARDED_BY(mu);
-    // This holds timers whose deadline is >= queue_deadline_cap.
-    Timer list ABSL_GUARDED_BY(mu);
+    // This holds timers whose deadline is >= queue_deadline_cap, bucketed so
+    // that insertion and cancellation are O(1) and RefillHeap() only visits
+    // buckets that the new cap could cover.
+    TimerWheel wheel ABSL_GUARDED_BY(mu);
   };
 
   void SwapAdjacentShardsInQueue(uint32_t first_shard_queue_index)
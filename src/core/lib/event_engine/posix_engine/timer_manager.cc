@@ -21,6 +21,7 @@
 #include <grpc/support/port_platform.h>
 #include <grpc/support/time.h>
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -28,6 +29,7 @@
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/time/time.h"
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/debug/trace.h"
 
 static thread_local bool g_timer_thread;
@@ -61,12 +63,29 @@ bool TimerManager::WaitUntil(grpc_core::Timestamp next) {
   return true;
 }
 
+grpc_core::Timestamp TimerManager::QuantizeWakeup(
+    grpc_core::Timestamp next) const {
+  if (timer_slack_ <= grpc_core::Duration::Zero() ||
+      next == grpc_core::Timestamp::InfFuture()) {
+    return next;
+  }
+  const int64_t slack_millis = timer_slack_.millis();
+  int64_t millis = next.milliseconds_after_process_epoch();
+  const int64_t remainder = millis % slack_millis;
+  if (remainder != 0) millis += slack_millis - remainder;
+  return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(millis);
+}
+
 void TimerManager::MainLoop() {
   grpc_core::Timestamp next = grpc_core::Timestamp::InfFuture();
   std::optional<std::vector<experimental::EventEngine::Closure*>> check_result =
       timer_list_->TimerCheck(&next);
   CHECK(check_result.has_value())
       << "ERROR: More than one MainLoop is running.";
+  // Timers may fire up to timer_slack_ late so that expirations falling in
+  // the same slack window share one wakeup; the TimerCheck after that wakeup
+  // drains every due shard in a single sweep.
+  next = QuantizeWakeup(next);
   bool timers_found = !check_result->empty();
   if (timers_found) {
     RunSomeTimers(std::move(*check_result));
@@ -84,7 +103,10 @@ bool TimerManager::IsTimerManagerThread() { return g_timer_thread; }
 
 TimerManager::TimerManager(
     std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool)
-    : host_(this), thread_pool_(std::move(thread_pool)) {
+    : host_(this),
+      timer_slack_(grpc_core::Duration::Milliseconds(std::max(
+          0, grpc_core::ConfigVars::Get().EventEngineTimerSlackMs()))),
+      thread_pool_(std::move(thread_pool)) {
   timer_list_ = std::make_unique<TimerList>(&host_);
   main_loop_exit_signal_.emplace();
   thread_pool_->Run([this]() { MainLoop(); });
@@ -77,6 +77,10 @@ class TimerManager final {
   void MainLoop();
   void RunSomeTimers(std::vector<experimental::EventEngine::Closure*> timers);
   bool WaitUntil(grpc_core::Timestamp next);
+  // Rounds the next wakeup time up to a multiple of the configured timer
+  // slack so that nearby expirations are dispatched by a single wakeup.
+  // Returns `next` unchanged when slack is disabled.
+  grpc_core::Timestamp QuantizeWakeup(grpc_core::Timestamp next) const;
   void Kick();
 
   grpc_core::Mutex mu_;
@@ -93,6 +97,8 @@ class TimerManager final {
   bool kicked_ ABSL_GUARDED_BY(mu_) = false;
   // number of timer wakeups
   uint64_t wakeups_ ABSL_GUARDED_BY(mu_) = false;
+  // maximum time timer expiry may be delayed to quantize wakeups
+  const grpc_core::Duration timer_slack_;
   // actual timer implementation
   std::unique_ptr<TimerList> timer_list_;
   std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool_;
@@ -0,0 +1,144 @@
+//
+//
+// Copyright 2015 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+
+#include "absl/log/check.h"
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+void ListJoin(Timer* head, Timer* timer) {
+  timer->next = head;
+  timer->prev = head->prev;
+  timer->next->prev = timer->prev->next = timer;
+}
+
+void ListRemove(Timer* timer) {
+  timer->next->prev = timer->prev;
+  timer->prev->next = timer->next;
+}
+}  // namespace
+
+TimerWheel::TimerWheel()
+    : buckets_(new Timer[kNumLevels * kSlotsPerLevel + 1]) {
+  for (size_t i = 0; i < kNumLevels * kSlotsPerLevel + 1; i++) {
+    buckets_[i].next = buckets_[i].prev = &buckets_[i];
+  }
+}
+
+TimerWheel::~TimerWheel() = default;
+
+void TimerWheel::Init(int64_t cap_millis) {
+  DCHECK_EQ(size_, 0u);
+  cap_ = cap_millis;
+}
+
+Timer* TimerWheel::OverflowBucket() {
+  return &buckets_[kNumLevels * kSlotsPerLevel];
+}
+
+Timer* TimerWheel::BucketFor(int64_t deadline) {
+  // A timer's stored deadline may predate the cap if it was already due when
+  // armed; file it as if due exactly at the cap so the next extraction finds
+  // it.
+  const int64_t delta = std::max<int64_t>(deadline - cap_, 0);
+  const int64_t effective_deadline = cap_ + delta;
+  for (int level = 0; level < kNumLevels; level++) {
+    if (delta < (int64_t{1} << (kLevelBits * (level + 1)))) {
+      const int64_t tick = effective_deadline >> (kLevelBits * level);
+      return &buckets_[level * kSlotsPerLevel +
+                       (tick & (kSlotsPerLevel - 1))];
+    }
+  }
+  return OverflowBucket();
+}
+
+void TimerWheel::Add(Timer* timer) {
+  ListJoin(BucketFor(timer->deadline), timer);
+  ++size_;
+}
+
+void TimerWheel::Remove(Timer* timer) {
+  ListRemove(timer);
+  --size_;
+}
+
+void TimerWheel::SpliceBucket(Timer* bucket, Timer* out) {
+  if (bucket->next == bucket) return;
+  Timer* first = bucket->next;
+  Timer* last = bucket->prev;
+  first->prev = out->prev;
+  first->prev->next = first;
+  last->next = out;
+  out->prev = last;
+  bucket->next = bucket->prev = bucket;
+}
+
+void TimerWheel::ExtractUnder(int64_t cap_millis, Timer* out) {
+  if (cap_millis <= cap_) return;
+  const int64_t old_cap = cap_;
+  if (size_ == 0) {
+    cap_ = cap_millis;
+    return;
+  }
+  // Splice every bucket that may hold a timer below the new cap onto a
+  // holding list. At each level only the slots whose ticks fall in
+  // [old_cap, cap_millis) can contain due timers; if the cap jumped by more
+  // than a full rotation, that is simply every slot.
+  Timer pending;
+  pending.next = pending.prev = &pending;
+  for (int level = 0; level < kNumLevels; level++) {
+    const int shift = kLevelBits * level;
+    const int64_t first_tick = old_cap >> shift;
+    const int64_t last_tick = (cap_millis - 1) >> shift;
+    const int64_t slots = std::min<int64_t>(last_tick - first_tick + 1,
+                                            static_cast<int64_t>(kSlotsPerLevel));
+    for (int64_t i = 0; i < slots; i++) {
+      SpliceBucket(&buckets_[level * kSlotsPerLevel +
+                             ((first_tick + i) & (kSlotsPerLevel - 1))],
+                   &pending);
+    }
+  }
+  // Overflow timers always sit at least a full top-level rotation past the
+  // cap, so they only need a look when the cap crosses into a new rotation.
+  if ((old_cap >> (kLevelBits * kNumLevels)) !=
+      (cap_millis >> (kLevelBits * kNumLevels))) {
+    SpliceBucket(OverflowBucket(), &pending);
+  }
+  cap_ = cap_millis;
+  // Hand due timers to the caller; re-file the rest, which may now land on a
+  // finer-grained level (this is the hierarchical cascade).
+  Timer* next;
+  for (Timer* timer = pending.next; timer != &pending; timer = next) {
+    next = timer->next;
+    if (timer->deadline < cap_millis) {
+      ListJoin(out, timer);
+      --size_;
+    } else {
+      ListJoin(BucketFor(timer->deadline), timer);
+    }
+  }
+}
+
+}  // namespace grpc_event_engine::experimental
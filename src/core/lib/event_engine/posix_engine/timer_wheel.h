@@ -0,0 +1,92 @@
+//
+//
+// Copyright 2015 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+
+#include <grpc/support/port_platform.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace grpc_event_engine::experimental {
+
+struct Timer;
+
+// A hashed hierarchical timer wheel holding timers whose deadlines lie beyond
+// the near-term horizon served by TimerHeap. Add() and Remove() are O(1) list
+// operations regardless of how many timers are armed, which makes the
+// dominant "armed then cancelled before firing" pattern cheap. Timers migrate
+// toward the caller (and from there into the heap) as ExtractUnder() advances
+// the wheel's cap.
+//
+// Buckets are indexed by bit ranges of the absolute deadline, so two timers a
+// full wheel rotation apart can share a bucket (the "hashed" part); such
+// timers are simply re-filed when the bucket is drained.
+class TimerWheel {
+ public:
+  TimerWheel();
+  ~TimerWheel();
+
+  // Set the cap below which timers will never be added. Must be called before
+  // the first Add().
+  void Init(int64_t cap_millis);
+
+  // Adds a timer to the wheel. The timer stays put until it is either
+  // Remove()d or handed back by ExtractUnder().
+  void Add(Timer* timer);
+
+  // Removes a timer previously added and not yet extracted.
+  void Remove(Timer* timer);
+
+  // Advances the wheel's cap to cap_millis, splicing every timer with a
+  // deadline earlier than cap_millis onto the circular list headed by out
+  // (unordered). Timers at or past the cap stay in the wheel, cascading to
+  // finer-grained levels as appropriate.
+  void ExtractUnder(int64_t cap_millis, Timer* out);
+
+  bool IsEmpty() const { return size_ == 0; }
+
+  size_t TestOnlySize() const { return size_; }
+
+ private:
+  // Each level has 2^kLevelBits slots, and a slot on level n spans
+  // 2^(kLevelBits*n) milliseconds, so the levels together cover roughly 17.5
+  // minutes past the cap. Deadlines beyond that go to an overflow bucket that
+  // is only rescanned when the cap crosses a top-level rotation.
+  static constexpr int kLevelBits = 5;
+  static constexpr int kNumLevels = 4;
+  static constexpr size_t kSlotsPerLevel = size_t{1} << kLevelBits;
+
+  Timer* BucketFor(int64_t deadline);
+  Timer* OverflowBucket();
+  // Splices the contents of bucket (a circular list sentinel) onto out.
+  static void SpliceBucket(Timer* bucket, Timer* out);
+
+  // No timer in the wheel has a deadline earlier than this.
+  int64_t cap_ = 0;
+  size_t size_ = 0;
+  // kNumLevels * kSlotsPerLevel slot sentinels followed by the overflow
+  // sentinel. Heap-allocated so Timer can stay forward-declared here.
+  std::unique_ptr<Timer[]> buckets_;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
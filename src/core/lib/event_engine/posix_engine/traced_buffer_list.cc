@@ -21,6 +21,7 @@
 #include <string.h>
 #include <time.h>
 
+#include <algorithm>
 #include <utility>
 
 #include "absl/functional/any_invocable.h"
@@ -214,46 +215,68 @@ void TracedBufferList::AddNewEntry(int32_t seq_no,
   list_.push_back(std::move(new_elem));
 }
 
+TracedBufferList::TimestampedEvent TracedBufferList::MakeTimestampedEvent(
+    struct sock_extended_err* serr, struct cmsghdr* opt_stats,
+    struct scm_timestamping* tss) {
+  TimestampedEvent event;
+  event.seq_no = serr->ee_data;
+  event.type = serr->ee_info;
+  event.timestamp = absl::TimeFromTimespec(tss->ts[0]);
+  event.metrics = ExtractOptStatsFromCmsg(opt_stats);
+  return event;
+}
+
 void TracedBufferList::ProcessTimestamp(struct sock_extended_err* serr,
                                         struct cmsghdr* opt_stats,
                                         struct scm_timestamping* tss) {
-  absl::Time timestamp = absl::TimeFromTimespec(tss->ts[0]);
+  TimestampedEvent event = MakeTimestampedEvent(serr, opt_stats, tss);
+  ProcessTimestamps(absl::MakeConstSpan(&event, 1));
+}
+
+void TracedBufferList::ProcessTimestamps(
+    absl::Span<const TimestampedEvent> events) {
+  if (events.empty()) return;
   grpc_core::Timestamp core_timestamp = grpc_core::Timestamp::Now();
-  auto metrics = ExtractOptStatsFromCmsg(opt_stats);
   grpc_core::MutexLock lock(&mu_);
-  auto it = list_.begin();
-  while (it != list_.end()) {
-    // The byte number refers to the sequence number of the last byte which this
-    // timestamp relates to.
-    if (serr->ee_data >= it->seq_no_) {
-      switch (serr->ee_info) {
-        case SCM_TSTAMP_SCHED:
+  for (const TimestampedEvent& event : events) {
+    // The byte number refers to the sequence number of the last byte which
+    // this timestamp relates to, so the event applies to every buffer whose
+    // last byte precedes it. The deque is ordered by seq_no, so that is a
+    // prefix that binary search can delimit.
+    auto bound = std::partition_point(
+        list_.begin(), list_.end(), [&event](const TracedBuffer& elem) {
+          return event.seq_no >= elem.seq_no_;
+        });
+    if (bound == list_.begin()) continue;
+    switch (event.type) {
+      case SCM_TSTAMP_SCHED:
+        for (auto it = list_.begin(); it != bound; ++it) {
           it->sink_.RecordEvent(EventEngine::Endpoint::WriteEvent::kScheduled,
-                                timestamp, metrics);
+                                event.timestamp, event.metrics);
           it->last_timestamp_ = core_timestamp;
-          ++it;
-          break;
-        case SCM_TSTAMP_SND:
+        }
+        break;
+      case SCM_TSTAMP_SND:
+        for (auto it = list_.begin(); it != bound; ++it) {
           it->sink_.RecordEvent(EventEngine::Endpoint::WriteEvent::kSent,
-                                timestamp, metrics);
+                                event.timestamp, event.metrics);
           it->last_timestamp_ = core_timestamp;
-          ++it;
-          break;
-        case SCM_TSTAMP_ACK:
+        }
+        break;
+      case SCM_TSTAMP_ACK:
+        for (auto it = list_.begin(); it != bound; ++it) {
           it->sink_.RecordEvent(EventEngine::Endpoint::WriteEvent::kAcked,
-                                timestamp, metrics);
-          it = list_.erase(it);
-          break;
-        default:
-          grpc_core::Crash(
-              absl::StrCat("Unknown timestamp type %d", serr->ee_info));
-      }
-    } else {
-      break;
+                                event.timestamp, event.metrics);
+        }
+        // The acked buffers form the front of the deque; drop them at once.
+        list_.erase(list_.begin(), bound);
+        break;
+      default:
+        grpc_core::Crash(absl::StrCat("Unknown timestamp type %d", event.type));
     }
   }
 
-  it = list_.begin();
+  auto it = list_.begin();
   while (it != list_.end()) {
     if (!it->TimedOut(core_timestamp)) {
       ++it;
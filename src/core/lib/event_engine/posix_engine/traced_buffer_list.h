@@ -20,10 +20,13 @@
 #include <grpc/support/time.h>
 #include <stdint.h>
 
+#include <deque>
 #include <optional>
 
 #include "absl/functional/any_invocable.h"
 #include "absl/status/status.h"
+#include "absl/time/time.h"
+#include "absl/types/span.h"
 #include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
 #include "src/core/lib/event_engine/posix_engine/posix_interface.h"
 #include "src/core/lib/event_engine/posix_engine/posix_write_event_sink.h"
@@ -51,12 +54,30 @@ class TracedBufferList {
   void AddNewEntry(int32_t seq_no, EventEnginePosixInterface* posix_interface,
                    const FileDescriptor& fd,
                    EventEngine::Endpoint::WriteEventSink sink);
+  // A timestamp event extracted from one SCM_TIMESTAMPING control message.
+  // Extraction must happen while the error queue is being drained (the
+  // control message buffer is reused between recvmsg calls), but matching
+  // against traced buffers can be deferred so that a whole drain is applied
+  // under a single lock acquisition via ProcessTimestamps().
+  struct TimestampedEvent {
+    uint32_t seq_no;  // Sequence number of the last byte this relates to.
+    uint32_t type;    // SCM_TSTAMP_* from sock_extended_err::ee_info.
+    absl::Time timestamp;
+    PosixWriteEventSink::ConnectionMetrics metrics;
+  };
+  // Builds a TimestampedEvent from the raw control message data.
+  static TimestampedEvent MakeTimestampedEvent(struct sock_extended_err* serr,
+                                               struct cmsghdr* opt_stats,
+                                               struct scm_timestamping* tss);
   // Processes a received timestamp based on sock_extended_err and
   // scm_timestamping structures. It will invoke the timestamps callback if the
   // timestamp type is SCM_TSTAMP_ACK.
   void ProcessTimestamp(struct sock_extended_err* serr,
                         struct cmsghdr* opt_stats,
                         struct scm_timestamping* tss);
+  // Applies a batch of timestamp events, typically one whole error queue
+  // drain, under a single lock acquisition.
+  void ProcessTimestamps(absl::Span<const TimestampedEvent> events);
   // The Size() operation is slow and is used only in tests.
   int Size() {
     grpc_core::MutexLock lock(&mu_);
@@ -88,9 +109,12 @@ class TracedBufferList {
     PosixWriteEventSink sink_;
   };
   grpc_core::Mutex mu_;
-  // TracedBuffers are ordered by sequence number and would need to be processed
-  // in a FIFO order starting with the smallest sequence number.
-  std::list<TracedBuffer> list_ ABSL_GUARDED_BY(mu_);
+  // TracedBuffers are ordered by sequence number and are processed in FIFO
+  // order starting with the smallest sequence number. A deque keeps them
+  // contiguous and indexable, so appends need no per-entry allocation, the
+  // prefix matched by a timestamp event can be found by binary search, and
+  // acked prefixes can be dropped in one range erase.
+  std::deque<TracedBuffer> list_ ABSL_GUARDED_BY(mu_);
 };
 
 #else   // GRPC_LINUX_ERRQUEUE
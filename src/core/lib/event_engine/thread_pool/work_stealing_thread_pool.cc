@@ -21,6 +21,7 @@
 #include <grpc/support/thd_id.h>
 #include <inttypes.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
@@ -31,8 +32,12 @@
 #include "absl/functional/any_invocable.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/thread_local.h"
@@ -51,6 +56,13 @@
 #include <signal.h>
 #endif
 
+#ifdef GPR_LINUX
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 // IWYU pragma: no_include <ratio>
 
 // ## Thread Pool Fork-handling
@@ -162,6 +174,56 @@ void DumpSignalHandler(int /* sig */) {
   grpc_core::Thread::Kill(gpr_thd_currentid());
 }
 
+// Returns the NUMA node the calling thread is currently running on, or -1 on
+// platforms that don't expose one. Worker threads are not pinned, so this is
+// a hint that is refreshed on the stealing path.
+int CurrentNumaNode() {
+#ifdef GPR_LINUX
+  unsigned node = 0;
+  if (syscall(SYS_getcpu, nullptr, &node, nullptr) == 0) {
+    return static_cast<int>(node);
+  }
+#endif
+  return -1;
+}
+
+#ifdef GPR_LINUX
+// Pins the calling thread to the CPU set named by the
+// GRPC_EVENT_ENGINE_CPU_AFFINITY config var (a comma separated list of CPUs
+// or CPU ranges, e.g. "0,2-5"). Best effort: malformed entries and
+// setaffinity failures are logged and otherwise ignored.
+void ApplyCpuAffinity() {
+  absl::string_view config =
+      grpc_core::ConfigVars::Get().EventEngineCpuAffinity();
+  if (config.empty()) return;
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  bool any_cpu_set = false;
+  for (absl::string_view part :
+       absl::StrSplit(config, ',', absl::SkipEmpty())) {
+    std::pair<absl::string_view, absl::string_view> range =
+        absl::StrSplit(part, absl::MaxSplits('-', 1));
+    int lo = 0;
+    int hi = 0;
+    if (!absl::SimpleAtoi(range.first, &lo) ||
+        (!range.second.empty() && !absl::SimpleAtoi(range.second, &hi))) {
+      LOG(ERROR) << "Ignoring malformed GRPC_EVENT_ENGINE_CPU_AFFINITY entry: "
+                 << part;
+      continue;
+    }
+    if (range.second.empty()) hi = lo;
+    for (int cpu = std::max(lo, 0); cpu <= hi && cpu < CPU_SETSIZE; ++cpu) {
+      CPU_SET(cpu, &cpuset);
+      any_cpu_set = true;
+    }
+  }
+  if (any_cpu_set &&
+      pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) != 0) {
+    LOG(ERROR) << "Failed to apply GRPC_EVENT_ENGINE_CPU_AFFINITY: " << config;
+  }
+}
+#endif  // GPR_LINUX
+
 }  // namespace
 
 thread_local WorkQueue* g_local_queue = nullptr;
@@ -193,9 +255,10 @@ void WorkStealingThreadPool::Run(EventEngine::Closure* closure) {
 
 // -------- WorkStealingThreadPool::TheftRegistry --------
 
-void WorkStealingThreadPool::TheftRegistry::Enroll(WorkQueue* queue) {
+void WorkStealingThreadPool::TheftRegistry::Enroll(
+    WorkQueue* queue, const std::atomic<int>* owner_numa_node) {
   grpc_core::MutexLock lock(&mu_);
-  queues_.emplace(queue);
+  queues_.emplace(queue, owner_numa_node);
 }
 
 void WorkStealingThreadPool::TheftRegistry::Unenroll(WorkQueue* queue) {
@@ -203,10 +266,30 @@ void WorkStealingThreadPool::TheftRegistry::Unenroll(WorkQueue* queue) {
   queues_.erase(queue);
 }
 
-EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealOne() {
+EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealOne(
+    int preferred_numa_node) {
   grpc_core::MutexLock lock(&mu_);
   EventEngine::Closure* closure;
-  for (auto* queue : queues_) {
+  // First pass: queues owned by threads on the thief's own NUMA node, so
+  // closures (and the endpoint state they touch) tend to stay on the socket
+  // that produced them.
+  if (preferred_numa_node >= 0) {
+    for (const auto& [queue, owner_numa_node] : queues_) {
+      if (owner_numa_node->load(std::memory_order_relaxed) !=
+          preferred_numa_node) {
+        continue;
+      }
+      closure = queue->PopMostRecent();
+      if (closure != nullptr) return closure;
+    }
+  }
+  // Second pass: steal from anywhere rather than go idle.
+  for (const auto& [queue, owner_numa_node] : queues_) {
+    if (preferred_numa_node >= 0 &&
+        owner_numa_node->load(std::memory_order_relaxed) ==
+            preferred_numa_node) {
+      continue;
+    }
     closure = queue->PopMostRecent();
     if (closure != nullptr) return closure;
   }
@@ -483,6 +566,9 @@ WorkStealingThreadPool::ThreadState::ThreadState(
       busy_count_idx_(pool_->busy_thread_count()->NextIndex()) {}
 
 void WorkStealingThreadPool::ThreadState::ThreadBody() {
+#ifdef GPR_LINUX
+  ApplyCpuAffinity();
+#endif
   if (g_log_verbose_failures) {
 #ifdef GPR_POSIX_SYNC
     std::signal(kDumpStackSignal, DumpSignalHandler);
@@ -492,7 +578,8 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
     pool_->TrackThread(gpr_thd_currentid());
   }
   g_local_queue = new BasicWorkQueue(pool_.get());
-  pool_->theft_registry()->Enroll(g_local_queue);
+  numa_node_.store(CurrentNumaNode(), std::memory_order_relaxed);
+  pool_->theft_registry()->Enroll(g_local_queue, &numa_node_);
   ThreadLocal::SetIsEventEngineThread(true);
   while (Step()) {
     // loop until the thread should no longer run
@@ -541,6 +628,11 @@ bool WorkStealingThreadPool::ThreadState::Step() {
   // * the steal pool returns nullptr
   bool should_run_again = false;
   auto start_time = std::chrono::steady_clock::now();
+  // About to go looking for work elsewhere: refresh this thread's NUMA node
+  // hint so both this thread's steal preference and other threads' view of
+  // this queue are current.
+  const int numa_node = CurrentNumaNode();
+  numa_node_.store(numa_node, std::memory_order_relaxed);
   // Wait until work is available or until shut down.
   while (!pool_->IsForking()) {
     // Pull from the global queue next
@@ -553,7 +645,7 @@ bool WorkStealingThreadPool::ThreadState::Step() {
       break;
     };
     // Try stealing if the queue is empty
-    closure = pool_->theft_registry()->StealOne();
+    closure = pool_->theft_registry()->StealOne(numa_node);
     if (closure != nullptr) {
       should_run_again = true;
       break;
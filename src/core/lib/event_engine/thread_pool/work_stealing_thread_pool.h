@@ -28,11 +28,13 @@
 #include <memory>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/functional/any_invocable.h"
 #include "src/core/lib/event_engine/thread_pool/thread_count.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
+#include "src/core/lib/event_engine/work_queue/mpmc_ring_work_queue.h"
 #include "src/core/lib/event_engine/work_queue/work_queue.h"
 #include "src/core/util/backoff.h"
 #include "src/core/util/notification.h"
@@ -83,16 +85,24 @@ class WorkStealingThreadPool final : public ThreadPool {
   class TheftRegistry {
    public:
     // Allow any member of the registry to steal from the provided queue.
-    void Enroll(WorkQueue* queue) ABSL_LOCKS_EXCLUDED(mu_);
+    // owner_numa_node points at the owning thread's NUMA node hint, which the
+    // owner keeps up to date; it must outlive the enrollment.
+    void Enroll(WorkQueue* queue, const std::atomic<int>* owner_numa_node)
+        ABSL_LOCKS_EXCLUDED(mu_);
     // Disallow work stealing from the provided queue.
     void Unenroll(WorkQueue* queue) ABSL_LOCKS_EXCLUDED(mu_);
     // Returns one closure from another thread, or nullptr if none are
-    // available.
-    EventEngine::Closure* StealOne() ABSL_LOCKS_EXCLUDED(mu_);
+    // available. Queues owned by threads on preferred_numa_node are tried
+    // first so work tends to stay on the socket that produced it; pass a
+    // negative node to steal from anywhere without preference.
+    EventEngine::Closure* StealOne(int preferred_numa_node)
+        ABSL_LOCKS_EXCLUDED(mu_);
 
    private:
     grpc_core::Mutex mu_;
-    absl::flat_hash_set<WorkQueue*> queues_ ABSL_GUARDED_BY(mu_);
+    // Maps each enrolled queue to its owner's NUMA node hint.
+    absl::flat_hash_map<WorkQueue*, const std::atomic<int>*> queues_
+        ABSL_GUARDED_BY(mu_);
   };
 
   // An implementation of the ThreadPool
@@ -176,7 +186,10 @@ class WorkStealingThreadPool final : public ThreadPool {
     BusyThreadCount busy_thread_count_;
     LivingThreadCount living_thread_count_;
     TheftRegistry theft_registry_;
-    BasicWorkQueue queue_;
+    // The global queue sees every producer thread calling EventEngine::Run,
+    // so it uses the lock-free ring variant; the mutex-guarded BasicWorkQueue
+    // remains in use for the per-worker local queues.
+    MpmcRingWorkQueue queue_;
     // Track shutdown and fork bits separately.
     // It's possible for a ThreadPool to initiate shut down while fork handlers
     // are running, and similarly possible for a fork event to occur during
@@ -216,6 +229,10 @@ class WorkStealingThreadPool final : public ThreadPool {
     LivingThreadCount::AutoThreadCounter auto_thread_counter_;
     grpc_core::BackOff backoff_;
     size_t busy_count_idx_;
+    // The NUMA node this thread last observed itself running on, refreshed
+    // before stealing and published to the TheftRegistry so other threads can
+    // prefer same-node victims. -1 where the platform gives no answer.
+    std::atomic<int> numa_node_{-1};
   };
 
   const std::shared_ptr<WorkStealingThreadPoolImpl> pool_;
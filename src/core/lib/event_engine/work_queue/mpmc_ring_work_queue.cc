@@ -0,0 +1,139 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/work_queue/mpmc_ring_work_queue.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <utility>
+
+#include "src/core/lib/event_engine/common_closures.h"
+
+namespace grpc_event_engine::experimental {
+
+MpmcRingWorkQueue::MpmcRingWorkQueue(void* owner)
+    : overflow_(owner), owner_(owner) {
+  InitCells();
+}
+
+void MpmcRingWorkQueue::InitCells() {
+  for (size_t i = 0; i < kRingSize; ++i) {
+    cells_[i].sequence.store(i, std::memory_order_relaxed);
+    cells_[i].closure = nullptr;
+  }
+}
+
+bool MpmcRingWorkQueue::TryPush(EventEngine::Closure* closure) {
+  size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+  Cell* cell;
+  for (;;) {
+    cell = &cells_[pos & (kRingSize - 1)];
+    const size_t seq = cell->sequence.load(std::memory_order_acquire);
+    const intptr_t dif =
+        static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+    if (dif == 0) {
+      // The cell is free; race other producers to claim it.
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (dif < 0) {
+      // The cell still holds an element from one lap ago: the ring is full.
+      return false;
+    } else {
+      // Another producer claimed this cell; reload and retry.
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+  cell->closure = closure;
+  // Publish the element: consumers wait for sequence == pos + 1.
+  cell->sequence.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+EventEngine::Closure* MpmcRingWorkQueue::TryPop() {
+  size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+  Cell* cell;
+  for (;;) {
+    cell = &cells_[pos & (kRingSize - 1)];
+    const size_t seq = cell->sequence.load(std::memory_order_acquire);
+    const intptr_t dif =
+        static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+    if (dif == 0) {
+      // The cell holds a published element; race other consumers for it.
+      if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (dif < 0) {
+      // The producer for this cell has not published yet: the ring is empty.
+      return nullptr;
+    } else {
+      // Another consumer claimed this cell; reload and retry.
+      pos = dequeue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+  EventEngine::Closure* closure = cell->closure;
+  // Free the cell for the producer that will next lap onto it.
+  cell->sequence.store(pos + kRingSize, std::memory_order_release);
+  return closure;
+}
+
+EventEngine::Closure* MpmcRingWorkQueue::PopOverflow() {
+  if (overflow_count_.load(std::memory_order_relaxed) == 0) return nullptr;
+  EventEngine::Closure* closure = overflow_.PopOldest();
+  if (closure != nullptr) {
+    overflow_count_.fetch_sub(1, std::memory_order_relaxed);
+  }
+  return closure;
+}
+
+bool MpmcRingWorkQueue::Empty() const {
+  return enqueue_pos_.load(std::memory_order_acquire) ==
+             dequeue_pos_.load(std::memory_order_acquire) &&
+         overflow_.Empty();
+}
+
+size_t MpmcRingWorkQueue::Size() const {
+  const size_t tail = enqueue_pos_.load(std::memory_order_acquire);
+  const size_t head = dequeue_pos_.load(std::memory_order_acquire);
+  return (tail >= head ? tail - head : 0) + overflow_.Size();
+}
+
+EventEngine::Closure* MpmcRingWorkQueue::PopMostRecent() {
+  // Drain overflowed closures first so a full-ring burst cannot starve them.
+  EventEngine::Closure* closure = PopOverflow();
+  if (closure != nullptr) return closure;
+  return TryPop();
+}
+
+EventEngine::Closure* MpmcRingWorkQueue::PopOldest() {
+  EventEngine::Closure* closure = PopOverflow();
+  if (closure != nullptr) return closure;
+  return TryPop();
+}
+
+void MpmcRingWorkQueue::Add(EventEngine::Closure* closure) {
+  if (TryPush(closure)) return;
+  // The ring is full; fall back to the mutex-guarded queue rather than spin
+  // or drop the closure.
+  overflow_count_.fetch_add(1, std::memory_order_relaxed);
+  overflow_.Add(closure);
+}
+
+void MpmcRingWorkQueue::Add(absl::AnyInvocable<void()> invocable) {
+  Add(static_cast<EventEngine::Closure*>(
+      SelfDeletingClosure::Create(std::move(invocable))));
+}
+
+}  // namespace grpc_event_engine::experimental
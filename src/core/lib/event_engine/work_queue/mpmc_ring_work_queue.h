@@ -0,0 +1,88 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_MPMC_RING_WORK_QUEUE_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_MPMC_RING_WORK_QUEUE_H
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <atomic>
+
+#include "absl/functional/any_invocable.h"
+#include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
+#include "src/core/lib/event_engine/work_queue/work_queue.h"
+
+namespace grpc_event_engine::experimental {
+
+// A WorkQueue backed by a bounded lock-free MPMC ring buffer (Dmitry Vyukov's
+// array-based queue with per-cell sequence numbers). Adds and pops on the
+// common path are a single CAS each and never take a lock, so the queue keeps
+// scaling where BasicWorkQueue's mutex collapses under many producers.
+//
+// The ring is FIFO and does not distinguish recency: PopMostRecent and
+// PopOldest both dequeue the oldest element, which the WorkQueue contract
+// permits. When the ring is momentarily full, closures overflow into a
+// mutex-guarded BasicWorkQueue so Add never blocks or drops work; the
+// overflow is drained preferentially so nothing parks there indefinitely.
+class MpmcRingWorkQueue : public WorkQueue {
+ public:
+  MpmcRingWorkQueue() { InitCells(); }
+  explicit MpmcRingWorkQueue(void* owner);
+  // Returns whether the queue is empty. Exact only while the queue is
+  // quiescent.
+  bool Empty() const override;
+  // Returns the size of the queue. Approximate under concurrent mutation.
+  size_t Size() const override;
+  // Returns the oldest element from the queue, or nullptr if empty. Both pop
+  // methods dequeue in FIFO order; see the class comment.
+  EventEngine::Closure* PopMostRecent() override;
+  // Returns the oldest element from the queue, or nullptr if empty.
+  EventEngine::Closure* PopOldest() override;
+  // Adds a closure to the queue.
+  void Add(EventEngine::Closure* closure) override;
+  // Wraps an AnyInvocable and adds it to the the queue.
+  void Add(absl::AnyInvocable<void()> invocable) override;
+  const void* owner() override { return owner_; }
+
+ private:
+  struct Cell {
+    std::atomic<size_t> sequence;
+    EventEngine::Closure* closure;
+  };
+  // Must be a power of two. Sized for the burst a callback-API server fans
+  // out before worker threads catch up; larger bursts spill to overflow_.
+  static constexpr size_t kRingSize = 256;
+
+  void InitCells();
+  // Attempts to enqueue into the ring; fails only if the ring is full.
+  bool TryPush(EventEngine::Closure* closure);
+  // Attempts to dequeue from the ring; fails only if the ring is empty.
+  EventEngine::Closure* TryPop();
+  // Pops a closure that previously overflowed, or returns nullptr.
+  EventEngine::Closure* PopOverflow();
+
+  // Producers and consumers race on separate counters; keep them on separate
+  // cache lines so enqueues do not invalidate the dequeue line and vice
+  // versa.
+  alignas(GPR_CACHELINE_SIZE) std::atomic<size_t> enqueue_pos_{0};
+  alignas(GPR_CACHELINE_SIZE) std::atomic<size_t> dequeue_pos_{0};
+  alignas(GPR_CACHELINE_SIZE) Cell cells_[kRingSize];
+  std::atomic<size_t> overflow_count_{0};
+  BasicWorkQueue overflow_;
+  const void* const owner_ = nullptr;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_MPMC_RING_WORK_QUEUE_H
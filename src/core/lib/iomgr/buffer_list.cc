@@ -31,6 +31,9 @@
 #include <string.h>
 #include <time.h>
 
+#include <algorithm>
+#include <utility>
+
 namespace grpc_core {
 namespace {
 // Fills gpr_timespec gts based on values from timespec ts.
@@ -203,107 +206,86 @@ bool TracedBufferList::TracedBuffer::Finished(gpr_timespec ts) {
 }
 
 void TracedBufferList::AddNewEntry(int32_t seq_no, int fd, void* arg) {
-  TracedBuffer* new_elem = new TracedBuffer(seq_no, arg);
+  TracedBuffer new_elem(seq_no, arg);
   // Store the current time as the sendmsg time.
-  new_elem->ts_.sendmsg_time.time = gpr_now(GPR_CLOCK_REALTIME);
-  new_elem->ts_.scheduled_time.time = gpr_inf_past(GPR_CLOCK_REALTIME);
-  new_elem->ts_.sent_time.time = gpr_inf_past(GPR_CLOCK_REALTIME);
-  new_elem->ts_.acked_time.time = gpr_inf_past(GPR_CLOCK_REALTIME);
-  if (GetSocketTcpInfo(&(new_elem->ts_.info), fd) == 0) {
-    ExtractOptStatsFromTcpInfo(&(new_elem->ts_.sendmsg_time.metrics),
-                               &(new_elem->ts_.info));
+  new_elem.ts_.sendmsg_time.time = gpr_now(GPR_CLOCK_REALTIME);
+  new_elem.ts_.scheduled_time.time = gpr_inf_past(GPR_CLOCK_REALTIME);
+  new_elem.ts_.sent_time.time = gpr_inf_past(GPR_CLOCK_REALTIME);
+  new_elem.ts_.acked_time.time = gpr_inf_past(GPR_CLOCK_REALTIME);
+  if (GetSocketTcpInfo(&(new_elem.ts_.info), fd) == 0) {
+    ExtractOptStatsFromTcpInfo(&(new_elem.ts_.sendmsg_time.metrics),
+                               &(new_elem.ts_.info));
   }
-  new_elem->last_timestamp_ = new_elem->ts_.sendmsg_time.time;
+  new_elem.last_timestamp_ = new_elem.ts_.sendmsg_time.time;
   MutexLock lock(&mu_);
-  if (!head_) {
-    head_ = tail_ = new_elem;
-  } else {
-    tail_->next_ = new_elem;
-    tail_ = new_elem;
-  }
+  list_.push_back(std::move(new_elem));
 }
 
 void TracedBufferList::ProcessTimestamp(struct sock_extended_err* serr,
                                         struct cmsghdr* opt_stats,
                                         struct scm_timestamping* tss) {
   MutexLock lock(&mu_);
-  TracedBuffer* elem = head_;
-  TracedBuffer* prev = nullptr;
-  while (elem != nullptr) {
-    // The byte number refers to the sequence number of the last byte which this
-    // timestamp relates to.
-    if (serr->ee_data >= elem->seq_no_) {
-      switch (serr->ee_info) {
-        case SCM_TSTAMP_SCHED:
-          FillGprFromTimestamp(&(elem->ts_.scheduled_time.time), &(tss->ts[0]));
-          ExtractOptStatsFromCmsg(&(elem->ts_.scheduled_time.metrics),
-                                  opt_stats);
-          elem->last_timestamp_ = elem->ts_.scheduled_time.time;
-          elem = elem->next_;
-          break;
-        case SCM_TSTAMP_SND:
-          FillGprFromTimestamp(&(elem->ts_.sent_time.time), &(tss->ts[0]));
-          ExtractOptStatsFromCmsg(&(elem->ts_.sent_time.metrics), opt_stats);
-          elem->last_timestamp_ = elem->ts_.sent_time.time;
-          elem = elem->next_;
-          break;
-        case SCM_TSTAMP_ACK:
-          FillGprFromTimestamp(&(elem->ts_.acked_time.time), &(tss->ts[0]));
-          ExtractOptStatsFromCmsg(&(elem->ts_.acked_time.metrics), opt_stats);
-          // Got all timestamps. Do the callback and free this TracedBuffer. The
-          // thing below can be passed by value if we don't want the restriction
-          // on the lifetime.
-          g_timestamps_callback(elem->arg_, &(elem->ts_), absl::OkStatus());
-          // Safe to update head_ to elem->next_ because the list is ordered by
-          // seq_no. Thus if elem is to be deleted, it has to be the first
-          // element in the list.
-          head_ = elem->next_;
-          delete elem;
-          elem = head_;
-          break;
-        default:
-          abort();
-      }
-    } else {
-      break;
+  // The byte number refers to the sequence number of the last byte which this
+  // timestamp relates to, so the event applies to every buffer whose last
+  // byte precedes it. The deque is ordered by seq_no, so that is a prefix
+  // that binary search can delimit.
+  auto bound = std::partition_point(
+      list_.begin(), list_.end(), [serr](const TracedBuffer& elem) {
+        return serr->ee_data >= elem.seq_no_;
+      });
+  if (bound != list_.begin()) {
+    switch (serr->ee_info) {
+      case SCM_TSTAMP_SCHED:
+        for (auto it = list_.begin(); it != bound; ++it) {
+          FillGprFromTimestamp(&(it->ts_.scheduled_time.time), &(tss->ts[0]));
+          ExtractOptStatsFromCmsg(&(it->ts_.scheduled_time.metrics), opt_stats);
+          it->last_timestamp_ = it->ts_.scheduled_time.time;
+        }
+        break;
+      case SCM_TSTAMP_SND:
+        for (auto it = list_.begin(); it != bound; ++it) {
+          FillGprFromTimestamp(&(it->ts_.sent_time.time), &(tss->ts[0]));
+          ExtractOptStatsFromCmsg(&(it->ts_.sent_time.metrics), opt_stats);
+          it->last_timestamp_ = it->ts_.sent_time.time;
+        }
+        break;
+      case SCM_TSTAMP_ACK:
+        for (auto it = list_.begin(); it != bound; ++it) {
+          FillGprFromTimestamp(&(it->ts_.acked_time.time), &(tss->ts[0]));
+          ExtractOptStatsFromCmsg(&(it->ts_.acked_time.metrics), opt_stats);
+          // Got all timestamps. Do the callback and release this TracedBuffer.
+          g_timestamps_callback(it->arg_, &(it->ts_), absl::OkStatus());
+        }
+        // The acked buffers form the front of the deque; drop them at once.
+        list_.erase(list_.begin(), bound);
+        break;
+      default:
+        abort();
     }
   }
 
-  elem = head_;
   gpr_timespec now = gpr_now(GPR_CLOCK_REALTIME);
-  while (elem != nullptr) {
-    if (!elem->Finished(now)) {
-      prev = elem;
-      elem = elem->next_;
+  auto it = list_.begin();
+  while (it != list_.end()) {
+    if (!it->Finished(now)) {
+      ++it;
       continue;
     }
-    g_timestamps_callback(elem->arg_, &(elem->ts_),
+    g_timestamps_callback(it->arg_, &(it->ts_),
                           absl::DeadlineExceededError("Ack timed out"));
-    if (prev != nullptr) {
-      prev->next_ = elem->next_;
-      delete elem;
-      elem = prev->next_;
-    } else {
-      head_ = elem->next_;
-      delete elem;
-      elem = head_;
-    }
+    it = list_.erase(it);
   }
-  tail_ = (head_ == nullptr) ? head_ : prev;
 }
 
 void TracedBufferList::Shutdown(void* remaining, absl::Status shutdown_err) {
   MutexLock lock(&mu_);
-  while (head_) {
-    TracedBuffer* elem = head_;
-    g_timestamps_callback(elem->arg_, &(elem->ts_), shutdown_err);
-    head_ = head_->next_;
-    delete elem;
+  for (auto& elem : list_) {
+    g_timestamps_callback(elem.arg_, &(elem.ts_), shutdown_err);
   }
+  list_.clear();
   if (remaining != nullptr) {
     g_timestamps_callback(remaining, nullptr, shutdown_err);
   }
-  tail_ = head_;
 }
 
 void grpc_tcp_set_write_timestamps_callback(
@@ -22,6 +22,7 @@
 #include <grpc/support/port_platform.h>
 #include <grpc/support/time.h>
 
+#include <deque>
 #include <optional>
 
 #include "src/core/lib/iomgr/error.h"
@@ -121,16 +122,10 @@ class TracedBufferList {
   void ProcessTimestamp(struct sock_extended_err* serr,
                         struct cmsghdr* opt_stats,
                         struct scm_timestamping* tss);
-  // The Size() operation is slow and is used only in tests.
+  // Returns the number of traced buffers; used only in tests.
   int Size() {
     MutexLock lock(&mu_);
-    int size = 0;
-    TracedBuffer* curr = head_;
-    while (curr) {
-      ++size;
-      curr = curr->next_;
-    }
-    return size;
+    return static_cast<int>(list_.size());
   }
   // Cleans the list by calling the callback for each traced buffer in the list
   // with timestamps that it has.
@@ -146,18 +141,17 @@ class TracedBufferList {
    private:
     friend class TracedBufferList;
     gpr_timespec last_timestamp_;
-    TracedBuffer* next_ = nullptr;
     uint32_t seq_no_;  // The sequence number for the last byte in the buffer
     void* arg_;        // The arg to pass to timestamps_callback
     Timestamps ts_;    // The timestamps corresponding to this buffer
   };
   Mutex mu_;
-  // TracedBuffers are ordered by sequence number and would need to be processed
-  // in a FIFO order starting with the smallest sequence number. To enable this,
-  // they are stored in a singly linked with head and tail pointers which allows
-  // easy appends and forward iteration operations.
-  TracedBuffer* head_ = nullptr;
-  TracedBuffer* tail_ = nullptr;
+  // TracedBuffers are ordered by sequence number and are processed in FIFO
+  // order starting with the smallest sequence number. A deque keeps them
+  // contiguous and indexable, so appends need no per-entry allocation, the
+  // prefix matched by a timestamp event can be found by binary search, and
+  // acked prefixes can be dropped in one range erase.
+  std::deque<TracedBuffer> list_;
 };
 
 #else   // GRPC_LINUX_ERRQUEUE
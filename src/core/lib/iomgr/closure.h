@@ -235,6 +235,22 @@ inline bool grpc_closure_list_append(grpc_closure_list* closure_list,
   return was_empty;
 }
 
+/// add \a closure to the front of \a list
+/// Returns true if \a list becomes non-empty
+inline bool grpc_closure_list_prepend(grpc_closure_list* closure_list,
+                                      grpc_closure* closure) {
+  if (closure == nullptr) {
+    return false;
+  }
+  bool was_empty = (closure_list->head == nullptr);
+  closure->next_data.next = closure_list->head;
+  closure_list->head = closure;
+  if (was_empty) {
+    closure_list->tail = closure;
+  }
+  return was_empty;
+}
+
 /// add \a closure to the end of \a list
 /// and set \a closure's result to \a error
 /// Returns true if \a list becomes non-empty
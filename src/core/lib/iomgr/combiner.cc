@@ -34,6 +34,12 @@
 #define STATE_UNORPHANED 1
 #define STATE_ELEM_COUNT_LOW_BIT 2
 
+// Maximum number of closures one borrowed thread executes on a combiner
+// before the remainder of the backlog is cooperatively rescheduled on
+// EventEngine, so that a deeply backlogged combiner cannot capture a poller
+// thread for the whole backlog.
+#define COMBINER_MAX_CLOSURES_PER_THREAD 128
+
 static void combiner_exec(grpc_core::Combiner* lock, grpc_closure* closure,
                           grpc_error_handle error);
 static void combiner_finally_exec(grpc_core::Combiner* lock,
@@ -157,7 +163,10 @@ static void queue_offload(grpc_core::Combiner* lock) {
   // Make the combiner look uncontended by storing a non-null value here, so
   // that we don't immediately offload again.
   gpr_atm_no_barrier_store(&lock->initiating_exec_ctx_or_null, 1);
-  GRPC_TRACE_LOG(combiner, INFO) << "C:" << lock << " queue_offload";
+  lock->closures_run_on_this_thread = 0;
+  GRPC_TRACE_LOG(combiner, INFO)
+      << "C:" << lock << " queue_offload depth="
+      << (gpr_atm_no_barrier_load(&lock->state) >> 1);
   lock->event_engine->Run([lock] {
     grpc_core::ExecCtx exec_ctx(0);
     push_last_on_exec_ctx(lock);
@@ -181,7 +190,8 @@ bool grpc_combiner_continue_exec_ctx() {
       << "C:" << lock << " grpc_combiner_continue_exec_ctx "
       << "contended=" << contended << " exec_ctx_ready_to_finish="
       << grpc_core::ExecCtx::Get()->IsReadyToFinish()
-      << " time_to_execute_final_list=" << lock->time_to_execute_final_list;
+      << " time_to_execute_final_list=" << lock->time_to_execute_final_list
+      << " depth=" << (gpr_atm_no_barrier_load(&lock->state) >> 1);
 
   // offload only if both (1) the combiner is contended and has more than one
   // closure to execute, and (2) the current execution context needs to finish
@@ -193,6 +203,15 @@ bool grpc_combiner_continue_exec_ctx() {
     return true;
   }
 
+  // Cooperatively yield the borrowed thread once it has executed a full batch
+  // of closures and a backlog still remains; the remainder is rescheduled on
+  // EventEngine rather than extending this thread's capture.
+  if (lock->closures_run_on_this_thread >= COMBINER_MAX_CLOSURES_PER_THREAD &&
+      (gpr_atm_acq_load(&lock->state) >> 1) > 1) {
+    queue_offload(lock);
+    return true;
+  }
+
   if (!lock->time_to_execute_final_list ||
       // peek to see if something new has shown up, and execute that with
       // priority
@@ -215,6 +234,7 @@ bool grpc_combiner_continue_exec_ctx() {
         grpc_core::internal::StatusMoveFromHeapPtr(cl->error_data.error);
     cl->error_data.error = 0;
     cl->cb(cl->cb_arg, std::move(cl_err));
+    lock->closures_run_on_this_thread++;
   } else {
     grpc_closure* c = lock->final_list.head;
     CHECK_NE(c, nullptr);
@@ -232,6 +252,8 @@ bool grpc_combiner_continue_exec_ctx() {
       c->error_data.error = 0;
       c->cb(c->cb_arg, std::move(error));
       c = next;
+      ++loops;
+      lock->closures_run_on_this_thread++;
     }
   }
 
@@ -260,6 +282,7 @@ bool grpc_combiner_continue_exec_ctx() {
       break;
     case OLD_STATE_WAS(false, 1):
       // had one count, one unorphaned --> unlocked unorphaned
+      lock->closures_run_on_this_thread = 0;
       return true;
     case OLD_STATE_WAS(true, 1):
       // and one count, one orphaned --> unlocked and orphaned
@@ -47,6 +47,10 @@ class Combiner {
   // lower bit - zero if orphaned (STATE_UNORPHANED)
   // other bits - number of items queued on the lock (STATE_ELEM_COUNT_LOW_BIT)
   gpr_atm state;
+  // Closures executed on the borrowed thread since this combiner was last
+  // scheduled on it; used to bound how long one thread is captured. Only
+  // touched while holding the lock.
+  size_t closures_run_on_this_thread = 0;
   bool time_to_execute_final_list = false;
   grpc_closure_list final_list;
   // TODO(ctiller): delete this when the combiner_offload_to_event_engine
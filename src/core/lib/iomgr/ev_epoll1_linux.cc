@@ -37,6 +37,7 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -90,8 +91,18 @@ typedef struct epoll_set {
   // Index of the first event in epoll_events that has to be processed. This
   // field is only valid if num_events > 0
   gpr_atm cursor;
+
+  // Adaptive events-per-wait batch size: do_epoll_wait() doubles it (up to
+  // MAX_EPOLL_EVENTS) whenever a wait fills the whole batch and halves it
+  // when waits come back mostly empty, so a loaded poller amortizes wakeups
+  // over large batches while a lightly loaded one keeps dequeue latency low.
+  // Only touched by the designated poller thread.
+  int events_per_wait;
 } epoll_set;
 
+// Lower bound for the adaptive events-per-wait batch.
+#define MIN_EPOLL_EVENTS_PER_WAIT 16
+
 // The global singleton epoll set
 static epoll_set g_epoll_set;
 
@@ -123,6 +134,7 @@ static bool epoll_set_init() {
   GRPC_TRACE_LOG(polling, INFO) << "grpc epoll fd: " << g_epoll_set.epfd;
   gpr_atm_no_barrier_store(&g_epoll_set.num_events, 0);
   gpr_atm_no_barrier_store(&g_epoll_set.cursor, 0);
+  g_epoll_set.events_per_wait = MIN_EPOLL_EVENTS_PER_WAIT;
   return true;
 }
 
@@ -732,8 +744,8 @@ static grpc_error_handle do_epoll_wait(grpc_pollset* ps,
     GRPC_SCHEDULING_START_BLOCKING_REGION;
   }
   do {
-    r = epoll_wait(g_epoll_set.epfd, g_epoll_set.events, MAX_EPOLL_EVENTS,
-                   timeout);
+    r = epoll_wait(g_epoll_set.epfd, g_epoll_set.events,
+                   g_epoll_set.events_per_wait, timeout);
   } while (r < 0 && errno == EINTR);
   if (timeout != 0) {
     GRPC_SCHEDULING_END_BLOCKING_REGION;
@@ -747,6 +759,22 @@ static grpc_error_handle do_epoll_wait(grpc_pollset* ps,
   gpr_atm_rel_store(&g_epoll_set.num_events, r);
   gpr_atm_rel_store(&g_epoll_set.cursor, 0);
 
+  // Adapt the batch for the next wait: a full batch means the poller is
+  // running behind, so grow it; a mostly empty wait means wakeup latency
+  // dominates, so shrink it back.
+  const int batch = g_epoll_set.events_per_wait;
+  if (r == batch) {
+    g_epoll_set.events_per_wait = std::min(batch * 2, MAX_EPOLL_EVENTS);
+  } else if (r < batch / 4 && batch > MIN_EPOLL_EVENTS_PER_WAIT) {
+    g_epoll_set.events_per_wait =
+        std::max(batch / 2, MIN_EPOLL_EVENTS_PER_WAIT);
+  }
+  if (g_epoll_set.events_per_wait != batch) {
+    GRPC_TRACE_LOG(polling, INFO)
+        << "ps: " << ps << " events_per_wait " << batch << " -> "
+        << g_epoll_set.events_per_wait;
+  }
+
   return absl::OkStatus();
 }
 
@@ -214,6 +214,11 @@ class GRPC_DLL ExecCtx : public latent_see::ParentScope {
   static void Run(const DebugLocation& location, grpc_closure* closure,
                   grpc_error_handle error);
 
+  /// As Run, but schedules \a closure at the front of the queue so it runs
+  /// before work that is already enqueued on this exec ctx.
+  static void RunUrgent(const DebugLocation& location, grpc_closure* closure,
+                        grpc_error_handle error);
+
   static void RunList(const DebugLocation& location, grpc_closure_list* list);
 
  protected:
@@ -59,6 +59,14 @@
 // Linux has TCP_INQ support since 4.18, but it is safe to set
 // the socket option on older kernels.
 #define GRPC_HAVE_TCP_INQ 1
+// Linux has TCP_ZEROCOPY_RECEIVE since 4.18; unsupported kernels are
+// detected at runtime (the receive queue mmap fails) and we fall back.
+#define GRPC_HAVE_TCP_ZEROCOPY_RECEIVE 1
+// splice(2) has moved pages between sockets and pipes since 2.6.17.
+#define GRPC_HAVE_SPLICE 1
+// SO_MAX_PACING_RATE has let the kernel pace a socket's transmissions
+// since 3.13; older kernels just fail the setsockopt at runtime.
+#define GRPC_HAVE_SO_MAX_PACING_RATE 1
 #ifdef LINUX_VERSION_CODE
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0)
 #define GRPC_LINUX_ERRQUEUE 1
@@ -36,6 +36,7 @@
 #include <grpc/byte_buffer.h>
 #include <grpc/event_engine/endpoint_config.h>
 #include <grpc/event_engine/event_engine.h>
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/sync.h>
 #include <grpc/support/time.h>
@@ -264,6 +265,10 @@ static grpc_error_handle tcp_server_create(grpc_closure* shutdown_complete,
   if (value.has_value()) {
     s->expand_wildcard_addrs = (*value != 0);
   }
+  value = config.GetInt(GRPC_ARG_PREALLOCATED_LISTENER_FD);
+  if (value.has_value() && *value >= 0) {
+    s->requested_pre_allocated_fd = *value;
+  }
   gpr_ref_init(&s->refs, 1);
   gpr_mu_init(&s->mu);
   s->active_ports = 0;
@@ -612,6 +617,54 @@ static grpc_error_handle clone_port(grpc_tcp_listener* listener,
   return absl::OkStatus();
 }
 
+// Returns true if fd is a listening socket whose bound address has the same
+// family as addr and, when addr carries a specific port, the same port.
+static bool supplied_fd_matches(int fd, const grpc_resolved_address* addr) {
+  grpc_resolved_address sockname;
+  memset(&sockname, 0, sizeof(sockname));
+  sockname.len = static_cast<socklen_t>(sizeof(struct sockaddr_storage));
+  if (getsockname(fd, reinterpret_cast<grpc_sockaddr*>(sockname.addr),
+                  &sockname.len) < 0) {
+    return false;
+  }
+  if (grpc_sockaddr_get_family(&sockname) != grpc_sockaddr_get_family(addr)) {
+    return false;
+  }
+  int requested_port = grpc_sockaddr_get_port(addr);
+  return requested_port == 0 ||
+         grpc_sockaddr_get_port(&sockname) == requested_port;
+}
+
+// Check whether the application supplied an inherited listening FD via
+// GRPC_ARG_PREALLOCATED_LISTENER_FD (e.g. one received over SCM_RIGHTS from
+// a previous incarnation of this server). If it matches addr, set its value
+// to s->pre_allocated_fd so that the next listener adopts it instead of
+// binding a fresh socket.
+static void set_matching_supplied_fd(grpc_tcp_server* s,
+                                     const grpc_resolved_address* addr,
+                                     int requested_port) {
+  int fd = s->requested_pre_allocated_fd;
+  if (fd < 0 || grpc_tcp_server_pre_allocated_fd(s) > 0) {
+    return;
+  }
+  grpc_resolved_address addr6_v4mapped;
+  if (grpc_sockaddr_to_v4mapped(addr, &addr6_v4mapped)) {
+    addr = &addr6_v4mapped;
+  }
+  if (grpc_sockaddr_is_wildcard(addr, &requested_port)) {
+    grpc_resolved_address wild4;
+    grpc_resolved_address wild6;
+    grpc_sockaddr_make_wildcards(requested_port, &wild4, &wild6);
+    if (supplied_fd_matches(fd, &wild4) || supplied_fd_matches(fd, &wild6)) {
+      grpc_tcp_server_set_pre_allocated_fd(s, fd);
+    }
+    return;
+  }
+  if (supplied_fd_matches(fd, addr)) {
+    grpc_tcp_server_set_pre_allocated_fd(s, fd);
+  }
+}
+
 static grpc_error_handle tcp_server_add_port(grpc_tcp_server* s,
                                              const grpc_resolved_address* addr,
                                              int* out_port) {
@@ -687,6 +740,9 @@ static grpc_error_handle tcp_server_add_port(grpc_tcp_server* s,
   /* Check if systemd has pre-allocated valid FDs */
   set_matching_sd_fds(s, addr, requested_port);
 
+  /* Check if the application supplied an inherited listening FD */
+  set_matching_supplied_fd(s, addr, requested_port);
+
   /* Do not unlink if there are pre-allocated FDs, or it will stop
      working after the first client connects */
   if (grpc_tcp_server_pre_allocated_fd(s) <= 0) {
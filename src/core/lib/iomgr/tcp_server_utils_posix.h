@@ -116,6 +116,10 @@ struct grpc_tcp_server {
       ee_listener = nullptr;
   /* used to store a pre-allocated FD assigned to a socket */
   int pre_allocated_fd;
+  /* an inherited listening FD supplied via
+     GRPC_ARG_PREALLOCATED_LISTENER_FD; adopted as pre_allocated_fd by the
+     first port whose address matches the FD's bound address */
+  int requested_pre_allocated_fd = -1;
 };
 
 // If successful, add a listener to \a s for \a addr, set \a dsmode for the
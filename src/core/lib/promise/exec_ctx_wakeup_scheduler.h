@@ -16,6 +16,7 @@
 #define GRPC_SRC_CORE_LIB_PROMISE_EXEC_CTX_WAKEUP_SCHEDULER_H
 
 #include <grpc/support/port_platform.h>
+#include <stdint.h>
 
 #include "absl/status/status.h"
 #include "src/core/lib/iomgr/closure.h"
@@ -25,14 +26,25 @@
 
 namespace grpc_core {
 
+// Priority lane for scheduled activity wakeups. Urgent wakeups run before
+// work that is already enqueued on the exec ctx, so a control-plane activity
+// can jump ahead of a backlog of data-path closures rather than queue behind
+// them.
+enum class WakeupPriority : uint8_t { kNormal, kUrgent };
+
 // A callback scheduler for activities that works by scheduling callbacks on the
 // exec ctx.
 class ExecCtxWakeupScheduler {
  public:
+  ExecCtxWakeupScheduler() = default;
+  explicit ExecCtxWakeupScheduler(WakeupPriority priority)
+      : priority_(priority) {}
+
   template <typename ActivityType>
   class BoundScheduler {
    protected:
-    explicit BoundScheduler(ExecCtxWakeupScheduler) {}
+    explicit BoundScheduler(ExecCtxWakeupScheduler scheduler)
+        : priority_(scheduler.priority_) {}
     BoundScheduler(const BoundScheduler&) = delete;
     BoundScheduler& operator=(const BoundScheduler&) = delete;
     void ScheduleWakeup() {
@@ -42,12 +54,20 @@ class ExecCtxWakeupScheduler {
             static_cast<ActivityType*>(arg)->RunScheduledWakeup();
           },
           static_cast<ActivityType*>(this), nullptr);
-      ExecCtx::Run(DEBUG_LOCATION, &closure_, absl::OkStatus());
+      if (priority_ == WakeupPriority::kUrgent) {
+        ExecCtx::RunUrgent(DEBUG_LOCATION, &closure_, absl::OkStatus());
+      } else {
+        ExecCtx::Run(DEBUG_LOCATION, &closure_, absl::OkStatus());
+      }
     }
 
    private:
     grpc_closure closure_;
+    const WakeupPriority priority_;
   };
+
+ private:
+  WakeupPriority priority_ = WakeupPriority::kNormal;
 };
 
 }  // namespace grpc_core
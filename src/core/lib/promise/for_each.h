@@ -18,6 +18,7 @@
 #include <grpc/support/port_platform.h>
 #include <stdint.h>
 
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -160,8 +161,23 @@ class ForEach {
   }
 
   Poll<Result> operator()() {
-    if (reading_next_) return PollReaderNext();
-    return PollAction();
+    // Drain as many ready items as are available: each iteration pulls one
+    // item and runs the action over it. Looping here - rather than having the
+    // read and action steps tail call one another - keeps the stack flat when
+    // hundreds of messages are ready at once, so the whole ready backlog is
+    // consumed in one activity poll.
+    while (true) {
+      if (reading_next_) {
+        if (auto result = PollReaderNext(); result.has_value()) {
+          return std::move(*result);
+        }
+        // A value arrived and the action for it was constructed.
+      }
+      if (auto result = PollAction(); result.has_value()) {
+        return std::move(*result);
+      }
+      // The action completed successfully and the next read was started.
+    }
   }
 
  private:
@@ -178,7 +194,11 @@ class ForEach {
                         ":", whence_.line(), "]: ");
   }
 
-  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION Poll<Result> PollReaderNext() {
+  // Poll for the next item. Returns std::nullopt if a value arrived and the
+  // action promise for it was constructed; otherwise returns the final result
+  // or Pending.
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION std::optional<Poll<Result>>
+  PollReaderNext() {
     GRPC_TRACE_LOG(promise_primitives, INFO) << DebugTag() << " PollReaderNext";
     auto r = reader_next_();
     if (auto* p = r.value_if_ready()) {
@@ -191,24 +211,27 @@ class ForEach {
               NextValueTraits<ReaderResult>::TakeValue(*p));
           Construct(&in_action_, std::move(action), std::move(*p));
           reading_next_ = false;
-          return PollAction();
+          return std::nullopt;
         }
         case NextValueType::kEndOfStream: {
           GRPC_TRACE_LOG(promise_primitives, INFO)
               << DebugTag() << " PollReaderNext: got end of stream";
-          return Done<Result>::Make(false);
+          return Poll<Result>(Done<Result>::Make(false));
         }
         case NextValueType::kError: {
           GRPC_TRACE_LOG(promise_primitives, INFO)
               << DebugTag() << " PollReaderNext: got error";
-          return Done<Result>::Make(true);
+          return Poll<Result>(Done<Result>::Make(true));
         }
       }
     }
-    return Pending();
+    return Poll<Result>(Pending{});
   }
 
-  Poll<Result> PollAction() {
+  // Poll the current action. Returns std::nullopt if the action completed
+  // successfully and the next read was started; otherwise returns the final
+  // result or Pending.
+  std::optional<Poll<Result>> PollAction() {
     GRPC_TRACE_LOG(promise_primitives, INFO) << DebugTag() << " PollAction";
     auto r = in_action_.promise();
     if (auto* p = r.value_if_ready()) {
@@ -216,12 +239,12 @@ class ForEach {
         Destruct(&in_action_);
         Construct(&reader_next_, reader_.Next());
         reading_next_ = true;
-        return PollReaderNext();
+        return std::nullopt;
       } else {
-        return std::move(*p);
+        return Poll<Result>(std::move(*p));
       }
     }
-    return Pending();
+    return Poll<Result>(Pending{});
   }
 
   GPR_NO_UNIQUE_ADDRESS Reader reader_;
@@ -249,9 +249,13 @@ class Mpsc {
   std::atomic<uint64_t> queued_tokens_{0};
   Waker active_tokens_waker_;
   std::atomic<Node*> head_ = &stub_;
+  // Consumer-private dequeue state: keep it off the cacheline that producers
+  // write through head_.
   alignas(GPR_CACHELINE_SIZE) Node* tail_ = &stub_;
   Node* accepted_head_ = nullptr;
-  std::atomic<uint64_t> active_tokens_{0};
+  // Decremented by token releasers on arbitrary threads; keep it off the
+  // consumer's cacheline so releases don't invalidate tail_/accepted_head_.
+  alignas(GPR_CACHELINE_SIZE) std::atomic<uint64_t> active_tokens_{0};
   Node stub_{0};
 #ifndef NDEBUG
   bool drained = false;
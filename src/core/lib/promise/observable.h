@@ -18,9 +18,11 @@
 #include <grpc/support/port_platform.h>
 
 #include "absl/container/flat_hash_set.h"
+#include "absl/container/inlined_vector.h"
 #include "absl/functional/any_invocable.h"
 #include "absl/log/check.h"
 #include "src/core/lib/promise/activity.h"
+#include "src/core/lib/promise/party.h"
 #include "src/core/lib/promise/poll.h"
 #include "src/core/util/sync.h"
 
@@ -64,10 +66,26 @@ class Observable {
     explicit State(T value) : value_(std::move(value)) {}
 
     // Update the value and wake all observers.
+    // Wakeups happen after the lock is dropped, so woken readers can re-read
+    // the value without piling up behind the writer, and the wakeup
+    // scheduling cost isn't paid under the lock - this matters when many
+    // observers are parked (e.g. queued LB picks during an update burst).
+    // The previous value is likewise destroyed outside the lock.
     void Set(T value) {
-      MutexLock lock(&mu_);
-      std::swap(value_, value);
-      WakeAll();
+      absl::InlinedVector<Waker, 8> wakers;
+      {
+        MutexLock lock(&mu_);
+        std::swap(value_, value);
+        wakers.reserve(observers_.size());
+        for (auto* observer : observers_) {
+          wakers.push_back(observer->TakeWaker());
+        }
+        observers_.clear();
+      }
+      // Batch the wakeups into one scheduled closure per party rather than
+      // scheduling each observer separately.
+      Party::AsyncWakeupBatch wakeup_batch;
+      for (auto& waker : wakers) waker.WakeupAsync();
     }
 
     // Export our mutex so that Observer can use it.
@@ -91,13 +109,6 @@ class Observable {
     }
 
    private:
-    // Wake all observers.
-    void WakeAll() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
-      for (auto* observer : observers_) {
-        observer->Wakeup();
-      }
-    }
-
     Mutex mu_;
     // All observers that may need an update.
     absl::flat_hash_set<Observer*> observers_ ABSL_GUARDED_BY(mu_);
@@ -129,7 +140,9 @@ class Observable {
     }
     Observer& operator=(Observer&& other) noexcept = delete;
 
-    void Wakeup() { waker_.WakeupAsync(); }
+    // Relinquish this observer's waker to the caller (held under the state
+    // mutex); the observer re-registers on its next pending poll.
+    Waker TakeWaker() { return std::move(waker_); }
 
     virtual bool ShouldReturn(const T& current) = 0;
 
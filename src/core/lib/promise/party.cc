@@ -29,6 +29,7 @@
 #include "src/core/lib/promise/activity.h"
 #include "src/core/util/json/json_writer.h"
 #include "src/core/util/latent_see.h"
+#include "src/core/util/shared_bit_gen.h"
 #include "src/core/util/sync.h"
 
 #ifdef GRPC_MAXIMIZE_THREADYNESS
@@ -151,6 +152,37 @@ Party::Participant::~Participant() {
   }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Party::AsyncWakeupBatch
+
+namespace {
+thread_local Party::AsyncWakeupBatch* g_async_wakeup_batch = nullptr;
+}
+
+Party::AsyncWakeupBatch::AsyncWakeupBatch()
+    : prev_(std::exchange(g_async_wakeup_batch, this)) {}
+
+Party::AsyncWakeupBatch::~AsyncWakeupBatch() {
+  DCHECK(g_async_wakeup_batch == this);
+  g_async_wakeup_batch = prev_;
+  if (pending_.empty()) return;
+  // Each collected party was left locked with a ref by WakeupAsync; run them
+  // all from one closure so that ExecCtx setup and scheduling costs are paid
+  // once per batch rather than once per party.
+  auto* event_engine =
+      pending_[0]
+          .party->arena_
+          ->GetContext<grpc_event_engine::experimental::EventEngine>();
+  CHECK(event_engine != nullptr);
+  event_engine->Run([pending = std::move(pending_)]() {
+    GRPC_LATENT_SEE_PARENT_SCOPE("Party::AsyncWakeupBatch");
+    ExecCtx exec_ctx;
+    for (const auto& wakeup : pending) {
+      RunLockedAndUnref(wakeup.party, wakeup.prev_state);
+    }
+  });
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Party::SpawnSerializer
 
@@ -466,7 +498,7 @@ uint64_t Party::NextAllocationMask(uint64_t current_allocation_mask) {
     ++unset_bits;
   }
   CHECK_GT(unset_bits, 0);
-  absl::BitGen bitgen;
+  SharedBitGen bitgen;
   size_t selected = absl::Uniform<size_t>(bitgen, 0, unset_bits);
   for (size_t i = 0; i < party_detail::kMaxParticipants; i++) {
     if (current_allocation_mask & (1ull << i)) continue;
@@ -542,6 +574,12 @@ void Party::WakeupAsync(WakeupMask wakeup_mask) {
                                        std::memory_order_acquire)) {
         LogStateChange("WakeupAsync", prev_state, prev_state | kLocked);
         wakeup_mask_ |= wakeup_mask;
+        // If this thread is collecting wakeups, defer scheduling: the batch
+        // will run all collected parties from one EventEngine closure.
+        if (auto* batch = g_async_wakeup_batch; batch != nullptr) {
+          batch->pending_.push_back({this, prev_state});
+          return;
+        }
         arena_->GetContext<grpc_event_engine::experimental::EventEngine>()->Run(
             [this, prev_state]() {
               GRPC_LATENT_SEE_PARENT_SCOPE("Party::WakeupAsync");
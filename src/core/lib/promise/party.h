@@ -26,6 +26,7 @@
 #include <utility>
 
 #include "absl/base/attributes.h"
+#include "absl/container/inlined_vector.h"
 #include "absl/functional/any_invocable.h"
 #include "absl/log/check.h"
 #include "absl/strings/string_view.h"
@@ -240,6 +241,32 @@ class Party : public Activity, private Wakeable {
     uint64_t prev_state_;
   };
 
+  // Batches asynchronous wakeups issued on the current thread.
+  // While an AsyncWakeupBatch is in scope, each Party::WakeupAsync call that
+  // wins its party's lock records the party instead of scheduling its own
+  // EventEngine closure; when the batch goes out of scope all recorded parties
+  // are run by a single closure sharing one ExecCtx. This is useful for code
+  // (e.g. a transport read completion) that wakes many call parties from one
+  // poller callback, where per-party closures dominate scheduling costs.
+  // Scopes may nest: wakeups are collected by the innermost batch, and each
+  // scope flushes what was collected during it. Thread compatible.
+  class AsyncWakeupBatch {
+   public:
+    AsyncWakeupBatch();
+    ~AsyncWakeupBatch();
+    AsyncWakeupBatch(const AsyncWakeupBatch&) = delete;
+    AsyncWakeupBatch& operator=(const AsyncWakeupBatch&) = delete;
+
+   private:
+    friend class Party;
+    struct PendingWakeup {
+      Party* party;
+      uint64_t prev_state;
+    };
+    AsyncWakeupBatch* const prev_;
+    absl::InlinedVector<PendingWakeup, 8> pending_;
+  };
+
   // SpawnSerializer is a helper class to serialize the execution of multiple
   // promises on a party.
   //
@@ -17,13 +17,19 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/support/port_platform.h>
 
+#include <map>
+#include <memory>
 #include <utility>
+#include <vector>
 
+#include "absl/base/thread_annotations.h"
 #include "src/core/lib/event_engine/event_engine_context.h"  // IWYU pragma: keep
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/context.h"
 #include "src/core/lib/promise/poll.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/sync.h"
 #include "src/core/util/time.h"
 
 namespace grpc_core {
@@ -90,4 +96,122 @@ bool Sleep::ActiveClosure::HasRun() const {
   return refs_.load(std::memory_order_acquire) == 1;
 }
 
+namespace {
+
+// Round deadline up to the next quantum boundary, so that all coarse sleeps
+// expiring within the same quantum agree on one bucket deadline.
+Timestamp QuantizeDeadline(Timestamp deadline, Duration quantum) {
+  const int64_t q = quantum.millis();
+  if (q <= 1 || deadline == Timestamp::InfFuture()) return deadline;
+  const uint64_t millis = deadline.milliseconds_after_process_epoch();
+  return Timestamp::FromMillisecondsAfterProcessEpoch(millis +
+                                                      (q - millis % q) % q);
+}
+
+}  // namespace
+
+// Registry of pending coarse sleep buckets. The first sleeper into a bucket
+// arms one EventEngine timer for it; every entry accumulated whilst that
+// timer is pending is woken by its single firing.
+class CoarseSleepBucketList final {
+ public:
+  static CoarseSleepBucketList* Get() {
+    static NoDestruct<CoarseSleepBucketList> list;
+    return &*list;
+  }
+
+  void Add(Timestamp bucket_end, CoarseSleep::BucketEntry* entry) {
+    std::shared_ptr<EventEngine> arm_on;
+    {
+      MutexLock lock(&mu_);
+      auto& bucket = buckets_[bucket_end];
+      bucket.push_back(entry);
+      // First entry into the bucket: this sleeper arms the shared timer.
+      if (bucket.size() == 1) {
+        arm_on = GetContext<EventEngine>()->shared_from_this();
+      }
+    }
+    if (arm_on != nullptr) {
+      arm_on->RunAfter(bucket_end - Timestamp::Now(),
+                       [this, bucket_end]() { Fire(bucket_end); });
+    }
+  }
+
+ private:
+  void Fire(Timestamp bucket_end) {
+    std::vector<CoarseSleep::BucketEntry*> entries;
+    {
+      MutexLock lock(&mu_);
+      auto it = buckets_.find(bucket_end);
+      if (it != buckets_.end()) {
+        entries = std::move(it->second);
+        buckets_.erase(it);
+      }
+    }
+    // If a new sleeper lands in this bucket after the erase above it starts a
+    // fresh bucket (and a fresh, immediately expiring timer) - never lost.
+    ExecCtx exec_ctx;
+    for (CoarseSleep::BucketEntry* entry : entries) {
+      entry->Wake();
+    }
+  }
+
+  Mutex mu_;
+  std::map<Timestamp, std::vector<CoarseSleep::BucketEntry*>> buckets_
+      ABSL_GUARDED_BY(mu_);
+};
+
+CoarseSleep::CoarseSleep(Timestamp deadline, Duration quantum)
+    : deadline_(QuantizeDeadline(deadline, quantum)) {}
+
+CoarseSleep::~CoarseSleep() {
+  if (entry_ != nullptr) entry_->Cancel();
+}
+
+Poll<absl::Status> CoarseSleep::operator()() {
+  if (!IsSleepPromiseExecCtxRemovalEnabled()) {
+    // Invalidate now so that we see a fresh version of the time.
+    // TODO(ctiller): the following can be safely removed when we remove
+    // ExecCtx.
+    ExecCtx::Get()->InvalidateNow();
+  }
+  const auto now = Timestamp::Now();
+  // If the deadline is earlier than now we can just return.
+  if (deadline_ <= now) return absl::OkStatus();
+  if (entry_ == nullptr) {
+    entry_ = new BucketEntry();
+    CoarseSleepBucketList::Get()->Add(deadline_, entry_);
+  }
+  if (entry_->HasRun()) return absl::OkStatus();
+  return Pending{};
+}
+
+CoarseSleep::BucketEntry::BucketEntry()
+    : waker_(GetContext<Activity>()->MakeOwningWaker()) {}
+
+void CoarseSleep::BucketEntry::Wake() {
+  auto waker = std::move(waker_);
+  if (Unref()) {
+    delete this;
+  } else {
+    waker.Wakeup();
+  }
+}
+
+void CoarseSleep::BucketEntry::Cancel() {
+  // The shared bucket timer cannot be cancelled on behalf of one sleeper, so
+  // just drop our ref; Wake() will drop the other when the bucket fires.
+  if (Unref()) delete this;
+}
+
+bool CoarseSleep::BucketEntry::Unref() {
+  return (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1);
+}
+
+bool CoarseSleep::BucketEntry::HasRun() const {
+  // If the bucket has fired (ie woken up the activity) then it will have
+  // decremented this ref count once.
+  return refs_.load(std::memory_order_acquire) == 1;
+}
+
 }  // namespace grpc_core
@@ -86,6 +86,68 @@ class Sleep final {
   ActiveClosure* closure_{nullptr};
 };
 
+// CoarseSleep is a Promise with the same contract as Sleep, except that the
+// deadline is rounded up to the next quantization boundary and all coarse
+// sleeps that land in the same bucket share one EventEngine timer.
+//
+// Use it for long, imprecise waits that are usually cancelled before they
+// fire (keepalives, reconnect and retry backoff): those arm and cancel one
+// timer per sleep, and at high call volume the timer subsystem churn costs
+// more than the sleeps themselves. The price is up to one quantum of extra
+// latency on the wakeup.
+class CoarseSleep final {
+ public:
+  static constexpr Duration kDefaultQuantum = Duration::Milliseconds(10);
+
+  explicit CoarseSleep(Timestamp deadline, Duration quantum = kDefaultQuantum);
+  explicit CoarseSleep(Duration timeout, Duration quantum = kDefaultQuantum)
+      : CoarseSleep(Timestamp::Now() + timeout, quantum) {}
+  ~CoarseSleep();
+
+  CoarseSleep(const CoarseSleep&) = delete;
+  CoarseSleep& operator=(const CoarseSleep&) = delete;
+  CoarseSleep(CoarseSleep&& other) noexcept
+      : deadline_(other.deadline_),
+        entry_(std::exchange(other.entry_, nullptr)) {}
+  CoarseSleep& operator=(CoarseSleep&& other) noexcept {
+    deadline_ = other.deadline_;
+    std::swap(entry_, other.entry_);
+    return *this;
+  }
+
+  Poll<absl::Status> operator()();
+
+ private:
+  friend class CoarseSleepBucketList;
+
+  // One sleeper's registration in a bucket. Unlike Sleep::ActiveClosure it
+  // owns no timer: the shared bucket timer calls Wake() when the bucket's
+  // deadline passes. Cancellation cannot remove the entry from the bucket,
+  // so a cancelled entry just lingers (for at most one quantum) until the
+  // bucket fires and drops the last ref.
+  class BucketEntry final {
+   public:
+    BucketEntry();
+
+    // Called by the shared bucket timer when the bucket's deadline passes.
+    void Wake();
+    // After calling Cancel, it's no longer safe to access this object.
+    void Cancel();
+
+    bool HasRun() const;
+
+   private:
+    bool Unref();
+
+    Waker waker_;
+    // One ref dropped by Wake(), the other by Cancel().
+    std::atomic<int> refs_{2};
+  };
+
+  Timestamp deadline_;  // Quantized.
+  BucketEntry* entry_{nullptr};
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_LIB_PROMISE_SLEEP_H
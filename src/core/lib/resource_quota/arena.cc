@@ -31,12 +31,74 @@ namespace grpc_core {
 
 namespace {
 
-void* ArenaStorage(size_t& initial_size) {
+// Per-thread cache of recently destroyed initial arena blocks. Call arenas
+// are created and destroyed at very high rates, almost always at the same
+// size thanks to the call size estimator; handing the next arena a block that
+// was just released on the same thread keeps that memory cache-hot and skips
+// a malloc/free pair without touching any shared state.
+constexpr size_t kMaxCachedArenaBlocks = 8;
+constexpr size_t kMaxCachedArenaBlockSize = 8192;
+
+struct ArenaBlockCache {
+  struct Block {
+    void* ptr;
+    size_t size;
+  };
+  Block blocks[kMaxCachedArenaBlocks];
+  size_t count = 0;
+  size_t next_evict = 0;
+  ~ArenaBlockCache() {
+    for (size_t i = 0; i < count; ++i) gpr_free_aligned(blocks[i].ptr);
+  }
+};
+
+thread_local ArenaBlockCache g_arena_block_cache;
+
+// Returns a cached block of exactly initial_size bytes, or nullptr on a
+// cache miss. Exact matching keeps quota accounting identical to a fresh
+// allocation; when the call size estimate drifts, blocks of both the old and
+// new size simply coexist in the cache until the old ones are evicted.
+void* TakeCachedArenaBlock(size_t initial_size) {
+  ArenaBlockCache& cache = g_arena_block_cache;
+  for (size_t i = 0; i < cache.count; ++i) {
+    if (cache.blocks[i].size != initial_size) continue;
+    void* ptr = cache.blocks[i].ptr;
+    cache.blocks[i] = cache.blocks[--cache.count];
+    return ptr;
+  }
+  return nullptr;
+}
+
+// Takes ownership of ptr if there is cache space for it; returns false if the
+// caller should free it instead.
+bool CacheArenaBlock(void* ptr, size_t size) {
+  if (size > kMaxCachedArenaBlockSize) return false;
+  ArenaBlockCache& cache = g_arena_block_cache;
+  if (cache.count == kMaxCachedArenaBlocks) {
+    // Evict round-robin so blocks of a stale size cannot pin the cache once
+    // the call size estimate moves on.
+    gpr_free_aligned(cache.blocks[cache.next_evict].ptr);
+    cache.blocks[cache.next_evict] = {ptr, size};
+    cache.next_evict = (cache.next_evict + 1) % kMaxCachedArenaBlocks;
+    return true;
+  }
+  cache.blocks[cache.count++] = {ptr, size};
+  return true;
+}
+
+void* ArenaStorage(size_t& initial_size, ArenaFactory* arena_factory) {
   size_t base_size = Arena::ArenaOverhead() +
                      GPR_ROUND_UP_TO_ALIGNMENT_SIZE(
                          arena_detail::BaseArenaContextTraits::ContextSize());
   initial_size =
       std::max(GPR_ROUND_UP_TO_ALIGNMENT_SIZE(initial_size), base_size);
+  // Prefer a block the factory retained from a previous arena: for call
+  // arenas that gives serial traffic on a channel back its own memory even
+  // when calls are destroyed on a different thread than they are created on.
+  void* retained = arena_factory->TakeArenaStorage(initial_size);
+  if (retained != nullptr) return retained;
+  void* cached = TakeCachedArenaBlock(initial_size);
+  if (cached != nullptr) return cached;
   static constexpr size_t alignment =
       (GPR_CACHELINE_SIZE > GPR_MAX_ALIGNMENT &&
        GPR_CACHELINE_SIZE % GPR_MAX_ALIGNMENT == 0)
@@ -45,8 +107,59 @@ void* ArenaStorage(size_t& initial_size) {
   return gpr_malloc_aligned(initial_size, alignment);
 }
 
+thread_local ArenaAllocAccounting::Consumer g_arena_alloc_consumer =
+    ArenaAllocAccounting::Consumer::kUnattributed;
+
+std::atomic<size_t>
+    g_arena_alloc_bytes[ArenaAllocAccounting::kNumConsumers] = {};
+
 }  // namespace
 
+std::atomic<bool> ArenaAllocAccounting::enabled_{false};
+
+void ArenaAllocAccounting::Enable() {
+  enabled_.store(true, std::memory_order_relaxed);
+}
+
+void ArenaAllocAccounting::Reset() {
+  for (auto& bytes : g_arena_alloc_bytes) {
+    bytes.store(0, std::memory_order_relaxed);
+  }
+}
+
+size_t ArenaAllocAccounting::BytesFor(Consumer consumer) {
+  return g_arena_alloc_bytes[static_cast<size_t>(consumer)].load(
+      std::memory_order_relaxed);
+}
+
+const char* ArenaAllocAccounting::ConsumerName(Consumer consumer) {
+  switch (consumer) {
+    case Consumer::kUnattributed:
+      return "unattributed";
+    case Consumer::kMetadata:
+      return "metadata";
+    case Consumer::kFilters:
+      return "filters";
+    case Consumer::kTransportStream:
+      return "transport_stream";
+    case Consumer::kTracers:
+      return "tracers";
+  }
+  GPR_UNREACHABLE_CODE(return "unknown");
+}
+
+ArenaAllocAccounting::Scope::Scope(Consumer consumer)
+    : prev_(g_arena_alloc_consumer) {
+  g_arena_alloc_consumer = consumer;
+}
+
+ArenaAllocAccounting::Scope::~Scope() { g_arena_alloc_consumer = prev_; }
+
+void ArenaAllocAccounting::Record(size_t size) {
+  g_arena_alloc_bytes[static_cast<size_t>(g_arena_alloc_consumer)].fetch_add(
+      size, std::memory_order_relaxed);
+}
+
 Arena::~Arena() {
   for (size_t i = 0; i < arena_detail::BaseArenaContextTraits::NumContexts();
        ++i) {
@@ -67,7 +180,7 @@ Arena::~Arena() {
 
 RefCountedPtr<Arena> Arena::Create(size_t initial_size,
                                    RefCountedPtr<ArenaFactory> arena_factory) {
-  void* p = ArenaStorage(initial_size);
+  void* p = ArenaStorage(initial_size, arena_factory.get());
   return RefCountedPtr<Arena>(
       new (p) Arena(initial_size, std::move(arena_factory)));
 }
@@ -100,8 +213,14 @@ void Arena::DestroyManagedNewObjects() {
 }
 
 void Arena::Destroy() const {
+  const size_t initial_size = initial_zone_size_;
+  // ~Arena releases arena_factory_, so take our own ref first in order to
+  // offer the storage back to the factory afterwards.
+  RefCountedPtr<ArenaFactory> arena_factory = arena_factory_;
   this->~Arena();
-  gpr_free_aligned(const_cast<Arena*>(this));
+  void* storage = const_cast<Arena*>(this);
+  if (arena_factory->ReturnArenaStorage(storage, initial_size)) return;
+  if (!CacheArenaBlock(storage, initial_size)) gpr_free_aligned(storage);
 }
 
 void* Arena::AllocZone(size_t size) {
@@ -31,6 +31,7 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <iosfwd>
 #include <memory>
 #include <utility>
@@ -118,11 +119,69 @@ struct UnrefDestroy {
 
 }  // namespace arena_detail
 
+// Optional process-wide attribution of arena allocations to coarse
+// consumer categories (metadata parsing, filter stacks, transport
+// streams, call tracers).  Used by the per-call memory breakdown
+// harness in test/core/memory_usage.  Disabled by default, costing one
+// well-predicted branch per allocation; once enabled it stays enabled
+// for the life of the process.
+class ArenaAllocAccounting {
+ public:
+  enum class Consumer : uint8_t {
+    kUnattributed = 0,
+    kMetadata,
+    kFilters,
+    kTransportStream,
+    kTracers,
+  };
+  static constexpr size_t kNumConsumers = 5;
+
+  // Starts recording.  Process-wide and irreversible.
+  static void Enable();
+  static bool Enabled() { return enabled_.load(std::memory_order_relaxed); }
+  // Zeroes all per-consumer counters.
+  static void Reset();
+  // Bytes recorded against `consumer` since Enable() (or the last
+  // Reset()), summed across all arenas and threads.
+  static size_t BytesFor(Consumer consumer);
+  static const char* ConsumerName(Consumer consumer);
+
+  // Attributes arena allocations made on this thread to `consumer` for
+  // the lifetime of the scope.
+  class Scope {
+   public:
+    explicit Scope(Consumer consumer);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    Consumer prev_;
+  };
+
+  // Called from Arena::Alloc when enabled.
+  static void Record(size_t size);
+
+ private:
+  static std::atomic<bool> enabled_;
+};
+
 class ArenaFactory : public RefCounted<ArenaFactory> {
  public:
   virtual RefCountedPtr<Arena> MakeArena() = 0;
   virtual void FinalizeArena(Arena* arena) = 0;
 
+  // Offers the storage that backed a destroyed arena's initial zone to the
+  // factory for reuse by a later MakeArena(). Returns true if the factory
+  // took ownership; otherwise the caller remains responsible for the block.
+  virtual bool ReturnArenaStorage(void* /*storage*/, size_t /*size*/) {
+    return false;
+  }
+
+  // Returns a block of exactly `size` bytes previously accepted by
+  // ReturnArenaStorage(), or nullptr if none is available.
+  virtual void* TakeArenaStorage(size_t /*size*/) { return nullptr; }
+
   MemoryAllocator& allocator() { return allocator_; }
 
  protected:
@@ -161,6 +220,9 @@ class Arena final : public RefCounted<Arena, NonPolymorphicRefCount,
   // Allocate \a size bytes from the arena.
   void* Alloc(size_t size) {
     size = GPR_ROUND_UP_TO_ALIGNMENT_SIZE(size);
+    if (GPR_UNLIKELY(ArenaAllocAccounting::Enabled())) {
+      ArenaAllocAccounting::Record(size);
+    }
     size_t begin = total_used_.fetch_add(size, std::memory_order_relaxed);
     if (begin + size <= initial_zone_size_) {
       return reinterpret_cast<char*>(this) + begin;
@@ -20,9 +20,18 @@
 #include <cstdint>
 
 #include "absl/log/check.h"
+#include "src/core/util/shared_bit_gen.h"
 
 namespace grpc_core {
 
+namespace {
+// Fraction of the connection cap at which probabilistic early rejection
+// begins. Between this utilization and the cap, the rejection probability
+// rises linearly from 0 to 1.
+constexpr int kEarlyRejectionNumerator = 4;
+constexpr int kEarlyRejectionDenominator = 5;
+}  // namespace
+
 ConnectionQuota::ConnectionQuota() = default;
 
 void ConnectionQuota::SetMaxIncomingConnections(int max_incoming_connections) {
@@ -30,6 +39,10 @@ void ConnectionQuota::SetMaxIncomingConnections(int max_incoming_connections) {
   CHECK_LT(max_incoming_connections, INT_MAX);
   CHECK(max_incoming_connections_.exchange(
             max_incoming_connections, std::memory_order_release) == INT_MAX);
+  early_rejection_.SetLimits(
+      static_cast<uint64_t>(max_incoming_connections) *
+          kEarlyRejectionNumerator / kEarlyRejectionDenominator,
+      static_cast<uint64_t>(max_incoming_connections));
 }
 
 // Returns true if the incoming connection is allowed to be accepted on the
@@ -44,11 +57,14 @@ bool ConnectionQuota::AllowIncomingConnection(MemoryQuotaRefPtr mem_quota,
     return true;
   }
 
+  SharedBitGen bit_gen;
   int curr_active_connections =
       active_incoming_connections_.load(std::memory_order_acquire);
   do {
-    if (curr_active_connections >=
-        max_incoming_connections_.load(std::memory_order_relaxed)) {
+    // Shed load gradually: always admit below the soft limit, reject with
+    // probability rising linearly towards 1 between the soft limit and the
+    // cap, and always reject at the cap.
+    if (early_rejection_.Reject(curr_active_connections, bit_gen)) {
       return false;
     }
   } while (!active_incoming_connections_.compare_exchange_weak(
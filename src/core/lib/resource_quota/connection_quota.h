@@ -22,6 +22,7 @@
 
 #include "absl/base/thread_annotations.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/util/random_early_detection.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/sync.h"
@@ -55,6 +56,13 @@ class ConnectionQuota : public RefCounted<ConnectionQuota> {
  private:
   std::atomic<int> active_incoming_connections_{0};
   std::atomic<int> max_incoming_connections_{std::numeric_limits<int>::max()};
+  // Rejects connections probabilistically as the active connection count
+  // approaches the cap, so that overload sheds load gradually instead of
+  // flipping between accept-all and refuse-all (which synchronizes client
+  // retries). Configured once by SetMaxIncomingConnections before the
+  // server starts accepting; Reject() is const, so consulting it without
+  // a lock afterwards is safe.
+  RandomEarlyDetection early_rejection_;
 };
 
 using ConnectionQuotaRefPtr = RefCountedPtr<ConnectionQuota>;
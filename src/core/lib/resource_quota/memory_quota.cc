@@ -32,13 +32,16 @@
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/promise/exec_ctx_wakeup_scheduler.h"
+#include "src/core/lib/promise/if.h"
 #include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/race.h"
 #include "src/core/lib/promise/seq.h"
 #include "src/core/lib/slice/slice_refcount.h"
+#include "src/core/telemetry/stats.h"
 #include "src/core/util/mpscq.h"
 #include "src/core/util/useful.h"
 
@@ -52,6 +55,16 @@ constexpr size_t kMaxReplenishBytes = 1024 * 1024;
 // Minimum number of bytes an allocator will request from a quota in one step.
 constexpr size_t kMinReplenishBytes = 4096;
 
+// Upper bound on the number of quota tokens one per-CPU cache shard may hold,
+// regardless of quota size.
+constexpr size_t kMaxTokenCacheShardBytes = 64 * 1024;
+
+// Instantaneous memory pressure above which paced incremental reclamation
+// (when configured) starts running non-destructive reclaimers. Chosen well
+// below the 0.95 set point the pressure controller steers towards, so that
+// incremental reclamation can head off the high pressure regime entirely.
+constexpr double kModerateReclaimPressure = 0.5;
+
 class MemoryQuotaTracker {
  public:
   static MemoryQuotaTracker& Get() {
@@ -431,7 +444,10 @@ class BasicMemoryQuota::WaitForSweepPromise {
   uint64_t token_;
 };
 
-BasicMemoryQuota::BasicMemoryQuota(std::string name) : name_(std::move(name)) {}
+BasicMemoryQuota::BasicMemoryQuota(std::string name)
+    : incremental_reclaim_bytes_(static_cast<size_t>(std::max(
+          0, ConfigVars::Get().MemoryQuotaIncrementalReclaimBytes()))),
+      name_(std::move(name)) {}
 
 void BasicMemoryQuota::Start() {
   auto self = shared_from_this();
@@ -444,14 +460,20 @@ void BasicMemoryQuota::Start() {
   // ... and repeat
   auto reclamation_loop = Loop([self]() {
     return Seq(
-        [self]() -> Poll<int> {
+        [self]() -> Poll<bool> {
           // If there's free memory we no longer need to reclaim memory!
           if (self->free_bytes_.load(std::memory_order_acquire) > 0) {
+            // ... unless incremental reclamation is configured and we're
+            // under moderate pressure, in which case we pay reclamation down
+            // a step at a time rather than saving it all up for an
+            // exhaustion sweep.
+            if (self->TakeIncrementalReclaimStep()) return true;
             return Pending{};
           }
-          return 0;
+          global_stats().IncrementMemoryQuotaExhaustionReclaims();
+          return false;
         },
-        [self]() {
+        [self](bool incremental) {
           // Race biases to the first thing that completes... so this will
           // choose the highest priority/least destructive thing to do that's
           // available.
@@ -460,34 +482,62 @@ void BasicMemoryQuota::Start() {
               return std::tuple(name, std::move(f));
             };
           };
-          return Race(
-              Map(self->reclaimers_[0].Next(), annotate("benign")),
-              Map(self->reclaimers_[1].Next(), annotate("idle")),
-              Map(self->reclaimers_[2].Next(), annotate("destructive")));
+          // Incremental steps only consult the non-destructive queues. The
+          // third arm hands back a null reclaimer if the quota becomes
+          // exhausted while we wait, so the next iteration can run a full
+          // sweep instead of blocking on an empty queue.
+          auto wait_for_exhaustion =
+              [self]() -> Poll<RefCountedPtr<ReclaimerQueue::Handle>> {
+            if (self->free_bytes_.load(std::memory_order_acquire) <= 0) {
+              return RefCountedPtr<ReclaimerQueue::Handle>(nullptr);
+            }
+            return Pending{};
+          };
+          return If(
+              incremental,
+              [&]() {
+                return Race(
+                    Map(self->reclaimers_[0].Next(), annotate("benign")),
+                    Map(self->reclaimers_[1].Next(), annotate("idle")),
+                    Map(wait_for_exhaustion, annotate("exhausted")));
+              },
+              [&]() {
+                return Race(
+                    Map(self->reclaimers_[0].Next(), annotate("benign")),
+                    Map(self->reclaimers_[1].Next(), annotate("idle")),
+                    Map(self->reclaimers_[2].Next(), annotate("destructive")));
+              });
         },
         [self](std::tuple<const char*, RefCountedPtr<ReclaimerQueue::Handle>>
                    arg) {
           auto reclaimer = std::move(std::get<1>(arg));
-          if (GRPC_TRACE_FLAG_ENABLED(resource_quota)) {
-            double free = std::max(intptr_t{0}, self->free_bytes_.load());
-            size_t quota_size = self->quota_size_.load();
-            LOG(INFO) << "RQ: " << self->name_ << " perform "
-                      << std::get<0>(arg)
-                      << " reclamation. Available free bytes: " << free
-                      << ", total quota_size: " << quota_size;
-          }
-          // One of the reclaimer queues gave us a way to get back memory.
-          // Call the reclaimer with a token that contains enough to wake us
-          // up again.
-          const uint64_t token = self->reclamation_counter_.fetch_add(
-                                     1, std::memory_order_relaxed) +
-                                 1;
-          reclaimer->Run(ReclamationSweep(
-              self, token, GetContext<Activity>()->MakeNonOwningWaker()));
-          // Return a promise that will wait for our barrier. This will be
-          // awoken by the token above being destroyed. So, once that token is
-          // destroyed, we'll be able to proceed.
-          return WaitForSweepPromise(self, token);
+          // A null reclaimer means an incremental step was overtaken by
+          // quota exhaustion: skip it and let the next iteration sweep.
+          return If(
+              reclaimer == nullptr,
+              []() -> Poll<Empty> { return Empty{}; },
+              [self, name = std::get<0>(arg),
+               reclaimer = std::move(reclaimer)]() {
+                if (GRPC_TRACE_FLAG_ENABLED(resource_quota)) {
+                  double free = std::max(intptr_t{0}, self->free_bytes_.load());
+                  size_t quota_size = self->quota_size_.load();
+                  LOG(INFO) << "RQ: " << self->name_ << " perform " << name
+                            << " reclamation. Available free bytes: " << free
+                            << ", total quota_size: " << quota_size;
+                }
+                // One of the reclaimer queues gave us a way to get back
+                // memory. Call the reclaimer with a token that contains
+                // enough to wake us up again.
+                const uint64_t token = self->reclamation_counter_.fetch_add(
+                                           1, std::memory_order_relaxed) +
+                                       1;
+                reclaimer->Run(ReclamationSweep(
+                    self, token, GetContext<Activity>()->MakeNonOwningWaker()));
+                // Return a promise that will wait for our barrier. This will
+                // be awoken by the token above being destroyed. So, once that
+                // token is destroyed, we'll be able to proceed.
+                return WaitForSweepPromise(self, token);
+              });
         },
         []() -> LoopCtl<absl::Status> {
           // Continue the loop!
@@ -495,8 +545,12 @@ void BasicMemoryQuota::Start() {
         });
   });
 
+  // Reclamation is how the system digs itself out of memory pressure; run its
+  // wakeups ahead of queued data-path work so a saturated exec ctx can't
+  // starve it.
   reclaimer_activity_ =
-      MakeActivity(std::move(reclamation_loop), ExecCtxWakeupScheduler(),
+      MakeActivity(std::move(reclamation_loop),
+                   ExecCtxWakeupScheduler(WakeupPriority::kUrgent),
                    [](absl::Status status) {
                      CHECK(status.code() == absl::StatusCode::kCancelled);
                    });
@@ -515,15 +569,84 @@ void BasicMemoryQuota::SetSize(size_t new_size) {
   }
 }
 
+size_t BasicMemoryQuota::TokenCacheShardCapacity() const {
+  return std::min(kMaxTokenCacheShardBytes,
+                  quota_size_.load(std::memory_order_relaxed) / 256);
+}
+
+bool BasicMemoryQuota::TakeFromTokenCache(size_t amount) {
+  if (amount > kMaxTokenCacheShardBytes) return false;
+  auto& shard = token_caches_.this_cpu();
+  intptr_t tokens = shard.tokens.load(std::memory_order_relaxed);
+  while (tokens >= static_cast<intptr_t>(amount)) {
+    if (shard.tokens.compare_exchange_weak(
+            tokens, tokens - static_cast<intptr_t>(amount),
+            std::memory_order_acq_rel, std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool BasicMemoryQuota::ReturnToTokenCache(size_t amount) {
+  // Never park tokens while the quota is in overcommit: the reclamation loop
+  // watches free_bytes_, and bytes hidden in a cache would keep it running.
+  if (free_bytes_.load(std::memory_order_relaxed) < 0) return false;
+  const intptr_t capacity = static_cast<intptr_t>(TokenCacheShardCapacity());
+  if (static_cast<intptr_t>(amount) > capacity) return false;
+  auto& shard = token_caches_.this_cpu();
+  intptr_t tokens = shard.tokens.load(std::memory_order_relaxed);
+  while (tokens + static_cast<intptr_t>(amount) <= capacity) {
+    if (shard.tokens.compare_exchange_weak(
+            tokens, tokens + static_cast<intptr_t>(amount),
+            std::memory_order_acq_rel, std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void BasicMemoryQuota::DrainTokenCaches() {
+  intptr_t drained = 0;
+  for (auto& shard : token_caches_) {
+    drained += shard.tokens.exchange(0, std::memory_order_acq_rel);
+  }
+  if (drained != 0) {
+    free_bytes_.fetch_add(drained, std::memory_order_relaxed);
+  }
+}
+
 void BasicMemoryQuota::Take(GrpcMemoryAllocatorImpl* allocator, size_t amount) {
   // If there's a request for nothing, then do nothing!
   if (amount == 0) return;
   DCHECK(amount <= std::numeric_limits<intptr_t>::max());
-  // Grab memory from the quota.
-  auto prior = free_bytes_.fetch_sub(amount, std::memory_order_acq_rel);
-  // If we push into overcommit, awake the reclaimer.
-  if (prior >= 0 && prior < static_cast<intptr_t>(amount)) {
-    if (reclaimer_activity_ != nullptr) reclaimer_activity_->ForceWakeup();
+  // Prefer this CPU's token cache; fall back to the shared counter.
+  if (!TakeFromTokenCache(amount)) {
+    // Grab memory from the quota.
+    auto prior = free_bytes_.fetch_sub(amount, std::memory_order_acq_rel);
+    // If we push into overcommit, awake the reclaimer - but first pull back
+    // any cached tokens, which may show that we're not really out of memory.
+    if (prior >= 0 && prior < static_cast<intptr_t>(amount)) {
+      DrainTokenCaches();
+      if (free_bytes_.load(std::memory_order_relaxed) < 0 &&
+          reclaimer_activity_ != nullptr) {
+        reclaimer_activity_->ForceWakeup();
+      }
+    }
+  }
+
+  // If incremental reclamation is configured, wake the reclaimer each time
+  // another budget's worth of bytes has been taken; whether a reclaimer
+  // actually runs is decided by TakeIncrementalReclaimStep.
+  if (incremental_reclaim_bytes_ > 0) {
+    const size_t taken = bytes_taken_since_incremental_reclaim_.fetch_add(
+                             amount, std::memory_order_relaxed) +
+                         amount;
+    if (taken >= incremental_reclaim_bytes_ &&
+        taken - amount < incremental_reclaim_bytes_ &&
+        reclaimer_activity_ != nullptr) {
+      reclaimer_activity_->ForceWakeup();
+    }
   }
 
   if (IsFreeLargeAllocatorEnabled()) {
@@ -546,6 +669,26 @@ void BasicMemoryQuota::Take(GrpcMemoryAllocatorImpl* allocator, size_t amount) {
   }
 }
 
+bool BasicMemoryQuota::TakeIncrementalReclaimStep() {
+  if (incremental_reclaim_bytes_ == 0) return false;
+  if (bytes_taken_since_incremental_reclaim_.load(std::memory_order_relaxed) <
+      incremental_reclaim_bytes_) {
+    return false;
+  }
+  // The budget is consumed whether or not we run a step, so that a later
+  // rise in pressure starts a fresh accounting period rather than firing
+  // immediately on stale history.
+  bytes_taken_since_incremental_reclaim_.store(0, std::memory_order_relaxed);
+  if (GetPressureInfo().instantaneous_pressure < kModerateReclaimPressure) {
+    return false;
+  }
+  global_stats().IncrementMemoryQuotaIncrementalReclaims();
+  if (GRPC_TRACE_FLAG_ENABLED(resource_quota)) {
+    LOG(INFO) << "RQ: " << name_ << " incremental reclamation step";
+  }
+  return true;
+}
+
 void BasicMemoryQuota::FinishReclamation(uint64_t token, Waker waker) {
   uint64_t current = reclamation_counter_.load(std::memory_order_relaxed);
   if (current != token) return;
@@ -564,6 +707,7 @@ void BasicMemoryQuota::FinishReclamation(uint64_t token, Waker waker) {
 }
 
 void BasicMemoryQuota::Return(size_t amount) {
+  if (ReturnToTokenCache(amount)) return;
   free_bytes_.fetch_add(amount, std::memory_order_relaxed);
 }
 
@@ -663,6 +807,10 @@ void BasicMemoryQuota::MaybeMoveAllocatorSmallToBig(
 }
 
 BasicMemoryQuota::PressureInfo BasicMemoryQuota::GetPressureInfo() {
+  // Tokens parked in per-CPU caches are not counted as free here: reading the
+  // shards would reintroduce the cross-core traffic the caches exist to avoid,
+  // and the resulting overestimate is bounded by TokenCacheShardCapacity() to
+  // a small fraction of the quota.
   double free = free_bytes_.load();
   if (free < 0) free = 0;
   size_t quota_size = quota_size_.load();
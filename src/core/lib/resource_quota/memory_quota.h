@@ -41,6 +41,7 @@
 #include "src/core/lib/promise/poll.h"
 #include "src/core/lib/resource_quota/periodic_update.h"
 #include "src/core/util/orphanable.h"
+#include "src/core/util/per_cpu.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/sync.h"
 #include "src/core/util/time.h"
@@ -348,6 +349,32 @@ class BasicMemoryQuota final
 
   static constexpr intptr_t kInitialSize = std::numeric_limits<intptr_t>::max();
 
+  // Per-CPU cache of quota tokens fronting free_bytes_, so that the common
+  // replenish/donate-back churn stays CPU-local instead of contending on the
+  // shared counter.
+  struct alignas(GPR_CACHELINE_SIZE) TokenCacheShard {
+    std::atomic<intptr_t> tokens{0};
+  };
+
+  // If incremental reclamation is configured and the quota is under moderate
+  // pressure, consume the byte budget accumulated by Take() and return true,
+  // signalling the reclamation loop to run one non-destructive reclaimer.
+  bool TakeIncrementalReclaimStep();
+
+  // Maximum number of tokens one cache shard may hold; scaled with the quota
+  // size so that parked tokens (which are invisible to pressure computation)
+  // stay a small fraction of the total.
+  size_t TokenCacheShardCapacity() const;
+  // Try to satisfy a Take() from this CPU's token cache. Returns false if the
+  // cache cannot cover the full amount.
+  bool TakeFromTokenCache(size_t amount);
+  // Try to park a Return() in this CPU's token cache. Returns false if the
+  // amount is too large, the shard is full, or the quota is in overcommit.
+  bool ReturnToTokenCache(size_t amount);
+  // Flush all cached tokens back to free_bytes_; called before declaring
+  // overcommit so parked tokens cannot trigger a spurious reclamation sweep.
+  void DrainTokenCaches();
+
   // Move allocator from big bucket to small bucket.
   void MaybeMoveAllocatorBigToSmall(GrpcMemoryAllocatorImpl* allocator);
   // Move allocator from small bucket to big bucket.
@@ -359,6 +386,8 @@ class BasicMemoryQuota final
   std::atomic<intptr_t> free_bytes_{kInitialSize};
   // The total number of bytes in this quota.
   std::atomic<size_t> quota_size_{kInitialSize};
+  // Per-CPU token caches fronting free_bytes_.
+  PerCpu<TokenCacheShard> token_caches_{PerCpuOptions().SetMaxShards(16)};
 
   // Reclaimer queues.
   ReclaimerQueue reclaimers_[kNumReclamationPasses];
@@ -376,6 +405,12 @@ class BasicMemoryQuota final
   // We also increment this counter on completion of a sweep, as an indicator
   // that the wait has ended.
   std::atomic<uint64_t> reclamation_counter_{0};
+  // When positive, one non-destructive reclaimer is run per this many bytes
+  // taken from the quota while under moderate pressure, spreading reclamation
+  // out instead of saving it all for an exhaustion sweep.
+  const size_t incremental_reclaim_bytes_;
+  // Bytes taken from the quota since the last incremental reclamation step.
+  std::atomic<size_t> bytes_taken_since_incremental_reclaim_{0};
   // Memory pressure smoothing
   memory_quota_detail::PressureTracker pressure_tracker_;
   // The name of this quota - used for debugging/tracing/etc..
@@ -218,11 +218,88 @@ grpc_slice grpc_slice_from_cpp_string(std::string str) {
   return slice;
 }
 
+namespace {
+
+// Pooled backing storage for slices created by grpc_slice_malloc_large.
+// Each block holds the grpc_slice_refcount header followed by the payload,
+// rounded up to a power-of-two size class, and is recycled through a small
+// per-thread freelist so the common 256B-8KB network buffer sizes skip the
+// heap allocator entirely.
+constexpr size_t kMinPooledSliceBlockSize = 256;
+constexpr size_t kMaxPooledSliceBlockSize = 8192;
+constexpr size_t kPooledSliceClasses = 6;  // 256, 512, ..., 8192
+constexpr size_t kMaxCachedSlicesPerClass = 16;
+
+size_t PooledSliceBlockSize(size_t size_class) {
+  return kMinPooledSliceBlockSize << size_class;
+}
+
+size_t PooledSliceClassForSize(size_t block_size) {
+  size_t size_class = 0;
+  while (PooledSliceBlockSize(size_class) < block_size) ++size_class;
+  return size_class;
+}
+
+struct PooledSliceFreelist {
+  void* blocks[kPooledSliceClasses][kMaxCachedSlicesPerClass];
+  size_t count[kPooledSliceClasses] = {};
+  ~PooledSliceFreelist() {
+    for (size_t c = 0; c < kPooledSliceClasses; ++c) {
+      for (size_t i = 0; i < count[c]; ++i) {
+        delete[] static_cast<uint8_t*>(blocks[c][i]);
+      }
+    }
+  }
+};
+
+thread_local PooledSliceFreelist g_pooled_slice_freelist;
+
+uint8_t* TakePooledSliceBlock(size_t size_class) {
+  auto& freelist = g_pooled_slice_freelist;
+  if (freelist.count[size_class] > 0) {
+    return static_cast<uint8_t*>(
+        freelist.blocks[size_class][--freelist.count[size_class]]);
+  }
+  return new uint8_t[PooledSliceBlockSize(size_class)];
+}
+
+// The destroyer carries the size class in its template argument, so a block
+// freed on any thread lands on that thread's freelist for the right class.
+template <size_t kSizeClass>
+void PooledSliceDestroy(grpc_slice_refcount* refcount) {
+  auto& freelist = g_pooled_slice_freelist;
+  if (freelist.count[kSizeClass] < kMaxCachedSlicesPerClass) {
+    freelist.blocks[kSizeClass][freelist.count[kSizeClass]++] = refcount;
+  } else {
+    delete[] reinterpret_cast<uint8_t*>(refcount);
+  }
+}
+
+constexpr grpc_slice_refcount::DestroyerFn kPooledSliceDestroyers[] = {
+    PooledSliceDestroy<0>, PooledSliceDestroy<1>, PooledSliceDestroy<2>,
+    PooledSliceDestroy<3>, PooledSliceDestroy<4>, PooledSliceDestroy<5>,
+};
+static_assert(sizeof(kPooledSliceDestroyers) /
+                      sizeof(kPooledSliceDestroyers[0]) ==
+                  kPooledSliceClasses,
+              "one destroyer per pooled slice size class");
+
+}  // namespace
+
 grpc_slice grpc_slice_malloc_large(size_t length) {
   grpc_slice slice;
-  uint8_t* memory = new uint8_t[sizeof(grpc_slice_refcount) + length];
-  slice.refcount = new (memory) grpc_slice_refcount(
-      [](grpc_slice_refcount* p) { delete[] reinterpret_cast<uint8_t*>(p); });
+  const size_t block_size = sizeof(grpc_slice_refcount) + length;
+  uint8_t* memory;
+  if (block_size <= kMaxPooledSliceBlockSize) {
+    const size_t size_class = PooledSliceClassForSize(block_size);
+    memory = TakePooledSliceBlock(size_class);
+    slice.refcount =
+        new (memory) grpc_slice_refcount(kPooledSliceDestroyers[size_class]);
+  } else {
+    memory = new uint8_t[block_size];
+    slice.refcount = new (memory) grpc_slice_refcount(
+        [](grpc_slice_refcount* p) { delete[] reinterpret_cast<uint8_t*>(p); });
+  }
   slice.data.refcounted.bytes = memory + sizeof(grpc_slice_refcount);
   slice.data.refcounted.length = length;
   return slice;
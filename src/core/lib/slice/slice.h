@@ -50,6 +50,11 @@
 // implementation might warrant changes to the public EventEngine Slice
 // type as well.
 
+// The inlined length is stored in a uint8_t, so builds overriding
+// GRPC_SLICE_INLINE_EXTRA_SIZE must keep the inline capacity representable.
+static_assert(GRPC_SLICE_INLINED_SIZE <= UINT8_MAX,
+              "grpc_slice inline storage must fit in a uint8_t length");
+
 namespace grpc_core {
 
 inline const grpc_slice& CSliceRef(const grpc_slice& slice,
@@ -527,3 +527,40 @@ void grpc_slice_buffer_undo_take_first(grpc_slice_buffer* sb,
   sb->count++;
   sb->length += GRPC_SLICE_LENGTH(slice);
 }
+
+void grpc_slice_buffer_coalesce(grpc_slice_buffer* sb,
+                                size_t min_contiguous_bytes) {
+  if (min_contiguous_bytes == 0 || sb->count < 2) return;
+  size_t write = 0;
+  size_t read = 0;
+  while (read < sb->count) {
+    // Find the extent of the run of small slices starting at `read`.
+    size_t run_end = read;
+    size_t run_bytes = 0;
+    while (run_end < sb->count &&
+           GRPC_SLICE_LENGTH(sb->slices[run_end]) < min_contiguous_bytes) {
+      run_bytes += GRPC_SLICE_LENGTH(sb->slices[run_end]);
+      ++run_end;
+    }
+    if (run_end - read >= 2) {
+      // Merge the run into one contiguous slice. The copies are short and
+      // bounded, so memcpy compiles down to wide vector moves.
+      grpc_slice merged = GRPC_SLICE_MALLOC(run_bytes);
+      uint8_t* dst = GRPC_SLICE_START_PTR(merged);
+      for (size_t i = read; i < run_end; ++i) {
+        const size_t len = GRPC_SLICE_LENGTH(sb->slices[i]);
+        memcpy(dst, GRPC_SLICE_START_PTR(sb->slices[i]), len);
+        dst += len;
+        grpc_core::CSliceUnref(sb->slices[i]);
+      }
+      sb->slices[write++] = merged;
+      read = run_end;
+    } else {
+      // A lone small slice or a large slice: keep it as-is.
+      if (run_end == read) ++run_end;
+      while (read < run_end) sb->slices[write++] = sb->slices[read++];
+    }
+  }
+  // Total byte length is unchanged; only the slice count shrinks.
+  sb->count = write;
+}
@@ -36,6 +36,13 @@ void grpc_slice_buffer_move_first_no_inline(grpc_slice_buffer* src, size_t n,
 void grpc_slice_buffer_trim_end_no_inline(grpc_slice_buffer* sb, size_t n,
                                           grpc_slice_buffer* garbage);
 
+// Merge each run of two or more adjacent slices that are all shorter than
+// min_contiguous_bytes into a single contiguous slice, so that consumers
+// which parse across slice boundaries see fewer, larger slices. Byte content
+// and total length are unchanged. A no-op when min_contiguous_bytes is 0.
+void grpc_slice_buffer_coalesce(grpc_slice_buffer* sb,
+                                size_t min_contiguous_bytes);
+
 namespace grpc_core {
 
 /// A slice buffer holds the memory for a collection of slices.
@@ -89,6 +96,12 @@ class SliceBuffer {
   /// Returns the number of slices held by the SliceBuffer.
   size_t Count() const { return slice_buffer_.count; }
 
+  /// Merge each run of adjacent slices shorter than min_contiguous_bytes
+  /// into a single contiguous slice. Contents are unchanged.
+  void Coalesce(size_t min_contiguous_bytes) {
+    grpc_slice_buffer_coalesce(&slice_buffer_, min_contiguous_bytes);
+  }
+
   /// Copy the entire contents to a memory buffer.
   void CopyToBuffer(uint8_t* dst) {
     grpc_slice_buffer_copy_first_into_buffer(&slice_buffer_,
@@ -29,6 +29,7 @@
 #include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/transport/connectivity_state.h"
 #include "src/core/telemetry/stats.h"
 #include "src/core/telemetry/stats_data.h"
 
@@ -172,6 +173,47 @@ void grpc_channel_reset_connect_backoff(grpc_channel* channel) {
   grpc_core::Channel::FromC(channel)->ResetConnectionBackoff();
 }
 
+namespace {
+// Keeps a channel's connections warm: whenever the channel reports IDLE,
+// kicks off connection establishment again. Registered for the lifetime of
+// the channel; the connectivity state tracker orphans it at shutdown.
+class WarmConnectionsWatcher final
+    : public grpc_core::AsyncConnectivityStateWatcherInterface {
+ public:
+  explicit WarmConnectionsWatcher(
+      grpc_core::WeakRefCountedPtr<grpc_core::Channel> channel)
+      : channel_(std::move(channel)) {}
+
+ private:
+  void OnConnectivityStateChange(grpc_connectivity_state new_state,
+                                 const absl::Status& /*status*/) override {
+    if (new_state != GRPC_CHANNEL_IDLE) return;
+    // If the channel is already draining its last strong ref, let it die
+    // rather than pinning it with another connection attempt.
+    auto channel =
+        channel_->RefIfNonZero().TakeAsSubclass<grpc_core::Channel>();
+    if (channel == nullptr) return;
+    channel->CheckConnectivityState(/*try_to_connect=*/true);
+  }
+
+  grpc_core::WeakRefCountedPtr<grpc_core::Channel> channel_;
+};
+}  // namespace
+
+void grpc_channel_warm_connections(grpc_channel* channel) {
+  grpc_core::ExecCtx exec_ctx;
+  GRPC_TRACE_LOG(api, INFO)
+      << "grpc_channel_warm_connections(channel=" << channel << ")";
+  grpc_core::Channel* c = grpc_core::Channel::FromC(channel);
+  if (!c->SupportsConnectivityWatcher()) return;
+  // Register with READY as the last-observed state so that a channel that is
+  // currently IDLE gets an immediate notification (and hence an immediate
+  // connection attempt).
+  c->AddConnectivityWatcher(GRPC_CHANNEL_READY,
+                            grpc_core::MakeOrphanable<WarmConnectionsWatcher>(
+                                c->WeakRefAsSubclass<grpc_core::Channel>()));
+}
+
 int grpc_channel_support_connectivity_watcher(grpc_channel* channel) {
   return grpc_core::Channel::FromC(channel)->SupportsConnectivityWatcher();
 }
@@ -156,7 +156,6 @@ grpc_channel* CreateChannelFromEndpoint(
   // debuggability.
   grpc_resolved_address address =
       CreateGRPCResolvedAddress(endpoint->GetPeerAddress());
-  auto response_generator = MakeRefCounted<FakeResolverResponseGenerator>();
   ChannelArgs channel_args =
       CoreConfiguration::Get()
           .channel_args_preconditioning()
@@ -167,13 +166,18 @@ grpc_channel* CreateChannelFromEndpoint(
     channel_args = channel_args.SetIfUnset(
         GRPC_ARG_DEFAULT_AUTHORITY, URI::PercentEncodeAuthority(*address_str));
   }
-  Resolver::Result result;
-  result.args = channel_args;
-  result.addresses = EndpointAddressesList({EndpointAddresses{address, {}}});
-  response_generator->SetResponseAsync(std::move(result));
-  auto r = CreateClientEndpointChannel(
-      "fake:created-from-endpoint", creds,
-      channel_args.SetObject(std::move(response_generator)));
+  // In direct-channel mode, the transport will consume the endpoint
+  // directly, so there's no need to set up a resolver.
+  if (!channel_args.GetBool(GRPC_ARG_DIRECT_CHANNEL).value_or(false)) {
+    auto response_generator = MakeRefCounted<FakeResolverResponseGenerator>();
+    Resolver::Result result;
+    result.args = channel_args;
+    result.addresses = EndpointAddressesList({EndpointAddresses{address, {}}});
+    response_generator->SetResponseAsync(std::move(result));
+    channel_args = channel_args.SetObject(std::move(response_generator));
+  }
+  auto r = CreateClientEndpointChannel("fake:created-from-endpoint", creds,
+                                       channel_args);
   if (!r.ok()) {
     return grpc_lame_client_channel_create(
         "fake:created-from-endpoint",
@@ -28,6 +28,14 @@
 
 #define GRPC_ARG_USE_V3_STACK "grpc.internal.use_v3_stack"
 
+// When set (in conjunction with a pre-connected endpoint passed via
+// CreateChannelFromEndpoint()), the channel is bound directly to a
+// transport created over that endpoint: no resolver or LB policy is
+// instantiated.  The channel cannot reconnect if the connection is
+// lost, and only insecure credentials are supported, since no connect
+// handshake runs in this mode.
+#define GRPC_ARG_DIRECT_CHANNEL "grpc.internal.direct_channel"
+
 namespace grpc_core {
 
 class Transport;
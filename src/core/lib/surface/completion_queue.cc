@@ -907,6 +907,13 @@ static void cq_end_op_for_callback(
   }
 
   auto* functor = static_cast<grpc_completion_queue_functor*>(tag);
+  // Inlineable functors are guaranteed non-blocking by whoever set the flag,
+  // so run them directly instead of paying a thread hop through the
+  // EventEngine.
+  if (functor->inlineable) {
+    (*functor->functor_run)(functor, error.ok());
+    return;
+  }
   cqd->event_engine->Run(
       [engine = cqd->event_engine, functor, ok = error.ok()]() {
         grpc_core::ExecCtx exec_ctx;
@@ -1153,6 +1160,35 @@ grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
   return cq->vtable->next(cq, deadline, reserved);
 }
 
+size_t grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                        grpc_event* events, size_t max_events,
+                                        gpr_timespec deadline, void* reserved) {
+  if (max_events == 0) return 0;
+  CHECK(cq->vtable->cq_completion_type == GRPC_CQ_NEXT);
+  // Block for the first event as usual.
+  events[0] = cq->vtable->next(cq, deadline, reserved);
+  size_t count = 1;
+  if (events[0].type != GRPC_OP_COMPLETE) return count;
+  // Opportunistically drain completions that are already queued, so
+  // callers processing a burst pay the queue synchronization once per
+  // batch instead of once per event.
+  cq_next_data* cqd = static_cast<cq_next_data*> DATA_FROM_CQ(cq);
+  GRPC_CQ_INTERNAL_REF(cq, "next_batch");
+  grpc_core::ExecCtx exec_ctx;
+  while (count < max_events) {
+    grpc_cq_completion* c = cqd->queue.Pop();
+    if (c == nullptr) break;
+    grpc_event* ev = &events[count++];
+    ev->type = GRPC_OP_COMPLETE;
+    ev->success = c->next & 1u;
+    ev->tag = c->tag;
+    c->done(c->done_arg, c);
+    GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, ev);
+  }
+  GRPC_CQ_INTERNAL_UNREF(cq, "next_batch");
+  return count;
+}
+
 static int add_plucker(grpc_completion_queue* cq, void* tag,
                        grpc_pollset_worker** worker) {
   cq_pluck_data* cqd = static_cast<cq_pluck_data*> DATA_FROM_CQ(cq);
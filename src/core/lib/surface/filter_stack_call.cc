@@ -109,7 +109,14 @@ grpc_error_handle FilterStackCall::Create(grpc_call_create_args* args,
   RefCountedPtr<Arena> arena = channel->call_arena_allocator()->MakeArena();
   arena->SetContext<grpc_event_engine::experimental::EventEngine>(
       args->channel->event_engine());
-  call = new (arena->Alloc(call_alloc_size)) FilterStackCall(arena, *args);
+  {
+    // The one big allocation covers the call object plus every filter's
+    // per-call data; attribute it to the filter stack for the memory
+    // breakdown harness.
+    ArenaAllocAccounting::Scope accounting(
+        ArenaAllocAccounting::Consumer::kFilters);
+    call = new (arena->Alloc(call_alloc_size)) FilterStackCall(arena, *args);
+  }
   DCHECK(FromC(call->c_ptr()) == call);
   DCHECK(FromCallStack(call->call_stack()) == call);
   *out_call = call->c_ptr();
@@ -137,6 +144,8 @@ grpc_error_handle FilterStackCall::Create(grpc_call_create_args* args,
     }
     // Client call tracers should be created after propagating relevant
     // properties (tracing included) from the parent.
+    ArenaAllocAccounting::Scope accounting(
+        ArenaAllocAccounting::Consumer::kTracers);
     (*channel_stack->stats_plugin_group)
         ->AddClientCallTracers(Slice(CSliceRef(path)), args->registered_method,
                                arena.get());
@@ -144,6 +153,8 @@ grpc_error_handle FilterStackCall::Create(grpc_call_create_args* args,
     global_stats().IncrementServerCallsCreated();
     call->final_op_.server.cancelled = nullptr;
     call->final_op_.server.core_server = args->server;
+    ArenaAllocAccounting::Scope accounting(
+        ArenaAllocAccounting::Consumer::kTracers);
     // TODO(yashykt): In the future, we want to also enable stats and trace
     // collecting from when the call is created at the transport. The idea is
     // that the transport would create the call tracer and pass it in as part of
@@ -152,7 +163,9 @@ grpc_error_handle FilterStackCall::Create(grpc_call_create_args* args,
     // set server call tracer. We need to refactor them to stats plugins
     // (including removing the client channel filters).
     if (args->server != nullptr &&
-        args->server->server_call_tracer_factory() != nullptr) {
+        args->server->server_call_tracer_factory() != nullptr &&
+        ServerCallTracerFactory::ShouldSampleCall(
+            args->server->call_tracer_sample_rate())) {
       auto* server_call_tracer =
           args->server->server_call_tracer_factory()->CreateNewServerCallTracer(
               arena.get(), args->server->channel_args());
@@ -174,8 +187,12 @@ grpc_error_handle FilterStackCall::Create(grpc_call_create_args* args,
       call->call_stack(), args->server_transport_data,
       call->start_time(), call->send_deadline(),
       call->arena(),      &call->call_combiner_};
-  add_init_error(&error, grpc_call_stack_init(channel_stack, 1, DestroyCall,
-                                              call, &call_args));
+  {
+    ArenaAllocAccounting::Scope accounting(
+        ArenaAllocAccounting::Consumer::kFilters);
+    add_init_error(&error, grpc_call_stack_init(channel_stack, 1, DestroyCall,
+                                                call, &call_args));
+  }
   // Publish this call to parent only after the call stack has been initialized.
   if (parent != nullptr) {
     call->PublishToParent(parent);
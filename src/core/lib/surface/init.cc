@@ -40,11 +40,13 @@
 #include "src/core/lib/experiments/config.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/iomgr.h"
 #include "src/core/lib/iomgr/timer_manager.h"
 #include "src/core/lib/security/authorization/grpc_server_authz_filter.h"
 #include "src/core/lib/surface/channel_stack_type.h"
 #include "src/core/lib/surface/init_internally.h"
+#include "src/core/service_config/service_config_impl.h"
 #include "src/core/util/fork.h"
 #include "src/core/util/sync.h"
 #include "src/core/util/thd.h"
@@ -146,6 +148,8 @@ void grpc_shutdown_internal_locked(void)
     }
     grpc_iomgr_shutdown();
   }
+  grpc_core::ServiceConfigImpl::ShutdownParseCache();
+  grpc_core::ChannelArgs::ShutdownInternTable();
   g_shutting_down = false;
   g_shutting_down_cv->SignalAll();
 }
@@ -20,6 +20,8 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <utility>
+
 #include "absl/log/log.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/error.h"
@@ -50,13 +52,14 @@ const char* ConnectivityStateName(grpc_connectivity_state state) {
 //
 
 // A fire-and-forget class to asynchronously deliver a connectivity
-// state notification to a watcher.
+// state notification to a watcher.  The state itself is not captured
+// here; it is read from the watcher's pending slot at delivery time, so
+// that transitions that occur before delivery are coalesced.
 class AsyncConnectivityStateWatcherInterface::Notifier {
  public:
   Notifier(RefCountedPtr<AsyncConnectivityStateWatcherInterface> watcher,
-           grpc_connectivity_state state, const absl::Status& status,
            const std::shared_ptr<WorkSerializer>& work_serializer)
-      : watcher_(std::move(watcher)), state_(state), status_(status) {
+      : watcher_(std::move(watcher)) {
     if (work_serializer != nullptr) {
       work_serializer->Run(
           [this]() { SendNotification(this, absl::OkStatus()); });
@@ -70,26 +73,48 @@ class AsyncConnectivityStateWatcherInterface::Notifier {
  private:
   static void SendNotification(void* arg, grpc_error_handle /*ignored*/) {
     Notifier* self = static_cast<Notifier*>(arg);
-    GRPC_TRACE_LOG(connectivity_state, INFO)
-        << "watcher " << self->watcher_.get()
-        << ": delivering async notification for "
-        << ConnectivityStateName(self->state_) << " ("
-        << self->status_.ToString() << ")";
-    self->watcher_->OnConnectivityStateChange(self->state_, self->status_);
+    self->watcher_->FlushNotification();
     delete self;
   }
 
   RefCountedPtr<AsyncConnectivityStateWatcherInterface> watcher_;
-  const grpc_connectivity_state state_;
-  const absl::Status status_;
   grpc_closure closure_;
 };
 
 void AsyncConnectivityStateWatcherInterface::Notify(
     grpc_connectivity_state state, const absl::Status& status) {
+  {
+    MutexLock lock(&mu_);
+    pending_state_ = state;
+    pending_status_ = status;
+    // If a notification is already scheduled but not yet delivered, it
+    // will pick up the state we just pended; don't schedule another.
+    if (notification_scheduled_) {
+      GRPC_TRACE_LOG(connectivity_state, INFO)
+          << "watcher " << this << ": coalescing notification for "
+          << ConnectivityStateName(state) << " into pending notification";
+      return;
+    }
+    notification_scheduled_ = true;
+  }
   // Deletes itself when done.
-  new Notifier(RefAsSubclass<AsyncConnectivityStateWatcherInterface>(), state,
-               status, work_serializer_);
+  new Notifier(RefAsSubclass<AsyncConnectivityStateWatcherInterface>(),
+               work_serializer_);
+}
+
+void AsyncConnectivityStateWatcherInterface::FlushNotification() {
+  grpc_connectivity_state state;
+  absl::Status status;
+  {
+    MutexLock lock(&mu_);
+    state = pending_state_;
+    status = std::move(pending_status_);
+    notification_scheduled_ = false;
+  }
+  GRPC_TRACE_LOG(connectivity_state, INFO)
+      << "watcher " << this << ": delivering async notification for "
+      << ConnectivityStateName(state) << " (" << status.ToString() << ")";
+  OnConnectivityStateChange(state, status);
 }
 
 //
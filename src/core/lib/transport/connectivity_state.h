@@ -27,10 +27,12 @@
 #include <memory>
 #include <utility>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/status/status.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/util/orphanable.h"
+#include "src/core/util/sync.h"
 #include "src/core/util/work_serializer.h"
 
 namespace grpc_core {
@@ -58,6 +60,13 @@ class ConnectivityStateWatcherInterface
 // An alternative watcher interface that performs notifications via an
 // asynchronous callback scheduled on the ExecCtx.
 // Subclasses must implement the OnConnectivityStateChange() method.
+//
+// Rapid-fire transitions are coalesced: if Notify() is called again
+// before a previously scheduled notification has been delivered, the
+// pending notification is updated in place, and the watcher sees a
+// single OnConnectivityStateChange() call with the most recent state.
+// This avoids notification storms when a transport flaps through
+// several states before the work serializer (or ExecCtx) drains.
 class AsyncConnectivityStateWatcherInterface
     : public ConnectivityStateWatcherInterface {
  public:
@@ -82,7 +91,16 @@ class AsyncConnectivityStateWatcherInterface
                                          const absl::Status& status) = 0;
 
  private:
+  // Delivers the most recently pended state to
+  // OnConnectivityStateChange().  Invoked by Notifier.
+  void FlushNotification();
+
   std::shared_ptr<WorkSerializer> work_serializer_;
+  Mutex mu_;
+  bool notification_scheduled_ ABSL_GUARDED_BY(mu_) = false;
+  grpc_connectivity_state pending_state_ ABSL_GUARDED_BY(mu_) =
+      GRPC_CHANNEL_IDLE;
+  absl::Status pending_status_ ABSL_GUARDED_BY(mu_);
 };
 
 // Tracks connectivity state.  Maintains a list of watchers that are
@@ -21,6 +21,8 @@
 #include <grpc/support/port_platform.h>
 #include <stdlib.h>
 
+#include <algorithm>
+#include <map>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -89,6 +91,7 @@ class EndpointList::Endpoint::Helper final
 absl::Status EndpointList::Endpoint::Init(
     const EndpointAddresses& addresses, const ChannelArgs& args,
     std::shared_ptr<WorkSerializer> work_serializer) {
+  addresses_ = addresses;
   ChannelArgs child_args =
       args.Set(GRPC_ARG_INTERNAL_PICK_FIRST_ENABLE_HEALTH_CHECKING, true)
           .Set(GRPC_ARG_INTERNAL_PICK_FIRST_OMIT_STATUS_MESSAGE_PREFIX, true);
@@ -163,15 +166,80 @@ RefCountedPtr<SubchannelInterface> EndpointList::Endpoint::CreateSubchannel(
 
 void EndpointList::Init(
     EndpointAddressesIterator* endpoints, const ChannelArgs& args,
+    EndpointList* replaced_list, bool replaced_list_is_live,
     absl::FunctionRef<OrphanablePtr<Endpoint>(RefCountedPtr<EndpointList>,
                                               const EndpointAddresses&,
                                               const ChannelArgs&)>
         create_endpoint) {
+  args_ = args;
   if (endpoints == nullptr) return;
+  // Index the donor list's endpoints by address, so that endpoints that
+  // have not changed can keep their child policies instead of being
+  // rebuilt.  Reuse requires identical channel args, since the existing
+  // child policies were configured with the donor's args.
+  std::map<EndpointAddresses, size_t> reusable;
+  if (replaced_list != nullptr && replaced_list->args_ == args) {
+    for (size_t i = 0; i < replaced_list->endpoints_.size(); ++i) {
+      reusable.emplace(*replaced_list->endpoints_[i]->addresses_, i);
+    }
+  }
+  // First pass: decide whether reuse is allowed.  A live donor is still
+  // being used for picks, so take endpoints from it only in shapes that
+  // cannot leave it serving a subset: either nothing new needs to be
+  // created, or the donor is drained entirely.
+  if (!reusable.empty() && replaced_list_is_live) {
+    auto unmatched = reusable;
+    size_t num_created = 0;
+    endpoints->ForEach([&](const EndpointAddresses& endpoint) {
+      if (unmatched.erase(endpoint) == 0) ++num_created;
+    });
+    if (num_created > 0 && !unmatched.empty()) reusable.clear();
+  }
+  // Second pass: build the list, taking over reusable endpoints.
+  bool reused_any = false;
   endpoints->ForEach([&](const EndpointAddresses& endpoint) {
-    endpoints_.push_back(
-        create_endpoint(Ref(DEBUG_LOCATION, "Endpoint"), endpoint, args));
+    auto it = reusable.find(endpoint);
+    if (it == reusable.end()) {
+      endpoints_.push_back(
+          create_endpoint(Ref(DEBUG_LOCATION, "Endpoint"), endpoint, args));
+      return;
+    }
+    OrphanablePtr<Endpoint> reused =
+        std::move(replaced_list->endpoints_[it->second]);
+    reusable.erase(it);
+    reused_any = true;
+    if (GPR_UNLIKELY(tracer_ != nullptr)) {
+      LOG(INFO) << "[" << tracer_ << " " << policy_.get() << "] endpoint "
+                << reused.get() << ": reusing child policy "
+                << reused->child_policy_.get() << " from list "
+                << replaced_list;
+    }
+    auto state = reused->connectivity_state_;
+    if (state.has_value()) {
+      CHECK_GT(replaced_list->num_endpoints_seen_initial_state_, 0u);
+      --replaced_list->num_endpoints_seen_initial_state_;
+    }
+    replaced_list->OnEndpointMigratedLocked(reused.get());
+    reused->endpoint_list_.reset(DEBUG_LOCATION, "Endpoint");
+    reused->endpoint_list_ = Ref(DEBUG_LOCATION, "Endpoint");
+    endpoints_.push_back(std::move(reused));
+    if (state.has_value()) {
+      // Replay the child's current state into this list's aggregation,
+      // as if the child had just reported it.
+      ++num_endpoints_seen_initial_state_;
+      endpoints_.back()->OnStateUpdate(std::nullopt, *state, absl::OkStatus());
+    }
   });
+  // Remove the holes left in the donor list by the endpoints we took.
+  if (reused_any) {
+    replaced_list->endpoints_.erase(
+        std::remove_if(replaced_list->endpoints_.begin(),
+                       replaced_list->endpoints_.end(),
+                       [](const OrphanablePtr<Endpoint>& endpoint) {
+                         return endpoint == nullptr;
+                       }),
+        replaced_list->endpoints_.end());
+  }
 }
 
 void EndpointList::ResetBackoffLocked() {
@@ -150,6 +150,9 @@ class EndpointList : public InternallyRefCounted<EndpointList> {
    private:
     class Helper;
 
+    // EndpointList moves endpoints between lists when reusing them.
+    friend class EndpointList;
+
     // Called when the child policy reports a connectivity state update.
     virtual void OnStateUpdate(std::optional<grpc_connectivity_state> old_state,
                                grpc_connectivity_state new_state,
@@ -162,6 +165,9 @@ class EndpointList : public InternallyRefCounted<EndpointList> {
 
     RefCountedPtr<EndpointList> endpoint_list_;
 
+    // Set by Init().  Unset only before Init() is called.
+    std::optional<EndpointAddresses> addresses_;
+
     OrphanablePtr<LoadBalancingPolicy> child_policy_;
     std::optional<grpc_connectivity_state> connectivity_state_;
     RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker_;
@@ -195,6 +201,32 @@ class EndpointList : public InternallyRefCounted<EndpointList> {
         tracer_(tracer) {}
 
   void Init(EndpointAddressesIterator* endpoints, const ChannelArgs& args,
+            absl::FunctionRef<OrphanablePtr<Endpoint>(
+                RefCountedPtr<EndpointList>, const EndpointAddresses&,
+                const ChannelArgs&)>
+                create_endpoint) {
+    Init(endpoints, args, /*replaced_list=*/nullptr,
+         /*replaced_list_is_live=*/false, create_endpoint);
+  }
+
+  // Like the above, but takes over endpoints from replaced_list instead
+  // of creating new ones wherever an endpoint's addresses and args are
+  // unchanged, so that an address list update does not rebuild the child
+  // policy (and thus re-establish connectivity state) for endpoints that
+  // did not change.  A reused endpoint retains its connectivity state,
+  // which is replayed into this list's aggregation via OnStateUpdate()
+  // with no old state; the donor list's accounting is adjusted via
+  // OnEndpointMigratedLocked().
+  //
+  // If replaced_list_is_live is true, replaced_list is still the list
+  // being used for picks, so reuse happens only in shapes that cannot
+  // disrupt it: either no new endpoints need to be created (the donor's
+  // last picker keeps working and this list can be swapped in at once)
+  // or every donor endpoint is reused (the drained donor will never
+  // report state again).  Mixed add-and-remove updates fall back to a
+  // full rebuild.
+  void Init(EndpointAddressesIterator* endpoints, const ChannelArgs& args,
+            EndpointList* replaced_list, bool replaced_list_is_live,
             absl::FunctionRef<OrphanablePtr<Endpoint>(
                 RefCountedPtr<EndpointList>, const EndpointAddresses&,
                 const ChannelArgs&)>
@@ -219,9 +251,16 @@ class EndpointList : public InternallyRefCounted<EndpointList> {
   virtual LoadBalancingPolicy::ChannelControlHelper* channel_control_helper()
       const = 0;
 
+  // Called when an endpoint is moved out of this list into a newer list
+  // that is reusing it.  Subclasses that maintain per-state counters
+  // must deduct the endpoint's last reported state here; the endpoint
+  // reports all subsequent state changes to the list that took it over.
+  virtual void OnEndpointMigratedLocked(Endpoint* /*endpoint*/) {}
+
   RefCountedPtr<LoadBalancingPolicy> policy_;
   std::string resolution_note_;
   const char* tracer_;
+  ChannelArgs args_;
   std::vector<OrphanablePtr<Endpoint>> endpoints_;
   size_t num_endpoints_seen_initial_state_ = 0;
 };
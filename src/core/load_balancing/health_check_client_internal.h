@@ -50,6 +50,15 @@ class HealthWatcher;
 // health watch call for each health check service name that is being
 // watched and reports the resulting connectivity state to all
 // registered watchers.
+//
+// Streams are thus deduplicated at two levels: all watchers of a given
+// service name on a subchannel share one stream (via HealthChecker), and
+// channels with matching subchannel keys share the subchannel itself via
+// the global subchannel pool.  Deduplication deliberately stops at the
+// subchannel boundary: the watch stream runs on this subchannel's own
+// connection, so it also serves as a probe of that connection, and
+// sharing a stream across subchannels to the same address would report
+// one connection's health for another.
 class HealthProducer final : public Subchannel::DataProducerInterface {
  public:
   HealthProducer() : interested_parties_(grpc_pollset_set_create()) {}
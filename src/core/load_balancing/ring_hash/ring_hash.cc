@@ -171,17 +171,31 @@ class RingHash final : public LoadBalancingPolicy {
   // A ring computed based on a config and address list.
   class Ring final : public RefCounted<Ring> {
    public:
-    struct RingEntry {
-      uint64_t hash;
-      size_t endpoint_index;  // Index into RingHash::endpoints_.
-    };
-
     Ring(RingHash* ring_hash, RingHashLbConfig* config);
 
-    const std::vector<RingEntry>& ring() const { return ring_; }
+    // The sorted ring hashes, stored separately from the endpoint indices
+    // so that the pick-time binary search walks a dense array of hashes;
+    // the endpoint index for a position is looked up only once the
+    // position is found.
+    const std::vector<uint64_t>& hashes() const { return hashes_; }
+    // Indices into RingHash::endpoints_, parallel to hashes().
+    const std::vector<size_t>& endpoint_indices() const {
+      return endpoint_indices_;
+    }
+
+    // Returns true if a ring built from ring_hash and config would have
+    // the same size parameters as this one.  The endpoint list (which
+    // also determines the ring's contents) must be compared separately
+    // by the caller.
+    bool MatchesConfig(RingHash* ring_hash, RingHashLbConfig* config) const;
 
    private:
-    std::vector<RingEntry> ring_;
+    std::vector<uint64_t> hashes_;
+    std::vector<size_t> endpoint_indices_;
+    // The size parameters the ring was built from, for MatchesConfig().
+    size_t min_ring_size_;
+    size_t max_ring_size_;
+    size_t ring_size_cap_;
   };
 
   // State for a particular endpoint.  Delegates to a pick_first child policy.
@@ -358,18 +372,19 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
   // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
   // (ketama_get_server) NOTE: The algorithm depends on using signed integers
   // for lowp, highp, and index. Do not change them!
-  const auto& ring = ring_->ring();
+  const std::vector<uint64_t>& hashes = ring_->hashes();
+  const std::vector<size_t>& endpoint_indices = ring_->endpoint_indices();
   int64_t lowp = 0;
-  int64_t highp = ring.size();
+  int64_t highp = hashes.size();
   int64_t index = 0;
   while (true) {
     index = (lowp + highp) / 2;
-    if (index == static_cast<int64_t>(ring.size())) {
+    if (index == static_cast<int64_t>(hashes.size())) {
       index = 0;
       break;
     }
-    uint64_t midval = ring[index].hash;
-    uint64_t midval1 = index == 0 ? 0 : ring[index - 1].hash;
+    uint64_t midval = hashes[index];
+    uint64_t midval1 = index == 0 ? 0 : hashes[index - 1];
     if (request_hash <= midval && request_hash > midval1) {
       break;
     }
@@ -385,9 +400,9 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
   }
   // Find the first endpoint we can use from the selected index.
   if (!using_random_hash) {
-    for (size_t i = 0; i < ring.size(); ++i) {
-      const auto& entry = ring[(index + i) % ring.size()];
-      const auto& endpoint_info = endpoints_[entry.endpoint_index];
+    for (size_t i = 0; i < hashes.size(); ++i) {
+      const auto& endpoint_info =
+          endpoints_[endpoint_indices[(index + i) % hashes.size()]];
       switch (endpoint_info.state) {
         case GRPC_CHANNEL_READY:
           return endpoint_info.picker->Pick(args);
@@ -406,9 +421,9 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
     // Using a random hash.  We will use the first READY endpoint we
     // find, triggering at most one endpoint to attempt connecting.
     bool requested_connection = has_endpoint_in_connecting_state_;
-    for (size_t i = 0; i < ring.size(); ++i) {
-      const auto& entry = ring[(index + i) % ring.size()];
-      const auto& endpoint_info = endpoints_[entry.endpoint_index];
+    for (size_t i = 0; i < hashes.size(); ++i) {
+      const auto& endpoint_info =
+          endpoints_[endpoint_indices[(index + i) % hashes.size()]];
       if (endpoint_info.state == GRPC_CHANNEL_READY) {
         return endpoint_info.picker->Pick(args);
       }
@@ -423,7 +438,7 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
   }
   std::string message = absl::StrCat(
       "ring hash cannot find a connected endpoint; first failure: ",
-      endpoints_[ring[index].endpoint_index].status.message());
+      endpoints_[endpoint_indices[index]].status.message());
   if (!resolution_note_.empty()) {
     absl::StrAppend(&message, " (", resolution_note_, ")");
   }
@@ -487,6 +502,9 @@ RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config) {
   const size_t ring_size_cap =
       ring_hash->args_.GetInt(GRPC_ARG_RING_HASH_LB_RING_SIZE_CAP)
           .value_or(kRingSizeCapDefault);
+  min_ring_size_ = config->min_ring_size();
+  max_ring_size_ = config->max_ring_size();
+  ring_size_cap_ = ring_size_cap;
   const size_t min_ring_size = std::min(config->min_ring_size(), ring_size_cap);
   const size_t max_ring_size = std::min(config->max_ring_size(), ring_size_cap);
   const double scale = std::min(
@@ -494,7 +512,12 @@ RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config) {
       static_cast<double>(max_ring_size));
   // Reserve memory for the entire ring up front.
   const uint64_t ring_size = std::ceil(scale);
-  ring_.reserve(ring_size);
+  struct RingEntry {
+    uint64_t hash;
+    size_t endpoint_index;  // Index into RingHash::endpoints_.
+  };
+  std::vector<RingEntry> ring;
+  ring.reserve(ring_size);
   // Populate the hash ring by walking through the (host, weight) pairs in
   // normalized_host_weights, and generating (scale * weight) hashes for each
   // host. Since these aren't necessarily whole numbers, we maintain running
@@ -518,7 +541,7 @@ RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config) {
       absl::string_view hash_key(hash_key_buffer.data(),
                                  hash_key_buffer.size());
       const uint64_t hash = XXH64(hash_key.data(), hash_key.size(), 0);
-      ring_.push_back({hash, i});
+      ring.push_back({hash, i});
       ++count;
       ++current_hashes;
       hash_key_buffer.erase(offset_start, hash_key_buffer.end());
@@ -528,10 +551,25 @@ RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config) {
     max_hashes_per_host =
         std::max(static_cast<uint64_t>(i), max_hashes_per_host);
   }
-  std::sort(ring_.begin(), ring_.end(),
+  std::sort(ring.begin(), ring.end(),
             [](const RingEntry& lhs, const RingEntry& rhs) -> bool {
               return lhs.hash < rhs.hash;
             });
+  // Split the sorted entries into parallel arrays.
+  hashes_.reserve(ring.size());
+  endpoint_indices_.reserve(ring.size());
+  for (const RingEntry& entry : ring) {
+    hashes_.push_back(entry.hash);
+    endpoint_indices_.push_back(entry.endpoint_index);
+  }
+}
+
+bool RingHash::Ring::MatchesConfig(RingHash* ring_hash,
+                                   RingHashLbConfig* config) const {
+  return config->min_ring_size() == min_ring_size_ &&
+         config->max_ring_size() == max_ring_size_ &&
+         ring_hash->args_.GetInt(GRPC_ARG_RING_HASH_LB_RING_SIZE_CAP)
+                 .value_or(kRingSizeCapDefault) == ring_size_cap_;
 }
 
 //
@@ -692,9 +730,11 @@ void RingHash::ResetBackoffLocked() {
 
 absl::Status RingHash::UpdateLocked(UpdateArgs args) {
   // Check address list.
+  EndpointAddressesList old_endpoints;
   if (args.addresses.ok()) {
     GRPC_TRACE_LOG(ring_hash_lb, INFO) << "[RH " << this << "] received update";
     // De-dup endpoints, taking weight into account.
+    old_endpoints = std::move(endpoints_);
     endpoints_.clear();
     std::map<EndpointAddressSet, size_t> endpoint_indices;
     (*args.addresses)->ForEach([&](const EndpointAddresses& endpoint) {
@@ -732,8 +772,14 @@ absl::Status RingHash::UpdateLocked(UpdateArgs args) {
   // Save config.
   auto* config = DownCast<RingHashLbConfig*>(args.config.get());
   request_hash_header_ = RefCountedStringValue(config->request_hash_header());
-  // Build new ring.
-  ring_ = MakeRefCounted<Ring>(this, config);
+  // Build new ring, unless neither the endpoint list nor the ring size
+  // parameters changed, in which case the existing ring is still valid.
+  // Endpoint comparison includes each endpoint's channel args, which
+  // covers its weight and hash key.
+  if (ring_ == nullptr || old_endpoints != endpoints_ ||
+      !ring_->MatchesConfig(this, config)) {
+    ring_ = MakeRefCounted<Ring>(this, config);
+  }
   // Update endpoint map.
   std::map<EndpointAddressSet, OrphanablePtr<RingHashEndpoint>> endpoint_map;
   std::vector<std::string> errors;
@@ -71,12 +71,20 @@ class RoundRobin final : public LoadBalancingPolicy {
     RoundRobinEndpointList(RefCountedPtr<RoundRobin> round_robin,
                            EndpointAddressesIterator* endpoints,
                            const ChannelArgs& args, std::string resolution_note,
+                           RoundRobinEndpointList* replaced_list,
+                           bool replaced_list_is_live,
                            std::vector<std::string>* errors)
         : EndpointList(std::move(round_robin), std::move(resolution_note),
                        GRPC_TRACE_FLAG_ENABLED(round_robin)
                            ? "RoundRobinEndpointList"
                            : nullptr) {
-      Init(endpoints, args,
+      // Carry forward the last failure seen by the list being replaced,
+      // so that reused children that are in TRANSIENT_FAILURE still have
+      // a status to report.
+      if (replaced_list != nullptr) {
+        last_failure_ = replaced_list->last_failure_;
+      }
+      Init(endpoints, args, replaced_list, replaced_list_is_live,
            [&](RefCountedPtr<EndpointList> endpoint_list,
                const EndpointAddresses& addresses, const ChannelArgs& args) {
              return MakeOrphanable<RoundRobinEndpoint>(
@@ -85,6 +93,16 @@ class RoundRobin final : public LoadBalancingPolicy {
            });
     }
 
+    // Called after construction when children may have been reused from
+    // the previous list: reused children already have connectivity state
+    // and will not report again until that state changes, so the
+    // conditions for swapping this list into use may already hold.
+    void MaybeSwapInAfterReuseLocked() {
+      if (AllEndpointsSeenInitialState()) {
+        MaybeUpdateRoundRobinConnectivityStateLocked(absl::OkStatus());
+      }
+    }
+
    private:
     class RoundRobinEndpoint final : public Endpoint {
      public:
@@ -119,6 +137,10 @@ class RoundRobin final : public LoadBalancingPolicy {
         std::optional<grpc_connectivity_state> old_state,
         grpc_connectivity_state new_state);
 
+    // Deducts a child's last reported state from the counters when a
+    // newer list takes the child over.
+    void OnEndpointMigratedLocked(Endpoint* endpoint) override;
+
     // Ensures that the right child list is used and then updates
     // the RR policy's connectivity state based on the child list's
     // state counters.
@@ -245,10 +267,18 @@ absl::Status RoundRobin::UpdateLocked(UpdateArgs args) {
     LOG(INFO) << "[RR " << this << "] replacing previous pending child list "
               << latest_pending_endpoint_list_.get();
   }
+  // Reuse unchanged children from the list being replaced: the previous
+  // pending list if there is one, otherwise the current list.
+  RoundRobinEndpointList* replaced_list =
+      latest_pending_endpoint_list_ != nullptr
+          ? latest_pending_endpoint_list_.get()
+          : endpoint_list_.get();
+  const bool replaced_list_is_live = latest_pending_endpoint_list_ == nullptr;
   std::vector<std::string> errors;
   latest_pending_endpoint_list_ = MakeOrphanable<RoundRobinEndpointList>(
       RefAsSubclass<RoundRobin>(DEBUG_LOCATION, "RoundRobinEndpointList"),
-      addresses, args.args, std::move(args.resolution_note), &errors);
+      addresses, args.args, std::move(args.resolution_note), replaced_list,
+      replaced_list_is_live, &errors);
   // If the new list is empty, immediately promote it to
   // endpoint_list_ and report TRANSIENT_FAILURE.
   if (latest_pending_endpoint_list_->size() == 0) {
@@ -267,6 +297,8 @@ absl::Status RoundRobin::UpdateLocked(UpdateArgs args) {
   // endpoint_list_.
   if (endpoint_list_ == nullptr) {
     endpoint_list_ = std::move(latest_pending_endpoint_list_);
+  } else {
+    latest_pending_endpoint_list_->MaybeSwapInAfterReuseLocked();
   }
   if (!errors.empty()) {
     return absl::UnavailableError(absl::StrCat(
@@ -339,6 +371,24 @@ void RoundRobin::RoundRobinEndpointList::UpdateStateCountersLocked(
   }
 }
 
+void RoundRobin::RoundRobinEndpointList::OnEndpointMigratedLocked(
+    Endpoint* endpoint) {
+  auto state = endpoint->connectivity_state();
+  if (!state.has_value()) return;
+  // Deduct the state with no replacement; the endpoint reports all
+  // subsequent changes to the list that took it over.
+  if (*state == GRPC_CHANNEL_READY) {
+    CHECK_GT(num_ready_, 0u);
+    --num_ready_;
+  } else if (*state == GRPC_CHANNEL_CONNECTING || *state == GRPC_CHANNEL_IDLE) {
+    CHECK_GT(num_connecting_, 0u);
+    --num_connecting_;
+  } else if (*state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+    CHECK_GT(num_transient_failure_, 0u);
+    --num_transient_failure_;
+  }
+}
+
 void RoundRobin::RoundRobinEndpointList::
     MaybeUpdateRoundRobinConnectivityStateLocked(absl::Status status_for_tf) {
   auto* round_robin = policy<RoundRobin>();
@@ -278,12 +278,19 @@ class WeightedRoundRobin final : public LoadBalancingPolicy {
     WrrEndpointList(RefCountedPtr<WeightedRoundRobin> wrr,
                     EndpointAddressesIterator* endpoints,
                     const ChannelArgs& args, std::string resolution_note,
+                    WrrEndpointList* replaced_list, bool replaced_list_is_live,
                     std::vector<std::string>* errors)
         : EndpointList(std::move(wrr), std::move(resolution_note),
                        GRPC_TRACE_FLAG_ENABLED(weighted_round_robin_lb)
                            ? "WrrEndpointList"
                            : nullptr) {
-      Init(endpoints, args,
+      // Carry forward the last failure seen by the list being replaced,
+      // so that reused children that are in TRANSIENT_FAILURE still have
+      // a status to report.
+      if (replaced_list != nullptr) {
+        last_failure_ = replaced_list->last_failure_;
+      }
+      Init(endpoints, args, replaced_list, replaced_list_is_live,
            [&](RefCountedPtr<EndpointList> endpoint_list,
                const EndpointAddresses& addresses, const ChannelArgs& args) {
              return MakeOrphanable<WrrEndpoint>(
@@ -292,6 +299,16 @@ class WeightedRoundRobin final : public LoadBalancingPolicy {
            });
     }
 
+    // Called after construction when children may have been reused from
+    // the previous list: reused children already have connectivity state
+    // and will not report again until that state changes, so the
+    // conditions for swapping this list into use may already hold.
+    void MaybeSwapInAfterReuseLocked() {
+      if (AllEndpointsSeenInitialState()) {
+        MaybeUpdateAggregatedConnectivityStateLocked(absl::OkStatus());
+      }
+    }
+
    private:
     LoadBalancingPolicy::ChannelControlHelper* channel_control_helper()
         const override {
@@ -304,6 +321,10 @@ class WeightedRoundRobin final : public LoadBalancingPolicy {
         std::optional<grpc_connectivity_state> old_state,
         grpc_connectivity_state new_state);
 
+    // Deducts a child's last reported state from the counters when a
+    // newer list takes the child over.
+    void OnEndpointMigratedLocked(Endpoint* endpoint) override;
+
     // Ensures that the right child list is used and then updates
     // the WRR policy's connectivity state based on the child list's
     // state counters.
@@ -379,11 +400,12 @@ class WeightedRoundRobin final : public LoadBalancingPolicy {
     RefCountedPtr<WeightedRoundRobinConfig> config_;
     std::vector<EndpointInfo> endpoints_;
 
-    Mutex scheduler_mu_;
-    std::shared_ptr<StaticStrideScheduler> scheduler_
-        ABSL_GUARDED_BY(&scheduler_mu_);
+    // Accessed via the std::atomic_* free functions for shared_ptr, so
+    // that the pick path takes no locks; replaced wholesale by the
+    // weight update timer.
+    std::shared_ptr<StaticStrideScheduler> scheduler_;
 
-    Mutex timer_mu_ ABSL_ACQUIRED_BEFORE(&scheduler_mu_);
+    Mutex timer_mu_;
     std::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
         timer_handle_ ABSL_GUARDED_BY(&timer_mu_);
 
@@ -595,11 +617,8 @@ WeightedRoundRobin::PickResult WeightedRoundRobin::Picker::Pick(PickArgs args) {
 
 size_t WeightedRoundRobin::Picker::PickIndex() {
   // Grab a ref to the scheduler.
-  std::shared_ptr<StaticStrideScheduler> scheduler;
-  {
-    MutexLock lock(&scheduler_mu_);
-    scheduler = scheduler_;
-  }
+  std::shared_ptr<StaticStrideScheduler> scheduler =
+      std::atomic_load_explicit(&scheduler_, std::memory_order_acquire);
   // If we have a scheduler, use it to do a WRR pick.
   if (scheduler != nullptr) return scheduler->Pick();
   // We don't have a scheduler (i.e., either all of the weights are 0 or
@@ -650,10 +669,8 @@ void WeightedRoundRobin::Picker::BuildSchedulerAndStartTimerLocked() {
                              {wrr_->channel_control_helper()->GetTarget()},
                              {wrr_->locality_name_});
   }
-  {
-    MutexLock lock(&scheduler_mu_);
-    scheduler_ = std::move(scheduler);
-  }
+  std::atomic_store_explicit(&scheduler_, std::move(scheduler),
+                             std::memory_order_release);
   // Start timer.
   GRPC_TRACE_LOG(weighted_round_robin_lb, INFO)
       << "[WRR " << wrr_.get() << " picker " << this
@@ -763,10 +780,17 @@ absl::Status WeightedRoundRobin::UpdateLocked(UpdateArgs args) {
               << "] replacing previous pending endpoint list "
               << latest_pending_endpoint_list_.get();
   }
+  // Reuse unchanged children from the list being replaced: the previous
+  // pending list if there is one, otherwise the current list.
+  WrrEndpointList* replaced_list = latest_pending_endpoint_list_ != nullptr
+                                       ? latest_pending_endpoint_list_.get()
+                                       : endpoint_list_.get();
+  const bool replaced_list_is_live = latest_pending_endpoint_list_ == nullptr;
   std::vector<std::string> errors;
   latest_pending_endpoint_list_ = MakeOrphanable<WrrEndpointList>(
       RefAsSubclass<WeightedRoundRobin>(), addresses.get(), args.args,
-      std::move(args.resolution_note), &errors);
+      std::move(args.resolution_note), replaced_list, replaced_list_is_live,
+      &errors);
   // If the new list is empty, immediately promote it to
   // endpoint_list_ and report TRANSIENT_FAILURE.
   if (latest_pending_endpoint_list_->size() == 0) {
@@ -786,6 +810,8 @@ absl::Status WeightedRoundRobin::UpdateLocked(UpdateArgs args) {
   // endpoint_list_.
   if (endpoint_list_.get() == nullptr) {
     endpoint_list_ = std::move(latest_pending_endpoint_list_);
+  } else {
+    latest_pending_endpoint_list_->MaybeSwapInAfterReuseLocked();
   }
   if (!errors.empty()) {
     return absl::UnavailableError(absl::StrCat(
@@ -922,6 +948,24 @@ void WeightedRoundRobin::WrrEndpointList::UpdateStateCountersLocked(
   }
 }
 
+void WeightedRoundRobin::WrrEndpointList::OnEndpointMigratedLocked(
+    Endpoint* endpoint) {
+  auto state = endpoint->connectivity_state();
+  if (!state.has_value()) return;
+  // Deduct the state with no replacement; the endpoint reports all
+  // subsequent changes to the list that took it over.
+  if (*state == GRPC_CHANNEL_READY) {
+    CHECK_GT(num_ready_, 0u);
+    --num_ready_;
+  } else if (*state == GRPC_CHANNEL_CONNECTING || *state == GRPC_CHANNEL_IDLE) {
+    CHECK_GT(num_connecting_, 0u);
+    --num_connecting_;
+  } else if (*state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+    CHECK_GT(num_transient_failure_, 0u);
+    --num_transient_failure_;
+  }
+}
+
 void WeightedRoundRobin::WrrEndpointList::
     MaybeUpdateAggregatedConnectivityStateLocked(absl::Status status_for_tf) {
   auto* wrr = policy<WeightedRoundRobin>();
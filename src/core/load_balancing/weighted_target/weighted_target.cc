@@ -57,6 +57,7 @@
 #include "src/core/util/json/json.h"
 #include "src/core/util/json/json_args.h"
 #include "src/core/util/json/json_object_loader.h"
+#include "src/core/util/json/json_writer.h"
 #include "src/core/util/orphanable.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/shared_bit_gen.h"
@@ -85,6 +86,9 @@ class WeightedTargetLbConfig final : public LoadBalancingPolicy::Config {
   struct ChildConfig {
     uint32_t weight;
     RefCountedPtr<LoadBalancingPolicy::Config> config;
+    // Canonical form of the child policy config, used to detect
+    // children whose config did not change across config deliveries.
+    std::string config_fingerprint;
 
     static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
     void JsonPostLoad(const Json& json, const JsonArgs&,
@@ -220,6 +224,13 @@ class WeightedTargetLb final : public LoadBalancingPolicy {
     grpc_connectivity_state connectivity_state_ = GRPC_CHANNEL_CONNECTING;
 
     OrphanablePtr<DelayedRemovalTimer> delayed_removal_timer_;
+
+    // Inputs of the last update passed down to the child policy, used
+    // to skip updates that the child would see as identical.
+    std::string last_config_fingerprint_;
+    absl::StatusOr<EndpointAddressesList> last_addresses_;
+    std::string last_resolution_note_;
+    ChannelArgs last_args_;
   };
 
   ~WeightedTargetLb() override;
@@ -570,8 +581,37 @@ absl::Status WeightedTargetLb::WeightedChild::UpdateLocked(
         << "] WeightedChild " << this << " " << name_ << ": reactivating";
     delayed_removal_timer_.reset();
   }
-  // Create child policy if needed.
   args = args.Set(GRPC_ARG_LB_WEIGHTED_TARGET_CHILD, name_);
+  // Flatten the addresses so they can be compared against those of the
+  // next update.
+  absl::StatusOr<EndpointAddressesList> flattened_addresses;
+  if (addresses.ok()) {
+    EndpointAddressesList address_list;
+    (*addresses)->ForEach([&](const EndpointAddresses& endpoint) {
+      address_list.push_back(endpoint);
+    });
+    flattened_addresses = std::move(address_list);
+  } else {
+    flattened_addresses = addresses.status();
+  }
+  // Skip the update if nothing the child policy can see has changed.
+  // The weight is used only on this side of the child, and it has
+  // already been updated above.
+  if (child_policy_ != nullptr &&
+      config.config_fingerprint == last_config_fingerprint_ &&
+      flattened_addresses == last_addresses_ &&
+      resolution_note == last_resolution_note_ && args == last_args_) {
+    GRPC_TRACE_LOG(weighted_target_lb, INFO)
+        << "[weighted_target_lb " << weighted_target_policy_.get()
+        << "] WeightedChild " << this << " " << name_
+        << ": child policy inputs unchanged, skipping update";
+    return absl::OkStatus();
+  }
+  last_config_fingerprint_ = config.config_fingerprint;
+  last_addresses_ = std::move(flattened_addresses);
+  last_resolution_note_ = resolution_note;
+  last_args_ = args;
+  // Create child policy if needed.
   if (child_policy_ == nullptr) {
     child_policy_ = CreateChildPolicyLocked(args);
   }
@@ -672,6 +712,7 @@ void WeightedTargetLbConfig::ChildConfig::JsonPostLoad(
     return;
   }
   config = std::move(*lb_config);
+  config_fingerprint = JsonDump(it->second);
 }
 
 const JsonLoaderInterface* WeightedTargetLbConfig::JsonLoader(const JsonArgs&) {
@@ -0,0 +1,173 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/resolver/dns/event_engine/caching_dns_resolver.h"
+
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_core {
+
+namespace {
+
+using grpc_event_engine::experimental::EventEngine;
+
+struct CacheKey {
+  std::string authority;
+  std::string name;
+  std::string default_port;
+
+  bool operator<(const CacheKey& other) const {
+    return std::tie(authority, name, default_port) <
+           std::tie(other.authority, other.name, other.default_port);
+  }
+};
+
+// Process-wide cache of hostname lookup results, shared by all channels
+// and all EventEngine instances.
+class DnsQueryCache {
+ public:
+  using Waiters =
+      std::vector<EventEngine::DNSResolver::LookupHostnameCallback>;
+
+  // What the caller should do for a lookup: serve addresses immediately
+  // if set (a fresh or stale hit), and start an underlying lookup if
+  // start_refresh is true.  On a miss with a refresh already in flight,
+  // neither is set: on_resolve has been queued as a waiter.
+  struct LookupAction {
+    std::optional<std::vector<EventEngine::ResolvedAddress>> addresses;
+    bool start_refresh = false;
+  };
+
+  LookupAction Lookup(
+      const CacheKey& key,
+      EventEngine::DNSResolver::LookupHostnameCallback* on_resolve) {
+    MutexLock lock(&mu_);
+    LookupAction action;
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      action.addresses = it->second.addresses;
+      if (std::chrono::steady_clock::now() < it->second.expiration) {
+        return action;  // Fresh hit.
+      }
+      // Stale hit: serve the stale addresses, and kick off one refresh
+      // if none is already running.
+      action.start_refresh = pending_.emplace(key, Waiters()).second;
+      return action;
+    }
+    // Miss: join the in-flight refresh, or start one.
+    auto inserted = pending_.emplace(key, Waiters());
+    inserted.first->second.push_back(std::move(*on_resolve));
+    action.start_refresh = inserted.second;
+    return action;
+  }
+
+  // Completes a refresh: stores the result (failures are not cached, so
+  // stale data survives a failed refresh) and returns the waiters to
+  // notify.
+  Waiters FinishRefresh(
+      const CacheKey& key,
+      const absl::StatusOr<std::vector<EventEngine::ResolvedAddress>>& result,
+      std::chrono::steady_clock::duration ttl) {
+    MutexLock lock(&mu_);
+    if (result.ok()) {
+      if (entries_.size() >= kMaxEntries &&
+          entries_.find(key) == entries_.end()) {
+        // A process resolving more names than fit here gets the cache
+        // dropped wholesale rather than per-entry eviction bookkeeping.
+        entries_.clear();
+      }
+      entries_[key] = Entry{*result, std::chrono::steady_clock::now() + ttl};
+    }
+    auto it = pending_.find(key);
+    if (it == pending_.end()) return {};
+    Waiters waiters = std::move(it->second);
+    pending_.erase(it);
+    return waiters;
+  }
+
+ private:
+  struct Entry {
+    std::vector<EventEngine::ResolvedAddress> addresses;
+    std::chrono::steady_clock::time_point expiration;
+  };
+
+  static constexpr size_t kMaxEntries = 1024;
+
+  Mutex mu_;
+  std::map<CacheKey, Entry> entries_ ABSL_GUARDED_BY(mu_);
+  std::map<CacheKey, Waiters> pending_ ABSL_GUARDED_BY(mu_);
+};
+
+DnsQueryCache* GlobalDnsQueryCache() {
+  static NoDestruct<DnsQueryCache> cache;
+  return &*cache;
+}
+
+}  // namespace
+
+std::unique_ptr<EventEngine::DNSResolver> CachingDNSResolver::MaybeWrap(
+    const ChannelArgs& args, absl::string_view authority,
+    std::shared_ptr<EventEngine> event_engine,
+    std::unique_ptr<EventEngine::DNSResolver> resolver) {
+  const int ttl_ms = args.GetInt(GRPC_ARG_DNS_CACHE_TTL_MS).value_or(0);
+  if (ttl_ms <= 0) return resolver;
+  return std::unique_ptr<EventEngine::DNSResolver>(new CachingDNSResolver(
+      std::chrono::milliseconds(ttl_ms), std::string(authority),
+      std::move(event_engine), std::move(resolver)));
+}
+
+void CachingDNSResolver::LookupHostname(LookupHostnameCallback on_resolve,
+                                        absl::string_view name,
+                                        absl::string_view default_port) {
+  CacheKey key{authority_, std::string(name), std::string(default_port)};
+  auto action = GlobalDnsQueryCache()->Lookup(key, &on_resolve);
+  if (action.start_refresh) {
+    // The refresh callback captures only the key and the global cache,
+    // so it is safe to run after this resolver is destroyed.
+    resolver_->LookupHostname(
+        [key = std::move(key), ttl = ttl_](
+            absl::StatusOr<std::vector<EventEngine::ResolvedAddress>> result) {
+          auto waiters =
+              GlobalDnsQueryCache()->FinishRefresh(key, result, ttl);
+          for (auto& waiter : waiters) {
+            waiter(result);
+          }
+        },
+        name, default_port);
+  }
+  if (action.addresses.has_value()) {
+    // Serve the hit asynchronously, matching the underlying resolver's
+    // contract that on_resolve is not invoked inline.
+    event_engine_->Run([on_resolve = std::move(on_resolve),
+                        addresses = std::move(*action.addresses)]() mutable {
+      on_resolve(std::move(addresses));
+    });
+  }
+}
+
+}  // namespace grpc_core
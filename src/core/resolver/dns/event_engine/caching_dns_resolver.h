@@ -0,0 +1,89 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_RESOLVER_DNS_EVENT_ENGINE_CACHING_DNS_RESOLVER_H
+#define GRPC_SRC_CORE_RESOLVER_DNS_EVENT_ENGINE_CACHING_DNS_RESOLVER_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/strings/string_view.h"
+#include "src/core/lib/channel/channel_args.h"
+
+namespace grpc_core {
+
+// A decorator around an EventEngine::DNSResolver that serves hostname
+// lookups from a process-wide cache.  Entries live for the duration set
+// via GRPC_ARG_DNS_CACHE_TTL_MS (the EventEngine DNS interface does not
+// surface per-record TTLs, so one configured bound is used instead).
+// Expired entries are served stale while a single deduplicated refresh
+// is in flight, so a re-resolution storm across many channels targeting
+// the same name costs one query.  SRV and TXT lookups pass through
+// uncached.
+//
+// Wrapping happens above the EventEngine, so every resolver
+// implementation (c-ares, native POSIX/Windows, CFStream) benefits.
+class CachingDNSResolver final
+    : public grpc_event_engine::experimental::EventEngine::DNSResolver {
+ public:
+  using EventEngine = grpc_event_engine::experimental::EventEngine;
+
+  // Wraps resolver in the cache if GRPC_ARG_DNS_CACHE_TTL_MS is set to a
+  // positive value; otherwise returns it unchanged.
+  static std::unique_ptr<EventEngine::DNSResolver> MaybeWrap(
+      const ChannelArgs& args, absl::string_view authority,
+      std::shared_ptr<EventEngine> event_engine,
+      std::unique_ptr<EventEngine::DNSResolver> resolver);
+
+  void LookupHostname(LookupHostnameCallback on_resolve,
+                      absl::string_view name,
+                      absl::string_view default_port) override;
+
+  void LookupSRV(LookupSRVCallback on_resolve,
+                 absl::string_view name) override {
+    resolver_->LookupSRV(std::move(on_resolve), name);
+  }
+
+  void LookupTXT(LookupTXTCallback on_resolve,
+                 absl::string_view name) override {
+    resolver_->LookupTXT(std::move(on_resolve), name);
+  }
+
+  void* QueryExtension(absl::string_view id) override {
+    return resolver_->QueryExtension(id);
+  }
+
+ private:
+  CachingDNSResolver(std::chrono::steady_clock::duration ttl,
+                     std::string authority,
+                     std::shared_ptr<EventEngine> event_engine,
+                     std::unique_ptr<EventEngine::DNSResolver> resolver)
+      : ttl_(ttl),
+        authority_(std::move(authority)),
+        event_engine_(std::move(event_engine)),
+        resolver_(std::move(resolver)) {}
+
+  const std::chrono::steady_clock::duration ttl_;
+  const std::string authority_;
+  std::shared_ptr<EventEngine> event_engine_;
+  std::unique_ptr<EventEngine::DNSResolver> resolver_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_RESOLVER_DNS_EVENT_ENGINE_CACHING_DNS_RESOLVER_H
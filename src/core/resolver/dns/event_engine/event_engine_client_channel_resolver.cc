@@ -42,6 +42,7 @@
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/resolve_address.h"
 #include "src/core/load_balancing/grpclb/grpclb_balancer_addresses.h"
+#include "src/core/resolver/dns/event_engine/caching_dns_resolver.h"
 #include "src/core/resolver/dns/event_engine/service_config_helper.h"
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/resolver/polling_resolver.h"
@@ -198,7 +199,8 @@ OrphanablePtr<Orphanable> EventEngineClientChannelDNSResolver::StartRequest() {
   return MakeOrphanable<EventEngineDNSRequestWrapper>(
       RefAsSubclass<EventEngineClientChannelDNSResolver>(DEBUG_LOCATION,
                                                          "dns-resolving"),
-      std::move(*dns_resolver));
+      CachingDNSResolver::MaybeWrap(channel_args(), authority(), event_engine_,
+                                    std::move(*dns_resolver)));
 }
 
 // ----------------------------------------------------------------------------
@@ -21,6 +21,7 @@
 #include <grpc/support/port_platform.h>
 #include <string.h>
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -40,12 +41,16 @@ namespace grpc_core {
 
 EndpointAddresses::EndpointAddresses(const grpc_resolved_address& address,
                                      const ChannelArgs& args)
-    : addresses_(1, address), args_(args) {}
+    : addresses_(
+          std::make_shared<std::vector<grpc_resolved_address>>(1, address)),
+      args_(args) {}
 
 EndpointAddresses::EndpointAddresses(
     std::vector<grpc_resolved_address> addresses, const ChannelArgs& args)
-    : addresses_(std::move(addresses)), args_(args) {
-  CHECK(!addresses_.empty());
+    : addresses_(std::make_shared<std::vector<grpc_resolved_address>>(
+          std::move(addresses))),
+      args_(args) {
+  CHECK(!addresses_->empty());
 }
 
 EndpointAddresses::EndpointAddresses(const EndpointAddresses& other)
@@ -70,21 +75,27 @@ EndpointAddresses& EndpointAddresses::operator=(
 }
 
 int EndpointAddresses::Cmp(const EndpointAddresses& other) const {
-  for (size_t i = 0; i < addresses_.size(); ++i) {
-    if (other.addresses_.size() == i) return 1;
-    if (addresses_[i].len > other.addresses_[i].len) return 1;
-    if (addresses_[i].len < other.addresses_[i].len) return -1;
-    int retval =
-        memcmp(addresses_[i].addr, other.addresses_[i].addr, addresses_[i].len);
-    if (retval != 0) return retval;
+  // Copies share address storage, so pointer equality means the address
+  // lists are identical and only the args need comparing.
+  if (addresses_ != other.addresses_) {
+    const auto& addresses = *addresses_;
+    const auto& other_addresses = *other.addresses_;
+    for (size_t i = 0; i < addresses.size(); ++i) {
+      if (other_addresses.size() == i) return 1;
+      if (addresses[i].len > other_addresses[i].len) return 1;
+      if (addresses[i].len < other_addresses[i].len) return -1;
+      int retval =
+          memcmp(addresses[i].addr, other_addresses[i].addr, addresses[i].len);
+      if (retval != 0) return retval;
+    }
+    if (other_addresses.size() > addresses.size()) return -1;
   }
-  if (other.addresses_.size() > addresses_.size()) return -1;
   return QsortCompare(args_, other.args_);
 }
 
 std::string EndpointAddresses::ToString() const {
   std::vector<std::string> addr_strings;
-  for (const auto& address : addresses_) {
+  for (const auto& address : *addresses_) {
     auto addr_str = grpc_sockaddr_to_string(&address, false);
     addr_strings.push_back(addr_str.ok() ? std::move(*addr_str)
                                          : addr_str.status().ToString());
@@ -21,6 +21,7 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <memory>
 #include <set>
 #include <string>
 #include <utility>
@@ -80,10 +81,10 @@ class EndpointAddresses final {
 
   // For backward compatibility only.
   // TODO(roth): Remove when all callers have been updated.
-  const grpc_resolved_address& address() const { return addresses_[0]; }
+  const grpc_resolved_address& address() const { return (*addresses_)[0]; }
 
   const std::vector<grpc_resolved_address>& addresses() const {
-    return addresses_;
+    return *addresses_;
   }
   const ChannelArgs& args() const { return args_; }
 
@@ -93,7 +94,10 @@ class EndpointAddresses final {
   std::string ToString() const;
 
  private:
-  std::vector<grpc_resolved_address> addresses_;
+  // Immutable and shared between copies, so that copying an
+  // EndpointAddresses (which happens at every layer an address list
+  // flows through) doesn't duplicate the address storage.
+  std::shared_ptr<const std::vector<grpc_resolved_address>> addresses_;
   ChannelArgs args_;
 };
 
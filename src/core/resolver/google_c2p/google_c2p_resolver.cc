@@ -58,6 +58,13 @@ namespace {
 
 const char* kC2PAuthority = "traffic-director-c2p.xds.googleapis.com";
 
+// How long cached metadata-server results stay usable.  The attributes
+// we query cannot change while the VM is running, but a modest TTL
+// bounds the damage if a cached failure or a buggy metadata server
+// response sticks; workloads that create channels in bursts only pay
+// the HTTP round trip on the first one either way.
+constexpr Duration kMetadataServerCacheTtl = Duration::Minutes(5);
+
 class GoogleCloud2ProdResolver final : public Resolver {
  public:
   explicit GoogleCloud2ProdResolver(ResolverArgs args);
@@ -149,35 +156,55 @@ void GoogleCloud2ProdResolver::StartLocked() {
     child_resolver_->StartLocked();
     return;
   }
-  // Using xDS.  Start metadata server queries.
-  zone_query_ = MakeOrphanable<GcpMetadataQuery>(
-      metadata_server_name_, std::string(GcpMetadataQuery::kZoneAttribute),
-      &pollent_,
-      [resolver = RefAsSubclass<GoogleCloud2ProdResolver>()](
-          std::string /* attribute */,
-          absl::StatusOr<std::string> result) mutable {
-        resolver->work_serializer_->Run([resolver,
-                                         result = std::move(result)]() mutable {
-          resolver->ZoneQueryDone(result.ok() ? std::move(result).value() : "");
-        });
-      },
-      Duration::Seconds(10));
-  ipv6_query_ = MakeOrphanable<GcpMetadataQuery>(
-      metadata_server_name_, std::string(GcpMetadataQuery::kIPv6Attribute),
-      &pollent_,
-      [resolver = RefAsSubclass<GoogleCloud2ProdResolver>()](
-          std::string /* attribute */,
-          absl::StatusOr<std::string> result) mutable {
-        resolver->work_serializer_->Run(
-            [resolver, result = std::move(result)]() {
-              // Check that the payload is non-empty in order to work around
-              // the fact that there are buggy implementations of metadata
-              // servers in the wild, which can in some cases return 200
-              // plus an empty result when they should have returned 404.
-              resolver->IPv6QueryDone(result.ok() && !result->empty());
-            });
-      },
-      Duration::Seconds(10));
+  // Using xDS.  Start metadata server queries, preferring results
+  // cached from a previous channel's queries.
+  auto cached_zone = GcpMetadataQuery::GetFromCache(
+      metadata_server_name_, GcpMetadataQuery::kZoneAttribute,
+      kMetadataServerCacheTtl);
+  auto cached_ipv6 = GcpMetadataQuery::GetFromCache(
+      metadata_server_name_, GcpMetadataQuery::kIPv6Attribute,
+      kMetadataServerCacheTtl);
+  if (!cached_zone.has_value()) {
+    zone_query_ = MakeOrphanable<GcpMetadataQuery>(
+        metadata_server_name_, std::string(GcpMetadataQuery::kZoneAttribute),
+        &pollent_,
+        [resolver = RefAsSubclass<GoogleCloud2ProdResolver>()](
+            std::string /* attribute */,
+            absl::StatusOr<std::string> result) mutable {
+          resolver->work_serializer_->Run(
+              [resolver, result = std::move(result)]() mutable {
+                resolver->ZoneQueryDone(result.ok() ? std::move(result).value()
+                                                    : "");
+              });
+        },
+        Duration::Seconds(10));
+  }
+  if (!cached_ipv6.has_value()) {
+    ipv6_query_ = MakeOrphanable<GcpMetadataQuery>(
+        metadata_server_name_, std::string(GcpMetadataQuery::kIPv6Attribute),
+        &pollent_,
+        [resolver = RefAsSubclass<GoogleCloud2ProdResolver>()](
+            std::string /* attribute */,
+            absl::StatusOr<std::string> result) mutable {
+          resolver->work_serializer_->Run(
+              [resolver, result = std::move(result)]() {
+                // Check that the payload is non-empty in order to work around
+                // the fact that there are buggy implementations of metadata
+                // servers in the wild, which can in some cases return 200
+                // plus an empty result when they should have returned 404.
+                resolver->IPv6QueryDone(result.ok() && !result->empty());
+              });
+        },
+        Duration::Seconds(10));
+  }
+  // Deliver cached results after starting any remaining queries, since
+  // delivering the second result starts the xds resolver.
+  if (cached_zone.has_value()) {
+    ZoneQueryDone(cached_zone->ok() ? std::move(*cached_zone).value() : "");
+  }
+  if (cached_ipv6.has_value()) {
+    IPv6QueryDone(cached_ipv6->ok() && !(*cached_ipv6)->empty());
+  }
 }
 
 void GoogleCloud2ProdResolver::RequestReresolutionLocked() {
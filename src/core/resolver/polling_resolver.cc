@@ -26,6 +26,7 @@
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "absl/random/random.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
@@ -37,6 +38,7 @@
 #include "src/core/util/backoff.h"
 #include "src/core/util/debug_location.h"
 #include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/shared_bit_gen.h"
 #include "src/core/util/uri.h"
 #include "src/core/util/work_serializer.h"
 
@@ -44,6 +46,17 @@ namespace grpc_core {
 
 using ::grpc_event_engine::experimental::EventEngine;
 
+namespace {
+
+// Cooldown timers are jittered upward by up to this fraction, so that
+// many channels whose cooldowns started together (e.g., because a
+// backend fleet restarted and they all requested re-resolution at once)
+// do not fire their next resolutions in lockstep.  Matches the jitter
+// used for resolution backoff.
+constexpr double kCooldownJitter = 0.2;
+
+}  // namespace
+
 PollingResolver::PollingResolver(ResolverArgs args,
                                  Duration min_time_between_resolutions,
                                  BackOff::Options backoff_options,
@@ -221,16 +234,20 @@ void PollingResolver::MaybeStartResolvingLocked() {
     const Duration time_until_next_resolution =
         earliest_next_resolution - Timestamp::Now();
     if (time_until_next_resolution > Duration::Zero()) {
+      // The cooldown is a minimum interval, so jitter only upward.
+      const Duration delay =
+          time_until_next_resolution *
+          absl::Uniform(SharedBitGen(), 1.0, 1.0 + kCooldownJitter);
       if (GPR_UNLIKELY(tracer_ != nullptr && tracer_->enabled())) {
         const Duration last_resolution_ago =
             Timestamp::Now() - *last_resolution_timestamp_;
         LOG(INFO) << "[polling resolver " << this
                   << "] in cooldown from last resolution (from "
                   << last_resolution_ago.millis()
-                  << " ms ago); will resolve again in "
-                  << time_until_next_resolution.millis() << " ms";
+                  << " ms ago); will resolve again in " << delay.millis()
+                  << " ms";
       }
-      ScheduleNextResolutionTimer(time_until_next_resolution);
+      ScheduleNextResolutionTimer(delay);
       return;
     }
   }
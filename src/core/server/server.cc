@@ -18,6 +18,7 @@
 
 #include <grpc/byte_buffer.h>
 #include <grpc/grpc.h>
+#include <grpc/grpc_posix.h>
 #include <grpc/impl/channel_arg_names.h>
 #include <grpc/impl/connectivity_state.h>
 #include <grpc/slice.h>
@@ -39,6 +40,7 @@
 #include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/cleanup/cleanup.h"
 #include "absl/container/flat_hash_map.h"
 #include "absl/log/check.h"
@@ -458,6 +460,16 @@ class Server::RequestMatcherInterface {
   virtual void MatchOrQueue(size_t start_request_queue_index,
                             CallData* calld) = 0;
 
+  // Admission gate consulted before an incoming RPC is handed to this
+  // matcher (and before any request payload is read, so that shed work is
+  // shed cheaply). Returns false if the RPC should be rejected with
+  // RESOURCE_EXHAUSTED. A successful acquisition must be paired with a
+  // ReleaseCallSlot() once the call completes. The base implementation
+  // admits everything: the matchers that expect the application to request
+  // calls have their own backpressure via the pending queues.
+  virtual bool TryAcquireCallSlot() { return true; }
+  virtual void ReleaseCallSlot() {}
+
   // Returns the server associated with this request matcher
   virtual Server* server() const = 0;
 };
@@ -583,11 +595,13 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
     for (LockedMultiProducerSingleConsumerQueue& queue : requests_per_cq_) {
       CHECK_EQ(queue.Pop(), nullptr);
     }
+    MutexLock lock(&mu_);
     CHECK(pending_filter_stack_.empty());
     CHECK(pending_promises_.empty());
   }
 
   void ZombifyPending() override {
+    MutexLock lock(&mu_);
     while (!pending_filter_stack_.empty()) {
       pending_filter_stack_.front().calld->SetState(
           CallData::CallState::ZOMBIED);
@@ -628,7 +642,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
       while (true) {
         NextPendingCall pending_call;
         {
-          MutexLock lock(&server_->mu_call_);
+          MutexLock lock(&mu_);
           while (!pending_filter_stack_.empty() &&
                  pending_filter_stack_.front().Age() >
                      server_->max_time_in_pending_queue_) {
@@ -691,14 +705,14 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
     }
     // No cq to take the request found; queue it on the slow list.
     // We need to ensure that all the queues are empty.  We do this under
-    // the server mu_call_ lock to ensure that if something is added to
+    // the matcher's mu_ lock to ensure that if something is added to
     // an empty request queue, it will block until the call is actually
     // added to the pending list.
     RequestedCall* rc = nullptr;
     size_t cq_idx = 0;
     size_t loop_count;
     {
-      MutexLock lock(&server_->mu_call_);
+      MutexLock lock(&mu_);
       for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
         cq_idx =
             (start_request_queue_index + loop_count) % requests_per_cq_.size();
@@ -729,7 +743,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
     }
     // No cq to take the request found; queue it on the slow list.
     // We need to ensure that all the queues are empty.  We do this under
-    // the server mu_call_ lock to ensure that if something is added to
+    // the matcher's mu_ lock to ensure that if something is added to
     // an empty request queue, it will block until the call is actually
     // added to the pending list.
     RequestedCall* rc = nullptr;
@@ -737,7 +751,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
     size_t loop_count;
     {
       std::vector<std::shared_ptr<ActivityWaiter>> removed_pending;
-      MutexLock lock(&server_->mu_call_);
+      MutexLock lock(&mu_);
       while (!pending_promises_.empty() &&
              pending_promises_.front()->Age() >
                  server_->max_time_in_pending_queue_) {
@@ -821,10 +835,16 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
     const Timestamp created = Timestamp::Now();
   };
   using PendingCallPromises = std::shared_ptr<ActivityWaiter>;
-  std::queue<PendingCallFilterStack> pending_filter_stack_;
-  std::queue<PendingCallPromises> pending_promises_;
+  // Guards the pending lists.  This is per-matcher rather than the server-wide
+  // mu_call_ so that slow-path traffic on one method does not contend with
+  // other methods (the request queues themselves are lock-free on the push
+  // side and sharded per CQ).
+  Mutex mu_;
+  std::queue<PendingCallFilterStack> pending_filter_stack_
+      ABSL_GUARDED_BY(mu_);
+  std::queue<PendingCallPromises> pending_promises_ ABSL_GUARDED_BY(mu_);
   std::vector<LockedMultiProducerSingleConsumerQueue> requests_per_cq_;
-  bool zombified_ = false;
+  bool zombified_ ABSL_GUARDED_BY(mu_) = false;
 };
 
 // AllocatingRequestMatchers don't allow the application to request an RPC in
@@ -836,7 +856,22 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
 class Server::AllocatingRequestMatcherBase : public RequestMatcherInterface {
  public:
   AllocatingRequestMatcherBase(Server* server, grpc_completion_queue* cq)
-      : server_(server), cq_(cq) {
+      : server_(server),
+        cq_(cq),
+        max_concurrent_requests_(static_cast<size_t>(std::max(
+            0, server->channel_args()
+                   .GetInt(GRPC_ARG_SERVER_MAX_CONCURRENT_CALLBACK_REQUESTS)
+                   .value_or(0)))),
+        sheds_on_memory_pressure_(
+            server->channel_args()
+                .GetBool(GRPC_ARG_SERVER_CALLBACK_SHED_ON_MEMORY_PRESSURE)
+                .value_or(false)),
+        memory_quota_(
+            sheds_on_memory_pressure_
+                ? server->channel_args()
+                      .GetObject<ResourceQuota>()
+                      ->memory_quota()
+                : nullptr) {
     size_t idx;
     for (idx = 0; idx < server->cqs_.size(); idx++) {
       if (server->cqs_[idx] == cq) {
@@ -847,6 +882,33 @@ class Server::AllocatingRequestMatcherBase : public RequestMatcherInterface {
     cq_idx_ = idx;
   }
 
+  // Allocating matchers hand every matched RPC straight to the application,
+  // so in-flight concurrency is bounded here rather than by the request
+  // queues. A limit of zero means unlimited. In adaptive mode new RPCs are
+  // additionally refused while the server's memory quota reports high
+  // pressure, so an overloaded callback server sheds work before its
+  // allocations do.
+  bool TryAcquireCallSlot() override {
+    if (max_concurrent_requests_ == 0 && !sheds_on_memory_pressure_) {
+      return true;
+    }
+    if (sheds_on_memory_pressure_ && memory_quota_->IsMemoryPressureHigh()) {
+      return false;
+    }
+    if (max_concurrent_requests_ == 0) return true;
+    size_t curr = concurrent_requests_.load(std::memory_order_relaxed);
+    do {
+      if (curr >= max_concurrent_requests_) return false;
+    } while (!concurrent_requests_.compare_exchange_weak(
+        curr, curr + 1, std::memory_order_acq_rel, std::memory_order_relaxed));
+    return true;
+  }
+
+  void ReleaseCallSlot() override {
+    if (max_concurrent_requests_ == 0) return;
+    concurrent_requests_.fetch_sub(1, std::memory_order_acq_rel);
+  }
+
   void ZombifyPending() override {}
 
   void KillRequests(grpc_error_handle /*error*/) override {}
@@ -869,6 +931,10 @@ class Server::AllocatingRequestMatcherBase : public RequestMatcherInterface {
  private:
   Server* const server_;
   grpc_completion_queue* const cq_;
+  const size_t max_concurrent_requests_;
+  const bool sheds_on_memory_pressure_;
+  const MemoryQuotaRefPtr memory_quota_;
+  std::atomic<size_t> concurrent_requests_{0};
   size_t cq_idx_;
 };
 
@@ -1119,25 +1185,48 @@ auto Server::MatchRequestAndMaybeReadFirstMessage(CallHandler call_handler,
     payload_handling = registered_method->payload_handling;
     rm = registered_method->matcher.get();
   }
+  // Consult the matcher's concurrency gate before reading any request
+  // payload so that rejected RPCs cost as little as possible. The slot is
+  // returned when the call completes.
+  const bool admitted = rm->TryAcquireCallSlot();
+  if (admitted &&
+      !call_handler.OnDone([rm](bool) { rm->ReleaseCallSlot(); })) {
+    // The call already finished: return the slot immediately.
+    rm->ReleaseCallSlot();
+  }
   using FirstMessageResult = ValueOrFailure<std::optional<MessageHandle>>;
-  auto maybe_read_first_message = If(
-      payload_handling == GRPC_SRM_PAYLOAD_READ_INITIAL_BYTE_BUFFER,
-      [call_handler]() mutable {
-        return Map(
-            call_handler.PullMessage(),
-            [](ClientToServerNextMessage next_msg) -> FirstMessageResult {
-              if (!next_msg.ok()) return Failure{};
-              if (!next_msg.has_value()) {
-                return FirstMessageResult(std::nullopt);
-              }
-              return FirstMessageResult(next_msg.TakeValue());
+  using MatchedCall =
+      absl::StatusOr<std::tuple<std::optional<MessageHandle>,
+                                RequestMatcherInterface::MatchResult,
+                                ClientMetadataHandle>>;
+  return If(
+      admitted,
+      [payload_handling, call_handler, rm, md = std::move(md)]() mutable {
+        auto maybe_read_first_message = If(
+            payload_handling == GRPC_SRM_PAYLOAD_READ_INITIAL_BYTE_BUFFER,
+            [call_handler]() mutable {
+              return Map(
+                  call_handler.PullMessage(),
+                  [](ClientToServerNextMessage next_msg) -> FirstMessageResult {
+                    if (!next_msg.ok()) return Failure{};
+                    if (!next_msg.has_value()) {
+                      return FirstMessageResult(std::nullopt);
+                    }
+                    return FirstMessageResult(next_msg.TakeValue());
+                  });
+            },
+            []() -> FirstMessageResult {
+              return FirstMessageResult(std::nullopt);
+            });
+        return TryJoin<absl::StatusOr>(
+            std::move(maybe_read_first_message), rm->MatchRequest(0),
+            [md = std::move(md)]() mutable {
+              return ValueOrFailure<ClientMetadataHandle>(std::move(md));
             });
       },
-      []() -> FirstMessageResult { return FirstMessageResult(std::nullopt); });
-  return TryJoin<absl::StatusOr>(
-      std::move(maybe_read_first_message), rm->MatchRequest(0),
-      [md = std::move(md)]() mutable {
-        return ValueOrFailure<ClientMetadataHandle>(std::move(md));
+      []() -> MatchedCall {
+        return absl::ResourceExhaustedError(
+            "Too many outstanding requests for this method");
       });
 }
 
@@ -1189,14 +1278,35 @@ Server::MakeCallDestination(const ChannelArgs& args,
       }));
 }
 
+namespace {
+
+// If per-method latency tracking is enabled, put a ServerLatencyHistograms
+// object into the server's channel args so that every channel stack the
+// server creates (and in particular ServerCallTracerFilter) can reach it.
+ChannelArgs MaybeAddLatencyHistograms(const ChannelArgs& args) {
+  if (!args.GetBool(GRPC_ARG_SERVER_PER_METHOD_LATENCY_TRACKING)
+           .value_or(false)) {
+    return args;
+  }
+  return args.SetObject(MakeRefCounted<ServerLatencyHistograms>());
+}
+
+}  // namespace
+
 Server::Server(const ChannelArgs& args)
     : channelz::DataSource(CreateChannelzNode(args)),
-      channel_args_(args),
+      channel_args_(MaybeAddLatencyHistograms(args)),
       channelz_node_(channelz::DataSource::channelz_node() == nullptr
                          ? nullptr
                          : channelz::DataSource::channelz_node()
                                ->RefAsSubclass<channelz::ServerNode>()),
       server_call_tracer_factory_(ServerCallTracerFactory::Get(args)),
+      call_tracer_sample_rate_(
+          server_call_tracer_factory_ == nullptr
+              ? 1.0
+              : server_call_tracer_factory_->TracingSampleRate(args)),
+      latency_histograms_(
+          channel_args_.GetObjectRef<ServerLatencyHistograms>()),
       compression_options_(CompressionOptionsFromChannelArgs(args)),
       max_time_in_pending_queue_(Duration::Seconds(
           channel_args_
@@ -1221,6 +1331,10 @@ Server::~Server() {
 }
 
 void Server::AddData(channelz::DataSink sink) {
+  if (latency_histograms_ != nullptr) {
+    sink.AddData("per_method_latency",
+                 latency_histograms_->ChannelzProperties());
+  }
   MutexLock global_lock(&mu_global_);
   sink.AddData(
       "server",
@@ -1361,8 +1475,13 @@ grpc_error_handle Server::SetupTransport(Transport* transport,
       if (grpc_cq_pollset(cqs_[cq_idx]) == accepting_pollset) break;
     }
     if (cq_idx == cqs_.size()) {
-      // Completion queue not found.  Pick a random one to publish new calls to.
-      cq_idx = static_cast<size_t>(rand()) % std::max<size_t>(1, cqs_.size());
+      // Completion queue not found: the connection was not accepted on a CQ
+      // pollset (e.g. event engine listeners). Shard such connections across
+      // the CQs round-robin; every call on this transport will then prefer
+      // the same CQ's request queue, keeping completions for one connection
+      // together instead of scattering them.
+      cq_idx = next_connection_cq_idx_.fetch_add(1, std::memory_order_relaxed) %
+               std::max<size_t>(1, cqs_.size());
     }
     intptr_t channelz_socket_uuid = 0;
     if (auto socket_node = transport->GetSocketNode(); socket_node != nullptr) {
@@ -1428,6 +1547,7 @@ Server::RegisteredMethod* Server::RegisterMethod(
                << absl::StrFormat("0x%08x", flags);
     return nullptr;
   }
+  if (host != nullptr && host[0] != '\0') registered_method_has_host_ = true;
   auto it = registered_methods_.emplace(
       key, std::make_unique<RegisteredMethod>(method, host, payload_handling,
                                               flags));
@@ -1574,6 +1694,15 @@ void Server::StopListening() {
   }
 }
 
+std::vector<int> Server::ListenFds() const {
+  std::vector<int> fds;
+  for (const auto& listener_state : listener_states_) {
+    if (listener_state->listener() == nullptr) continue;
+    listener_state->listener()->AppendListenFds(&fds);
+  }
+  return fds;
+}
+
 void Server::CancelAllCalls() {
   ChannelBroadcaster broadcaster;
   {
@@ -1764,13 +1893,18 @@ void Server::ChannelData::InitTransport(RefCountedPtr<Server> server,
 Server::RegisteredMethod* Server::GetRegisteredMethod(
     const absl::string_view& host, const absl::string_view& path) {
   if (registered_methods_.empty()) return nullptr;
-  // check for an exact match with host
-  auto it = registered_methods_.find(std::pair(host, path));
-  if (it != registered_methods_.end()) {
-    return it->second.get();
+  // check for an exact match with host, but only if some method was
+  // actually registered with a host: the common case is that none were,
+  // and skipping this probe saves hashing the (host, path) pair on every
+  // incoming call.
+  if (registered_method_has_host_) {
+    auto it = registered_methods_.find(std::pair(host, path));
+    if (it != registered_methods_.end()) {
+      return it->second.get();
+    }
   }
   // check for wildcard method definition (no host set)
-  it = registered_methods_.find(std::pair("", path));
+  auto it = registered_methods_.find(std::pair("", path));
   if (it != registered_methods_.end()) {
     return it->second.get();
   }
@@ -1884,6 +2018,9 @@ Server::CallData::CallData(grpc_call_element* elem,
 
 Server::CallData::~CallData() {
   CHECK(state_.load(std::memory_order_relaxed) != CallState::PENDING);
+  // The matcher is owned by the server, which this call holds a ref to, so
+  // it is guaranteed to still be alive here.
+  if (holds_call_slot_) matcher_->ReleaseCallSlot();
   grpc_metadata_array_destroy(&initial_metadata_);
   grpc_byte_buffer_destroy(payload_);
 }
@@ -2003,6 +2140,18 @@ void Server::CallData::StartNewRpc(grpc_call_element* elem) {
       payload_handling = rm->payload_handling;
     }
   }
+  // Consult the matcher's concurrency gate before reading any request
+  // payload so that rejected RPCs cost as little as possible.
+  if (!matcher_->TryAcquireCallSlot()) {
+    grpc_call_cancel_with_status(call_, GRPC_STATUS_RESOURCE_EXHAUSTED,
+                                 "Too many outstanding requests for this "
+                                 "method",
+                                 nullptr);
+    state_.store(CallState::ZOMBIED, std::memory_order_relaxed);
+    KillZombie();
+    return;
+  }
+  holds_call_slot_ = true;
   // Start recv_message op if needed.
   switch (payload_handling) {
     case GRPC_SRM_PAYLOAD_NONE:
@@ -2256,3 +2405,13 @@ void grpc_server_config_fetcher_destroy(
       << server_config_fetcher << ")";
   delete grpc_core::ServerConfigFetcher::FromC(server_config_fetcher);
 }
+
+namespace grpc_core::experimental {
+
+std::vector<int> ServerListenFds(grpc_server* server) {
+  grpc_core::ExecCtx exec_ctx;
+  GRPC_TRACE_LOG(api, INFO) << "ServerListenFds(server=" << server << ")";
+  return grpc_core::Server::FromC(server)->ListenFds();
+}
+
+}  // namespace grpc_core::experimental
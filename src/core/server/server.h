@@ -63,6 +63,7 @@
 #include "src/core/lib/surface/completion_queue.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/server/server_interface.h"
+#include "src/core/server/server_latency_histograms.h"
 #include "src/core/telemetry/call_tracer.h"
 #include "src/core/util/cpp_impl_of.h"
 #include "src/core/util/dual_ref_counted.h"
@@ -76,6 +77,10 @@
 #define GRPC_ARG_SERVER_MAX_PENDING_REQUESTS "grpc.server.max_pending_requests"
 #define GRPC_ARG_SERVER_MAX_PENDING_REQUESTS_HARD_LIMIT \
   "grpc.server.max_pending_requests_hard_limit"
+#define GRPC_ARG_SERVER_MAX_CONCURRENT_CALLBACK_REQUESTS \
+  "grpc.server.max_concurrent_callback_requests"
+#define GRPC_ARG_SERVER_CALLBACK_SHED_ON_MEMORY_PRESSURE \
+  "grpc.server.callback_shed_on_memory_pressure"
 
 namespace grpc_core {
 
@@ -213,6 +218,13 @@ class Server : public ServerInterface,
 
     virtual const grpc_resolved_address* resolved_address() const = 0;
 
+    /// Appends the listening socket file descriptors owned by this
+    /// listener to fds, so that they can be handed off to another process
+    /// (e.g. over SCM_RIGHTS) across a server restart. The fds remain
+    /// owned by the listener. Listener types that do not own listening
+    /// sockets append nothing.
+    virtual void AppendListenFds(std::vector<int>* /*fds*/) const {}
+
     /// Sets a closure to be invoked by the listener when its destruction
     /// is complete.
     virtual void SetOnDestroyDone(grpc_closure* on_destroy_done) = 0;
@@ -354,6 +366,16 @@ class Server : public ServerInterface,
     return server_call_tracer_factory_;
   }
 
+  // Built-in per-method latency histograms, or null if
+  // GRPC_ARG_SERVER_PER_METHOD_LATENCY_TRACKING is not enabled.
+  ServerLatencyHistograms* latency_histograms() const {
+    return latency_histograms_.get();
+  }
+
+  double call_tracer_sample_rate() const override {
+    return call_tracer_sample_rate_;
+  }
+
   void set_config_fetcher(std::unique_ptr<ServerConfigFetcher> config_fetcher) {
     config_fetcher_ = std::move(config_fetcher);
   }
@@ -410,6 +432,12 @@ class Server : public ServerInterface,
 
   void StopListening();
 
+  // Returns the listening socket fds across all listeners, so that they can
+  // be handed off to another process across a server restart. The fds remain
+  // owned by the listeners; callers should dup() them before passing them to
+  // another process. See grpc_core::experimental::ServerListenFds().
+  std::vector<int> ListenFds() const;
+
   void CancelAllCalls() ABSL_LOCKS_EXCLUDED(mu_global_);
 
   void SendGoaways() ABSL_LOCKS_EXCLUDED(mu_global_, mu_call_);
@@ -542,6 +570,9 @@ class Server : public ServerInterface,
     grpc_completion_queue* cq_new_ = nullptr;
 
     RequestMatcherInterface* matcher_ = nullptr;
+    // True if this call was admitted through the matcher's concurrency
+    // gate; the slot is returned to the matcher when the call is destroyed.
+    bool holds_call_slot_ = false;
     grpc_byte_buffer* payload_ = nullptr;
 
     grpc_closure kill_zombie_closure_;
@@ -666,6 +697,8 @@ class Server : public ServerInterface,
   RefCountedPtr<channelz::ServerNode> channelz_node_;
   std::unique_ptr<ServerConfigFetcher> config_fetcher_;
   ServerCallTracerFactory* const server_call_tracer_factory_;
+  const double call_tracer_sample_rate_;
+  const RefCountedPtr<ServerLatencyHistograms> latency_histograms_;
 
   std::vector<grpc_completion_queue*> cqs_;
   std::vector<grpc_pollset*> pollsets_;
@@ -674,7 +707,9 @@ class Server : public ServerInterface,
 
   // The two following mutexes control access to server-state.
   // mu_global_ controls access to non-call-related state (e.g., channel state).
-  // mu_call_ controls access to call-related state (e.g., the call lists).
+  // mu_call_ serializes killing pending work at shutdown.  (Each request
+  // matcher guards its own pending lists with a per-matcher mutex so that
+  // slow-path traffic on one method does not contend with other methods.)
   //
   // If they are ever required to be nested, you must lock mu_global_
   // before mu_call_. This is currently used in shutdown processing
@@ -692,6 +727,9 @@ class Server : public ServerInterface,
                       std::unique_ptr<RegisteredMethod>,
                       StringViewStringViewPairHash, StringViewStringViewPairEq>
       registered_methods_;
+  // Whether any registered method named a specific host. When false (the
+  // common case), per-call lookup goes straight to the wildcard-host probe.
+  bool registered_method_has_host_ = false;
 
   // Request matcher for unregistered methods.
   std::unique_ptr<RequestMatcherInterface> unregistered_request_matcher_;
@@ -703,10 +741,19 @@ class Server : public ServerInterface,
   // server should not notify on shutdown until the counter is 0 (shutdown is
   // called and there are no requests that are accepted but not started).
   std::atomic<int> shutdown_refs_{1};
+
+  // Shards connections whose accepting pollset does not correspond to any
+  // completion queue (e.g. event engine based listeners) across CQs
+  // round-robin, so each connection still gets a stable CQ for the life of
+  // the transport.
+  std::atomic<size_t> next_connection_cq_idx_{0};
+
   bool shutdown_published_ ABSL_GUARDED_BY(mu_global_) = false;
   std::vector<ShutdownTag> shutdown_tags_ ABSL_GUARDED_BY(mu_global_);
 
-  RandomEarlyDetection pending_backlog_protector_ ABSL_GUARDED_BY(mu_call_){
+  // Configured at construction and immutable thereafter; Reject() is const,
+  // so this is safe to consult without holding any server mutex.
+  const RandomEarlyDetection pending_backlog_protector_{
       static_cast<uint64_t>(
           std::max(0, channel_args_.GetInt(GRPC_ARG_SERVER_MAX_PENDING_REQUESTS)
                           .value_or(1000))),
@@ -34,9 +34,10 @@ const grpc_channel_filter ServerCallTracerFilter::kFilter =
                            kFilterExaminesServerInitialMetadata>();
 
 absl::StatusOr<std::unique_ptr<ServerCallTracerFilter>>
-ServerCallTracerFilter::Create(const ChannelArgs& /*args*/,
+ServerCallTracerFilter::Create(const ChannelArgs& args,
                                ChannelFilter::Args /*filter_args*/) {
-  return std::make_unique<ServerCallTracerFilter>();
+  return std::make_unique<ServerCallTracerFilter>(
+      args.GetObjectRef<ServerLatencyHistograms>());
 }
 
 void RegisterServerCallTracerFilter(CoreConfiguration::Builder* builder) {
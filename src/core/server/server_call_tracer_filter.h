@@ -16,6 +16,7 @@
 #define GRPC_SRC_CORE_SERVER_SERVER_CALL_TRACER_FILTER_H
 
 #include <grpc/support/port_platform.h>
+#include <grpc/support/time.h>
 
 #include <functional>
 #include <utility>
@@ -30,9 +31,13 @@
 #include "src/core/lib/promise/context.h"
 #include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/pipe.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/server/server_latency_histograms.h"
 #include "src/core/telemetry/call_tracer.h"
 #include "src/core/util/latent_see.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/time.h"
 
 namespace grpc_core {
 
@@ -44,13 +49,24 @@ class ServerCallTracerFilter
   static absl::string_view TypeName() { return "server_call_tracer"; }
 
   static absl::StatusOr<std::unique_ptr<ServerCallTracerFilter>> Create(
-      const ChannelArgs& /*args*/, ChannelFilter::Args /*filter_args*/);
+      const ChannelArgs& args, ChannelFilter::Args /*filter_args*/);
+
+  explicit ServerCallTracerFilter(
+      RefCountedPtr<ServerLatencyHistograms> latency_histograms)
+      : latency_histograms_(std::move(latency_histograms)) {}
 
   class Call {
    public:
-    void OnClientInitialMetadata(ClientMetadata& client_initial_metadata) {
+    void OnClientInitialMetadata(ClientMetadata& client_initial_metadata,
+                                 ServerCallTracerFilter* filter) {
       GRPC_LATENT_SEE_INNER_SCOPE(
           "ServerCallTracerFilter::Call::OnClientInitialMetadata");
+      if (filter->latency_histograms_ != nullptr) {
+        if (const Slice* path =
+                client_initial_metadata.get_pointer(HttpPathMetadata())) {
+          path_ = path->Ref();
+        }
+      }
       auto* call_tracer = MaybeGetContext<ServerCallTracer>();
       if (call_tracer == nullptr) return;
       call_tracer->RecordReceivedInitialMetadata(&client_initial_metadata);
@@ -64,8 +80,16 @@ class ServerCallTracerFilter
       call_tracer->RecordSendInitialMetadata(&server_initial_metadata);
     }
 
-    void OnFinalize(const grpc_call_final_info* final_info) {
+    void OnFinalize(const grpc_call_final_info* final_info,
+                    ServerCallTracerFilter* filter) {
       GRPC_LATENT_SEE_INNER_SCOPE("ServerCallTracerFilter::Call::OnFinalize");
+      if (filter->latency_histograms_ != nullptr && final_info != nullptr &&
+          !path_.empty()) {
+        filter->latency_histograms_->RecordCallLatency(
+            path_.as_string_view(),
+            Duration::Milliseconds(
+                gpr_time_to_millis(final_info->stats.latency)));
+      }
       auto* call_tracer = MaybeGetContext<ServerCallTracer>();
       if (call_tracer == nullptr) return;
       call_tracer->RecordEnd(final_info);
@@ -82,7 +106,14 @@ class ServerCallTracerFilter
     static inline const NoInterceptor OnClientToServerMessage;
     static inline const NoInterceptor OnClientToServerHalfClose;
     static inline const NoInterceptor OnServerToClientMessage;
+
+   private:
+    // Only captured when per-method latency tracking is enabled.
+    Slice path_;
   };
+
+ private:
+  const RefCountedPtr<ServerLatencyHistograms> latency_histograms_;
 };
 
 void RegisterServerCallTracerFilter(CoreConfiguration::Builder* builder);
@@ -37,6 +37,10 @@ class ServerInterface {
   virtual const ChannelArgs& channel_args() const = 0;
   virtual channelz::ServerNode* channelz_node() const = 0;
   virtual ServerCallTracerFactory* server_call_tracer_factory() const = 0;
+  // Fraction of calls, in [0, 1], that should get a server call tracer.
+  // Cached at server creation so that the per-call sampling decision is
+  // a plain coin flip.
+  virtual double call_tracer_sample_rate() const { return 1.0; }
   virtual grpc_compression_options compression_options() const = 0;
 };
 
@@ -0,0 +1,110 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/server/server_latency_histograms.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace grpc_core {
+
+namespace {
+
+// Exponential bucket boundaries in milliseconds, 1ms..30min. Values at or
+// above the last boundary land in the final bucket. Same shape as the
+// 1800000/40 latency histograms in stats_data, but with the table local to
+// this file so that a HistogramView can be formed over per-method buckets.
+constexpr int kNumBoundaries = ServerLatencyHistograms::kNumLatencyBuckets + 1;
+const int kLatencyBucketBoundariesMs[kNumBoundaries] = {
+    0,      1,      2,      3,       5,      8,      12,     18,     26,
+    37,     53,     76,     108,     153,    217,    308,    436,    617,
+    873,    1235,   1748,   2473,    3499,   4950,   7003,   9907,   14015,
+    19825,  28044,  39670,  56116,   79379,  112286, 158835, 224680, 317821,
+    449574, 635945, 899575, 1272492, 1800000};
+
+int LatencyBucketFor(int value_ms) {
+  if (value_ms < 0) value_ms = 0;
+  const int* const begin = kLatencyBucketBoundariesMs;
+  const int* const end = begin + kNumBoundaries;
+  const int bucket =
+      static_cast<int>(std::upper_bound(begin + 1, end, value_ms) - begin) - 1;
+  return std::min(bucket, ServerLatencyHistograms::kNumLatencyBuckets - 1);
+}
+
+}  // namespace
+
+HistogramView ServerLatencyHistograms::MethodHistogram::View() const {
+  return HistogramView{&LatencyBucketFor, kLatencyBucketBoundariesMs,
+                       kNumLatencyBuckets, buckets};
+}
+
+void ServerLatencyHistograms::RecordCallLatency(absl::string_view method,
+                                                Duration latency) {
+  const int value_ms = static_cast<int>(
+      std::min<int64_t>(std::max<int64_t>(latency.millis(), 0),
+                        std::numeric_limits<int>::max()));
+  MutexLock lock(&mu_);
+  MethodHistogram* histogram;
+  auto it = histograms_.find(method);
+  if (it != histograms_.end()) {
+    histogram = &it->second;
+  } else if (histograms_.size() < kMaxTrackedMethods) {
+    histogram =
+        &histograms_.emplace(std::string(method), MethodHistogram()).first
+             ->second;
+  } else {
+    histogram = &histograms_
+                     .emplace(std::string(kOverflowMethod), MethodHistogram())
+                     .first->second;
+  }
+  ++histogram->buckets[LatencyBucketFor(value_ms)];
+  ++histogram->count;
+}
+
+std::vector<ServerLatencyHistograms::MethodSnapshot>
+ServerLatencyHistograms::Snapshot() const {
+  std::vector<MethodSnapshot> snapshot;
+  {
+    MutexLock lock(&mu_);
+    snapshot.reserve(histograms_.size());
+    for (const auto& [method, histogram] : histograms_) {
+      const HistogramView view = histogram.View();
+      snapshot.push_back(MethodSnapshot{method, histogram.count,
+                                        view.Percentile(50),
+                                        view.Percentile(95),
+                                        view.Percentile(99)});
+    }
+  }
+  std::sort(snapshot.begin(), snapshot.end(),
+            [](const MethodSnapshot& a, const MethodSnapshot& b) {
+              return a.method < b.method;
+            });
+  return snapshot;
+}
+
+channelz::PropertyGrid ServerLatencyHistograms::ChannelzProperties() const {
+  channelz::PropertyGrid grid;
+  for (const MethodSnapshot& method : Snapshot()) {
+    grid.Set("count", method.method, method.count)
+        .Set("p50_ms", method.method, method.p50_ms)
+        .Set("p95_ms", method.method, method.p95_ms)
+        .Set("p99_ms", method.method, method.p99_ms);
+  }
+  return grid;
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,104 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_SERVER_SERVER_LATENCY_HISTOGRAMS_H
+#define GRPC_SRC_CORE_SERVER_SERVER_LATENCY_HISTOGRAMS_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+#include "src/core/channelz/property_list.h"
+#include "src/core/telemetry/histogram_view.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+#include "src/core/util/useful.h"
+
+namespace grpc_core {
+
+// Built-in per-method server call latency histograms.
+//
+// Created by the server when GRPC_ARG_SERVER_PER_METHOD_LATENCY_TRACKING is
+// enabled and fed from ServerCallTracerFilter at call finalization, so no
+// stats plugin needs to be installed to observe per-method latency. The
+// histograms are exposed via the server's channelz entity and via the C++
+// grpc::experimental::GetServerMetricsSnapshot() API.
+//
+// Memory is bounded: at most kMaxTrackedMethods distinct methods get their
+// own histogram; calls to any further methods are aggregated under
+// kOverflowMethod.
+//
+// The object is plumbed to the server's channel stacks as a channel arg so
+// that ServerCallTracerFilter can reach it.
+class ServerLatencyHistograms final
+    : public RefCounted<ServerLatencyHistograms> {
+ public:
+  // Number of exponential latency buckets. Bucket boundaries are in
+  // milliseconds and span 1ms..30min (see kLatencyBucketBoundariesMs in the
+  // .cc file), mirroring the shape of the generated stats_data latency
+  // histograms.
+  static constexpr int kNumLatencyBuckets = 40;
+  // Bound on the number of distinct methods tracked.
+  static constexpr size_t kMaxTrackedMethods = 100;
+  // Key under which calls to methods beyond kMaxTrackedMethods aggregate.
+  static constexpr absl::string_view kOverflowMethod = "[other]";
+
+  static absl::string_view ChannelArgName() {
+    return "grpc.internal.server_latency_histograms";
+  }
+  static int ChannelArgsCompare(const ServerLatencyHistograms* a,
+                                const ServerLatencyHistograms* b) {
+    return QsortCompare(a, b);
+  }
+
+  // Snapshot of one method's latency distribution.
+  struct MethodSnapshot {
+    std::string method;
+    uint64_t count;
+    double p50_ms;
+    double p95_ms;
+    double p99_ms;
+  };
+
+  void RecordCallLatency(absl::string_view method, Duration latency)
+      ABSL_LOCKS_EXCLUDED(mu_);
+
+  // Returns a snapshot of all tracked methods, ordered by method name.
+  std::vector<MethodSnapshot> Snapshot() const ABSL_LOCKS_EXCLUDED(mu_);
+
+  // Per-method latency table for the server's channelz entity.
+  channelz::PropertyGrid ChannelzProperties() const;
+
+ private:
+  struct MethodHistogram {
+    uint64_t buckets[kNumLatencyBuckets] = {};
+    uint64_t count = 0;
+    HistogramView View() const;
+  };
+
+  mutable Mutex mu_;
+  absl::flat_hash_map<std::string, MethodHistogram> histograms_
+      ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_SERVER_SERVER_LATENCY_HISTOGRAMS_H
@@ -17,8 +17,10 @@
 #include "src/core/service_config/service_config_impl.h"
 
 #include <grpc/support/port_platform.h>
+#include <stdint.h>
 #include <string.h>
 
+#include <map>
 #include <optional>
 #include <string>
 #include <utility>
@@ -36,6 +38,8 @@
 #include "src/core/util/json/json_reader.h"
 #include "src/core/util/json/json_writer.h"
 #include "src/core/util/memory.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/sync.h"
 #include "src/core/util/validation_errors.h"
 
 namespace grpc_core {
@@ -80,8 +84,83 @@ struct MethodConfig {
 
 }  // namespace
 
+namespace {
+
+// Process-wide cache of parsed service configs.  A parsed config is a
+// pure function of the channel args and the JSON string, so resolvers
+// that re-deliver an unchanged config -- and channels that receive the
+// same config -- share one immutable parsed object instead of
+// re-parsing on every resolution.
+class ServiceConfigCache {
+ public:
+  RefCountedPtr<ServiceConfig> Lookup(const ChannelArgs& args,
+                                      absl::string_view json_string) {
+    Key key{args, std::string(json_string)};
+    MutexLock lock(&mu_);
+    CheckGenerationLocked();
+    auto it = cache_.find(key);
+    if (it == cache_.end()) return nullptr;
+    return it->second;
+  }
+
+  void Store(const ChannelArgs& args, absl::string_view json_string,
+             RefCountedPtr<ServiceConfig> service_config) {
+    MutexLock lock(&mu_);
+    CheckGenerationLocked();
+    // A process generally sees only a handful of distinct configs.  If
+    // something churns out more than fit here, drop the cache wholesale
+    // and let entries be re-parsed on demand.
+    if (cache_.size() >= kMaxEntries) cache_.clear();
+    cache_.emplace(Key{args, std::string(json_string)},
+                   std::move(service_config));
+  }
+
+  void Clear() {
+    MutexLock lock(&mu_);
+    cache_.clear();
+  }
+
+ private:
+  struct Key {
+    ChannelArgs args;
+    std::string json;
+
+    bool operator<(const Key& other) const {
+      int c = json.compare(other.json);
+      if (c != 0) return c < 0;
+      return args < other.args;
+    }
+  };
+
+  // Parse results also depend on the registered service config parsers,
+  // so entries from a previous CoreConfiguration (tests substitute it)
+  // must not be served.
+  void CheckGenerationLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&mu_) {
+    const uint64_t generation = CoreConfiguration::Generation();
+    if (generation != generation_) {
+      cache_.clear();
+      generation_ = generation;
+    }
+  }
+
+  static constexpr size_t kMaxEntries = 256;
+
+  Mutex mu_;
+  uint64_t generation_ ABSL_GUARDED_BY(&mu_) = 0;
+  std::map<Key, RefCountedPtr<ServiceConfig>> cache_ ABSL_GUARDED_BY(&mu_);
+};
+
+ServiceConfigCache* GlobalServiceConfigCache() {
+  static NoDestruct<ServiceConfigCache> cache;
+  return &*cache;
+}
+
+}  // namespace
+
 absl::StatusOr<RefCountedPtr<ServiceConfig>> ServiceConfigImpl::Create(
     const ChannelArgs& args, absl::string_view json_string) {
+  auto cached = GlobalServiceConfigCache()->Lookup(args, json_string);
+  if (cached != nullptr) return cached;
   auto json = JsonParse(json_string);
   if (!json.ok()) return json.status();
   ValidationErrors errors;
@@ -90,9 +169,14 @@ absl::StatusOr<RefCountedPtr<ServiceConfig>> ServiceConfigImpl::Create(
     return errors.status(absl::StatusCode::kInvalidArgument,
                          "errors validating service config");
   }
+  GlobalServiceConfigCache()->Store(args, json_string, service_config);
   return service_config;
 }
 
+void ServiceConfigImpl::ShutdownParseCache() {
+  GlobalServiceConfigCache()->Clear();
+}
+
 RefCountedPtr<ServiceConfig> ServiceConfigImpl::Create(
     const ChannelArgs& args, const Json& json, ValidationErrors* errors) {
   return Create(args, json, JsonDump(json), errors);
@@ -66,9 +66,15 @@ namespace grpc_core {
 class ServiceConfigImpl final : public ServiceConfig {
  public:
   /// Creates a new service config from parsing \a json_string.
+  /// Parse results are cached process-wide keyed on (args, json_string),
+  /// so repeated calls with unchanged inputs share one parsed object.
   static absl::StatusOr<RefCountedPtr<ServiceConfig>> Create(
       const ChannelArgs& args, absl::string_view json_string);
 
+  /// Drops the process-wide parse cache.  Called at grpc_shutdown() so
+  /// that cached configs don't pin channel arg objects past shutdown.
+  static void ShutdownParseCache();
+
   // Alternate forms that are useful in edge cases.
   static RefCountedPtr<ServiceConfig> Create(const ChannelArgs& args,
                                              const Json& json,
@@ -21,12 +21,17 @@
 #include <grpc/support/port_platform.h>
 
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
 #include "absl/log/check.h"
+#include "absl/random/distributions.h"
+#include "absl/strings/numbers.h"
 #include "src/core/lib/promise/context.h"
 #include "src/core/telemetry/tcp_tracer.h"
+#include "src/core/util/shared_bit_gen.h"
+#include "src/core/util/useful.h"
 
 namespace grpc_core {
 
@@ -50,6 +55,9 @@ ServerCallTracerFactory* g_server_call_tracer_factory_ = nullptr;
 const char* kServerCallTracerFactoryChannelArgName =
     "grpc.experimental.server_call_tracer_factory";
 
+const char* kServerCallTracerSampleRateChannelArgName =
+    "grpc.experimental.server_call_tracer_sample_rate";
+
 }  // namespace
 
 ServerCallTracerFactory* ServerCallTracerFactory::Get(
@@ -78,6 +86,25 @@ absl::string_view ServerCallTracerFactory::ChannelArgName() {
   return kServerCallTracerFactoryChannelArgName;
 }
 
+absl::string_view ServerCallTracerFactory::SampleRateChannelArgName() {
+  return kServerCallTracerSampleRateChannelArgName;
+}
+
+double ServerCallTracerFactory::TracingSampleRate(const ChannelArgs& args) {
+  std::optional<absl::string_view> rate_str =
+      args.GetString(SampleRateChannelArgName());
+  if (!rate_str.has_value()) return 1.0;
+  double rate;
+  if (!absl::SimpleAtod(*rate_str, &rate)) return 1.0;
+  return Clamp(rate, 0.0, 1.0);
+}
+
+bool ServerCallTracerFactory::ShouldSampleCall(double sample_rate) {
+  if (sample_rate >= 1.0) return true;
+  if (sample_rate <= 0.0) return false;
+  return absl::Bernoulli(SharedBitGen(), sample_rate);
+}
+
 class DelegatingClientCallTracer : public ClientCallTracer {
  public:
   class DelegatingClientCallAttemptTracer
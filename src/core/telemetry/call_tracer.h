@@ -209,6 +209,20 @@ class ServerCallTracerFactory {
   // Returns true if a server is to be traced, false otherwise.
   virtual bool IsServerTraced(const ChannelArgs& /*args*/) { return true; }
 
+  // Returns the fraction of calls, in [0, 1], that should get a call
+  // tracer. The decision for an individual call is made with
+  // ShouldSampleCall() before CreateNewServerCallTracer() is invoked, so
+  // unsampled calls skip tracer allocation entirely. The default
+  // implementation reads the channel arg named by
+  // SampleRateChannelArgName() (a string holding a double), tracing
+  // every call if the arg is unset.
+  virtual double TracingSampleRate(const ChannelArgs& args);
+
+  // Makes the per-call head-sampling decision for the given rate: a
+  // cheap coin flip, with the common all-or-nothing rates
+  // short-circuited.
+  static bool ShouldSampleCall(double sample_rate);
+
   // Use this method to get the server call tracer factory from channel args,
   // instead of directly fetching it with `GetObject`.
   static ServerCallTracerFactory* Get(const ChannelArgs& channel_args);
@@ -223,6 +237,10 @@ class ServerCallTracerFactory {
   static void TestOnlyReset();
 
   static absl::string_view ChannelArgName();
+
+  // Name of the channel arg holding the tracing sample rate read by the
+  // default TracingSampleRate() implementation.
+  static absl::string_view SampleRateChannelArgName();
 };
 
 // Convenience functions to add call tracers to a call context. Allows setting
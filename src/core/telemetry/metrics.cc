@@ -18,12 +18,91 @@
 
 #include <memory>
 #include <optional>
+#include <string>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "src/core/util/crash.h"
+#include "src/core/util/down_cast.h"
 
 namespace grpc_core {
 
+namespace {
+
+// Default LabelValueSet implementation used by plugins that do not
+// pre-aggregate: retains owned copies of the label values so that
+// recordings can be replayed through the span-based methods.
+class OwnedLabelValueSet final : public StatsPlugin::LabelValueSet {
+ public:
+  OwnedLabelValueSet(GlobalInstrumentsRegistry::GlobalInstrumentHandle handle,
+                     absl::Span<const absl::string_view> label_values,
+                     absl::Span<const absl::string_view> optional_label_values)
+      : handle_(handle),
+        labels_(label_values.begin(), label_values.end()),
+        optional_labels_(optional_label_values.begin(),
+                         optional_label_values.end()),
+        label_views_(labels_.begin(), labels_.end()),
+        optional_label_views_(optional_labels_.begin(),
+                              optional_labels_.end()) {}
+
+  GlobalInstrumentsRegistry::GlobalInstrumentHandle handle() const {
+    return handle_;
+  }
+  absl::Span<const absl::string_view> label_values() const {
+    return label_views_;
+  }
+  absl::Span<const absl::string_view> optional_label_values() const {
+    return optional_label_views_;
+  }
+
+ private:
+  GlobalInstrumentsRegistry::GlobalInstrumentHandle handle_;
+  std::vector<std::string> labels_;
+  std::vector<std::string> optional_labels_;
+  // Views over labels_/optional_labels_; those vectors are never
+  // mutated after construction.
+  std::vector<absl::string_view> label_views_;
+  std::vector<absl::string_view> optional_label_views_;
+};
+
+}  // namespace
+
+RefCountedPtr<StatsPlugin::LabelValueSet> StatsPlugin::MakeLabelValueSet(
+    GlobalInstrumentsRegistry::GlobalInstrumentHandle handle,
+    absl::Span<const absl::string_view> label_values,
+    absl::Span<const absl::string_view> optional_label_values) {
+  return MakeRefCounted<OwnedLabelValueSet>(handle, label_values,
+                                            optional_label_values);
+}
+
+void StatsPlugin::AddCounterWithLabelValueSet(LabelValueSet* label_value_set,
+                                              uint64_t value) {
+  auto* set = DownCast<OwnedLabelValueSet*>(label_value_set);
+  AddCounter(set->handle(), value, set->label_values(),
+             set->optional_label_values());
+}
+
+void StatsPlugin::AddCounterWithLabelValueSet(LabelValueSet* label_value_set,
+                                              double value) {
+  auto* set = DownCast<OwnedLabelValueSet*>(label_value_set);
+  AddCounter(set->handle(), value, set->label_values(),
+             set->optional_label_values());
+}
+
+void StatsPlugin::RecordHistogramWithLabelValueSet(
+    LabelValueSet* label_value_set, uint64_t value) {
+  auto* set = DownCast<OwnedLabelValueSet*>(label_value_set);
+  RecordHistogram(set->handle(), value, set->label_values(),
+                  set->optional_label_values());
+}
+
+void StatsPlugin::RecordHistogramWithLabelValueSet(
+    LabelValueSet* label_value_set, double value) {
+  auto* set = DownCast<OwnedLabelValueSet*>(label_value_set);
+  RecordHistogram(set->handle(), value, set->label_values(),
+                  set->optional_label_values());
+}
+
 // Uses the Construct-on-First-Use idiom to avoid the static initialization
 // order fiasco.
 std::vector<GlobalInstrumentsRegistry::GlobalInstrumentDescriptor>&
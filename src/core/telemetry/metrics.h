@@ -31,6 +31,8 @@
 #include "src/core/lib/slice/slice.h"
 #include "src/core/telemetry/call_tracer.h"
 #include "src/core/util/no_destruct.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/sync.h"
 #include "src/core/util/time.h"
 
@@ -281,6 +283,15 @@ class StatsPlugin {
     virtual int Compare(const ScopeConfig& other) const = 0;
   };
 
+  // An opaque, plugin-specific representation of a label value vector
+  // resolved once for a particular instrument via MakeLabelValueSet() and
+  // then used for many recordings. See StatsPluginGroup::MakeLabelSet()
+  // for the caller-facing API.
+  class LabelValueSet : public RefCounted<LabelValueSet> {
+   public:
+    ~LabelValueSet() override = default;
+  };
+
   virtual ~StatsPlugin() = default;
 
   // Whether this stats plugin is enabled for the channel specified by \a scope.
@@ -354,14 +365,29 @@ class StatsPlugin {
   virtual ServerCallTracer* GetServerCallTracer(
       std::shared_ptr<ScopeConfig> scope_config) = 0;
 
-  // TODO(yijiem): This is an optimization for the StatsPlugin to create its own
-  // representation of the label_values and use it multiple times. We would
-  // change AddCounter and RecordHistogram to take RefCountedPtr<LabelValueSet>
-  // and also change the StatsPluginsGroup to support this.
-  // Use the StatsPlugin to get a representation of label values that can be
-  // saved for multiple uses later.
-  // virtual RefCountedPtr<LabelValueSet> MakeLabelValueSet(
-  //     absl::Span<absl::string_view> label_values) = 0;
+  // Resolves the given label values for \a handle once into a reusable
+  // representation, so that hot recording sites do not pay to re-hash
+  // identical label vectors on every update. The default implementation
+  // retains owned copies of the label strings and replays them through
+  // the span-based recording methods above; plugins that can
+  // pre-aggregate should override this together with the LabelValueSet
+  // recording methods below.
+  virtual RefCountedPtr<LabelValueSet> MakeLabelValueSet(
+      GlobalInstrumentsRegistry::GlobalInstrumentHandle handle,
+      absl::Span<const absl::string_view> label_values,
+      absl::Span<const absl::string_view> optional_label_values);
+
+  // Recording through a LabelValueSet. \a label_value_set must have been
+  // created by MakeLabelValueSet() on this same plugin, for the
+  // instrument being recorded.
+  virtual void AddCounterWithLabelValueSet(LabelValueSet* label_value_set,
+                                           uint64_t value);
+  virtual void AddCounterWithLabelValueSet(LabelValueSet* label_value_set,
+                                           double value);
+  virtual void RecordHistogramWithLabelValueSet(LabelValueSet* label_value_set,
+                                                uint64_t value);
+  virtual void RecordHistogramWithLabelValueSet(LabelValueSet* label_value_set,
+                                                double value);
 };
 
 // A global registry of stats plugins. It has shared ownership to the registered
@@ -439,6 +465,94 @@ class GlobalStatsPluginRegistry {
                                       optional_values);
       }
     }
+    // A label vector resolved once against every plugin in the group.
+    // Hot recording sites create one per (instrument, label vector) -
+    // typically cached per subchannel or per method - and then record
+    // through it, avoiding the per-update cost of rebuilding and
+    // re-hashing identical label sets.
+    class LabelSet : public RefCounted<LabelSet> {
+     public:
+      ~LabelSet() override = default;
+
+     private:
+      friend class StatsPluginGroup;
+      // Parallel to plugins_state_.
+      std::vector<RefCountedPtr<StatsPlugin::LabelValueSet>> label_value_sets_;
+    };
+    // Tag-only subclass that carries the instrument's value and
+    // instrument types so that recording through a label set stays as
+    // strongly typed as the span-based methods above.
+    template <GlobalInstrumentsRegistry::ValueType V,
+              GlobalInstrumentsRegistry::InstrumentType I>
+    class TypedLabelSet : public LabelSet {};
+
+    // Resolves a label vector for \a handle once against all plugins in
+    // the group. Only counters and histograms can be recorded through a
+    // label set.
+    template <GlobalInstrumentsRegistry::ValueType V,
+              GlobalInstrumentsRegistry::InstrumentType I, std::size_t M,
+              std::size_t N>
+    RefCountedPtr<TypedLabelSet<V, I>> MakeLabelSet(
+        GlobalInstrumentsRegistry::TypedGlobalInstrumentHandle<V, I, M, N>
+            handle,
+        std::array<absl::string_view, M> label_values,
+        std::array<absl::string_view, N> optional_values) {
+      static_assert(
+          I == GlobalInstrumentsRegistry::InstrumentType::kCounter ||
+              I == GlobalInstrumentsRegistry::InstrumentType::kHistogram,
+          "only counters and histograms can be recorded through a label set");
+      auto label_set = MakeRefCounted<TypedLabelSet<V, I>>();
+      label_set->label_value_sets_.reserve(plugins_state_.size());
+      for (auto& state : plugins_state_) {
+        label_set->label_value_sets_.push_back(state.plugin->MakeLabelValueSet(
+            handle, label_values, optional_values));
+      }
+      return label_set;
+    }
+
+    // Records through a label set created by MakeLabelSet() on this
+    // group.
+    void AddCounter(
+        const TypedLabelSet<
+            GlobalInstrumentsRegistry::ValueType::kUInt64,
+            GlobalInstrumentsRegistry::InstrumentType::kCounter>& label_set,
+        uint64_t value) {
+      for (size_t i = 0; i < plugins_state_.size(); ++i) {
+        plugins_state_[i].plugin->AddCounterWithLabelValueSet(
+            label_set.label_value_sets_[i].get(), value);
+      }
+    }
+    void AddCounter(
+        const TypedLabelSet<
+            GlobalInstrumentsRegistry::ValueType::kDouble,
+            GlobalInstrumentsRegistry::InstrumentType::kCounter>& label_set,
+        double value) {
+      for (size_t i = 0; i < plugins_state_.size(); ++i) {
+        plugins_state_[i].plugin->AddCounterWithLabelValueSet(
+            label_set.label_value_sets_[i].get(), value);
+      }
+    }
+    void RecordHistogram(
+        const TypedLabelSet<
+            GlobalInstrumentsRegistry::ValueType::kUInt64,
+            GlobalInstrumentsRegistry::InstrumentType::kHistogram>& label_set,
+        uint64_t value) {
+      for (size_t i = 0; i < plugins_state_.size(); ++i) {
+        plugins_state_[i].plugin->RecordHistogramWithLabelValueSet(
+            label_set.label_value_sets_[i].get(), value);
+      }
+    }
+    void RecordHistogram(
+        const TypedLabelSet<
+            GlobalInstrumentsRegistry::ValueType::kDouble,
+            GlobalInstrumentsRegistry::InstrumentType::kHistogram>& label_set,
+        double value) {
+      for (size_t i = 0; i < plugins_state_.size(); ++i) {
+        plugins_state_[i].plugin->RecordHistogramWithLabelValueSet(
+            label_set.label_value_sets_[i].get(), value);
+      }
+    }
+
     // Returns true if any of the stats plugins in the group have enabled \a
     // handle.
     bool IsInstrumentEnabled(
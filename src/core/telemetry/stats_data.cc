@@ -415,6 +415,13 @@ const absl::string_view
         "enobufs_count",
         "uncommon_io_error_count",
         "msg_errqueue_error_count",
+        "poller_kicks",
+        "poller_kicks_coalesced",
+        "memory_quota_incremental_reclaims",
+        "memory_quota_exhaustion_reclaims",
+        "ssl_session_cache_hits",
+        "ssl_session_cache_misses",
+        "handshakes_queued",
 };
 const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     Counter::COUNT)] = {
@@ -452,6 +459,15 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of ENOBUFS errors",
     "Number of uncommon io errors",
     "Number of uncommon errors returned by MSG_ERRQUEUE",
+    "Number of times a poller thread was kicked to wake it up",
+    "Number of poller kicks elided because a wakeup was already pending",
+    "Number of paced non-destructive reclamation steps run under moderate "
+    "memory pressure",
+    "Number of reclamation sweeps triggered by memory quota exhaustion",
+    "Number of SSL session cache lookups that found a cached session",
+    "Number of SSL session cache lookups that found no cached session",
+    "Number of handshakes that waited in the admission queue because the "
+    "concurrent handshake limit was reached",
 };
 const absl::string_view
     GlobalStats::histogram_name[static_cast<int>(Histogram::COUNT)] = {
@@ -467,6 +483,7 @@ const absl::string_view
         "work_serializer_work_time_ms",
         "work_serializer_work_time_per_item_ms",
         "work_serializer_items_per_run",
+        "exec_ctx_closures_per_flush",
         "chaotic_good_sendmsgs_per_write_control",
         "chaotic_good_recvmsgs_per_read_control",
         "chaotic_good_sendmsgs_per_write_data",
@@ -497,6 +514,7 @@ const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     "work",
     "How long do individual items take to process in work serializers",
     "How many callbacks are executed when a work serializer runs",
+    "How many closures are executed when an exec ctx flushes",
     "Number of sendmsgs per control channel endpoint write",
     "Number of recvmsgs per control channel endpoint read",
     "Number of sendmsgs per data channel endpoint write",
@@ -542,7 +560,14 @@ GlobalStats::GlobalStats()
       enotconn_count{0},
       enobufs_count{0},
       uncommon_io_error_count{0},
-      msg_errqueue_error_count{0} {}
+      msg_errqueue_error_count{0},
+      poller_kicks{0},
+      poller_kicks_coalesced{0},
+      memory_quota_incremental_reclaims{0},
+      memory_quota_exhaustion_reclaims{0},
+      ssl_session_cache_hits{0},
+      ssl_session_cache_misses{0},
+      handshakes_queued{0} {}
 HistogramView GlobalStats::histogram(Histogram which) const {
   switch (which) {
     default:
@@ -583,6 +608,9 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kWorkSerializerItemsPerRun:
       return HistogramView{&Histogram_10000_20_64::BucketFor, kStatsTable4, 20,
                            work_serializer_items_per_run.buckets()};
+    case Histogram::kExecCtxClosuresPerFlush:
+      return HistogramView{&Histogram_10000_20_64::BucketFor, kStatsTable4, 20,
+                           exec_ctx_closures_per_flush.buckets()};
     case Histogram::kChaoticGoodSendmsgsPerWriteControl:
       return HistogramView{&Histogram_100_20_64::BucketFor, kStatsTable10, 20,
                            chaotic_good_sendmsgs_per_write_control.buckets()};
@@ -685,6 +713,19 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.uncommon_io_error_count.load(std::memory_order_relaxed);
     result->msg_errqueue_error_count +=
         data.msg_errqueue_error_count.load(std::memory_order_relaxed);
+    result->poller_kicks += data.poller_kicks.load(std::memory_order_relaxed);
+    result->poller_kicks_coalesced +=
+        data.poller_kicks_coalesced.load(std::memory_order_relaxed);
+    result->memory_quota_incremental_reclaims +=
+        data.memory_quota_incremental_reclaims.load(std::memory_order_relaxed);
+    result->memory_quota_exhaustion_reclaims +=
+        data.memory_quota_exhaustion_reclaims.load(std::memory_order_relaxed);
+    result->ssl_session_cache_hits +=
+        data.ssl_session_cache_hits.load(std::memory_order_relaxed);
+    result->ssl_session_cache_misses +=
+        data.ssl_session_cache_misses.load(std::memory_order_relaxed);
+    result->handshakes_queued +=
+        data.handshakes_queued.load(std::memory_order_relaxed);
     data.call_initial_size.Collect(&result->call_initial_size);
     data.tcp_write_size.Collect(&result->tcp_write_size);
     data.tcp_write_iov_size.Collect(&result->tcp_write_iov_size);
@@ -701,6 +742,8 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         &result->work_serializer_work_time_per_item_ms);
     data.work_serializer_items_per_run.Collect(
         &result->work_serializer_items_per_run);
+    data.exec_ctx_closures_per_flush.Collect(
+        &result->exec_ctx_closures_per_flush);
     data.chaotic_good_sendmsgs_per_write_control.Collect(
         &result->chaotic_good_sendmsgs_per_write_control);
     data.chaotic_good_recvmsgs_per_read_control.Collect(
@@ -775,6 +818,20 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       uncommon_io_error_count - other.uncommon_io_error_count;
   result->msg_errqueue_error_count =
       msg_errqueue_error_count - other.msg_errqueue_error_count;
+  result->poller_kicks = poller_kicks - other.poller_kicks;
+  result->poller_kicks_coalesced =
+      poller_kicks_coalesced - other.poller_kicks_coalesced;
+  result->memory_quota_incremental_reclaims =
+      memory_quota_incremental_reclaims -
+      other.memory_quota_incremental_reclaims;
+  result->memory_quota_exhaustion_reclaims =
+      memory_quota_exhaustion_reclaims -
+      other.memory_quota_exhaustion_reclaims;
+  result->ssl_session_cache_hits =
+      ssl_session_cache_hits - other.ssl_session_cache_hits;
+  result->ssl_session_cache_misses =
+      ssl_session_cache_misses - other.ssl_session_cache_misses;
+  result->handshakes_queued = handshakes_queued - other.handshakes_queued;
   result->call_initial_size = call_initial_size - other.call_initial_size;
   result->tcp_write_size = tcp_write_size - other.tcp_write_size;
   result->tcp_write_iov_size = tcp_write_iov_size - other.tcp_write_iov_size;
@@ -795,6 +852,8 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       other.work_serializer_work_time_per_item_ms;
   result->work_serializer_items_per_run =
       work_serializer_items_per_run - other.work_serializer_items_per_run;
+  result->exec_ctx_closures_per_flush =
+      exec_ctx_closures_per_flush - other.exec_ctx_closures_per_flush;
   result->chaotic_good_sendmsgs_per_write_control =
       chaotic_good_sendmsgs_per_write_control -
       other.chaotic_good_sendmsgs_per_write_control;
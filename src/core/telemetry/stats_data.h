@@ -301,6 +301,13 @@ struct GlobalStats {
     kEnobufsCount,
     kUncommonIoErrorCount,
     kMsgErrqueueErrorCount,
+    kPollerKicks,
+    kPollerKicksCoalesced,
+    kMemoryQuotaIncrementalReclaims,
+    kMemoryQuotaExhaustionReclaims,
+    kSslSessionCacheHits,
+    kSslSessionCacheMisses,
+    kHandshakesQueued,
     COUNT
   };
   enum class Histogram {
@@ -316,6 +323,7 @@ struct GlobalStats {
     kWorkSerializerWorkTimeMs,
     kWorkSerializerWorkTimePerItemMs,
     kWorkSerializerItemsPerRun,
+    kExecCtxClosuresPerFlush,
     kChaoticGoodSendmsgsPerWriteControl,
     kChaoticGoodRecvmsgsPerReadControl,
     kChaoticGoodSendmsgsPerWriteData,
@@ -371,6 +379,13 @@ struct GlobalStats {
       uint64_t enobufs_count;
       uint64_t uncommon_io_error_count;
       uint64_t msg_errqueue_error_count;
+      uint64_t poller_kicks;
+      uint64_t poller_kicks_coalesced;
+      uint64_t memory_quota_incremental_reclaims;
+      uint64_t memory_quota_exhaustion_reclaims;
+      uint64_t ssl_session_cache_hits;
+      uint64_t ssl_session_cache_misses;
+      uint64_t handshakes_queued;
     };
     uint64_t counters[static_cast<int>(Counter::COUNT)];
   };
@@ -386,6 +401,7 @@ struct GlobalStats {
   Histogram_100000_20_64 work_serializer_work_time_ms;
   Histogram_100000_20_64 work_serializer_work_time_per_item_ms;
   Histogram_10000_20_64 work_serializer_items_per_run;
+  Histogram_10000_20_64 exec_ctx_closures_per_flush;
   Histogram_100_20_64 chaotic_good_sendmsgs_per_write_control;
   Histogram_100_20_64 chaotic_good_recvmsgs_per_read_control;
   Histogram_100_20_64 chaotic_good_sendmsgs_per_write_data;
@@ -508,6 +524,32 @@ class GlobalStatsCollector {
     data_.this_cpu().msg_errqueue_error_count.fetch_add(
         1, std::memory_order_relaxed);
   }
+  void IncrementPollerKicks() {
+    data_.this_cpu().poller_kicks.fetch_add(1, std::memory_order_relaxed);
+  }
+  void IncrementPollerKicksCoalesced() {
+    data_.this_cpu().poller_kicks_coalesced.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementMemoryQuotaIncrementalReclaims() {
+    data_.this_cpu().memory_quota_incremental_reclaims.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementMemoryQuotaExhaustionReclaims() {
+    data_.this_cpu().memory_quota_exhaustion_reclaims.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementSslSessionCacheHits() {
+    data_.this_cpu().ssl_session_cache_hits.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementSslSessionCacheMisses() {
+    data_.this_cpu().ssl_session_cache_misses.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementHandshakesQueued() {
+    data_.this_cpu().handshakes_queued.fetch_add(1, std::memory_order_relaxed);
+  }
   void IncrementCallInitialSize(int value) {
     data_.this_cpu().call_initial_size.Increment(value);
   }
@@ -544,6 +586,9 @@ class GlobalStatsCollector {
   void IncrementWorkSerializerItemsPerRun(int value) {
     data_.this_cpu().work_serializer_items_per_run.Increment(value);
   }
+  void IncrementExecCtxClosuresPerFlush(int value) {
+    data_.this_cpu().exec_ctx_closures_per_flush.Increment(value);
+  }
   void IncrementChaoticGoodSendmsgsPerWriteControl(int value) {
     data_.this_cpu().chaotic_good_sendmsgs_per_write_control.Increment(value);
   }
@@ -622,6 +667,13 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> enobufs_count{0};
     std::atomic<uint64_t> uncommon_io_error_count{0};
     std::atomic<uint64_t> msg_errqueue_error_count{0};
+    std::atomic<uint64_t> poller_kicks{0};
+    std::atomic<uint64_t> poller_kicks_coalesced{0};
+    std::atomic<uint64_t> memory_quota_incremental_reclaims{0};
+    std::atomic<uint64_t> memory_quota_exhaustion_reclaims{0};
+    std::atomic<uint64_t> ssl_session_cache_hits{0};
+    std::atomic<uint64_t> ssl_session_cache_misses{0};
+    std::atomic<uint64_t> handshakes_queued{0};
     HistogramCollector_65536_26_64 call_initial_size;
     HistogramCollector_16777216_20_64 tcp_write_size;
     HistogramCollector_80_10_64 tcp_write_iov_size;
@@ -634,6 +686,7 @@ class GlobalStatsCollector {
     HistogramCollector_100000_20_64 work_serializer_work_time_ms;
     HistogramCollector_100000_20_64 work_serializer_work_time_per_item_ms;
     HistogramCollector_10000_20_64 work_serializer_items_per_run;
+    HistogramCollector_10000_20_64 exec_ctx_closures_per_flush;
     HistogramCollector_100_20_64 chaotic_good_sendmsgs_per_write_control;
     HistogramCollector_100_20_64 chaotic_good_recvmsgs_per_read_control;
     HistogramCollector_100_20_64 chaotic_good_sendmsgs_per_write_data;
@@ -649,7 +702,7 @@ class GlobalStatsCollector {
     HistogramCollector_16777216_20_64 chaotic_good_tcp_write_size_data;
     HistogramCollector_16777216_20_64 chaotic_good_tcp_write_size_control;
   };
-  PerCpu<Data> data_{PerCpuOptions().SetCpusPerShard(4).SetMaxShards(32)};
+  PerCpu<Data> data_{PerCpuOptions().SetCpusPerShard(1).SetMaxShards(128)};
 };
 inline GlobalStatsCollector& global_stats() {
   return *NoDestructSingleton<GlobalStatsCollector>::Get();
@@ -832,7 +885,7 @@ class Http2GlobalStatsCollector {
     HistogramCollector_16777216_50_64 http2_read_data_frame_size;
     HistogramCollector_16777216_50_64 http2_write_target_size;
   };
-  PerCpu<Data> data_{PerCpuOptions().SetCpusPerShard(4).SetMaxShards(32)};
+  PerCpu<Data> data_{PerCpuOptions().SetCpusPerShard(1).SetMaxShards(128)};
 };
 inline Http2GlobalStatsCollector& http2_global_stats() {
   return *NoDestructSingleton<Http2GlobalStatsCollector>::Get();
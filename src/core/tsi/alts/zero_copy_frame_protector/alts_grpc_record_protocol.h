@@ -49,6 +49,27 @@ tsi_result alts_grpc_record_protocol_protect(
     alts_grpc_record_protocol* self, grpc_slice_buffer* unprotected_slices,
     grpc_slice_buffer* protected_slices);
 
+///
+/// This method protects all data in unprotected_slices in one pass, splitting
+/// it into frames carrying at most max_unprotected_data_size bytes each, and
+/// appends the protected frames to protected_slices. Compared with calling
+/// alts_grpc_record_protocol_protect once per frame, this amortizes output
+/// allocations and slice bookkeeping across the whole batch. The input
+/// unprotected data slice buffer will be cleared on success.
+///
+///- self: an alts_grpc_record_protocol instance.
+///- unprotected_slices: the unprotected data to be protected.
+///- max_unprotected_data_size: maximum unprotected data bytes per frame.
+///- protected_slices: slice buffer where the protected frames are appended.
+///
+/// This method returns TSI_OK in case of success, TSI_UNIMPLEMENTED if the
+/// record protocol does not support batching (callers should fall back to
+/// per-frame protect), or a specific error code in case of failure.
+///
+tsi_result alts_grpc_record_protocol_protect_batch(
+    alts_grpc_record_protocol* self, grpc_slice_buffer* unprotected_slices,
+    size_t max_unprotected_data_size, grpc_slice_buffer* protected_slices);
+
 ///
 /// This methods performs unprotect operation on a full frame of protected data
 /// and appends unprotected data to unprotected_slices. It is the caller's
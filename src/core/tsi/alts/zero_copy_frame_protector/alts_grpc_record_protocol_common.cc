@@ -36,18 +36,24 @@ static void ensure_iovec_buf_size(alts_grpc_record_protocol* rp,
                                   const grpc_slice_buffer* sb) {
   CHECK(rp != nullptr);
   CHECK_NE(sb, nullptr);
-  if (sb->count <= rp->iovec_buf_length) {
+  alts_grpc_record_protocol_reserve_iovec_buf(rp, sb->count);
+}
+
+// --- Implementation of methods defined in tsi_grpc_record_protocol_common.h.
+// ---
+
+void alts_grpc_record_protocol_reserve_iovec_buf(alts_grpc_record_protocol* rp,
+                                                 size_t count) {
+  CHECK(rp != nullptr);
+  if (count <= rp->iovec_buf_length) {
     return;
   }
   // At least double the iovec buffer size.
-  rp->iovec_buf_length = std::max(sb->count, 2 * rp->iovec_buf_length);
+  rp->iovec_buf_length = std::max(count, 2 * rp->iovec_buf_length);
   rp->iovec_buf = static_cast<iovec_t*>(
       gpr_realloc(rp->iovec_buf, rp->iovec_buf_length * sizeof(iovec_t)));
 }
 
-// --- Implementation of methods defined in tsi_grpc_record_protocol_common.h.
-// ---
-
 void alts_grpc_record_protocol_convert_slice_buffer_to_iovec(
     alts_grpc_record_protocol* rp, const grpc_slice_buffer* sb) {
   CHECK(rp != nullptr);
@@ -136,6 +142,22 @@ tsi_result alts_grpc_record_protocol_protect(
   return self->vtable->protect(self, unprotected_slices, protected_slices);
 }
 
+tsi_result alts_grpc_record_protocol_protect_batch(
+    alts_grpc_record_protocol* self, grpc_slice_buffer* unprotected_slices,
+    size_t max_unprotected_data_size, grpc_slice_buffer* protected_slices) {
+  if (self == nullptr || self->vtable == nullptr ||
+      unprotected_slices == nullptr || protected_slices == nullptr ||
+      max_unprotected_data_size == 0) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  if (self->vtable->protect_batch == nullptr) {
+    return TSI_UNIMPLEMENTED;
+  }
+  return self->vtable->protect_batch(self, unprotected_slices,
+                                     max_unprotected_data_size,
+                                     protected_slices);
+}
+
 tsi_result alts_grpc_record_protocol_unprotect(
     alts_grpc_record_protocol* self, grpc_slice_buffer* protected_slices,
     grpc_slice_buffer* unprotected_slices) {
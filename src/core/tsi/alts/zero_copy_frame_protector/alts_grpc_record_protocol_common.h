@@ -39,6 +39,12 @@ struct alts_grpc_record_protocol_vtable {
                           grpc_slice_buffer* protected_slices,
                           grpc_slice_buffer* unprotected_slices);
   void (*destruct)(alts_grpc_record_protocol* self);
+  // Optional multi-frame protect; may be null, in which case
+  // alts_grpc_record_protocol_protect_batch returns TSI_UNIMPLEMENTED.
+  tsi_result (*protect_batch)(alts_grpc_record_protocol* self,
+                              grpc_slice_buffer* unprotected_slices,
+                              size_t max_unprotected_data_size,
+                              grpc_slice_buffer* protected_slices);
 };
 // Main struct for alts_grpc_record_protocol implementation, shared by both
 // integrity-only record protocol and privacy-integrity record protocol.
@@ -63,6 +69,14 @@ struct alts_grpc_record_protocol {
 void alts_grpc_record_protocol_convert_slice_buffer_to_iovec(
     alts_grpc_record_protocol* rp, const grpc_slice_buffer* sb);
 
+///
+/// Makes sure rp->iovec_buf can hold at least count entries, reallocating it
+/// if necessary. Used by batched protect implementations that build iovec
+/// arrays spanning arbitrary slice ranges.
+///
+void alts_grpc_record_protocol_reserve_iovec_buf(alts_grpc_record_protocol* rp,
+                                                 size_t count);
+
 ///
 /// Copies bytes from slice buffer to destination buffer. Caller is responsible
 /// for allocating enough memory of destination buffer. This method is used for
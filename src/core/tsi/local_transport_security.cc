@@ -27,16 +27,10 @@
 
 #include "absl/log/log.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
-#include "src/core/tsi/transport_security_grpc.h"
 #include "src/core/util/crash.h"
 
 namespace {
 
-// Main struct for local TSI zero-copy frame protector.
-typedef struct local_zero_copy_grpc_protector {
-  tsi_zero_copy_grpc_protector base;
-} local_zero_copy_grpc_protector;
-
 // Main struct for local TSI handshaker result.
 typedef struct local_tsi_handshaker_result {
   tsi_handshaker_result base;
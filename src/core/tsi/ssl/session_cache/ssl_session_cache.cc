@@ -21,15 +21,29 @@
 #include <grpc/support/port_platform.h>
 #include <grpc/support/string_util.h>
 
+#include "absl/hash/hash.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "absl/strings/string_view.h"
 #include "src/core/lib/slice/slice_internal.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/sync.h"
+#include "src/core/util/useful.h"
 
 namespace tsi {
 
+namespace {
+
+// One shard is enough for small caches; larger caches get one shard per this
+// many sessions of capacity (up to kMaxShards) so that reconnect storms
+// resuming many sessions concurrently do not serialize on a single lock.
+constexpr size_t kSessionsPerShard = 256;
+constexpr size_t kMaxShards = 32;
+
+}  // namespace
+
 /// Node for single cached session.
 class SslSessionLRUCache::Node {
  public:
@@ -61,38 +75,56 @@ class SslSessionLRUCache::Node {
   Node* prev_ = nullptr;
 };
 
-SslSessionLRUCache::SslSessionLRUCache(size_t capacity) : capacity_(capacity) {
+SslSessionLRUCache::SslSessionLRUCache(size_t capacity) {
   if (capacity == 0) {
     LOG(ERROR) << "SslSessionLRUCache capacity is zero. SSL sessions cannot be "
                   "resumed.";
   }
+  size_t num_shards =
+      grpc_core::Clamp<size_t>(capacity / kSessionsPerShard, 1, kMaxShards);
+  shards_ = std::vector<Shard>(num_shards);
+  // Distribute capacity across shards; the first shards take the remainder.
+  for (size_t i = 0; i < num_shards; i++) {
+    shards_[i].capacity =
+        capacity / num_shards + (i < capacity % num_shards ? 1 : 0);
+  }
 }
 
 SslSessionLRUCache::~SslSessionLRUCache() {
-  Node* node = use_order_list_head_;
-  while (node) {
-    Node* next = node->next_;
-    delete node;
-    node = next;
+  for (Shard& shard : shards_) {
+    Node* node = shard.use_order_list_head;
+    while (node) {
+      Node* next = node->next_;
+      delete node;
+      node = next;
+    }
   }
 }
 
 size_t SslSessionLRUCache::Size() {
-  grpc_core::MutexLock lock(&lock_);
-  return use_order_list_size_;
+  size_t size = 0;
+  for (Shard& shard : shards_) {
+    grpc_core::MutexLock lock(&shard.lock);
+    size += shard.use_order_list_size;
+  }
+  return size;
+}
+
+SslSessionLRUCache::Shard& SslSessionLRUCache::ShardForKey(const char* key) {
+  return shards_[absl::HashOf(absl::string_view(key)) % shards_.size()];
 }
 
 SslSessionLRUCache::Node* SslSessionLRUCache::FindLocked(
-    const std::string& key) {
-  auto it = entry_by_key_.find(key);
-  if (it == entry_by_key_.end()) {
+    Shard& shard, const std::string& key) {
+  auto it = shard.entry_by_key.find(key);
+  if (it == shard.entry_by_key.end()) {
     return nullptr;
   }
   Node* node = it->second;
   // Move to the beginning.
-  Remove(node);
-  PushFront(node);
-  AssertInvariants();
+  Remove(shard, node);
+  PushFront(shard, node);
+  AssertInvariants(shard);
   return node;
 }
 
@@ -101,87 +133,92 @@ void SslSessionLRUCache::Put(const char* key, SslSessionPtr session) {
     LOG(ERROR) << "Attempted to put null SSL session in session cache.";
     return;
   }
-  grpc_core::MutexLock lock(&lock_);
-  Node* node = FindLocked(key);
+  Shard& shard = ShardForKey(key);
+  grpc_core::MutexLock lock(&shard.lock);
+  Node* node = FindLocked(shard, key);
   if (node != nullptr) {
     node->SetSession(std::move(session));
     return;
   }
   node = new Node(key, std::move(session));
-  PushFront(node);
-  entry_by_key_.emplace(key, node);
-  AssertInvariants();
-  if (use_order_list_size_ > capacity_) {
-    CHECK(use_order_list_tail_);
-    node = use_order_list_tail_;
-    Remove(node);
+  PushFront(shard, node);
+  shard.entry_by_key.emplace(key, node);
+  AssertInvariants(shard);
+  if (shard.use_order_list_size > shard.capacity) {
+    CHECK(shard.use_order_list_tail);
+    node = shard.use_order_list_tail;
+    Remove(shard, node);
     // Order matters, key is destroyed after deleting node.
-    entry_by_key_.erase(node->key());
+    shard.entry_by_key.erase(node->key());
     delete node;
-    AssertInvariants();
+    AssertInvariants(shard);
   }
 }
 
 SslSessionPtr SslSessionLRUCache::Get(const char* key) {
-  grpc_core::MutexLock lock(&lock_);
+  Shard& shard = ShardForKey(key);
+  grpc_core::MutexLock lock(&shard.lock);
   // Key is only used for lookups.
-  Node* node = FindLocked(key);
+  Node* node = FindLocked(shard, key);
   if (node == nullptr) {
+    grpc_core::global_stats().IncrementSslSessionCacheMisses();
     return nullptr;
   }
+  grpc_core::global_stats().IncrementSslSessionCacheHits();
   return node->CopySession();
 }
 
-void SslSessionLRUCache::Remove(SslSessionLRUCache::Node* node) {
+void SslSessionLRUCache::Remove(Shard& shard, SslSessionLRUCache::Node* node) {
   if (node->prev_ == nullptr) {
-    use_order_list_head_ = node->next_;
+    shard.use_order_list_head = node->next_;
   } else {
     node->prev_->next_ = node->next_;
   }
   if (node->next_ == nullptr) {
-    use_order_list_tail_ = node->prev_;
+    shard.use_order_list_tail = node->prev_;
   } else {
     node->next_->prev_ = node->prev_;
   }
-  CHECK_GE(use_order_list_size_, 1u);
-  use_order_list_size_--;
+  CHECK_GE(shard.use_order_list_size, 1u);
+  shard.use_order_list_size--;
 }
 
-void SslSessionLRUCache::PushFront(SslSessionLRUCache::Node* node) {
-  if (use_order_list_head_ == nullptr) {
-    use_order_list_head_ = node;
-    use_order_list_tail_ = node;
+void SslSessionLRUCache::PushFront(Shard& shard,
+                                   SslSessionLRUCache::Node* node) {
+  if (shard.use_order_list_head == nullptr) {
+    shard.use_order_list_head = node;
+    shard.use_order_list_tail = node;
     node->next_ = nullptr;
     node->prev_ = nullptr;
   } else {
-    node->next_ = use_order_list_head_;
+    node->next_ = shard.use_order_list_head;
     node->next_->prev_ = node;
-    use_order_list_head_ = node;
+    shard.use_order_list_head = node;
     node->prev_ = nullptr;
   }
-  use_order_list_size_++;
+  shard.use_order_list_size++;
 }
 
 #ifndef NDEBUG
-void SslSessionLRUCache::AssertInvariants() {
+void SslSessionLRUCache::AssertInvariants(Shard& shard) {
   size_t size = 0;
   Node* prev = nullptr;
-  Node* current = use_order_list_head_;
+  Node* current = shard.use_order_list_head;
   while (current != nullptr) {
     size++;
     CHECK(current->prev_ == prev);
-    auto it = entry_by_key_.find(current->key());
-    CHECK(it != entry_by_key_.end());
+    auto it = shard.entry_by_key.find(current->key());
+    CHECK(it != shard.entry_by_key.end());
     CHECK(it->second == current);
     prev = current;
     current = current->next_;
   }
-  CHECK(prev == use_order_list_tail_);
-  CHECK(size == use_order_list_size_);
-  CHECK(entry_by_key_.size() == use_order_list_size_);
+  CHECK(prev == shard.use_order_list_tail);
+  CHECK(size == shard.use_order_list_size);
+  CHECK(shard.entry_by_key.size() == shard.use_order_list_size);
 }
 #else
-void SslSessionLRUCache::AssertInvariants() {}
+void SslSessionLRUCache::AssertInvariants(Shard& /*shard*/) {}
 #endif
 
 }  // namespace tsi
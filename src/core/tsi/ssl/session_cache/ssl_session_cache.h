@@ -26,6 +26,8 @@
 #include <openssl/ssl.h>
 
 #include <map>
+#include <string>
+#include <vector>
 
 #include "src/core/tsi/ssl/session_cache/ssl_session.h"
 #include "src/core/util/cpp_impl_of.h"
@@ -40,7 +42,9 @@
 /// name. Note that servers are required to share session ticket encryption keys
 /// in order for cache to be effective.
 ///
-/// This class is thread safe.
+/// This class is thread safe. Large caches are sharded by key hash so that
+/// concurrent handshakes resuming different sessions do not serialize on a
+/// single lock; the LRU eviction policy is applied per shard.
 
 namespace tsi {
 
@@ -78,18 +82,24 @@ class SslSessionLRUCache
  private:
   class Node;
 
-  Node* FindLocked(const std::string& key);
-  void Remove(Node* node);
-  void PushFront(Node* node);
-  void AssertInvariants();
+  /// Independent LRU list guarded by its own lock.
+  struct Shard {
+    grpc_core::Mutex lock;
+    size_t capacity = 0;
 
-  grpc_core::Mutex lock_;
-  size_t capacity_;
+    Node* use_order_list_head = nullptr;
+    Node* use_order_list_tail = nullptr;
+    size_t use_order_list_size = 0;
+    std::map<std::string, Node*> entry_by_key;
+  };
 
-  Node* use_order_list_head_ = nullptr;
-  Node* use_order_list_tail_ = nullptr;
-  size_t use_order_list_size_ = 0;
-  std::map<std::string, Node*> entry_by_key_;
+  Shard& ShardForKey(const char* key);
+  static Node* FindLocked(Shard& shard, const std::string& key);
+  static void Remove(Shard& shard, Node* node);
+  static void PushFront(Shard& shard, Node* node);
+  static void AssertInvariants(Shard& shard);
+
+  std::vector<Shard> shards_;
 };
 
 }  // namespace tsi
@@ -36,6 +36,8 @@
 
 #include <grpc/grpc_crl_provider.h>
 #include <grpc/grpc_security.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/string_util.h>
 #include <grpc/support/sync.h>
@@ -49,6 +51,7 @@
 #include <openssl/x509.h>
 #include <openssl/x509v3.h>
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <string>
@@ -62,12 +65,14 @@
 #include "absl/strings/string_view.h"
 #include "src/core/credentials/transport/tls/grpc_tls_crl_provider.h"
 #include "src/core/credentials/transport/tls/ssl_utils.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/lib/surface/init.h"
 #include "src/core/tsi/ssl/key_logging/ssl_key_logging.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
 #include "src/core/tsi/ssl_transport_security_utils.h"
 #include "src/core/tsi/ssl_types.h"
 #include "src/core/tsi/transport_security.h"
+#include "src/core/tsi/transport_security_grpc.h"
 #include "src/core/tsi/transport_security_interface.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/env.h"
@@ -98,6 +103,15 @@ const size_t kMaxChainLength = 100;
 // SSL structure. This is what we would ultimately want though...
 #define TSI_SSL_MAX_PROTECTION_OVERHEAD 100
 
+// Size of a TLS record header: 1 byte content type, 2 bytes version, 2 bytes
+// length.
+#define TSI_SSL_TLS_RECORD_HEADER_SIZE 5
+
+// Contiguous input at or above this size is encrypted straight out of the
+// caller's slice by the zero-copy protector; smaller slices are coalesced in
+// a staging buffer so that we do not emit a TLS record per tiny slice.
+#define TSI_SSL_ZERO_COPY_DIRECT_WRITE_THRESHOLD 1024
+
 using TlsSessionKeyLogger = tsi::TlsSessionKeyLoggerCache::TlsSessionKeyLogger;
 
 // --- Structure definitions. ---
@@ -160,6 +174,24 @@ struct tsi_ssl_frame_protector {
   // concurrently.
   gpr_mu mu;
 };
+struct tsi_ssl_zero_copy_grpc_protector {
+  tsi_zero_copy_grpc_protector base;
+  SSL* ssl;
+  BIO* network_io;
+  // Coalesces slices smaller than the direct-write threshold into full
+  // records.
+  unsigned char* staging;
+  size_t max_plaintext_bytes_per_frame;
+  size_t max_protected_frame_size;
+  // Ciphertext that the BIO pair could not yet absorb; carried over to the
+  // next unprotect call.
+  grpc_slice_buffer protected_sb;
+  // Scratch space for discarding consumed ciphertext slices.
+  grpc_slice_buffer consumed_sb;
+  // Ensures that protect and unprotect are not called concurrently: they
+  // share one SSL object.
+  gpr_mu mu;
+};
 // --- Library Initialization. ---
 
 namespace {
@@ -1434,6 +1466,201 @@ static const tsi_frame_protector_vtable frame_protector_vtable = {
     ssl_protector_destroy,
 };
 
+// --- tsi_zero_copy_grpc_protector methods implementation. ---
+
+// Moves all ciphertext currently pending in the network BIO into
+// protected_slices without any intermediate staging buffer.
+static tsi_result ssl_zero_copy_drain_network_bio(
+    BIO* network_io, grpc_slice_buffer* protected_slices) {
+  int pending;
+  while ((pending = static_cast<int>(BIO_pending(network_io))) > 0) {
+    grpc_slice slice = GRPC_SLICE_MALLOC(static_cast<size_t>(pending));
+    int read_from_ssl =
+        BIO_read(network_io, GRPC_SLICE_START_PTR(slice), pending);
+    if (read_from_ssl <= 0) {
+      grpc_core::CSliceUnref(slice);
+      LOG(ERROR) << "Could not read from BIO even though some data is pending";
+      return TSI_INTERNAL_ERROR;
+    }
+    if (static_cast<size_t>(read_from_ssl) < GRPC_SLICE_LENGTH(slice)) {
+      grpc_slice_buffer_add(
+          protected_slices,
+          grpc_slice_sub_no_ref(slice, 0, static_cast<size_t>(read_from_ssl)));
+    } else {
+      grpc_slice_buffer_add(protected_slices, slice);
+    }
+  }
+  return TSI_OK;
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_protect(
+    tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* unprotected_slices,
+    grpc_slice_buffer* protected_slices) {
+  if (self == nullptr || unprotected_slices == nullptr ||
+      protected_slices == nullptr) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  gpr_mu_lock(&impl->mu);
+  tsi_result result = TSI_OK;
+  size_t staging_offset = 0;
+  for (size_t i = 0; i < unprotected_slices->count && result == TSI_OK; i++) {
+    const unsigned char* cur =
+        GRPC_SLICE_START_PTR(unprotected_slices->slices[i]);
+    size_t remaining = GRPC_SLICE_LENGTH(unprotected_slices->slices[i]);
+    while (remaining > 0 && result == TSI_OK) {
+      if (staging_offset == 0 &&
+          remaining >= TSI_SSL_ZERO_COPY_DIRECT_WRITE_THRESHOLD) {
+        // Large contiguous input: encrypt straight out of the caller's slice.
+        size_t chunk = std::min(remaining, impl->max_plaintext_bytes_per_frame);
+        result = grpc_core::DoSslWrite(impl->ssl, cur, chunk);
+        if (result != TSI_OK) break;
+        result =
+            ssl_zero_copy_drain_network_bio(impl->network_io, protected_slices);
+        cur += chunk;
+        remaining -= chunk;
+      } else {
+        size_t chunk = std::min(
+            remaining, impl->max_plaintext_bytes_per_frame - staging_offset);
+        memcpy(impl->staging + staging_offset, cur, chunk);
+        staging_offset += chunk;
+        cur += chunk;
+        remaining -= chunk;
+        if (staging_offset == impl->max_plaintext_bytes_per_frame) {
+          result = grpc_core::DoSslWrite(impl->ssl, impl->staging,
+                                         staging_offset);
+          if (result != TSI_OK) break;
+          staging_offset = 0;
+          result = ssl_zero_copy_drain_network_bio(impl->network_io,
+                                                   protected_slices);
+        }
+      }
+    }
+  }
+  if (result == TSI_OK && staging_offset > 0) {
+    // Zero-copy protectors have no separate flush: emit the tail record now.
+    result = grpc_core::DoSslWrite(impl->ssl, impl->staging, staging_offset);
+    if (result == TSI_OK) {
+      result =
+          ssl_zero_copy_drain_network_bio(impl->network_io, protected_slices);
+    }
+  }
+  if (result == TSI_OK) grpc_slice_buffer_reset_and_unref(unprotected_slices);
+  gpr_mu_unlock(&impl->mu);
+  return result;
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_unprotect(
+    tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* protected_slices,
+    grpc_slice_buffer* unprotected_slices, int* min_progress_size) {
+  if (self == nullptr || protected_slices == nullptr ||
+      unprotected_slices == nullptr) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  gpr_mu_lock(&impl->mu);
+  grpc_slice_buffer_move_into(protected_slices, &impl->protected_sb);
+  tsi_result result = TSI_OK;
+  bool made_progress = true;
+  while (made_progress && result == TSI_OK) {
+    made_progress = false;
+    // Feed as much ciphertext as the BIO pair will absorb.
+    while (impl->protected_sb.length > 0) {
+      grpc_slice* first = &impl->protected_sb.slices[0];
+      CHECK_LE(GRPC_SLICE_LENGTH(*first), static_cast<size_t>(INT_MAX));
+      int written = BIO_write(impl->network_io, GRPC_SLICE_START_PTR(*first),
+                              static_cast<int>(GRPC_SLICE_LENGTH(*first)));
+      if (written <= 0) break;  // BIO pair full: decrypt to make room.
+      made_progress = true;
+      grpc_slice_buffer_move_first(&impl->protected_sb,
+                                   static_cast<size_t>(written),
+                                   &impl->consumed_sb);
+      grpc_slice_buffer_reset_and_unref(&impl->consumed_sb);
+    }
+    // Decrypt every complete record now in the BIO, straight into output
+    // slices.
+    for (;;) {
+      grpc_slice slice = GRPC_SLICE_MALLOC(impl->max_plaintext_bytes_per_frame);
+      size_t unprotected_size = GRPC_SLICE_LENGTH(slice);
+      result = grpc_core::DoSslRead(impl->ssl, GRPC_SLICE_START_PTR(slice),
+                                    &unprotected_size);
+      if (result != TSI_OK || unprotected_size == 0) {
+        grpc_core::CSliceUnref(slice);
+        break;
+      }
+      made_progress = true;
+      if (unprotected_size < GRPC_SLICE_LENGTH(slice)) {
+        grpc_slice_buffer_add(
+            unprotected_slices,
+            grpc_slice_sub_no_ref(slice, 0, unprotected_size));
+      } else {
+        grpc_slice_buffer_add(unprotected_slices, slice);
+      }
+    }
+  }
+  if (min_progress_size != nullptr) *min_progress_size = 1;
+  gpr_mu_unlock(&impl->mu);
+  return result;
+}
+
+static void ssl_zero_copy_grpc_protector_destroy(
+    tsi_zero_copy_grpc_protector* self) {
+  if (self == nullptr) return;
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  grpc_slice_buffer_destroy(&impl->protected_sb);
+  grpc_slice_buffer_destroy(&impl->consumed_sb);
+  if (impl->staging != nullptr) gpr_free(impl->staging);
+  if (impl->ssl != nullptr) SSL_free(impl->ssl);
+  if (impl->network_io != nullptr) BIO_free(impl->network_io);
+  gpr_mu_destroy(&impl->mu);
+  gpr_free(impl);
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_max_frame_size(
+    tsi_zero_copy_grpc_protector* self, size_t* max_frame_size) {
+  if (self == nullptr || max_frame_size == nullptr) return TSI_INVALID_ARGUMENT;
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  *max_frame_size = impl->max_protected_frame_size;
+  return TSI_OK;
+}
+
+static bool ssl_zero_copy_grpc_protector_read_frame_size(
+    tsi_zero_copy_grpc_protector* /*self*/, grpc_slice_buffer* protected_slices,
+    uint32_t* frame_size) {
+  if (protected_slices == nullptr || frame_size == nullptr) return false;
+  if (protected_slices->length < TSI_SSL_TLS_RECORD_HEADER_SIZE) return false;
+  // The record header may straddle slice boundaries.
+  unsigned char header[TSI_SSL_TLS_RECORD_HEADER_SIZE];
+  size_t copied = 0;
+  for (size_t i = 0;
+       i < protected_slices->count && copied < TSI_SSL_TLS_RECORD_HEADER_SIZE;
+       i++) {
+    size_t n = std::min(GRPC_SLICE_LENGTH(protected_slices->slices[i]),
+                        TSI_SSL_TLS_RECORD_HEADER_SIZE - copied);
+    memcpy(header + copied, GRPC_SLICE_START_PTR(protected_slices->slices[i]),
+           n);
+    copied += n;
+  }
+  // A TLS record is the 5 byte header plus the 16 bit length in bytes 3-4.
+  *frame_size = (static_cast<uint32_t>(header[3]) << 8 |
+                 static_cast<uint32_t>(header[4])) +
+                TSI_SSL_TLS_RECORD_HEADER_SIZE;
+  return true;
+}
+
+static const tsi_zero_copy_grpc_protector_vtable
+    ssl_zero_copy_grpc_protector_vtable = {
+        ssl_zero_copy_grpc_protector_protect,
+        ssl_zero_copy_grpc_protector_unprotect,
+        ssl_zero_copy_grpc_protector_destroy,
+        ssl_zero_copy_grpc_protector_max_frame_size,
+        ssl_zero_copy_grpc_protector_read_frame_size,
+};
+
 // --- tsi_server_handshaker_factory methods implementation. ---
 
 static void tsi_ssl_handshaker_factory_destroy(
@@ -1586,7 +1813,57 @@ static tsi_result ssl_handshaker_result_extract_peer(
 static tsi_result ssl_handshaker_result_get_frame_protector_type(
     const tsi_handshaker_result* /*self*/,
     tsi_frame_protector_type* frame_protector_type) {
-  *frame_protector_type = TSI_FRAME_PROTECTOR_NORMAL;
+  *frame_protector_type = TSI_FRAME_PROTECTOR_NORMAL_OR_ZERO_COPY;
+  return TSI_OK;
+}
+
+static tsi_result ssl_handshaker_result_create_zero_copy_grpc_protector(
+    const tsi_handshaker_result* self, size_t* max_output_protected_frame_size,
+    tsi_zero_copy_grpc_protector** protector) {
+  size_t actual_max_output_protected_frame_size =
+      TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+  tsi_ssl_handshaker_result* impl =
+      reinterpret_cast<tsi_ssl_handshaker_result*>(
+          const_cast<tsi_handshaker_result*>(self));
+  tsi_ssl_zero_copy_grpc_protector* protector_impl =
+      static_cast<tsi_ssl_zero_copy_grpc_protector*>(
+          gpr_zalloc(sizeof(*protector_impl)));
+
+  if (max_output_protected_frame_size != nullptr) {
+    if (*max_output_protected_frame_size >
+        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND) {
+      *max_output_protected_frame_size =
+          TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+    } else if (*max_output_protected_frame_size <
+               TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND) {
+      *max_output_protected_frame_size =
+          TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND;
+    }
+    actual_max_output_protected_frame_size = *max_output_protected_frame_size;
+  }
+  protector_impl->max_protected_frame_size =
+      actual_max_output_protected_frame_size;
+  protector_impl->max_plaintext_bytes_per_frame =
+      actual_max_output_protected_frame_size - TSI_SSL_MAX_PROTECTION_OVERHEAD;
+  protector_impl->staging = static_cast<unsigned char*>(
+      gpr_malloc(protector_impl->max_plaintext_bytes_per_frame));
+  if (protector_impl->staging == nullptr) {
+    LOG(ERROR)
+        << "Could not allocate buffer for tsi_ssl_zero_copy_grpc_protector.";
+    gpr_free(protector_impl);
+    return TSI_INTERNAL_ERROR;
+  }
+  grpc_slice_buffer_init(&protector_impl->protected_sb);
+  grpc_slice_buffer_init(&protector_impl->consumed_sb);
+
+  // Transfer ownership of ssl and network_io to the zero-copy protector.
+  protector_impl->ssl = impl->ssl;
+  impl->ssl = nullptr;
+  protector_impl->network_io = impl->network_io;
+  impl->network_io = nullptr;
+  gpr_mu_init(&protector_impl->mu);
+  protector_impl->base.vtable = &ssl_zero_copy_grpc_protector_vtable;
+  *protector = &protector_impl->base;
   return TSI_OK;
 }
 
@@ -1657,7 +1934,7 @@ static void ssl_handshaker_result_destroy(tsi_handshaker_result* self) {
 static const tsi_handshaker_result_vtable handshaker_result_vtable = {
     ssl_handshaker_result_extract_peer,
     ssl_handshaker_result_get_frame_protector_type,
-    nullptr,  // create_zero_copy_grpc_protector
+    ssl_handshaker_result_create_zero_copy_grpc_protector,
     ssl_handshaker_result_create_frame_protector,
     ssl_handshaker_result_get_unused_bytes,
     ssl_handshaker_result_destroy,
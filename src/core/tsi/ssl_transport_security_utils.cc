@@ -72,7 +72,7 @@ void LogSslErrorStack(void) {
   }
 }
 
-tsi_result DoSslWrite(SSL* ssl, unsigned char* unprotected_bytes,
+tsi_result DoSslWrite(SSL* ssl, const unsigned char* unprotected_bytes,
                       size_t unprotected_bytes_size) {
   CHECK_LE(unprotected_bytes_size, static_cast<size_t>(INT_MAX));
   ERR_clear_error();
@@ -160,10 +160,18 @@ tsi_result SslProtectorProtect(const unsigned char* unprotected_bytes,
     return TSI_OK;
   }
 
-  // If we can, prepare the buffer, send it to SSL_write and read.
-  memcpy(buffer + buffer_offset, unprotected_bytes, available);
-  result = DoSslWrite(ssl, buffer, buffer_size);
-  if (result != TSI_OK) return result;
+  if (buffer_offset == 0) {
+    // Nothing is staged: encrypt a full frame straight out of the caller's
+    // buffer instead of copying it through ours first. Framing is unchanged -
+    // SSL_write still sees exactly buffer_size bytes.
+    result = DoSslWrite(ssl, unprotected_bytes, buffer_size);
+    if (result != TSI_OK) return result;
+  } else {
+    // If we can, prepare the buffer, send it to SSL_write and read.
+    memcpy(buffer + buffer_offset, unprotected_bytes, available);
+    result = DoSslWrite(ssl, buffer, buffer_size);
+    if (result != TSI_OK) return result;
+  }
 
   CHECK_LE(*protected_output_frames_size, static_cast<size_t>(INT_MAX));
   read_from_ssl = BIO_read(network_io, protected_output_frames,
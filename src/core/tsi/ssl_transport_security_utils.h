@@ -49,7 +49,7 @@ void LogSslErrorStack(void);
 // unprotected_bytes_size: the size of the buffer |unprotected_bytes|.
 //
 // return: TSI_OK if the write operation succeeds or corresponding TSI errors.
-tsi_result DoSslWrite(SSL* ssl, unsigned char* unprotected_bytes,
+tsi_result DoSslWrite(SSL* ssl, const unsigned char* unprotected_bytes,
                       size_t unprotected_bytes_size);
 
 // Performs an SSL_read and handle errors.
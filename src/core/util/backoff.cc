@@ -22,6 +22,9 @@
 
 #include <algorithm>
 
+#include "absl/random/random.h"
+#include "src/core/util/shared_bit_gen.h"
+
 namespace grpc_core {
 
 BackOff::BackOff(const Options& options) : options_(options) { Reset(); }
@@ -33,8 +36,9 @@ Duration BackOff::NextAttemptDelay() {
     current_backoff_ *= options_.multiplier();
   }
   current_backoff_ = std::min(current_backoff_, options_.max_backoff());
+  SharedBitGen bitgen;
   const double jitter =
-      absl::Uniform(bitgen_, 1 - options_.jitter(), 1 + options_.jitter());
+      absl::Uniform(bitgen, 1 - options_.jitter(), 1 + options_.jitter());
   return current_backoff_ * jitter;
 }
 
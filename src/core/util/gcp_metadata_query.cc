@@ -24,6 +24,7 @@
 #include <grpc/support/port_platform.h>
 #include <string.h>
 
+#include <map>
 #include <memory>
 #include <utility>
 
@@ -35,13 +36,38 @@
 #include "absl/strings/string_view.h"
 #include "src/core/credentials/transport/transport_credentials.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/util/no_destruct.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/status_helper.h"
+#include "src/core/util/sync.h"
 #include "src/core/util/time.h"
 #include "src/core/util/uri.h"
 
 namespace grpc_core {
 
+namespace {
+
+// Process-wide cache of metadata-server query results, shared by all
+// channels so that attributes that cannot change for the lifetime of
+// the instance (zone, instance id, ...) are fetched only once.
+struct MetadataQueryCache {
+  struct Entry {
+    absl::StatusOr<std::string> result;
+    Timestamp timestamp;
+  };
+
+  Mutex mu;
+  std::map<std::pair<std::string, std::string>, Entry> entries
+      ABSL_GUARDED_BY(mu);
+};
+
+MetadataQueryCache* GetMetadataQueryCache() {
+  static NoDestruct<MetadataQueryCache> cache;
+  return cache.get();
+}
+
+}  // namespace
+
 constexpr const char GcpMetadataQuery::kZoneAttribute[];
 constexpr const char GcpMetadataQuery::kClusterNameAttribute[];
 constexpr const char GcpMetadataQuery::kRegionAttribute[];
@@ -65,12 +91,13 @@ GcpMetadataQuery::GcpMetadataQuery(
         callback,
     Duration timeout)
     : InternallyRefCounted<GcpMetadataQuery>(nullptr, 2),
+      metadata_server_name_(std::move(metadata_server_name)),
       attribute_(std::move(attribute)),
       callback_(std::move(callback)) {
   GRPC_CLOSURE_INIT(&on_done_, OnDone, this, nullptr);
   auto uri =
-      URI::Create("http", /*user_info=*/"", std::move(metadata_server_name),
-                  attribute_, {} /* query params */, "" /* fragment */);
+      URI::Create("http", /*user_info=*/"", metadata_server_name_, attribute_,
+                  {} /* query params */, "" /* fragment */);
   CHECK(uri.ok());  // params are hardcoded
   grpc_http_request request;
   memset(&request, 0, sizeof(grpc_http_request));
@@ -124,10 +151,31 @@ void GcpMetadataQuery::OnDone(void* arg, grpc_error_handle error) {
   } else {
     result = std::string(self->response_.body, self->response_.body_length);
   }
+  auto* cache = GetMetadataQueryCache();
+  {
+    MutexLock lock(&cache->mu);
+    cache->entries[{self->metadata_server_name_, self->attribute_}] = {
+        result, Timestamp::Now()};
+  }
   auto callback = std::move(self->callback_);
   auto attribute = std::move(self->attribute_);
   self->Unref();
   return callback(std::move(attribute), std::move(result));
 }
 
+std::optional<absl::StatusOr<std::string>> GcpMetadataQuery::GetFromCache(
+    absl::string_view metadata_server_name, absl::string_view attribute,
+    Duration ttl) {
+  auto* cache = GetMetadataQueryCache();
+  MutexLock lock(&cache->mu);
+  auto it = cache->entries.find(
+      {std::string(metadata_server_name), std::string(attribute)});
+  if (it == cache->entries.end()) return std::nullopt;
+  if (Timestamp::Now() - it->second.timestamp > ttl) {
+    cache->entries.erase(it);
+    return std::nullopt;
+  }
+  return it->second.result;
+}
+
 }  // namespace grpc_core
@@ -19,10 +19,12 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <optional>
 #include <string>
 
 #include "absl/functional/any_invocable.h"
 #include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/polling_entity.h"
@@ -69,10 +71,20 @@ class GcpMetadataQuery : public InternallyRefCounted<GcpMetadataQuery> {
 
   void Orphan() override;
 
+  // Returns the result of a previous query for the given attribute on
+  // the given metadata server, if one completed less than ttl ago.
+  // Every query populates the cache when it completes, including
+  // failures, since callers that would retry on failure should not
+  // hammer the metadata server once per channel.
+  static std::optional<absl::StatusOr<std::string>> GetFromCache(
+      absl::string_view metadata_server_name, absl::string_view attribute,
+      Duration ttl);
+
  private:
   static void OnDone(void* arg, grpc_error_handle error);
 
   grpc_closure on_done_;
+  std::string metadata_server_name_;
   std::string attribute_;
   absl::AnyInvocable<void(std::string /* attribute */,
                           absl::StatusOr<std::string> /* result */)>
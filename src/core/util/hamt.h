@@ -0,0 +1,462 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_UTIL_HAMT_H
+#define GRPC_SRC_CORE_UTIL_HAMT_H
+
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "absl/hash/hash.h"
+#include "absl/numeric/bits.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/useful.h"
+
+namespace grpc_core {
+
+// A persistent hash array mapped trie: the hash-based analogue of AVL<K, V>
+// (see avl.h). Add/Remove return a new HAMT that shares every untouched node
+// with the original; Lookup consumes the key's hash five bits per 32-way
+// branch level, so it touches a small constant number of nodes instead of an
+// O(log n) comparison chain.
+//
+// Keys are hashed with absl::Hash. Heterogeneous Lookup/Remove with a
+// SomethingLikeK requires that SomethingLikeK hash identically to K and
+// compare equal with operator==; absl guarantees matching hashes for
+// string-like types.
+//
+// Iteration: ForEach visits entries in trie (hash) order, which is
+// deterministic within a process but unrelated to key order; ForEachSorted
+// visits in key order at the cost of collecting and sorting the entries.
+// Comparisons (QsortCompare, operator==, operator<) use trie order, which is
+// a valid total order because equal contents always produce equal tries.
+template <class K, class V>
+class HAMT {
+ public:
+  HAMT() {}
+
+  HAMT Add(K key, V value) const {
+    const uint64_t hash = HashOf(key);
+    return HAMT(AddToNode(root_, 0, hash, std::move(key), std::move(value)));
+  }
+
+  template <typename SomethingLikeK>
+  HAMT Remove(const SomethingLikeK& key) const {
+    if (root_ == nullptr) return *this;
+    return HAMT(RemoveFromNode(root_, 0, HashOf(key), key));
+  }
+
+  template <typename SomethingLikeK>
+  const V* Lookup(const SomethingLikeK& key) const {
+    const Node* n = root_.get();
+    if (n == nullptr) return nullptr;
+    const uint64_t hash = HashOf(key);
+    int shift = 0;
+    while (n->kind == Kind::kBranch) {
+      const Branch* b = static_cast<const Branch*>(n);
+      const uint32_t bit = BitFor(hash, shift);
+      if ((b->bitmap & bit) == 0) return nullptr;
+      n = b->children[IndexOf(b->bitmap, bit)].get();
+      shift += kBitsPerLevel;
+    }
+    if (n->kind == Kind::kLeaf) {
+      const Leaf* leaf = static_cast<const Leaf*>(n);
+      if (leaf->hash == hash && leaf->kv.first == key) {
+        return &leaf->kv.second;
+      }
+      return nullptr;
+    }
+    const Collision* c = static_cast<const Collision*>(n);
+    if (c->hash != hash) return nullptr;
+    for (const auto& kv : c->entries) {
+      if (kv.first == key) return &kv.second;
+    }
+    return nullptr;
+  }
+
+  bool Empty() const { return root_ == nullptr; }
+
+  size_t Size() const { return root_ == nullptr ? 0 : root_->size; }
+
+  // Visits entries in trie (hash) order.
+  template <class F>
+  void ForEach(F&& f) const {
+    ForEachImpl(root_.get(), std::forward<F>(f));
+  }
+
+  // Visits entries in key order; costs a collection and sort per call, so
+  // keep it to paths where the ordering is observable.
+  template <class F>
+  void ForEachSorted(F&& f) const {
+    std::vector<const std::pair<K, V>*> entries;
+    entries.reserve(Size());
+    CollectEntries(root_.get(), entries);
+    std::sort(entries.begin(), entries.end(),
+              [](const std::pair<K, V>* a, const std::pair<K, V>* b) {
+                return a->first < b->first;
+              });
+    for (const std::pair<K, V>* kv : entries) {
+      f(kv->first, kv->second);
+    }
+  }
+
+  bool SameIdentity(const HAMT& other) const { return root_ == other.root_; }
+
+  friend int QsortCompare(const HAMT& left, const HAMT& right) {
+    if (left.root_.get() == right.root_.get()) return 0;
+    Iterator a(left.root_.get());
+    Iterator b(right.root_.get());
+    for (;;) {
+      const std::pair<K, V>* p = a.current();
+      const std::pair<K, V>* q = b.current();
+      if (p != q) {
+        if (p == nullptr) return -1;
+        if (q == nullptr) return 1;
+        const int kv = QsortCompare(*p, *q);
+        if (kv != 0) return kv;
+      } else if (p == nullptr) {
+        return 0;
+      }
+      a.MoveNext();
+      b.MoveNext();
+    }
+  }
+
+  bool operator==(const HAMT& other) const {
+    return QsortCompare(*this, other) == 0;
+  }
+
+  bool operator<(const HAMT& other) const {
+    return QsortCompare(*this, other) < 0;
+  }
+
+ private:
+  static constexpr int kBitsPerLevel = 5;
+  static constexpr uint32_t kLevelMask = (1u << kBitsPerLevel) - 1;
+
+  enum class Kind : uint8_t { kLeaf, kCollision, kBranch };
+
+  struct Node : public RefCounted<Node> {
+    Node(Kind kind, size_t size) : kind(kind), size(size) {}
+    const Kind kind;
+    // Number of entries in this subtree.
+    const size_t size;
+  };
+  using NodePtr = RefCountedPtr<Node>;
+
+  struct Leaf final : public Node {
+    Leaf(uint64_t hash, K key, V value)
+        : Node(Kind::kLeaf, 1),
+          hash(hash),
+          kv(std::move(key), std::move(value)) {}
+    const uint64_t hash;
+    const std::pair<K, V> kv;
+  };
+
+  struct Collision final : public Node {
+    Collision(uint64_t hash, std::vector<std::pair<K, V>> entries)
+        : Node(Kind::kCollision, entries.size()),
+          hash(hash),
+          entries(std::move(entries)) {}
+    const uint64_t hash;
+    const std::vector<std::pair<K, V>> entries;
+  };
+
+  struct Branch final : public Node {
+    Branch(uint32_t bitmap, std::vector<NodePtr> children, size_t size)
+        : Node(Kind::kBranch, size),
+          bitmap(bitmap),
+          children(std::move(children)) {}
+    const uint32_t bitmap;
+    const std::vector<NodePtr> children;
+  };
+
+  explicit HAMT(NodePtr root) : root_(std::move(root)) {}
+
+  template <typename SomethingLikeK>
+  static uint64_t HashOf(const SomethingLikeK& key) {
+    return absl::HashOf(key);
+  }
+
+  static uint32_t BitFor(uint64_t hash, int shift) {
+    return 1u << ((hash >> shift) & kLevelMask);
+  }
+
+  static size_t IndexOf(uint32_t bitmap, uint32_t bit) {
+    return absl::popcount(bitmap & (bit - 1));
+  }
+
+  // Hash of a leaf or collision node.
+  static uint64_t NodeHash(const NodePtr& n) {
+    return n->kind == Kind::kLeaf
+               ? static_cast<const Leaf*>(n.get())->hash
+               : static_cast<const Collision*>(n.get())->hash;
+  }
+
+  // Builds the branch (chain) distinguishing two leaf-or-collision nodes
+  // with different hashes. Terminates because two different 64-bit hashes
+  // differ in some five-bit chunk.
+  static NodePtr SplitBranch(int shift, NodePtr a, NodePtr b) {
+    const uint32_t abit = BitFor(NodeHash(a), shift);
+    const uint32_t bbit = BitFor(NodeHash(b), shift);
+    const size_t size = a->size + b->size;
+    std::vector<NodePtr> children;
+    if (abit == bbit) {
+      children.push_back(
+          SplitBranch(shift + kBitsPerLevel, std::move(a), std::move(b)));
+      return MakeRefCounted<Branch>(abit, std::move(children), size);
+    }
+    if (abit < bbit) {
+      children.push_back(std::move(a));
+      children.push_back(std::move(b));
+    } else {
+      children.push_back(std::move(b));
+      children.push_back(std::move(a));
+    }
+    return MakeRefCounted<Branch>(abit | bbit, std::move(children), size);
+  }
+
+  static NodePtr AddToNode(const NodePtr& node, int shift, uint64_t hash,
+                           K key, V value) {
+    if (node == nullptr) {
+      return MakeRefCounted<Leaf>(hash, std::move(key), std::move(value));
+    }
+    switch (node->kind) {
+      case Kind::kLeaf: {
+        const Leaf* leaf = static_cast<const Leaf*>(node.get());
+        if (leaf->hash != hash) {
+          return SplitBranch(
+              shift, node,
+              MakeRefCounted<Leaf>(hash, std::move(key), std::move(value)));
+        }
+        if (leaf->kv.first == key) {
+          return MakeRefCounted<Leaf>(hash, std::move(key), std::move(value));
+        }
+        std::vector<std::pair<K, V>> entries;
+        entries.push_back(leaf->kv);
+        entries.emplace_back(std::move(key), std::move(value));
+        return MakeRefCounted<Collision>(hash, std::move(entries));
+      }
+      case Kind::kCollision: {
+        const Collision* c = static_cast<const Collision*>(node.get());
+        if (c->hash != hash) {
+          return SplitBranch(
+              shift, node,
+              MakeRefCounted<Leaf>(hash, std::move(key), std::move(value)));
+        }
+        std::vector<std::pair<K, V>> entries = c->entries;
+        for (auto& kv : entries) {
+          if (kv.first == key) {
+            kv.second = std::move(value);
+            return MakeRefCounted<Collision>(hash, std::move(entries));
+          }
+        }
+        entries.emplace_back(std::move(key), std::move(value));
+        return MakeRefCounted<Collision>(hash, std::move(entries));
+      }
+      case Kind::kBranch: {
+        const Branch* b = static_cast<const Branch*>(node.get());
+        const uint32_t bit = BitFor(hash, shift);
+        const size_t index = IndexOf(b->bitmap, bit);
+        std::vector<NodePtr> children = b->children;
+        if ((b->bitmap & bit) == 0) {
+          children.insert(
+              children.begin() + index,
+              MakeRefCounted<Leaf>(hash, std::move(key), std::move(value)));
+          return MakeRefCounted<Branch>(b->bitmap | bit, std::move(children),
+                                        b->size + 1);
+        }
+        NodePtr replaced = AddToNode(children[index], shift + kBitsPerLevel,
+                                     hash, std::move(key), std::move(value));
+        const size_t new_size =
+            b->size + replaced->size - children[index]->size;
+        children[index] = std::move(replaced);
+        return MakeRefCounted<Branch>(b->bitmap, std::move(children),
+                                      new_size);
+      }
+    }
+    GPR_UNREACHABLE_CODE(return nullptr);
+  }
+
+  // Returns `node` itself (same identity) if the key is absent.
+  template <typename SomethingLikeK>
+  static NodePtr RemoveFromNode(const NodePtr& node, int shift, uint64_t hash,
+                                const SomethingLikeK& key) {
+    switch (node->kind) {
+      case Kind::kLeaf: {
+        const Leaf* leaf = static_cast<const Leaf*>(node.get());
+        if (leaf->hash == hash && leaf->kv.first == key) return nullptr;
+        return node;
+      }
+      case Kind::kCollision: {
+        const Collision* c = static_cast<const Collision*>(node.get());
+        if (c->hash != hash) return node;
+        for (size_t i = 0; i < c->entries.size(); ++i) {
+          if (c->entries[i].first == key) {
+            if (c->entries.size() == 2) {
+              const std::pair<K, V>& kv = c->entries[1 - i];
+              return MakeRefCounted<Leaf>(hash, kv.first, kv.second);
+            }
+            std::vector<std::pair<K, V>> entries = c->entries;
+            entries.erase(entries.begin() + i);
+            return MakeRefCounted<Collision>(hash, std::move(entries));
+          }
+        }
+        return node;
+      }
+      case Kind::kBranch: {
+        const Branch* b = static_cast<const Branch*>(node.get());
+        const uint32_t bit = BitFor(hash, shift);
+        if ((b->bitmap & bit) == 0) return node;
+        const size_t index = IndexOf(b->bitmap, bit);
+        NodePtr child =
+            RemoveFromNode(b->children[index], shift + kBitsPerLevel, hash,
+                           key);
+        if (child == b->children[index]) return node;
+        if (child == nullptr) {
+          if (b->children.size() == 1) return nullptr;
+          if (b->children.size() == 2 &&
+              b->children[1 - index]->kind != Kind::kBranch) {
+            // Collapse the lone remaining leaf/collision into the parent:
+            // it stores its full hash, so it resolves correctly at any
+            // depth, and the collapse keeps lookups shallow.
+            return b->children[1 - index];
+          }
+          std::vector<NodePtr> children = b->children;
+          children.erase(children.begin() + index);
+          return MakeRefCounted<Branch>(b->bitmap & ~bit,
+                                        std::move(children), b->size - 1);
+        }
+        std::vector<NodePtr> children = b->children;
+        const size_t new_size = b->size + child->size - children[index]->size;
+        if (children.size() == 1 && child->kind != Kind::kBranch) {
+          return child;
+        }
+        children[index] = std::move(child);
+        return MakeRefCounted<Branch>(b->bitmap, std::move(children),
+                                      new_size);
+      }
+    }
+    GPR_UNREACHABLE_CODE(return nullptr);
+  }
+
+  template <class F>
+  static void ForEachImpl(const Node* n, F&& f) {
+    if (n == nullptr) return;
+    switch (n->kind) {
+      case Kind::kLeaf: {
+        const Leaf* leaf = static_cast<const Leaf*>(n);
+        f(leaf->kv.first, leaf->kv.second);
+        return;
+      }
+      case Kind::kCollision: {
+        const Collision* c = static_cast<const Collision*>(n);
+        for (const auto& kv : c->entries) f(kv.first, kv.second);
+        return;
+      }
+      case Kind::kBranch: {
+        const Branch* b = static_cast<const Branch*>(n);
+        for (const NodePtr& child : b->children) {
+          ForEachImpl(child.get(), f);
+        }
+        return;
+      }
+    }
+  }
+
+  static void CollectEntries(const Node* n,
+                             std::vector<const std::pair<K, V>*>& entries) {
+    if (n == nullptr) return;
+    switch (n->kind) {
+      case Kind::kLeaf:
+        entries.push_back(&static_cast<const Leaf*>(n)->kv);
+        return;
+      case Kind::kCollision:
+        for (const auto& kv : static_cast<const Collision*>(n)->entries) {
+          entries.push_back(&kv);
+        }
+        return;
+      case Kind::kBranch:
+        for (const NodePtr& child : static_cast<const Branch*>(n)->children) {
+          CollectEntries(child.get(), entries);
+        }
+        return;
+    }
+  }
+
+  // Trie-order iterator over entries; the explicit stack mirrors the AVL
+  // iterator. 64 hash bits over five-bit levels bound the branch depth at
+  // 13, plus one frame for the terminal leaf/collision node.
+  class Iterator {
+   public:
+    explicit Iterator(const Node* root) {
+      if (root != nullptr) Descend(root);
+    }
+
+    const std::pair<K, V>* current() const {
+      if (depth_ == 0) return nullptr;
+      const Frame& frame = frames_[depth_ - 1];
+      if (frame.node->kind == Kind::kLeaf) {
+        return &static_cast<const Leaf*>(frame.node)->kv;
+      }
+      return &static_cast<const Collision*>(frame.node)->entries[frame.index];
+    }
+
+    void MoveNext() {
+      Frame& top = frames_[depth_ - 1];
+      if (top.node->kind == Kind::kCollision) {
+        const Collision* c = static_cast<const Collision*>(top.node);
+        if (++top.index < c->entries.size()) return;
+      }
+      --depth_;
+      while (depth_ > 0) {
+        Frame& frame = frames_[depth_ - 1];
+        const Branch* b = static_cast<const Branch*>(frame.node);
+        if (++frame.index < b->children.size()) {
+          Descend(b->children[frame.index].get());
+          return;
+        }
+        --depth_;
+      }
+    }
+
+   private:
+    struct Frame {
+      const Node* node;
+      size_t index;
+    };
+
+    void Descend(const Node* n) {
+      while (n->kind == Kind::kBranch) {
+        frames_[depth_++] = {n, 0};
+        n = static_cast<const Branch*>(n)->children[0].get();
+      }
+      frames_[depth_++] = {n, 0};
+    }
+
+    Frame frames_[16];
+    size_t depth_ = 0;
+  };
+
+  NodePtr root_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_UTIL_HAMT_H
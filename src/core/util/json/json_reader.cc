@@ -18,6 +18,7 @@
 #include <grpc/support/port_platform.h>
 #include <inttypes.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <algorithm>
 #include <map>
@@ -121,6 +122,7 @@ class JsonReader {
 
   Status Run();
   uint32_t ReadChar();
+  void ConsumePlainStringChars();
   bool IsComplete();
 
   size_t CurrentIndex() const { return input_ - original_input_ - 1; }
@@ -249,6 +251,55 @@ uint32_t JsonReader::ReadChar() {
   return r;
 }
 
+namespace {
+
+constexpr uint64_t kEachByte = 0x0101010101010101u;
+constexpr uint64_t kHighBits = 0x8080808080808080u;
+
+// Returns non-zero if any byte of the word is zero.
+constexpr uint64_t AnyByteZero(uint64_t w) {
+  return (w - kEachByte) & ~w & kHighBits;
+}
+
+// Returns non-zero if any byte of the word needs the state machine:
+// a quote, a backslash, a control character, or a non-ASCII byte.
+constexpr uint64_t AnyByteSpecial(uint64_t w) {
+  return (w & kHighBits) |                                // >= 0x80
+         ((w - (0x20 * kEachByte)) & ~w & kHighBits) |    // < 0x20
+         AnyByteZero(w ^ (0x22 * kEachByte)) |            // '"'
+         AnyByteZero(w ^ (0x5c * kEachByte));             // '\\'
+}
+
+}  // namespace
+
+// Bulk-consumes a run of plain string characters -- printable ASCII
+// other than quote and backslash -- appending them to string_ in one
+// shot.  Scans a word at a time, falling back to the byte-by-byte state
+// machine at the first character that needs it.  This is the hot loop
+// when parsing large configs, which are mostly long unescaped strings.
+void JsonReader::ConsumePlainStringChars() {
+  const uint8_t* p = input_;
+  size_t n = remaining_input_;
+  while (n >= sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, p, sizeof(uint64_t));
+    if (AnyByteSpecial(word) != 0) break;
+    p += sizeof(uint64_t);
+    n -= sizeof(uint64_t);
+  }
+  while (n > 0) {
+    const uint8_t c = *p;
+    if (c < 0x20 || c >= 0x80 || c == '"' || c == '\\') break;
+    ++p;
+    --n;
+  }
+  if (p != input_) {
+    string_.append(reinterpret_cast<const char*>(input_), p - input_);
+    input_ = p;
+    remaining_input_ = n;
+  }
+}
+
 Json* JsonReader::CreateAndLinkValue() {
   if (stack_.empty()) return &root_value_;
   return MatchMutable(
@@ -351,6 +402,14 @@ JsonReader::Status JsonReader::Run() {
 
   // This state-machine is a strict implementation of ECMA-404
   while (true) {
+    // In the middle of a string, with no UTF-8 sequence or surrogate
+    // pair pending, consume plain characters in bulk; the state machine
+    // then only sees the characters that actually change state.
+    if ((state_ == State::GRPC_JSON_STATE_OBJECT_KEY_STRING ||
+         state_ == State::GRPC_JSON_STATE_VALUE_STRING) &&
+        utf8_bytes_remaining_ == 0 && unicode_high_surrogate_ == 0) {
+      ConsumePlainStringChars();
+    }
     c = ReadChar();
     switch (c) {
       // Let's process the error case first.
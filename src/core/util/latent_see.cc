@@ -39,25 +39,97 @@ std::atomic<uintptr_t> Log::free_bins_{0};
 const std::chrono::steady_clock::time_point start_time =
     std::chrono::steady_clock::now();
 
+namespace {
+
+// Serialize one event as a Chrome trace format JSON object. With
+// `absolute_timestamps` set the "ts" field is steady_clock (CLOCK_MONOTONIC
+// on Linux) time since epoch, letting the trace be merged with a system
+// tracing session on the same clock; otherwise it is relative to process
+// start, as Dump() has always written it.
+void AppendEventJson(const Log::RecordedEvent& event, bool absolute_timestamps,
+                     bool* first, std::string* json) {
+  using Nanos = std::chrono::duration<unsigned long long, std::nano>;
+  absl::string_view phase;
+  bool has_id;
+  switch (event.event.type) {
+    case EventType::kBegin:
+      phase = "B";
+      has_id = false;
+      break;
+    case EventType::kEnd:
+      phase = "E";
+      has_id = false;
+      break;
+    case EventType::kFlowStart:
+      phase = "s";
+      has_id = true;
+      break;
+    case EventType::kFlowEnd:
+      phase = "f";
+      has_id = true;
+      break;
+    case EventType::kMark:
+      phase = "i";
+      has_id = false;
+      break;
+  }
+  if (!*first) {
+    absl::StrAppend(json, ",\n");
+  }
+  *first = false;
+  std::string ts;
+  if (absolute_timestamps) {
+    // %.3f rather than %.12g: absolute microsecond values are large enough
+    // that %.12g would round away sub-microsecond detail.
+    ts = absl::StrFormat(
+        "%.3f",
+        Nanos(event.event.timestamp.time_since_epoch()).count() / 1000.0);
+  } else {
+    ts = absl::StrFormat(
+        "%.12g", Nanos(event.event.timestamp - start_time).count() / 1000.0);
+  }
+  if (event.event.metadata->name[0] != '"') {
+    absl::StrAppend(json, "{\"name\": \"", event.event.metadata->name,
+                    "\", \"ph\": \"", phase, "\", \"ts\": ", ts,
+                    ", \"pid\": 0, \"tid\": ", event.thread_id);
+  } else {
+    absl::StrAppend(json, "{\"name\": ", event.event.metadata->name,
+                    ", \"ph\": \"", phase, "\", \"ts\": ", ts,
+                    ", \"pid\": 0, \"tid\": ", event.thread_id);
+  }
+  if (has_id) {
+    absl::StrAppend(json, ", \"id\": ", event.event.id);
+  }
+  if (event.event.type == EventType::kFlowEnd) {
+    absl::StrAppend(json, ", \"bp\": \"e\"");
+  }
+  absl::StrAppend(json, ", \"args\": {\"file\": \"", event.event.metadata->file,
+                  "\", \"line\": ", event.event.metadata->line,
+                  ", \"batch\": ", event.batch_id, "}}");
+}
+
+}  // namespace
+
+void Log::Dump() {
+  auto json = TryGenerateJson();
+  if (!json.has_value()) {
+    LOG(INFO) << "Failed to generate latent_see.json (contention with "
+                 "another writer)";
+    return;
+  }
+  if (stats_flusher_ != nullptr) {
+    stats_flusher_(*json);
+    return;
+  }
+  LOG(INFO) << "Writing latent_see.json in " << get_current_dir_name();
+  FILE* f = fopen("latent_see.json", "w");
+  if (f == nullptr) return;
+  fprintf(f, "%s", json->c_str());
+  fclose(f);
+}
+
 void Log::InstallAtExitHandler() {
-  atexit([] {
-    auto& log = Log::Get();
-    auto json = log.TryGenerateJson();
-    if (!json.has_value()) {
-      LOG(INFO) << "Failed to generate latent_see.json (contention with "
-                   "another writer)";
-      return;
-    }
-    if (log.stats_flusher_ != nullptr) {
-      log.stats_flusher_(*json);
-      return;
-    }
-    LOG(INFO) << "Writing latent_see.json in " << get_current_dir_name();
-    FILE* f = fopen("latent_see.json", "w");
-    if (f == nullptr) return;
-    fprintf(f, "%s", json->c_str());
-    fclose(f);
-  });
+  atexit([] { Log::Get().Dump(); });
 }
 
 void Log::TryPullEventsAndFlush(
@@ -69,6 +141,7 @@ void Log::TryPullEventsAndFlush(
     for (auto& fragment : fragments_) {
       MutexLock lock(&fragment.mu_active);
       fragment.active.clear();
+      fragment.ring_next = 0;
     }
     return;
   }
@@ -79,6 +152,7 @@ void Log::TryPullEventsAndFlush(
     CHECK_EQ(fragment.flushing.size(), 0);
     MutexLock lock(&fragment.mu_active);
     fragment.flushing.swap(fragment.active);
+    fragment.ring_next = 0;
   }
   // Now we've swapped out, call the callback repeatedly with each fragment.
   // This is the slow part - there's a lot of copying and transformation that
@@ -98,69 +172,13 @@ void Log::TryPullEventsAndFlush(
 }
 
 std::optional<std::string> Log::TryGenerateJson() {
-  using Nanos = std::chrono::duration<unsigned long long, std::nano>;
   std::string json = "[\n";
   bool first = true;
   int callbacks = 0;
   TryPullEventsAndFlush([&](absl::Span<const RecordedEvent> events) {
     ++callbacks;
     for (const auto& event : events) {
-      absl::string_view phase;
-      bool has_id;
-      switch (event.event.type) {
-        case EventType::kBegin:
-          phase = "B";
-          has_id = false;
-          break;
-        case EventType::kEnd:
-          phase = "E";
-          has_id = false;
-          break;
-        case EventType::kFlowStart:
-          phase = "s";
-          has_id = true;
-          break;
-        case EventType::kFlowEnd:
-          phase = "f";
-          has_id = true;
-          break;
-        case EventType::kMark:
-          phase = "i";
-          has_id = false;
-          break;
-      }
-      if (!first) {
-        absl::StrAppend(&json, ",\n");
-      }
-      first = false;
-      if (event.event.metadata->name[0] != '"') {
-        absl::StrAppend(
-            &json, "{\"name\": \"", event.event.metadata->name,
-            "\", \"ph\": \"", phase, "\", \"ts\": ",
-            absl::StrFormat(
-                "%.12g",
-                Nanos(event.event.timestamp - start_time).count() / 1000.0),
-            ", \"pid\": 0, \"tid\": ", event.thread_id);
-      } else {
-        absl::StrAppend(
-            &json, "{\"name\": ", event.event.metadata->name, ", \"ph\": \"",
-            phase, "\", \"ts\": ",
-            absl::StrFormat(
-                "%.12g",
-                Nanos(event.event.timestamp - start_time).count() / 1000.0),
-            ", \"pid\": 0, \"tid\": ", event.thread_id);
-      }
-
-      if (has_id) {
-        absl::StrAppend(&json, ", \"id\": ", event.event.id);
-      }
-      if (event.event.type == EventType::kFlowEnd) {
-        absl::StrAppend(&json, ", \"bp\": \"e\"");
-      }
-      absl::StrAppend(&json, ", \"args\": {\"file\": \"",
-                      event.event.metadata->file,
-                      "\", \"line\": ", event.event.metadata->line,
-                      ", \"batch\": ", event.batch_id, "}}");
+      AppendEventJson(event, /*absolute_timestamps=*/false, &first, &json);
     }
   });
   if (callbacks == 0) return std::nullopt;
@@ -168,6 +186,64 @@ std::optional<std::string> Log::TryGenerateJson() {
   return json;
 }
 
+bool Log::StartStreaming(const char* path, std::chrono::milliseconds interval) {
+  MutexLock lock(&mu_streaming_);
+  if (streaming_active_) return false;
+  FILE* f = fopen(path, "w");
+  if (f == nullptr) return false;
+  fputs("[\n", f);
+  streaming_file_ = f;
+  streaming_first_event_ = true;
+  streaming_stop_requested_ = false;
+  streaming_active_ = true;
+  streaming_thread_ = Thread("latent_see_stream",
+                             [this, interval]() { StreamingLoop(interval); });
+  streaming_thread_.Start();
+  return true;
+}
+
+void Log::StopStreaming() {
+  {
+    MutexLock lock(&mu_streaming_);
+    if (!streaming_active_) return;
+    streaming_stop_requested_ = true;
+    cv_streaming_.Signal();
+  }
+  streaming_thread_.Join();
+  MutexLock lock(&mu_streaming_);
+  streaming_active_ = false;
+}
+
+void Log::StreamingLoop(std::chrono::milliseconds interval) {
+  bool done = false;
+  while (!done) {
+    {
+      MutexLock lock(&mu_streaming_);
+      if (!streaming_stop_requested_) {
+        cv_streaming_.WaitWithTimeout(&mu_streaming_,
+                                      absl::Milliseconds(interval.count()));
+      }
+      done = streaming_stop_requested_;
+    }
+    std::string chunk;
+    TryPullEventsAndFlush([&](absl::Span<const RecordedEvent> events) {
+      for (const auto& event : events) {
+        AppendEventJson(event, /*absolute_timestamps=*/true,
+                        &streaming_first_event_, &chunk);
+      }
+    });
+    if (!chunk.empty()) {
+      fwrite(chunk.data(), 1, chunk.size(), streaming_file_);
+      // Flush per interval so the trace on disk is complete up to the last
+      // pull even if the process dies; the array is deliberately left
+      // unterminated, which trace viewers accept.
+      fflush(streaming_file_);
+    }
+  }
+  fclose(streaming_file_);
+  streaming_file_ = nullptr;
+}
+
 void Log::FlushBin(Bin* bin) {
   if (bin->events.empty()) return;
   auto& log = Get();
@@ -175,10 +251,22 @@ void Log::FlushBin(Bin* bin) {
       log.next_batch_id_.fetch_add(1, std::memory_order_relaxed);
   auto& fragment = log.fragments_.this_cpu();
   const auto thread_id = thread_id_;
+  const size_t max_events =
+      log.max_events_per_cpu_.load(std::memory_order_relaxed);
   {
     MutexLock lock(&fragment.mu_active);
     for (auto event : bin->events) {
-      fragment.active.push_back(RecordedEvent{thread_id, batch_id, event});
+      if (max_events == 0 || fragment.active.size() < max_events) {
+        fragment.active.push_back(RecordedEvent{thread_id, batch_id, event});
+      } else {
+        // Flight recorder mode: overwrite the oldest slot. Events carry their
+        // own timestamps so trace viewers are indifferent to the rotation.
+        if (fragment.ring_next >= fragment.active.size()) {
+          fragment.ring_next = 0;
+        }
+        fragment.active[fragment.ring_next++] =
+            RecordedEvent{thread_id, batch_id, event};
+      }
     }
   }
   bin->events.clear();
@@ -38,6 +38,7 @@
 #include "absl/strings/string_view.h"
 #include "src/core/util/per_cpu.h"
 #include "src/core/util/sync.h"
+#include "src/core/util/thd.h"
 
 #define TAGGED_POINTER_SIZE_BITS 48
 
@@ -132,14 +133,45 @@ class Log {
     stats_flusher_ = std::move(stats_exporter);
   }
 
+  // Flight recorder mode: bound the number of events retained per cpu
+  // fragment, overwriting the oldest once the bound is reached. With a bound
+  // in place collection never allocates beyond it, so latent_see can be left
+  // enabled in production and Dump() called from a trigger (say a
+  // deadline-exceeded hook) to capture what led up to the violation.
+  // 0 (the default) retains everything until the next flush.
+  void SetMaxEventsPerCpu(size_t max_events) {
+    max_events_per_cpu_.store(max_events, std::memory_order_relaxed);
+  }
+
+  // Export everything recorded so far: hand the JSON trace to the installed
+  // stats flusher, or failing that write latent_see.json in the working
+  // directory.
+  void Dump();
+
   // Install an atexit callback that will log to latent_see.json in the working
   // directory
   static void InstallAtExitHandler();
 
+  // Streaming mode: a background thread pulls recorded events every
+  // `interval` and appends them to `path` as Chrome trace format JSON (which
+  // Perfetto's trace processor also ingests). Unlike Dump() the array is
+  // written incrementally and left unterminated - explicitly permitted by the
+  // format - so the trace survives a crash mid-run and memory is reclaimed
+  // every interval instead of accumulating until a one-shot export. Streamed
+  // timestamps are absolute CLOCK_MONOTONIC microseconds rather than
+  // process-relative, so the file shares a clock domain with a concurrent
+  // system tracing session (perfetto, ftrace) and the two can be merged
+  // without manual timeline alignment.
+  // Returns false if streaming is already active or `path` cannot be opened.
+  bool StartStreaming(const char* path, std::chrono::milliseconds interval);
+  // Stop the streaming thread after one final pull, and close the file.
+  void StopStreaming();
+
  private:
   Log() = default;
 
   static void FlushBin(Bin* bin);
+  void StreamingLoop(std::chrono::milliseconds interval);
 
   std::atomic<uint64_t> next_thread_id_{1};
   std::atomic<uint64_t> next_batch_id_{1};
@@ -152,9 +184,20 @@ class Log {
   struct Fragment {
     Mutex mu_active ABSL_ACQUIRED_AFTER(mu_flushing_);
     std::vector<RecordedEvent> active ABSL_GUARDED_BY(mu_active);
+    // Next slot to overwrite once active is full (flight recorder mode only).
+    size_t ring_next ABSL_GUARDED_BY(mu_active) = 0;
     std::vector<RecordedEvent> flushing ABSL_GUARDED_BY(&Log::mu_flushing_);
   };
   PerCpu<Fragment> fragments_{PerCpuOptions()};
+  std::atomic<size_t> max_events_per_cpu_{0};
+  Mutex mu_streaming_;
+  CondVar cv_streaming_;
+  bool streaming_active_ ABSL_GUARDED_BY(mu_streaming_) = false;
+  bool streaming_stop_requested_ ABSL_GUARDED_BY(mu_streaming_) = false;
+  Thread streaming_thread_;
+  // Owned by StartStreaming/StopStreaming; written only by streaming_thread_.
+  FILE* streaming_file_ = nullptr;
+  bool streaming_first_event_ = true;
 };
 
 template <bool kParent>
@@ -17,14 +17,19 @@
 #ifndef GRPC_SRC_CORE_UTIL_LRU_CACHE_H
 #define GRPC_SRC_CORE_UTIL_LRU_CACHE_H
 
+#include <algorithm>
+#include <array>
 #include <list>
 #include <optional>
 #include <tuple>
 #include <utility>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_map.h"
 #include "absl/functional/any_invocable.h"
+#include "absl/hash/hash.h"
 #include "absl/log/check.h"
+#include "src/core/util/sync.h"
 
 namespace grpc_core {
 
@@ -67,6 +72,70 @@ class LruCache {
   std::list<Key> lru_list_;
 };
 
+// A thread-safe sharded LRU cache with the same API as LruCache.
+// Keys are hashed to one of a fixed number of shards, each guarded by its
+// own mutex and keeping its own LRU list, so concurrent lookups of
+// different keys mostly do not serialize. Eviction is least-recently-used
+// within each shard, which approximates global LRU; the max size is split
+// evenly across shards, so a shard may evict while the cache as a whole is
+// slightly under max_size.
+template <typename Key, typename Value>
+class ShardedLruCache {
+ public:
+  explicit ShardedLruCache(size_t max_size) {
+    CHECK_GT(max_size, 0UL);
+    for (auto& shard : shards_) {
+      shard.cache.emplace(PerShardSize(max_size));
+    }
+  }
+
+  // Returns the value for key, or nullopt if not present.
+  std::optional<Value> Get(Key key) {
+    Shard& shard = ShardForKey(key);
+    MutexLock lock(&shard.mu);
+    return shard.cache->Get(std::move(key));
+  }
+
+  // If key is present in the cache, returns the corresponding value.
+  // Otherwise, inserts a new entry in the map, calling create() to
+  // construct the new value.  Note that create() runs under the shard's
+  // mutex, blocking other lookups of keys in the same shard.
+  Value GetOrInsert(Key key, absl::AnyInvocable<Value(const Key&)> create) {
+    Shard& shard = ShardForKey(key);
+    MutexLock lock(&shard.mu);
+    return shard.cache->GetOrInsert(std::move(key), std::move(create));
+  }
+
+  // Changes the max size of the cache, evicting least-recently-used
+  // entries per shard as needed to enforce the new size.
+  void SetMaxSize(size_t max_size) {
+    CHECK_GT(max_size, 0UL);
+    const size_t per_shard_size = PerShardSize(max_size);
+    for (auto& shard : shards_) {
+      MutexLock lock(&shard.mu);
+      shard.cache->SetMaxSize(per_shard_size);
+    }
+  }
+
+ private:
+  static constexpr size_t kNumShards = 16;
+
+  struct Shard {
+    Mutex mu;
+    std::optional<LruCache<Key, Value>> cache ABSL_GUARDED_BY(mu);
+  };
+
+  static size_t PerShardSize(size_t max_size) {
+    return std::max<size_t>(1, (max_size + kNumShards - 1) / kNumShards);
+  }
+
+  Shard& ShardForKey(const Key& key) {
+    return shards_[absl::Hash<Key>()(key) % kNumShards];
+  }
+
+  std::array<Shard, kNumShards> shards_;
+};
+
 //
 // implementation -- no user-serviceable parts below
 //
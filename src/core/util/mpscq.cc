@@ -76,6 +76,27 @@ MultiProducerSingleConsumerQueue::PopAndCheckEnd(bool* empty) {
   return nullptr;
 }
 
+MultiProducerSingleConsumerQueue::Node*
+MultiProducerSingleConsumerQueue::PopAll() {
+  Node* head = nullptr;
+  Node* tail = nullptr;
+  bool empty = false;
+  // Draining through PopAndCheckEnd is cheap: mid-chain pops are plain loads,
+  // and only the final element involves an atomic exchange (to re-insert the
+  // stub). Relink the popped nodes into a FIFO chain as we go; the nodes are
+  // exclusively ours once popped, so their next pointers are free to reuse.
+  while (Node* node = PopAndCheckEnd(&empty)) {
+    node->next.store(nullptr, std::memory_order_relaxed);
+    if (tail == nullptr) {
+      head = node;
+    } else {
+      tail->next.store(node, std::memory_order_relaxed);
+    }
+    tail = node;
+  }
+  return head;
+}
+
 //
 // LockedMultiProducerSingleConsumerQueue
 //
@@ -56,6 +56,12 @@ class MultiProducerSingleConsumerQueue {
   // Pop a node; sets *empty to true if the queue is empty, or false if it is
   // not.
   Node* PopAndCheckEnd(bool* empty);
+  // Pop every node that is ready in one call. Returns the head of an
+  // intrusive FIFO list linked through Node::next and terminated by nullptr,
+  // or nullptr if no node was ready. As with Pop(), nodes whose Push is still
+  // in flight may be missed and picked up by a later call.
+  // Thread compatible - can only be called from one thread at a time
+  Node* PopAll();
 
  private:
   // make sure head & tail don't share a cacheline
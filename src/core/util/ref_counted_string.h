@@ -21,6 +21,7 @@
 #include <stddef.h>
 
 #include <string>
+#include <utility>
 
 #include "absl/strings/string_view.h"
 #include "src/core/util/ref_counted.h"
@@ -89,6 +90,13 @@ class RefCountedStringValue {
   RefCountedPtr<RefCountedString> str_;
 };
 
+// Hashes as the underlying string so heterogeneous hash lookups with
+// absl::string_view land on the same value.
+template <typename H>
+H AbslHashValue(H h, const RefCountedStringValue& value) {
+  return H::combine(std::move(h), value.as_string_view());
+}
+
 inline bool operator==(const RefCountedStringValue& lhs,
                        absl::string_view rhs) {
   return lhs.as_string_view() == rhs;
@@ -0,0 +1,123 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_UTIL_STRUCTURED_EVENT_LOG_H
+#define GRPC_SRC_CORE_UTIL_STRUCTURED_EVENT_LOG_H
+
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <type_traits>
+#include <vector>
+
+#include "src/core/util/per_cpu.h"
+#include "src/core/util/time_precise.h"
+
+namespace grpc_core {
+
+// Debug utility to capture fixed-layout structured events on hot paths with
+// zero allocation and no locks.
+// Where EventLog collects named int64 counters, this collects typed records
+// (Record must be trivially copyable) into per-cpu rings of preallocated
+// slots. An append claims a slot with one relaxed fetch_add, copies the
+// record in, and publishes it with a single release store; once the ring
+// wraps the oldest records are overwritten, so a collector left enabled
+// retains the most recent events per cpu at a fixed memory cost.
+// Collection is seqlock-style: records overwritten while Collect() runs are
+// dropped rather than returned torn.
+template <typename Record, size_t kSlotsPerShard = 4096>
+class StructuredEventLog {
+ public:
+  static_assert(std::is_trivially_copyable<Record>::value,
+                "records must be fixed-layout and trivially copyable");
+
+  struct TimestampedRecord {
+    gpr_cycle_counter when;
+    Record record;
+  };
+
+  // Cheap enough to leave in hot paths permanently: while disabled an append
+  // is one relaxed load.
+  bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  void Append(const Record& record) {
+    if (!enabled()) return;
+    auto& shard = shards_.this_cpu();
+    // Tickets increase monotonically per shard, so a slot's sequence is
+    // unique across ring generations - Collect() relies on this to detect
+    // overwrites.
+    const uint64_t ticket =
+        shard.next_ticket.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = shard.slots[ticket % kSlotsPerShard];
+    slot.sequence.store(0, std::memory_order_relaxed);
+    slot.value.when = gpr_get_cycle_counter();
+    slot.value.record = record;
+    // The single fence: publishing the sequence releases the copied record.
+    slot.sequence.store(ticket + 1, std::memory_order_release);
+  }
+
+  void Enable() {
+    for (auto& shard : shards_) {
+      for (auto& slot : shard.slots) {
+        slot.sequence.store(0, std::memory_order_relaxed);
+      }
+      shard.next_ticket.store(0, std::memory_order_relaxed);
+    }
+    enabled_.store(true, std::memory_order_release);
+  }
+
+  void Disable() { enabled_.store(false, std::memory_order_relaxed); }
+
+  // Returns the captured records ordered by timestamp. Safe to call while
+  // appends continue; records overwritten mid-copy are skipped.
+  std::vector<TimestampedRecord> Collect() const {
+    std::vector<TimestampedRecord> result;
+    for (const auto& shard : shards_) {
+      for (const auto& slot : shard.slots) {
+        const uint64_t seq = slot.sequence.load(std::memory_order_acquire);
+        if (seq == 0) continue;
+        TimestampedRecord copy = slot.value;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != seq) continue;
+        result.push_back(copy);
+      }
+    }
+    std::stable_sort(result.begin(), result.end(),
+                     [](const TimestampedRecord& a, const TimestampedRecord& b) {
+                       return a.when < b.when;
+                     });
+    return result;
+  }
+
+ private:
+  struct Slot {
+    // 0 = empty or mid-write; ticket+1 once the record below is published.
+    std::atomic<uint64_t> sequence{0};
+    TimestampedRecord value;
+  };
+
+  struct Shard {
+    std::atomic<uint64_t> next_ticket{0};
+    std::vector<Slot> slots{kSlotsPerShard};
+  };
+
+  std::atomic<bool> enabled_{false};
+  PerCpu<Shard> shards_{PerCpuOptions().SetCpusPerShard(2)};
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_UTIL_STRUCTURED_EVENT_LOG_H
@@ -31,6 +31,7 @@
 #include "absl/container/inlined_vector.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
@@ -94,6 +95,13 @@ class WorkSerializer::WorkSerializerImpl
   enum class RefillResult { kRefilled, kFinished, kFinishedAndOrphaned };
   RefillResult RefillInner();
 
+  // Spin briefly (bounded by GRPC_WORK_SERIALIZER_SPIN_USEC) waiting for the
+  // current owner to go idle, so that a caller that lost the ownership race
+  // can run its callback inline instead of queueing it behind a thread hop
+  // through EventEngine. Returns true if the serializer went idle within the
+  // spin budget; drops and reacquires mu_ whilst spinning.
+  bool SpinUntilIdle() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
 #ifndef NDEBUG
   void SetCurrentThread() { running_work_serializer_ = this; }
   void ClearCurrentThread() { running_work_serializer_ = nullptr; }
@@ -167,7 +175,11 @@ void WorkSerializer::WorkSerializerImpl::Run(
       << "WorkSerializer[" << this << "] Scheduling callback ["
       << location.file() << ":" << location.line() << "]";
   global_stats().IncrementWorkSerializerItemsEnqueued();
-  MutexLock lock(&mu_);
+  ReleasableMutexLock lock(&mu_);
+  // If we lost the ownership race, optionally spin waiting for the owner to
+  // go idle: winning the spin lets us run the callback inline on this thread
+  // instead of queueing it behind a thread hop through EventEngine.
+  const bool run_inline = running_ && SpinUntilIdle();
   if (!running_) {
     // If we were previously idle, insert this callback directly into the
     // empty processing_ list and start running.
@@ -177,7 +189,12 @@ void WorkSerializer::WorkSerializerImpl::Run(
     time_running_items_ = std::chrono::steady_clock::duration();
     CHECK(processing_.empty());
     processing_.emplace_back(std::move(callback), location);
-    event_engine_->Run(this);
+    if (run_inline) {
+      lock.Release();
+      Run();
+    } else {
+      event_engine_->Run(this);
+    }
   } else {
     // We are already running, so add this callback to the incoming_ list.
     // The work loop will eventually get to it.
@@ -185,6 +202,20 @@ void WorkSerializer::WorkSerializerImpl::Run(
   }
 }
 
+bool WorkSerializer::WorkSerializerImpl::SpinUntilIdle() {
+  const int32_t spin_usec = ConfigVars::Get().WorkSerializerSpinUsec();
+  if (spin_usec <= 0) return false;
+  const auto give_up =
+      std::chrono::steady_clock::now() + std::chrono::microseconds(spin_usec);
+  do {
+    mu_.Unlock();
+    std::this_thread::yield();
+    mu_.Lock();
+    if (!running_) return true;
+  } while (std::chrono::steady_clock::now() < give_up);
+  return false;
+}
+
 // Implementation of EventEngine::Closure::Run - our actual work loop
 void WorkSerializer::WorkSerializerImpl::Run() {
   GRPC_LATENT_SEE_PARENT_SCOPE("WorkSerializer::Run");
@@ -18,8 +18,10 @@
 
 #include <vector>
 
+#include "absl/random/random.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
+#include "src/core/util/shared_bit_gen.h"
 
 namespace grpc_core {
 
@@ -60,8 +62,8 @@ bool XdsEndpointResource::DropConfig::ShouldDrop(
   for (const auto& drop_category : drop_category_list_) {
     // Generate a random number in [0, 1000000).
     const uint32_t random = [&]() {
-      MutexLock lock(&mu_);
-      return absl::Uniform<uint32_t>(bit_gen_, 0, 1000000);
+      SharedBitGen bit_gen;
+      return absl::Uniform<uint32_t>(bit_gen, 0, 1000000);
     }();
     if (random < drop_category.parts_per_million) {
       *category_name = &drop_category.name;
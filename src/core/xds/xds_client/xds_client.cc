@@ -84,6 +84,28 @@ bool XdsEndpointFallbackEnabled() {
 
 using ::grpc_event_engine::experimental::EventEngine;
 
+namespace {
+
+// Converts a set of watchers into an immutable snapshot list for
+// notification fan-out.
+XdsClient::WatcherList MakeWatcherList(const XdsClient::WatcherSet& watchers) {
+  auto list = std::make_shared<
+      std::vector<RefCountedPtr<XdsClient::ResourceWatcherInterface>>>();
+  list->reserve(watchers.size());
+  for (const auto& watcher : watchers) list->push_back(watcher);
+  return list;
+}
+
+XdsClient::WatcherList MakeWatcherList(
+    RefCountedPtr<XdsClient::ResourceWatcherInterface> watcher) {
+  auto list = std::make_shared<
+      std::vector<RefCountedPtr<XdsClient::ResourceWatcherInterface>>>();
+  list->push_back(std::move(watcher));
+  return list;
+}
+
+}  // namespace
+
 //
 // Internal class declarations
 //
@@ -269,7 +291,7 @@ class XdsClient::XdsChannel::AdsCall final
             state.SetDoesNotExistOnTimeout();
           }
           ads_call_->xds_client()->NotifyWatchersOnResourceChanged(
-              state.failed_status(), state.watchers(),
+              state.failed_status(), state.watcher_list(),
               ReadDelayHandle::NoWait());
         }
       }
@@ -329,8 +351,18 @@ class XdsClient::XdsChannel::AdsCall final
 
   void SendMessageLocked(const XdsResourceType* type)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  // Records that an ACK or NACK needs to be sent for the given resource
+  // type and schedules a flush in a separate event-loop callback, so
+  // that acks for responses processed close together are combined into
+  // a single request per type.
+  void SendAckLocked(const XdsResourceType* type)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  void FlushAcks();
 
   struct DecodeContext {
+    explicit DecodeContext(size_t arena_initial_block_size)
+        : arena(arena_initial_block_size) {}
+
     upb::Arena arena;
     const XdsResourceType* type;
     std::string type_url;
@@ -349,6 +381,13 @@ class XdsClient::XdsChannel::AdsCall final
                      absl::string_view serialized_resource,
                      DecodeContext* context)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  // If the resource's serialized bytes are identical to those of the
+  // cached resource, accepts it without decoding or validating it again.
+  // Returns true if the resource was handled.
+  bool MaybeAcceptUnchangedResource(absl::string_view resource_name,
+                                    absl::string_view serialized_resource,
+                                    DecodeContext* context)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
   void HandleServerReportedResourceError(size_t idx,
                                          absl::string_view resource_name,
                                          absl::Status status,
@@ -384,6 +423,11 @@ class XdsClient::XdsChannel::AdsCall final
   // Resource types for which requests need to be sent.
   std::set<const XdsResourceType*> buffered_requests_;
 
+  // Resource types with an ACK or NACK accumulated but not yet sent.
+  std::set<const XdsResourceType*> pending_acks_
+      ABSL_GUARDED_BY(&XdsClient::mu_);
+  bool ack_flush_scheduled_ ABSL_GUARDED_BY(&XdsClient::mu_) = false;
+
   // State for each resource type.
   std::map<const XdsResourceType*, ResourceTypeState> state_map_;
 };
@@ -613,11 +657,11 @@ void XdsClient::XdsChannel::SetChannelStatusLocked(absl::Status status) {
   // Enqueue notifications for the watchers.
   if (!watchers_cached.empty()) {
     xds_client_->NotifyWatchersOnAmbientError(
-        status, std::move(watchers_cached), ReadDelayHandle::NoWait());
+        status, MakeWatcherList(watchers_cached), ReadDelayHandle::NoWait());
   }
   if (!watchers_uncached.empty()) {
     xds_client_->NotifyWatchersOnResourceChanged(
-        status, std::move(watchers_uncached), ReadDelayHandle::NoWait());
+        status, MakeWatcherList(watchers_uncached), ReadDelayHandle::NoWait());
   }
 }
 
@@ -915,6 +959,9 @@ std::string XdsClient::XdsChannel::AdsCall::CreateAdsRequest(
 void XdsClient::XdsChannel::AdsCall::SendMessageLocked(
     const XdsResourceType* type)
     ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_) {
+  // Any request for a type carries the latest version, nonce, and
+  // error status for that type, so it subsumes any pending ack.
+  pending_acks_.erase(type);
   // Buffer message sending if an existing message is in flight.
   if (send_message_pending_ != nullptr) {
     buffered_requests_.insert(type);
@@ -971,6 +1018,83 @@ void XdsClient::XdsChannel::AdsCall::OnRequestSent(bool ok) {
   }
 }
 
+void XdsClient::XdsChannel::AdsCall::SendAckLocked(const XdsResourceType* type)
+    ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_) {
+  pending_acks_.insert(type);
+  if (ack_flush_scheduled_) return;
+  ack_flush_scheduled_ = true;
+  xds_client()->engine()->Run([self = Ref(DEBUG_LOCATION, "ack flush")]() {
+    ExecCtx exec_ctx;
+    self->FlushAcks();
+  });
+}
+
+void XdsClient::XdsChannel::AdsCall::FlushAcks() {
+  MutexLock lock(&xds_client()->mu_);
+  ack_flush_scheduled_ = false;
+  if (!IsCurrentCallOnChannel()) return;
+  // SendMessageLocked() removes the type from pending_acks_.
+  while (!pending_acks_.empty()) {
+    SendMessageLocked(*pending_acks_.begin());
+  }
+}
+
+bool XdsClient::XdsChannel::AdsCall::MaybeAcceptUnchangedResource(
+    absl::string_view resource_name, absl::string_view serialized_resource,
+    DecodeContext* context) {
+  auto parsed_resource_name =
+      xds_client()->ParseXdsResourceName(resource_name, context->type);
+  if (!parsed_resource_name.ok()) return false;
+  auto authority_it =
+      xds_client()->authority_state_map_.find(parsed_resource_name->authority);
+  if (authority_it == xds_client()->authority_state_map_.end()) return false;
+  auto type_it = authority_it->second.type_map.find(context->type);
+  if (type_it == authority_it->second.type_map.end()) return false;
+  auto res_it = type_it->second.find(parsed_resource_name->key);
+  if (res_it == type_it->second.end()) return false;
+  ResourceState& resource_state = res_it->second;
+  if (!resource_state.HasResource() ||
+      resource_state.serialized_proto() != serialized_resource) {
+    return false;
+  }
+  // The exact same bytes were previously decoded, validated, and
+  // accepted, so all of that work can be skipped.
+  GRPC_TRACE_LOG(xds_client, INFO)
+      << "[xds_client " << xds_client() << "] " << context->type_url
+      << " resource " << resource_name
+      << " bytes identical to current, skipping decode.";
+  // Cancel resource-does-not-exist timer, if needed.
+  if (auto it = state_map_.find(context->type); it != state_map_.end()) {
+    auto timer_authority_it = it->second.subscribed_resources.find(
+        parsed_resource_name->authority);
+    if (timer_authority_it != it->second.subscribed_resources.end()) {
+      auto timer_it = timer_authority_it->second.find(
+          parsed_resource_name->key);
+      if (timer_it != timer_authority_it->second.end()) {
+        timer_it->second->MarkSeen();
+      }
+    }
+  }
+  // If needed, record that we've seen this resource.
+  if (context->type->AllResourcesRequiredInSotW()) {
+    context->resources_seen[parsed_resource_name->authority].insert(
+        parsed_resource_name->key);
+  }
+  ++context->num_valid_resources;
+  // Re-ack under the new version.
+  resource_state.SetAcked(resource_state.resource(),
+                          std::string(serialized_resource), context->version,
+                          context->update_time);
+  // If we previously had connectivity problems, notify watchers that
+  // the ambient error has been cleared.
+  if (!xds_channel()->status().ok()) {
+    xds_client()->NotifyWatchersOnAmbientError(absl::OkStatus(),
+                                               resource_state.watcher_list(),
+                                               context->read_delay_handle);
+  }
+  return true;
+}
+
 void XdsClient::XdsChannel::AdsCall::ParseResource(
     size_t idx, absl::string_view type_url, absl::string_view resource_name,
     absl::string_view serialized_resource, DecodeContext* context) {
@@ -985,6 +1109,14 @@ void XdsClient::XdsChannel::AdsCall::ParseResource(
     ++context->num_invalid_resources;
     return;
   }
+  // If the Resource wrapper gave us the resource name, check whether the
+  // serialized bytes are identical to those of the resource we already
+  // have cached, in which case decoding and validation can be skipped.
+  if (!resource_name.empty() &&
+      MaybeAcceptUnchangedResource(resource_name, serialized_resource,
+                                   context)) {
+    return;
+  }
   // Parse the resource.
   XdsResourceType::DecodeContext resource_type_context = {
       xds_client(), xds_channel()->server_, xds_client()->def_pool_.ptr(),
@@ -1096,14 +1228,14 @@ void XdsClient::XdsChannel::AdsCall::ParseResource(
     // the ambient error has been cleared.
     if (!xds_channel()->status().ok()) {
       xds_client()->NotifyWatchersOnAmbientError(absl::OkStatus(),
-                                                 resource_state.watchers(),
+                                                 resource_state.watcher_list(),
                                                  context->read_delay_handle);
     }
     return;
   }
   // Notify watchers.
   xds_client()->NotifyWatchersOnResourceChanged(resource_state.resource(),
-                                                resource_state.watchers(),
+                                                resource_state.watcher_list(),
                                                 context->read_delay_handle);
 }
 
@@ -1183,11 +1315,11 @@ void XdsClient::XdsChannel::AdsCall::HandleServerReportedResourceError(
   // via OnResourceChanged(); otherwise, notify via OnAmbientError().
   if (!resource_state.HasResource()) {
     xds_client()->NotifyWatchersOnResourceChanged(
-        resource_state.failed_status(), resource_state.watchers(),
+        resource_state.failed_status(), resource_state.watcher_list(),
         context->read_delay_handle);
   } else {
     xds_client()->NotifyWatchersOnAmbientError(resource_state.failed_status(),
-                                               resource_state.watchers(),
+                                               resource_state.watcher_list(),
                                                context->read_delay_handle);
   }
 }
@@ -1319,9 +1451,15 @@ absl::Status XdsClient::XdsChannel::AdsCall::DecodeAdsResponse(
 }
 
 void XdsClient::XdsChannel::AdsCall::OnRecvMessage(absl::string_view payload) {
+  // Size the decode arena's initial block from the wire size of the
+  // response, so that steady-state control-plane pushes don't grow the
+  // arena block by block.  The decoded tree is typically a small
+  // multiple of the wire size.
+  constexpr size_t kMaxDecodeArenaInitialBlockSize = 4 * 1024 * 1024;
   // context.read_delay_handle needs to be destroyed after the mutex is
   // released.
-  DecodeContext context;
+  DecodeContext context(
+      std::min(payload.size() * 2, kMaxDecodeArenaInitialBlockSize));
   MutexLock lock(&xds_client()->mu_);
   if (!IsCurrentCallOnChannel()) return;
   // Parse and validate the response.
@@ -1391,8 +1529,10 @@ void XdsClient::XdsChannel::AdsCall::OnRecvMessage(absl::string_view payload) {
       xds_channel()->resource_type_version_map_[context.type] =
           std::move(context.version);
     }
-    // Send ACK or NACK.
-    SendMessageLocked(context.type);
+    // Send ACK or NACK.  This is deferred to a separate event-loop
+    // callback, so that a burst of responses yields one combined
+    // ack per type instead of one write per response.
+    SendAckLocked(context.type);
   }
   // Update metrics.
   if (xds_client()->metrics_reporter_ != nullptr) {
@@ -1687,7 +1827,8 @@ void XdsClient::WatchResource(const XdsResourceType* type,
       MaybeRegisterResourceTypeLocked(type);
       invalid_watchers_.insert(watcher);
     }
-    NotifyWatchersOnResourceChanged(std::move(status), {watcher},
+    NotifyWatchersOnResourceChanged(std::move(status),
+                                    MakeWatcherList(watcher),
                                     ReadDelayHandle::NoWait());
   };
   auto resource_name = ParseXdsResourceName(name, type);
@@ -1747,7 +1888,8 @@ void XdsClient::WatchResource(const XdsResourceType* type,
     if (resource_state.HasResource()) {
       GRPC_TRACE_LOG(xds_client, INFO)
           << "[xds_client " << this << "] returning cached data for " << name;
-      NotifyWatchersOnResourceChanged(resource_state.resource(), {watcher},
+      NotifyWatchersOnResourceChanged(resource_state.resource(),
+                                      MakeWatcherList(watcher),
                                       ReadDelayHandle::NoWait());
     }
     if (!resource_state.failed_status().ok()) {
@@ -1755,7 +1897,7 @@ void XdsClient::WatchResource(const XdsResourceType* type,
           << "[xds_client " << this << "] returning cached error for " << name
           << ": " << resource_state.failed_status();
       NotifyWatchersOnError(resource_state, ReadDelayHandle::NoWait(),
-                            {watcher});
+                            MakeWatcherList(watcher));
     }
   }
   // Make sure all channels are subscribing to the resource.
@@ -1768,7 +1910,8 @@ void XdsClient::WatchResource(const XdsResourceType* type,
     GRPC_TRACE_LOG(xds_client, INFO)
         << "[xds_client " << this << "] returning cached channel error for "
         << name << ": " << channel_status;
-    NotifyWatchersOnError(resource_state, ReadDelayHandle::NoWait(), {watcher},
+    NotifyWatchersOnError(resource_state, ReadDelayHandle::NoWait(),
+                          MakeWatcherList(watcher),
                           std::move(channel_status));
   }
 }
@@ -1928,13 +2071,13 @@ absl::Status XdsClient::AppendNodeToStatus(const absl::Status& status) const {
 void XdsClient::NotifyWatchersOnResourceChanged(
     absl::StatusOr<std::shared_ptr<const XdsResourceType::ResourceData>>
         resource,
-    WatcherSet watchers, RefCountedPtr<ReadDelayHandle> read_delay_handle) {
+    WatcherList watchers, RefCountedPtr<ReadDelayHandle> read_delay_handle) {
   if (!resource.ok()) resource = AppendNodeToStatus(resource.status());
   work_serializer_.Run(
       [watchers = std::move(watchers), resource = std::move(resource),
        read_delay_handle = std::move(read_delay_handle)]()
           ABSL_EXCLUSIVE_LOCKS_REQUIRED(&work_serializer_) {
-            for (const auto& watcher : watchers) {
+            for (const auto& watcher : *watchers) {
               watcher->OnGenericResourceChanged(resource, read_delay_handle);
             }
           },
@@ -1942,14 +2085,14 @@ void XdsClient::NotifyWatchersOnResourceChanged(
 }
 
 void XdsClient::NotifyWatchersOnAmbientError(
-    absl::Status status, WatcherSet watchers,
+    absl::Status status, WatcherList watchers,
     RefCountedPtr<ReadDelayHandle> read_delay_handle) {
   if (!status.ok()) status = AppendNodeToStatus(status);
   work_serializer_.Run(
       [watchers = std::move(watchers), status = std::move(status),
        read_delay_handle = std::move(read_delay_handle)]()
           ABSL_EXCLUSIVE_LOCKS_REQUIRED(&work_serializer_) {
-            for (const auto& watcher : watchers) {
+            for (const auto& watcher : *watchers) {
               watcher->OnAmbientError(status, read_delay_handle);
             }
           },
@@ -1958,9 +2101,9 @@ void XdsClient::NotifyWatchersOnAmbientError(
 
 void XdsClient::NotifyWatchersOnError(
     const ResourceState& resource_state,
-    RefCountedPtr<ReadDelayHandle> read_delay_handle, WatcherSet watchers,
+    RefCountedPtr<ReadDelayHandle> read_delay_handle, WatcherList watchers,
     absl::Status status) {
-  if (watchers.empty()) watchers = resource_state.watchers();
+  if (watchers == nullptr) watchers = resource_state.watcher_list();
   if (status.ok()) status = resource_state.failed_status();
   if (!resource_state.HasResource()) {
     NotifyWatchersOnResourceChanged(std::move(status), std::move(watchers),
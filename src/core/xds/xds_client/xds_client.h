@@ -261,6 +261,13 @@ class XdsClient : public DualRefCounted<XdsClient> {
                           RefCountedPtrHash<ResourceWatcherInterface>,
                           RefCountedPtrEq<ResourceWatcherInterface>>;
 
+  // An immutable snapshot of a set of watchers.  Enqueued notifications
+  // share the snapshot, so fan-out iterates a plain array instead of
+  // copying the watcher set for every event; the snapshot is rebuilt
+  // only when watchers are added or removed.
+  using WatcherList = std::shared_ptr<
+      const std::vector<RefCountedPtr<ResourceWatcherInterface>>>;
+
   class ResourceState {
    public:
     // Resource status from the view of a xDS client, which tells the
@@ -301,12 +308,15 @@ class XdsClient : public DualRefCounted<XdsClient> {
 
     void AddWatcher(RefCountedPtr<ResourceWatcherInterface> watcher) {
       watchers_.insert(std::move(watcher));
+      RebuildWatcherList();
     }
     void RemoveWatcher(ResourceWatcherInterface* watcher) {
       watchers_.erase(watcher);
+      RebuildWatcherList();
     }
     bool HasWatchers() const { return !watchers_.empty(); }
     const WatcherSet& watchers() const { return watchers_; }
+    const WatcherList& watcher_list() const { return watcher_list_; }
 
     void SetAcked(std::shared_ptr<const XdsResourceType::ResourceData> resource,
                   std::string serialized_proto, std::string version,
@@ -328,6 +338,7 @@ class XdsClient : public DualRefCounted<XdsClient> {
     std::shared_ptr<const XdsResourceType::ResourceData> resource() const {
       return resource_;
     }
+    const std::string& serialized_proto() const { return serialized_proto_; }
 
     const absl::Status& failed_status() const { return failed_status_; }
 
@@ -336,7 +347,17 @@ class XdsClient : public DualRefCounted<XdsClient> {
         envoy_service_status_v3_ClientConfig_GenericXdsConfig* entry) const;
 
    private:
+    void RebuildWatcherList() {
+      auto list = std::make_shared<
+          std::vector<RefCountedPtr<ResourceWatcherInterface>>>();
+      list->reserve(watchers_.size());
+      for (const auto& watcher : watchers_) list->push_back(watcher);
+      watcher_list_ = std::move(list);
+    }
+
     WatcherSet watchers_;
+    WatcherList watcher_list_ = std::make_shared<
+        const std::vector<RefCountedPtr<ResourceWatcherInterface>>>();
     // The latest data seen for the resource.
     std::shared_ptr<const XdsResourceType::ResourceData> resource_;
     // Cache state.
@@ -368,18 +389,19 @@ class XdsClient : public DualRefCounted<XdsClient> {
   void NotifyWatchersOnResourceChanged(
       absl::StatusOr<std::shared_ptr<const XdsResourceType::ResourceData>>
           resource,
-      WatcherSet watchers, RefCountedPtr<ReadDelayHandle> read_delay_handle);
+      WatcherList watchers, RefCountedPtr<ReadDelayHandle> read_delay_handle);
   // Sends an OnAmbientError() notification to a specific set of watchers.
   void NotifyWatchersOnAmbientError(
-      absl::Status status, WatcherSet watchers,
+      absl::Status status, WatcherList watchers,
       RefCountedPtr<ReadDelayHandle> read_delay_handle);
   // Notifies watchers for resource_state of an error, using
   // OnResourceChanged() if there is no cached resource or
   // OnAmbientError() if there is a cached resource.
   void NotifyWatchersOnError(const ResourceState& resource_state,
                              RefCountedPtr<ReadDelayHandle> read_delay_handle,
-                             // If empty, will use resource_state.watchers().
-                             WatcherSet watchers = {},
+                             // If null, will use
+                             // resource_state.watcher_list().
+                             WatcherList watchers = nullptr,
                              // If OK, will use resource_state.failed_status().
                              absl::Status status = absl::OkStatus());
 
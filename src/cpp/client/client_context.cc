@@ -68,7 +68,8 @@ ClientContext::ClientContext()
       census_context_(nullptr),
       propagate_from_call_(nullptr),
       compression_algorithm_(GRPC_COMPRESS_NONE),
-      initial_metadata_corked_(false) {
+      initial_metadata_corked_(false),
+      inline_callbacks_(false) {
   g_client_callbacks->DefaultConstructor(this);
 }
 
@@ -80,6 +81,35 @@ ClientContext::~ClientContext() {
   g_client_callbacks->Destructor(this);
 }
 
+void ClientContext::Reset() {
+  // Mirrors the constructor's initializer list; fields whose containers can
+  // keep their allocations are cleared rather than reassigned.
+  if (call_ != nullptr) {
+    grpc_call_unref(call_);
+    call_ = nullptr;
+  }
+  initial_metadata_received_ = false;
+  wait_for_ready_ = false;
+  wait_for_ready_explicitly_set_ = false;
+  channel_.reset();
+  call_canceled_ = false;
+  deadline_ = gpr_inf_future(GPR_CLOCK_REALTIME);
+  authority_.clear();
+  creds_.reset();
+  auth_context_.reset();
+  census_context_ = nullptr;
+  send_initial_metadata_.clear();
+  recv_initial_metadata_.Reset();
+  trailing_metadata_.Reset();
+  propagate_from_call_ = nullptr;
+  propagation_options_ = PropagationOptions();
+  compression_algorithm_ = GRPC_COMPRESS_NONE;
+  initial_metadata_corked_ = false;
+  inline_callbacks_ = false;
+  debug_error_string_.clear();
+  rpc_info_ = grpc::experimental::ClientRpcInfo();
+}
+
 void ClientContext::set_credentials(
     const std::shared_ptr<CallCredentials>& creds) {
   creds_ = creds;
@@ -23,6 +23,7 @@
 #include <grpcpp/impl/completion_queue_tag.h>
 #include <grpcpp/impl/grpc_library.h>
 
+#include <algorithm>
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
@@ -163,6 +164,36 @@ CompletionQueue::NextStatus CompletionQueue::AsyncNextInternal(
   }
 }
 
+size_t CompletionQueue::NextBatch(void** tags, bool* oks, size_t max_events) {
+  if (max_events == 0) return 0;
+  // Drain in stack-sized chunks so that callers may pass an arbitrarily
+  // large max_events.
+  constexpr size_t kMaxEventsPerChunk = 64;
+  grpc_event events[kMaxEventsPerChunk];
+  for (;;) {
+    size_t n = grpc_completion_queue_next_batch(
+        cq_, events, std::min(max_events, kMaxEventsPerChunk),
+        gpr_inf_future(GPR_CLOCK_REALTIME), nullptr);
+    size_t num_read = 0;
+    for (size_t i = 0; i < n; ++i) {
+      // A non-completion event (shutdown; timeout cannot happen with an
+      // infinite deadline) is always the only event returned.
+      if (events[i].type != GRPC_OP_COMPLETE) return num_read;
+      auto core_cq_tag =
+          static_cast<grpc::internal::CompletionQueueTag*>(events[i].tag);
+      bool ok = events[i].success != 0;
+      void* tag = core_cq_tag;
+      if (core_cq_tag->FinalizeResult(&tag, &ok)) {
+        tags[num_read] = tag;
+        oks[num_read] = ok;
+        ++num_read;
+      }
+    }
+    // If every event was consumed by FinalizeResult(), block for more.
+    if (num_read > 0) return num_read;
+  }
+}
+
 CompletionQueue::CompletionQueueTLSCache::CompletionQueueTLSCache(
     CompletionQueue* cq)
     : cq_(cq), flushed_(false) {
@@ -181,17 +181,30 @@ void ProtoServerReflectionBackend::FillFileDescriptorResponse(
     return;
   }
 
-  protobuf::FileDescriptorProto file_desc_proto;
-  std::string data;
-  file_desc->CopyTo(&file_desc_proto);
-  file_desc_proto.SerializeToString(&data);
-  response->mutable_file_descriptor_response()->add_file_descriptor_proto(data);
+  response->mutable_file_descriptor_response()->add_file_descriptor_proto(
+      GetSerializedFileDescriptor(file_desc));
 
   for (int i = 0; i < file_desc->dependency_count(); ++i) {
     FillFileDescriptorResponse(file_desc->dependency(i), response, seen_files);
   }
 }
 
+const std::string& ProtoServerReflectionBackend::GetSerializedFileDescriptor(
+    const protobuf::FileDescriptor* file_desc) const {
+  grpc::internal::MutexLock lock(&file_descriptor_cache_mu_);
+  auto it = file_descriptor_cache_.find(file_desc);
+  if (it == file_descriptor_cache_.end()) {
+    protobuf::FileDescriptorProto file_desc_proto;
+    file_desc->CopyTo(&file_desc_proto);
+    it = file_descriptor_cache_
+             .emplace(file_desc, file_desc_proto.SerializeAsString())
+             .first;
+  }
+  // Returning a reference that outlives the lock is safe: entries are only
+  // ever added, and node based containers keep values in place.
+  return it->second;
+}
+
 Status ProtoServerReflection::ServerReflectionInfo(
     ServerContext* /* context */,
     ServerReaderWriter<reflection::v1alpha::ServerReflectionResponse,
@@ -25,8 +25,11 @@
 #include <grpcpp/support/status.h>
 #include <grpcpp/support/sync_stream.h>
 
+#include <grpcpp/impl/sync.h>
+
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -76,8 +79,19 @@ class ProtoServerReflectionBackend {
   template <typename Response>
   void FillErrorResponse(const Status& status, Response* error_response) const;
 
+  const std::string& GetSerializedFileDescriptor(
+      const protobuf::FileDescriptor* file_desc) const;
+
   const protobuf::DescriptorPool* descriptor_pool_;
   const std::vector<string>* services_;
+
+  // Serialized FileDescriptorProtos keyed by descriptor identity. Pool
+  // entries are immutable once built, so cached bytes never go stale; files
+  // registered after a lookup miss are simply serialized on first use.
+  // Entries are never erased or modified, only added.
+  mutable grpc::internal::Mutex file_descriptor_cache_mu_;
+  mutable std::unordered_map<const protobuf::FileDescriptor*, std::string>
+      file_descriptor_cache_;
 };
 
 class ProtoServerReflection final
@@ -25,6 +25,7 @@
 #include <grpcpp/support/slice.h>
 #include <stdint.h>
 
+#include <array>
 #include <memory>
 #include <utility>
 
@@ -190,10 +191,12 @@ DefaultHealthCheckService::HealthCheckServiceImpl::HandleCheckRequest(
     reactor->Finish(Status(StatusCode::NOT_FOUND, "service name unknown"));
     return reactor;
   }
-  if (!EncodeResponse(serving_status, response)) {
+  const ByteBuffer* cached_response = GetCachedResponse(serving_status);
+  if (cached_response == nullptr) {
     reactor->Finish(Status(StatusCode::INTERNAL, "could not encode response"));
     return reactor;
   }
+  *response = *cached_response;
   reactor->Finish(Status::OK);
   return reactor;
 }
@@ -245,6 +248,20 @@ bool DefaultHealthCheckService::HealthCheckServiceImpl::EncodeResponse(
   return true;
 }
 
+const ByteBuffer*
+DefaultHealthCheckService::HealthCheckServiceImpl::GetCachedResponse(
+    ServingStatus status) {
+  static const std::array<ByteBuffer, 3>* const responses = [] {
+    auto* array = new std::array<ByteBuffer, 3>();
+    for (ServingStatus status : {NOT_FOUND, SERVING, NOT_SERVING}) {
+      if (!EncodeResponse(status, &(*array)[status])) (*array)[status].Clear();
+    }
+    return array;
+  }();
+  const ByteBuffer& response = (*responses)[status];
+  return response.Valid() ? &response : nullptr;
+}
+
 //
 // DefaultHealthCheckService::HealthCheckServiceImpl::WatchReactor
 //
@@ -297,13 +314,16 @@ void DefaultHealthCheckService::HealthCheckServiceImpl::WatchReactor::
       return;
     }
   }
-  // Send response.
-  bool success = EncodeResponse(status, &response_);
-  if (!success) {
+  // Send response. The serialized form is shared by all watchers; copying a
+  // ByteBuffer only bumps slice refcounts, so a status flip costs no
+  // serialization work per watcher.
+  const ByteBuffer* cached_response = GetCachedResponse(status);
+  if (cached_response == nullptr) {
     MaybeFinishLocked(
         Status(StatusCode::INTERNAL, "could not encode response"));
     return;
   }
+  response_ = *cached_response;
   VLOG(2) << "[HCS " << service_ << "] watcher " << this << " \""
           << service_name_ << "\": starting write for ServingStatus " << status;
   write_pending_ = true;
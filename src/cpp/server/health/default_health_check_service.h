@@ -90,6 +90,11 @@ class DefaultHealthCheckService final : public HealthCheckServiceInterface {
                               std::string* service_name);
     static bool EncodeResponse(ServingStatus status, ByteBuffer* response);
 
+    // Returns the shared serialized response for status, or nullptr if
+    // encoding failed. There are only three possible responses, so each is
+    // serialized exactly once and fanned out to all callers by reference.
+    static const ByteBuffer* GetCachedResponse(ServingStatus status);
+
     DefaultHealthCheckService* database_;
 
     grpc::internal::Mutex mu_;
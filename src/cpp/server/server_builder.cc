@@ -183,6 +183,16 @@ void ServerBuilder::experimental_type::SetAuthorizationPolicyProvider(
   builder_->authorization_provider_ = std::move(provider);
 }
 
+void ServerBuilder::experimental_type::SetMaxConcurrentCallbackRequests(
+    int max_concurrent_requests, bool shed_on_memory_pressure) {
+  builder_->AddChannelArgument(GRPC_ARG_SERVER_MAX_CONCURRENT_CALLBACK_REQUESTS,
+                               max_concurrent_requests);
+  if (shed_on_memory_pressure) {
+    builder_->AddChannelArgument(
+        GRPC_ARG_SERVER_CALLBACK_SHED_ON_MEMORY_PRESSURE, 1);
+  }
+}
+
 void ServerBuilder::experimental_type::EnableCallMetricRecording(
     experimental::ServerMetricRecorder* server_metric_recorder) {
   builder_->AddChannelArgument(GRPC_ARG_SERVER_CALL_METRIC_RECORDING, 1);
@@ -57,6 +57,7 @@
 #include <cstdlib>
 #include <memory>
 #include <new>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -66,6 +67,9 @@
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/channelz/channelz.h"
+#include "src/core/channelz/property_list.h"
 #include "src/core/ext/transport/inproc/inproc_transport.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/iomgr.h"
@@ -559,6 +563,49 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
   grpc_core::ManualConstructor<internal::Call> wrapped_call_;
 };
 
+namespace {
+
+// Storage recycler for CallbackRequest objects. Core asks for a fresh
+// request allocation for every RPC it matches and the finished request is
+// released when the RPC completes; routing the blocks through a small
+// per-method free list spares steady-state callback traffic an allocator
+// round trip per call.
+class CallbackRequestFreeList {
+ public:
+  ~CallbackRequestFreeList() {
+    for (void* block : blocks_) {
+      ::operator delete(block);
+    }
+  }
+
+  // Returns a recycled storage block, or nullptr if none is available.
+  void* Take() {
+    grpc::internal::MutexLock lock(&mu_);
+    if (blocks_.empty()) return nullptr;
+    void* block = blocks_.back();
+    blocks_.pop_back();
+    return block;
+  }
+
+  // Accepts a storage block for reuse. Returns false when the list is at
+  // capacity, in which case ownership stays with the caller.
+  bool Return(void* block) {
+    grpc::internal::MutexLock lock(&mu_);
+    if (blocks_.size() >= kMaxBlocks) return false;
+    blocks_.push_back(block);
+    return true;
+  }
+
+ private:
+  // Bounds the memory held idle per method; overflow goes back to the heap.
+  static constexpr size_t kMaxBlocks = 32;
+
+  grpc::internal::Mutex mu_;
+  std::vector<void*> blocks_;
+};
+
+}  // namespace
+
 template <class ServerContextType>
 class Server::CallbackRequest final
     : public grpc::internal::CompletionQueueTag {
@@ -572,9 +619,11 @@ class Server::CallbackRequest final
   // is nullptr since these services don't have pre-defined methods.
   CallbackRequest(Server* server, grpc::internal::RpcServiceMethod* method,
                   grpc::CompletionQueue* cq,
-                  grpc_core::Server::RegisteredCallAllocation* data)
+                  grpc_core::Server::RegisteredCallAllocation* data,
+                  std::shared_ptr<CallbackRequestFreeList> freelist)
       : server_(server),
         method_(method),
+        freelist_(std::move(freelist)),
         has_request_payload_(method->method_type() ==
                                  grpc::internal::RpcMethod::NORMAL_RPC ||
                              method->method_type() ==
@@ -620,6 +669,17 @@ class Server::CallbackRequest final
     server_->UnrefWithPossibleNotify();
   }
 
+  // Destroys this request, recycling its storage block through the method's
+  // free list when one is attached. All requests created through the method
+  // allocators must be released with Done() rather than delete.
+  void Done() {
+    std::shared_ptr<CallbackRequestFreeList> freelist = std::move(freelist_);
+    this->~CallbackRequest();
+    if (freelist == nullptr || !freelist->Return(this)) {
+      ::operator delete(static_cast<void*>(this));
+    }
+  }
+
   // Needs specialization to account for different processing of metadata
   // in generic API
   bool FinalizeResult(void** tag, bool* status) override;
@@ -663,7 +723,7 @@ class Server::CallbackRequest final
       if (!ok) {
         // The call has been shutdown.
         // Delete its contents to free up the request.
-        delete req_;
+        req_->Done();
         return;
       }
 
@@ -726,7 +786,7 @@ class Server::CallbackRequest final
                           : req_->server_->generic_handler_.get();
       handler->RunHandler(grpc::internal::MethodHandler::HandlerParameter(
           call_, req_->ctx_, req_->request_, req_->request_status_,
-          req_->handler_data_, [this] { delete req_; }));
+          req_->handler_data_, [this] { req_->Done(); }));
     }
   };
 
@@ -748,6 +808,8 @@ class Server::CallbackRequest final
 
   Server* const server_;
   grpc::internal::RpcServiceMethod* const method_;
+  // Recycles this request's storage block; null for generic requests.
+  std::shared_ptr<CallbackRequestFreeList> freelist_;
   const bool has_request_payload_;
   grpc_byte_buffer* request_payload_ = nullptr;
   void* request_ = nullptr;
@@ -806,11 +868,13 @@ class Server::SyncRequestThreadManager : public grpc::ThreadManager {
   SyncRequestThreadManager(Server* server, grpc::CompletionQueue* server_cq,
                            std::shared_ptr<GlobalCallbacks> global_callbacks,
                            grpc_resource_quota* rq, int min_pollers,
-                           int max_pollers, int cq_timeout_msec)
+                           int max_pollers, int cq_timeout_msec,
+                           size_t cq_index)
       : ThreadManager("SyncServer", rq, min_pollers, max_pollers),
         server_(server),
         server_cq_(server_cq),
         cq_timeout_msec_(cq_timeout_msec),
+        cq_index_(cq_index),
         global_callbacks_(std::move(global_callbacks)) {}
 
   WorkStatus PollForWork(void** tag, bool* ok) override {
@@ -888,17 +952,53 @@ class Server::SyncRequestThreadManager : public grpc::ThreadManager {
 
   void Start() {
     if (has_sync_method_) {
+      // Publish this manager's thread counts on the server's channelz node.
+      auto* channelz_node =
+          grpc_core::Server::FromC(server_->server())->channelz_node();
+      if (channelz_node != nullptr) {
+        stats_data_source_.emplace(channelz_node->Ref(), this, cq_index_);
+      }
       Initialize();  // ThreadManager's Initialize()
     }
   }
 
  private:
+  // Reports the manager's worker-pool counts via channelz.
+  class StatsDataSource final : public grpc_core::channelz::DataSource {
+   public:
+    StatsDataSource(
+        grpc_core::RefCountedPtr<grpc_core::channelz::BaseNode> node,
+        SyncRequestThreadManager* mgr, size_t cq_index)
+        : grpc_core::channelz::DataSource(std::move(node)),
+          mgr_(mgr),
+          cq_index_(cq_index) {
+      SourceConstructed();
+    }
+    ~StatsDataSource() { SourceDestructing(); }
+    void AddData(grpc_core::channelz::DataSink sink) override {
+      sink.AddData(absl::StrCat("sync_thread_manager_", cq_index_),
+                   grpc_core::channelz::PropertyList()
+                       .Set("num_threads", mgr_->GetNumThreads())
+                       .Set("num_pollers", mgr_->GetNumPollers())
+                       .Set("max_active_threads_sofar",
+                            mgr_->GetMaxActiveThreadsSoFar()));
+    }
+
+   private:
+    SyncRequestThreadManager* mgr_;
+    size_t cq_index_;
+  };
+
   Server* server_;
   grpc::CompletionQueue* server_cq_;
   int cq_timeout_msec_;
+  size_t cq_index_;
   bool has_sync_method_ = false;
   std::unique_ptr<grpc::internal::RpcServiceMethod> unknown_method_;
   std::shared_ptr<Server::GlobalCallbacks> global_callbacks_;
+  // Last member so it detaches from the channelz node before the stats it
+  // reads are torn down.
+  std::optional<StatsDataSource> stats_data_source_;
 };
 
 Server::Server(
@@ -945,7 +1045,7 @@ Server::Server(
     for (const auto& it : *sync_server_cqs_) {
       sync_req_mgrs_.emplace_back(new SyncRequestThreadManager(
           this, it.get(), global_callbacks_, server_rq, min_pollers,
-          max_pollers, sync_cq_timeout_msec));
+          max_pollers, sync_cq_timeout_msec, sync_req_mgrs_.size()));
     }
 
     if (default_rq_created) {
@@ -1099,11 +1199,18 @@ bool Server::RegisterService(const std::string* addr, grpc::Service* service) {
       grpc::internal::RpcServiceMethod* method_value = method.get();
       grpc::CompletionQueue* cq = CallbackCQ();
       grpc_server_register_completion_queue(server_, cq->cq(), nullptr);
+      auto freelist = std::make_shared<CallbackRequestFreeList>();
       grpc_core::Server::FromC(server_)->SetRegisteredMethodAllocator(
-          cq->cq(), method_registration_tag, [this, cq, method_value] {
+          cq->cq(), method_registration_tag,
+          [this, cq, method_value, freelist] {
             grpc_core::Server::RegisteredCallAllocation result;
-            new CallbackRequest<grpc::CallbackServerContext>(this, method_value,
-                                                             cq, &result);
+            void* storage = freelist->Take();
+            if (storage == nullptr) {
+              storage = ::operator new(
+                  sizeof(CallbackRequest<grpc::CallbackServerContext>));
+            }
+            new (storage) CallbackRequest<grpc::CallbackServerContext>(
+                this, method_value, cq, &result, freelist);
             return result;
           });
     }
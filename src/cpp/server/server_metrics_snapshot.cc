@@ -0,0 +1,45 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpcpp/ext/server_metrics_snapshot.h>
+
+#include <utility>
+
+#include "src/core/server/server.h"
+#include "src/core/server/server_latency_histograms.h"
+
+namespace grpc {
+namespace experimental {
+
+ServerMetricsSnapshot GetServerMetricsSnapshot(Server* server) {
+  ServerMetricsSnapshot snapshot;
+  grpc_core::Server* core_server =
+      grpc_core::Server::FromC(server->c_server());
+  grpc_core::ServerLatencyHistograms* histograms =
+      core_server->latency_histograms();
+  if (histograms == nullptr) return snapshot;
+  for (auto& method : histograms->Snapshot()) {
+    snapshot.method_latencies.push_back(
+        MethodLatencySnapshot{std::move(method.method), method.count,
+                              method.p50_ms, method.p95_ms, method.p99_ms});
+  }
+  return snapshot;
+}
+
+}  // namespace experimental
+}  // namespace grpc
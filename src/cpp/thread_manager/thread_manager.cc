@@ -21,38 +21,14 @@
 #include <climits>
 
 #include "absl/log/check.h"
-#include "absl/log/log.h"
 #include "absl/strings/str_format.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/ref_counted_ptr.h"
-#include "src/core/util/thd.h"
+#include "src/core/util/useful.h"
 
 namespace grpc {
 
-ThreadManager::WorkerThread::WorkerThread(ThreadManager* thd_mgr)
-    : thd_mgr_(thd_mgr) {
-  // Make thread creation exclusive with respect to its join happening in
-  // ~WorkerThread().
-  thd_ = grpc_core::Thread(
-      "grpcpp_sync_server",
-      [](void* th) { static_cast<ThreadManager::WorkerThread*>(th)->Run(); },
-      this, &created_);
-  if (!created_) {
-    LOG(ERROR) << "Could not create grpc_sync_server worker-thread";
-  }
-}
-
-void ThreadManager::WorkerThread::Run() {
-  thd_mgr_->MainWorkLoop();
-  thd_mgr_->MarkAsCompleted(this);
-}
-
-ThreadManager::WorkerThread::~WorkerThread() {
-  // Don't join until the thread is fully constructed.
-  thd_.Join();
-}
-
 ThreadManager::ThreadManager(const char*, grpc_resource_quota* resource_quota,
                              int min_pollers, int max_pollers)
     : shutdown_(false),
@@ -69,8 +45,7 @@ ThreadManager::~ThreadManager() {
     grpc_core::MutexLock lock(&mu_);
     CHECK_EQ(num_threads_, 0);
   }
-
-  CleanupCompletedThreads();
+  if (thread_pool_ != nullptr) thread_pool_->Quiesce();
 }
 
 void ThreadManager::Wait() {
@@ -91,16 +66,28 @@ bool ThreadManager::IsShutdown() {
 }
 
 int ThreadManager::GetMaxActiveThreadsSoFar() {
-  grpc_core::MutexLock list_lock(&list_mu_);
+  grpc_core::MutexLock lock(&mu_);
   return max_active_threads_sofar_;
 }
 
-void ThreadManager::MarkAsCompleted(WorkerThread* thd) {
-  {
-    grpc_core::MutexLock list_lock(&list_mu_);
-    completed_threads_.push_back(thd);
-  }
+int ThreadManager::GetNumThreads() {
+  grpc_core::MutexLock lock(&mu_);
+  return num_threads_;
+}
+
+int ThreadManager::GetNumPollers() {
+  grpc_core::MutexLock lock(&mu_);
+  return num_pollers_;
+}
+
+void ThreadManager::StartWorker() {
+  thread_pool_->Run([this]() {
+    MainWorkLoop();
+    MarkWorkerCompleted();
+  });
+}
 
+void ThreadManager::MarkWorkerCompleted() {
   {
     grpc_core::MutexLock lock(&mu_);
     num_threads_--;
@@ -113,18 +100,12 @@ void ThreadManager::MarkAsCompleted(WorkerThread* thd) {
   thread_quota_->Release(1);
 }
 
-void ThreadManager::CleanupCompletedThreads() {
-  std::list<WorkerThread*> completed_threads;
-  {
-    // swap out the completed threads list: allows other threads to clean up
-    // more quickly
-    grpc_core::MutexLock lock(&list_mu_);
-    completed_threads.swap(completed_threads_);
-  }
-  for (auto thd : completed_threads) delete thd;
-}
-
 void ThreadManager::Initialize() {
+  // Created here rather than in the constructor so that managers that are
+  // never initialized (e.g. servers with no sync methods) don't spawn pool
+  // threads.
+  thread_pool_ = grpc_event_engine::experimental::MakeThreadPool(
+      grpc_core::Clamp(min_pollers_, 1, INT_MAX));
   if (!thread_quota_->Reserve(min_pollers_)) {
     grpc_core::Crash(absl::StrFormat(
         "No thread quota available to even create the minimum required "
@@ -140,9 +121,7 @@ void ThreadManager::Initialize() {
   }
 
   for (int i = 0; i < min_pollers_; i++) {
-    WorkerThread* worker = new WorkerThread(this);
-    CHECK(worker->created());  // Must be able to create the minimum
-    worker->Start();
+    StartWorker();
   }
 }
 
@@ -172,25 +151,15 @@ void ThreadManager::MainWorkLoop() {
         bool resource_exhausted = false;
         if (!shutdown_ && num_pollers_ < min_pollers_) {
           if (thread_quota_->Reserve(1)) {
-            // We can allocate a new poller thread
+            // We can allocate a new poller worker
             num_pollers_++;
             num_threads_++;
             if (num_threads_ > max_active_threads_sofar_) {
               max_active_threads_sofar_ = num_threads_;
             }
-            // Drop lock before spawning thread to avoid contention
+            // Drop lock before submitting work to avoid contention
             lock.Release();
-            WorkerThread* worker = new WorkerThread(this);
-            if (worker->created()) {
-              worker->Start();
-            } else {
-              // Get lock again to undo changes to poller/thread counters.
-              grpc_core::MutexLock failure_lock(&mu_);
-              num_pollers_--;
-              num_threads_--;
-              resource_exhausted = true;
-              delete worker;
-            }
+            StartWorker();
           } else if (num_pollers_ > 0) {
             // There is still at least some thread polling, so we can go on
             // even though we are below the number of pollers that we would
@@ -254,12 +223,9 @@ void ThreadManager::MainWorkLoop() {
     }
   };
 
-  // This thread is exiting. Do some cleanup work i.e delete already completed
-  // worker threads
-  CleanupCompletedThreads();
-
   // If we are here, either ThreadManager is shutting down or it already has
-  // enough threads.
+  // enough threads.  The pool thread running this loop is returned to the
+  // pool rather than destroyed.
 }
 
 }  // namespace grpc
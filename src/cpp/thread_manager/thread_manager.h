@@ -19,12 +19,12 @@
 #ifndef GRPC_SRC_CPP_THREAD_MANAGER_THREAD_MANAGER_H
 #define GRPC_SRC_CPP_THREAD_MANAGER_THREAD_MANAGER_H
 
-#include <list>
+#include <memory>
 
+#include "src/core/lib/event_engine/thread_pool/thread_pool.h"
 #include "src/core/lib/resource_quota/api.h"
 #include "src/core/lib/resource_quota/thread_quota.h"
 #include "src/core/util/sync.h"
-#include "src/core/util/thd.h"
 
 namespace grpc {
 
@@ -90,54 +90,23 @@ class ThreadManager {
   // to check if resource_quota is properly being enforced.
   int GetMaxActiveThreadsSoFar();
 
+  // Snapshots of the current worker/poller counts, for diagnostics (e.g.
+  // channelz).
+  int GetNumThreads();
+  int GetNumPollers();
+
  private:
-  // Helper wrapper class around grpc_core::Thread. Takes a ThreadManager object
-  // and starts a new grpc_core::Thread to calls the Run() function.
-  //
-  // The Run() function calls ThreadManager::MainWorkLoop() function and once
-  // that completes, it marks the WorkerThread completed by calling
-  // ThreadManager::MarkAsCompleted()
-  //
-  // WHY IS THIS NEEDED?:
-  // When a thread terminates, some other thread *must* call Join() on that
-  // thread so that the resources are released. Having a WorkerThread wrapper
-  // will make this easier. Once Run() completes, each thread calls the
-  // following two functions:
-  //    ThreadManager::CleanupCompletedThreads()
-  //    ThreadManager::MarkAsCompleted()
-  //
-  //  - MarkAsCompleted() puts the WorkerThread object in the ThreadManger's
-  //    completed_threads_ list
-  //  - CleanupCompletedThreads() calls "Join()" on the threads that are already
-  //    in the completed_threads_ list  (since a thread cannot call Join() on
-  //    itself, it calls CleanupCompletedThreads() *before* calling
-  //    MarkAsCompleted())
-  //
-  // TODO(sreek): Consider creating the threads 'detached' so that Join() need
-  // not be called (and the need for this WorkerThread class is eliminated)
-  class WorkerThread {
-   public:
-    explicit WorkerThread(ThreadManager* thd_mgr);
-    ~WorkerThread();
-
-    bool created() const { return created_; }
-    void Start() { thd_.Start(); }
-
-   private:
-    // Calls thd_mgr_->MainWorkLoop() and once that completes, calls
-    // thd_mgr_>MarkAsCompleted(this) to mark the thread as completed
-    void Run();
-
-    ThreadManager* const thd_mgr_;
-    grpc_core::Thread thd_;
-    bool created_;
-  };
+  // Submits a new worker loop to the thread pool. Workers are closures on a
+  // work-stealing pool rather than dedicated threads, so starting one when a
+  // poller finds work typically reuses a parked pool thread instead of
+  // creating (and later destroying) an OS thread.
+  void StartWorker();
 
   // The main function in ThreadManager
   void MainWorkLoop();
 
-  void MarkAsCompleted(WorkerThread* thd);
-  void CleanupCompletedThreads();
+  // Adjusts counters and quota after a worker loop exits.
+  void MarkWorkerCompleted();
 
   // Protects shutdown_, num_pollers_, num_threads_ and
   // max_active_threads_sofar_
@@ -170,8 +139,9 @@ class ThreadManager {
   // ever set so far
   int max_active_threads_sofar_;
 
-  grpc_core::Mutex list_mu_;
-  std::list<WorkerThread*> completed_threads_;
+  // The pool that runs the worker loops. Owned by this ThreadManager so that
+  // sync-server work stays isolated from the EventEngine's I/O pool.
+  std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool_;
 };
 
 }  // namespace grpc
@@ -61,6 +61,13 @@ Status ByteBuffer::DumpToSingleSlice(Slice* slice) const {
   return Status::OK;
 }
 
+Status ByteBuffer::FlattenToSlice(Slice* slice) const {
+  if (TrySingleSlice(slice).ok()) {
+    return Status::OK;
+  }
+  return DumpToSingleSlice(slice);
+}
+
 Status ByteBuffer::Dump(std::vector<Slice>* slices) const {
   slices->clear();
   if (!buffer_) {
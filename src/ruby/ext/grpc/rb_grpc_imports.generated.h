@@ -342,6 +342,9 @@ extern grpc_completion_queue_create_type grpc_completion_queue_create_import;
 typedef grpc_event(*grpc_completion_queue_next_type)(grpc_completion_queue* cq, gpr_timespec deadline, void* reserved);
 extern grpc_completion_queue_next_type grpc_completion_queue_next_import;
 #define grpc_completion_queue_next grpc_completion_queue_next_import
+typedef size_t(*grpc_completion_queue_next_batch_type)(grpc_completion_queue* cq, grpc_event* events, size_t max_events, gpr_timespec deadline, void* reserved);
+extern grpc_completion_queue_next_batch_type grpc_completion_queue_next_batch_import;
+#define grpc_completion_queue_next_batch grpc_completion_queue_next_batch_import
 typedef grpc_event(*grpc_completion_queue_pluck_type)(grpc_completion_queue* cq, void* tag, gpr_timespec deadline, void* reserved);
 extern grpc_completion_queue_pluck_type grpc_completion_queue_pluck_import;
 #define grpc_completion_queue_pluck grpc_completion_queue_pluck_import
@@ -399,6 +402,9 @@ extern grpc_channel_get_info_type grpc_channel_get_info_import;
 typedef void(*grpc_channel_reset_connect_backoff_type)(grpc_channel* channel);
 extern grpc_channel_reset_connect_backoff_type grpc_channel_reset_connect_backoff_import;
 #define grpc_channel_reset_connect_backoff grpc_channel_reset_connect_backoff_import
+typedef void(*grpc_channel_warm_connections_type)(grpc_channel* channel);
+extern grpc_channel_warm_connections_type grpc_channel_warm_connections_import;
+#define grpc_channel_warm_connections grpc_channel_warm_connections_import
 typedef void(*grpc_channel_credentials_release_type)(grpc_channel_credentials* creds);
 extern grpc_channel_credentials_release_type grpc_channel_credentials_release_import;
 #define grpc_channel_credentials_release grpc_channel_credentials_release_import
@@ -18,6 +18,7 @@
 
 #include "src/core/call/call_arena_allocator.h"
 
+#include <grpc/support/alloc.h>
 #include <grpc/support/sync.h>
 #include <grpc/support/time.h>
 #include <inttypes.h>
@@ -71,6 +72,27 @@ TEST(CallArenaAllocatorTest, SettlesWithAllocation) {
   LOG(INFO) << estimate;
 }
 
+TEST(CallArenaAllocatorTest, RetainsStorageAtMatchingSize) {
+  auto allocator = MakeRefCounted<CallArenaAllocator>(
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
+          "test-allocator"),
+      1024);
+  // A parked block comes back when the next arena wants the same size.
+  void* block = gpr_malloc_aligned(2048, GPR_MAX_ALIGNMENT);
+  EXPECT_TRUE(allocator->ReturnArenaStorage(block, 2048));
+  EXPECT_EQ(allocator->TakeArenaStorage(2048), block);
+  gpr_free_aligned(block);
+  // A size mismatch (the call size estimate drifted) is a miss.
+  block = gpr_malloc_aligned(2048, GPR_MAX_ALIGNMENT);
+  EXPECT_TRUE(allocator->ReturnArenaStorage(block, 2048));
+  EXPECT_EQ(allocator->TakeArenaStorage(4096), nullptr);
+  // Oversized blocks are refused so idle channels don't pin them.
+  constexpr size_t kHuge = 128 * 1024;
+  block = gpr_malloc_aligned(kHuge, GPR_MAX_ALIGNMENT);
+  EXPECT_FALSE(allocator->ReturnArenaStorage(block, kHuge));
+  gpr_free_aligned(block);
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char* argv[]) {
@@ -1215,6 +1215,62 @@ TEST(CallFiltersTest, UnaryCall) {
                   "f1:OnFinalize", "f2:OnFinalize"));
 }
 
+TEST(CallFiltersTest, PerFilterLatencyTracking) {
+  struct Filter {
+    static absl::string_view TypeName() { return "testfilter"; }
+    struct Call {
+      void OnClientInitialMetadata(ClientMetadata&) {}
+      void OnServerInitialMetadata(ServerMetadata&) {}
+      void OnClientToServerMessage(Message&) {}
+      void OnServerToClientMessage(Message&) {}
+      static inline const NoInterceptor OnClientToServerHalfClose;
+      static inline const NoInterceptor OnServerTrailingMetadata;
+      static inline const NoInterceptor OnFinalize;
+    };
+  };
+  auto collector = MakeRefCounted<FilterLatencyCollector>(nullptr);
+  Filter f1;
+  Filter f2;
+  CallFilters::StackBuilder builder;
+  builder.SetLatencyCollector(collector);
+  builder.Add(&f1);
+  builder.Add(&f2);
+  auto arena = SimpleArenaAllocator()->MakeArena();
+  CallFilters filters(Arena::MakePooledForOverwrite<ClientMetadata>());
+  filters.AddStack(builder.Build());
+  filters.Start();
+  promise_detail::Context<Arena> ctx(arena.get());
+  StrictMock<MockActivity> activity;
+  activity.Activate();
+  auto pull_client_initial_metadata = filters.PullClientInitialMetadata();
+  EXPECT_THAT(pull_client_initial_metadata(), IsReady());
+  Mock::VerifyAndClearExpectations(&activity);
+  auto push_client_to_server_message = filters.PushClientToServerMessage(
+      Arena::MakePooled<Message>(SliceBuffer(), 0));
+  EXPECT_THAT(push_client_to_server_message(), IsPending());
+  auto pull_client_to_server_message = filters.PullClientToServerMessage();
+  EXPECT_WAKEUP(activity,
+                EXPECT_THAT(pull_client_to_server_message(), IsReady()));
+  EXPECT_THAT(push_client_to_server_message(), IsReady(Success{}));
+  filters.PushServerInitialMetadata(
+      Arena::MakePooledForOverwrite<ServerMetadata>());
+  auto pull_server_initial_metadata = filters.PullServerInitialMetadata();
+  EXPECT_THAT(pull_server_initial_metadata(), IsReady());
+  Mock::VerifyAndClearExpectations(&activity);
+  filters.PushServerTrailingMetadata(
+      Arena::MakePooledForOverwrite<ServerMetadata>());
+  auto pull_server_trailing_metadata = filters.PullServerTrailingMetadata();
+  EXPECT_THAT(pull_server_trailing_metadata(), IsReady());
+  // Each filter saw client initial metadata, one client to server message,
+  // and server initial metadata. Duplicate filter names get disambiguated.
+  auto snapshot = collector->Snapshot();
+  ASSERT_EQ(snapshot.size(), 2u);
+  EXPECT_EQ(snapshot[0].filter, "testfilter");
+  EXPECT_EQ(snapshot[0].count, 3u);
+  EXPECT_EQ(snapshot[1].filter, "testfilter#2");
+  EXPECT_EQ(snapshot[1].count, 3u);
+}
+
 TEST(CallFiltersTest, UnaryCallWithMultiStack) {
   struct Filter {
     struct Call {
@@ -46,6 +46,34 @@ TEST(CallFinalizationTest, Works) {
   EXPECT_EQ(evidence, "SECOND12342\nFIRST12342\n");
 }
 
+TEST(CallFinalizationTest, ManyAndLargeFinalizersSpillToArena) {
+  auto arena = SimpleArenaAllocator()->MakeArena();
+  std::string evidence;
+  TestContext<Arena> context(arena.get());
+  CallFinalization finalization;
+  // Enough registrations (some with deliberately large captures) to overflow
+  // the inline storage region and exercise the arena fallback; execution must
+  // still be reverse registration order across both regions.
+  for (int i = 0; i < 10; i++) {
+    if (i % 3 == 0) {
+      char big[64] = {};
+      big[0] = 'x';
+      finalization.Add(
+          [&evidence, big, i](const grpc_call_final_info*) mutable {
+            evidence += absl::StrCat(i, big[0], " ");
+          });
+    } else {
+      finalization.Add([&evidence, i](const grpc_call_final_info*) {
+        evidence += absl::StrCat(i, " ");
+      });
+    }
+  }
+  grpc_call_final_info final_info{};
+  final_info.error_string = "";
+  finalization.Run(&final_info);
+  EXPECT_EQ(evidence, "9x 8 7 6x 5 4 3x 2 1 0x ");
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char** argv) {
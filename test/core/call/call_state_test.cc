@@ -235,6 +235,30 @@ TEST(CallStateTest, RepeatedServerToClientMessages) {
   EXPECT_THAT(state.PollPushServerToClientMessage(), IsReady(Success{}));
 }
 
+TEST(CallStateTest, CoalescedInitialMetadataAndFirstMessageWakeOnce) {
+  StrictMock<MockActivity> activity;
+  activity.Activate();
+  CallState state;
+  EXPECT_THAT(state.PollPullServerInitialMetadataAvailable(), IsPending());
+  EXPECT_THAT(state.PollPullServerToClientMessageAvailable(), IsPending());
+  EXPECT_WAKEUP(activity, state.Start());
+  // Pushing initial metadata and the first message back-to-back - as a
+  // combined server send batch does - must produce exactly one wakeup: the
+  // message push piggy-backs on the metadata push's wakeup, so the puller
+  // observes both in a single poll and the transport can emit one write.
+  EXPECT_CALL(activity, WakeupRequested()).Times(1);
+  state.PushServerInitialMetadata();
+  state.BeginPushServerToClientMessage();
+  Mock::VerifyAndClearExpectations(&activity);
+  EXPECT_WAKEUP(activity,
+                EXPECT_THAT(state.PollPullServerInitialMetadataAvailable(),
+                            IsReady(true)));
+  EXPECT_WAKEUP(activity, state.FinishPullServerInitialMetadata());
+  EXPECT_THAT(state.PollPullServerToClientMessageAvailable(), IsReady(true));
+  EXPECT_WAKEUP(activity, state.FinishPullServerToClientMessage());
+  EXPECT_THAT(state.PollPushServerToClientMessage(), IsReady(Success{}));
+}
+
 TEST(CallStateTest, ReceiveTrailersOnly) {
   StrictMock<MockActivity> activity;
   activity.Activate();
@@ -171,6 +171,30 @@ TEST(RequestBufferTest, PushThenPullMessage) {
   EXPECT_THAT(poll_msg.value().value().value(), IsTestMessage());
 }
 
+TEST(RequestBufferTest, ReplaySharesPayloadSlices) {
+  RequestBuffer buffer;
+  EXPECT_EQ(buffer.PushClientInitialMetadata(TestMetadata()), 40);
+  auto message = Arena::MakePooled<Message>(
+      SliceBuffer(Slice::FromCopiedString(std::string(128, 'a'))), 0);
+  const uint8_t* const payload_bytes =
+      GRPC_SLICE_START_PTR(message->payload()->c_slice_at(0));
+  auto pusher = buffer.PushMessage(std::move(message));
+  EXPECT_THAT(pusher(), IsReady());
+  // Neither reader has won the buffer, so both pull copies - but those copies
+  // must reference the buffered payload's slices, not duplicate the bytes.
+  RequestBuffer::Reader reader1(&buffer);
+  RequestBuffer::Reader reader2(&buffer);
+  for (auto* reader : {&reader1, &reader2}) {
+    auto poll_msg = reader->PullMessage()();
+    ASSERT_TRUE(poll_msg.ready());
+    ASSERT_TRUE(poll_msg.value().ok());
+    ASSERT_TRUE(poll_msg.value().value().has_value());
+    auto& replayed = *poll_msg.value().value();
+    EXPECT_EQ(GRPC_SLICE_START_PTR(replayed->payload()->c_slice_at(0)),
+              payload_bytes);
+  }
+}
+
 TEST(RequestBufferTest, PushThenPullMessageStreamBeforeInitialMetadata) {
   RequestBuffer buffer;
   EXPECT_EQ(buffer.PushClientInitialMetadata(TestMetadata()), 40);
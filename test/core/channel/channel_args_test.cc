@@ -74,6 +74,23 @@ TEST(ChannelArgsTest, SetGetRemove) {
   gpr_free(ptr);
 }
 
+TEST(ChannelArgsTest, Interned) {
+  EXPECT_EQ(ChannelArgs().Interned(), ChannelArgs());
+  ChannelArgs a = ChannelArgs().Set("answer", 42).Set("foo", "bar");
+  ChannelArgs b = ChannelArgs().Set("foo", "bar").Set("answer", 42);
+  EXPECT_EQ(a.Interned(), a);
+  EXPECT_EQ(a.Interned(), b.Interned());
+  EXPECT_NE(a.Interned(), b.Set("foo", "baz").Interned());
+}
+
+TEST(ChannelArgsTest, ShutdownInternTableReleasesEntries) {
+  ChannelArgs a = ChannelArgs().Set("interned", "value");
+  EXPECT_EQ(a.Interned(), a);
+  ChannelArgs::ShutdownInternTable();
+  // Re-interning after a flush works fine.
+  EXPECT_EQ(a.Interned(), a);
+}
+
 TEST(ChannelArgsTest, RemoveAllKeysWithPrefix) {
   ChannelArgs args;
   args = args.Set("foo", 1);
@@ -182,6 +199,21 @@ TEST(ChannelArgsTest, RetrieveRawPointerFromStoredSharedPtr) {
   EXPECT_EQ(2, shared_obj.use_count());
 }
 
+TEST(ChannelArgsTest, InternedDoesNotPinPointerValues) {
+  auto shared_obj = std::make_shared<ShareableObject>(42);
+  {
+    ChannelArgs args = ChannelArgs().SetObject(shared_obj).Set("answer", 42);
+    ChannelArgs interned = args.Interned();
+    EXPECT_EQ(interned, args);
+    EXPECT_EQ(interned.Interned(), args);
+  }
+  // The intern table must not have kept a copy: pointer-valued args are
+  // returned unshared, so the object dies with the last local instance
+  // (otherwise e.g. an EventEngine stored in subchannel args would be
+  // pinned for the process lifetime, hanging WaitForSingleOwner()).
+  EXPECT_EQ(shared_obj.use_count(), 1);
+}
+
 TEST(ChannelArgsTest, StoreSharedPtrEventEngine) {
   auto p = std::shared_ptr<EventEngine>(CreateEventEngine());
   ChannelArgs a;
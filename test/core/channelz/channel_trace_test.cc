@@ -357,6 +357,46 @@ TEST(ChannelTracerTest, TestSmallMemoryLimitProto) {
   upb_Arena_Free(arena);
 }
 
+// Tests that an entry's description is rendered at most once, no matter how
+// many times the trace is scraped.
+TEST(ChannelTracerTest, RepeatedRenderMemoizesDescriptions) {
+  class CountingRenderer final : public ChannelTrace::Renderer {
+   public:
+    explicit CountingRenderer(int* render_count)
+        : render_count_(render_count) {}
+    std::string Render() const override {
+      ++*render_count_;
+      return "event";
+    }
+    size_t MemoryUsage() const override { return sizeof(*this); }
+
+   private:
+    int* render_count_;
+  };
+  ChannelTrace tracer(kEventListMemoryLimit);
+  int render_count = 0;
+  tracer.NewNode(std::make_unique<CountingRenderer>(&render_count)).Commit();
+  for (int i = 0; i < 2; ++i) {
+    Json json = tracer.RenderJson();
+    EXPECT_THAT(json, IsChannelTraceWithEvents(
+                          1, ::testing::ElementsAre(
+                                 IsTraceEvent("event", "CT_INFO"))))
+        << JsonDump(json);
+  }
+  upb_Arena* arena = upb_Arena_New();
+  grpc_channelz_v2_Entity* entity = grpc_channelz_v2_Entity_new(arena);
+  tracer.Render(entity, arena);
+  size_t size;
+  const grpc_channelz_v2_TraceEvent* const* trace =
+      grpc_channelz_v2_Entity_trace(entity, &size);
+  ASSERT_EQ(size, 1);
+  EXPECT_EQ(
+      UpbStringToStdString(grpc_channelz_v2_TraceEvent_description(trace[0])),
+      "event");
+  upb_Arena_Free(arena);
+  EXPECT_EQ(render_count, 1);
+}
+
 // Tests that the code is thread-safe.
 TEST(ChannelTracerTest, ThreadSafety) {
   ChannelTrace tracer(kEventListMemoryLimit);
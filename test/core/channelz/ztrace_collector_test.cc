@@ -36,6 +36,24 @@ class TestConfig {
   bool Finishes(TestData n) { return n.n == 42; }
 };
 
+class SamplingTestConfig {
+ public:
+  explicit SamplingTestConfig(std::map<std::string, std::string> args)
+      : sample_one_in_(IntFromArgs(args, "sample_one_in").value_or(1)) {}
+
+  bool Finishes(TestData) { return false; }
+
+  bool Accepts(const TestData&) {
+    if (++counter_ < sample_one_in_) return false;
+    counter_ = 0;
+    return true;
+  }
+
+ private:
+  const int64_t sample_one_in_;
+  int64_t counter_ = 0;
+};
+
 TEST(ZTraceCollectorTest, NoOp) {
   ZTraceCollector<TestConfig, TestData> collector;
 }
@@ -161,6 +179,80 @@ TEST(ZTraceCollectorTest, EarlyTerminationWorks) {
   grpc_shutdown();
 }
 
+TEST(ZTraceCollectorTest, AppendAfterTraceFinishedWorks) {
+  grpc_init();
+  ZTraceCollector<TestConfig, TestData> collector;
+  Notification n1;
+  collector.MakeZTrace()->Run(
+      Timestamp::Now() + Duration::Hours(100), {{"test_arg", "test_value"}},
+      grpc_event_engine::experimental::GetDefaultEventEngine(),
+      [&n1](Json) { n1.Notify(); });
+  collector.Append(TestData{42});  // Terminates the first query.
+  n1.WaitForNotification();
+  // With no query running these take the lock-free path.
+  collector.Append(TestData{1});
+  collector.Append(TestData{2});
+  // A later query still collects normally.
+  Notification n2;
+  Json result;
+  collector.MakeZTrace()->Run(
+      Timestamp::Now() + Duration::Milliseconds(100),
+      {{"memory_cap", std::to_string(1024 * 1024 * 1024)},
+       {"test_arg", "test_value"}},
+      grpc_event_engine::experimental::GetDefaultEventEngine(),
+      [&n2, &result](Json r) {
+        result = r;
+        n2.Notify();
+      });
+  int i = 0;
+  while (!n2.HasBeenNotified()) {
+    collector.Append(TestData{1000 + i});
+    i++;
+  }
+  ValidateSimpleTrace(result, i);
+  grpc_shutdown();
+}
+
+TEST(ZTraceCollectorTest, AcceptsFiltersEntries) {
+  grpc_init();
+  ZTraceCollector<SamplingTestConfig, TestData> collector;
+  Notification n;
+  Json result;
+  collector.MakeZTrace()->Run(
+      Timestamp::Now() + Duration::Milliseconds(100),
+      {{"memory_cap", std::to_string(1024 * 1024 * 1024)},
+       {"sample_one_in", "2"}},
+      grpc_event_engine::experimental::GetDefaultEventEngine(),
+      [&n, &result](Json r) {
+        result = r;
+        n.Notify();
+      });
+  int i = 0;
+  while (!n.HasBeenNotified()) {
+    collector.Append(TestData{i});
+    i++;
+  }
+  ASSERT_EQ(result.type(), Json::Type::kObject);
+  auto entries_it = result.object().find("entries");
+  ASSERT_NE(entries_it, result.object().end());
+  const auto& entries = entries_it->second;
+  ASSERT_EQ(entries.type(), Json::Type::kArray);
+  const auto& entries_array = entries.array();
+  EXPECT_LE(entries_array.size(), (i + 1) / 2);
+  // The config accepts every second event: only odd values get recorded.
+  for (const auto& entry : entries_array) {
+    ASSERT_EQ(entry.type(), Json::Type::kObject);
+    const auto& entry_object = entry.object();
+    auto n_it = entry_object.find("n");
+    ASSERT_NE(n_it, entry_object.end());
+    ASSERT_EQ(n_it->second.type(), Json::Type::kNumber);
+    int value;
+    ASSERT_TRUE(absl::SimpleAtoi(n_it->second.string(), &value));
+    EXPECT_EQ(value % 2, 1);
+  }
+  grpc_shutdown();
+}
+
 struct ExhaustionResult {
   Json result;
   Notification n;
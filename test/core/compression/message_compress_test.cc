@@ -251,6 +251,49 @@ TEST(MessageCompressTest, BadDecompressionDataStream) {
   grpc_slice_buffer_destroy(&output);
 }
 
+TEST(MessageCompressTest, DictionaryCompressRoundTrip) {
+  const char* dict_text =
+      "{\"user_id\":\"0000000000\",\"session\":\"cafebabe\",\"operation\":"
+      "\"read\",\"status\":\"OK\",\"payload\":{}}";
+  const char* message_text =
+      "{\"user_id\":\"1234567890\",\"session\":\"deadbeef\",\"operation\":"
+      "\"read\",\"status\":\"OK\",\"payload\":{}}";
+  grpc_slice dict = grpc_slice_from_static_string(dict_text);
+  grpc_slice_buffer input;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer output;
+
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input, grpc_slice_from_copied_string(message_text));
+
+  grpc_core::ExecCtx exec_ctx;
+  ASSERT_EQ(1, grpc_msg_compress_with_dictionary(&input, dict, &compressed));
+  // A message this small and this similar to the dictionary must compress.
+  ASSERT_LT(compressed.length, input.length);
+  ASSERT_EQ(1,
+            grpc_msg_decompress_with_dictionary(&compressed, dict, &output));
+  grpc_slice final = grpc_slice_merge(output.slices, output.count);
+  ASSERT_EQ(GRPC_SLICE_LENGTH(final), strlen(message_text));
+  ASSERT_EQ(0, memcmp(GRPC_SLICE_START_PTR(final), message_text,
+                      strlen(message_text)));
+
+  // Decompressing against the wrong dictionary must fail, not corrupt.
+  grpc_slice wrong_dict = grpc_slice_from_static_string("something else");
+  grpc_slice_buffer wrong_output;
+  grpc_slice_buffer_init(&wrong_output);
+  ASSERT_EQ(0, grpc_msg_decompress_with_dictionary(&compressed, wrong_dict,
+                                                   &wrong_output));
+  ASSERT_EQ(wrong_output.count, 0);
+
+  grpc_core::CSliceUnref(final);
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_buffer_destroy(&output);
+  grpc_slice_buffer_destroy(&wrong_output);
+}
+
 TEST(MessageCompressTest, BadCompressionAlgorithm) {
   grpc_slice_buffer input;
   grpc_slice_buffer output;
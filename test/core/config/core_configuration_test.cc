@@ -49,6 +49,18 @@ TEST(ConfigTest, NoopConfig) {
   CoreConfiguration::Get();
 }
 
+TEST(ConfigTest, PrewarmBuildsEagerly) {
+  CoreConfiguration::Reset();
+  int builds = 0;
+  g_mock_builder = [&builds](CoreConfiguration::Builder*) { ++builds; };
+  CoreConfiguration::Prewarm();
+  EXPECT_EQ(builds, 1);
+  // Subsequent lookups reuse the prewarmed configuration.
+  CoreConfiguration::Get();
+  EXPECT_EQ(builds, 1);
+  g_mock_builder = nullptr;
+}
+
 TEST(ConfigTest, ThreadedInit) {
   CoreConfiguration::Reset();
   g_mock_builder = [](CoreConfiguration::Builder*) {
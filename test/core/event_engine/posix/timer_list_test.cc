@@ -183,6 +183,62 @@ TEST(TimerListTest, Destruction) {
   EXPECT_TRUE(timer_list.TimerCancel(&timers[2]));
 }
 
+// Timers far beyond the near-term horizon live in the shard's timer wheel;
+// verify they can be cancelled while parked there and that survivors still
+// fire as the horizon advances to reach them (including the overflow bucket).
+TEST(TimerListTest, FarDeadlinesCancelAndFire) {
+  constexpr int kNumTimers = 42;
+  Timer timers[kNumTimers];
+  StrictMock<MockClosure> closures[kNumTimers];
+
+  const auto kStart =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(100);
+
+  StrictMock<MockHost> host;
+  EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
+  TimerList timer_list(&host);
+
+  // Timers 0..39 are seconds-to-minutes out; the last two are far enough out
+  // to land in the wheel's overflow bucket.
+  for (int i = 0; i < 40; i++) {
+    EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
+    timer_list.TimerInit(&timers[i],
+                         kStart + grpc_core::Duration::Seconds(5 * (i + 1)),
+                         &closures[i]);
+  }
+  for (int i = 40; i < kNumTimers; i++) {
+    EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
+    timer_list.TimerInit(&timers[i], kStart + grpc_core::Duration::Minutes(30),
+                         &closures[i]);
+  }
+
+  // Cancel every other timer while it is still parked in the wheel.
+  for (int i = 1; i < kNumTimers; i += 2) {
+    EXPECT_TRUE(timer_list.TimerCancel(&timers[i]));
+  }
+
+  // Advance past the seconds-to-minutes batch: the surviving timers fire.
+  EXPECT_CALL(host, Now())
+      .WillOnce(Return(kStart + grpc_core::Duration::Seconds(201)));
+  for (int i = 0; i < 40; i += 2) {
+    EXPECT_CALL(closures[i], Run());
+  }
+  EXPECT_EQ(FinishCheck(timer_list.TimerCheck(nullptr)),
+            CheckResult::kTimersFired);
+  for (int i = 0; i < 40; i += 2) {
+    Mock::VerifyAndClearExpectations(&closures[i]);
+  }
+
+  // Advance past the overflow batch.
+  EXPECT_CALL(host, Now())
+      .WillOnce(Return(kStart + grpc_core::Duration::Minutes(31)));
+  EXPECT_CALL(closures[40], Run());
+  EXPECT_EQ(FinishCheck(timer_list.TimerCheck(nullptr)),
+            CheckResult::kTimersFired);
+  EXPECT_FALSE(timer_list.TimerCancel(&timers[0]));
+  EXPECT_FALSE(timer_list.TimerCancel(&timers[40]));
+}
+
 // Cleans up a list with pending timers that simulate long-running-services.
 // This test does the following:
 //  1) Simulates grpc server start time to 25 days in the past (completed in
@@ -25,6 +25,7 @@
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "gtest/gtest.h"
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/posix_engine/timer.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
@@ -73,6 +74,36 @@ TEST(TimerManagerTest, StressTest) {
   pool->Quiesce();
 }
 
+TEST(TimerManagerTest, TimersFireWithSlackEnabled) {
+  grpc_core::ConfigVars::Overrides config_overrides;
+  config_overrides.event_engine_timer_slack_ms = 50;
+  grpc_core::ConfigVars::SetOverrides(config_overrides);
+  grpc_core::ExecCtx exec_ctx;
+  auto pool = MakeThreadPool(8);
+  {
+    TimerManager manager(pool);
+    auto now = grpc_core::Timestamp::Now();
+    auto deadline = now + grpc_core::Duration::Milliseconds(100);
+    Timer timer;
+    std::atomic<bool> called{false};
+    manager.TimerInit(&timer, deadline,
+                      experimental::SelfDeletingClosure::Create(
+                          [&called]() { called = true; }));
+    auto test_deadline = now + grpc_core::Duration::Seconds(10);
+    while (!called.load(std::memory_order_relaxed)) {
+      exec_ctx.InvalidateNow();
+      ASSERT_LT(grpc_core::Timestamp::Now(), test_deadline)
+          << "Timer did not fire with slack enabled";
+      absl::SleepFor(absl::Milliseconds(10));
+    }
+    // Slack may only delay expiry, never run a timer early.
+    exec_ctx.InvalidateNow();
+    EXPECT_GE(grpc_core::Timestamp::Now(), deadline);
+  }
+  pool->Quiesce();
+  grpc_core::ConfigVars::SetOverrides(grpc_core::ConfigVars::Overrides());
+}
+
 TEST(TimerManagerTest, ShutDownBeforeAllCallbacksAreExecuted) {
   // Should the internal timer_list complain in this scenario?
   grpc_core::ExecCtx exec_ctx;
@@ -173,6 +173,45 @@ TEST(BufferListTest, ProcessTimestampsAcked) {
   EXPECT_THAT(traced_buffers.Size(), Eq(0));
 }
 
+// Tests that a batch of timestamp events is applied in order by a single
+// ProcessTimestamps() call.
+TEST(BufferListTest, ProcessTimestampsBatch) {
+  TracedBufferList traced_buffers;
+  int sent_count = 0;
+  int acked_count = 0;
+  constexpr int kNumIterations = 10;
+  for (int i = 0; i < kNumIterations; ++i) {
+    traced_buffers.AddNewEntry(
+        /*seq_no=*/i, /*posix_interface=*/nullptr, /*fd=*/FileDescriptor(),
+        WriteEventSink(nullptr, {WriteEvent::kSent, WriteEvent::kAcked},
+                       [&sent_count, &acked_count](
+                           WriteEvent event, absl::Time /*time*/,
+                           std::vector<WriteMetric> /*metrics*/) {
+                         if (event == WriteEvent::kSent) {
+                           ++sent_count;
+                         } else {
+                           EXPECT_EQ(event, WriteEvent::kAcked);
+                           ++acked_count;
+                         }
+                       }));
+  }
+  EXPECT_THAT(traced_buffers.Size(), Eq(10));
+  TracedBufferList::TimestampedEvent sent_event;
+  sent_event.seq_no = 10;
+  sent_event.type = SCM_TSTAMP_SND;
+  sent_event.timestamp = absl::Now();
+  TracedBufferList::TimestampedEvent acked_event;
+  acked_event.seq_no = 10;
+  acked_event.type = SCM_TSTAMP_ACK;
+  acked_event.timestamp = absl::Now();
+  std::vector<TracedBufferList::TimestampedEvent> events = {sent_event,
+                                                            acked_event};
+  traced_buffers.ProcessTimestamps(events);
+  EXPECT_EQ(sent_count, 10);
+  EXPECT_EQ(acked_count, 10);
+  EXPECT_THAT(traced_buffers.Size(), Eq(0));
+}
+
 // Tests that traced buffers that don't see updates get timed out.
 TEST(BufferListTest, TimedOut) {
   TracedBufferList::TestOnlySetMaxPendingAckTime(grpc_core::Duration::Zero());
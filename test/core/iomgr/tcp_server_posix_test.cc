@@ -39,6 +39,7 @@
 #endif
 
 #include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/sync.h>
 #include <grpc/support/time.h>
@@ -582,6 +583,64 @@ static void test_pre_allocated_inet_fd() {
   close(pre_fd);
 }
 
+static void test_supplied_fd_channel_arg() {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_resolved_address resolved_addr;
+  struct sockaddr_in6* addr =
+      reinterpret_cast<struct sockaddr_in6*>(resolved_addr.addr);
+  grpc_tcp_server* s;
+  if (grpc_event_engine::experimental::UseEventEngineListener()) {
+    // Pre-allocated fd support will be added to event engine later.
+    return;
+  }
+  LOG_TEST("test_supplied_fd_channel_arg");
+
+  // Create, bind and listen on an "inherited" socket.
+  int port = grpc_pick_unused_port_or_die();
+  struct sockaddr_in6 address;
+  memset(&address, 0, sizeof(address));
+  address.sin6_family = AF_INET6;
+  address.sin6_port = htons(port);
+  int pre_fd = socket(AF_INET6, SOCK_STREAM, 0);
+  ASSERT_GE(pre_fd, 0);
+  const int enable = 1;
+  setsockopt(pre_fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(int));
+  if (bind(pre_fd, reinterpret_cast<struct sockaddr*>(&address),
+           sizeof(address)) < 0 ||
+      listen(pre_fd, SOMAXCONN) < 0) {
+    LOG(ERROR) << "Unable to bind/listen on inet socket: %m";
+    close(pre_fd);
+    return;
+  }
+
+  // Hand the fd to the server via channel args, as an application would
+  // after receiving it over SCM_RIGHTS from a previous incarnation.
+  auto args = grpc_core::CoreConfiguration::Get()
+                  .channel_args_preconditioning()
+                  .PreconditionChannelArgs(nullptr)
+                  .Set(GRPC_ARG_PREALLOCATED_LISTENER_FD, pre_fd);
+  ASSERT_EQ(
+      absl::OkStatus(),
+      grpc_tcp_server_create(
+          nullptr,
+          grpc_event_engine::experimental::ChannelArgsEndpointConfig(args),
+          on_connect, nullptr, &s));
+
+  // Add a matching port; the supplied fd should be adopted.
+  int pt;
+  memset(&resolved_addr, 0, sizeof(resolved_addr));
+  resolved_addr.len = static_cast<socklen_t>(sizeof(struct sockaddr_in6));
+  addr->sin6_family = AF_INET6;
+  addr->sin6_port = htons(port);
+  ASSERT_EQ(grpc_tcp_server_add_port(s, &resolved_addr, &pt), absl::OkStatus());
+  ASSERT_EQ(grpc_tcp_server_pre_allocated_fd(s), pre_fd);
+  ASSERT_GE(grpc_tcp_server_port_fd_count(s, 0), 1);
+  ASSERT_EQ(grpc_tcp_server_port_fd(s, 0, 0), pre_fd);
+
+  grpc_tcp_server_unref(s);
+  close(pre_fd);
+}
+
 #ifdef GRPC_HAVE_UNIX_SOCKET
 static int pre_allocate_unix_sock(grpc_tcp_server* s, const char* path,
                                   int* fd) {
@@ -742,6 +801,7 @@ TEST(TcpServerPosixTest, MainTest) {
     test_no_op_with_port();
     test_no_op_with_port_and_start();
     test_pre_allocated_inet_fd();
+    test_supplied_fd_channel_arg();
 #ifdef GRPC_HAVE_UNIX_SOCKET
     test_pre_allocated_unix_fd();
 #endif
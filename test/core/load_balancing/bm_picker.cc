@@ -15,8 +15,12 @@
 #include <benchmark/benchmark.h>
 #include <grpc/grpc.h>
 
+#include <atomic>
 #include <memory>
+#include <optional>
+#include <string>
 
+#include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "src/core/client_channel/subchannel_interface_internal.h"
 #include "src/core/config/core_configuration.h"
@@ -27,6 +31,7 @@
 #include "src/core/load_balancing/health_check_client_internal.h"
 #include "src/core/load_balancing/lb_policy.h"
 #include "src/core/util/json/json_reader.h"
+#include "test/core/test_util/allocation_counter.h"
 #include "test/core/test_util/build.h"
 
 namespace grpc_core {
@@ -50,9 +55,14 @@ class BenchmarkHelper : public std::enable_shared_from_this<BenchmarkHelper> {
     config_ = std::move(*config_parsed);
   }
 
-  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> GetPicker() {
+  // Returns the picker for the given endpoint count, blocking until the
+  // matching UpdateLbPolicy() has taken effect.  Taking the expected
+  // count here lets concurrent benchmark threads rendezvous on the same
+  // picker while one of them drives the update.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> GetPicker(
+      size_t num_endpoints) {
     MutexLock lock(&mu_);
-    while (picker_ == nullptr) {
+    while (picker_ == nullptr || current_endpoints_ != num_endpoints) {
       cv_.Wait(&mu_);
     }
     return picker_;
@@ -61,6 +71,8 @@ class BenchmarkHelper : public std::enable_shared_from_this<BenchmarkHelper> {
   void UpdateLbPolicy(size_t num_endpoints) {
     {
       MutexLock lock(&mu_);
+      if (current_endpoints_ == num_endpoints) return;
+      current_endpoints_ = num_endpoints;
       picker_ = nullptr;
       work_serializer_->Run([this, num_endpoints]() {
         EndpointAddressesList addresses;
@@ -101,7 +113,10 @@ class BenchmarkHelper : public std::enable_shared_from_this<BenchmarkHelper> {
       helper_->connectivity_watchers_.erase(watcher);
     }
 
-    void RequestConnection() override { LOG(FATAL) << "unimplemented"; }
+    // No-op: every subchannel reports READY as soon as it is watched, so
+    // policies that connect lazily (e.g. ring_hash) just see an
+    // immediately-ready subchannel.
+    void RequestConnection() override {}
 
     void ResetBackoff() override { LOG(FATAL) << "unimplemented"; }
 
@@ -203,6 +218,7 @@ class BenchmarkHelper : public std::enable_shared_from_this<BenchmarkHelper> {
   CondVar cv_;
   RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker_
       ABSL_GUARDED_BY(mu_);
+  size_t current_endpoints_ ABSL_GUARDED_BY(mu_) = 0;
   absl::flat_hash_set<
       std::shared_ptr<SubchannelInterface::ConnectivityStateWatcherInterface>>
       connectivity_watchers_ ABSL_GUARDED_BY(mu_);
@@ -215,16 +231,39 @@ class BenchmarkHelper : public std::enable_shared_from_this<BenchmarkHelper> {
                       ChannelArgs{}}));
 };
 
+// Minimal metadata for PickArgs: serves a rotating value for the hash
+// header ring_hash is configured with below, so its header-hash path is
+// exercised without per-pick random number generator construction.
+class FakeMetadata final : public LoadBalancingPolicy::MetadataInterface {
+ public:
+  std::optional<absl::string_view> Lookup(absl::string_view key,
+                                          std::string* buffer) const override {
+    if (key != "grpc-hash") return std::nullopt;
+    static std::atomic<uint64_t> counter{0};
+    *buffer = absl::StrCat(counter.fetch_add(1, std::memory_order_relaxed));
+    return *buffer;
+  }
+};
+
 void BM_Pick(benchmark::State& state, BenchmarkHelper& helper) {
   helper.UpdateLbPolicy(state.range(0));
-  auto picker = helper.GetPicker();
+  auto picker = helper.GetPicker(state.range(0));
+  FakeMetadata metadata;
+  const uint64_t allocs_before = grpc_core::testing::TotalAllocationCount();
   for (auto _ : state) {
     picker->Pick(LoadBalancingPolicy::PickArgs{
         "/foo/bar",
-        nullptr,
+        &metadata,
         nullptr,
     });
   }
+  // Allocation counting is process-global, so only this single-threaded
+  // variant reports it; the multi-threaded variant would mix all threads'
+  // picks into one counter.
+  state.counters["allocs_per_pick"] =
+      grpc_core::testing::CheckAllocsPerIteration(
+          allocs_before, state.iterations(), "BM_Pick",
+          "GRPC_BENCHMARK_MAX_ALLOCS_PER_PICK");
 }
 #define PICKER_BENCHMARK(policy, config)                        \
   BENCHMARK_CAPTURE(BM_Pick, policy,                            \
@@ -237,9 +276,52 @@ void BM_Pick(benchmark::State& state, BenchmarkHelper& helper) {
       ->Range(1, IsSlowBuild() ? 1000 : 100000)
 
 PICKER_BENCHMARK(pick_first, "[{\"pick_first\":{}}]");
+PICKER_BENCHMARK(round_robin, "[{\"round_robin\":{}}]");
 PICKER_BENCHMARK(
     weighted_round_robin,
     "[{\"weighted_round_robin\":{\"enableOobLoadReport\":false}}]");
+PICKER_BENCHMARK(
+    ring_hash,
+    "[{\"ring_hash_experimental\":{\"requestHashHeader\":\"grpc-hash\"}}]");
+
+// All benchmark threads hammer one shared picker, modeling many-core
+// clients where every call races through the same picker.  items/s is
+// the aggregate pick throughput across threads; divide by the thread
+// count to see per-thread scaling.
+void BM_PickMultiThreaded(benchmark::State& state, BenchmarkHelper& helper) {
+  if (state.thread_index() == 0) helper.UpdateLbPolicy(state.range(0));
+  auto picker = helper.GetPicker(state.range(0));
+  FakeMetadata metadata;
+  for (auto _ : state) {
+    picker->Pick(LoadBalancingPolicy::PickArgs{
+        "/foo/bar",
+        &metadata,
+        nullptr,
+    });
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+#define PICKER_BENCHMARK_MULTI_THREADED(policy, config)         \
+  BENCHMARK_CAPTURE(BM_PickMultiThreaded, policy,               \
+                    []() -> BenchmarkHelper& {                  \
+                      static auto* helper =                     \
+                          new BenchmarkHelper(#policy, config); \
+                      return *helper;                           \
+                    }())                                        \
+      ->ArgName("endpoints")                                    \
+      ->Arg(10)                                                 \
+      ->Arg(100)                                                \
+      ->Arg(IsSlowBuild() ? 200 : 2000)                         \
+      ->ThreadRange(1, IsSlowBuild() ? 4 : 64)
+
+PICKER_BENCHMARK_MULTI_THREADED(pick_first, "[{\"pick_first\":{}}]");
+PICKER_BENCHMARK_MULTI_THREADED(round_robin, "[{\"round_robin\":{}}]");
+PICKER_BENCHMARK_MULTI_THREADED(
+    weighted_round_robin,
+    "[{\"weighted_round_robin\":{\"enableOobLoadReport\":false}}]");
+PICKER_BENCHMARK_MULTI_THREADED(
+    ring_hash,
+    "[{\"ring_hash_experimental\":{\"requestHashHeader\":\"grpc-hash\"}}]");
 
 }  // namespace
 }  // namespace grpc_core
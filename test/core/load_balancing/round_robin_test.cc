@@ -67,6 +67,24 @@ TEST_F(RoundRobinTest, AddressUpdates) {
                               absl::MakeSpan(kAddresses).last(2));
 }
 
+TEST_F(RoundRobinTest, IdenticalUpdateReusesChildren) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, nullptr), lb_policy()),
+            absl::OkStatus());
+  ExpectRoundRobinStartup(kAddresses);
+  // Resending the same addresses reuses the existing children, so the
+  // new list becomes READY immediately, with no reconnection churn.
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, nullptr), lb_policy()),
+            absl::OkStatus());
+  auto picker = ExpectState(GRPC_CHANNEL_READY);
+  ExpectRoundRobinPicks(picker.get(), kAddresses);
+  for (absl::string_view address : kAddresses) {
+    EXPECT_FALSE(FindSubchannel(address)->ConnectionRequested());
+  }
+  ExpectQueueEmpty();
+}
+
 TEST_F(RoundRobinTest, MultipleAddressesPerEndpoint) {
   constexpr std::array<absl::string_view, 2> kEndpoint1Addresses = {
       "ipv4:127.0.0.1:443", "ipv4:127.0.0.1:444"};
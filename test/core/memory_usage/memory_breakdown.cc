@@ -0,0 +1,184 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Per-call arena memory breakdown harness.
+//
+// The other binaries in this directory measure total process memory; this
+// one attributes per-call arena bytes to coarse consumers (metadata,
+// filter stacks, transport streams, call tracers) using the accounting
+// hooks in src/core/lib/resource_quota/arena.cc.  It runs client and
+// server in one process, so reported bytes are the combined cost of both
+// sides of a call, divided by the number of calls.  One JSON line is
+// printed per scenario so CI can diff the numbers across revisions.
+
+#include <grpc/grpc.h>
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/support/sync_stream.h>
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/end2end/data/ssl_test_data.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_config.h"
+
+namespace {
+
+constexpr int kWarmupCalls = 10;
+constexpr int kMeasuredCalls = 100;
+
+class EchoServiceImpl final : public grpc::testing::EchoTestService::Service {
+ public:
+  grpc::Status Echo(grpc::ServerContext* /*ctx*/,
+                    const grpc::testing::EchoRequest* request,
+                    grpc::testing::EchoResponse* response) override {
+    response->set_message(request->message());
+    return grpc::Status::OK;
+  }
+
+  grpc::Status BidiStream(
+      grpc::ServerContext* /*ctx*/,
+      grpc::ServerReaderWriter<grpc::testing::EchoResponse,
+                               grpc::testing::EchoRequest>* stream) override {
+    grpc::testing::EchoRequest request;
+    grpc::testing::EchoResponse response;
+    while (stream->Read(&request)) {
+      response.set_message(request.message());
+      stream->Write(response);
+    }
+    return grpc::Status::OK;
+  }
+};
+
+void DoUnaryCall(grpc::testing::EchoTestService::Stub* stub) {
+  grpc::ClientContext ctx;
+  grpc::testing::EchoRequest request;
+  grpc::testing::EchoResponse response;
+  request.set_message("hello");
+  grpc::Status status = stub->Echo(&ctx, request, &response);
+  CHECK(status.ok()) << status.error_message();
+}
+
+void DoStreamingCall(grpc::testing::EchoTestService::Stub* stub) {
+  grpc::ClientContext ctx;
+  auto stream = stub->BidiStream(&ctx);
+  grpc::testing::EchoRequest request;
+  grpc::testing::EchoResponse response;
+  request.set_message("hello");
+  for (int i = 0; i < 3; i++) {
+    CHECK(stream->Write(request));
+    CHECK(stream->Read(&response));
+  }
+  CHECK(stream->WritesDone());
+  CHECK(stream->Finish().ok());
+}
+
+// Runs `calls` iterations of `call` against a fresh server + channel
+// built from the given credentials and channel args, resetting the arena
+// accounting counters after warmup, and prints the per-call byte
+// breakdown as one JSON line.
+void RunScenario(const char* name,
+                 std::shared_ptr<grpc::ServerCredentials> server_creds,
+                 std::shared_ptr<grpc::ChannelCredentials> channel_creds,
+                 const grpc::ChannelArguments& channel_args,
+                 void (*call)(grpc::testing::EchoTestService::Stub*)) {
+  int port = grpc_pick_unused_port_or_die();
+  std::string address = absl::StrCat("localhost:", port);
+  EchoServiceImpl service;
+  grpc::ServerBuilder builder;
+  builder.AddListeningPort(address, std::move(server_creds));
+  builder.RegisterService(&service);
+  std::unique_ptr<grpc::Server> server = builder.BuildAndStart();
+  auto channel = grpc::CreateCustomChannel(address, std::move(channel_creds),
+                                           channel_args);
+  auto stub = grpc::testing::EchoTestService::NewStub(channel);
+  for (int i = 0; i < kWarmupCalls; i++) {
+    call(stub.get());
+  }
+  grpc_core::ArenaAllocAccounting::Reset();
+  for (int i = 0; i < kMeasuredCalls; i++) {
+    call(stub.get());
+  }
+  using Consumer = grpc_core::ArenaAllocAccounting::Consumer;
+  std::string json = absl::StrCat("{\"scenario\":\"", name,
+                                  "\",\"calls\":", kMeasuredCalls,
+                                  ",\"per_call_bytes\":{");
+  size_t total = 0;
+  for (size_t i = 0; i < grpc_core::ArenaAllocAccounting::kNumConsumers; i++) {
+    Consumer consumer = static_cast<Consumer>(i);
+    size_t bytes = grpc_core::ArenaAllocAccounting::BytesFor(consumer);
+    total += bytes;
+    absl::StrAppend(
+        &json, "\"", grpc_core::ArenaAllocAccounting::ConsumerName(consumer),
+        "\":", bytes / kMeasuredCalls, ",");
+  }
+  absl::StrAppend(&json, "\"total\":", total / kMeasuredCalls, "}}");
+  printf("%s\n", json.c_str());
+  fflush(stdout);
+  server->Shutdown();
+  grpc_recycle_unused_port(port);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_core::ArenaAllocAccounting::Enable();
+  grpc_init();
+
+  RunScenario("unary", grpc::InsecureServerCredentials(),
+              grpc::InsecureChannelCredentials(), grpc::ChannelArguments(),
+              DoUnaryCall);
+
+  RunScenario("streaming", grpc::InsecureServerCredentials(),
+              grpc::InsecureChannelCredentials(), grpc::ChannelArguments(),
+              DoStreamingCall);
+
+  grpc::ChannelArguments retry_args;
+  retry_args.SetInt(GRPC_ARG_ENABLE_RETRIES, 1);
+  retry_args.SetString(
+      GRPC_ARG_SERVICE_CONFIG,
+      "{\"methodConfig\":[{"
+      "\"name\":[{\"service\":\"grpc.testing.EchoTestService\"}],"
+      "\"retryPolicy\":{\"maxAttempts\":3,\"initialBackoff\":\"0.1s\","
+      "\"maxBackoff\":\"1s\",\"backoffMultiplier\":2,"
+      "\"retryableStatusCodes\":[\"UNAVAILABLE\"]}}]}");
+  RunScenario("retry", grpc::InsecureServerCredentials(),
+              grpc::InsecureChannelCredentials(), retry_args, DoUnaryCall);
+
+  grpc::SslServerCredentialsOptions ssl_server_options;
+  ssl_server_options.pem_key_cert_pairs.push_back(
+      {test_server1_key, test_server1_cert});
+  grpc::SslCredentialsOptions ssl_channel_options;
+  ssl_channel_options.pem_root_certs = test_root_cert;
+  grpc::ChannelArguments tls_args;
+  tls_args.SetSslTargetNameOverride("foo.test.google.fr");
+  RunScenario("tls", grpc::SslServerCredentials(ssl_server_options),
+              grpc::SslCredentials(ssl_channel_options), tls_args, DoUnaryCall);
+
+  grpc_shutdown();
+  return 0;
+}
@@ -17,6 +17,7 @@
 #include <stdlib.h>
 
 #include <memory>
+#include <vector>
 
 #include "absl/status/status.h"
 #include "gtest/gtest.h"
@@ -60,6 +61,41 @@ TEST(ExecCtxWakeupSchedulerTest, Works) {
   EXPECT_TRUE(done);
 }
 
+TEST(ExecCtxWakeupSchedulerTest, UrgentWakeupRunsBeforeQueuedWork) {
+  int state = 0;
+  std::vector<int> order;
+  auto activity = MakeActivity(
+      [&state, &order]() mutable -> Poll<absl::Status> {
+        ++state;
+        switch (state) {
+          case 1:
+            return Pending();
+          case 2:
+            order.push_back(1);
+            return absl::OkStatus();
+          default:
+            abort();
+        }
+      },
+      ExecCtxWakeupScheduler(WakeupPriority::kUrgent),
+      [](absl::Status status) { EXPECT_EQ(status, absl::OkStatus()); });
+  EXPECT_EQ(state, 1);
+  {
+    ExecCtx exec_ctx;
+    // Queue some ordinary work first; the urgent wakeup must still run ahead
+    // of it.
+    ExecCtx::Run(DEBUG_LOCATION,
+                 GRPC_CLOSURE_CREATE(
+                     [](void* arg, grpc_error_handle) {
+                       static_cast<std::vector<int>*>(arg)->push_back(2);
+                     },
+                     &order, nullptr),
+                 absl::OkStatus());
+    activity->ForceWakeup();
+  }
+  EXPECT_EQ(order, (std::vector<int>{1, 2}));
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char** argv) {
@@ -605,6 +605,51 @@ void StressTestAsserts(std::vector<Timestamp>& start_times,
   }
 }
 
+TEST_F(PartyTest, AsyncWakeupBatchRunsAllParties) {
+  // While a Party::AsyncWakeupBatch is in scope, WakeupAsync calls made on
+  // this thread are collected, and the woken parties are run by a single
+  // scheduled closure once the batch goes out of scope.
+  // This test asserts the following:
+  // 1. No collected party is polled while the batch is in scope.
+  // 2. Every collected party runs after the batch goes out of scope.
+  constexpr int kBatchedParties = 10;
+  std::vector<RefCountedPtr<Party>> parties;
+  std::vector<Waker> wakers(kBatchedParties);
+  Notification ready[kBatchedParties];
+  Notification done[kBatchedParties];
+  for (int i = 0; i < kBatchedParties; i++) {
+    parties.push_back(MakeParty());
+    parties.back()->Spawn(
+        "TestSpawn",
+        [&waker = wakers[i], &ready = ready[i],
+         polled = false]() mutable -> Poll<int> {
+          if (!polled) {
+            polled = true;
+            waker = GetContext<Activity>()->MakeOwningWaker();
+            ready.Notify();
+            return Pending{};
+          }
+          return 42;
+        },
+        [&done = done[i]](int) { done.Notify(); });
+    ready[i].WaitForNotification();
+  }
+  {
+    Party::AsyncWakeupBatch batch;
+    for (int i = 0; i < kBatchedParties; i++) {
+      wakers[i].WakeupAsync();
+    }
+    // Nothing runs until the batch goes out of scope: the wakeups are only
+    // collected, no closure has been scheduled yet.
+    for (int i = 0; i < kBatchedParties; i++) {
+      EXPECT_FALSE(done[i].HasBeenNotified());
+    }
+  }
+  for (int i = 0; i < kBatchedParties; i++) {
+    done[i].WaitForNotification();
+  }
+}
+
 TEST_F(PartyTest, ThreadStressTest) {
   // Most other tests are testing the Party code with only 1 or 2 threads.
   // This test will test the Party code for multiple threads.
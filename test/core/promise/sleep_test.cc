@@ -121,6 +121,71 @@ TEST(Sleep, MoveSemantics) {
   EXPECT_GE(Timestamp::Now(), done_time);
 }
 
+TEST(CoarseSleep, Zzzz) {
+  ExecCtx exec_ctx;
+  Notification done;
+  Timestamp done_time = Timestamp::Now() + Duration::Seconds(1);
+  auto engine = GetDefaultEventEngine();
+  // Sleep for roughly one second then set done to true.
+  auto activity = MakeActivity(
+      CoarseSleep(done_time), InlineWakeupScheduler(),
+      [&done](absl::Status r) {
+        EXPECT_EQ(r, absl::OkStatus());
+        done.Notify();
+      },
+      ArenaWithEventEngine(engine.get()));
+  done.WaitForNotification();
+  exec_ctx.InvalidateNow();
+  EXPECT_GE(Timestamp::Now(), done_time);
+}
+
+TEST(CoarseSleep, Cancel) {
+  ExecCtx exec_ctx;
+  Notification done;
+  Timestamp done_time = Timestamp::Now() + Duration::Seconds(1);
+  auto engine = GetDefaultEventEngine();
+  // Sleep for one second but race it to complete immediately
+  auto activity = MakeActivity(
+      Race(CoarseSleep(done_time), [] { return absl::CancelledError(); }),
+      InlineWakeupScheduler(),
+      [&done](absl::Status r) {
+        EXPECT_EQ(r, absl::CancelledError());
+        done.Notify();
+      },
+      ArenaWithEventEngine(engine.get()));
+  done.WaitForNotification();
+  exec_ctx.InvalidateNow();
+  EXPECT_LT(Timestamp::Now(), done_time);
+}
+
+TEST(CoarseSleep, ManySleepsShareABucket) {
+  // Kick off a pile of coarse sleeps with deadlines inside one quantum; they
+  // must all resolve, at or after the latest requested deadline's bucket.
+  static const int kNumActivities = 100;
+  ExecCtx exec_ctx;
+  std::vector<std::shared_ptr<Notification>> notifications;
+  std::vector<ActivityPtr> activities;
+  auto engine = GetDefaultEventEngine();
+  const Timestamp base = Timestamp::Now() + Duration::Seconds(1);
+  for (int i = 0; i < kNumActivities; i++) {
+    auto notification = std::make_shared<Notification>();
+    auto activity = MakeActivity(
+        CoarseSleep(base + Duration::Milliseconds(i % 10),
+                    Duration::Milliseconds(100)),
+        ExecCtxWakeupScheduler(),
+        [notification](absl::Status /*r*/) { notification->Notify(); },
+        ArenaWithEventEngine(engine.get()));
+    notifications.push_back(std::move(notification));
+    activities.push_back(std::move(activity));
+  }
+  for (int i = 0; i < kNumActivities; i++) {
+    notifications[i]->WaitForNotification();
+    exec_ctx.Flush();
+  }
+  exec_ctx.InvalidateNow();
+  EXPECT_GE(Timestamp::Now(), base);
+}
+
 TEST(Sleep, StressTest) {
   // Kick off a bunch sleeps for one second.
   static const int kNumActivities = 100000;
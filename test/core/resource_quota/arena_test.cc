@@ -140,6 +140,20 @@ typedef struct {
 
 TEST(ArenaTest, NoOp) { SimpleArenaAllocator()->MakeArena(); }
 
+TEST(ArenaTest, ReusesInitialBlockOnSameThread) {
+  ExecCtx exec_ctx;
+  // Use a size no other test allocates at so the per-thread block cache
+  // cannot already hold a matching block.
+  auto allocator = SimpleArenaAllocator(4999);
+  auto arena = allocator->MakeArena();
+  void* storage = arena.get();
+  arena.reset();
+  // The freshly released block should be handed to the next same-sized arena
+  // created on this thread.
+  auto reused = allocator->MakeArena();
+  EXPECT_EQ(static_cast<void*>(reused.get()), storage);
+}
+
 TEST(ArenaTest, ManagedNew) {
   ExecCtx exec_ctx;
   auto arena = SimpleArenaAllocator(1)->MakeArena();
@@ -0,0 +1,93 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/resource_quota/connection_quota.h"
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+
+namespace grpc_core {
+namespace testing {
+
+TEST(ConnectionQuotaTest, UnlimitedByDefault) {
+  auto mem_quota = MakeMemoryQuota("test");
+  auto q = MakeRefCounted<ConnectionQuota>();
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_TRUE(q->AllowIncomingConnection(mem_quota, "peer"));
+  }
+}
+
+TEST(ConnectionQuotaTest, AdmitsBelowSoftLimitRejectsAtCap) {
+  auto mem_quota = MakeMemoryQuota("test");
+  auto q = MakeRefCounted<ConnectionQuota>();
+  q->SetMaxIncomingConnections(100);
+  // Below 80% of the cap admission is deterministic.
+  for (int i = 0; i < 80; i++) {
+    EXPECT_TRUE(q->AllowIncomingConnection(mem_quota, "peer")) << i;
+  }
+  // Between the soft limit and the cap admission is probabilistic, but the
+  // cap itself is still hard: we can never exceed it.
+  int admitted = 80;
+  for (int i = 0; i < 10000 && admitted < 100; i++) {
+    if (q->AllowIncomingConnection(mem_quota, "peer")) admitted++;
+  }
+  EXPECT_EQ(q->TestOnlyActiveIncomingConnections(), admitted);
+  EXPECT_LE(admitted, 100);
+  for (int i = 0; i < 100; i++) {
+    EXPECT_FALSE(q->AllowIncomingConnection(mem_quota, "peer"));
+  }
+  // Releasing connections drops utilization back below the soft limit and
+  // admission becomes deterministic again.
+  q->ReleaseConnections(admitted - 50);
+  EXPECT_TRUE(q->AllowIncomingConnection(mem_quota, "peer"));
+  q->ReleaseConnections(51);
+  EXPECT_EQ(q->TestOnlyActiveIncomingConnections(), 0);
+}
+
+TEST(ConnectionQuotaTest, EarlyRejectionIsProbabilistic) {
+  auto mem_quota = MakeMemoryQuota("test");
+  auto q = MakeRefCounted<ConnectionQuota>();
+  q->SetMaxIncomingConnections(100);
+  for (int i = 0; i < 90; i++) {
+    if (!q->AllowIncomingConnection(mem_quota, "peer")) {
+      q->ReleaseConnections(i);
+      return;  // Saw an early rejection in the graduated band.
+    }
+  }
+  // At 90% utilization each admission attempt is rejected with probability
+  // 0.5; 100 consecutive admissions have probability 2^-100.
+  int rejected = 0;
+  for (int i = 0; i < 100; i++) {
+    if (!q->AllowIncomingConnection(mem_quota, "peer")) {
+      rejected++;
+    } else {
+      q->ReleaseConnections(1);
+    }
+  }
+  EXPECT_GT(rejected, 0);
+  q->ReleaseConnections(90);
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+// Hook needed to run ExecCtx outside of iomgr.
+void grpc_set_default_iomgr_platform() {}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -26,6 +26,7 @@
 #include <vector>
 
 #include "gtest/gtest.h"
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "test/core/resource_quota/call_checker.h"
 #include "test/core/test_util/test_config.h"
@@ -110,6 +111,67 @@ TEST(MemoryQuotaTest, CreateSomeObjectsAndExpectReclamation) {
   EXPECT_EQ(object2.get(), nullptr);
 }
 
+TEST(MemoryQuotaTest, IncrementalReclamationRunsWithoutExhaustion) {
+  ConfigVars::Overrides config_overrides;
+  config_overrides.memory_quota_incremental_reclaim_bytes = 1024;
+  ConfigVars::SetOverrides(config_overrides);
+  {
+    ExecCtx exec_ctx;
+    MemoryQuota memory_quota("foo");
+    memory_quota.SetSize(65536);
+    auto memory_owner = memory_quota.CreateMemoryOwner();
+    // Hold enough memory to sit at moderate pressure, far from exhaustion.
+    auto ballast = memory_owner.MakeUnique<Sized<40000>>();
+    std::atomic<bool> called{false};
+    memory_owner.PostReclaimer(
+        ReclamationPass::kBenign,
+        [&called](std::optional<ReclamationSweep> sweep) {
+          EXPECT_TRUE(sweep.has_value());
+          called.store(true, std::memory_order_relaxed);
+        });
+    // Churn small allocations: each one takes enough from the quota to fill
+    // the incremental budget, so the benign reclaimer should run even though
+    // the quota never exhausts.
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!called.load(std::memory_order_relaxed)) {
+      ASSERT_LT(std::chrono::steady_clock::now(), deadline)
+          << "incremental reclamation never ran";
+      auto churn_owner = memory_quota.CreateMemoryOwner();
+      auto object = churn_owner.MakeUnique<Sized<1000>>();
+      object.reset();
+      exec_ctx.Flush();
+    }
+  }
+  ConfigVars::SetOverrides(ConfigVars::Overrides());
+}
+
+TEST(MemoryQuotaTest, ReclaimsDespiteTokenCacheChurn) {
+  ExecCtx exec_ctx;
+  MemoryQuota memory_quota("foo");
+  memory_quota.SetSize(4 * 1024 * 1024);
+  auto memory_owner = memory_quota.CreateMemoryOwner();
+  // Seed the per-CPU token caches: each short-lived owner returns its taken
+  // bytes on destruction, parking them CPU-locally.
+  for (int i = 0; i < 1000; i++) {
+    auto churn_owner = memory_quota.CreateMemoryOwner();
+    auto churn_object = churn_owner.MakeUnique<Sized<10000>>();
+  }
+  // Exhausting the quota must still trigger reclamation: parked tokens are
+  // drained back before the quota declares overcommit.
+  auto object = memory_owner.MakeUnique<Sized<3 * 1024 * 1024>>();
+  auto checker = CallChecker::Make();
+  memory_owner.PostReclaimer(
+      ReclamationPass::kDestructive,
+      [&object, checker](std::optional<ReclamationSweep> sweep) {
+        checker->Called();
+        EXPECT_TRUE(sweep.has_value());
+        object.reset();
+      });
+  auto object2 = memory_owner.MakeUnique<Sized<2 * 1024 * 1024>>();
+  exec_ctx.Flush();
+  EXPECT_EQ(object.get(), nullptr);
+}
+
 TEST(MemoryQuotaTest, ReserveRangeNoPressure) {
   MemoryQuota memory_quota("foo");
   auto memory_allocator = memory_quota.CreateMemoryAllocator("bar");
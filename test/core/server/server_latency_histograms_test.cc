@@ -0,0 +1,119 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/server/server_latency_histograms.h"
+
+#include <string>
+
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+namespace {
+
+TEST(ServerLatencyHistogramsTest, EmptySnapshot) {
+  auto histograms = MakeRefCounted<ServerLatencyHistograms>();
+  EXPECT_TRUE(histograms->Snapshot().empty());
+}
+
+TEST(ServerLatencyHistogramsTest, RecordsPerMethod) {
+  auto histograms = MakeRefCounted<ServerLatencyHistograms>();
+  for (int i = 0; i < 100; ++i) {
+    histograms->RecordCallLatency("/pkg.Service/Fast",
+                                  Duration::Milliseconds(10));
+    histograms->RecordCallLatency("/pkg.Service/Slow",
+                                  Duration::Milliseconds(1000));
+  }
+  auto snapshot = histograms->Snapshot();
+  ASSERT_EQ(snapshot.size(), 2);
+  EXPECT_EQ(snapshot[0].method, "/pkg.Service/Fast");
+  EXPECT_EQ(snapshot[0].count, 100);
+  EXPECT_LT(snapshot[0].p99_ms, snapshot[1].p50_ms);
+  EXPECT_EQ(snapshot[1].method, "/pkg.Service/Slow");
+  EXPECT_EQ(snapshot[1].count, 100);
+  EXPECT_GE(snapshot[1].p50_ms, 100.0);
+}
+
+TEST(ServerLatencyHistogramsTest, PercentilesAreOrdered) {
+  auto histograms = MakeRefCounted<ServerLatencyHistograms>();
+  for (int i = 1; i <= 1000; ++i) {
+    histograms->RecordCallLatency("/pkg.Service/Method",
+                                  Duration::Milliseconds(i));
+  }
+  auto snapshot = histograms->Snapshot();
+  ASSERT_EQ(snapshot.size(), 1);
+  EXPECT_LE(snapshot[0].p50_ms, snapshot[0].p95_ms);
+  EXPECT_LE(snapshot[0].p95_ms, snapshot[0].p99_ms);
+  EXPECT_GT(snapshot[0].p50_ms, 0.0);
+}
+
+TEST(ServerLatencyHistogramsTest, ExtremeLatenciesDoNotCrash) {
+  auto histograms = MakeRefCounted<ServerLatencyHistograms>();
+  histograms->RecordCallLatency("/pkg.Service/Method",
+                                Duration::Milliseconds(-5));
+  histograms->RecordCallLatency("/pkg.Service/Method", Duration::Hours(1000));
+  auto snapshot = histograms->Snapshot();
+  ASSERT_EQ(snapshot.size(), 1);
+  EXPECT_EQ(snapshot[0].count, 2);
+}
+
+TEST(ServerLatencyHistogramsTest, MethodCountIsBounded) {
+  auto histograms = MakeRefCounted<ServerLatencyHistograms>();
+  const size_t kNumMethods = ServerLatencyHistograms::kMaxTrackedMethods + 50;
+  for (size_t i = 0; i < kNumMethods; ++i) {
+    histograms->RecordCallLatency(absl::StrCat("/pkg.Service/Method", i),
+                                  Duration::Milliseconds(1));
+  }
+  auto snapshot = histograms->Snapshot();
+  // kMaxTrackedMethods individual methods plus the overflow entry.
+  ASSERT_EQ(snapshot.size(), ServerLatencyHistograms::kMaxTrackedMethods + 1);
+  uint64_t overflow_count = 0;
+  for (const auto& method : snapshot) {
+    if (method.method == ServerLatencyHistograms::kOverflowMethod) {
+      overflow_count = method.count;
+    }
+  }
+  EXPECT_EQ(overflow_count,
+            kNumMethods - ServerLatencyHistograms::kMaxTrackedMethods);
+}
+
+TEST(ServerLatencyHistogramsTest, TrackedMethodStaysTrackedAfterOverflow) {
+  auto histograms = MakeRefCounted<ServerLatencyHistograms>();
+  histograms->RecordCallLatency("/pkg.Service/First",
+                                Duration::Milliseconds(1));
+  for (size_t i = 0; i < 2 * ServerLatencyHistograms::kMaxTrackedMethods;
+       ++i) {
+    histograms->RecordCallLatency(absl::StrCat("/pkg.Service/Method", i),
+                                  Duration::Milliseconds(1));
+  }
+  histograms->RecordCallLatency("/pkg.Service/First",
+                                Duration::Milliseconds(1));
+  for (const auto& method : histograms->Snapshot()) {
+    if (method.method == "/pkg.Service/First") {
+      EXPECT_EQ(method.count, 2);
+      return;
+    }
+  }
+  FAIL() << "/pkg.Service/First not found in snapshot";
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
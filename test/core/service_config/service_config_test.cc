@@ -143,6 +143,21 @@ TEST_F(ServiceConfigTest, EmptyConfig) {
   EXPECT_EQ((*service_config)->json_string(), "{}");
 }
 
+TEST_F(ServiceConfigTest, ParseResultsCachedForIdenticalInputs) {
+  const char* test_json = "{\"global_param\":5}";
+  auto service_config1 = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config1.ok()) << service_config1.status();
+  // Same args and JSON: same parsed object.
+  auto service_config2 = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config2.ok()) << service_config2.status();
+  EXPECT_EQ(service_config1->get(), service_config2->get());
+  // Different args: parsed separately.
+  auto service_config3 = ServiceConfigImpl::Create(
+      ChannelArgs().Set(GRPC_ARG_DISABLE_PARSING, 1), test_json);
+  ASSERT_TRUE(service_config3.ok()) << service_config3.status();
+  EXPECT_NE(service_config1->get(), service_config3->get());
+}
+
 TEST_F(ServiceConfigTest, SkipMethodConfigWithNoNameOrEmptyName) {
   const char* test_json =
       "{\"methodConfig\": ["
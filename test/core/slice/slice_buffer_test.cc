@@ -20,6 +20,7 @@
 #include <string.h>
 
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "absl/log/check.h"
@@ -76,6 +77,41 @@ TEST(SliceBufferTest, SliceRefTest) {
   sb.Clear();
 }
 
+TEST(SliceBufferTest, CoalesceMergesRunsOfSmallSlices) {
+  SliceBuffer sb;
+  sb.Append(Slice::FromCopiedString("ab"));
+  sb.Append(Slice::FromCopiedString("cd"));
+  sb.Append(Slice::FromCopiedString("ef"));
+  sb.Append(MakeSlice(kNewSliceLength));
+  sb.Append(Slice::FromCopiedString("gh"));
+  sb.Append(Slice::FromCopiedString("ij"));
+  const size_t length_before = sb.Length();
+  std::string contents_before = sb.JoinIntoString();
+  sb.Coalesce(16);
+  ASSERT_EQ(sb.Count(), 3);
+  ASSERT_EQ(sb.Length(), length_before);
+  ASSERT_EQ(sb.JoinIntoString(), contents_before);
+  ASSERT_EQ(sb.RefSlice(0).as_string_view(), "abcdef");
+  ASSERT_EQ(sb.RefSlice(2).as_string_view(), "ghij");
+}
+
+TEST(SliceBufferTest, CoalesceLeavesLoneAndLargeSlicesAlone) {
+  SliceBuffer sb;
+  sb.Append(Slice::FromCopiedString("ab"));
+  sb.Append(MakeSlice(kNewSliceLength));
+  sb.Append(Slice::FromCopiedString("cd"));
+  std::string contents_before = sb.JoinIntoString();
+  sb.Coalesce(16);
+  ASSERT_EQ(sb.Count(), 3);
+  ASSERT_EQ(sb.JoinIntoString(), contents_before);
+  // Threshold of zero disables coalescing entirely.
+  SliceBuffer sb2;
+  sb2.Append(Slice::FromCopiedString("ab"));
+  sb2.Append(Slice::FromCopiedString("cd"));
+  sb2.Coalesce(0);
+  ASSERT_EQ(sb2.Count(), 2);
+}
+
 int main(int argc, char** argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
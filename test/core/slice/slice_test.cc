@@ -64,6 +64,44 @@ TEST(GrpcSliceTest, MallocReturnsSomethingSensible) {
   }
 }
 
+TEST(GrpcSliceTest, InlineBoundaryIsHonored) {
+  // Copies at exactly the inline capacity must stay inlined; one byte more
+  // must spill to a refcounted slice. Written against the macro so it holds
+  // for builds that override GRPC_SLICE_INLINE_EXTRA_SIZE.
+  std::string at_capacity(GRPC_SLICE_INLINED_SIZE, 'x');
+  grpc_slice inlined =
+      grpc_slice_from_copied_buffer(at_capacity.data(), at_capacity.size());
+  EXPECT_EQ(inlined.refcount, nullptr);
+  EXPECT_EQ(GRPC_SLICE_LENGTH(inlined), GRPC_SLICE_INLINED_SIZE);
+
+  std::string over_capacity(GRPC_SLICE_INLINED_SIZE + 1, 'x');
+  grpc_slice refcounted = grpc_slice_from_copied_buffer(over_capacity.data(),
+                                                        over_capacity.size());
+  EXPECT_NE(refcounted.refcount, nullptr);
+
+  // Copy and comparison must agree across the two representations.
+  grpc_slice copy = grpc_slice_copy(inlined);
+  EXPECT_TRUE(grpc_slice_eq(inlined, copy));
+  EXPECT_FALSE(grpc_slice_eq(inlined, refcounted));
+
+  grpc_slice_unref(copy);
+  grpc_slice_unref(refcounted);
+  grpc_slice_unref(inlined);
+}
+
+TEST(GrpcSliceTest, MallocBlocksAreRecycledOnSameThread) {
+  // grpc_slice_malloc pools its refcount+payload blocks per thread; an
+  // unref followed by a same-sized malloc must reuse the block just freed.
+  grpc_slice first = grpc_slice_malloc(1000);
+  memset(GRPC_SLICE_START_PTR(first), 'a', GRPC_SLICE_LENGTH(first));
+  grpc_slice_refcount* refcount = first.refcount;
+  grpc_slice_unref(first);
+  grpc_slice second = grpc_slice_malloc(1000);
+  EXPECT_EQ(second.refcount, refcount);
+  memset(GRPC_SLICE_START_PTR(second), 'b', GRPC_SLICE_LENGTH(second));
+  grpc_slice_unref(second);
+}
+
 static void do_nothing(void* /*ignored*/) {}
 
 TEST(GrpcSliceTest, SliceNewReturnsSomethingSensible) {
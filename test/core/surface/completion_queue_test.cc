@@ -175,6 +175,64 @@ TEST(GrpcCompletionQueueTest, TestCqEndOp) {
   }
 }
 
+TEST(GrpcCompletionQueueTest, TestNextBatch) {
+  grpc_event events[8];
+  grpc_completion_queue* cc;
+  void* tags[4];
+  grpc_cq_completion completions[GPR_ARRAY_SIZE(tags)];
+  grpc_cq_polling_type polling_types[] = {
+      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING};
+  grpc_completion_queue_attributes attr = {};
+
+  LOG_TEST("test_next_batch");
+
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(tags); i++) {
+    tags[i] = create_test_tag();
+  }
+
+  attr.version = 1;
+  attr.cq_completion_type = GRPC_CQ_NEXT;
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(polling_types); i++) {
+    grpc_core::ExecCtx exec_ctx;
+    attr.cq_polling_type = polling_types[i];
+    cc = grpc_completion_queue_create(
+        grpc_completion_queue_factory_lookup(&attr), &attr, nullptr);
+
+    for (size_t j = 0; j < GPR_ARRAY_SIZE(tags); j++) {
+      ASSERT_TRUE(grpc_cq_begin_op(cc, tags[j]));
+      grpc_cq_end_op(cc, tags[j], absl::OkStatus(), do_nothing_end_completion,
+                     nullptr, &completions[j]);
+    }
+
+    // All queued completions should come back in a single batch.
+    size_t n = grpc_completion_queue_next_batch(
+        cc, events, GPR_ARRAY_SIZE(events), gpr_inf_past(GPR_CLOCK_REALTIME),
+        nullptr);
+    ASSERT_EQ(n, GPR_ARRAY_SIZE(tags));
+    for (size_t j = 0; j < n; j++) {
+      ASSERT_EQ(events[j].type, GRPC_OP_COMPLETE);
+      ASSERT_EQ(events[j].tag, tags[j]);
+      ASSERT_TRUE(events[j].success);
+    }
+
+    // An empty queue yields a lone timeout event.
+    n = grpc_completion_queue_next_batch(cc, events, GPR_ARRAY_SIZE(events),
+                                         gpr_inf_past(GPR_CLOCK_REALTIME),
+                                         nullptr);
+    ASSERT_EQ(n, 1);
+    ASSERT_EQ(events[0].type, GRPC_QUEUE_TIMEOUT);
+
+    // After shutdown, a lone shutdown event.
+    grpc_completion_queue_shutdown(cc);
+    n = grpc_completion_queue_next_batch(cc, events, GPR_ARRAY_SIZE(events),
+                                         gpr_inf_future(GPR_CLOCK_REALTIME),
+                                         nullptr);
+    ASSERT_EQ(n, 1);
+    ASSERT_EQ(events[0].type, GRPC_QUEUE_SHUTDOWN);
+    grpc_completion_queue_destroy(cc);
+  }
+}
+
 TEST(GrpcCompletionQueueTest, TestCqTlsCacheFull) {
   grpc_event ev;
   grpc_completion_queue* cc;
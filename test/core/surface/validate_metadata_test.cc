@@ -0,0 +1,82 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/surface/validate_metadata.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/slice/slice.h"
+
+namespace grpc_core {
+namespace {
+
+bool KeyByteIsLegal(uint8_t c) {
+  return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '-' ||
+         c == '_' || c == '.';
+}
+
+bool ValueByteIsLegal(uint8_t c) { return c >= 32 && c <= 126; }
+
+bool ValueIsLegal(const std::string& value) {
+  auto slice = Slice::FromCopiedString(value);
+  return grpc_validate_header_nonbin_value_is_legal(slice.c_slice()).ok();
+}
+
+TEST(ValidateMetadataTest, EmptyKeyIsIllegal) {
+  EXPECT_EQ(ValidateHeaderKeyIsLegal(""),
+            ValidateMetadataResult::kCannotBeZeroLength);
+}
+
+TEST(ValidateMetadataTest, TypicalKeysAreLegal) {
+  EXPECT_EQ(ValidateHeaderKeyIsLegal("content-type"),
+            ValidateMetadataResult::kOk);
+  EXPECT_EQ(ValidateHeaderKeyIsLegal("grpc-timeout"),
+            ValidateMetadataResult::kOk);
+  EXPECT_EQ(ValidateHeaderKeyIsLegal("x-envoy-peer-metadata-id"),
+            ValidateMetadataResult::kOk);
+}
+
+TEST(ValidateMetadataTest, EveryByteValueAtEveryPosition) {
+  // The validators work word-at-a-time over the bulk of the input with a
+  // per-byte tail; sweep each byte value through every offset of an input
+  // long enough to exercise full words, partial tails, and the boundary
+  // between the two.
+  for (size_t len : {1u, 7u, 8u, 9u, 16u, 19u}) {
+    for (size_t pos = 0; pos < len; pos++) {
+      for (int c = 0; c < 256; c++) {
+        std::string key(len, 'a');
+        key[pos] = static_cast<char>(c);
+        const bool legal = KeyByteIsLegal(static_cast<uint8_t>(c));
+        EXPECT_EQ(ValidateHeaderKeyIsLegal(key),
+                  legal ? ValidateMetadataResult::kOk
+                        : ValidateMetadataResult::kIllegalHeaderKey)
+            << "len=" << len << " pos=" << pos << " c=" << c;
+        std::string value(len, 'A');
+        value[pos] = static_cast<char>(c);
+        EXPECT_EQ(ValueIsLegal(value),
+                  ValueByteIsLegal(static_cast<uint8_t>(c)))
+            << "len=" << len << " pos=" << pos << " c=" << c;
+      }
+    }
+  }
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
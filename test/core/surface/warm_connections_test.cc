@@ -0,0 +1,186 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/credentials.h>
+#include <grpc/grpc.h>
+#include <grpc/grpc_security.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/status.h>
+#include <grpc/support/time.h>
+
+#include <string>
+
+#include "gtest/gtest.h"
+#include "src/core/util/host_port.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_config.h"
+
+namespace {
+
+// Smoke tests for grpc_channel_warm_connections: the channel must leave
+// IDLE without any RPC being started, and must re-establish its connection
+// when it later drops back to IDLE.  The tests never pass
+// try_to_connect=true themselves, so every connection attempt they observe
+// was triggered by the warming watcher.
+
+class WarmConnectionsTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    addr_ = grpc_core::JoinHostPort("localhost",
+                                    grpc_pick_unused_port_or_die());
+    cq_ = grpc_completion_queue_create_for_next(nullptr);
+  }
+
+  void TearDown() override {
+    if (channel_ != nullptr) grpc_channel_destroy(channel_);
+    if (server_ != nullptr) {
+      grpc_server_shutdown_and_notify(server_, server_cq_, nullptr);
+      grpc_event ev = grpc_completion_queue_next(
+          server_cq_, grpc_timeout_seconds_to_deadline(5), nullptr);
+      EXPECT_EQ(ev.type, GRPC_OP_COMPLETE);
+      grpc_server_destroy(server_);
+      grpc_completion_queue_shutdown(server_cq_);
+      DrainQueue(server_cq_);
+      grpc_completion_queue_destroy(server_cq_);
+    }
+    grpc_completion_queue_shutdown(cq_);
+    DrainQueue(cq_);
+    grpc_completion_queue_destroy(cq_);
+  }
+
+  // Starts an insecure server; if max_connection_idle_ms is positive the
+  // server closes connections that stay idle that long, which is what
+  // sends a call-less client channel back to IDLE.
+  void StartServer(int max_connection_idle_ms) {
+    grpc_arg arg;
+    grpc_channel_args server_args = {0, nullptr};
+    if (max_connection_idle_ms > 0) {
+      arg = grpc_channel_arg_integer_create(
+          const_cast<char*>(GRPC_ARG_MAX_CONNECTION_IDLE_MS),
+          max_connection_idle_ms);
+      server_args = {1, &arg};
+    }
+    server_ = grpc_server_create(&server_args, nullptr);
+    server_cq_ = grpc_completion_queue_create_for_next(nullptr);
+    grpc_server_register_completion_queue(server_, server_cq_, nullptr);
+    grpc_server_credentials* server_creds =
+        grpc_insecure_server_credentials_create();
+    EXPECT_TRUE(
+        grpc_server_add_http2_port(server_, addr_.c_str(), server_creds));
+    grpc_server_credentials_release(server_creds);
+    grpc_server_start(server_);
+  }
+
+  void CreateChannel() {
+    grpc_channel_credentials* creds = grpc_insecure_credentials_create();
+    channel_ = grpc_channel_create(addr_.c_str(), creds, nullptr);
+    grpc_channel_credentials_release(creds);
+  }
+
+  // Waits for the channel to report target_state, relying only on
+  // watch_connectivity_state (which never initiates a connection).
+  bool WaitForState(grpc_connectivity_state target_state) {
+    gpr_timespec deadline = grpc_timeout_seconds_to_deadline(30);
+    while (true) {
+      grpc_connectivity_state state =
+          grpc_channel_check_connectivity_state(channel_, 0);
+      if (state == target_state) return true;
+      if (gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), deadline) > 0) {
+        return false;
+      }
+      grpc_channel_watch_connectivity_state(channel_, state, deadline, cq_,
+                                            nullptr);
+      grpc_event ev = grpc_completion_queue_next(
+          cq_, gpr_inf_future(GPR_CLOCK_REALTIME), nullptr);
+      EXPECT_EQ(ev.type, GRPC_OP_COMPLETE);
+      if (!ev.success) return false;
+    }
+  }
+
+  // Blocks until the channel reports any state other than "from".
+  void WaitForStateChange(grpc_connectivity_state from) {
+    grpc_channel_watch_connectivity_state(
+        channel_, from, grpc_timeout_seconds_to_deadline(30), cq_, nullptr);
+    grpc_event ev = grpc_completion_queue_next(
+        cq_, gpr_inf_future(GPR_CLOCK_REALTIME), nullptr);
+    ASSERT_EQ(ev.type, GRPC_OP_COMPLETE);
+    ASSERT_TRUE(ev.success);
+  }
+
+  static void DrainQueue(grpc_completion_queue* cq) {
+    while (grpc_completion_queue_next(cq, gpr_inf_future(GPR_CLOCK_REALTIME),
+                                      nullptr)
+               .type != GRPC_QUEUE_SHUTDOWN) {
+    }
+  }
+
+  std::string addr_;
+  grpc_server* server_ = nullptr;
+  grpc_completion_queue* server_cq_ = nullptr;
+  grpc_channel* channel_ = nullptr;
+  grpc_completion_queue* cq_ = nullptr;
+};
+
+TEST_F(WarmConnectionsTest, KicksIdleChannelToReady) {
+  StartServer(/*max_connection_idle_ms=*/0);
+  CreateChannel();
+  // A fresh channel is IDLE and stays there without RPC activity.
+  ASSERT_EQ(grpc_channel_check_connectivity_state(channel_, 0),
+            GRPC_CHANNEL_IDLE);
+  grpc_channel_warm_connections(channel_);
+  // The warming watcher alone must drive the channel to READY.
+  EXPECT_TRUE(WaitForState(GRPC_CHANNEL_READY));
+}
+
+TEST_F(WarmConnectionsTest, ReconnectsWhenConnectionGoesIdle) {
+  // The server closes connections idle for a second, which reports the
+  // call-less client channel back to IDLE.
+  StartServer(/*max_connection_idle_ms=*/1000 * grpc_test_slowdown_factor());
+  CreateChannel();
+  grpc_channel_warm_connections(channel_);
+  ASSERT_TRUE(WaitForState(GRPC_CHANNEL_READY));
+  // Wait for the server to drop the connection...
+  WaitForStateChange(GRPC_CHANNEL_READY);
+  // ...and for the warming watcher to notice the IDLE transition and
+  // connect again, all without any action on the channel.
+  EXPECT_TRUE(WaitForState(GRPC_CHANNEL_READY));
+}
+
+TEST_F(WarmConnectionsTest, DoesNotKeepDestroyedChannelAlive) {
+  // No server: the channel churns through connection attempts.  Destroying
+  // it right after warming must release it cleanly — the watcher holds
+  // only a weak ref, so this would fail under ASAN/refcount checks if it
+  // pinned the channel.
+  CreateChannel();
+  grpc_channel_warm_connections(channel_);
+  grpc_channel_destroy(channel_);
+  channel_ = nullptr;
+}
+
+TEST_F(WarmConnectionsTest, NoOpOnChannelWithoutConnectivityWatching) {
+  channel_ = grpc_lame_client_channel_create(
+      addr_.c_str(), GRPC_STATUS_UNAVAILABLE, "lame channel");
+  grpc_channel_warm_connections(channel_);
+  ASSERT_EQ(grpc_channel_check_connectivity_state(channel_, 0),
+            GRPC_CHANNEL_TRANSIENT_FAILURE);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestGrpcScope grpc_scope;
+  return RUN_ALL_TESTS();
+}
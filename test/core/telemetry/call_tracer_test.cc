@@ -86,6 +86,44 @@ TEST_F(CallTracerTest, BasicServerCallTracerTest) {
   EXPECT_EQ(annotation_logger_, std::vector<std::string>({"Test", "Test"}));
 }
 
+class NoopServerCallTracerFactory : public ServerCallTracerFactory {
+ public:
+  ServerCallTracer* CreateNewServerCallTracer(
+      Arena* /*arena*/, const ChannelArgs& /*channel_args*/) override {
+    return nullptr;
+  }
+};
+
+TEST_F(CallTracerTest, TracingSampleRateFromChannelArgs) {
+  NoopServerCallTracerFactory factory;
+  EXPECT_EQ(factory.TracingSampleRate(ChannelArgs()), 1.0);
+  EXPECT_EQ(factory.TracingSampleRate(ChannelArgs().Set(
+                ServerCallTracerFactory::SampleRateChannelArgName(), "0.01")),
+            0.01);
+  // Out-of-range rates are clamped and malformed rates ignored.
+  EXPECT_EQ(factory.TracingSampleRate(ChannelArgs().Set(
+                ServerCallTracerFactory::SampleRateChannelArgName(), "7.5")),
+            1.0);
+  EXPECT_EQ(factory.TracingSampleRate(ChannelArgs().Set(
+                ServerCallTracerFactory::SampleRateChannelArgName(), "-1")),
+            0.0);
+  EXPECT_EQ(factory.TracingSampleRate(ChannelArgs().Set(
+                ServerCallTracerFactory::SampleRateChannelArgName(), "bogus")),
+            1.0);
+}
+
+TEST_F(CallTracerTest, ShouldSampleCallShortCircuits) {
+  EXPECT_TRUE(ServerCallTracerFactory::ShouldSampleCall(1.0));
+  EXPECT_FALSE(ServerCallTracerFactory::ShouldSampleCall(0.0));
+  // A mid-range rate samples some calls but not all of them.
+  int sampled = 0;
+  for (int i = 0; i < 1000; ++i) {
+    if (ServerCallTracerFactory::ShouldSampleCall(0.5)) ++sampled;
+  }
+  EXPECT_GT(sampled, 0);
+  EXPECT_LT(sampled, 1000);
+}
+
 TEST_F(CallTracerTest, MultipleServerCallTracers) {
   promise_detail::Context<Arena> arena_ctx(arena_.get());
   FakeServerCallTracer server_call_tracer1(&annotation_logger_);
@@ -81,6 +81,30 @@ TEST_F(MetricsTest, UInt64Counter) {
               ::testing::Optional(6));
 }
 
+TEST_F(MetricsTest, UInt64CounterWithLabelSet) {
+  auto uint64_counter_handle =
+      GlobalInstrumentsRegistry::RegisterUInt64Counter(
+          "uint64_counter", "A simple uint64 counter.", "unit", true)
+          .Labels("label_key_1", "label_key_2")
+          .OptionalLabels("optional_label_key_1", "optional_label_key_2")
+          .Build();
+  std::array<absl::string_view, 2> kLabelValues = {"label_value_1",
+                                                   "label_value_2"};
+  std::array<absl::string_view, 2> kOptionalLabelValues = {
+      "optional_label_value_1", "optional_label_value_2"};
+  constexpr absl::string_view kDomain1To4 = "domain1.domain2.domain3.domain4";
+  auto plugin = MakeStatsPluginForTarget(kDomain1To4);
+  auto group = GlobalStatsPluginRegistry::GetStatsPluginsForChannel(
+      StatsPluginChannelScope(kDomain1To4, "", endpoint_config_));
+  auto label_set = group->MakeLabelSet(uint64_counter_handle, kLabelValues,
+                                       kOptionalLabelValues);
+  group->AddCounter(*label_set, uint64_t(1));
+  group->AddCounter(*label_set, uint64_t(2));
+  EXPECT_THAT(plugin->GetUInt64CounterValue(uint64_counter_handle, kLabelValues,
+                                            kOptionalLabelValues),
+              ::testing::Optional(3));
+}
+
 TEST_F(MetricsTest, DoubleCounter) {
   auto double_counter_handle =
       GlobalInstrumentsRegistry::RegisterDoubleCounter(
@@ -161,6 +185,30 @@ TEST_F(MetricsTest, UInt64Histogram) {
               ::testing::Optional(::testing::UnorderedElementsAre(1, 2, 3)));
 }
 
+TEST_F(MetricsTest, UInt64HistogramWithLabelSet) {
+  auto uint64_histogram_handle =
+      GlobalInstrumentsRegistry::RegisterUInt64Histogram(
+          "uint64_histogram", "A simple uint64 histogram.", "unit", true)
+          .Labels("label_key_1", "label_key_2")
+          .OptionalLabels("optional_label_key_1", "optional_label_key_2")
+          .Build();
+  std::array<absl::string_view, 2> kLabelValues = {"label_value_1",
+                                                   "label_value_2"};
+  std::array<absl::string_view, 2> kOptionalLabelValues = {
+      "optional_label_value_1", "optional_label_value_2"};
+  constexpr absl::string_view kDomain1To4 = "domain1.domain2.domain3.domain4";
+  auto plugin = MakeStatsPluginForTarget(kDomain1To4);
+  auto group = GlobalStatsPluginRegistry::GetStatsPluginsForChannel(
+      StatsPluginChannelScope(kDomain1To4, "", endpoint_config_));
+  auto label_set = group->MakeLabelSet(uint64_histogram_handle, kLabelValues,
+                                       kOptionalLabelValues);
+  group->RecordHistogram(*label_set, uint64_t(1));
+  group->RecordHistogram(*label_set, uint64_t(2));
+  EXPECT_THAT(plugin->GetUInt64HistogramValue(
+                  uint64_histogram_handle, kLabelValues, kOptionalLabelValues),
+              ::testing::Optional(::testing::UnorderedElementsAre(1, 2)));
+}
+
 TEST_F(MetricsTest, DoubleHistogram) {
   auto double_histogram_handle =
       GlobalInstrumentsRegistry::RegisterDoubleHistogram(
@@ -0,0 +1,163 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "test/core/test_util/allocation_counter.h"
+
+#include <grpc/support/port_platform.h>
+#include <stdlib.h>
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+#include "absl/log/log.h"
+#include "absl/strings/numbers.h"
+#include "src/core/util/env.h"
+
+namespace {
+
+std::atomic<uint64_t> g_allocation_count{0};
+
+void* CountingAlloc(size_t size) {
+  g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+  return malloc(size);
+}
+
+// Aligned allocations get their own free path because Windows pairs
+// _aligned_malloc with _aligned_free; the align_val_t operator delete
+// overloads below are only ever invoked for aligned allocations, so the
+// pairing holds.
+void* CountingAlignedAlloc(size_t size, size_t alignment) {
+  g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+#ifdef GPR_WINDOWS
+  return _aligned_malloc(size, alignment);
+#else
+  void* ptr = nullptr;
+  if (posix_memalign(&ptr, alignment, size) != 0) return nullptr;
+  return ptr;
+#endif
+}
+
+void CountingFree(void* ptr) { free(ptr); }
+
+void CountingAlignedFree(void* ptr) {
+#ifdef GPR_WINDOWS
+  _aligned_free(ptr);
+#else
+  free(ptr);
+#endif
+}
+
+}  // namespace
+
+namespace grpc_core {
+namespace testing {
+
+uint64_t TotalAllocationCount() {
+  return g_allocation_count.load(std::memory_order_relaxed);
+}
+
+double CheckAllocsPerIteration(uint64_t allocations_before,
+                               uint64_t iterations,
+                               const char* benchmark_name,
+                               const char* golden_env_var) {
+  if (iterations == 0) return 0;
+  const uint64_t delta = TotalAllocationCount() - allocations_before;
+  const double allocs_per_iteration =
+      static_cast<double>(delta) / static_cast<double>(iterations);
+  if (golden_env_var != nullptr) {
+    auto golden = GetEnv(golden_env_var);
+    double max_allocs;
+    if (golden.has_value() && absl::SimpleAtod(*golden, &max_allocs) &&
+        allocs_per_iteration > max_allocs) {
+      LOG(FATAL) << benchmark_name << ": " << allocs_per_iteration
+                 << " allocations per iteration exceeds the golden value of "
+                 << max_allocs << " from $" << golden_env_var;
+    }
+  }
+  return allocs_per_iteration;
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+// Global allocator replacements. Defining these here (rather than hooking
+// malloc) keeps the harness portable; C++ allocations dominate the paths we
+// gate, and gpr_malloc-based allocations in core are deliberate enough to
+// be reviewed when they change.
+
+void* operator new(std::size_t size) {
+  void* p = CountingAlloc(size);
+  if (p == nullptr) throw std::bad_alloc();
+  return p;
+}
+
+void* operator new[](std::size_t size) {
+  void* p = CountingAlloc(size);
+  if (p == nullptr) throw std::bad_alloc();
+  return p;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  return CountingAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+  return CountingAlloc(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  void* p = CountingAlignedAlloc(size, static_cast<size_t>(alignment));
+  if (p == nullptr) throw std::bad_alloc();
+  return p;
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  void* p = CountingAlignedAlloc(size, static_cast<size_t>(alignment));
+  if (p == nullptr) throw std::bad_alloc();
+  return p;
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment,
+                   const std::nothrow_t&) noexcept {
+  return CountingAlignedAlloc(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment,
+                     const std::nothrow_t&) noexcept {
+  return CountingAlignedAlloc(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept { CountingFree(ptr); }
+void operator delete[](void* ptr) noexcept { CountingFree(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { CountingFree(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { CountingFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+  CountingFree(ptr);
+}
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+  CountingFree(ptr);
+}
+void operator delete(void* ptr, std::align_val_t) noexcept {
+  CountingAlignedFree(ptr);
+}
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+  CountingAlignedFree(ptr);
+}
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+  CountingAlignedFree(ptr);
+}
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept {
+  CountingAlignedFree(ptr);
+}
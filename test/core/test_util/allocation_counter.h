@@ -0,0 +1,57 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_TEST_CORE_TEST_UTIL_ALLOCATION_COUNTER_H
+#define GRPC_TEST_CORE_TEST_UTIL_ALLOCATION_COUNTER_H
+
+#include <stdint.h>
+
+// Allocation-counting harness for benchmarks.
+//
+// Linking //test/core/test_util:allocation_counter into a binary replaces
+// the global operator new/delete family with versions that bump a
+// process-wide counter, so benchmarks can report allocations-per-iteration
+// alongside time (e.g. allocs per RPC, per streaming message, per LB pick)
+// and CI can pin them to golden values.
+//
+// The count covers every thread in the process: RPC work performed on
+// EventEngine threads between two reads from the benchmark thread is
+// included, but so is unrelated background activity (timer ticks,
+// resolution), so golden values should carry a little slack.
+
+namespace grpc_core {
+namespace testing {
+
+// Total allocations (operator new and friends) made by the process so far.
+// Defined in the same translation unit as the operator new replacements,
+// so any binary that calls this is guaranteed to link the counting
+// allocator too.
+uint64_t TotalAllocationCount();
+
+// Computes allocations per iteration since `allocations_before` (a prior
+// TotalAllocationCount() reading) and returns it for reporting via
+// benchmark counters. If `golden_env_var` is non-null and that environment
+// variable is set to a number, crashes when the per-iteration count
+// exceeds it — this is the PR-time regression gate; goldens live in the CI
+// invocation, not in code, so platform and build-mode differences can get
+// different bounds.
+double CheckAllocsPerIteration(uint64_t allocations_before,
+                               uint64_t iterations,
+                               const char* benchmark_name,
+                               const char* golden_env_var);
+
+}  // namespace testing
+}  // namespace grpc_core
+
+#endif  // GRPC_TEST_CORE_TEST_UTIL_ALLOCATION_COUNTER_H
@@ -0,0 +1,81 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/chunk_size_tuner.h"
+
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace {
+
+TEST(ChunkSizeTunerTest, UnmeasuredReturnsMax) {
+  ChunkSizeTuner tuner;
+  EXPECT_EQ(tuner.ChunkSize(1024 * 1024, 64), 1024 * 1024u);
+  EXPECT_EQ(tuner.ChunkSize(0, 64), 0u);
+}
+
+TEST(ChunkSizeTunerTest, TracksBandwidthDelayProduct) {
+  ChunkSizeTuner tuner;
+  // 0.256 bytes/ns over a 1ms rtt ==> 256kB bdp.
+  tuner.MeasureNetwork(1000, 0.256);
+  EXPECT_EQ(tuner.ChunkSize(1024 * 1024, 0), 256 * 1024u);
+}
+
+TEST(ChunkSizeTunerTest, ClampsToNegotiatedMax) {
+  ChunkSizeTuner tuner;
+  tuner.MeasureNetwork(1000000, 1.0);  // huge bdp
+  EXPECT_EQ(tuner.ChunkSize(1024 * 1024, 64), 1024 * 1024u);
+}
+
+TEST(ChunkSizeTunerTest, NeverShrinksBelowMinimum) {
+  ChunkSizeTuner tuner;
+  tuner.MeasureNetwork(10, 0.001);  // tiny bdp
+  EXPECT_EQ(tuner.ChunkSize(1024 * 1024, 64), 16 * 1024u);
+}
+
+TEST(ChunkSizeTunerTest, SmallMaxBypassesAdaptation) {
+  ChunkSizeTuner tuner;
+  tuner.MeasureNetwork(1000, 0.256);
+  // A negotiated max below the adaptive floor (e.g. test configs with one
+  // byte chunks) is passed through untouched.
+  EXPECT_EQ(tuner.ChunkSize(1, 1), 1u);
+}
+
+TEST(ChunkSizeTunerTest, ContentionDividesTheTarget) {
+  ChunkSizeTuner tuner;
+  tuner.MeasureNetwork(1000, 0.256);  // 256kB bdp
+  tuner.MeasureContention(4);
+  EXPECT_EQ(tuner.ChunkSize(1024 * 1024, 0), 64 * 1024u);
+  tuner.MeasureContention(0);  // treated as one stream
+  EXPECT_EQ(tuner.ChunkSize(1024 * 1024, 0), 256 * 1024u);
+}
+
+TEST(ChunkSizeTunerTest, RoundsDownToAlignment) {
+  ChunkSizeTuner tuner;
+  tuner.MeasureNetwork(1000, 0.256);  // 256kB bdp
+  tuner.MeasureContention(3);
+  const uint32_t chunk_size = tuner.ChunkSize(1024 * 1024, 64);
+  EXPECT_EQ(chunk_size % 64, 0u);
+  EXPECT_LE(chunk_size, 256 * 1024u / 3);
+}
+
+}  // namespace
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -155,7 +155,8 @@ grpc_event_engine::experimental::Slice PaddingBytes(uint32_t padding) {
       buffer.data(), buffer.size());
 }
 
-MpscQueued<chaotic_good::OutgoingFrame> TestFrame(absl::string_view payload) {
+MpscQueued<chaotic_good::OutgoingFrame> TestFrame(absl::string_view payload,
+                                                  uint32_t stream_id = 1) {
   // We create an mpsc receiver that we can funnel frames through to get them
   // properly wrapped in an MpscQueued so that we don't need to special case
   // resource reclamation for DataEndpoints.
@@ -164,8 +165,8 @@ MpscQueued<chaotic_good::OutgoingFrame> TestFrame(absl::string_view payload) {
   static Mutex* mu = new Mutex();
   MutexLock lock(mu);
   chaotic_good::MessageFrame frame(
-      1, Arena::MakePooled<Message>(
-             SliceBuffer(Slice::FromCopiedString(payload)), 0));
+      stream_id, Arena::MakePooled<Message>(
+                     SliceBuffer(Slice::FromCopiedString(payload)), 0));
   frames->MakeSender().UnbufferedImmediateSend(
       chaotic_good::OutgoingFrame{std::move(frame), nullptr}, 1);
   return std::move(*frames->Next()().value());
@@ -239,7 +240,7 @@ DATA_ENDPOINTS_TEST(CanWrite) {
       MakeRefCounted<chaotic_good::TransportContext>(
           event_engine(), MakeTestChannelzSocketNode()),
       64, 64, std::make_shared<chaotic_good::TcpZTraceCollector>(), false,
-      "rand", Time1Clock());
+      "rand", 64 * 1024, Time1Clock());
   ep.ExpectWrite(
       {DataFrameHeader(64, 123, 1, 5),
        grpc_event_engine::experimental::Slice::FromCopiedString("hello"),
@@ -251,6 +252,37 @@ DATA_ENDPOINTS_TEST(CanWrite) {
   WaitForAllPendingWork();
 }
 
+DATA_ENDPOINTS_TEST(CanAddEndpointLater) {
+  util::testing::MockPromiseEndpoint ep(1234);
+  EXPECT_CALL(*ep.endpoint, GetPeerAddress())
+      .WillRepeatedly(::testing::ReturnRef(GetPeerAddress()));
+  EXPECT_CALL(*ep.endpoint, GetLocalAddress())
+      .WillRepeatedly(::testing::ReturnRef(GetLocalAddress()));
+  ExportMockTelemetryInfo(ep);
+  auto close_ep = ep.ExpectDelayedReadClose(absl::UnavailableError("test done"),
+                                            event_engine().get());
+  // Start with no endpoints at all: writes must queue until one is added.
+  chaotic_good::DataEndpoints data_endpoints(
+      Endpoints(),
+      MakeRefCounted<chaotic_good::TransportContext>(
+          event_engine(), MakeTestChannelzSocketNode()),
+      64, 64, std::make_shared<chaotic_good::TcpZTraceCollector>(), false,
+      "rand", 64 * 1024, Time1Clock());
+  EXPECT_EQ(data_endpoints.endpoint_count(), 0);
+  ep.ExpectWrite(
+      {DataFrameHeader(64, 123, 1, 5),
+       grpc_event_engine::experimental::Slice::FromCopiedString("hello"),
+       PaddingBytes(64 - 5)},
+      event_engine().get());
+  data_endpoints.Write(123, TestFrame("hello"));
+  data_endpoints.AddEndpoint(chaotic_good::ImmediateConnection(
+      "late", std::move(ep.promise_endpoint)));
+  EXPECT_EQ(data_endpoints.endpoint_count(), 1);
+  WaitForAllPendingWork();
+  close_ep();
+  WaitForAllPendingWork();
+}
+
 DATA_ENDPOINTS_TEST(CanMultiWrite) {
   util::testing::MockPromiseEndpoint ep1(1234);
   util::testing::MockPromiseEndpoint ep2(1235);
@@ -274,7 +306,7 @@ DATA_ENDPOINTS_TEST(CanMultiWrite) {
       MakeRefCounted<chaotic_good::TransportContext>(
           event_engine(), MakeTestChannelzSocketNode()),
       64, 64, std::make_shared<chaotic_good::TcpZTraceCollector>(), false,
-      "spanrr", Time1Clock());
+      "spanrr", 64 * 1024, Time1Clock());
   SliceBuffer writes;
   ep1.CaptureWrites(writes, event_engine().get());
   ep2.CaptureWrites(writes, event_engine().get());
@@ -307,6 +339,57 @@ DATA_ENDPOINTS_TEST(CanMultiWrite) {
                        expected(124, "world") + expected(123, "hello")));
 }
 
+DATA_ENDPOINTS_TEST(InterleavesCompetingStreams) {
+  util::testing::MockPromiseEndpoint ep(1234);
+  EXPECT_CALL(*ep.endpoint, GetPeerAddress())
+      .WillRepeatedly(::testing::ReturnRef(GetPeerAddress()));
+  EXPECT_CALL(*ep.endpoint, GetLocalAddress())
+      .WillRepeatedly(::testing::ReturnRef(GetLocalAddress()));
+  ExportMockTelemetryInfo(ep);
+  auto close_ep = ep.ExpectDelayedReadClose(absl::UnavailableError("test done"),
+                                            event_engine().get());
+  // Quantum of exactly one frame's wire size (64 byte header + 64 byte
+  // payload) so each stream places one frame per round robin turn.
+  chaotic_good::DataEndpoints data_endpoints(
+      Endpoints(std::move(ep.promise_endpoint)),
+      MakeRefCounted<chaotic_good::TransportContext>(
+          event_engine(), MakeTestChannelzSocketNode()),
+      64, 64, std::make_shared<chaotic_good::TcpZTraceCollector>(), false,
+      "spanrr", 128, Time1Clock());
+  SliceBuffer writes;
+  ep.CaptureWrites(writes, event_engine().get());
+  // Stream 1 queues a deep backlog before stream 2's single frame arrives.
+  data_endpoints.Write(1, TestFrame("aaaaa", 1));
+  data_endpoints.Write(2, TestFrame("bbbbb", 1));
+  data_endpoints.Write(3, TestFrame("ccccc", 1));
+  data_endpoints.Write(4, TestFrame("small", 2));
+  TickUntilTrue([&]() { return writes.Length() == 4 * (64 + 64); });
+  WaitForAllPendingWork();
+  close_ep();
+  WaitForAllPendingWork();
+  auto expected = [](uint64_t payload_tag, std::string payload) {
+    auto padding = [](uint32_t padding) {
+      std::vector<uint8_t> buffer(padding);
+      return Slice::FromCopiedBuffer(buffer.data(), buffer.size());
+    };
+    SliceBuffer buffer;
+    chaotic_good::TcpDataFrameHeader{payload_tag, 1,
+                                     static_cast<uint32_t>(payload.length())}
+        .Serialize(
+            buffer.AddTiny(chaotic_good::TcpDataFrameHeader::kFrameHeaderSize));
+    buffer.Append(
+        padding(64 - chaotic_good::TcpDataFrameHeader::kFrameHeaderSize));
+    buffer.Append(Slice::FromCopiedBuffer(payload));
+    buffer.Append(padding(64 - payload.length()));
+    return buffer.JoinIntoString();
+  };
+  // Deficit round robin places stream 2's frame after stream 1's first frame
+  // rather than behind stream 1's whole backlog.
+  EXPECT_EQ(writes.JoinIntoString(),
+            expected(1, "aaaaa") + expected(4, "small") +
+                expected(2, "bbbbb") + expected(3, "ccccc"));
+}
+
 DATA_ENDPOINTS_TEST(CanRead) {
   util::testing::MockPromiseEndpoint ep(1234);
   EXPECT_CALL(*ep.endpoint, GetPeerAddress())
@@ -326,7 +409,7 @@ DATA_ENDPOINTS_TEST(CanRead) {
       MakeRefCounted<chaotic_good::TransportContext>(
           event_engine(), MakeTestChannelzSocketNode()),
       64, 64, std::make_shared<chaotic_good::TcpZTraceCollector>(), false,
-      "spanrr", Time1Clock());
+      "spanrr", 64 * 1024, Time1Clock());
   SpawnTestSeqWithoutContext("read", data_endpoints.Read(5).Await(),
                              [](absl::StatusOr<SliceBuffer> result) {
                                EXPECT_TRUE(result.ok());
@@ -356,7 +439,7 @@ DATA_ENDPOINTS_TEST(CanWriteSecurityFrame) {
       MakeRefCounted<chaotic_good::TransportContext>(
           event_engine(), MakeTestChannelzSocketNode()),
       64, 64, std::make_shared<chaotic_good::TcpZTraceCollector>(), false,
-      "rand", Time1Clock());
+      "rand", 64 * 1024, Time1Clock());
   ::testing::Mock::VerifyAndClearExpectations(
       transport_framing_endpoint_extension);
   ep.ExpectWrite({DataFrameHeader(64, 0, 0, strlen("security_frame_bytes")),
@@ -401,7 +484,7 @@ DATA_ENDPOINTS_TEST(CanReadSecurityFrame) {
       MakeRefCounted<chaotic_good::TransportContext>(
           event_engine(), MakeTestChannelzSocketNode()),
       64, 64, std::make_shared<chaotic_good::TcpZTraceCollector>(), false,
-      "rand", Time1Clock());
+      "rand", 64 * 1024, Time1Clock());
   SpawnTestSeqWithoutContext(
       "read",
       [&data_endpoints]() {
@@ -0,0 +1,196 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/decode_huff_fast.h"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/core/ext/transport/chttp2/transport/decode_huff.h"
+#include "src/core/ext/transport/chttp2/transport/huffsyms.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr int kEosSym = 256;
+
+// HPACK Huffman encoder built directly from the symbol table, so tests can
+// inject the EOS symbol mid-stream (grpc_chttp2_huffman_compress cannot).
+class Encoder {
+ public:
+  void Add(int sym) {
+    const auto& hs = grpc_chttp2_huffsyms[sym];
+    acc_ = (acc_ << hs.length) | hs.bits;
+    nbits_ += hs.length;
+    while (nbits_ >= 8) {
+      out_.push_back(static_cast<uint8_t>(acc_ >> (nbits_ - 8)));
+      nbits_ -= 8;
+    }
+  }
+
+  // True if the symbols added so far fill a whole number of bytes.
+  bool aligned() const { return nbits_ == 0; }
+
+  // Pads the final partial byte with ones, per RFC 7541 §5.2 (or, for
+  // building invalid inputs, with zeros).
+  std::vector<uint8_t> Finish(bool pad_with_ones = true) {
+    if (nbits_ > 0) {
+      const uint8_t padding =
+          pad_with_ones ? static_cast<uint8_t>((1u << (8 - nbits_)) - 1) : 0;
+      out_.push_back(static_cast<uint8_t>((acc_ << (8 - nbits_)) | padding));
+      nbits_ = 0;
+    }
+    return out_;
+  }
+
+ private:
+  uint64_t acc_ = 0;
+  int nbits_ = 0;
+  std::vector<uint8_t> out_;
+};
+
+std::vector<uint8_t> Encode(const std::vector<uint8_t>& syms,
+                            int eos_at = -1) {
+  Encoder enc;
+  for (size_t i = 0; i < syms.size(); i++) {
+    if (static_cast<int>(i) == eos_at) enc.Add(kEosSym);
+    enc.Add(syms[i]);
+  }
+  if (eos_at == static_cast<int>(syms.size())) enc.Add(kEosSym);
+  return enc.Finish();
+}
+
+std::optional<std::vector<uint8_t>> DecodeGenerated(
+    const std::vector<uint8_t>& input) {
+  std::vector<uint8_t> v;
+  auto f = [&](uint8_t x) { v.push_back(x); };
+  if (!HuffDecoder<decltype(f)>(f, input.data(), input.data() + input.size())
+           .Run()) {
+    return std::nullopt;
+  }
+  return v;
+}
+
+std::optional<std::vector<uint8_t>> DecodeWide(
+    const std::vector<uint8_t>& input) {
+  std::vector<uint8_t> v;
+  auto f = [&](uint8_t x) { v.push_back(x); };
+  if (!HuffDecoderFast<decltype(f)>(f, input.data(),
+                                    input.data() + input.size())
+           .Run()) {
+    return std::nullopt;
+  }
+  return v;
+}
+
+// Asserts the wide decoder agrees with the generated one on accept/reject
+// and output, and returns the (common) result.
+std::optional<std::vector<uint8_t>> DecodeBoth(
+    const std::vector<uint8_t>& input) {
+  auto generated = DecodeGenerated(input);
+  auto wide = DecodeWide(input);
+  EXPECT_EQ(wide, generated);
+  return generated;
+}
+
+std::vector<uint8_t> PatternSyms(size_t length) {
+  std::vector<uint8_t> syms;
+  for (size_t i = 0; i < length; i++) {
+    syms.push_back(static_cast<uint8_t>(i * 13));
+  }
+  return syms;
+}
+
+// Encoded lengths here span the wide decoder's 16 byte bulk-loop threshold,
+// so both its tail-only and bulk+tail paths are exercised.
+TEST(DecodeHuffFastTest, RoundTripsAtBoundaryLengths) {
+  for (size_t length = 0; length <= 48; length++) {
+    const auto syms = PatternSyms(length);
+    EXPECT_EQ(DecodeBoth(Encode(syms)), syms) << "length=" << length;
+  }
+}
+
+TEST(DecodeHuffFastTest, RoundTripsAllSymbols) {
+  std::vector<uint8_t> syms;
+  for (int i = 0; i < 256; i++) syms.push_back(static_cast<uint8_t>(i));
+  EXPECT_EQ(DecodeBoth(Encode(syms)), syms);
+}
+
+// A literal EOS symbol ends decoding successfully, discarding whatever
+// follows it; both decoders must truncate identically.
+TEST(DecodeHuffFastTest, LiteralEosTruncates) {
+  for (size_t length : {0, 1, 15, 16, 17, 40}) {
+    const auto syms = PatternSyms(length);
+    for (size_t pos = 0; pos <= length; pos++) {
+      auto result = DecodeBoth(Encode(syms, static_cast<int>(pos)));
+      ASSERT_TRUE(result.has_value())
+          << "length=" << length << " pos=" << pos;
+      EXPECT_EQ(*result, std::vector<uint8_t>(syms.begin(),
+                                              syms.begin() + pos))
+          << "length=" << length << " pos=" << pos;
+    }
+  }
+}
+
+// Returns some symbol with a 5 bit code, so streams built from runs of it
+// have a known bit length (and hence a known padding length).
+uint8_t FiveBitSym() {
+  for (int sym = 0; sym < GRPC_CHTTP2_NUM_HUFFSYMS; sym++) {
+    if (grpc_chttp2_huffsyms[sym].length == 5) {
+      return static_cast<uint8_t>(sym);
+    }
+  }
+  abort();
+}
+
+// Padding bits that are not all ones make the string invalid.  Runs of n
+// 5 bit symbols leave (8 - 5n mod 8) mod 8 padding bits; for the chosen n
+// that is 1, 2, 3 or 6, so zero padding either matches no code at all or
+// (at 6 bits) decodes one spurious symbol and still leaves a non-all-ones
+// remainder — both decoders must reject every case.
+TEST(DecodeHuffFastTest, InvalidPaddingRejected) {
+  const uint8_t sym = FiveBitSym();
+  for (size_t n : {1, 2, 3, 6, 25, 26, 27, 50}) {
+    Encoder enc;
+    for (size_t i = 0; i < n; i++) enc.Add(sym);
+    ASSERT_FALSE(enc.aligned()) << "n=" << n;
+    EXPECT_EQ(DecodeBoth(enc.Finish(/*pad_with_ones=*/false)), std::nullopt)
+        << "n=" << n;
+  }
+}
+
+// RFC 7541 §5.2 caps padding at 7 bits, but the generated decoder has
+// always tolerated longer all-ones runs (they are EOS prefixes); the wide
+// decoder must be exactly as lenient so that a string's validity does not
+// depend on which decoder its length selects.
+TEST(DecodeHuffFastTest, LongAllOnesPaddingAccepted) {
+  for (size_t length : {1, 15, 16, 17, 40}) {
+    const auto syms = PatternSyms(length);
+    auto encoded = Encode(syms);
+    encoded.push_back(0xff);
+    EXPECT_EQ(DecodeBoth(encoded), syms) << "length=" << length;
+    encoded.push_back(0xff);
+    EXPECT_EQ(DecodeBoth(encoded), syms) << "length=" << length;
+  }
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -179,6 +179,30 @@ TEST_F(FlowControlTest, RecvData) {
             prev_preferred_rx_frame_size);
 }
 
+TEST_F(FlowControlTest, DeliveryRateGrowsWindowTarget) {
+  ExecCtx exec_ctx;
+  TransportFlowControl tfc("test", true, &memory_owner_);
+  StreamFlowControl sfc(&tfc);
+  const Timestamp start = Timestamp::Now();
+  {
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&sfc);
+    EXPECT_EQ(sfc_upd.RecvData(16384), absl::OkStatus());
+    std::ignore = sfc_upd.MakeAction();
+  }
+  EXPECT_EQ(sfc.delivery_rate_window_target(), 0);
+  // Complete a measurement period: the stream should now earn window
+  // proportional to its delivery rate, bounded by the transport target.
+  exec_ctx.TestOnlySetNow(start + Duration::Milliseconds(150));
+  {
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&sfc);
+    EXPECT_EQ(sfc_upd.RecvData(16384), absl::OkStatus());
+    std::ignore = sfc_upd.MakeAction();
+  }
+  EXPECT_GT(sfc.delivery_rate_window_target(), 0);
+  EXPECT_LE(sfc.delivery_rate_window_target(),
+            std::min(kMaxWindowDelta, tfc.target_window()));
+}
+
 TEST_F(FlowControlTest, TrackMinProgressSize) {
   ExecCtx exec_ctx;
   TransportFlowControl tfc("test", true, &memory_owner_);
@@ -0,0 +1,121 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/frame_data.h"
+
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/core/ext/transport/chttp2/transport/http2_ztrace_collector.h"
+#include "src/core/telemetry/call_tracer.h"
+
+namespace grpc_core {
+namespace {
+
+class FakeCallTracer final : public CallTracerInterface {
+ public:
+  void RecordIncomingBytes(
+      const TransportByteSize& /*transport_byte_size*/) override {}
+  void RecordOutgoingBytes(
+      const TransportByteSize& /*transport_byte_size*/) override {}
+  void RecordSendInitialMetadata(
+      grpc_metadata_batch* /*send_initial_metadata*/) override {}
+  void RecordSendTrailingMetadata(
+      grpc_metadata_batch* /*send_trailing_metadata*/) override {}
+  void RecordSendMessage(const Message& /*send_message*/) override {}
+  void RecordSendCompressedMessage(
+      const Message& /*send_compressed_message*/) override {}
+  void RecordReceivedInitialMetadata(
+      grpc_metadata_batch* /*recv_initial_metadata*/) override {}
+  void RecordReceivedMessage(const Message& /*recv_message*/) override {}
+  void RecordReceivedDecompressedMessage(
+      const Message& /*recv_decompressed_message*/) override {}
+  void RecordCancel(grpc_error_handle /*cancel_error*/) override {}
+  std::shared_ptr<TcpCallTracer> StartNewTcpTrace() override {
+    return nullptr;
+  }
+  void RecordAnnotation(absl::string_view /*annotation*/) override {}
+  void RecordAnnotation(const Annotation& /*annotation*/) override {}
+  std::string TraceId() override { return ""; }
+  std::string SpanId() override { return ""; }
+  bool IsSampled() override { return false; }
+};
+
+// A large refcounted payload must ride through grpc_chttp2_encode_data by
+// reference: the bytes that land in outbuf alias the original allocation.
+TEST(EncodeDataTest, LargePayloadIsReferencedNotCopied) {
+  constexpr size_t kPayloadSize = 1024 * 1024;
+  grpc_slice_buffer inbuf;
+  grpc_slice_buffer outbuf;
+  grpc_slice_buffer_init(&inbuf);
+  grpc_slice_buffer_init(&outbuf);
+
+  std::vector<char> big(kPayloadSize, 'x');
+  grpc_slice payload = grpc_slice_from_copied_buffer(big.data(), big.size());
+  const uint8_t* payload_bytes = GRPC_SLICE_START_PTR(payload);
+  grpc_slice_buffer_add(&inbuf, payload);
+
+  FakeCallTracer call_tracer;
+  Http2ZTraceCollector ztrace_collector;
+  grpc_chttp2_encode_data(1, &inbuf, kPayloadSize, /*is_eof=*/false,
+                          &call_tracer, &ztrace_collector, &outbuf);
+
+  EXPECT_EQ(outbuf.length, 9 + kPayloadSize);
+  bool found_referenced_payload = false;
+  for (size_t i = 0; i < outbuf.count; i++) {
+    if (GRPC_SLICE_START_PTR(outbuf.slices[i]) == payload_bytes) {
+      found_referenced_payload = true;
+    }
+  }
+  EXPECT_TRUE(found_referenced_payload);
+
+  grpc_slice_buffer_destroy(&inbuf);
+  grpc_slice_buffer_destroy(&outbuf);
+}
+
+// The 9 byte frame header must not allocate: it lands in inline slice
+// storage at the tail of outbuf.
+TEST(EncodeDataTest, FrameHeaderUsesInlineStorage) {
+  grpc_slice_buffer inbuf;
+  grpc_slice_buffer outbuf;
+  grpc_slice_buffer_init(&inbuf);
+  grpc_slice_buffer_init(&outbuf);
+
+  grpc_slice payload = grpc_slice_from_copied_string("hello");
+  grpc_slice_buffer_add(&inbuf, payload);
+
+  FakeCallTracer call_tracer;
+  Http2ZTraceCollector ztrace_collector;
+  grpc_chttp2_encode_data(1, &inbuf, 5, /*is_eof=*/true, &call_tracer,
+                          &ztrace_collector, &outbuf);
+
+  ASSERT_GE(outbuf.count, 1u);
+  EXPECT_EQ(outbuf.slices[0].refcount, nullptr);
+  EXPECT_EQ(outbuf.length, 9 + 5u);
+
+  grpc_slice_buffer_destroy(&inbuf);
+  grpc_slice_buffer_destroy(&outbuf);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
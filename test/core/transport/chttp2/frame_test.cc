@@ -1045,6 +1045,57 @@ TEST(Frame, ParseRejectsWindowUpdateFrameZeroIncrement) {
               "{WINDOW_UPDATE: flags=0, stream_id=2147483647, length=4}")));
 }
 
+TEST(Frame, ReorderFramesForWriteSingleStreamUnchanged) {
+  std::vector<Http2Frame> frames;
+  frames.emplace_back(Http2DataFrame{1, false, SliceBufferFromString("a")});
+  frames.emplace_back(Http2DataFrame{1, false, SliceBufferFromString("b")});
+  frames.emplace_back(Http2PingFrame{false, 1234});
+  auto out = ReorderFramesForWrite(std::move(frames));
+  ASSERT_EQ(out.size(), 3u);
+  EXPECT_TRUE(std::holds_alternative<Http2DataFrame>(out[0]));
+  EXPECT_TRUE(std::holds_alternative<Http2DataFrame>(out[1]));
+  EXPECT_TRUE(std::holds_alternative<Http2PingFrame>(out[2]));
+}
+
+TEST(Frame, ReorderFramesForWriteRoundRobinsStreams) {
+  std::vector<Http2Frame> frames;
+  // A bulk burst on stream 1 followed by a control frame and a short write
+  // on stream 3.
+  frames.emplace_back(Http2DataFrame{1, false, SliceBufferFromString("a1")});
+  frames.emplace_back(Http2DataFrame{1, false, SliceBufferFromString("a2")});
+  frames.emplace_back(Http2DataFrame{1, false, SliceBufferFromString("a3")});
+  frames.emplace_back(Http2PingFrame{false, 1234});
+  frames.emplace_back(Http2DataFrame{3, true, SliceBufferFromString("b1")});
+  auto out = ReorderFramesForWrite(std::move(frames));
+  ASSERT_EQ(out.size(), 5u);
+  // Control frame first.
+  EXPECT_TRUE(std::holds_alternative<Http2PingFrame>(out[0]));
+  // Stream 3's lone frame lands after stream 1's first frame, not after its
+  // whole burst.
+  EXPECT_EQ(std::get<Http2DataFrame>(out[1]).stream_id, 1u);
+  EXPECT_EQ(std::get<Http2DataFrame>(out[2]).stream_id, 3u);
+  EXPECT_EQ(std::get<Http2DataFrame>(out[3]).stream_id, 1u);
+  EXPECT_EQ(std::get<Http2DataFrame>(out[4]).stream_id, 1u);
+  // Per-stream payload order is preserved.
+  EXPECT_EQ(std::get<Http2DataFrame>(out[1]).payload.JoinIntoString(), "a1");
+  EXPECT_EQ(std::get<Http2DataFrame>(out[3]).payload.JoinIntoString(), "a2");
+}
+
+TEST(Frame, ReorderFramesForWriteKeepsContinuationWithHeaders) {
+  std::vector<Http2Frame> frames;
+  frames.emplace_back(
+      Http2HeaderFrame{1, false, false, SliceBufferFromString("h1")});
+  frames.emplace_back(
+      Http2ContinuationFrame{1, true, SliceBufferFromString("c1")});
+  frames.emplace_back(Http2DataFrame{3, false, SliceBufferFromString("d3")});
+  auto out = ReorderFramesForWrite(std::move(frames));
+  ASSERT_EQ(out.size(), 3u);
+  EXPECT_TRUE(std::holds_alternative<Http2HeaderFrame>(out[0]));
+  // CONTINUATION must directly follow its HEADERS frame.
+  EXPECT_TRUE(std::holds_alternative<Http2ContinuationFrame>(out[1]));
+  EXPECT_TRUE(std::holds_alternative<Http2DataFrame>(out[2]));
+}
+
 TEST(Frame, GrpcHeaderTest) {
   constexpr uint8_t kFlags = 15;
   constexpr uint32_t kLength = 1111111;
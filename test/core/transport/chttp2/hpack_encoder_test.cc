@@ -226,8 +226,11 @@ TEST(HpackEncoderTest, TestBasicHeaders) {
   grpc_core::ExecCtx exec_ctx;
   g_compressor = new grpc_core::HPackCompressor();
 
-  verify(false, "000005 0104 deadbeef 00 0161 0161", {{"a", "a"}});
-  verify(false, "00000a 0104 deadbeef 00 0161 0161 00 0162 0163",
+  // Headers with no dedicated compressor are added to the dynamic table
+  // (0x40: literal with incremental indexing) so later repeats can be sent
+  // as a one byte index.
+  verify(false, "000005 0104 deadbeef 40 0161 0161", {{"a", "a"}});
+  verify(false, "00000a 0104 deadbeef 40 0161 0161 40 0162 0163",
          {{"a", "a"}, {"b", "c"}});
 
   delete g_compressor;
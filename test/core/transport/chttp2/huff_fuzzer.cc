@@ -29,6 +29,7 @@
 #include "gtest/gtest.h"
 #include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/decode_huff.h"
+#include "src/core/ext/transport/chttp2/transport/decode_huff_fast.h"
 #include "src/core/ext/transport/chttp2/transport/huffsyms.h"
 #include "src/core/util/dump_args.h"
 
@@ -52,6 +53,12 @@ void EncodeDecodeRoundTrips(std::vector<uint8_t> buffer) {
                                          GRPC_SLICE_END_PTR(compressed))
                   .Run());
   EXPECT_EQ(buffer, uncompressed_again);
+  uncompressed_again.clear();
+  EXPECT_TRUE(HuffDecoderFast<decltype(add)>(add,
+                                             GRPC_SLICE_START_PTR(compressed),
+                                             GRPC_SLICE_END_PTR(compressed))
+                  .Run());
+  EXPECT_EQ(buffer, uncompressed_again);
   grpc_slice_unref(uncompressed);
   grpc_slice_unref(compressed);
 }
@@ -109,11 +116,24 @@ std::optional<std::vector<uint8_t>> DecodeHuffFast(const uint8_t* begin,
   return v;
 }
 
+std::optional<std::vector<uint8_t>> DecodeHuffWide(const uint8_t* begin,
+                                                   const uint8_t* end) {
+  std::vector<uint8_t> v;
+  auto f = [&](uint8_t x) { v.push_back(x); };
+  if (!HuffDecoderFast<decltype(f)>(f, begin, end).Run()) {
+    return std::nullopt;
+  }
+  return v;
+}
+
 void DifferentialOptimizedTest(std::vector<uint8_t> buffer) {
   auto slow = DecodeHuffSlow(buffer.data(), buffer.data() + buffer.size());
   auto fast = DecodeHuffFast(buffer.data(), buffer.data() + buffer.size());
+  auto wide = DecodeHuffWide(buffer.data(), buffer.data() + buffer.size());
   EXPECT_EQ(fast, slow) << GRPC_DUMP_ARGS(ToString(buffer), ToString(slow),
                                           ToString(fast));
+  EXPECT_EQ(wide, slow) << GRPC_DUMP_ARGS(ToString(buffer), ToString(slow),
+                                          ToString(wide));
 }
 FUZZ_TEST(HuffTest, DifferentialOptimizedTest);
 
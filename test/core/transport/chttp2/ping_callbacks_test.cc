@@ -494,6 +494,46 @@ TEST(PingCallbacksTest, CoalescedPingsRoundtrip) {
   EXPECT_TRUE(acked2);
 }
 
+TEST(PingCallbacksTest, TimeoutDeadlineRoundtripsWithoutTimers) {
+  // A StrictMock event engine verifies that neither recording a deadline nor
+  // acking the ping performs any timer operation.
+  StrictMock<MockEventEngine> event_engine;
+  absl::BitGen bitgen;
+  Chttp2PingCallbacks callbacks;
+  EXPECT_EQ(callbacks.earliest_timeout_deadline(), Timestamp::InfFuture());
+  callbacks.RequestPing();
+  auto id = callbacks.StartPing(bitgen);
+  EXPECT_TRUE(callbacks.started_new_ping_without_setting_timeout());
+  const Timestamp deadline =
+      Timestamp::ProcessEpoch() + Duration::Seconds(10);
+  EXPECT_EQ(callbacks.OnPingTimeoutDeadline(deadline), id);
+  EXPECT_FALSE(callbacks.started_new_ping_without_setting_timeout());
+  EXPECT_EQ(callbacks.earliest_timeout_deadline(), deadline);
+  EXPECT_TRUE(callbacks.AckPing(id, &event_engine));
+  EXPECT_EQ(callbacks.earliest_timeout_deadline(), Timestamp::InfFuture());
+}
+
+TEST(PingCallbacksTest, EarliestTimeoutDeadlineTracksInflightPings) {
+  StrictMock<MockEventEngine> event_engine;
+  absl::BitGen bitgen;
+  Chttp2PingCallbacks callbacks;
+  const Timestamp deadline1 =
+      Timestamp::ProcessEpoch() + Duration::Seconds(10);
+  const Timestamp deadline2 =
+      Timestamp::ProcessEpoch() + Duration::Seconds(20);
+  callbacks.RequestPing();
+  auto id1 = callbacks.StartPing(bitgen);
+  EXPECT_EQ(callbacks.OnPingTimeoutDeadline(deadline1), id1);
+  callbacks.RequestPing();
+  auto id2 = callbacks.StartPing(bitgen);
+  EXPECT_EQ(callbacks.OnPingTimeoutDeadline(deadline2), id2);
+  EXPECT_EQ(callbacks.earliest_timeout_deadline(), deadline1);
+  EXPECT_TRUE(callbacks.AckPing(id1, &event_engine));
+  EXPECT_EQ(callbacks.earliest_timeout_deadline(), deadline2);
+  EXPECT_TRUE(callbacks.AckPing(id2, &event_engine));
+  EXPECT_EQ(callbacks.earliest_timeout_deadline(), Timestamp::InfFuture());
+}
+
 TEST(PingCallbacksTest, CancelAllCancelsCallbacks) {
   StrictMock<MockEventEngine> event_engine;
   absl::BitGen bitgen;
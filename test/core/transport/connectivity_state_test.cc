@@ -21,6 +21,7 @@
 #include <grpc/grpc.h>
 
 #include "gtest/gtest.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 #include "test/core/test_util/test_config.h"
 #include "test/core/test_util/tracer_util.h"
 
@@ -63,6 +64,48 @@ class Watcher : public ConnectivityStateWatcherInterface {
   bool* destroyed_;
 };
 
+class AsyncWatcher : public AsyncConnectivityStateWatcherInterface {
+ public:
+  AsyncWatcher(int* count, grpc_connectivity_state* output,
+               absl::Status* status)
+      : count_(count), output_(output), status_(status) {}
+
+ private:
+  void OnConnectivityStateChange(grpc_connectivity_state new_state,
+                                 const absl::Status& status) override {
+    ++*count_;
+    *output_ = new_state;
+    *status_ = status;
+  }
+
+  int* count_;
+  grpc_connectivity_state* output_;
+  absl::Status* status_;
+};
+
+TEST(StateTracker, AsyncWatcherCoalescesRapidTransitions) {
+  int count = 0;
+  grpc_connectivity_state state = GRPC_CHANNEL_IDLE;
+  absl::Status status;
+  ExecCtx exec_ctx;
+  ConnectivityStateTracker tracker("xxx", GRPC_CHANNEL_IDLE);
+  tracker.AddWatcher(GRPC_CHANNEL_IDLE,
+                     MakeOrphanable<AsyncWatcher>(&count, &state, &status));
+  // Flap through several states before the ExecCtx drains.
+  absl::Status transient_failure_status(absl::StatusCode::kUnavailable,
+                                        "status for testing");
+  tracker.SetState(GRPC_CHANNEL_CONNECTING, absl::Status(), "whee");
+  tracker.SetState(GRPC_CHANNEL_READY, absl::Status(), "whee");
+  tracker.SetState(GRPC_CHANNEL_TRANSIENT_FAILURE, transient_failure_status,
+                   "whee");
+  EXPECT_EQ(count, 0);
+  exec_ctx.Flush();
+  // The watcher sees one notification with the final state.
+  EXPECT_EQ(count, 1);
+  EXPECT_EQ(state, GRPC_CHANNEL_TRANSIENT_FAILURE);
+  EXPECT_EQ(status, transient_failure_status);
+}
+
 TEST(StateTracker, SetAndGetState) {
   ConnectivityStateTracker tracker("xxx", GRPC_CHANNEL_CONNECTING,
                                    absl::Status());
@@ -20,6 +20,7 @@
 
 #include <grpc/support/alloc.h>
 
+#include <algorithm>
 #include <memory>
 
 #include "absl/types/span.h"
@@ -342,6 +343,50 @@ static void empty_seal_unseal(alts_grpc_record_protocol* sender,
   }
 }
 
+static void batch_seal_unseal(alts_grpc_record_protocol* sender,
+                              alts_grpc_record_protocol* receiver) {
+  constexpr size_t kMaxUnprotectedDataSize = 512;
+  for (size_t i = 0; i < kSealRepeatTimes; i++) {
+    alts_grpc_record_protocol_test_var* var =
+        alts_grpc_record_protocol_test_var_create();
+    // Seals everything in one batch call.
+    size_t data_length = var->original_sb.length;
+    tsi_result status = alts_grpc_record_protocol_protect_batch(
+        sender, &var->original_sb, kMaxUnprotectedDataSize, &var->protected_sb);
+    if (status == TSI_UNIMPLEMENTED) {
+      // This record protocol does not support batching.
+      alts_grpc_record_protocol_test_var_destroy(var);
+      return;
+    }
+    ASSERT_EQ(status, TSI_OK);
+    size_t num_frames = data_length / kMaxUnprotectedDataSize;
+    if (num_frames == 0 || data_length % kMaxUnprotectedDataSize != 0) {
+      num_frames++;
+    }
+    ASSERT_EQ(var->protected_sb.length,
+              data_length +
+                  num_frames * (var->header_length + var->tag_length));
+    // Unseals frame by frame.
+    size_t remaining = data_length;
+    grpc_slice_buffer frame_sb;
+    grpc_slice_buffer_init(&frame_sb);
+    for (size_t frame = 0; frame < num_frames; frame++) {
+      size_t frame_bytes = std::min(remaining, kMaxUnprotectedDataSize);
+      grpc_slice_buffer_move_first(
+          &var->protected_sb,
+          frame_bytes + var->header_length + var->tag_length, &frame_sb);
+      status = alts_grpc_record_protocol_unprotect(receiver, &frame_sb,
+                                                   &var->unprotected_sb);
+      ASSERT_EQ(status, TSI_OK);
+      remaining -= frame_bytes;
+    }
+    grpc_slice_buffer_destroy(&frame_sb);
+    ASSERT_TRUE(
+        are_slice_buffers_equal(&var->unprotected_sb, &var->duplicate_sb));
+    alts_grpc_record_protocol_test_var_destroy(var);
+  }
+}
+
 static void unsync_seal_unseal(alts_grpc_record_protocol* sender,
                                alts_grpc_record_protocol* receiver) {
   tsi_result status;
@@ -425,6 +470,12 @@ static void alts_grpc_record_protocol_empty_seal_unseal_tests(
   empty_seal_unseal(fixture->server_protect, fixture->client_unprotect);
 }
 
+static void alts_grpc_record_protocol_batch_seal_unseal_tests(
+    alts_grpc_record_protocol_test_fixture* fixture) {
+  batch_seal_unseal(fixture->client_protect, fixture->server_unprotect);
+  batch_seal_unseal(fixture->server_protect, fixture->client_unprotect);
+}
+
 static void alts_grpc_record_protocol_unsync_seal_unseal_tests(
     alts_grpc_record_protocol_test_fixture* fixture) {
   unsync_seal_unseal(fixture->client_protect, fixture->server_unprotect);
@@ -463,6 +514,10 @@ static void alts_grpc_record_protocol_tests(
   auto* fixture_5 = fixture_create();
   alts_grpc_record_protocol_input_check_tests(fixture_5);
   alts_grpc_record_protocol_test_fixture_destroy(fixture_5);
+
+  auto* fixture_6 = fixture_create();
+  alts_grpc_record_protocol_batch_seal_unseal_tests(fixture_6);
+  alts_grpc_record_protocol_test_fixture_destroy(fixture_6);
 }
 
 TEST(AltsGrpcRecordProtocolTest, MainTest) {
@@ -143,6 +143,32 @@ TEST(SslSessionCacheTest, LruCache) {
   EXPECT_EQ(tracker.AliveCount(), 0);
 }
 
+TEST(SslSessionCacheTest, ShardedCacheMaintainsCapacity) {
+  SessionTracker tracker;
+  {
+    // Large enough capacity to spread entries over several shards.
+    RefCountedPtr<tsi::SslSessionLRUCache> cache =
+        tsi::SslSessionLRUCache::Create(512);
+    for (long id = 0; id < 1000; id++) {
+      std::string domain = std::to_string(id) + ".random.domain";
+      cache->Put(domain.c_str(), tracker.NewSession(id));
+    }
+    // Eviction is per shard, so the cache may hold slightly fewer sessions
+    // than its total capacity, but never more.
+    EXPECT_LE(cache->Size(), 512);
+    EXPECT_EQ(tracker.AliveCount(), cache->Size());
+    // The most recently inserted session is never the LRU entry of its shard.
+    EXPECT_NE(cache->Get("999.random.domain"), nullptr);
+    // Lookups keep working across shards.
+    tsi::SslSessionPtr sess = tracker.NewSession(1000);
+    SSL_SESSION* sess_ptr = sess.get();
+    cache->Put("fresh.random.domain", std::move(sess));
+    EXPECT_EQ(cache->Get("fresh.random.domain").get(), sess_ptr);
+  }
+  // Cache destructor destroys all sessions.
+  EXPECT_EQ(tracker.AliveCount(), 0);
+}
+
 TEST(SslSessionCacheTest, PutAndGet) {
   // Set up an empty cache and an SSL session.
   SSL_CTX* ssl_ctx = SSL_CTX_new(TLS_method());
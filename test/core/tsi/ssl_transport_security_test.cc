@@ -19,6 +19,7 @@
 #include "src/core/tsi/ssl_transport_security.h"
 
 #include <grpc/grpc.h>
+#include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/string_util.h>
 #include <openssl/crypto.h>
@@ -35,6 +36,7 @@
 #include "absl/strings/str_cat.h"
 #include "gtest/gtest.h"
 #include "src/core/tsi/transport_security.h"
+#include "src/core/tsi/transport_security_grpc.h"
 #include "src/core/tsi/transport_security_interface.h"
 #include "src/core/util/memory.h"
 #include "test/core/test_util/build.h"
@@ -1182,6 +1184,175 @@ TEST_P(SslTransportSecurityTest, ConcurrentlyProtectAndUnprotectOnServer) {
 }
 #endif  // defined(OPENSSL_IS_BORINGSSL)
 
+// --- SSL zero-copy protector tests. ---
+
+// Creates the zero-copy protector that the security handshaker picks in
+// production for this handshaker result.
+static tsi_zero_copy_grpc_protector* CreateZeroCopyProtector(
+    tsi_handshaker_result* result) {
+  tsi_frame_protector_type frame_protector_type;
+  EXPECT_EQ(tsi_handshaker_result_get_frame_protector_type(
+                result, &frame_protector_type),
+            TSI_OK);
+  EXPECT_EQ(frame_protector_type, TSI_FRAME_PROTECTOR_NORMAL_OR_ZERO_COPY);
+  tsi_zero_copy_grpc_protector* protector = nullptr;
+  EXPECT_EQ(tsi_handshaker_result_create_zero_copy_grpc_protector(
+                result, /*max_output_protected_frame_size=*/nullptr,
+                &protector),
+            TSI_OK);
+  EXPECT_NE(protector, nullptr);
+  return protector;
+}
+
+// Returns a message whose contents vary byte to byte, so reordered or
+// dropped record payloads do not compare equal.
+static std::string PatternMessage(size_t size) {
+  std::string message(size, '\0');
+  for (size_t i = 0; i < size; i++) {
+    message[i] = static_cast<char>('a' + (i % 26));
+  }
+  return message;
+}
+
+TEST_P(SslTransportSecurityTest, ZeroCopyProtectAndUnprotect) {
+  LOG(INFO) << "ssl_tsi_test_zero_copy_protect_and_unprotect";
+  SetUpSslFixture(/*tls_version=*/std::get<0>(GetParam()),
+                  /*send_client_ca_list=*/std::get<1>(GetParam()));
+  DoHandshake();
+  tsi_zero_copy_grpc_protector* client =
+      CreateZeroCopyProtector(ssl_tsi_test_fixture_->client_result);
+  tsi_zero_copy_grpc_protector* server =
+      CreateZeroCopyProtector(ssl_tsi_test_fixture_->server_result);
+  std::string request = PatternMessage(1024);
+  std::string protected_request =
+      ZeroCopyProtect(client, request, /*input_slice_size=*/request.size());
+  EXPECT_EQ(ZeroCopyUnprotect(server, protected_request,
+                              /*read_size=*/protected_request.size()),
+            request);
+  // The reverse direction may carry session tickets ahead of the
+  // application data; unprotect must consume them silently.
+  std::string response = PatternMessage(2048);
+  std::string protected_response =
+      ZeroCopyProtect(server, response, /*input_slice_size=*/response.size());
+  EXPECT_EQ(ZeroCopyUnprotect(client, protected_response,
+                              /*read_size=*/protected_response.size()),
+            response);
+  tsi_zero_copy_grpc_protector_destroy(client);
+  tsi_zero_copy_grpc_protector_destroy(server);
+}
+
+TEST_P(SslTransportSecurityTest, ZeroCopyProtectStagedAndDirectWritePaths) {
+  LOG(INFO) << "ssl_tsi_test_zero_copy_protect_staged_and_direct_write_paths";
+  SetUpSslFixture(/*tls_version=*/std::get<0>(GetParam()),
+                  /*send_client_ca_list=*/std::get<1>(GetParam()));
+  DoHandshake();
+  tsi_zero_copy_grpc_protector* client =
+      CreateZeroCopyProtector(ssl_tsi_test_fixture_->client_result);
+  tsi_zero_copy_grpc_protector* server =
+      CreateZeroCopyProtector(ssl_tsi_test_fixture_->server_result);
+  std::string message = PatternMessage(20000);
+  // Sub-threshold input slices are coalesced through the staging buffer.
+  std::string staged = ZeroCopyProtect(client, message,
+                                       /*input_slice_size=*/64);
+  EXPECT_EQ(ZeroCopyUnprotect(server, staged, /*read_size=*/staged.size()),
+            message);
+  // A single slice larger than a record is encrypted straight out of the
+  // caller's memory, spanning several TLS records.
+  std::string direct = ZeroCopyProtect(client, message,
+                                       /*input_slice_size=*/message.size());
+  EXPECT_EQ(ZeroCopyUnprotect(server, direct, /*read_size=*/direct.size()),
+            message);
+  // Slices on either side of the direct-write threshold round-trip
+  // identically.
+  for (size_t input_slice_size : {1023, 1024}) {
+    std::string protected_message =
+        ZeroCopyProtect(client, message, input_slice_size);
+    EXPECT_EQ(ZeroCopyUnprotect(server, protected_message,
+                                /*read_size=*/protected_message.size()),
+              message);
+  }
+  tsi_zero_copy_grpc_protector_destroy(client);
+  tsi_zero_copy_grpc_protector_destroy(server);
+}
+
+TEST_P(SslTransportSecurityTest, ZeroCopyUnprotectAcrossReadBoundaries) {
+  LOG(INFO) << "ssl_tsi_test_zero_copy_unprotect_across_read_boundaries";
+  SetUpSslFixture(/*tls_version=*/std::get<0>(GetParam()),
+                  /*send_client_ca_list=*/std::get<1>(GetParam()));
+  DoHandshake();
+  tsi_zero_copy_grpc_protector* client =
+      CreateZeroCopyProtector(ssl_tsi_test_fixture_->client_result);
+  tsi_zero_copy_grpc_protector* server =
+      CreateZeroCopyProtector(ssl_tsi_test_fixture_->server_result);
+  // Deliver a multi-record message in chunks smaller than a record so
+  // record payloads straddle reads.
+  std::string message = PatternMessage(TSI_TEST_BIG_MESSAGE_SIZE);
+  std::string protected_message =
+      ZeroCopyProtect(client, message, /*input_slice_size=*/message.size());
+  EXPECT_EQ(ZeroCopyUnprotect(server, protected_message, /*read_size=*/1000),
+            message);
+  // Byte-at-a-time delivery makes every record header straddle reads.
+  std::string small_message = PatternMessage(64);
+  std::string protected_small_message = ZeroCopyProtect(
+      client, small_message, /*input_slice_size=*/small_message.size());
+  EXPECT_EQ(ZeroCopyUnprotect(server, protected_small_message,
+                              /*read_size=*/1),
+            small_message);
+  tsi_zero_copy_grpc_protector_destroy(client);
+  tsi_zero_copy_grpc_protector_destroy(server);
+}
+
+TEST_P(SslTransportSecurityTest, ZeroCopyReadFrameSizeAcrossSliceBoundaries) {
+  LOG(INFO) << "ssl_tsi_test_zero_copy_read_frame_size_across_slice_boundaries";
+  SetUpSslFixture(/*tls_version=*/std::get<0>(GetParam()),
+                  /*send_client_ca_list=*/std::get<1>(GetParam()));
+  DoHandshake();
+  tsi_zero_copy_grpc_protector* client =
+      CreateZeroCopyProtector(ssl_tsi_test_fixture_->client_result);
+  tsi_zero_copy_grpc_protector* server =
+      CreateZeroCopyProtector(ssl_tsi_test_fixture_->server_result);
+  // A 256 byte message fits in a single TLS record, so the frame size
+  // reported for the protected bytes is the whole protected length.
+  std::string message = PatternMessage(256);
+  std::string protected_message =
+      ZeroCopyProtect(client, message, /*input_slice_size=*/message.size());
+  grpc_slice_buffer protected_sb;
+  grpc_slice_buffer_init(&protected_sb);
+  grpc_slice_buffer_add(
+      &protected_sb,
+      grpc_slice_from_copied_buffer(protected_message.data(), 2));
+  // Two bytes are not enough for the 5 byte TLS record header.
+  uint32_t frame_size = 0;
+  EXPECT_FALSE(tsi_zero_copy_grpc_protector_read_frame_size(
+      server, &protected_sb, &frame_size));
+  // Completing the header across a slice boundary makes the size readable.
+  grpc_slice_buffer_add(
+      &protected_sb,
+      grpc_slice_from_copied_buffer(protected_message.data() + 2, 3));
+  ASSERT_TRUE(tsi_zero_copy_grpc_protector_read_frame_size(
+      server, &protected_sb, &frame_size));
+  EXPECT_EQ(frame_size, protected_message.size());
+  // The bare header yields no plaintext but must be buffered for later.
+  grpc_slice_buffer unprotected_sb;
+  grpc_slice_buffer_init(&unprotected_sb);
+  int min_progress_size = 0;
+  ASSERT_EQ(tsi_zero_copy_grpc_protector_unprotect(
+                server, &protected_sb, &unprotected_sb, &min_progress_size),
+            TSI_OK);
+  EXPECT_EQ(unprotected_sb.length, 0u);
+  EXPECT_EQ(min_progress_size, 1);
+  // Delivering the rest of the record completes the message.
+  EXPECT_EQ(
+      ZeroCopyUnprotect(server,
+                        absl::string_view(protected_message).substr(5),
+                        /*read_size=*/7),
+      message);
+  grpc_slice_buffer_destroy(&protected_sb);
+  grpc_slice_buffer_destroy(&unprotected_sb);
+  tsi_zero_copy_grpc_protector_destroy(client);
+  tsi_zero_copy_grpc_protector_destroy(server);
+}
+
 static const tsi_ssl_handshaker_factory_vtable* original_vtable;
 static bool handshaker_factory_destructor_called;
 
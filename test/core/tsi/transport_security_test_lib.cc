@@ -19,6 +19,7 @@
 #include "test/core/tsi/transport_security_test_lib.h"
 
 #include <grpc/grpc.h>
+#include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <openssl/asn1.h>
 #include <openssl/bio.h>
@@ -32,9 +33,12 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <algorithm>
+
 #include "absl/log/check.h"
 #include "absl/strings/str_cat.h"
 #include "src/core/lib/iomgr/error.h"
+#include "src/core/tsi/transport_security_grpc.h"
 #include "src/core/tsi/transport_security_interface.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/memory.h"
@@ -862,3 +866,63 @@ std::string Unprotect(tsi_frame_protector* protector,
                             cur - message_buffer);
   return message_bytes;
 }
+
+static std::string slice_buffer_to_string(grpc_slice_buffer* sb) {
+  std::string bytes;
+  for (size_t i = 0; i < sb->count; i++) {
+    bytes.append(
+        reinterpret_cast<const char*>(GRPC_SLICE_START_PTR(sb->slices[i])),
+        GRPC_SLICE_LENGTH(sb->slices[i]));
+  }
+  return bytes;
+}
+
+std::string ZeroCopyProtect(tsi_zero_copy_grpc_protector* protector,
+                            absl::string_view buffer,
+                            size_t input_slice_size) {
+  CHECK(protector != nullptr);
+  CHECK_GT(input_slice_size, 0u);
+  grpc_slice_buffer unprotected_sb;
+  grpc_slice_buffer protected_sb;
+  grpc_slice_buffer_init(&unprotected_sb);
+  grpc_slice_buffer_init(&protected_sb);
+  for (size_t i = 0; i < buffer.size(); i += input_slice_size) {
+    size_t slice_size = std::min(input_slice_size, buffer.size() - i);
+    grpc_slice_buffer_add(
+        &unprotected_sb,
+        grpc_slice_from_copied_buffer(buffer.data() + i, slice_size));
+  }
+  CHECK_EQ(tsi_zero_copy_grpc_protector_protect(protector, &unprotected_sb,
+                                                &protected_sb),
+           TSI_OK);
+  std::string protected_bytes = slice_buffer_to_string(&protected_sb);
+  grpc_slice_buffer_destroy(&unprotected_sb);
+  grpc_slice_buffer_destroy(&protected_sb);
+  return protected_bytes;
+}
+
+std::string ZeroCopyUnprotect(tsi_zero_copy_grpc_protector* protector,
+                              absl::string_view buffer, size_t read_size) {
+  CHECK(protector != nullptr);
+  CHECK_GT(read_size, 0u);
+  grpc_slice_buffer protected_sb;
+  grpc_slice_buffer unprotected_sb;
+  grpc_slice_buffer_init(&protected_sb);
+  grpc_slice_buffer_init(&unprotected_sb);
+  for (size_t i = 0; i < buffer.size(); i += read_size) {
+    size_t slice_size = std::min(read_size, buffer.size() - i);
+    grpc_slice_buffer_add(
+        &protected_sb,
+        grpc_slice_from_copied_buffer(buffer.data() + i, slice_size));
+    int min_progress_size = 0;
+    CHECK_EQ(tsi_zero_copy_grpc_protector_unprotect(protector, &protected_sb,
+                                                    &unprotected_sb,
+                                                    &min_progress_size),
+             TSI_OK);
+    CHECK_GE(min_progress_size, 1);
+  }
+  std::string message_bytes = slice_buffer_to_string(&unprotected_sb);
+  grpc_slice_buffer_destroy(&protected_sb);
+  grpc_slice_buffer_destroy(&unprotected_sb);
+  return message_bytes;
+}
@@ -251,4 +251,17 @@ std::string Protect(tsi_frame_protector* protector, absl::string_view buffer);
 // Returns the result of unprotecting the buffer using the protector.
 std::string Unprotect(tsi_frame_protector* protector, absl::string_view buffer);
 
+// Returns the result of protecting the buffer using the zero-copy protector.
+// The buffer is first split into input slices of at most input_slice_size
+// bytes, so callers can steer implementations between their coalescing and
+// direct paths.
+std::string ZeroCopyProtect(tsi_zero_copy_grpc_protector* protector,
+                            absl::string_view buffer, size_t input_slice_size);
+
+// Returns the result of unprotecting the buffer using the zero-copy
+// protector, feeding it at most read_size bytes per unprotect call so frames
+// (and their headers) may straddle reads.
+std::string ZeroCopyUnprotect(tsi_zero_copy_grpc_protector* protector,
+                              absl::string_view buffer, size_t read_size);
+
 #endif  // GRPC_TEST_CORE_TSI_TRANSPORT_SECURITY_TEST_LIB_H
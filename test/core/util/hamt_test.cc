@@ -0,0 +1,100 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/hamt.h"
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+
+TEST(HamtTest, NoOp) { HAMT<int, int> hamt; }
+
+TEST(HamtTest, Lookup) {
+  auto hamt = HAMT<int, int>().Add(1, 42);
+  EXPECT_EQ(nullptr, hamt.Lookup(2));
+  EXPECT_EQ(42, *hamt.Lookup(1));
+  hamt = hamt.Remove(1);
+  EXPECT_EQ(nullptr, hamt.Lookup(1));
+  hamt = hamt.Add(1, 42).Add(1, 1);
+  EXPECT_EQ(1, *hamt.Lookup(1));
+  hamt = hamt.Add(2, 2).Add(3, 3).Add(4, 4);
+  EXPECT_EQ(1, *hamt.Lookup(1));
+  EXPECT_EQ(2, *hamt.Lookup(2));
+  EXPECT_EQ(3, *hamt.Lookup(3));
+  EXPECT_EQ(4, *hamt.Lookup(4));
+  EXPECT_EQ(nullptr, hamt.Lookup(5));
+}
+
+TEST(HamtTest, ManyKeys) {
+  HAMT<int, int> hamt;
+  for (int i = 0; i < 1000; i++) {
+    hamt = hamt.Add(i, i * 2);
+  }
+  EXPECT_EQ(1000u, hamt.Size());
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_NE(nullptr, hamt.Lookup(i));
+    EXPECT_EQ(i * 2, *hamt.Lookup(i));
+  }
+  for (int i = 0; i < 1000; i += 2) {
+    hamt = hamt.Remove(i);
+  }
+  EXPECT_EQ(500u, hamt.Size());
+  for (int i = 0; i < 1000; i++) {
+    if (i % 2 == 0) {
+      EXPECT_EQ(nullptr, hamt.Lookup(i));
+    } else {
+      ASSERT_NE(nullptr, hamt.Lookup(i));
+      EXPECT_EQ(i * 2, *hamt.Lookup(i));
+    }
+  }
+}
+
+TEST(HamtTest, RemoveAbsentKeepsIdentity) {
+  auto hamt = HAMT<int, int>().Add(1, 1).Add(2, 2);
+  EXPECT_TRUE(hamt.SameIdentity(hamt.Remove(3)));
+}
+
+TEST(HamtTest, ForEachSortedVisitsInKeyOrder) {
+  HAMT<int, int> hamt;
+  for (int i = 99; i >= 0; i--) {
+    hamt = hamt.Add(i, i);
+  }
+  std::vector<int> keys;
+  hamt.ForEachSorted([&keys](const int& key, const int&) {
+    keys.push_back(key);
+  });
+  ASSERT_EQ(100u, keys.size());
+  for (int i = 0; i < 100; i++) {
+    EXPECT_EQ(i, keys[i]);
+  }
+}
+
+TEST(HamtTest, Equality) {
+  auto a = HAMT<int, int>().Add(1, 1).Add(2, 2).Add(3, 3);
+  auto b = HAMT<int, int>().Add(3, 3).Add(1, 1).Add(2, 2);
+  EXPECT_TRUE(a == b);
+  EXPECT_FALSE(a == b.Add(4, 4));
+  EXPECT_FALSE(a == b.Remove(2));
+  EXPECT_FALSE(a == b.Add(2, 42));
+}
+
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
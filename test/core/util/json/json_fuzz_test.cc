@@ -45,5 +45,19 @@ void ParseRoundTrips(std::string input) {
 }
 FUZZ_TEST(JsonTest, ParseRoundTrips);
 
+// Exercises the reader's bulk string scanning: arbitrary printable
+// content, once encoded, must come back byte-for-byte regardless of
+// where quotes and backslashes fall relative to word boundaries.
+void EncodedStringRoundTrips(std::string content) {
+  auto text = JsonDump(Json::FromString(content));
+  auto json = JsonParse(text);
+  CHECK_OK(json);
+  ASSERT_EQ(json->type(), Json::Type::kString);
+  EXPECT_EQ(json->string(), content)
+      << GRPC_DUMP_ARGS(absl::CEscape(content), absl::CEscape(text));
+}
+FUZZ_TEST(JsonTest, EncodedStringRoundTrips)
+    .WithDomains(fuzztest::PrintableAsciiString());
+
 }  // namespace
 }  // namespace grpc_core
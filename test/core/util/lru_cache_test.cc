@@ -16,6 +16,8 @@
 
 #include "src/core/util/lru_cache.h"
 
+#include <thread>
+
 #include "absl/log/check.h"
 #include "absl/strings/numbers.h"
 #include "absl/strings/str_cat.h"
@@ -99,6 +101,81 @@ TEST(LruCache, SetMaxSize) {
   }
 }
 
+TEST(ShardedLruCache, Basic) {
+  int creations = 0;
+  auto create = [&](const std::string& key) {
+    int value;
+    CHECK(absl::SimpleAtoi(key, &value));
+    ++creations;
+    return value;
+  };
+  // Large enough that nothing is evicted in this test.
+  ShardedLruCache<std::string, int> cache(1000);
+  for (int i = 0; i < 100; ++i) {
+    std::string key = absl::StrCat(i);
+    EXPECT_EQ(std::nullopt, cache.Get(key));
+    EXPECT_EQ(i, cache.GetOrInsert(key, create));
+    EXPECT_EQ(i, cache.Get(key));
+  }
+  EXPECT_EQ(creations, 100);
+  // Lookups of existing keys must not trigger creation.
+  for (int i = 0; i < 100; ++i) {
+    std::string key = absl::StrCat(i);
+    EXPECT_EQ(i, cache.GetOrInsert(key, create));
+  }
+  EXPECT_EQ(creations, 100);
+}
+
+TEST(ShardedLruCache, EnforcesMaxSize) {
+  auto create = [&](const std::string& key) {
+    int value;
+    CHECK(absl::SimpleAtoi(key, &value));
+    return value;
+  };
+  ShardedLruCache<std::string, int> cache(16);
+  for (int i = 0; i < 100; ++i) {
+    std::string key = absl::StrCat(i);
+    cache.GetOrInsert(key, create);
+  }
+  // Eviction is per shard, so we can't say exactly which keys survive, but
+  // the total must not exceed the max size and the most recently inserted
+  // key must still be present.
+  EXPECT_EQ(99, cache.Get("99"));
+  int present = 0;
+  for (int i = 0; i < 100; ++i) {
+    if (cache.Get(absl::StrCat(i)).has_value()) ++present;
+  }
+  EXPECT_LE(present, 16);
+  // Shrinking further evicts down to the new size.
+  cache.SetMaxSize(1);
+  present = 0;
+  for (int i = 0; i < 100; ++i) {
+    if (cache.Get(absl::StrCat(i)).has_value()) ++present;
+  }
+  EXPECT_LE(present, 16);  // one entry per shard
+}
+
+TEST(ShardedLruCache, ConcurrentAccess) {
+  auto create = [](const std::string& key) {
+    int value;
+    CHECK(absl::SimpleAtoi(key, &value));
+    return value;
+  };
+  ShardedLruCache<std::string, int> cache(64);
+  std::vector<std::thread> threads;
+  threads.reserve(8);
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([&cache, create] {
+      for (int i = 0; i < 1000; ++i) {
+        std::string key = absl::StrCat(i % 100);
+        int value = cache.GetOrInsert(key, create);
+        EXPECT_EQ(value, i % 100);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char** argv) {
@@ -60,6 +60,30 @@ TEST(MpscqTest, Serial) {
   }
 }
 
+TEST(MpscqTest, SerialPopAll) {
+  VLOG(2) << "test_serial_pop_all";
+  MultiProducerSingleConsumerQueue q;
+  // PopAll on an empty queue returns nullptr.
+  ASSERT_EQ(q.PopAll(), nullptr);
+  for (size_t i = 0; i < 10000; i++) {
+    q.Push(&new_node(i, nullptr)->node);
+  }
+  // All queued nodes come back in one FIFO chain linked through next.
+  MultiProducerSingleConsumerQueue::Node* head = q.PopAll();
+  size_t i = 0;
+  while (head != nullptr) {
+    MultiProducerSingleConsumerQueue::Node* next =
+        head->next.load(std::memory_order_relaxed);
+    test_node* n = reinterpret_cast<test_node*>(head);
+    ASSERT_EQ(n->i, i);
+    i++;
+    delete n;
+    head = next;
+  }
+  ASSERT_EQ(i, 10000);
+  ASSERT_EQ(q.PopAll(), nullptr);
+}
+
 typedef struct {
   size_t ctr;
   MultiProducerSingleConsumerQueue* q;
@@ -0,0 +1,71 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/object_pool.h"
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+struct Counted {
+  explicit Counted(int v) : value(v) { ++instances; }
+  ~Counted() { --instances; }
+  int value;
+  static int instances;
+};
+
+int Counted::instances = 0;
+
+TEST(ObjectPoolTest, ConstructsAndDestructs) {
+  Counted* p = ObjectPool<Counted>::New(42);
+  EXPECT_EQ(p->value, 42);
+  EXPECT_EQ(Counted::instances, 1);
+  ObjectPool<Counted>::Delete(p);
+  EXPECT_EQ(Counted::instances, 0);
+}
+
+TEST(ObjectPoolTest, ReusesBlocksOnSameThread) {
+  Counted* first = ObjectPool<Counted>::New(1);
+  ObjectPool<Counted>::Delete(first);
+  // The freelist is LIFO, so the next allocation must reuse the block.
+  Counted* second = ObjectPool<Counted>::New(2);
+  EXPECT_EQ(static_cast<void*>(first), static_cast<void*>(second));
+  EXPECT_EQ(second->value, 2);
+  ObjectPool<Counted>::Delete(second);
+}
+
+TEST(ObjectPoolTest, CrossThreadFreeIsSafe) {
+  std::vector<Counted*> objects;
+  objects.reserve(100);
+  for (int i = 0; i < 100; ++i) {
+    objects.push_back(ObjectPool<Counted>::New(i));
+  }
+  std::thread t([&objects] {
+    for (Counted* p : objects) ObjectPool<Counted>::Delete(p);
+  });
+  t.join();
+  EXPECT_EQ(Counted::instances, 0);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,81 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/structured_event_log.h"
+
+#include <stdint.h>
+
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+struct TestEvent {
+  uint32_t kind;
+  int64_t value;
+};
+
+TEST(StructuredEventLogTest, DisabledDropsEvents) {
+  StructuredEventLog<TestEvent> log;
+  log.Append({1, 42});
+  EXPECT_TRUE(log.Collect().empty());
+}
+
+TEST(StructuredEventLogTest, CollectsInTimestampOrder) {
+  StructuredEventLog<TestEvent> log;
+  log.Enable();
+  for (int64_t i = 0; i < 100; ++i) {
+    log.Append({1, i});
+  }
+  auto collected = log.Collect();
+  ASSERT_EQ(collected.size(), 100);
+  for (size_t i = 1; i < collected.size(); ++i) {
+    EXPECT_GE(collected[i].when, collected[i - 1].when);
+  }
+}
+
+TEST(StructuredEventLogTest, RingOverwritesOldestOnceFull) {
+  StructuredEventLog<TestEvent, 8> log;
+  log.Enable();
+  for (int64_t i = 0; i < 1000; ++i) {
+    log.Append({1, i});
+  }
+  auto collected = log.Collect();
+  EXPECT_FALSE(collected.empty());
+  // Overwritten slots must not resurface; everything retained is valid and
+  // the total is bounded by the (sharded) ring capacity, not the append
+  // count.
+  EXPECT_LT(collected.size(), 1000);
+  for (const auto& event : collected) {
+    EXPECT_EQ(event.record.kind, 1);
+    EXPECT_LT(event.record.value, 1000);
+  }
+}
+
+TEST(StructuredEventLogTest, EnableClearsEarlierCapture) {
+  StructuredEventLog<TestEvent> log;
+  log.Enable();
+  log.Append({1, 1});
+  log.Disable();
+  log.Enable();
+  EXPECT_TRUE(log.Collect().empty());
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -33,6 +33,7 @@
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "gtest/gtest.h"
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
@@ -368,6 +369,45 @@ TEST(WorkSerializerTest, MetricsWork) {
   WaitForSingleOwner(GetDefaultEventEngine());
 }
 
+TEST(WorkSerializerTest, SpinThenRunInline) {
+  ConfigVars::Overrides config_overrides;
+  config_overrides.work_serializer_spin_usec = 5000000;
+  ConfigVars::SetOverrides(config_overrides);
+  auto lock = std::make_unique<WorkSerializer>(GetDefaultEventEngine());
+  // Occupy the serializer with a callback that blocks until released.
+  Notification first_started;
+  Notification first_release;
+  lock->Run(
+      [&first_started, &first_release]() {
+        first_started.Notify();
+        first_release.WaitForNotification();
+      },
+      DEBUG_LOCATION);
+  first_started.WaitForNotification();
+  // Release the first callback shortly after the second Run() below starts
+  // spinning; the spin budget is far larger than the release delay, so the
+  // second callback must run inline on this thread rather than hop through
+  // EventEngine.
+  std::thread releaser([&first_release]() {
+    absl::SleepFor(absl::Milliseconds(50));
+    first_release.Notify();
+  });
+  std::thread::id run_thread;
+  Notification second_done;
+  lock->Run(
+      [&run_thread, &second_done]() {
+        run_thread = std::this_thread::get_id();
+        second_done.Notify();
+      },
+      DEBUG_LOCATION);
+  second_done.WaitForNotification();
+  releaser.join();
+  EXPECT_EQ(run_thread, std::this_thread::get_id());
+  lock.reset();
+  WaitForSingleOwner(GetDefaultEventEngine());
+  ConfigVars::SetOverrides(ConfigVars::Overrides());
+}
+
 #ifndef NDEBUG
 TEST(WorkSerializerTest, RunningInWorkSerializer) {
   auto work_serializer1 =
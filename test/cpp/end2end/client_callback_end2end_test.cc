@@ -1025,6 +1025,54 @@ TEST_P(ClientCallbackEnd2endTest, ResponseStream) {
   }
 }
 
+class PipelinedReadClient
+    : public grpc::ClientPipelinedReadReactor<EchoResponse> {
+ public:
+  PipelinedReadClient(grpc::testing::EchoTestService::Stub* stub,
+                      size_t slots) {
+    request_.set_message("Hello client ");
+    stub->async()->ResponseStream(&context_, &request_, this);
+    StartReads(slots);
+    StartCall();
+  }
+  void OnReadMessage(EchoResponse& msg) override {
+    EXPECT_LT(reads_complete_, kServerDefaultResponseStreamsToSend);
+    EXPECT_EQ(msg.message(),
+              request_.message() + std::to_string(reads_complete_));
+    reads_complete_++;
+  }
+  void OnReadsDone() override {
+    EXPECT_EQ(reads_complete_, kServerDefaultResponseStreamsToSend);
+  }
+  void OnDone(const Status& s) override {
+    EXPECT_TRUE(s.ok());
+    EXPECT_EQ(reads_complete_, kServerDefaultResponseStreamsToSend);
+    std::unique_lock<std::mutex> l(mu_);
+    done_ = true;
+    cv_.notify_one();
+  }
+  void Await() {
+    std::unique_lock<std::mutex> l(mu_);
+    while (!done_) {
+      cv_.wait(l);
+    }
+  }
+
+ private:
+  EchoRequest request_;
+  ClientContext context_;
+  int reads_complete_{0};
+  std::mutex mu_;
+  std::condition_variable cv_;
+  bool done_ = false;
+};
+
+TEST_P(ClientCallbackEnd2endTest, PipelinedResponseStream) {
+  ResetStub();
+  PipelinedReadClient test{stub_.get(), 3};
+  test.Await();
+}
+
 TEST_P(ClientCallbackEnd2endTest, ClientCancelsResponseStream) {
   ResetStub();
   ReadClient test{stub_.get(), DO_NOT_CANCEL, ClientCancelInfo{2}};
@@ -209,6 +209,34 @@ TEST_F(ProtoServerReflectionTest, V1ApiInstalled) {
       << response.DebugString();
 }
 
+TEST_F(ProtoServerReflectionTest, RepeatedQueriesReturnIdenticalBytes) {
+  ResetStub();
+  using Service = reflection::v1::ServerReflection;
+  using Request = reflection::v1::ServerReflectionRequest;
+  using Response = reflection::v1::ServerReflectionResponse;
+  Service::Stub stub(channel_);
+  ClientContext context;
+  auto reader_writer = stub.ServerReflectionInfo(&context);
+  Request request;
+  request.set_file_containing_symbol(Service::service_full_name());
+  reader_writer->Write(request);
+  Response first;
+  ASSERT_TRUE(reader_writer->Read(&first));
+  // The second lookup is served from the serialized descriptor cache and
+  // must match the first byte for byte.
+  reader_writer->WriteLast(request, WriteOptions());
+  Response second;
+  ASSERT_TRUE(reader_writer->Read(&second));
+  EXPECT_EQ(first.file_descriptor_response().file_descriptor_proto_size(),
+            second.file_descriptor_response().file_descriptor_proto_size());
+  for (int i = 0;
+       i < first.file_descriptor_response().file_descriptor_proto_size();
+       ++i) {
+    EXPECT_EQ(first.file_descriptor_response().file_descriptor_proto(i),
+              second.file_descriptor_response().file_descriptor_proto(i));
+  }
+}
+
 }  // namespace testing
 }  // namespace grpc
 
@@ -0,0 +1,350 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Corpus-driven HPACK benchmarks.
+//
+// The fixtures in bm_chttp2_hpack.cc encode and parse one header set at
+// a time, so the dynamic table reaches steady state after the first
+// iteration and indexed lookups always hit.  Production connections see
+// a stream of different header sets — mostly-repeated pseudo headers,
+// a handful of hot paths, and per-request values that never repeat — so
+// dynamic-table hit rates and encoder costs depend on the distribution,
+// not on any single set.  These benchmarks replay a whole corpus of
+// recorded header sets through one encoder (and parser) so that table
+// state evolves across requests as it does on a live connection.
+//
+// Corpus file format (set GRPC_HPACK_CORPUS to a path to use your own
+// anonymized captures; a built-in corpus modeled on production traffic
+// is used otherwise): plain text, one "key: value" header per line,
+// header sets separated by blank lines, '#' lines ignored.
+
+#include <benchmark/benchmark.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/random/bit_gen_ref.h"
+#include "absl/random/random.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/util/env.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+Http2ZTraceCollector* ztrace_collector = new Http2ZTraceCollector();
+
+using HeaderSet = std::vector<std::pair<std::string, std::string>>;
+
+// Built-in corpus standing in for anonymized production captures: a
+// long-lived client connection issuing requests against a small set of
+// hot methods (heavily repeated, so they should become dynamic-table
+// hits), with constant connection-scoped headers and a per-request id
+// that never repeats, interleaved with the matching server responses
+// and trailers.
+std::vector<HeaderSet> DefaultCorpus() {
+  const char* kPaths[] = {
+      "/acme.inventory.v1.InventoryService/GetItem",
+      "/acme.inventory.v1.InventoryService/GetItem",
+      "/acme.inventory.v1.InventoryService/GetItem",
+      "/acme.inventory.v1.InventoryService/ListItems",
+      "/acme.inventory.v1.InventoryService/ListItems",
+      "/acme.checkout.v2.CheckoutService/StartCheckout",
+      "/acme.checkout.v2.CheckoutService/CompleteCheckout",
+      "/grpc.health.v1.Health/Check",
+  };
+  std::vector<HeaderSet> corpus;
+  for (int i = 0; i < 64; i++) {
+    HeaderSet request = {
+        {":scheme", "http"},
+        {":method", "POST"},
+        {":path", kPaths[i % (sizeof(kPaths) / sizeof(kPaths[0]))]},
+        {":authority", "inventory.prod.acme.internal:443"},
+        {"te", "trailers"},
+        {"content-type", "application/grpc"},
+        {"user-agent", "grpc-c++/1.74.0 grpc-c/48.0.0 (linux; chttp2)"},
+        {"x-request-id", absl::StrCat("req-", 0x9e3779b97f4a7c15ull * (i + 1))},
+        {"x-deployment", "prod-us-east1-b"},
+    };
+    corpus.push_back(std::move(request));
+    HeaderSet response = {
+        {":status", "200"},
+        {"content-type", "application/grpc"},
+    };
+    corpus.push_back(std::move(response));
+    HeaderSet trailers = {
+        {"grpc-status", "0"},
+    };
+    corpus.push_back(std::move(trailers));
+  }
+  return corpus;
+}
+
+std::vector<HeaderSet> LoadCorpusFile(const std::string& path) {
+  std::ifstream in(path);
+  CHECK(in.good()) << "failed to open HPACK corpus " << path;
+  std::vector<HeaderSet> corpus;
+  HeaderSet current;
+  std::string line;
+  while (std::getline(in, line)) {
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    if (line.empty()) {
+      if (!current.empty()) corpus.push_back(std::move(current));
+      current.clear();
+      continue;
+    }
+    if (line[0] == '#') continue;
+    size_t sep = line.find(": ");
+    CHECK(sep != std::string::npos) << "malformed corpus line: " << line;
+    current.emplace_back(line.substr(0, sep), line.substr(sep + 2));
+  }
+  if (!current.empty()) corpus.push_back(std::move(current));
+  CHECK(!corpus.empty()) << "empty HPACK corpus " << path;
+  return corpus;
+}
+
+const std::vector<HeaderSet>& Corpus() {
+  static const std::vector<HeaderSet>* corpus = []() {
+    auto path = GetEnv("GRPC_HPACK_CORPUS");
+    return new std::vector<HeaderSet>(
+        path.has_value() ? LoadCorpusFile(*path) : DefaultCorpus());
+  }();
+  return *corpus;
+}
+
+void CrashOnAppendError(absl::string_view, const Slice&) { abort(); }
+
+// Recorded headers are key/value strings; map the typed (pseudo)
+// headers onto their metadata traits the way the transport would and
+// append the rest verbatim.
+void ApplyHeader(grpc_metadata_batch* b, const std::string& key,
+                 const std::string& value) {
+  if (key == ":scheme") {
+    b->Set(HttpSchemeMetadata(),
+           HttpSchemeMetadata::Parse(value, CrashOnAppendError));
+  } else if (key == ":method") {
+    b->Set(HttpMethodMetadata(),
+           value == "POST" ? HttpMethodMetadata::kPost
+                           : HttpMethodMetadata::kGet);
+  } else if (key == ":path") {
+    b->Set(HttpPathMetadata(), Slice::FromCopiedString(value));
+  } else if (key == ":authority") {
+    b->Set(HttpAuthorityMetadata(), Slice::FromCopiedString(value));
+  } else if (key == ":status") {
+    b->Set(HttpStatusMetadata(), atoi(value.c_str()));
+  } else if (key == "te") {
+    b->Set(TeMetadata(), TeMetadata::kTrailers);
+  } else if (key == "content-type") {
+    b->Set(ContentTypeMetadata(), ContentTypeMetadata::kApplicationGrpc);
+  } else if (key == "user-agent") {
+    b->Set(UserAgentMetadata(), Slice::FromCopiedString(value));
+  } else if (key == "grpc-status") {
+    b->Set(GrpcStatusMetadata(),
+           static_cast<grpc_status_code>(atoi(value.c_str())));
+  } else {
+    b->Append(key, Slice::FromCopiedString(value), CrashOnAppendError);
+  }
+}
+
+std::vector<std::unique_ptr<grpc_metadata_batch>> BuildBatches() {
+  std::vector<std::unique_ptr<grpc_metadata_batch>> batches;
+  for (const HeaderSet& set : Corpus()) {
+    auto b = std::make_unique<grpc_metadata_batch>();
+    for (const auto& [key, value] : set) ApplyHeader(b.get(), key, value);
+    batches.push_back(std::move(b));
+  }
+  return batches;
+}
+
+class FakeCallTracer final : public CallTracerInterface {
+ public:
+  void RecordIncomingBytes(const TransportByteSize&) override {}
+  void RecordOutgoingBytes(const TransportByteSize&) override {}
+  void RecordSendInitialMetadata(grpc_metadata_batch*) override {}
+  void RecordSendTrailingMetadata(grpc_metadata_batch*) override {}
+  void RecordSendMessage(const Message&) override {}
+  void RecordSendCompressedMessage(const Message&) override {}
+  void RecordReceivedInitialMetadata(grpc_metadata_batch*) override {}
+  void RecordReceivedMessage(const Message&) override {}
+  void RecordReceivedDecompressedMessage(const Message&) override {}
+  void RecordCancel(grpc_error_handle) override {}
+  std::shared_ptr<TcpCallTracer> StartNewTcpTrace() override { return nullptr; }
+  void RecordAnnotation(absl::string_view) override {}
+  void RecordAnnotation(const Annotation&) override {}
+  std::string TraceId() override { return ""; }
+  std::string SpanId() override { return ""; }
+  bool IsSampled() override { return false; }
+};
+
+// Encodes one header set with an evolving compressor; returns the
+// HEADERS frame payload (frame header stripped) ready for the parser.
+std::vector<grpc_slice> EncodeSet(HPackCompressor* c, uint32_t stream_id,
+                                  const grpc_metadata_batch& b,
+                                  size_t* wire_bytes) {
+  FakeCallTracer call_tracer;
+  grpc_slice_buffer outbuf;
+  grpc_slice_buffer_init(&outbuf);
+  c->EncodeHeaders(
+      HPackCompressor::EncodeHeaderOptions{stream_id, true, true,
+                                           size_t{1024 * 1024}, &call_tracer,
+                                           ztrace_collector},
+      b, &outbuf);
+  if (wire_bytes != nullptr) *wire_bytes += outbuf.length;
+  std::vector<grpc_slice> out;
+  for (size_t i = 0; i < outbuf.count; i++) {
+    out.push_back(grpc_slice_ref(outbuf.slices[i]));
+  }
+  grpc_slice_buffer_reset_and_unref(&outbuf);
+  grpc_slice_buffer_destroy(&outbuf);
+  CHECK(!out.empty());
+  CHECK_GT(GRPC_SLICE_LENGTH(out[0]), 9u);
+  out[0] = grpc_slice_sub_no_ref(out[0], 9, GRPC_SLICE_LENGTH(out[0]));
+  return out;
+}
+
+void ParseSet(HPackParser* p, grpc_metadata_batch* b,
+              const std::vector<grpc_slice>& slices, uint32_t stream_id,
+              absl::BitGenRef bitgen) {
+  p->BeginFrame(b, std::numeric_limits<uint32_t>::max(),
+                std::numeric_limits<uint32_t>::max(),
+                HPackParser::Boundary::EndOfHeaders,
+                HPackParser::Priority::None,
+                HPackParser::LogInfo{stream_id, HPackParser::LogInfo::kHeaders,
+                                     false});
+  for (size_t i = 0; i < slices.size(); ++i) {
+    CHECK_OK(p->Parse(slices[i], i == slices.size() - 1, bitgen,
+                      /*call_tracer=*/nullptr));
+  }
+}
+
+// One compressor encodes the whole corpus over and over; the dynamic
+// table carries over between header sets and between passes, as on a
+// long-lived connection.  Each iteration encodes one header set.
+void BM_HpackEncoderEncodeCorpus(benchmark::State& state) {
+  ExecCtx exec_ctx;
+  auto batches = BuildBatches();
+  size_t plaintext_bytes = 0;
+  for (const HeaderSet& set : Corpus()) {
+    for (const auto& [key, value] : set) {
+      plaintext_bytes += key.length() + value.length();
+    }
+  }
+  HPackCompressor c;
+  uint32_t stream_id = 1;
+  size_t wire_bytes = 0;
+  while (state.KeepRunningBatch(batches.size())) {
+    for (auto& b : batches) {
+      auto slices = EncodeSet(&c, stream_id, *b, &wire_bytes);
+      for (auto slice : slices) grpc_slice_unref(slice);
+      stream_id += 2;
+      ExecCtx::Get()->Flush();
+    }
+  }
+  state.counters["wire_bytes_per_set"] = benchmark::Counter(
+      static_cast<double>(wire_bytes) / state.iterations());
+  state.counters["compression_ratio"] =
+      static_cast<double>(wire_bytes) /
+      (static_cast<double>(plaintext_bytes) *
+       (static_cast<double>(state.iterations()) / Corpus().size()));
+}
+BENCHMARK(BM_HpackEncoderEncodeCorpus);
+
+// Parses one pre-encoded pass over the corpus per batch with a fresh
+// parser, so the parser's dynamic table replays the same evolution the
+// encoder's table went through while producing the capture.
+void BM_HpackParserParseCorpus(benchmark::State& state) {
+  ExecCtx exec_ctx;
+  auto batches = BuildBatches();
+  std::vector<std::vector<grpc_slice>> encoded;
+  {
+    HPackCompressor c;
+    uint32_t stream_id = 1;
+    for (auto& b : batches) {
+      encoded.push_back(EncodeSet(&c, stream_id, *b, nullptr));
+      stream_id += 2;
+    }
+  }
+  absl::BitGen bitgen;
+  while (state.KeepRunningBatch(encoded.size())) {
+    HPackParser p;
+    grpc_metadata_batch b;
+    uint32_t stream_id = 1;
+    for (const auto& slices : encoded) {
+      ParseSet(&p, &b, slices, stream_id, absl::BitGenRef(bitgen));
+      b.Clear();
+      stream_id += 2;
+      ExecCtx::Get()->Flush();
+    }
+  }
+  for (const auto& slices : encoded) {
+    for (auto slice : slices) grpc_slice_unref(slice);
+  }
+}
+BENCHMARK(BM_HpackParserParseCorpus);
+
+// Full round trip with a persistent encoder/parser pair whose dynamic
+// tables co-evolve across the whole run.  Each iteration encodes and
+// parses one header set.
+void BM_HpackRoundTripCorpus(benchmark::State& state) {
+  ExecCtx exec_ctx;
+  auto batches = BuildBatches();
+  HPackCompressor c;
+  HPackParser p;
+  absl::BitGen bitgen;
+  uint32_t stream_id = 1;
+  while (state.KeepRunningBatch(batches.size())) {
+    for (auto& b : batches) {
+      auto slices = EncodeSet(&c, stream_id, *b, nullptr);
+      grpc_metadata_batch parsed;
+      ParseSet(&p, &parsed, slices, stream_id, absl::BitGenRef(bitgen));
+      for (auto slice : slices) grpc_slice_unref(slice);
+      stream_id += 2;
+      ExecCtx::Get()->Flush();
+    }
+  }
+}
+BENCHMARK(BM_HpackRoundTripCorpus);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,283 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark gRPC under multi-channel saturation load.
+//
+// The ping-pong fullstack benchmarks drive a single channel with a
+// single outstanding RPC, which can't reproduce the bottlenecks of
+// deployments with hundreds of channels and deep per-channel pipelines.
+// This suite creates many channels (each with its own subchannel and
+// connection), keeps a configurable number of unary RPCs in flight on
+// each, and sweeps message sizes and the number of CPUs the process may
+// run on, so that throughput-per-core scaling curves can be compared
+// across changes.
+
+#include <benchmark/benchmark.h>
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+#include <grpcpp/channel.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+
+#include <atomic>
+#include <climits>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/callback_test_service.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+#ifdef GPR_LINUX
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+namespace grpc {
+namespace testing {
+namespace {
+
+// Restricts the process to the first `cpus` CPUs for the duration of a
+// benchmark run (Linux only; a no-op elsewhere).  0 means no
+// restriction.  Restricting the whole process bounds the event engine
+// and poller threads as well as the benchmark's own threads, which is
+// what makes the per-core scaling sweep meaningful.
+class ScopedCpuLimit {
+ public:
+  explicit ScopedCpuLimit(int cpus) {
+#ifdef GPR_LINUX
+    if (cpus <= 0) return;
+    if (sched_getaffinity(0, sizeof(saved_), &saved_) != 0) return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int i = 0; i < cpus && i < CPU_SETSIZE; i++) {
+      CPU_SET(i, &set);
+    }
+    restore_ = sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    (void)cpus;
+#endif
+  }
+
+  ~ScopedCpuLimit() {
+#ifdef GPR_LINUX
+    if (restore_) sched_setaffinity(0, sizeof(saved_), &saved_);
+#endif
+  }
+
+ private:
+#ifdef GPR_LINUX
+  cpu_set_t saved_;
+  bool restore_ = false;
+#endif
+};
+
+// Number of NUMA nodes visible to the process, or 0 if unknown.
+// Reported as a label so that results from differently shaped machines
+// aren't compared blindly.
+int CountNumaNodes() {
+#ifdef GPR_LINUX
+  int nodes = 0;
+  while (access(
+             absl::StrCat("/sys/devices/system/node/node", nodes).c_str(),
+             F_OK) == 0) {
+    nodes++;
+  }
+  return nodes;
+#else
+  return 0;
+#endif
+}
+
+// One server plus `num_channels` independent channels to it.  Each
+// channel gets its own subchannel pool (and therefore its own
+// connection), as hundreds of distinct client processes would.
+class SaturationFixture {
+ public:
+  SaturationFixture(Service* service, int num_channels) {
+    port_ = grpc_pick_unused_port_or_die();
+    std::string address = absl::StrCat("localhost:", port_);
+    ServerBuilder b;
+    b.AddListeningPort(address, InsecureServerCredentials());
+    b.RegisterService(service);
+    b.SetMaxReceiveMessageSize(INT_MAX);
+    b.SetMaxSendMessageSize(INT_MAX);
+    server_ = b.BuildAndStart();
+    channels_.reserve(num_channels);
+    for (int i = 0; i < num_channels; i++) {
+      ChannelArguments args;
+      args.SetInt(GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH, INT_MAX);
+      args.SetInt(GRPC_ARG_MAX_SEND_MESSAGE_LENGTH, INT_MAX);
+      args.SetInt(GRPC_ARG_ENABLE_RETRIES, 0);
+      args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+      channels_.push_back(grpc::CreateCustomChannel(
+          address, InsecureChannelCredentials(), args));
+    }
+  }
+
+  ~SaturationFixture() {
+    channels_.clear();
+    server_->Shutdown(grpc_timeout_milliseconds_to_deadline(0));
+    grpc_recycle_unused_port(port_);
+  }
+
+  std::shared_ptr<Channel> channel(size_t i) { return channels_[i]; }
+
+ private:
+  int port_;
+  std::unique_ptr<Server> server_;
+  std::vector<std::shared_ptr<Channel>> channels_;
+};
+
+// State for one in-flight unary RPC slot.  Each slot reissues itself
+// from its completion callback until the batch's issue budget is spent.
+struct RpcSlot {
+  explicit RpcSlot(EchoTestService::Stub* s) : stub(s) {}
+  ClientContext ctx;
+  EchoRequest request;
+  EchoResponse response;
+  EchoTestService::Stub* stub;
+};
+
+void BM_UnarySaturation(benchmark::State& state) {
+  const int num_channels = static_cast<int>(state.range(0));
+  const int outstanding_per_channel = static_cast<int>(state.range(1));
+  const int request_size = static_cast<int>(state.range(2));
+  const int response_size = static_cast<int>(state.range(3));
+  const int cpu_limit = static_cast<int>(state.range(4));
+  ScopedCpuLimit cpu_limiter(cpu_limit);
+  CallbackStreamingTestService service;
+  SaturationFixture fixture(&service, num_channels);
+  std::vector<std::unique_ptr<EchoTestService::Stub>> stubs;
+  stubs.reserve(num_channels);
+  for (int i = 0; i < num_channels; i++) {
+    stubs.push_back(EchoTestService::NewStub(fixture.channel(i)));
+  }
+  const int total_slots = num_channels * outstanding_per_channel;
+  std::vector<std::unique_ptr<RpcSlot>> slots;
+  slots.reserve(total_slots);
+  for (int i = 0; i < total_slots; i++) {
+    slots.push_back(
+        std::make_unique<RpcSlot>(stubs[i / outstanding_per_channel].get()));
+    if (request_size > 0) {
+      slots.back()->request.set_message(std::string(request_size, 'a'));
+    }
+  }
+  struct BatchState {
+    std::atomic<int64_t> to_issue{0};
+    std::atomic<int64_t> completed{0};
+    int64_t target = 0;
+    std::mutex mu;
+    std::condition_variable cv;
+    bool done = false;
+  } batch;
+  std::function<void(RpcSlot*)> issue = [&](RpcSlot* slot) {
+    slot->ctx.~ClientContext();
+    new (&slot->ctx) ClientContext();
+    if (response_size > 0) {
+      slot->ctx.AddMetadata(kServerMessageSize, std::to_string(response_size));
+    }
+    slot->stub->async()->Echo(
+        &slot->ctx, &slot->request, &slot->response, [&, slot](Status s) {
+          CHECK(s.ok());
+          if (batch.to_issue.fetch_sub(1, std::memory_order_acq_rel) > 0) {
+            issue(slot);
+          }
+          if (batch.completed.fetch_add(1, std::memory_order_acq_rel) + 1 ==
+              batch.target) {
+            std::lock_guard<std::mutex> l(batch.mu);
+            batch.done = true;
+            batch.cv.notify_one();
+          }
+        });
+  };
+  // Amortize batch setup over several round trips per slot.  Every
+  // iteration corresponds to one completed RPC.
+  const int64_t batch_size = static_cast<int64_t>(total_slots) * 4;
+  while (state.KeepRunningBatch(batch_size)) {
+    batch.target = batch_size;
+    batch.to_issue.store(batch_size - total_slots, std::memory_order_relaxed);
+    batch.completed.store(0, std::memory_order_relaxed);
+    batch.done = false;
+    for (auto& slot : slots) {
+      issue(slot.get());
+    }
+    std::unique_lock<std::mutex> l(batch.mu);
+    batch.cv.wait(l, [&]() { return batch.done; });
+  }
+  const int cpus =
+      cpu_limit > 0 ? cpu_limit : static_cast<int>(gpr_cpu_num_cores());
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(
+      static_cast<int64_t>(request_size + response_size) * state.iterations());
+  state.counters["cpus"] = cpus;
+  state.counters["rpcs_per_core"] = benchmark::Counter(
+      static_cast<double>(state.iterations()) / cpus,
+      benchmark::Counter::kIsRate);
+  state.SetLabel(absl::StrCat("numa_nodes:", CountNumaNodes()));
+}
+
+void SaturationArgs(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"channels", "outstanding", "req_size", "resp_size", "cpus"});
+  // Channel-count sweep across the message size matrix, unpinned.
+  for (int channels : {1, 8, 64, 256}) {
+    for (int outstanding : {1, 4}) {
+      for (int size : {0, 4096, 256 * 1024}) {
+        b->Args({channels, outstanding, size, size, 0});
+      }
+    }
+  }
+  // Per-core scaling curve at a fixed load shape: restrict the process
+  // to 1, 2, 4, ... CPUs and watch rpcs_per_core.
+  for (int cpus = 1; cpus <= static_cast<int>(gpr_cpu_num_cores());
+       cpus *= 2) {
+    b->Args({64, 4, 4096, 4096, cpus});
+  }
+}
+
+BENCHMARK(BM_UnarySaturation)
+    ->Apply(SaturationArgs)
+    ->UseRealTime()
+    ->MeasureProcessCPUTime();
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,268 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark chaotic good's differentiators: the data endpoint matrix
+// (1/2/4/8 connections), large-message striping throughput, mixed stream
+// workloads, and reconnect cost. Every benchmark is also registered
+// against chttp2 on the identical TCP fixture so the two transports can
+// be compared side by side from one binary.
+// TODO(ctiller): fold back into bm_fullstack_streaming_ping_pong.cc once
+// chaotic good can run without custom experiment configuration.
+
+#include <optional>
+
+#include "test/core/test_util/build.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/chaotic_good_fixture.h"
+#include "test/cpp/microbenchmarks/fullstack_streaming_ping_pong.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+//******************************************************************************
+// BENCHMARKING KERNELS
+//
+
+// Two concurrent bidi streams on one channel: stream 0 ping-pongs small
+// (64 byte) messages while stream 1 ping-pongs large (state.range(0)
+// byte) messages in lockstep. chttp2 serializes both streams onto one
+// connection, so the large payload head-of-line blocks the small one;
+// chaotic good stripes the large payload across its data connections.
+// Watch how time-per-iteration changes with the data connection count.
+template <class Fixture>
+static void BM_MixedStreamingPingPong(benchmark::State& state) {
+  constexpr int kSmallMsgSize = 64;
+  const int large_msg_size = state.range(0);
+
+  EchoTestService::AsyncService service;
+  std::unique_ptr<Fixture> fixture(new Fixture(&service));
+  {
+    EchoRequest send_request[2];
+    EchoResponse send_response[2];
+    EchoRequest recv_request[2];
+    EchoResponse recv_response[2];
+    send_request[0].set_message(std::string(kSmallMsgSize, 'a'));
+    send_response[0].set_message(std::string(kSmallMsgSize, 'b'));
+    send_request[1].set_message(std::string(large_msg_size, 'a'));
+    send_response[1].set_message(std::string(large_msg_size, 'b'));
+
+    std::unique_ptr<EchoTestService::Stub> stub(
+        EchoTestService::NewStub(fixture->channel()));
+
+    ServerContext svr_ctx[2];
+    std::optional<ServerAsyncReaderWriter<EchoResponse, EchoRequest>>
+        response_rw[2];
+    ClientContext cli_ctx[2];
+    std::unique_ptr<ClientAsyncReaderWriter<EchoRequest, EchoResponse>>
+        request_rw[2];
+
+    // Establish both streams.
+    void* t;
+    bool ok;
+    int need_tags = 0;
+    for (int i = 0; i < 2; i++) {
+      response_rw[i].emplace(&svr_ctx[i]);
+      service.RequestBidiStream(&svr_ctx[i], &*response_rw[i], fixture->cq(),
+                                fixture->cq(), tag(i));
+      request_rw[i] =
+          stub->AsyncBidiStream(&cli_ctx[i], fixture->cq(), tag(2 + i));
+      need_tags |= (1 << i) | (1 << (2 + i));
+    }
+    while (need_tags) {
+      CHECK(fixture->cq()->Next(&t, &ok));
+      CHECK(ok);
+      int i = static_cast<int>(reinterpret_cast<intptr_t>(t));
+      CHECK(need_tags & (1 << i));
+      need_tags &= ~(1 << i);
+    }
+
+    for (auto _ : state) {
+      // Tags: client write = 0+stream, server recv = 2+stream,
+      // client recv = 4+stream, server send = 6+stream.
+      for (int i = 0; i < 2; i++) {
+        request_rw[i]->Write(send_request[i], tag(i));
+        response_rw[i]->Read(&recv_request[i], tag(2 + i));
+        request_rw[i]->Read(&recv_response[i], tag(4 + i));
+      }
+      need_tags = (1 << 0) | (1 << 1) | (1 << 2) | (1 << 3) | (1 << 4) |
+                  (1 << 5) | (1 << 6) | (1 << 7);
+      while (need_tags) {
+        CHECK(fixture->cq()->Next(&t, &ok));
+        CHECK(ok);
+        int i = static_cast<int>(reinterpret_cast<intptr_t>(t));
+
+        // If a server recv is complete, start that stream's send
+        if (i == 2 || i == 3) {
+          const int stream = i - 2;
+          response_rw[stream]->Write(send_response[stream], tag(6 + stream));
+        }
+
+        CHECK(need_tags & (1 << i));
+        need_tags &= ~(1 << i);
+      }
+    }
+
+    // Wind down both streams.
+    Status recv_status[2];
+    for (int i = 0; i < 2; i++) {
+      request_rw[i]->WritesDone(tag(i));
+      response_rw[i]->Finish(Status::OK, tag(2 + i));
+      request_rw[i]->Finish(&recv_status[i], tag(4 + i));
+    }
+    need_tags =
+        (1 << 0) | (1 << 1) | (1 << 2) | (1 << 3) | (1 << 4) | (1 << 5);
+    while (need_tags) {
+      CHECK(fixture->cq()->Next(&t, &ok));
+      int i = static_cast<int>(reinterpret_cast<intptr_t>(t));
+      CHECK(need_tags & (1 << i));
+      need_tags &= ~(1 << i);
+    }
+    CHECK(recv_status[0].ok());
+    CHECK(recv_status[1].ok());
+  }
+
+  fixture.reset();
+  state.SetBytesProcessed((kSmallMsgSize + large_msg_size) * 2 *
+                          state.iterations());
+}
+
+// Measures full transport (re)establishment: every iteration opens a
+// fresh channel with its own subchannel pool, brings up one stream --
+// which forces the connection handshake, and for chaotic good the
+// settings exchange plus the data connection fan-out -- and tears it
+// back down.
+template <class Fixture>
+static void BM_StreamingReconnect(benchmark::State& state) {
+  EchoTestService::AsyncService service;
+  std::unique_ptr<Fixture> fixture(new Fixture(&service));
+  void* t;
+  bool ok;
+  for (auto _ : state) {
+    auto stub = EchoTestService::NewStub(fixture->NewChannel());
+    ClientContext cli_ctx;
+    ServerContext svr_ctx;
+    ServerAsyncReaderWriter<EchoResponse, EchoRequest> response_rw(&svr_ctx);
+    service.RequestBidiStream(&svr_ctx, &response_rw, fixture->cq(),
+                              fixture->cq(), tag(0));
+    auto request_rw = stub->AsyncBidiStream(&cli_ctx, fixture->cq(), tag(1));
+    int need_tags = (1 << 0) | (1 << 1);
+    while (need_tags) {
+      CHECK(fixture->cq()->Next(&t, &ok));
+      CHECK(ok);
+      int i = static_cast<int>(reinterpret_cast<intptr_t>(t));
+      CHECK(need_tags & (1 << i));
+      need_tags &= ~(1 << i);
+    }
+    request_rw->WritesDone(tag(0));
+    response_rw.Finish(Status::OK, tag(1));
+    Status recv_status;
+    request_rw->Finish(&recv_status, tag(2));
+    need_tags = (1 << 0) | (1 << 1) | (1 << 2);
+    while (need_tags) {
+      CHECK(fixture->cq()->Next(&t, &ok));
+      int i = static_cast<int>(reinterpret_cast<intptr_t>(t));
+      CHECK(need_tags & (1 << i));
+      need_tags &= ~(1 << i);
+    }
+    CHECK(recv_status.ok());
+  }
+  fixture.reset();
+}
+
+//******************************************************************************
+// CONFIGURATIONS
+//
+
+static const int kMaxMessageSize = [] {
+  if (BuiltUnderMsan() || BuiltUnderTsan() || BuiltUnderUbsan()) {
+    // Scale down sizes for intensive benchmarks to avoid timeouts.
+    return 8 * 1024 * 1024;
+  }
+  return 128 * 1024 * 1024;
+}();
+
+// Generate Args for StreamingPingPong benchmarks. Currently generates args for
+// only "small streams" (i.e streams with 0, 1 or 2 messages)
+static void StreamingPingPongArgs(benchmark::internal::Benchmark* b) {
+  int msg_size = 0;
+
+  b->Args({0, 0});  // spl case: 0 ping-pong msgs (msg_size doesn't matter here)
+
+  for (msg_size = 0; msg_size <= kMaxMessageSize;
+       msg_size == 0 ? msg_size++ : msg_size *= 8) {
+    b->Args({msg_size, 1});
+    b->Args({msg_size, 2});
+  }
+}
+
+// The data endpoint matrix, plus chttp2 on the same fixture as baseline.
+using Chttp2Baseline = ChaoticGoodFixtureWithDataConnections<0>;
+using ChaoticGood1 = ChaoticGoodFixtureWithDataConnections<1>;
+using ChaoticGood2 = ChaoticGoodFixtureWithDataConnections<2>;
+using ChaoticGood4 = ChaoticGoodFixtureWithDataConnections<4>;
+using ChaoticGood8 = ChaoticGoodFixtureWithDataConnections<8>;
+
+#define CHAOTIC_GOOD_SUITE(kernel, args)                                \
+  BENCHMARK_TEMPLATE(kernel, Chttp2Baseline, NoOpMutator, NoOpMutator)  \
+      ->args;                                                           \
+  BENCHMARK_TEMPLATE(kernel, ChaoticGood1, NoOpMutator, NoOpMutator)    \
+      ->args;                                                           \
+  BENCHMARK_TEMPLATE(kernel, ChaoticGood2, NoOpMutator, NoOpMutator)    \
+      ->args;                                                           \
+  BENCHMARK_TEMPLATE(kernel, ChaoticGood4, NoOpMutator, NoOpMutator)    \
+      ->args;                                                           \
+  BENCHMARK_TEMPLATE(kernel, ChaoticGood8, NoOpMutator, NoOpMutator)->args
+
+// Stream setup/teardown and small-stream latency across the matrix.
+CHAOTIC_GOOD_SUITE(BM_StreamingPingPong, Apply(StreamingPingPongArgs));
+// Sustained per-message throughput on one stream; the large end of the
+// range is where striping across data connections should pay off.
+CHAOTIC_GOOD_SUITE(BM_StreamingPingPongMsgs, Range(0, kMaxMessageSize));
+
+#define CHAOTIC_GOOD_SUITE_NO_MUTATORS(kernel, ...)          \
+  BENCHMARK_TEMPLATE(kernel, Chttp2Baseline)->__VA_ARGS__;   \
+  BENCHMARK_TEMPLATE(kernel, ChaoticGood1)->__VA_ARGS__;     \
+  BENCHMARK_TEMPLATE(kernel, ChaoticGood2)->__VA_ARGS__;     \
+  BENCHMARK_TEMPLATE(kernel, ChaoticGood4)->__VA_ARGS__;     \
+  BENCHMARK_TEMPLATE(kernel, ChaoticGood8)->__VA_ARGS__
+
+// Mixed workload: small messages competing with large ones.
+CHAOTIC_GOOD_SUITE_NO_MUTATORS(BM_MixedStreamingPingPong,
+                               Range(128 * 1024, kMaxMessageSize));
+// Reconnect cost: chaotic good must bring up its data connections before
+// the transport is usable, so this grows with the matrix.
+CHAOTIC_GOOD_SUITE_NO_MUTATORS(BM_StreamingReconnect, UseRealTime());
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc_core::ForceEnableExperiment("event_engine_client", true);
+  grpc_core::ForceEnableExperiment("event_engine_listener", true);
+  grpc_core::ForceEnableExperiment("promise_based_client_call", true);
+  grpc_core::ForceEnableExperiment("chaotic_good", true);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
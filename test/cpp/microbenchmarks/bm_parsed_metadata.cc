@@ -0,0 +1,90 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark per-header parse cost into ParsedMetadata - in particular the
+// inline small-value path (timeouts, status codes, compression bits) versus
+// the slice and allocation paths.
+
+#include <benchmark/benchmark.h>
+#include <stdlib.h>
+
+#include "absl/strings/string_view.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/lib/slice/slice.h"
+
+namespace {
+
+void NoError(absl::string_view, const grpc_core::Slice&) { abort(); }
+
+void ParseBenchmark(benchmark::State& state, absl::string_view key,
+                    absl::string_view value) {
+  const auto value_slice = grpc_core::Slice::FromCopiedString(value);
+  const uint32_t transport_size =
+      grpc_core::ParsedMetadata<grpc_metadata_batch>::TransportSize(
+          static_cast<uint32_t>(key.length()),
+          static_cast<uint32_t>(value.length()));
+  for (auto _ : state) {
+    auto parsed = grpc_metadata_batch::Parse(key, value_slice.Ref(), false,
+                                             transport_size, NoError);
+    benchmark::DoNotOptimize(parsed);
+  }
+}
+
+// Small trivially copyable mementos: stored inline in ParsedMetadata, no
+// slice refs and no allocation.
+void BM_ParseTimeout(benchmark::State& state) {
+  ParseBenchmark(state, "grpc-timeout", "30S");
+}
+BENCHMARK(BM_ParseTimeout);
+
+void BM_ParseStatus(benchmark::State& state) {
+  ParseBenchmark(state, "grpc-status", "0");
+}
+BENCHMARK(BM_ParseStatus);
+
+void BM_ParseContentType(benchmark::State& state) {
+  ParseBenchmark(state, "content-type", "application/grpc");
+}
+BENCHMARK(BM_ParseContentType);
+
+void BM_ParseAcceptEncoding(benchmark::State& state) {
+  ParseBenchmark(state, "grpc-accept-encoding", "identity,deflate,gzip");
+}
+BENCHMARK(BM_ParseAcceptEncoding);
+
+// Slice-valued mementos: the value slice is retained.
+void BM_ParseUserAgent(benchmark::State& state) {
+  ParseBenchmark(state, "user-agent", "grpc-c/3.0.0-dev (linux; chttp2)");
+}
+BENCHMARK(BM_ParseUserAgent);
+
+// Unknown headers: key/value pair allocation path.
+void BM_ParseUnknownHeader(benchmark::State& state) {
+  ParseBenchmark(state, "not-a-known-header", "some-value");
+}
+BENCHMARK(BM_ParseUnknownHeader);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
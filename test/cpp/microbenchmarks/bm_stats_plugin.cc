@@ -78,6 +78,25 @@ void BM_AddCounterWithLabelsWithFakeStatsPlugin(benchmark::State& state) {
 }
 BENCHMARK(BM_AddCounterWithLabelsWithFakeStatsPlugin);
 
+void BM_AddCounterWithInternedLabelsWithFakeStatsPlugin(
+    benchmark::State& state) {
+  grpc_core::GlobalStatsPluginRegistryTestPeer::
+      ResetGlobalStatsPluginRegistry();
+  grpc_core::FakeStatsPluginBuilder().BuildAndRegister();
+  grpc_event_engine::experimental::ChannelArgsEndpointConfig endpoint_config;
+  auto stats_plugin_group =
+      grpc_core::GlobalStatsPluginRegistry::GetStatsPluginsForChannel(
+          grpc_core::experimental::StatsPluginChannelScope("", "",
+                                                           endpoint_config));
+  auto label_set = stats_plugin_group->MakeLabelSet(
+      kCounterWithLabelsHandle, {"val1", "val2", "val3"},
+      {"opt_val1", "opt_val2", "opt_val3"});
+  for (auto _ : state) {
+    stats_plugin_group->AddCounter(*label_set, 1);
+  }
+}
+BENCHMARK(BM_AddCounterWithInternedLabelsWithFakeStatsPlugin);
+
 void BM_AddCounterWithOTelPlugin(benchmark::State& state) {
   grpc_core::GlobalStatsPluginRegistryTestPeer::
       ResetGlobalStatsPluginRegistry();
@@ -152,6 +171,23 @@ void BM_AddCounterWithLabelsWithNoPlugin(benchmark::State& state) {
 }
 BENCHMARK(BM_AddCounterWithLabelsWithNoPlugin);
 
+void BM_AddCounterWithInternedLabelsWithNoPlugin(benchmark::State& state) {
+  grpc_core::GlobalStatsPluginRegistryTestPeer::
+      ResetGlobalStatsPluginRegistry();
+  grpc_event_engine::experimental::ChannelArgsEndpointConfig endpoint_config;
+  auto stats_plugin_group =
+      grpc_core::GlobalStatsPluginRegistry::GetStatsPluginsForChannel(
+          grpc_core::experimental::StatsPluginChannelScope("", "",
+                                                           endpoint_config));
+  auto label_set = stats_plugin_group->MakeLabelSet(
+      kCounterWithLabelsHandle, {"val1", "val2", "val3"},
+      {"opt_val1", "opt_val2", "opt_val3"});
+  for (auto _ : state) {
+    stats_plugin_group->AddCounter(*label_set, 1);
+  }
+}
+BENCHMARK(BM_AddCounterWithInternedLabelsWithNoPlugin);
+
 }  // namespace
 
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
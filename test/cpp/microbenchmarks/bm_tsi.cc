@@ -0,0 +1,351 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Microbenchmarks for the TSI record path: SSL frame protector
+// protect/unprotect throughput by record size, cipher and input
+// fragmentation, plus handshakes-per-second for full and session-resumed
+// handshakes. The ALTS zero-copy protector has its own harness in
+// bm_alts_zero_copy_protector.cc.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "src/core/tsi/ssl_transport_security.h"
+#include "src/core/tsi/transport_security.h"
+#include "src/core/tsi/transport_security_interface.h"
+#include "test/core/end2end/data/ssl_test_data.h"
+
+namespace {
+
+// Matches the server1 certificate in ssl_test_data.
+constexpr const char* kServerName = "foo.test.google.fr";
+
+tsi_ssl_client_handshaker_factory* MakeClientFactory(
+    tsi_tls_version tls_version, const char* cipher_suites,
+    tsi_ssl_session_cache* session_cache) {
+  tsi_ssl_client_handshaker_options options;
+  options.pem_root_certs = test_root_cert;
+  options.cipher_suites = cipher_suites;
+  options.session_cache = session_cache;
+  options.min_tls_version = tls_version;
+  options.max_tls_version = tls_version;
+  tsi_ssl_client_handshaker_factory* factory = nullptr;
+  CHECK(tsi_create_ssl_client_handshaker_factory_with_options(
+            &options, &factory) == TSI_OK);
+  return factory;
+}
+
+tsi_ssl_server_handshaker_factory* MakeServerFactory(
+    tsi_tls_version tls_version, const char* cipher_suites) {
+  tsi_ssl_pem_key_cert_pair key_cert_pair = {test_server1_key,
+                                             test_server1_cert};
+  tsi_ssl_server_handshaker_options options;
+  options.pem_key_cert_pairs = &key_cert_pair;
+  options.num_key_cert_pairs = 1;
+  options.cipher_suites = cipher_suites;
+  options.min_tls_version = tls_version;
+  options.max_tls_version = tls_version;
+  tsi_ssl_server_handshaker_factory* factory = nullptr;
+  CHECK(tsi_create_ssl_server_handshaker_factory_with_options(
+            &options, &factory) == TSI_OK);
+  return factory;
+}
+
+// Drives a client/server handshaker pair to completion. The SSL TSI
+// handshaker is synchronous, so this just ping-pongs each side's
+// bytes_to_send into the other until both produce a result.
+void DoHandshake(tsi_handshaker* client, tsi_handshaker* server,
+                 tsi_handshaker_result** client_result,
+                 tsi_handshaker_result** server_result) {
+  *client_result = nullptr;
+  *server_result = nullptr;
+  const unsigned char* to_server = nullptr;
+  size_t to_server_size = 0;
+  const unsigned char* to_client = nullptr;
+  size_t to_client_size = 0;
+  // The client speaks first.
+  CHECK(tsi_handshaker_next(client, nullptr, 0, &to_server, &to_server_size,
+                            client_result, nullptr, nullptr) == TSI_OK);
+  while (*client_result == nullptr || *server_result == nullptr) {
+    if (*server_result == nullptr) {
+      CHECK(tsi_handshaker_next(server, to_server, to_server_size, &to_client,
+                                &to_client_size, server_result, nullptr,
+                                nullptr) == TSI_OK);
+      to_server_size = 0;
+    }
+    if (*client_result == nullptr) {
+      CHECK(tsi_handshaker_next(client, to_client, to_client_size, &to_server,
+                                &to_server_size, client_result, nullptr,
+                                nullptr) == TSI_OK);
+      to_client_size = 0;
+    }
+  }
+}
+
+void CheckSessionReused(tsi_handshaker_result* client_result, bool reused) {
+  tsi_peer peer;
+  CHECK(tsi_handshaker_result_extract_peer(client_result, &peer) == TSI_OK);
+  const tsi_peer_property* property = tsi_peer_get_property_by_name(
+      &peer, TSI_SSL_SESSION_REUSED_PEER_PROPERTY);
+  CHECK_NE(property, nullptr);
+  CHECK_EQ(strncmp(property->value.data, reused ? "true" : "false",
+                   property->value.length),
+           0);
+  tsi_peer_destruct(&peer);
+}
+
+// Completes one handshake and returns both sides' frame protectors, sized
+// to emit records of at most max_frame_size bytes.
+void MakeProtectors(tsi_tls_version tls_version, const char* cipher_suites,
+                    size_t max_frame_size, tsi_frame_protector** client,
+                    tsi_frame_protector** server) {
+  tsi_ssl_client_handshaker_factory* client_factory =
+      MakeClientFactory(tls_version, cipher_suites, nullptr);
+  tsi_ssl_server_handshaker_factory* server_factory =
+      MakeServerFactory(tls_version, cipher_suites);
+  tsi_handshaker* client_handshaker = nullptr;
+  tsi_handshaker* server_handshaker = nullptr;
+  CHECK(tsi_ssl_client_handshaker_factory_create_handshaker(
+            client_factory, kServerName, 0, 0, std::nullopt,
+            &client_handshaker) == TSI_OK);
+  CHECK(tsi_ssl_server_handshaker_factory_create_handshaker(
+            server_factory, 0, 0, &server_handshaker) == TSI_OK);
+  tsi_handshaker_result* client_result = nullptr;
+  tsi_handshaker_result* server_result = nullptr;
+  DoHandshake(client_handshaker, server_handshaker, &client_result,
+              &server_result);
+  size_t client_max_frame_size = max_frame_size;
+  CHECK(tsi_handshaker_result_create_frame_protector(
+            client_result, &client_max_frame_size, client) == TSI_OK);
+  size_t server_max_frame_size = max_frame_size;
+  CHECK(tsi_handshaker_result_create_frame_protector(
+            server_result, &server_max_frame_size, server) == TSI_OK);
+  tsi_handshaker_result_destroy(client_result);
+  tsi_handshaker_result_destroy(server_result);
+  tsi_handshaker_destroy(client_handshaker);
+  tsi_handshaker_destroy(server_handshaker);
+  tsi_ssl_client_handshaker_factory_unref(client_factory);
+  tsi_ssl_server_handshaker_factory_unref(server_factory);
+}
+
+// Protects message_size bytes, feeding the protector fragment_size bytes
+// at a time to model fragmented slice buffers, then flushes. Returns the
+// number of protected bytes produced.
+size_t Protect(tsi_frame_protector* protector, const uint8_t* message,
+               size_t message_size, size_t fragment_size, uint8_t* out,
+               size_t out_capacity) {
+  size_t produced = 0;
+  while (message_size > 0) {
+    size_t fragment = std::min(fragment_size, message_size);
+    while (fragment > 0) {
+      size_t processed = fragment;
+      size_t out_size = out_capacity - produced;
+      CHECK(tsi_frame_protector_protect(protector, message, &processed,
+                                        out + produced, &out_size) == TSI_OK);
+      message += processed;
+      fragment -= processed;
+      message_size -= processed;
+      produced += out_size;
+    }
+  }
+  size_t still_pending = 0;
+  do {
+    size_t out_size = out_capacity - produced;
+    CHECK(tsi_frame_protector_protect_flush(protector, out + produced,
+                                            &out_size,
+                                            &still_pending) == TSI_OK);
+    produced += out_size;
+  } while (still_pending > 0);
+  return produced;
+}
+
+void Unprotect(tsi_frame_protector* protector, const uint8_t* protected_bytes,
+               size_t protected_size, uint8_t* out, size_t out_capacity) {
+  size_t consumed_out = 0;
+  while (protected_size > 0) {
+    size_t processed = protected_size;
+    size_t out_size = out_capacity - consumed_out;
+    CHECK(tsi_frame_protector_unprotect(protector, protected_bytes, &processed,
+                                        out + consumed_out,
+                                        &out_size) == TSI_OK);
+    protected_bytes += processed;
+    protected_size -= processed;
+    consumed_out += out_size;
+  }
+}
+
+std::vector<uint8_t> MakeMessage(size_t size) {
+  std::vector<uint8_t> message(size);
+  for (size_t i = 0; i < size; i++) {
+    message[i] = static_cast<uint8_t>(i);
+  }
+  return message;
+}
+
+// Generous bound for record framing overhead across the frame sizes and
+// ciphers benchmarked here.
+size_t ProtectedCapacity(size_t message_size, size_t max_frame_size) {
+  return message_size + 1024 * (1 + message_size / max_frame_size);
+}
+
+void BM_SslProtect(benchmark::State& state, tsi_tls_version tls_version,
+                   const char* cipher_suites) {
+  const size_t message_size = state.range(0);
+  const size_t fragment_size =
+      state.range(1) == 0 ? message_size : state.range(1);
+  const size_t max_frame_size = state.range(2);
+  tsi_frame_protector* client = nullptr;
+  tsi_frame_protector* server = nullptr;
+  MakeProtectors(tls_version, cipher_suites, max_frame_size, &client, &server);
+  std::vector<uint8_t> message = MakeMessage(message_size);
+  std::vector<uint8_t> protected_buf(
+      ProtectedCapacity(message_size, max_frame_size));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Protect(client, message.data(), message_size,
+                                     fragment_size, protected_buf.data(),
+                                     protected_buf.size()));
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          message_size);
+  tsi_frame_protector_destroy(client);
+  tsi_frame_protector_destroy(server);
+}
+
+void BM_SslProtectUnprotect(benchmark::State& state,
+                            tsi_tls_version tls_version,
+                            const char* cipher_suites) {
+  const size_t message_size = state.range(0);
+  const size_t fragment_size =
+      state.range(1) == 0 ? message_size : state.range(1);
+  const size_t max_frame_size = state.range(2);
+  tsi_frame_protector* client = nullptr;
+  tsi_frame_protector* server = nullptr;
+  MakeProtectors(tls_version, cipher_suites, max_frame_size, &client, &server);
+  std::vector<uint8_t> message = MakeMessage(message_size);
+  std::vector<uint8_t> protected_buf(
+      ProtectedCapacity(message_size, max_frame_size));
+  std::vector<uint8_t> unprotected_buf(protected_buf.size());
+  // Record sequence numbers advance on every record, so each iteration
+  // must protect fresh bytes for unprotect to verify.
+  for (auto _ : state) {
+    size_t protected_size =
+        Protect(client, message.data(), message_size, fragment_size,
+                protected_buf.data(), protected_buf.size());
+    Unprotect(server, protected_buf.data(), protected_size,
+              unprotected_buf.data(), unprotected_buf.size());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          message_size);
+  tsi_frame_protector_destroy(client);
+  tsi_frame_protector_destroy(server);
+}
+
+void BM_SslHandshake(benchmark::State& state, tsi_tls_version tls_version,
+                     bool resume) {
+  tsi_ssl_session_cache* session_cache =
+      resume ? tsi_ssl_session_cache_create_lru(16) : nullptr;
+  tsi_ssl_client_handshaker_factory* client_factory =
+      MakeClientFactory(tls_version, nullptr, session_cache);
+  tsi_ssl_server_handshaker_factory* server_factory =
+      MakeServerFactory(tls_version, nullptr);
+  auto handshake = [&](bool check_reused) {
+    tsi_handshaker* client_handshaker = nullptr;
+    tsi_handshaker* server_handshaker = nullptr;
+    CHECK(tsi_ssl_client_handshaker_factory_create_handshaker(
+              client_factory, kServerName, 0, 0, std::nullopt,
+              &client_handshaker) == TSI_OK);
+    CHECK(tsi_ssl_server_handshaker_factory_create_handshaker(
+              server_factory, 0, 0, &server_handshaker) == TSI_OK);
+    tsi_handshaker_result* client_result = nullptr;
+    tsi_handshaker_result* server_result = nullptr;
+    DoHandshake(client_handshaker, server_handshaker, &client_result,
+                &server_result);
+    CheckSessionReused(client_result, check_reused);
+    tsi_handshaker_result_destroy(client_result);
+    tsi_handshaker_result_destroy(server_result);
+    tsi_handshaker_destroy(client_handshaker);
+    tsi_handshaker_destroy(server_handshaker);
+  };
+  // Prime the session cache with one full handshake.
+  if (resume) handshake(/*check_reused=*/false);
+  for (auto _ : state) {
+    handshake(/*check_reused=*/resume);
+  }
+  state.SetItemsProcessed(state.iterations());
+  tsi_ssl_client_handshaker_factory_unref(client_factory);
+  tsi_ssl_server_handshaker_factory_unref(server_factory);
+  if (session_cache != nullptr) tsi_ssl_session_cache_unref(session_cache);
+}
+
+// message size x fragment size (0 = unfragmented) x max record size.
+void RecordPathArgs(benchmark::internal::Benchmark* b) {
+  b->ArgsProduct({{16 * 1024, 1024 * 1024}, {0, 4096}, {4096, 16384}})
+      ->ArgNames({"msg", "frag", "record"});
+}
+
+BENCHMARK_CAPTURE(BM_SslProtect, tls12_aes128_gcm, tsi_tls_version::TSI_TLS1_2,
+                  "ECDHE-RSA-AES128-GCM-SHA256")
+    ->Apply(RecordPathArgs);
+BENCHMARK_CAPTURE(BM_SslProtect, tls12_aes256_gcm, tsi_tls_version::TSI_TLS1_2,
+                  "ECDHE-RSA-AES256-GCM-SHA384")
+    ->Apply(RecordPathArgs);
+BENCHMARK_CAPTURE(BM_SslProtect, tls12_chacha20, tsi_tls_version::TSI_TLS1_2,
+                  "ECDHE-RSA-CHACHA20-POLY1305")
+    ->Apply(RecordPathArgs);
+BENCHMARK_CAPTURE(BM_SslProtect, tls13, tsi_tls_version::TSI_TLS1_3, nullptr)
+    ->Apply(RecordPathArgs);
+
+BENCHMARK_CAPTURE(BM_SslProtectUnprotect, tls12_aes128_gcm,
+                  tsi_tls_version::TSI_TLS1_2, "ECDHE-RSA-AES128-GCM-SHA256")
+    ->Apply(RecordPathArgs);
+BENCHMARK_CAPTURE(BM_SslProtectUnprotect, tls12_aes256_gcm,
+                  tsi_tls_version::TSI_TLS1_2, "ECDHE-RSA-AES256-GCM-SHA384")
+    ->Apply(RecordPathArgs);
+BENCHMARK_CAPTURE(BM_SslProtectUnprotect, tls12_chacha20,
+                  tsi_tls_version::TSI_TLS1_2, "ECDHE-RSA-CHACHA20-POLY1305")
+    ->Apply(RecordPathArgs);
+BENCHMARK_CAPTURE(BM_SslProtectUnprotect, tls13, tsi_tls_version::TSI_TLS1_3,
+                  nullptr)
+    ->Apply(RecordPathArgs);
+
+BENCHMARK_CAPTURE(BM_SslHandshake, tls12_full, tsi_tls_version::TSI_TLS1_2,
+                  /*resume=*/false);
+BENCHMARK_CAPTURE(BM_SslHandshake, tls12_resumed, tsi_tls_version::TSI_TLS1_2,
+                  /*resume=*/true);
+// TLS 1.3 tickets arrive after the handshake completes, over the record
+// path that this synchronous driver does not run, so only the full
+// handshake is benchmarked there.
+BENCHMARK_CAPTURE(BM_SslHandshake, tls13_full, tsi_tls_version::TSI_TLS1_3,
+                  /*resume=*/false);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
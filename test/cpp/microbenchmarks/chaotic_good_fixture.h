@@ -0,0 +1,119 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Fixtures for benchmarking chaotic good end2end.
+// TODO(ctiller): fold back into fullstack_fixtures.h once chaotic good can
+// run without custom experiment configuration.
+
+#ifndef GRPC_TEST_CPP_MICROBENCHMARKS_CHAOTIC_GOOD_FIXTURE_H
+#define GRPC_TEST_CPP_MICROBENCHMARKS_CHAOTIC_GOOD_FIXTURE_H
+
+#include <grpc/impl/channel_arg_names.h>
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/security/server_credentials.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "src/core/ext/transport/chaotic_good/chaotic_good.h"
+#include "src/core/ext/transport/chaotic_good/server/chaotic_good_server.h"
+#include "src/core/transport/endpoint_transport.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/fullstack_fixtures.h"
+
+namespace grpc {
+namespace testing {
+
+// Fullstack fixture over a real TCP connection, templated on the number of
+// chaotic good data connections so benchmarks can sweep the data endpoint
+// matrix. Zero data connections selects chttp2 instead, so the identical
+// fixture (same port handling, same channel construction) doubles as the
+// comparison baseline within one binary.
+template <int kDataConnections>
+class ChaoticGoodFixtureWithDataConnections : public BaseFixture {
+ public:
+  explicit ChaoticGoodFixtureWithDataConnections(
+      Service* service,
+      const FixtureConfiguration& config = FixtureConfiguration()) {
+    address_ = MakeAddress(&port_);
+    ServerBuilder b;
+    if (kDataConnections > 0) {
+      b.AddChannelArgument(
+          GRPC_ARG_PREFERRED_TRANSPORT_PROTOCOLS,
+          std::string(grpc_core::chaotic_good::WireFormatPreferences()));
+      b.AddChannelArgument(GRPC_ARG_CHAOTIC_GOOD_DATA_CONNECTIONS,
+                           kDataConnections);
+    }
+    b.AddListeningPort(address_, InsecureServerCredentials());
+    cq_ = b.AddCompletionQueue(true);
+    b.RegisterService(service);
+    config.ApplyCommonServerBuilderConfig(&b);
+    server_ = b.BuildAndStart();
+    config.ApplyCommonChannelArguments(&args_);
+    if (kDataConnections > 0) {
+      args_.SetString(
+          GRPC_ARG_PREFERRED_TRANSPORT_PROTOCOLS,
+          std::string(grpc_core::chaotic_good::WireFormatPreferences()));
+    }
+    channel_ = NewChannel();
+  }
+
+  ~ChaoticGoodFixtureWithDataConnections() override {
+    server_->Shutdown(grpc_timeout_milliseconds_to_deadline(0));
+    cq_->Shutdown();
+    void* tag;
+    bool ok;
+    while (cq_->Next(&tag, &ok)) {
+    }
+    grpc_recycle_unused_port(port_);
+  }
+
+  // Opens a fresh channel -- and with it a fresh transport: control
+  // connection plus data connections -- to the same server. Each channel
+  // gets a local subchannel pool so repeated calls really reconnect
+  // instead of picking up the already-connected shared subchannel; this is
+  // what the reconnect benchmarks exercise.
+  std::shared_ptr<Channel> NewChannel() {
+    ChannelArguments args = args_;
+    args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+    return grpc::CreateCustomChannel(address_, InsecureChannelCredentials(),
+                                     args);
+  }
+
+  ServerCompletionQueue* cq() { return cq_.get(); }
+  std::shared_ptr<Channel> channel() { return channel_; }
+
+ private:
+  static std::string MakeAddress(int* port) {
+    *port = grpc_pick_unused_port_or_die();
+    std::stringstream addr;
+    addr << "localhost:" << *port;
+    return addr.str();
+  }
+
+  std::string address_;
+  ChannelArguments args_;
+  std::unique_ptr<Server> server_;
+  std::unique_ptr<ServerCompletionQueue> cq_;
+  std::shared_ptr<Channel> channel_;
+  int port_;
+};
+
+using ChaoticGoodFixture = ChaoticGoodFixtureWithDataConnections<1>;
+
+}  // namespace testing
+}  // namespace grpc
+
+#endif  // GRPC_TEST_CPP_MICROBENCHMARKS_CHAOTIC_GOOD_FIXTURE_H
@@ -27,6 +27,7 @@
 
 #include "absl/log/check.h"
 #include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/allocation_counter.h"
 #include "test/cpp/microbenchmarks/fullstack_context_mutators.h"
 #include "test/cpp/microbenchmarks/fullstack_fixtures.h"
 
@@ -67,6 +68,8 @@ static void BM_StreamingPingPong(benchmark::State& state) {
     std::unique_ptr<EchoTestService::Stub> stub(
         EchoTestService::NewStub(fixture->channel()));
 
+    const uint64_t allocs_before =
+        grpc_core::testing::TotalAllocationCount();
     for (auto _ : state) {
       ServerContext svr_ctx;
       ServerContextMutator svr_ctx_mut(&svr_ctx);
@@ -131,6 +134,15 @@ static void BM_StreamingPingPong(benchmark::State& state) {
 
       CHECK(recv_status.ok());
     }
+    // One iteration is a whole stream; gate only the pure setup/teardown
+    // shape, since message allocations are covered by
+    // BM_StreamingPingPongMsgs.
+    state.counters["allocs_per_stream"] =
+        grpc_core::testing::CheckAllocsPerIteration(
+            allocs_before, state.iterations(), "BM_StreamingPingPong",
+            (msg_size == 0 && max_ping_pongs == 0)
+                ? "GRPC_BENCHMARK_MAX_ALLOCS_PER_STREAM"
+                : nullptr);
   }
 
   fixture.reset();
@@ -181,6 +193,8 @@ static void BM_StreamingPingPongMsgs(benchmark::State& state) {
       need_tags &= ~(1 << i);
     }
 
+    const uint64_t allocs_before =
+        grpc_core::testing::TotalAllocationCount();
     for (auto _ : state) {
       request_rw->Write(send_request, tag(0));   // Start client send
       response_rw.Read(&recv_request, tag(1));   // Start server recv
@@ -201,6 +215,13 @@ static void BM_StreamingPingPongMsgs(benchmark::State& state) {
         need_tags &= ~(1 << i);
       }
     }
+    // One iteration is one ping-pong: two messages on the wire. Gate the
+    // empty-message shape only; payload allocations scale with msg_size.
+    state.counters["allocs_per_ping_pong"] =
+        grpc_core::testing::CheckAllocsPerIteration(
+            allocs_before, state.iterations(), "BM_StreamingPingPongMsgs",
+            msg_size == 0 ? "GRPC_BENCHMARK_MAX_ALLOCS_PER_PING_PONG"
+                          : nullptr);
 
     request_rw->WritesDone(tag(0));
     response_rw.Finish(Status::OK, tag(1));
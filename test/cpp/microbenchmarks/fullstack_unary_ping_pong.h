@@ -27,6 +27,7 @@
 
 #include "absl/log/check.h"
 #include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/allocation_counter.h"
 #include "test/cpp/microbenchmarks/fullstack_context_mutators.h"
 #include "test/cpp/microbenchmarks/fullstack_fixtures.h"
 
@@ -74,6 +75,7 @@ static void BM_UnaryPingPong(benchmark::State& state) {
                       fixture->cq(), tag(1));
   std::unique_ptr<EchoTestService::Stub> stub(
       EchoTestService::NewStub(fixture->channel()));
+  const uint64_t allocs_before = grpc_core::testing::TotalAllocationCount();
   for (auto _ : state) {
     GRPC_LATENT_SEE_PARENT_SCOPE("OneRequest");
     recv_response.Clear();
@@ -114,6 +116,14 @@ static void BM_UnaryPingPong(benchmark::State& state) {
                           tag(slot));
     }
   }
+  // Only the empty-message shape is gated: payload allocations scale with
+  // message size, so larger shapes just report their counter.
+  state.counters["allocs_per_rpc"] =
+      grpc_core::testing::CheckAllocsPerIteration(
+          allocs_before, state.iterations(), "BM_UnaryPingPong",
+          (state.range(0) == 0 && state.range(1) == 0)
+              ? "GRPC_BENCHMARK_MAX_ALLOCS_PER_RPC"
+              : nullptr);
   stub.reset();
   fixture.reset();
   server_env[0]->~ServerEnv();
@@ -28,6 +28,7 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
 #include <thread>
@@ -136,12 +137,31 @@ class HistogramEntry final {
     status_used_ = true;
     status_ = status;
   }
+  bool saturated() const { return saturated_; }
+  void set_saturated(bool saturated) { saturated_ = saturated; }
 
  private:
   bool value_used_;
   double value_;
   bool status_used_;
   int status_;
+  // True open-loop mode: the RPC was issued while more RPCs were
+  // outstanding than configured slots, i.e. past saturation.
+  bool saturated_ = false;
+};
+
+// Shared state for true open-loop load (see PoissonParams.true_open_loop):
+// arrivals are issued on schedule independent of completions, growing the
+// set of outstanding RPCs up to max_outstanding and dropping arrivals past
+// that cap.
+struct OpenLoopState {
+  bool enabled = false;
+  // client_channels * outstanding_rpcs_per_channel.
+  int configured_slots = 0;
+  int max_outstanding = 0;
+  int rpc_timeout_ms = 0;
+  std::atomic<int> outstanding{0};
+  std::atomic<uint64_t> dropped_arrivals{0};
 };
 
 typedef std::unordered_map<int, int64_t> StatusHistogram;
@@ -167,6 +187,7 @@ class Client {
 
   ClientStats Mark(bool reset) {
     Histogram latencies;
+    Histogram saturated_latencies;
     StatusHistogram statuses;
     UsageTimer::Result timer_result;
 
@@ -174,25 +195,34 @@ class Client {
 
     int cur_poll_count = GetPollCount();
     int poll_count = cur_poll_count - last_reset_poll_count_;
+    uint64_t cur_dropped_arrivals =
+        open_loop_.dropped_arrivals.load(std::memory_order_relaxed);
+    uint64_t dropped_arrivals =
+        cur_dropped_arrivals - last_reset_dropped_arrivals_;
     if (reset) {
       std::vector<Histogram> to_merge(threads_.size());
+      std::vector<Histogram> to_merge_saturated(threads_.size());
       std::vector<StatusHistogram> to_merge_status(threads_.size());
 
       for (size_t i = 0; i < threads_.size(); i++) {
-        threads_[i]->BeginSwap(&to_merge[i], &to_merge_status[i]);
+        threads_[i]->BeginSwap(&to_merge[i], &to_merge_saturated[i],
+                               &to_merge_status[i]);
       }
       std::unique_ptr<UsageTimer> timer(new UsageTimer);
       timer_.swap(timer);
       for (size_t i = 0; i < threads_.size(); i++) {
         latencies.Merge(to_merge[i]);
+        saturated_latencies.Merge(to_merge_saturated[i]);
         MergeStatusHistogram(to_merge_status[i], &statuses);
       }
       timer_result = timer->Mark();
       last_reset_poll_count_ = cur_poll_count;
+      last_reset_dropped_arrivals_ = cur_dropped_arrivals;
     } else {
       // merge snapshots of each thread histogram
       for (size_t i = 0; i < threads_.size(); i++) {
-        threads_[i]->MergeStatsInto(&latencies, &statuses);
+        threads_[i]->MergeStatsInto(&latencies, &saturated_latencies,
+                                    &statuses);
       }
       timer_result = timer_->Mark();
     }
@@ -222,6 +252,10 @@ class Client {
     stats.set_time_system(timer_result.system);
     stats.set_time_user(timer_result.user);
     stats.set_cq_poll_count(poll_count);
+    if (open_loop_.enabled) {
+      saturated_latencies.FillProto(stats.mutable_saturated_latencies());
+      stats.set_dropped_arrivals(dropped_arrivals);
+    }
     return stats;
   }
 
@@ -269,15 +303,17 @@ class Client {
 
     ~Thread() { impl_.join(); }
 
-    void BeginSwap(Histogram* n, StatusHistogram* s) {
+    void BeginSwap(Histogram* n, Histogram* sat, StatusHistogram* s) {
       std::lock_guard<std::mutex> g(mu_);
       n->Swap(&histogram_);
+      sat->Swap(&saturated_histogram_);
       s->swap(statuses_);
     }
 
-    void MergeStatsInto(Histogram* hist, StatusHistogram* s) {
+    void MergeStatsInto(Histogram* hist, Histogram* sat, StatusHistogram* s) {
       std::unique_lock<std::mutex> g(mu_);
       hist->Merge(histogram_);
+      sat->Merge(saturated_histogram_);
       MergeStatusHistogram(statuses_, s);
     }
 
@@ -289,6 +325,7 @@ class Client {
       std::lock_guard<std::mutex> g(mu_);
       if (entry->value_used()) {
         histogram_.Add(entry->value());
+        if (entry->saturated()) saturated_histogram_.Add(entry->value());
         if (client_->GetLatencyCollectionIntervalInSeconds() > 0) {
           histogram_per_interval_.Add(entry->value());
           double now = UsageTimer::Now();
@@ -329,6 +366,7 @@ class Client {
 
     std::mutex mu_;
     Histogram histogram_;
+    Histogram saturated_histogram_;
     StatusHistogram statuses_;
     Client* client_;
     const size_t idx_;
@@ -372,6 +410,16 @@ class Client {
       case LoadParams::kPoisson:
         random_dist = std::make_unique<ExpDist>(load.poisson().offered_load() /
                                                 num_threads);
+        if (load.poisson().true_open_loop()) {
+          open_loop_.enabled = true;
+          open_loop_.configured_slots = config.client_channels() *
+                                        config.outstanding_rpcs_per_channel();
+          open_loop_.max_outstanding =
+              load.poisson().max_outstanding() > 0
+                  ? load.poisson().max_outstanding()
+                  : 16 * open_loop_.configured_slots;
+          open_loop_.rpc_timeout_ms = load.poisson().rpc_timeout_ms();
+        }
         break;
       default:
         grpc_core::Crash("unreachable");
@@ -398,6 +446,8 @@ class Client {
                         : std::bind(&Client::NextIssueTime, this, thread_idx);
   }
 
+  OpenLoopState* open_loop_state() { return &open_loop_; }
+
   virtual void ThreadFunc(size_t thread_idx, Client::Thread* t) = 0;
 
   std::vector<std::unique_ptr<Thread>> threads_;
@@ -405,6 +455,7 @@ class Client {
 
   InterarrivalTimer interarrival_timer_;
   std::vector<gpr_timespec> next_time_;
+  OpenLoopState open_loop_;
 
   std::mutex thread_completion_mu_;
   size_t threads_remaining_;
@@ -414,6 +465,7 @@ class Client {
   bool started_requests_;
 
   int last_reset_poll_count_;
+  uint64_t last_reset_dropped_arrivals_ = 0;
 
   void MaybeStartRequests() {
     if (!started_requests_) {
@@ -61,6 +61,11 @@ class ClientRpcContext {
 
   virtual void Start(CompletionQueue* cq, const ClientConfig& config) = 0;
   virtual void TryCancel() = 0;
+  // True open-loop load (only honored by the unary context): contexts
+  // that implement it spawn their successor at issue time instead of at
+  // completion time, so the poll loop must not clone them when done.
+  virtual void SetOpenLoopState(OpenLoopState* /*open_loop*/) {}
+  virtual bool SpawnOnDone() { return true; }
 };
 
 template <class RequestType, class ResponseType>
@@ -92,6 +97,31 @@ class ClientRpcContextUnaryImpl : public ClientRpcContext {
   bool RunNextState(bool /*ok*/, HistogramEntry* entry) override {
     switch (next_state_) {
       case State::READY:
+        if (open_loop_ != nullptr && open_loop_->enabled) {
+          // True open loop: this arrival fires on schedule no matter how
+          // many RPCs are still outstanding. Spawn the next arrival now
+          // rather than on completion, unless the cap has been reached,
+          // in which case the arrival is dropped and this context just
+          // re-arms for the next scheduled one.
+          int outstanding =
+              open_loop_->outstanding.fetch_add(1, std::memory_order_relaxed) +
+              1;
+          if (outstanding > open_loop_->max_outstanding) {
+            open_loop_->outstanding.fetch_sub(1, std::memory_order_relaxed);
+            open_loop_->dropped_arrivals.fetch_add(1,
+                                                   std::memory_order_relaxed);
+            alarm_->Set(cq_, next_issue_(), ClientRpcContext::tag(this));
+            return true;
+          }
+          saturated_ = outstanding > open_loop_->configured_slots;
+          StartNewClone(cq_);
+          if (open_loop_->rpc_timeout_ms > 0) {
+            context_.set_deadline(
+                gpr_time_add(gpr_now(GPR_CLOCK_REALTIME),
+                             gpr_time_from_millis(open_loop_->rpc_timeout_ms,
+                                                  GPR_TIMESPAN)));
+          }
+        }
         start_ = UsageTimer::Now();
         response_reader_ = prepare_req_(stub_, &context_, req_, cq_);
         response_reader_->StartCall();
@@ -100,8 +130,12 @@ class ClientRpcContextUnaryImpl : public ClientRpcContext {
                                  ClientRpcContext::tag(this));
         return true;
       case State::RESP_DONE:
+        if (open_loop_ != nullptr && open_loop_->enabled) {
+          open_loop_->outstanding.fetch_sub(1, std::memory_order_relaxed);
+        }
         if (status_.ok()) {
           entry->set_value((UsageTimer::Now() - start_) * 1e9);
+          entry->set_saturated(saturated_);
         }
         callback_(status_, &response_, entry);
         next_state_ = State::INVALID;
@@ -114,9 +148,16 @@ class ClientRpcContextUnaryImpl : public ClientRpcContext {
   void StartNewClone(CompletionQueue* cq) override {
     auto* clone = new ClientRpcContextUnaryImpl(stub_, req_, next_issue_,
                                                 prepare_req_, callback_);
+    clone->open_loop_ = open_loop_;
     clone->StartInternal(cq);
   }
   void TryCancel() override { context_.TryCancel(); }
+  void SetOpenLoopState(OpenLoopState* open_loop) override {
+    open_loop_ = open_loop;
+  }
+  bool SpawnOnDone() override {
+    return open_loop_ == nullptr || !open_loop_->enabled;
+  }
 
  private:
   grpc::ClientContext context_;
@@ -135,6 +176,8 @@ class ClientRpcContextUnaryImpl : public ClientRpcContext {
       prepare_req_;
   grpc::Status status_;
   double start_;
+  OpenLoopState* open_loop_ = nullptr;
+  bool saturated_ = false;
   std::unique_ptr<grpc::ClientAsyncResponseReader<ResponseType>>
       response_reader_;
 
@@ -189,6 +232,7 @@ class AsyncClient : public ClientImpl<StubType, RequestType> {
         auto* cq = cli_cqs_[t].get();
         auto ctx =
             setup_ctx(channels_[ch].get_stub(), next_issuers_[t], request_);
+        ctx->SetOpenLoopState(this->open_loop_state());
         ctx->Start(cq, config);
         if (config.distribute_load_across_threads()) {
           t = (t + 1) % cli_cqs_.size();
@@ -282,8 +326,11 @@ class AsyncClient : public ClientImpl<StubType, RequestType> {
         [&, ctx, ok, entry_ptr, shutdown_mu]() {
           if (!ctx->RunNextState(ok, entry_ptr)) {
             // The RPC and callback are done, so clone the ctx
-            // and kickstart the new one
-            ctx->StartNewClone(cli_cqs_[cq_[thread_idx]].get());
+            // and kickstart the new one (open-loop contexts already
+            // spawned their successor at issue time)
+            if (ctx->SpawnOnDone()) {
+              ctx->StartNewClone(cli_cqs_[cq_[thread_idx]].get());
+            }
             delete ctx;
           }
           shutdown_mu->unlock();
@@ -203,6 +203,27 @@ static void postprocess_scenario_result(ScenarioResult* result) {
                                                               time_estimate);
   }
 
+  // For true open-loop scenarios, report behavior past saturation:
+  // dropped-arrival rate and latency percentiles over just the RPCs
+  // issued while the client had more outstanding than configured slots.
+  int64_t dropped_arrivals = 0;
+  Histogram saturated_histogram;
+  for (int i = 0; i < result->client_stats_size(); i++) {
+    const auto& client_stat = result->client_stats(i);
+    dropped_arrivals += client_stat.dropped_arrivals();
+    saturated_histogram.MergeProto(client_stat.saturated_latencies());
+  }
+  if (dropped_arrivals > 0 || saturated_histogram.Count() > 0) {
+    result->mutable_summary()->set_dropped_arrivals_per_second(
+        dropped_arrivals / time_estimate);
+    result->mutable_summary()->set_saturated_latency_50(
+        saturated_histogram.Percentile(50));
+    result->mutable_summary()->set_saturated_latency_95(
+        saturated_histogram.Percentile(95));
+    result->mutable_summary()->set_saturated_latency_99(
+        saturated_histogram.Percentile(99));
+  }
+
   // Fill in data for other metrics required in result summary
   auto qps_per_server_core = qps / sum(result->server_cores(), Cores);
   result->mutable_summary()->set_qps_per_server_core(qps_per_server_core);
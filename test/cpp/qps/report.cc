@@ -100,6 +100,16 @@ void GprLogReporter::ReportLatency(const ScenarioResult& result) {
             << result.summary().latency_95() / 1000 << "/"
             << result.summary().latency_99() / 1000 << "/"
             << result.summary().latency_999() / 1000 << " us";
+  if (result.summary().saturated_latency_99() > 0) {
+    LOG(INFO) << "Saturated latencies (50/95/99%-ile): "
+              << result.summary().saturated_latency_50() / 1000 << "/"
+              << result.summary().saturated_latency_95() / 1000 << "/"
+              << result.summary().saturated_latency_99() / 1000 << " us";
+  }
+  if (result.summary().dropped_arrivals_per_second() > 0) {
+    LOG(INFO) << "Dropped arrivals/second: "
+              << result.summary().dropped_arrivals_per_second();
+  }
 }
 
 void GprLogReporter::ReportTimes(const ScenarioResult& result) {
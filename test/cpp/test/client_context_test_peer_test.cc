@@ -70,6 +70,29 @@ TEST(ClientContextTestPeerTest, GetSendInitialMetadata) {
   ASSERT_EQ(metadata, peer.GetSendInitialMetadata());
 }
 
+TEST(ClientContextTestPeerTest, ResetReturnsContextToFreshState) {
+  ClientContext context;
+  ClientContextTestPeer peer(&context);
+
+  context.AddMetadata(key1, val1);
+  context.set_deadline(std::chrono::system_clock::now());
+  context.set_wait_for_ready(true);
+  peer.AddServerInitialMetadata(key2, val2);
+
+  context.Reset();
+
+  ASSERT_TRUE(peer.GetSendInitialMetadata().empty());
+  ASSERT_TRUE(context.GetServerInitialMetadata().empty());
+  ASSERT_EQ(gpr_inf_future(GPR_CLOCK_REALTIME).tv_sec,
+            context.raw_deadline().tv_sec);
+
+  // The context is usable again after a reset.
+  context.AddMetadata(key2, val2);
+  std::multimap<std::string, std::string> metadata;
+  metadata.insert(std::pair<std::string, std::string>(key2, val2));
+  ASSERT_EQ(metadata, peer.GetSendInitialMetadata());
+}
+
 }  // namespace testing
 }  // namespace grpc
 
@@ -103,6 +103,23 @@ TEST_F(ByteBufferTest, Dump) {
   EXPECT_TRUE(SliceEqual(slices[1], world));
 }
 
+TEST_F(ByteBufferTest, MoveStealsContents) {
+  std::vector<Slice> slices;
+  slices.emplace_back(kContent1);
+  ByteBuffer buffer(&slices[0], 1);
+  ByteBuffer moved_to(std::move(buffer));
+  EXPECT_TRUE(moved_to.Valid());
+  EXPECT_EQ(strlen(kContent1), moved_to.Length());
+  // NOLINTNEXTLINE(bugprone-use-after-move)
+  EXPECT_FALSE(buffer.Valid());
+  ByteBuffer assigned_to;
+  assigned_to = std::move(moved_to);
+  EXPECT_TRUE(assigned_to.Valid());
+  EXPECT_EQ(strlen(kContent1), assigned_to.Length());
+  // NOLINTNEXTLINE(bugprone-use-after-move)
+  EXPECT_FALSE(moved_to.Valid());
+}
+
 TEST_F(ByteBufferTest, SerializationMakesCopy) {
   grpc_slice hello = grpc_slice_from_copied_string(kContent1);
   grpc_slice world = grpc_slice_from_copied_string(kContent2);
@@ -139,6 +156,27 @@ TEST_F(ByteBufferTest, TrySingleSliceWithMultipleSlices) {
   EXPECT_FALSE(buffer.TrySingleSlice(&slice).ok());
 }
 
+TEST_F(ByteBufferTest, FlattenToSliceWithSingleSlice) {
+  std::vector<Slice> slices;
+  slices.emplace_back(kContent1);
+  ByteBuffer buffer(&slices[0], 1);
+  Slice slice;
+  EXPECT_TRUE(buffer.FlattenToSlice(&slice).ok());
+  EXPECT_EQ(slice.size(), slices[0].size());
+  // Single-slice buffers are viewed in place rather than copied.
+  EXPECT_EQ(slice.begin(), slices[0].begin());
+}
+
+TEST_F(ByteBufferTest, FlattenToSliceWithMultipleSlices) {
+  std::vector<Slice> slices;
+  slices.emplace_back(kContent1);
+  slices.emplace_back(kContent2);
+  ByteBuffer buffer(&slices[0], 2);
+  Slice slice;
+  EXPECT_TRUE(buffer.FlattenToSlice(&slice).ok());
+  EXPECT_EQ(strlen(kContent1) + strlen(kContent2), slice.size());
+}
+
 TEST_F(ByteBufferTest, DumpToSingleSlice) {
   std::vector<Slice> slices;
   slices.emplace_back(kContent1);
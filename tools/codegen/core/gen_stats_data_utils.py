@@ -695,7 +695,7 @@ class StatsDataGenerator:
                     print(
                         (
                             "  PerCpu<Data>"
-                            " data_{PerCpuOptions().SetCpusPerShard(4).SetMaxShards(32)};"
+                            " data_{PerCpuOptions().SetCpusPerShard(1).SetMaxShards(128)};"
                         ),
                         file=H,
                     )